@@ -1,4 +1,6 @@
 #include <ares/scheduler/thread.hpp>
+#include <ares/scheduler/passive.hpp>
 #include <ares/scheduler/scheduler.hpp>
 #include <ares/scheduler/thread.cpp>
+#include <ares/scheduler/passive.cpp>
 #include <ares/scheduler/scheduler.cpp>
@@ -10,15 +10,16 @@ struct Readable {
   ~Readable() { reset(); }
 
   auto reset() -> void {
-    delete[] self.data;
+    if(!self.file) delete[] self.data;
+    self.file.reset();
     self.data = nullptr;
     self.size = 0;
     self.mask = 0;
   }
 
   auto allocate(u32 size, T fill = (T)~0ull) -> void {
-    if(!size) return reset();
-    delete[] self.data;
+    reset();
+    if(!size) return;
     self.size = size;
     self.mask = bit::round(self.size) - 1;
     self.data = new T[self.mask + 1];
@@ -32,6 +33,18 @@ struct Readable {
   }
 
   auto load(VFS::File fp) -> void {
+    //a private mapping that needs no mirroring is used in place of a copy.
+    //program() writes to it, which only ever touches this process's pages.
+    if(!self.size && fp->mapped() && !fp->offset() && fp->size() <= 0xffff'ffffull * sizeof(T)) {
+      u64 size = fp->size() / sizeof(T);
+      if(size && size * sizeof(T) == fp->size() && bit::round(size) == size) {
+        self.file = fp;
+        self.data = (T*)fp->data();
+        self.size = size;
+        self.mask = size - 1;
+        return;
+      }
+    }
     if(!self.size) allocate(fp->size());
     fp->read({(u8*)self.data, min(fp->size(), self.size * sizeof(T))});
     for(u32 address = self.size; address <= self.mask; address++) {
@@ -68,6 +81,7 @@ struct Readable {
     T* data = nullptr;
     u32 size = 0;
     u32 mask = 0;
+    VFS::File file;  //keeps an adopted mapping alive
   } self;
 };
 
@@ -11,9 +11,12 @@ auto Stream::setFrequency(f64 frequency) -> void {
 auto Stream::setResamplerFrequency(f64 resamplerFrequency) -> void {
   _resamplerFrequency = resamplerFrequency;
 
+  //the frontend is notified every 2ms of output; the queues hold 100ms so that
+  //streams which run ahead of the others can wait for them to catch up.
+  _batch = max(1u, (u32)(_resamplerFrequency * 0.002));
   for(auto& channel : _channels) {
     channel.nyquist.clear();
-    channel.resampler.reset(_frequency, _resamplerFrequency);
+    channel.resampler.reset(_frequency, _resamplerFrequency, _resamplerFrequency * 0.1);
   }
 
   if(_frequency >= _resamplerFrequency * 2) {
@@ -103,6 +106,10 @@ auto Stream::pending() const -> bool {
   return !_channels.empty() && _channels[0].resampler.pending();
 }
 
+auto Stream::buffered() const -> u32 {
+  return !_channels.empty() ? _channels[0].resampler.size() : 0;
+}
+
 auto Stream::read(f64 samples[]) -> u32 {
   for(u32 c : range(_channels.size())) {
     samples[c] = _channels[c].resampler.read() * !muted();
@@ -110,7 +117,18 @@ auto Stream::read(f64 samples[]) -> u32 {
   return _channels.size();
 }
 
+//reads the given number of frames, interleaved by channel.
+auto Stream::read(f64 samples[], u32 frames) -> u32 {
+  u32 channels = _channels.size();
+  for(u32 c : range(channels)) {
+    _channels[c].resampler.read(samples + c, frames, channels);
+    if(muted()) for(u32 n : range(frames)) samples[n * channels + c] = 0.0;
+  }
+  return channels;
+}
+
 auto Stream::write(const f64 samples[]) -> void {
+  u32 before = buffered();
   for(u32 c : range(_channels.size())) {
     f64 sample = samples[c] + 1e-25;  //constant offset used to suppress denormals
     for(auto& filter : _channels[c].filters) {
@@ -125,7 +143,7 @@ auto Stream::write(const f64 samples[]) -> void {
     _channels[c].resampler.write(sample);
   }
 
-  //if there are samples pending, then alert the frontend to possibly process them.
-  //this will generally happen when every audio stream has pending samples to be mixed.
-  if(pending()) platform->audio(std::static_pointer_cast<Core::Audio::Stream>(shared_from_this()));
+  //each time another batch of samples is pending, alert the frontend to possibly mix them.
+  //this will generally happen when every audio stream has a batch of samples to be mixed.
+  if(buffered() / _batch > before / _batch) platform->audio(std::static_pointer_cast<Core::Audio::Stream>(shared_from_this()));
 }
@@ -19,7 +19,9 @@ struct Stream : Audio {
   auto addHighShelfFilter(f64 cutoffFrequency, u32 order, f64 gain, f64 slope) -> void;
 
   auto pending() const -> bool;
+  auto buffered() const -> u32;
   auto read(f64 samples[]) -> u32;
+  auto read(f64 samples[], u32 frames) -> u32;
   auto write(const f64 samples[]) -> void;
 
   template<typename... P>
@@ -45,5 +47,6 @@ protected:
   std::vector<Channel> _channels;
   f64 _frequency = 48000.0;
   f64 _resamplerFrequency = 48000.0;
+  u32 _batch = 96;  //resampled frames per platform->audio() notification
   bool _muted = false;
 };
@@ -1,15 +1,45 @@
 struct Instruction : Tracer {
   DeclareClass(Instruction, "debugger.tracer.instruction")
 
+  //binary trace record: written to a ring buffer by the emulation thread and drained by the frontend,
+  //so that tracing does not disassemble or format anything while the game is running.
+  struct Record {
+    u64 clock;     //timestamp, in the core's own clock units
+    u64 address;
+    u32 opcode;
+    u8  index;     //a register written since the previous record, or NoRegister
+    u8  flags;
+    u8  reserved[2];
+    u64 value;     //the new value of that register
+  };
+
+  //binary trace files are this header followed by records, in host byte order.
+  struct FileHeader {
+    char signature[8];
+    u32  recordSize;
+    u32  addressBits;
+    char architecture[16];
+    char component[16];
+    char name[32];
+  };
+
+  static constexpr char FileSignature[8] = {'a', 'r', 'e', 's', 't', 'r', 'c', '1'};
+  static constexpr u8 NoRegister = 0xff;
+  static constexpr u8 Continuation = 0x01;  //record flag: carries only one more register written by the previous instruction
+  static constexpr u32 RingSize = 1 << 16;  //records; must be a power of two
+
   Instruction(string name = {}, string component = {}) : Tracer(name, component) {
     setMask(_mask);
     setDepth(_depth);
   }
 
+  auto enabled() const -> bool { return Tracer::enabled() || _binary.load(std::memory_order_relaxed); }
   auto addressBits() const -> u32 { return _addressBits; }
   auto addressMask() const -> u32 { return _addressMask; }
   auto mask() const -> bool { return _mask; }
   auto depth() const -> u32 { return _depth; }
+  auto binary() const -> bool { return _binary.load(std::memory_order_acquire); }
+  auto architecture() const -> string { return _architecture; }
 
   auto setAddressBits(u32 addressBits, u32 addressMask = 0) -> void {
     _addressBits = addressBits;
@@ -28,6 +58,35 @@ struct Instruction : Tracer {
     for(auto& history : _history) history = ~0ull;
   }
 
+  //binary mode sends records to the ring buffer instead of text to the platform log.
+  //the frontend must drain() the ring while it is enabled: the emulation thread waits when it is full.
+  auto setBinary(bool binary) -> void {
+    if(binary && !_ring) _ring = std::make_unique<Record[]>(RingSize);
+    if(binary && !_binary) {
+      //records left over from the previous trace must not start the next one
+      _head.store(0, std::memory_order_relaxed);
+      _tail.store(0, std::memory_order_relaxed);
+    }
+    _binary.store(binary, std::memory_order_release);
+    if(_toggle) _toggle();
+  }
+
+  auto fileHeader() const -> FileHeader {
+    FileHeader header{};
+    memory::copy(header.signature, FileSignature, sizeof(FileSignature));
+    header.recordSize = sizeof(Record);
+    header.addressBits = _addressBits;
+    memory::copy(header.architecture, sizeof(header.architecture) - 1, _architecture.data(), _architecture.size());
+    memory::copy(header.component, sizeof(header.component) - 1, _component.data(), _component.size());
+    memory::copy(header.name, sizeof(header.name) - 1, _name.data(), _name.size());
+    return header;
+  }
+
+  //names the instruction set, so that offline tools can pick a disassembler for binary traces.
+  auto setArchitecture(string architecture) -> void {
+    _architecture = architecture;
+  }
+
   auto setEnabled(bool enabled) -> void {
     Tracer::setTerminal(enabled);
     if(!enabled) {
@@ -95,6 +154,29 @@ struct Instruction : Tracer {
     PlatformLog(std::dynamic_pointer_cast<Tracer>(shared_from_this()), {output.strip()});
   }
 
+  //called instead of notify() in binary mode, after address() accepted the instruction.
+  auto record(u32 opcode, u64 clock, u8 index = NoRegister, u64 value = 0) -> void {
+    push({clock, _address, opcode, index, 0, {}, value});
+  }
+
+  //follows record() once for each further register that changed along with the first one.
+  auto recordRegister(u8 index, u64 value) -> void {
+    push({0, _address, 0, index, Continuation, {}, value});
+  }
+
+  //passes all buffered records to output, in order; safe to call from one thread other than the emulation thread.
+  auto drain(const std::function<void (std::span<const Record>)>& output) -> void {
+    if(!_ring) return;
+    u64 tail = _tail.load(std::memory_order_relaxed);
+    u64 head = _head.load(std::memory_order_acquire);
+    while(tail != head) {
+      u64 count = min<u64>(head - tail, RingSize - (tail & (RingSize - 1)));
+      output({&_ring[tail & (RingSize - 1)], (size_t)count});
+      tail += count;
+      _tail.store(tail, std::memory_order_release);
+    }
+  }
+
   auto serialize(string& output, string depth) -> void override {
     Tracer::serialize(output, depth);
     output.append(depth, "  addressBits: ", _addressBits, "\n");
@@ -115,6 +197,16 @@ struct Instruction : Tracer {
   }
 
 protected:
+  auto push(const Record& record) -> void {
+    u64 head = _head.load(std::memory_order_relaxed);
+    while(head - _tail.load(std::memory_order_acquire) >= RingSize) {
+      if(!_binary.load(std::memory_order_acquire)) return;
+      spinloop();
+    }
+    _ring[head & (RingSize - 1)] = record;
+    _head.store(head + 1, std::memory_order_release);
+  }
+
   struct VisitMask {
     VisitMask(u64 address) : upper(address >> 6), mask(0) {}
     auto operator==(const VisitMask& source) const -> bool { return upper == source.upper; }
@@ -147,4 +239,9 @@ protected:
   n64 _omitted = 0;
   std::vector<u64> _history;
   hashset<VisitMask> _masks;
+  atomic<bool> _binary = false;
+  string _architecture;
+  std::unique_ptr<Record[]> _ring;
+  atomic<u64> _head = 0;
+  atomic<u64> _tail = 0;
 };
@@ -1,5 +1,5 @@
 struct Input : Object {
   DeclareClass(Input, "input")
   using Object::Object;
-  u64 lastPoll;
+  u32 binding = 0;  //reserved for the frontend, to cache the host input this node is mapped to
 };
@@ -25,6 +25,7 @@ struct Platform {
   virtual auto audio(Node::Audio::Stream) -> void {}
   virtual auto input(Node::Input::Input) -> void {}
   virtual auto cheat(u32 addr) -> maybe<u32> { return nothing; }
+  virtual auto cheats() -> bool { return false; }  //true while cheat() may return a value
 };
 
 extern Platform* platform;
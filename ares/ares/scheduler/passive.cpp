@@ -0,0 +1,73 @@
+inline Passive::~Passive() {
+  destroy();
+}
+
+inline auto Passive::frequency() const -> u64 { return _frequency; }
+inline auto Passive::scalar() const -> u64 { return _scalar; }
+inline auto Passive::clock() const -> u64 { return _clock; }
+inline auto Passive::event() const -> u64 { return _event; }
+
+inline auto Passive::setFrequency(double frequency) -> void {
+  _frequency = frequency + 0.5;
+  _scalar = Thread::Second / _frequency;
+}
+
+inline auto Passive::setClock(u64 clock) -> void {
+  _clock = clock;
+}
+
+//requests that the component be caught up once any thread reaches the given clock value,
+//even if it is not accessed before then (eg to raise an interrupt on time.)
+inline auto Passive::setEvent(u64 clock) -> void {
+  _event = clock;
+}
+
+//as above, relative to the current clock of the component.
+inline auto Passive::schedule(u32 clocks) -> void {
+  _event = _clock + _scalar * clocks;
+}
+
+inline auto Passive::create(double frequency, std::function<void ()> entryPoint) -> void {
+  _entryPoint = entryPoint;
+  _event = Never;
+  setFrequency(frequency);
+  setClock(0);
+  scheduler.append(*this);
+}
+
+inline auto Passive::destroy() -> void {
+  scheduler.remove(*this);
+  _entryPoint = {};
+}
+
+inline auto Passive::step(u32 clocks) -> void {
+  _clock += _scalar * clocks;
+}
+
+//catch up to the thread that is currently running, if any.
+inline auto Passive::synchronize() -> void {
+  for(auto thread : scheduler._threads) {
+    if(thread->active()) return synchronize(thread->clock());
+  }
+}
+
+//catch up to the specified thread.
+inline auto Passive::synchronize(Thread& thread) -> void {
+  synchronize(thread.clock());
+}
+
+//run the entry point until the component has reached the specified clock value.
+inline auto Passive::synchronize(u64 clock) -> void {
+  //the entry point may access other components that in turn try to catch this one up.
+  if(_running || !_entryPoint) return;
+  _running = true;
+  while(_clock < clock) _entryPoint();
+  _running = false;
+}
+
+inline auto Passive::serialize(serializer& s) -> void {
+  s(_frequency);
+  s(_scalar);
+  s(_clock);
+  s(_event);
+}
@@ -0,0 +1,47 @@
+//a component that is clocked like a Thread, but that does not have a coroutine of its own.
+//
+//devices that are rarely observed (PSGs, timers, real-time clocks) do not need to run in
+//lock-step with the CPU: instead they are caught up inline, by running their entry point
+//until they reach the time of the thread that is accessing them. they are also caught up
+//when their next event is reached, and before the scheduler rebases clocks on frame exit.
+//this removes the pair of context switches per step that a Thread would otherwise cost.
+
+struct Passive {
+  enum : u64 { Never = (u64)-1 };
+
+  Passive() = default;
+  Passive(const Passive&) = delete;
+  auto operator=(const Passive&) = delete;
+  virtual ~Passive();
+
+  auto frequency() const -> u64;
+  auto scalar() const -> u64;
+  auto clock() const -> u64;
+  auto event() const -> u64;
+
+  auto setFrequency(double frequency) -> void;
+  auto setClock(u64 clock) -> void;
+  auto setEvent(u64 clock) -> void;
+  auto schedule(u32 clocks) -> void;
+
+  auto create(double frequency, std::function<void ()> entryPoint) -> void;
+  auto destroy() -> void;
+
+  auto step(u32 clocks) -> void;
+  auto synchronize() -> void;
+  auto synchronize(Thread& thread) -> void;
+  auto synchronize(u64 clock) -> void;
+
+  auto serialize(serializer& s) -> void;
+
+protected:
+  std::function<void ()> _entryPoint;
+  u64 _frequency = 0;
+  u64 _scalar = 0;
+  u64 _clock = 0;
+  u64 _event = Never;
+  bool _running = false;
+
+  friend struct Scheduler;
+  friend struct Thread;
+};
@@ -1,5 +1,7 @@
 inline auto Scheduler::reset() -> void {
   _threads.clear();
+  _lookup.clear();
+  _passives.clear();
 }
 
 inline auto Scheduler::threads() const -> u32 {
@@ -7,9 +9,7 @@ inline auto Scheduler::threads() const -> u32 {
 }
 
 inline auto Scheduler::thread(u32 uniqueID) const -> maybe<Thread&> {
-  for(auto& thread : _threads) {
-    if(thread->_uniqueID == uniqueID) return *thread;
-  }
+  if(uniqueID < _lookup.size() && _lookup[uniqueID]) return *_lookup[uniqueID];
   return {};
 }
 
@@ -18,7 +18,7 @@ inline auto Scheduler::thread(u32 uniqueID) const -> maybe<Thread&> {
 //the first unused ID is selected, to avoid the uniqueID growing in an unbounded fashion.
 inline auto Scheduler::uniqueID() const -> u32 {
   u32 uniqueID = 0;
-  while(thread(uniqueID)) uniqueID++;
+  while(uniqueID < _lookup.size() && _lookup[uniqueID]) uniqueID++;
   return uniqueID;
 }
 
@@ -45,11 +45,26 @@ inline auto Scheduler::append(Thread& thread) -> bool {
   thread._uniqueID = uniqueID();
   thread._clock = maximum() + thread._uniqueID;
   _threads.push_back(&thread);
+  if(thread._uniqueID >= _lookup.size()) _lookup.resize(thread._uniqueID + 1);
+  _lookup[thread._uniqueID] = &thread;
   return true;
 }
 
 inline auto Scheduler::remove(Thread& thread) -> void {
-  std::erase(_threads, &thread);
+  if(!std::erase(_threads, &thread)) return;
+  _lookup[thread._uniqueID] = nullptr;
+  while(!_lookup.empty() && !_lookup.back()) _lookup.pop_back();
+}
+
+inline auto Scheduler::append(Passive& passive) -> bool {
+  if(std::ranges::find(_passives, &passive) != _passives.end()) return false;
+  passive._clock = maximum();
+  _passives.push_back(&passive);
+  return true;
+}
+
+inline auto Scheduler::remove(Passive& passive) -> void {
+  std::erase(_passives, &passive);
 }
 
 //power cycle and soft reset events: assigns the primary thread and resets all thread clocks.
@@ -58,6 +73,10 @@ inline auto Scheduler::power(Thread& thread) -> void {
   for(auto& thread : _threads) {
     thread->_clock = thread->_uniqueID;
   }
+  for(auto& passive : _passives) {
+    passive->_clock = 0;
+    passive->_event = Passive::Never;
+  }
 }
 
 inline auto Scheduler::enter(Mode mode) -> Event {
@@ -99,10 +118,22 @@ inline auto Scheduler::enter(Mode mode) -> Event {
 }
 
 inline auto Scheduler::exit(Event event) -> void {
-  //subtract the minimum time from all threads to prevent clock overflow.
+  //passive components are brought up to date with every thread once per exit.
   auto reduce = minimum();
-  for(auto& thread : _threads) {
-    thread->_clock -= reduce;
+  for(auto& passive : _passives) {
+    passive->synchronize(reduce);
+  }
+
+  //subtract the minimum time from all threads to prevent clock overflow.
+  //this is deferred until it is needed, rather than touching every clock on every exit.
+  if(reduce >= Rebase) {
+    for(auto& thread : _threads) {
+      thread->_clock -= reduce;
+    }
+    for(auto& passive : _passives) {
+      passive->_clock -= reduce;
+      if(passive->_event != Passive::Never) passive->_event -= min(reduce, passive->_event);
+    }
   }
 
   //return to the thread that entered the scheduler originally.
@@ -1,4 +1,5 @@
 struct Thread;
+struct Passive;
 
 struct Scheduler {
   enum class Mode : u32 {
@@ -8,6 +9,10 @@ struct Scheduler {
     SynchronizeAuxiliary,
   };
 
+  //clocks are only rebased once the furthest behind thread passes this point.
+  //at Thread::Second units per second, this leaves well over a second of headroom before overflow.
+  enum : u64 { Rebase = (u64)1 << 61 };
+
   Scheduler() = default;
   Scheduler(const Scheduler&) = delete;
   auto operator=(const Scheduler&) = delete;
@@ -21,6 +26,8 @@ struct Scheduler {
 
   auto append(Thread& thread) -> bool;
   auto remove(Thread& thread) -> void;
+  auto append(Passive& passive) -> bool;
+  auto remove(Passive& passive) -> void;
 
   auto power(Thread& thread) -> void;
   auto enter(Mode mode = Mode::Run) -> Event;
@@ -39,9 +46,12 @@ private:
   Mode _mode = Mode::Run;
   Event _event = Event::Step;
   std::vector<Thread*> _threads;
+  std::vector<Thread*> _lookup;  //indexed by uniqueID
+  std::vector<Passive*> _passives;
   bool _synchronize = false;
 
   friend struct Thread;
+  friend struct Passive;
 };
 
 extern Scheduler scheduler;
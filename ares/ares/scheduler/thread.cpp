@@ -78,6 +78,10 @@ inline auto Thread::synchronize() -> void {
   //note: this will call Thread::synchronize(*this) at some point, but this is safe:
   //the comparison will always fail as the current thread can never be behind itself.
   for(auto thread : scheduler._threads) synchronize(*thread);
+  //run any passive components whose next event has been reached.
+  for(auto passive : scheduler._passives) {
+    if(passive->_event <= clock()) passive->synchronize(clock());
+  }
 }
 
 //ensure the specified thread(s) are caught up the current thread before proceeding.
@@ -10,6 +10,7 @@ namespace ares {
 #include "instruction.cpp"
 #include "instructions.cpp"
 #include "serialization.cpp"
+#include "recompiler.cpp"
 #include "disassembler.cpp"
 
 auto GSU::power() -> void {
@@ -34,6 +35,13 @@ auto GSU::power() -> void {
   regs.pipeline = 0x01;  //nop
   regs.ramaddr  = 0x0000;
   regs.reset();
+
+  if constexpr(Accuracy::Recompiler) {
+    auto buffer = ares::Memory::FixedAllocator::get().tryAcquire(8_MiB);
+    recompiler.allocator.resize(8_MiB, bump_allocator::executable, buffer);
+    recompiler.reset();
+    recompiler.written = false;
+  }
 }
 
 }
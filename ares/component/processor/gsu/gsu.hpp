@@ -1,9 +1,12 @@
 #pragma once
 
+#include <nall/recompiler/generic/generic.hpp>
+
 namespace ares {
 
 struct GSU {
   #include "registers.hpp"
+  #include "accuracy.hpp"
 
   virtual auto step(u32 clocks) -> void = 0;
 
@@ -15,6 +18,7 @@ struct GSU {
   virtual auto pipe() -> n8 = 0;
   virtual auto syncROMBuffer() -> void = 0;
   virtual auto readROMBuffer() -> n8 = 0;
+  virtual auto updateROMBuffer() -> void = 0;
   virtual auto syncRAMBuffer() -> void = 0;
   virtual auto readRAMBuffer(n16 address) -> n8 = 0;
   virtual auto writeRAMBuffer(n16 address, n8 data) -> void = 0;
@@ -71,6 +75,97 @@ struct GSU {
   //switch.cpp
   auto instruction(n8 opcode) -> void;
 
+  auto stepTrampoline(u32 clocks) -> void {
+    return step(clocks);  //virtual function call
+  }
+
+  auto updateROMBufferTrampoline() -> void {
+    regs.r[14].modified = false;
+    return updateROMBuffer();  //virtual function call
+  }
+
+  struct Recompiler : recompiler::generic {
+    GSU& self;
+    Recompiler(GSU& self) : self(self), generic(allocator) {}
+
+    struct Block {
+      auto execute(GSU& self) -> void {
+        ((void (*)(GSU*, Registers*))code)(&self, &self.regs);
+      }
+
+      u8* code;
+      Block* next;  //block at the same address compiled for another entry state
+      u32 state;    //pipeline, prefix and clock select at entry
+      u32 size;     //bytes fetched from the instruction cache
+    };
+
+    struct Pool {
+      u32 generation;
+      Block* blocks[1 << 8];
+    };
+
+    struct Prefix {
+      auto operator==(const Prefix&) const -> bool = default;
+
+      bool alt1;
+      bool alt2;
+      bool b;
+      u32 sreg;
+      u32 dreg;
+    };
+
+    auto reset() -> void {
+      allocator.release();
+      generation = 0;
+      pools.resize(1 << 16);
+      std::ranges::fill(pools, nullptr);
+    }
+
+    auto invalidate() -> void {
+      generation++;
+    }
+
+    auto state() const -> u32;
+    auto resident(n16 address, u32 size) const -> bool;
+    auto pool(u32 address) -> Pool*;
+    auto block() -> Block*;
+    auto emit(u32 address, u32 state) -> Block*;
+    auto emitInstruction(n8 opcode) -> bool;
+    auto emitHandler(auto (GSU::*handler)() -> void) -> void;
+    auto emitHandler(auto (GSU::*handler)(u32) -> void, u32 n, u32 operands = 0) -> void;
+    auto emitCall() -> void;
+    auto emitReturn() -> void;
+    auto emitExit() -> void;
+    auto flushClocks() -> void;
+    auto flushPrefix() -> void;
+    auto read(n16 address) const -> n8;
+    auto immediate(bool fetch = true) -> n8;
+    auto load(reg r, u32 n) -> void;
+    template<typename T> auto store(u32 n, T value) -> void;
+    auto flagsSZ(u32 sign = 0x8000) -> void;
+    auto writeFlags(u32 mask) -> void;
+    auto reset(Prefix& prefix) -> void;
+
+    static auto immediates(n8 opcode) -> u32;
+
+    bool enabled = false;
+    bool written = false;  //cache RAM holds data written by the S-CPU since it was last flushed
+    u32 generation;
+    bump_allocator allocator;
+    std::vector<Pool*> pools;
+
+    //state of the block being emitted
+    n16 pc;         //R15 at the current point in the block
+    n16 last;       //address of the last byte fetched
+    n8 pipeline;    //opcode that will be executed next
+    Prefix prefix;
+    Prefix stored;  //prefix state last written to the registers
+    u32 clocks;     //clock ticks per instruction cache fetch
+    u32 pending;    //clock ticks of fetches not yet stepped
+    bool jumped;    //R15 was written by the current instruction
+    bool rom;       //R14 was written by the current instruction
+  } recompiler{*this};
+
   //serialization.cpp
   auto serialize(serializer&) -> void;
 
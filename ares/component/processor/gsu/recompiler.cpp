@@ -0,0 +1,782 @@
+//blocks are compiled only for code that is resident in the instruction cache:
+//every fetch from there costs the same number of clock ticks, so fetch timing is accumulated
+//at compile time and stepped at once before anything that can observe it: calls into the
+//interpreter, writes to R14 (which restart the ROM buffer), and the end of the block.
+//code fetched through the ROM and RAM buffers is stepped byte by byte, and stays on the
+//interpreter.
+
+#define Reg(n)      mem(sreg(1), offset(&self.regs.r[n].data))
+#define Modified(n) mem(sreg(1), offset(&self.regs.r[n].modified))
+#define SFR         mem(sreg(1), offset(&self.regs.sfr.data))
+#define SREG        mem(sreg(1), offset(&self.regs.sreg))
+#define DREG        mem(sreg(1), offset(&self.regs.dreg))
+#define PIPELINE    mem(sreg(1), offset(&self.regs.pipeline))
+
+#define offset(field) ((u8*)(field) - (u8*)&self.regs)
+
+namespace {
+  enum : u32 {
+    Z    = 1 <<  1,
+    CY   = 1 <<  2,
+    S    = 1 <<  3,
+    OV   = 1 <<  4,
+    G    = 1 <<  5,
+    ALT1 = 1 <<  8,
+    ALT2 = 1 <<  9,
+    B    = 1 << 12,
+  };
+}
+
+auto GSU::Recompiler::state() const -> u32 {
+  auto& regs = self.regs;
+  return regs.pipeline | regs.sfr.alt1 << 8 | regs.sfr.alt2 << 9 | regs.sfr.b << 10
+       | regs.clsr << 11 | regs.sreg << 12 | regs.dreg << 16;
+}
+
+auto GSU::Recompiler::resident(n16 address, u32 size) const -> bool {
+  n16 offset = address - self.regs.cbr;
+  if(offset + size > 512 || address + size > 0x10000) return false;
+  for(u32 line = offset >> 4; line <= offset + size - 1 >> 4; line++) {
+    if(!self.cache.valid[line]) return false;
+  }
+  return true;
+}
+
+auto GSU::Recompiler::pool(u32 address) -> Pool* {
+  auto& pool = pools[address >> 8 & 0xffff];
+  if(!pool) {
+    pool = (Pool*)allocator.acquire(sizeof(Pool));
+    memory::jitprotect(false);
+    *pool = {};
+    pool->generation = generation;
+    memory::jitprotect(true);
+  } else if(pool->generation != generation) {
+    memory::jitprotect(false);
+    for(auto& block : pool->blocks) block = nullptr;
+    pool->generation = generation;
+    memory::jitprotect(true);
+  }
+  return pool;
+}
+
+auto GSU::Recompiler::block() -> Block* {
+  u32 address = self.regs.pbr << 16 | self.regs.r[15];
+  u32 state = this->state();
+  for(auto block = pool(address)->blocks[address & 0xff]; block; block = block->next) {
+    if(block->state == state) return resident(address, block->size) ? block : nullptr;
+  }
+
+  auto block = emit(address, state);
+  if(!block) return nullptr;
+
+  auto pool = this->pool(address);
+  memory::jitprotect(false);
+  block->next = pool->blocks[address & 0xff];
+  pool->blocks[address & 0xff] = block;
+  memory::jitprotect(true);
+  return block;
+}
+
+auto GSU::Recompiler::emit(u32 address, u32 state) -> Block* {
+  pc = address;
+  pipeline = state;
+  if(!resident(pc, 1 + immediates(pipeline))) return nullptr;
+
+  if(unlikely(allocator.available() < 1_MiB)) {
+    print("GSU allocator flush\n");
+    reset();
+  }
+
+  prefix.alt1 = state >>  8 & 1;
+  prefix.alt2 = state >>  9 & 1;
+  prefix.b    = state >> 10 & 1;
+  prefix.sreg = state >> 12 & 15;
+  prefix.dreg = state >> 16 & 15;
+  stored = prefix;
+  clocks = state >> 11 & 1 ? 1 : 2;
+  pending = 0;
+
+  auto block = (Block*)allocator.acquire(sizeof(Block));
+  beginFunction(2);
+
+  for(u32 count = 0; count < 32; count++) {
+    if(count && !resident(pc, 1 + immediates(pipeline))) break;
+    jumped = false;
+    rom = false;
+    n8 opcode = pipeline;
+    pipeline = read(pc);  //mirrors GSU::peekpipe()
+    pending += clocks;
+    last = pc;
+    //a ROM buffer load in progress must complete with the old value of R14,
+    //and the load started by writing R14 must not count ticks that preceded it
+    if(prefix.dreg == 14 || (opcode & 15) == 14) flushClocks();
+    bool terminal = emitInstruction(opcode);
+    if(rom) call(&GSU::updateROMBufferTrampoline);
+    if(jumped) break;
+    pc++;
+    if(terminal) break;
+  }
+  emitExit();
+
+  memory::jitprotect(false);
+  block->code = endFunction();
+  block->next = nullptr;
+  block->state = state;
+  block->size = (n16)(last - address) + 1;
+  memory::jitprotect(true);
+  return block;
+}
+
+//returns true when the block must end after this instruction
+auto GSU::Recompiler::emitInstruction(n8 opcode) -> bool {
+  u32 n = opcode & 15;
+  auto sr = prefix.sreg;
+  auto dr = prefix.dreg;
+  bool alt1 = prefix.alt1;
+  bool alt2 = prefix.alt2;
+
+  switch(opcode) {
+
+  //stop
+  case 0x00: {
+    emitHandler(&GSU::instructionSTOP);
+    return true;
+  }
+
+  //nop
+  case 0x01: {
+    reset(prefix);
+    return false;
+  }
+
+  //cache
+  case 0x02: {
+    emitHandler(&GSU::instructionCACHE);
+    return true;
+  }
+
+  //lsr
+  case 0x03: {
+    load(reg(0), sr);
+    and32(reg(1), reg(0), imm(1));
+    shl32(sreg(2), reg(1), imm(2));
+    lshr32(reg(0), reg(0), imm(1));
+    store(dr, reg(0));
+    flagsSZ();
+    or32(reg(2), reg(2), sreg(2));
+    writeFlags(Z | CY | S);
+    reset(prefix);
+    return false;
+  }
+
+  //rol
+  case 0x04: {
+    load(reg(0), sr);
+    lshr32(reg(1), reg(0), imm(13));
+    and32(sreg(2), reg(1), imm(CY));
+    mov32_u16(reg(1), SFR);
+    lshr32(reg(1), reg(1), imm(2));
+    and32(reg(1), reg(1), imm(1));
+    shl32(reg(0), reg(0), imm(1));
+    or32(reg(0), reg(0), reg(1));
+    and32(reg(0), reg(0), imm(0xffff));
+    store(dr, reg(0));
+    flagsSZ();
+    or32(reg(2), reg(2), sreg(2));
+    writeFlags(Z | CY | S);
+    reset(prefix);
+    return false;
+  }
+
+  //bra, blt, bge, bne, beq, bpl, bmi, bcc, bcs, bvc, bvs
+  case range11(0x05, 0x0f): {
+    auto displacement = (i8)immediate();
+    n16 target = pc + displacement;
+    if(opcode == 0x05) {
+      store(15, imm(target));
+      return true;
+    }
+    mov32_u16(reg(0), SFR);
+    switch(opcode) {
+    case 0x06: case 0x07:
+      lshr32(reg(1), reg(0), imm(1));
+      xor32(reg(0), reg(0), reg(1));
+      lshr32(reg(0), reg(0), imm(3));
+      break;
+    case 0x08: case 0x09: lshr32(reg(0), reg(0), imm(1)); break;
+    case 0x0a: case 0x0b: lshr32(reg(0), reg(0), imm(3)); break;
+    case 0x0c: case 0x0d: lshr32(reg(0), reg(0), imm(2)); break;
+    case 0x0e: case 0x0f: lshr32(reg(0), reg(0), imm(4)); break;
+    }
+    and32(reg(0), reg(0), imm(1));
+    mov32(reg(1), imm((n16)(pc + 1)));
+    auto skip = cmp32_jump(reg(0), imm(opcode & 1), flag_ne);
+    mov32(reg(1), imm(target));
+    setLabel(skip);
+    store(15, reg(1));
+    return true;
+  }
+
+  //to rN, move rN
+  case range16(0x10, 0x1f): {
+    if(!prefix.b) {
+      prefix.dreg = n;
+      return false;
+    }
+    load(reg(0), sr);
+    store(n, reg(0));
+    reset(prefix);
+    return false;
+  }
+
+  //with rN
+  case range16(0x20, 0x2f): {
+    prefix.sreg = n;
+    prefix.dreg = n;
+    prefix.b = 1;
+    return false;
+  }
+
+  //stw (rN), stb (rN)
+  case range12(0x30, 0x3b): {
+    emitHandler(&GSU::instructionStore, n);
+    return false;
+  }
+
+  //loop
+  case 0x3c: {
+    load(reg(0), 12);
+    sub32(reg(0), reg(0), imm(1));
+    and32(reg(0), reg(0), imm(0xffff));
+    store(12, reg(0));
+    flagsSZ();
+    writeFlags(Z | S);
+    auto zero = cmp32_jump(reg(0), imm(0), flag_eq);
+    load(reg(1), 13);
+    auto done = jump();
+    setLabel(zero);
+    mov32(reg(1), imm((n16)(pc + 1)));
+    setLabel(done);
+    store(15, reg(1));
+    reset(prefix);
+    return true;
+  }
+
+  //alt1
+  case 0x3d: {
+    prefix.b = 0;
+    prefix.alt1 = 1;
+    return false;
+  }
+
+  //alt2
+  case 0x3e: {
+    prefix.b = 0;
+    prefix.alt2 = 1;
+    return false;
+  }
+
+  //alt3
+  case 0x3f: {
+    prefix.b = 0;
+    prefix.alt1 = 1;
+    prefix.alt2 = 1;
+    return false;
+  }
+
+  //ldw (rN), ldb (rN)
+  case range12(0x40, 0x4b): {
+    emitHandler(&GSU::instructionLoad, n);
+    return false;
+  }
+
+  //plot, rpix
+  case 0x4c: {
+    emitHandler(&GSU::instructionPLOT_RPIX);
+    return false;
+  }
+
+  //swap
+  case 0x4d: {
+    load(reg(0), sr);
+    lshr32(reg(1), reg(0), imm(8));
+    shl32(reg(0), reg(0), imm(8));
+    or32(reg(0), reg(0), reg(1));
+    and32(reg(0), reg(0), imm(0xffff));
+    store(dr, reg(0));
+    flagsSZ();
+    writeFlags(Z | S);
+    reset(prefix);
+    return false;
+  }
+
+  //color, cmode
+  case 0x4e: {
+    emitHandler(&GSU::instructionCOLOR_CMODE);
+    return false;
+  }
+
+  //not
+  case 0x4f: {
+    load(reg(0), sr);
+    xor32(reg(0), reg(0), imm(0xffff));
+    store(dr, reg(0));
+    flagsSZ();
+    writeFlags(Z | S);
+    reset(prefix);
+    return false;
+  }
+
+  //add, adc
+  case range16(0x50, 0x5f): {
+    load(reg(0), sr);
+    if(alt2) mov32(reg(1), imm(n));
+    else load(reg(1), n);
+    add32(reg(2), reg(0), reg(1));
+    if(alt1) {
+      mov32_u16(reg(3), SFR);
+      lshr32(reg(3), reg(3), imm(2));
+      and32(reg(3), reg(3), imm(1));
+      add32(reg(2), reg(2), reg(3));
+    }
+    //ov = ~(sr ^ n) & (n ^ r) & 0x8000
+    xor32(reg(3), reg(0), reg(1));
+    xor32(reg(3), reg(3), imm(0xffff));
+    xor32(reg(0), reg(1), reg(2));
+    and32(reg(3), reg(3), reg(0));
+    lshr32(reg(3), reg(3), imm(11));
+    and32(reg(3), reg(3), imm(OV));
+    //cy = r >= 0x10000
+    lshr32(reg(1), reg(2), imm(14));
+    and32(reg(1), reg(1), imm(CY));
+    or32(sreg(2), reg(3), reg(1));
+    and32(reg(0), reg(2), imm(0xffff));
+    store(dr, reg(0));
+    flagsSZ();
+    or32(reg(2), reg(2), sreg(2));
+    writeFlags(Z | CY | S | OV);
+    reset(prefix);
+    return false;
+  }
+
+  //sub, sbc, cmp
+  case range16(0x60, 0x6f): {
+    load(reg(0), sr);
+    if(alt2 && !alt1) mov32(reg(1), imm(n));
+    else load(reg(1), n);
+    sub32(reg(2), reg(0), reg(1));
+    if(alt1 && !alt2) {
+      mov32_u16(reg(3), SFR);
+      lshr32(reg(3), reg(3), imm(2));
+      and32(reg(3), reg(3), imm(1));
+      xor32(reg(3), reg(3), imm(1));
+      sub32(reg(2), reg(2), reg(3));
+    }
+    //ov = (sr ^ n) & (sr ^ r) & 0x8000
+    xor32(reg(3), reg(0), reg(1));
+    xor32(reg(1), reg(0), reg(2));
+    and32(reg(3), reg(3), reg(1));
+    lshr32(reg(3), reg(3), imm(11));
+    and32(reg(3), reg(3), imm(OV));
+    //cy = r >= 0
+    lshr32(reg(1), reg(2), imm(31));
+    xor32(reg(1), reg(1), imm(1));
+    shl32(reg(1), reg(1), imm(2));
+    or32(sreg(2), reg(3), reg(1));
+    and32(reg(0), reg(2), imm(0xffff));
+    if(!alt2 || !alt1) store(dr, reg(0));
+    flagsSZ();
+    or32(reg(2), reg(2), sreg(2));
+    writeFlags(Z | CY | S | OV);
+    reset(prefix);
+    return false;
+  }
+
+  //merge
+  case 0x70: {
+    load(reg(0), 7);
+    and32(reg(0), reg(0), imm(0xff00));
+    load(reg(1), 8);
+    lshr32(reg(1), reg(1), imm(8));
+    or32(reg(0), reg(0), reg(1));
+    store(dr, reg(0));
+    xor32(reg(2), reg(2), reg(2));
+    for(auto [mask, flag] : {std::pair{0xc0c0u, OV}, {0x8080u, S}, {0xe0e0u, CY}, {0xf0f0u, Z}}) {
+      test32(reg(0), imm(mask), set_z);
+      mov32_f(reg(3), flag_nz);
+      shl32(reg(3), reg(3), imm(bit::first(flag)));
+      or32(reg(2), reg(2), reg(3));
+    }
+    writeFlags(Z | CY | S | OV);
+    reset(prefix);
+    return false;
+  }
+
+  //and, bic
+  case range15(0x71, 0x7f): {
+    load(reg(0), sr);
+    if(alt2) mov32(reg(1), imm(n));
+    else load(reg(1), n);
+    if(alt1) xor32(reg(1), reg(1), imm(0xffff));
+    and32(reg(0), reg(0), reg(1));
+    store(dr, reg(0));
+    flagsSZ();
+    writeFlags(Z | S);
+    reset(prefix);
+    return false;
+  }
+
+  //mult, umult
+  case range16(0x80, 0x8f): {
+    emitHandler(&GSU::instructionMULT_UMULT, n);
+    return false;
+  }
+
+  //sbk
+  case 0x90: {
+    emitHandler(&GSU::instructionSBK);
+    return false;
+  }
+
+  //link #N
+  case range4(0x91, 0x94): {
+    store(11, imm((n16)(pc + n)));
+    reset(prefix);
+    return false;
+  }
+
+  //sex
+  case 0x95: {
+    load(reg(0), sr);
+    mov32_s8(reg(0), reg(0));
+    and32(reg(0), reg(0), imm(0xffff));
+    store(dr, reg(0));
+    flagsSZ();
+    writeFlags(Z | S);
+    reset(prefix);
+    return false;
+  }
+
+  //asr, div2
+  case 0x96: {
+    load(reg(0), sr);
+    and32(reg(1), reg(0), imm(1));
+    shl32(sreg(2), reg(1), imm(2));
+    mov32_s16(reg(1), reg(0));
+    ashr32(reg(1), reg(1), imm(1));
+    if(alt1) {
+      add32(reg(0), reg(0), imm(1));
+      lshr32(reg(0), reg(0), imm(16));
+      add32(reg(1), reg(1), reg(0));
+    }
+    and32(reg(0), reg(1), imm(0xffff));
+    store(dr, reg(0));
+    flagsSZ();
+    or32(reg(2), reg(2), sreg(2));
+    writeFlags(Z | CY | S);
+    reset(prefix);
+    return false;
+  }
+
+  //ror
+  case 0x97: {
+    load(reg(0), sr);
+    and32(reg(1), reg(0), imm(1));
+    shl32(sreg(2), reg(1), imm(2));
+    mov32_u16(reg(1), SFR);
+    and32(reg(1), reg(1), imm(CY));
+    shl32(reg(1), reg(1), imm(13));
+    lshr32(reg(0), reg(0), imm(1));
+    or32(reg(0), reg(0), reg(1));
+    store(dr, reg(0));
+    flagsSZ();
+    or32(reg(2), reg(2), sreg(2));
+    writeFlags(Z | CY | S);
+    reset(prefix);
+    return false;
+  }
+
+  //jmp rN, ljmp rN
+  case range6(0x98, 0x9d): {
+    if(alt1) {
+      emitHandler(&GSU::instructionJMP_LJMP, n);
+      return true;
+    }
+    load(reg(0), n);
+    store(15, reg(0));
+    reset(prefix);
+    return true;
+  }
+
+  //lob
+  case 0x9e: {
+    load(reg(0), sr);
+    and32(reg(0), reg(0), imm(0xff));
+    store(dr, reg(0));
+    flagsSZ(0x80);
+    writeFlags(Z | S);
+    reset(prefix);
+    return false;
+  }
+
+  //fmult, lmult
+  case 0x9f: {
+    emitHandler(&GSU::instructionFMULT_LMULT);
+    return false;
+  }
+
+  //ibt rN,#pp, lms rN,(yy), sms (yy),rN
+  case range16(0xa0, 0xaf): {
+    if(alt1 || alt2) {
+      emitHandler(&GSU::instructionIBT_LMS_SMS, n, 1);
+      return false;
+    }
+    n16 data = (i8)immediate();
+    if(n == 14) flushClocks();
+    store(n, imm(data));
+    reset(prefix);
+    return false;
+  }
+
+  //from rN, moves rN
+  case range16(0xb0, 0xbf): {
+    if(!prefix.b) {
+      prefix.sreg = n;
+      return false;
+    }
+    load(reg(0), n);
+    store(dr, reg(0));
+    lshr32(reg(1), reg(0), imm(3));
+    and32(sreg(2), reg(1), imm(OV));
+    flagsSZ();
+    or32(reg(2), reg(2), sreg(2));
+    writeFlags(Z | S | OV);
+    reset(prefix);
+    return false;
+  }
+
+  //hib
+  case 0xc0: {
+    load(reg(0), sr);
+    lshr32(reg(0), reg(0), imm(8));
+    store(dr, reg(0));
+    flagsSZ(0x80);
+    writeFlags(Z | S);
+    reset(prefix);
+    return false;
+  }
+
+  //or, xor
+  case range15(0xc1, 0xcf): {
+    load(reg(0), sr);
+    if(alt2) mov32(reg(1), imm(n));
+    else load(reg(1), n);
+    if(!alt1) or32(reg(0), reg(0), reg(1));
+    else xor32(reg(0), reg(0), reg(1));
+    store(dr, reg(0));
+    flagsSZ();
+    writeFlags(Z | S);
+    reset(prefix);
+    return false;
+  }
+
+  //inc rN
+  case range15(0xd0, 0xde): {
+    load(reg(0), n);
+    add32(reg(0), reg(0), imm(1));
+    and32(reg(0), reg(0), imm(0xffff));
+    store(n, reg(0));
+    flagsSZ();
+    writeFlags(Z | S);
+    reset(prefix);
+    return false;
+  }
+
+  //getc, ramb, romb
+  case 0xdf: {
+    emitHandler(&GSU::instructionGETC_RAMB_ROMB);
+    return false;
+  }
+
+  //dec rN
+  case range15(0xe0, 0xee): {
+    load(reg(0), n);
+    sub32(reg(0), reg(0), imm(1));
+    and32(reg(0), reg(0), imm(0xffff));
+    store(n, reg(0));
+    flagsSZ();
+    writeFlags(Z | S);
+    reset(prefix);
+    return false;
+  }
+
+  //getb, getbh, getbl, getbs
+  case 0xef: {
+    emitHandler(&GSU::instructionGETB);
+    return false;
+  }
+
+  //iwt rN,#xx, lm rN,(xx), sm (xx),rN
+  case range16(0xf0, 0xff): {
+    if(alt1 || alt2) {
+      emitHandler(&GSU::instructionIWT_LM_SM, n, 2);
+      return false;
+    }
+    n8 lo = immediate();
+    n8 hi = immediate();
+    if(n == 14) flushClocks();
+    store(n, imm(hi << 8 | lo));
+    reset(prefix);
+    return false;
+  }
+
+  }
+
+  return true;
+}
+
+//instructions that are not emitted inline call into the interpreter, which handles their
+//ROM and RAM buffer accesses, and any fetches of their operands, with exact timing.
+auto GSU::Recompiler::emitHandler(auto (GSU::*handler)() -> void) -> void {
+  emitCall();
+  call(handler);
+  emitReturn();
+}
+
+auto GSU::Recompiler::emitHandler(auto (GSU::*handler)(u32) -> void, u32 n, u32 operands) -> void {
+  emitCall();
+  mov32(reg(1), imm(n));
+  call(handler);
+  //the handler fetches its own operands
+  for(u32 index : range(operands)) immediate(false);
+  emitReturn();
+}
+
+//brings the registers up to date before calling into code that may step the GSU
+auto GSU::Recompiler::emitCall() -> void {
+  flushPrefix();
+  mov32_u16(Reg(15), imm(pc));
+  mov32_u8(Modified(15), imm(0));  //mirrors GSU::peekpipe()
+  mov32_u8(PIPELINE, imm(pipeline));
+  flushClocks();
+}
+
+//handles the results of an instruction executed by the interpreter
+auto GSU::Recompiler::emitReturn() -> void {
+  reset(prefix);
+  stored = prefix;
+
+  mov32_u8(reg(0), Modified(14));
+  auto rom = cmp32_jump(reg(0), imm(0), flag_eq);
+  call(&GSU::updateROMBufferTrampoline);
+  setLabel(rom);
+
+  mov32_u8(reg(0), Modified(15));
+  auto step = cmp32_jump(reg(0), imm(0), flag_eq);
+  mov32_u8(Modified(15), imm(0));
+  jumpEpilog();
+  setLabel(step);
+
+  //the GSU may have been stopped by the instruction or by the S-CPU
+  mov32_u16(reg(0), SFR);
+  test32(reg(0), imm(G), set_z);
+  auto running = jump(flag_nz);
+  mov32_u16(Reg(15), imm((n16)(pc + 1)));
+  jumpEpilog();
+  setLabel(running);
+}
+
+//writes back the state at the end of the block; R15 is already written if the block jumped
+auto GSU::Recompiler::emitExit() -> void {
+  flushPrefix();
+  if(!jumped) mov32_u16(Reg(15), imm(pc));
+  mov32_u8(PIPELINE, imm(pipeline));
+  flushClocks();
+  jumpEpilog();
+}
+
+auto GSU::Recompiler::flushClocks() -> void {
+  if(!pending) return;
+  mov32(reg(1), imm(pending));
+  call(&GSU::stepTrampoline);
+  pending = 0;
+}
+
+auto GSU::Recompiler::flushPrefix() -> void {
+  if(prefix == stored) return;
+  if(prefix.sreg != stored.sreg) mov32(SREG, imm(prefix.sreg));
+  if(prefix.dreg != stored.dreg) mov32(DREG, imm(prefix.dreg));
+  if(prefix.alt1 != stored.alt1 || prefix.alt2 != stored.alt2 || prefix.b != stored.b) {
+    mov32_u16(reg(0), SFR);
+    and32(reg(0), reg(0), imm(~(ALT1 | ALT2 | B) & 0xffff));
+    u32 bits = prefix.alt1 * ALT1 | prefix.alt2 * ALT2 | prefix.b * B;
+    if(bits) or32(reg(0), reg(0), imm(bits));
+    mov32_u16(SFR, reg(0));
+  }
+  stored = prefix;
+}
+
+auto GSU::Recompiler::read(n16 address) const -> n8 {
+  return self.cache.buffer[(n16)(address - self.regs.cbr) & 511];
+}
+
+//mirrors GSU::pipe(): returns the opcode in the pipeline and fetches the next byte
+auto GSU::Recompiler::immediate(bool fetch) -> n8 {
+  n8 data = pipeline;
+  pipeline = read(++pc);
+  if(fetch) pending += clocks;
+  last = pc;
+  return data;
+}
+
+auto GSU::Recompiler::load(reg r, u32 n) -> void {
+  if(n == 15) return mov32(r, imm(pc));
+  mov32_u16(r, Reg(n));
+}
+
+template<typename T> auto GSU::Recompiler::store(u32 n, T value) -> void {
+  mov32_u16(Reg(n), value);
+  if(n == 14) rom = true;
+  if(n == 15) jumped = true;
+}
+
+//reg(2) = S and Z flags of the 16-bit result in reg(0)
+auto GSU::Recompiler::flagsSZ(u32 sign) -> void {
+  cmp32(reg(0), imm(0), set_z);
+  mov32_f(reg(2), flag_z);
+  shl32(reg(2), reg(2), imm(1));
+  lshr32(reg(3), reg(0), imm(sign == 0x8000 ? 12 : 4));
+  and32(reg(3), reg(3), imm(S));
+  or32(reg(2), reg(2), reg(3));
+}
+
+//replaces the flags in mask with those in reg(2)
+auto GSU::Recompiler::writeFlags(u32 mask) -> void {
+  mov32_u16(reg(3), SFR);
+  and32(reg(3), reg(3), imm(~mask & 0xffff));
+  or32(reg(3), reg(3), reg(2));
+  mov32_u16(SFR, reg(3));
+}
+
+auto GSU::Recompiler::reset(Prefix& prefix) -> void {
+  prefix.alt1 = 0;
+  prefix.alt2 = 0;
+  prefix.b = 0;
+  prefix.sreg = 0;
+  prefix.dreg = 0;
+}
+
+auto GSU::Recompiler::immediates(n8 opcode) -> u32 {
+  if(opcode >= 0x05 && opcode <= 0x0f) return 1;  //branches
+  if(opcode >= 0xa0 && opcode <= 0xaf) return 1;  //ibt, lms, sms
+  if(opcode >= 0xf0) return 2;                    //iwt, lm, sm
+  return 0;
+}
+
+#undef Reg
+#undef Modified
+#undef SFR
+#undef SREG
+#undef DREG
+#undef PIPELINE
+#undef offset
@@ -0,0 +1,7 @@
+struct Accuracy {
+  //enable all accuracy flags
+  static constexpr bool Reference = 0;
+
+  static constexpr bool Interpreter = 0 | Reference | !recompiler::generic::supported;
+  static constexpr bool Recompiler = !Interpreter;
+};
@@ -0,0 +1,1082 @@
+//blocks are compiled from code in host memory, and are specialized on the E, M and X flags
+//and on the B and D registers. accesses to pages of host memory are performed inline: rather
+//than being stepped one at a time, their clock ticks are accumulated and stepped at once via
+//stepBlock() before any access that must go through the bus, and at the end of the block.
+//other components therefore observe the processor at block granularity. interrupts are
+//polled between blocks, exactly as the interpreter polls them between instructions.
+//instructions that change the E flag, move blocks, wait, or vector through memory are left
+//to the interpreter.
+
+#define Reg(name)   mem(sreg(1), offset(&self.r.name))
+#define Field(name) mem(sreg(0), (u8*)&name - (u8*)&self)
+
+#define offset(field) ((u8*)(field) - (u8*)&self.r)
+
+namespace {
+  //length of each instruction when M and X are set; immediates grow by one byte when clear
+  constexpr u8 lengths[256] = {
+    2,2,2,2,2,2,2,2,1,2,1,1,3,3,3,4, 2,2,2,2,2,2,2,2,1,3,1,1,3,3,3,4,
+    3,2,4,2,2,2,2,2,1,2,1,1,3,3,3,4, 2,2,2,2,2,2,2,2,1,3,1,1,3,3,3,4,
+    1,2,2,2,3,2,2,2,1,2,1,1,3,3,3,4, 2,2,2,2,3,2,2,2,1,3,1,1,4,3,3,4,
+    1,2,3,2,2,2,2,2,1,2,1,1,3,3,3,4, 2,2,2,2,2,2,2,2,1,3,1,1,3,3,3,4,
+    2,2,3,2,2,2,2,2,1,2,1,1,3,3,3,4, 2,2,2,2,2,2,2,2,1,3,1,1,3,3,3,4,
+    2,2,2,2,2,2,2,2,1,2,1,1,3,3,3,4, 2,2,2,2,2,2,2,2,1,3,1,1,3,3,3,4,
+    2,2,2,2,2,2,2,2,1,2,1,1,3,3,3,4, 2,2,2,2,2,2,2,2,1,3,1,1,3,3,3,4,
+    2,2,2,2,2,2,2,2,1,2,1,1,3,3,3,4, 2,2,2,2,3,2,2,2,1,3,1,1,3,3,3,4,
+  };
+}
+
+auto WDC65816::Recompiler::state() const -> u32 {
+  auto& r = self.r;
+  return r.e << 0 | r.p.m << 1 | r.p.x << 2 | r.b << 8 | r.d.w << 16;
+}
+
+auto WDC65816::Recompiler::pool(u32 address) -> Pool* {
+  auto& pool = pools[address >> 8 & 0xffff];
+  if(!pool) {
+    pool = (Pool*)allocator.acquire(sizeof(Pool));
+    memory::jitprotect(false);
+    *pool = {};
+    pool->generation = generation;
+    memory::jitprotect(true);
+  } else if(pool->generation != generation) {
+    memory::jitprotect(false);
+    for(auto& block : pool->blocks) block = nullptr;
+    pool->generation = generation;
+    memory::jitprotect(true);
+  }
+  return pool;
+}
+
+auto WDC65816::Recompiler::block() -> Block* {
+  u32 address = self.r.pc.d;
+  if(!pages[address >> PageBits].read) return nullptr;
+
+  u32 state = this->state();
+  for(auto block = pool(address)->blocks[address & 0xff]; block; block = block->next) {
+    if(block->state != state) continue;
+    //code in writable memory may have been modified since the block was compiled
+    if(block->source && memory::compare(block->source, block->bytes, block->size)) break;
+    return block->code ? block : nullptr;
+  }
+
+  auto block = emit(address, state);
+  auto pool = this->pool(address);
+  memory::jitprotect(false);
+  block->next = pool->blocks[address & 0xff];
+  pool->blocks[address & 0xff] = block;
+  memory::jitprotect(true);
+  return block->code ? block : nullptr;
+}
+
+auto WDC65816::Recompiler::emit(u32 address, u32 state) -> Block* {
+  if(unlikely(allocator.available() < 1_MiB)) {
+    print("WDC65816 allocator flush\n");
+    reset();
+  }
+
+  pc = address;
+  e = state >> 0 & 1;
+  m = state >> 1 & 1;
+  x = state >> 2 & 1;
+  b = state >> 8;
+  d = state >> 16;
+  pendingClocks = 0;
+  pendingCycles = 0;
+  start = address;
+  end = address;
+
+  auto& page = pages[address >> PageBits];
+  auto block = (Block*)allocator.acquire(sizeof(Block));
+  beginFunction(2, 5);
+
+  u32 size = 0;
+  u32 result = Continue;
+  for(u32 count = 0; count < 32 && result == Continue; count++) {
+    //blocks never span pages, so that one check of the page validates the whole block
+    u32 length = this->length(page.read[pc & PageSize - 1], m, x);
+    if((pc & PageSize - 1) + length > PageSize) break;
+
+    end = start + size + length;
+    ended = false;
+    dynamic = false;
+    auto restore = pc;
+    auto restoreClocks = pendingClocks;
+    auto restoreCycles = pendingCycles;
+    result = emitInstruction();
+    if(result == Unsupported) {
+      pc = restore;
+      pendingClocks = restoreClocks;
+      pendingCycles = restoreCycles;
+      break;
+    }
+    size += length;
+    if(result == Continue && ended) result = End;
+
+    //a write through the bus may have changed the memory map or raised an interrupt
+    if(dynamic && result == Continue) {
+      mov32_u8(reg(0), Field(exit));
+      auto skip = cmp32_jump(reg(0), imm(0), flag_eq);
+      emitExit(pc, Fall);
+      setLabel(skip);
+    }
+  }
+  if(result != Exited && size) emitExit(pc, Fall);
+
+  memory::jitprotect(false);
+  if(size) {
+    block->code = endFunction();
+  } else {
+    resetCompiler();
+    block->code = nullptr;
+    size = 1;
+  }
+  block->next = nullptr;
+  block->state = state;
+  block->size = size;
+  block->source = nullptr;
+  block->bytes = nullptr;
+  if(!page.constant) {
+    block->source = page.read + (address & PageSize - 1);
+    block->bytes = (n8*)allocator.acquire(size);
+    memory::copy(block->bytes, block->source, size);
+  }
+  memory::jitprotect(true);
+  return block;
+}
+
+auto WDC65816::Recompiler::emitInstruction() -> u32 {
+  n8 opcode = pages[pc >> PageBits].read[pc & PageSize - 1];
+
+  switch(opcode) {
+  case 0x00:  //brk
+  case 0x02:  //cop
+  case 0x40:  //rti
+  case 0x42:  //wdm
+  case 0x44:  //mvp
+  case 0x54:  //mvn
+  case 0x6c:  //jmp (addr)
+  case 0x7c:  //jmp (addr,x)
+  case 0xcb:  //wai
+  case 0xdb:  //stp
+  case 0xdc:  //jml [addr]
+  case 0xfb:  //xce
+  case 0xfc:  //jsr (addr,x)
+    return Unsupported;
+  }
+  //(dp,x) wraps its pointer within the direct page in emulation mode
+  if((opcode & 0x1f) == 0x01 && e && (n8)d) return Unsupported;
+
+  fetch();
+  switch(opcode) {
+
+  //ora, and, eor, adc, sta, lda, cmp, sbc
+  #define group(base) \
+  case base + 0x01: case base + 0x03: case base + 0x05: case base + 0x07: \
+  case base + 0x09: case base + 0x0d: case base + 0x0f: case base + 0x11: \
+  case base + 0x12: case base + 0x13: case base + 0x15: case base + 0x17: \
+  case base + 0x19: case base + 0x1d: case base + 0x1f:
+  group(0x00) group(0x20) group(0x40) group(0x60) group(0x80) group(0xa0) group(0xc0) group(0xe0) {
+  #undef group
+    Mode mode;
+    switch(opcode & 0x1f) {
+    case 0x01: mode = Mode::IndexedIndirect; break;
+    case 0x03: mode = Mode::Stack; break;
+    case 0x05: mode = Mode::Direct; break;
+    case 0x07: mode = Mode::IndirectLong; break;
+    case 0x09: mode = Mode::Immediate; break;
+    case 0x0d: mode = Mode::Bank; break;
+    case 0x0f: mode = Mode::Long; break;
+    case 0x11: mode = Mode::IndirectIndexed; break;
+    case 0x12: mode = Mode::Indirect; break;
+    case 0x13: mode = Mode::IndirectStack; break;
+    case 0x15: mode = Mode::DirectX; break;
+    case 0x17: mode = Mode::IndirectLongY; break;
+    case 0x19: mode = Mode::BankY; break;
+    case 0x1d: mode = Mode::BankX; break;
+    case 0x1f: mode = Mode::LongX; break;
+    }
+    if(opcode == 0x89) {  //bit #imm
+      u32 data = fetch();
+      if(!m) data |= fetch() << 8;
+      mov32_u16(reg(0), Reg(a.w));
+      test32(reg(0), imm(data), set_z);
+      mov32_f(reg(0), flag_z);
+      mov32_u8(Reg(p.z), reg(0));
+      break;
+    }
+    if(opcode >> 5 == 4) {
+      emitWrite(mode, Register::A, !m);
+      break;
+    }
+    emitRead(mode, algorithm(opcode >> 5, !m), !m);
+    break;
+  }
+
+  #define op(name, wide) (wide ? &WDC65816::algorithmTrampoline<&WDC65816::algorithm##name##16> \
+                               : &WDC65816::algorithmTrampoline<&WDC65816::algorithm##name##8>)
+  case 0xa0: emitRead(Mode::Immediate, op(LDY, !x), !x); break;
+  case 0xa4: emitRead(Mode::Direct,    op(LDY, !x), !x); break;
+  case 0xac: emitRead(Mode::Bank,      op(LDY, !x), !x); break;
+  case 0xb4: emitRead(Mode::DirectX,   op(LDY, !x), !x); break;
+  case 0xbc: emitRead(Mode::BankX,     op(LDY, !x), !x); break;
+  case 0xa2: emitRead(Mode::Immediate, op(LDX, !x), !x); break;
+  case 0xa6: emitRead(Mode::Direct,    op(LDX, !x), !x); break;
+  case 0xae: emitRead(Mode::Bank,      op(LDX, !x), !x); break;
+  case 0xb6: emitRead(Mode::DirectY,   op(LDX, !x), !x); break;
+  case 0xbe: emitRead(Mode::BankY,     op(LDX, !x), !x); break;
+  case 0xc0: emitRead(Mode::Immediate, op(CPY, !x), !x); break;
+  case 0xc4: emitRead(Mode::Direct,    op(CPY, !x), !x); break;
+  case 0xcc: emitRead(Mode::Bank,      op(CPY, !x), !x); break;
+  case 0xe0: emitRead(Mode::Immediate, op(CPX, !x), !x); break;
+  case 0xe4: emitRead(Mode::Direct,    op(CPX, !x), !x); break;
+  case 0xec: emitRead(Mode::Bank,      op(CPX, !x), !x); break;
+  case 0x24: emitRead(Mode::Direct,    op(BIT, !m), !m); break;
+  case 0x2c: emitRead(Mode::Bank,      op(BIT, !m), !m); break;
+  case 0x34: emitRead(Mode::DirectX,   op(BIT, !m), !m); break;
+  case 0x3c: emitRead(Mode::BankX,     op(BIT, !m), !m); break;
+
+  case 0x84: emitWrite(Mode::Direct,  Register::Y, !x); break;
+  case 0x8c: emitWrite(Mode::Bank,    Register::Y, !x); break;
+  case 0x94: emitWrite(Mode::DirectX, Register::Y, !x); break;
+  case 0x86: emitWrite(Mode::Direct,  Register::X, !x); break;
+  case 0x8e: emitWrite(Mode::Bank,    Register::X, !x); break;
+  case 0x96: emitWrite(Mode::DirectY, Register::X, !x); break;
+  case 0x64: emitWrite(Mode::Direct,  Register::Z, !m); break;
+  case 0x74: emitWrite(Mode::DirectX, Register::Z, !m); break;
+  case 0x9c: emitWrite(Mode::Bank,    Register::Z, !m); break;
+  case 0x9e: emitWrite(Mode::BankX,   Register::Z, !m); break;
+
+  case 0x06: emitModify(Mode::Direct,  op(ASL, !m), !m); break;
+  case 0x0e: emitModify(Mode::Bank,    op(ASL, !m), !m); break;
+  case 0x16: emitModify(Mode::DirectX, op(ASL, !m), !m); break;
+  case 0x1e: emitModify(Mode::BankX,   op(ASL, !m), !m); break;
+  case 0x26: emitModify(Mode::Direct,  op(ROL, !m), !m); break;
+  case 0x2e: emitModify(Mode::Bank,    op(ROL, !m), !m); break;
+  case 0x36: emitModify(Mode::DirectX, op(ROL, !m), !m); break;
+  case 0x3e: emitModify(Mode::BankX,   op(ROL, !m), !m); break;
+  case 0x46: emitModify(Mode::Direct,  op(LSR, !m), !m); break;
+  case 0x4e: emitModify(Mode::Bank,    op(LSR, !m), !m); break;
+  case 0x56: emitModify(Mode::DirectX, op(LSR, !m), !m); break;
+  case 0x5e: emitModify(Mode::BankX,   op(LSR, !m), !m); break;
+  case 0x66: emitModify(Mode::Direct,  op(ROR, !m), !m); break;
+  case 0x6e: emitModify(Mode::Bank,    op(ROR, !m), !m); break;
+  case 0x76: emitModify(Mode::DirectX, op(ROR, !m), !m); break;
+  case 0x7e: emitModify(Mode::BankX,   op(ROR, !m), !m); break;
+  case 0xc6: emitModify(Mode::Direct,  op(DEC, !m), !m); break;
+  case 0xce: emitModify(Mode::Bank,    op(DEC, !m), !m); break;
+  case 0xd6: emitModify(Mode::DirectX, op(DEC, !m), !m); break;
+  case 0xde: emitModify(Mode::BankX,   op(DEC, !m), !m); break;
+  case 0xe6: emitModify(Mode::Direct,  op(INC, !m), !m); break;
+  case 0xee: emitModify(Mode::Bank,    op(INC, !m), !m); break;
+  case 0xf6: emitModify(Mode::DirectX, op(INC, !m), !m); break;
+  case 0xfe: emitModify(Mode::BankX,   op(INC, !m), !m); break;
+  case 0x04: emitModify(Mode::Direct,  op(TSB, !m), !m); break;
+  case 0x0c: emitModify(Mode::Bank,    op(TSB, !m), !m); break;
+  case 0x14: emitModify(Mode::Direct,  op(TRB, !m), !m); break;
+  case 0x1c: emitModify(Mode::Bank,    op(TRB, !m), !m); break;
+
+  case 0x0a: emitImplied(op(ASL, !m), Register::A, !m); break;
+  case 0x2a: emitImplied(op(ROL, !m), Register::A, !m); break;
+  case 0x4a: emitImplied(op(LSR, !m), Register::A, !m); break;
+  case 0x6a: emitImplied(op(ROR, !m), Register::A, !m); break;
+  case 0x1a: emitImplied(op(INC, !m), Register::A, !m); break;
+  case 0x3a: emitImplied(op(DEC, !m), Register::A, !m); break;
+  case 0xe8: emitImplied(op(INC, !x), Register::X, !x); break;
+  case 0xca: emitImplied(op(DEC, !x), Register::X, !x); break;
+  case 0xc8: emitImplied(op(INC, !x), Register::Y, !x); break;
+  case 0x88: emitImplied(op(DEC, !x), Register::Y, !x); break;
+  #undef op
+
+  case 0x10: emitBranch(offset(&self.r.p.n), 0); return Exited;  //bpl
+  case 0x30: emitBranch(offset(&self.r.p.n), 1); return Exited;  //bmi
+  case 0x50: emitBranch(offset(&self.r.p.v), 0); return Exited;  //bvc
+  case 0x70: emitBranch(offset(&self.r.p.v), 1); return Exited;  //bvs
+  case 0x90: emitBranch(offset(&self.r.p.c), 0); return Exited;  //bcc
+  case 0xb0: emitBranch(offset(&self.r.p.c), 1); return Exited;  //bcs
+  case 0xd0: emitBranch(offset(&self.r.p.z), 0); return Exited;  //bne
+  case 0xf0: emitBranch(offset(&self.r.p.z), 1); return Exited;  //beq
+  case 0x80: emitBranch(Always, 1); return Exited;               //bra
+
+  case 0x82: {  //brl
+    u32 displacement = fetch();
+    displacement |= fetch() << 8;
+    idle();
+    emitExit(pc & 0xff0000 | (n16)(pc + displacement), Branch);
+    return Exited;
+  }
+
+  case 0x4c: {  //jmp addr
+    u32 target = fetch();
+    target |= fetch() << 8;
+    emitExit(pc & 0xff0000 | target, Jump);
+    return Exited;
+  }
+
+  case 0x5c: {  //jml long
+    u32 target = fetch();
+    target |= fetch() << 8;
+    target |= fetch() << 16;
+    emitExit(target, Jump);
+    return Exited;
+  }
+
+  case 0x20: {  //jsr addr
+    u32 target = fetch();
+    target |= fetch() << 8;
+    idle();
+    mov32(sreg(3), imm((n16)(pc - 1)));
+    emitPush(8, false);
+    emitPush(0, false);
+    emitExit(pc & 0xff0000 | target, Jump);
+    return Exited;
+  }
+
+  case 0x22: {  //jsl long
+    u32 target = fetch();
+    target |= fetch() << 8;
+    mov32(sreg(3), imm(pc >> 16));
+    emitPush(0, true);
+    idle();
+    target |= fetch() << 16;
+    mov32(sreg(3), imm((n16)(pc - 1)));
+    emitPush(8, true);
+    emitPush(0, true);
+    emitStackFixup();
+    emitExit(target, Jump);
+    return Exited;
+  }
+
+  case 0x60: {  //rts
+    idle();
+    idle();
+    emitPull(false);
+    mov32(sreg(3), reg(0));
+    emitPull(false);
+    shl32(reg(0), reg(0), imm(8));
+    or32(reg(0), reg(0), sreg(3));
+    idle();
+    add32(reg(0), reg(0), imm(1));
+    and32(reg(0), reg(0), imm(0xffff));
+    or32(reg(0), reg(0), imm(pc & 0xff0000));
+    mov32(Reg(pc.d), reg(0));
+    emitExit(~0, Jump);
+    return Exited;
+  }
+
+  case 0x6b: {  //rtl
+    idle();
+    idle();
+    emitPull(true);
+    mov32(sreg(3), reg(0));
+    emitPull(true);
+    shl32(reg(0), reg(0), imm(8));
+    or32(sreg(3), sreg(3), reg(0));
+    emitPull(true);
+    shl32(reg(0), reg(0), imm(16));
+    or32(reg(0), reg(0), sreg(3));
+    add32(reg(1), reg(0), imm(1));
+    and32(reg(1), reg(1), imm(0xffff));
+    and32(reg(0), reg(0), imm(0xff0000));
+    or32(reg(0), reg(0), reg(1));
+    mov32(Reg(pc.d), reg(0));
+    emitStackFixup();
+    emitExit(~0, Jump);
+    return Exited;
+  }
+
+  case 0x18: idle(); mov32_u8(Reg(p.c), imm(0)); break;  //clc
+  case 0x38: idle(); mov32_u8(Reg(p.c), imm(1)); break;  //sec
+  case 0x58: idle(); mov32_u8(Reg(p.i), imm(0)); break;  //cli
+  case 0x78: idle(); mov32_u8(Reg(p.i), imm(1)); break;  //sei
+  case 0xb8: idle(); mov32_u8(Reg(p.v), imm(0)); break;  //clv
+  case 0xd8: idle(); mov32_u8(Reg(p.d), imm(0)); break;  //cld
+  case 0xf8: idle(); mov32_u8(Reg(p.d), imm(1)); break;  //sed
+
+  case 0xc2:    //rep #imm
+  case 0xe2: {  //sep #imm
+    n8 data = fetch();
+    bool value = opcode == 0xe2;
+    idle();
+    if(data.bit(0)) mov32_u8(Reg(p.c), imm(value));
+    if(data.bit(1)) mov32_u8(Reg(p.z), imm(value));
+    if(data.bit(2)) mov32_u8(Reg(p.i), imm(value));
+    if(data.bit(3)) mov32_u8(Reg(p.d), imm(value));
+    if(data.bit(6)) mov32_u8(Reg(p.v), imm(value));
+    if(data.bit(7)) mov32_u8(Reg(p.n), imm(value));
+    bool index = data.bit(4) && !e ? value : x;
+    bool memory = data.bit(5) && !e ? value : m;
+    if(index != x) mov32_u8(Reg(p.x), imm(index));
+    if(memory != m) mov32_u8(Reg(p.m), imm(memory));
+    if(index && !x) {
+      load(reg(0), Register::X);
+      and32(reg(0), reg(0), imm(0xff));
+      store(Register::X, reg(0), 1);
+      load(reg(0), Register::Y);
+      and32(reg(0), reg(0), imm(0xff));
+      store(Register::Y, reg(0), 1);
+    }
+    x = index;
+    m = memory;
+    break;
+  }
+
+  case 0xaa: emitTransfer(Register::A, Register::X, !x); break;  //tax
+  case 0xa8: emitTransfer(Register::A, Register::Y, !x); break;  //tay
+  case 0xba: emitTransfer(Register::S, Register::X, !x); break;  //tsx
+  case 0x8a: emitTransfer(Register::X, Register::A, !m); break;  //txa
+  case 0x9b: emitTransfer(Register::X, Register::Y, !x); break;  //txy
+  case 0x98: emitTransfer(Register::Y, Register::A, !m); break;  //tya
+  case 0xbb: emitTransfer(Register::Y, Register::X, !x); break;  //tyx
+  case 0x3b: emitTransfer(Register::S, Register::A,  1); break;  //tsc
+  case 0x7b: emitTransfer(Register::D, Register::A,  1); break;  //tdc
+
+  case 0x5b: {  //tcd
+    emitTransfer(Register::A, Register::D, 1);
+    return End;
+  }
+
+  case 0x1b: {  //tcs
+    idle();
+    load(reg(0), Register::A);
+    store(Register::S, reg(0), 1);
+    emitStackFixup();
+    break;
+  }
+
+  case 0x9a: {  //txs
+    idle();
+    load(reg(0), Register::X);
+    if(e) and32(reg(0), reg(0), imm(0xff));
+    store(Register::S, reg(0), !e);
+    break;
+  }
+
+  case 0xeb: {  //xba
+    idle();
+    idle();
+    mov32_u16(reg(0), Reg(a.w));
+    lshr32(reg(1), reg(0), imm(8));
+    shl32(reg(0), reg(0), imm(8));
+    or32(reg(0), reg(0), reg(1));
+    mov32_u16(Reg(a.w), reg(0));
+    and32(reg(0), reg(0), imm(0xff));
+    flagsZN(reg(0), 0);
+    break;
+  }
+
+  case 0xea: idle(); break;  //nop
+
+  case 0x48: idle(); load(reg(0), Register::A); emitPush(!m); break;  //pha
+  case 0xda: idle(); load(reg(0), Register::X); emitPush(!x); break;  //phx
+  case 0x5a: idle(); load(reg(0), Register::Y); emitPush(!x); break;  //phy
+
+  case 0x8b: idle(); mov32(reg(0), imm(b)); emitPush(0); break;        //phb
+  case 0x4b: idle(); mov32(reg(0), imm(pc >> 16)); emitPush(0); break;  //phk
+
+  case 0x08: {  //php
+    idle();
+    call(&WDC65816::readFlags);
+    emitPush(0);
+    break;
+  }
+
+  case 0x0b: {  //phd
+    idle();
+    mov32(sreg(3), imm(d));
+    emitPush(8, true);
+    emitPush(0, true);
+    emitStackFixup();
+    break;
+  }
+
+  case 0xf4: {  //pea addr
+    u32 data = fetch();
+    data |= fetch() << 8;
+    mov32(sreg(3), imm(data));
+    emitPush(8, true);
+    emitPush(0, true);
+    emitStackFixup();
+    break;
+  }
+
+  case 0xd4: {  //pei (dp)
+    u32 address = fetch();
+    if((n8)d) idle();
+    Address pointer{.base = d + address, .mask = 0xffff};
+    read(pointer, 0);
+    mov32(sreg(3), reg(0));
+    read(pointer, 1);
+    shl32(reg(0), reg(0), imm(8));
+    or32(sreg(3), sreg(3), reg(0));
+    emitPush(8, true);
+    emitPush(0, true);
+    emitStackFixup();
+    break;
+  }
+
+  case 0x62: {  //per addr
+    u32 displacement = fetch();
+    displacement |= fetch() << 8;
+    idle();
+    mov32(sreg(3), imm((n16)(pc + displacement)));
+    emitPush(8, true);
+    emitPush(0, true);
+    emitStackFixup();
+    break;
+  }
+
+  case 0x68: emitPull(Register::A, !m); break;  //pla
+  case 0xfa: emitPull(Register::X, !x); break;  //plx
+  case 0x7a: emitPull(Register::Y, !x); break;  //ply
+
+  case 0xab: {  //plb
+    idle();
+    idle();
+    emitPull(true);
+    mov32_u8(Reg(b), reg(0));
+    flagsZN(reg(0), 0);
+    emitStackFixup();
+    return End;
+  }
+
+  case 0x2b: {  //pld
+    idle();
+    idle();
+    emitPull(true);
+    mov32(sreg(3), reg(0));
+    emitPull(true);
+    shl32(reg(0), reg(0), imm(8));
+    or32(reg(0), reg(0), sreg(3));
+    mov32_u16(Reg(d.w), reg(0));
+    flagsZN(reg(0), 1);
+    emitStackFixup();
+    return End;
+  }
+
+  case 0x28: {  //plp
+    idle();
+    idle();
+    emitPull(false);
+    mov32(reg(1), reg(0));
+    call(&WDC65816::writeFlags);
+    return End;
+  }
+
+  default:
+    return Unsupported;
+  }
+
+  return Continue;
+}
+
+auto WDC65816::Recompiler::emitRead(Mode mode, auto (WDC65816::*op)(u32) -> u32, bool wide) -> void {
+  if(mode == Mode::Immediate) {
+    u32 data = fetch();
+    if(wide) data |= fetch() << 8;
+    mov32(reg(1), imm(data));
+    call(op);
+    return;
+  }
+
+  auto address = emitAddress(mode, false);
+  read(address, 0);
+  if(wide) {
+    mov32(sreg(3), reg(0));
+    read(address, 1);
+    shl32(reg(0), reg(0), imm(8));
+    or32(reg(0), reg(0), sreg(3));
+  }
+  mov32(reg(1), reg(0));
+  call(op);
+}
+
+auto WDC65816::Recompiler::emitWrite(Mode mode, Register source, bool wide) -> void {
+  auto address = emitAddress(mode, true);
+  load(reg(0), source);
+  mov32(sreg(3), reg(0));
+  write(address, 0, 0);
+  if(wide) write(address, 1, 8);
+}
+
+auto WDC65816::Recompiler::emitModify(Mode mode, auto (WDC65816::*op)(u32) -> u32, bool wide) -> void {
+  auto address = emitAddress(mode, true);
+  read(address, 0);
+  if(wide) {
+    mov32(sreg(3), reg(0));
+    read(address, 1);
+    shl32(reg(0), reg(0), imm(8));
+    or32(reg(0), reg(0), sreg(3));
+  }
+  idle();
+  mov32(reg(1), reg(0));
+  call(op);
+  mov32(sreg(3), reg(0));
+  if(wide) write(address, 1, 8);
+  write(address, 0, 0);
+}
+
+auto WDC65816::Recompiler::emitImplied(auto (WDC65816::*op)(u32) -> u32, Register target, bool wide) -> void {
+  idle();
+  load(reg(1), target);
+  if(!wide) and32(reg(1), reg(1), imm(0xff));
+  call(op);
+  store(target, reg(0), wide);
+}
+
+auto WDC65816::Recompiler::emitTransfer(Register source, Register target, bool wide) -> void {
+  idle();
+  load(reg(0), source);
+  if(!wide) and32(reg(0), reg(0), imm(0xff));
+  store(target, reg(0), wide);
+  flagsZN(reg(0), wide);
+}
+
+//mirrors the addressing of the interpreter's instruction handlers, including their idle cycles.
+//addresses that depend on registers are computed into sreg(2).
+auto WDC65816::Recompiler::emitAddress(Mode mode, bool write) -> Address {
+  //idle4(): an extra cycle when indexing crosses a page, or always for 16-bit indexes
+  auto crossed = [&](auto base, auto address) {
+    if(write || !x) return idle();
+    commit();
+    xor32(reg(0), base, address);
+    test32(reg(0), imm(0xff00), set_z);
+    auto skip = jump(flag_z);
+    add32(Field(clocks), Field(clocks), imm(idleClocks));
+    add32(Field(cycles), Field(cycles), imm(1));
+    setLabel(skip);
+  };
+
+  switch(mode) {
+  case Mode::Direct: {
+    u32 address = fetch();
+    if((n8)d) idle();
+    return direct(address, false);
+  }
+
+  case Mode::DirectX:
+  case Mode::DirectY: {
+    u32 address = fetch();
+    if((n8)d) idle();
+    idle();
+    load(reg(0), mode == Mode::DirectX ? Register::X : Register::Y);
+    mov32(sreg(2), reg(0));
+    return direct(address, true);
+  }
+
+  case Mode::Bank: {
+    u32 address = fetch();
+    address |= fetch() << 8;
+    return {.base = (u32)b << 16 | address};
+  }
+
+  case Mode::BankX:
+  case Mode::BankY: {
+    u32 address = fetch();
+    address |= fetch() << 8;
+    load(reg(0), mode == Mode::BankX ? Register::X : Register::Y);
+    mov32(sreg(2), reg(0));
+    add32(reg(1), reg(0), imm(address));
+    crossed(reg(1), imm(address));
+    return {.base = (u32)b << 16 | address, .indexed = true};
+  }
+
+  case Mode::Long:
+  case Mode::LongX: {
+    u32 address = fetch();
+    address |= fetch() << 8;
+    address |= fetch() << 16;
+    if(mode == Mode::Long) return {.base = address};
+    load(reg(0), Register::X);
+    mov32(sreg(2), reg(0));
+    return {.base = address, .indexed = true};
+  }
+
+  case Mode::Indirect:
+  case Mode::IndexedIndirect:
+  case Mode::IndirectIndexed: {
+    u32 address = fetch();
+    if((n8)d) idle();
+    if(mode == Mode::IndexedIndirect) {
+      idle();
+      load(reg(0), Register::X);
+      mov32(sreg(2), reg(0));
+    }
+    auto pointer = direct(address, mode == Mode::IndexedIndirect);
+    read(pointer, 0);
+    mov32(sreg(3), reg(0));
+    read(pointer, 1);
+    shl32(reg(0), reg(0), imm(8));
+    or32(sreg(3), sreg(3), reg(0));
+    if(mode == Mode::IndirectIndexed) {
+      load(reg(0), Register::Y);
+      add32(sreg(2), sreg(3), reg(0));
+      crossed(sreg(2), sreg(3));
+    } else {
+      mov32(sreg(2), sreg(3));
+    }
+    return {.base = (u32)b << 16, .indexed = true};
+  }
+
+  case Mode::IndirectLong:
+  case Mode::IndirectLongY: {
+    u32 address = fetch();
+    if((n8)d) idle();
+    Address pointer{.base = d + address, .mask = 0xffff};
+    read(pointer, 0);
+    mov32(sreg(3), reg(0));
+    read(pointer, 1);
+    shl32(reg(0), reg(0), imm(8));
+    or32(sreg(3), sreg(3), reg(0));
+    read(pointer, 2);
+    shl32(reg(0), reg(0), imm(16));
+    or32(sreg(2), sreg(3), reg(0));
+    if(mode == Mode::IndirectLongY) {
+      load(reg(0), Register::Y);
+      add32(sreg(2), sreg(2), reg(0));
+    }
+    return {.indexed = true};
+  }
+
+  case Mode::Stack: {
+    u32 address = fetch();
+    idle();
+    load(reg(0), Register::S);
+    mov32(sreg(2), reg(0));
+    return {.base = address, .mask = 0xffff, .indexed = true};
+  }
+
+  case Mode::IndirectStack: {
+    u32 address = fetch();
+    idle();
+    load(reg(0), Register::S);
+    mov32(sreg(2), reg(0));
+    Address pointer{.base = address, .mask = 0xffff, .indexed = true};
+    read(pointer, 0);
+    mov32(sreg(3), reg(0));
+    read(pointer, 1);
+    shl32(reg(0), reg(0), imm(8));
+    or32(sreg(3), sreg(3), reg(0));
+    idle();
+    load(reg(0), Register::Y);
+    add32(sreg(2), sreg(3), reg(0));
+    return {.base = (u32)b << 16, .indexed = true};
+  }
+
+  case Mode::Immediate:
+    break;
+  }
+
+  return {};
+}
+
+auto WDC65816::Recompiler::emitBranch(u32 flag, bool value) -> void {
+  u32 displacement = (i8)fetch();
+  u32 target = pc & 0xff0000 | (n16)(pc + displacement);
+
+  sljit_jump* skip = nullptr;
+  if(flag != Always) {
+    mov32_u8(reg(0), mem(sreg(1), flag));
+    skip = cmp32_jump(reg(0), imm(value), flag_ne);
+  }
+
+  u32 clocks = pendingClocks;
+  u32 cycles = pendingCycles;
+  if(e && (pc >> 8 & 0xff) != (target >> 8 & 0xff)) idle();
+  idle();
+  emitExit(target, Branch);
+  pendingClocks = clocks;
+  pendingCycles = cycles;
+
+  if(skip) {
+    setLabel(skip);
+    emitExit(pc, Fall);
+  }
+}
+
+//ends the block at the given address (or at the address already stored in PC for ~0),
+//performing the idle cycles of a taken branch or jump, and polling for interrupts.
+//the pending clock ticks are left in place, as other paths through the block still use them.
+auto WDC65816::Recompiler::emitExit(u32 target, u32 jump) -> void {
+  if(pendingCycles) {
+    add32(Field(clocks), Field(clocks), imm(pendingClocks));
+    add32(Field(cycles), Field(cycles), imm(pendingCycles));
+  }
+  if(target != ~0) mov32(Reg(pc.d), imm(target));
+  mov32(reg(1), imm(jump));
+  call(&WDC65816::exitTrampoline);
+  jumpEpilog();
+}
+
+//pushes the value in reg(0), as the interpreter's push() does
+auto WDC65816::Recompiler::emitPush(bool wide) -> void {
+  mov32(sreg(3), reg(0));
+  if(wide) emitPush(8, false);
+  emitPush(0, false);
+}
+
+//pushes one byte of sreg(3); in emulation mode, push() wraps within page one and pushN() does not
+auto WDC65816::Recompiler::emitPush(u32 shift, bool native) -> void {
+  mov32_u16(sreg(2), Reg(s.w));
+  write({.mask = 0xffff, .indexed = true}, 0, shift);
+  sub32(reg(0), sreg(2), imm(1));
+  if(e && !native) and32(reg(0), reg(0), imm(0xff));
+  store(Register::S, reg(0), !e || native);
+}
+
+//pulls one byte into reg(0)
+auto WDC65816::Recompiler::emitPull(bool native) -> void {
+  load(reg(0), Register::S);
+  add32(reg(0), reg(0), imm(1));
+  if(e && !native) and32(reg(0), reg(0), imm(0xff));
+  store(Register::S, reg(0), !e || native);
+  mov32_u16(sreg(2), Reg(s.w));
+  read({.mask = 0xffff, .indexed = true}, 0);
+}
+
+auto WDC65816::Recompiler::emitPull(Register target, bool wide) -> void {
+  idle();
+  idle();
+  emitPull(false);
+  if(wide) {
+    mov32(sreg(3), reg(0));
+    emitPull(false);
+    shl32(reg(0), reg(0), imm(8));
+    or32(reg(0), reg(0), sreg(3));
+  }
+  store(target, reg(0), wide);
+  flagsZN(reg(0), wide);
+}
+
+//instructions using pushN() and pullN() leave the stack in page one in emulation mode
+auto WDC65816::Recompiler::emitStackFixup() -> void {
+  if(!e) return;
+  load(reg(0), Register::S);
+  and32(reg(0), reg(0), imm(0xff));
+  or32(reg(0), reg(0), imm(0x100));
+  store(Register::S, reg(0), 1);
+}
+
+//adds the clock ticks of accesses made so far to the runtime count
+auto WDC65816::Recompiler::commit() -> void {
+  if(!pendingCycles) return;
+  add32(Field(clocks), Field(clocks), imm(pendingClocks));
+  add32(Field(cycles), Field(cycles), imm(pendingCycles));
+  pendingClocks = 0;
+  pendingCycles = 0;
+}
+
+auto WDC65816::Recompiler::fetch() -> n8 {
+  auto& page = pages[pc >> PageBits];
+  n8 data = page.read[pc & PageSize - 1];
+  pendingClocks += page.clocks;
+  pendingCycles++;
+  pc = pc & 0xff0000 | (n16)(pc + 1);
+  return data;
+}
+
+auto WDC65816::Recompiler::idle() -> void {
+  pendingClocks += idleClocks;
+  pendingCycles++;
+}
+
+//reads one byte into reg(0)
+auto WDC65816::Recompiler::read(Address address, u32 offset) -> void {
+  if(!address.indexed) {
+    u32 target = (address.base + offset & address.mask) | address.bits;
+    auto& page = pages[target >> PageBits];
+    if(page.read) {
+      mov32_u8(reg(0), mem0((sljit_sw)(page.read + (target & PageSize - 1))));
+      mov32(Reg(mar), imm(target));
+      mov32_u8(Reg(mdr), reg(0));
+      pendingClocks += page.clocks;
+      pendingCycles++;
+      return;
+    }
+    commit();
+    mov32(reg(1), imm(target));
+    call(&WDC65816::readTrampoline);
+    return;
+  }
+
+  commit();
+  emitLookup(address, offset);
+  mov64(reg(3), mem(reg(2), offsetof(Page, read)));
+  cmp64(reg(3), imm(0), set_z);
+  auto slow = jump(flag_z);
+  add32(Field(clocks), Field(clocks), mem(reg(2), offsetof(Page, clocks)));
+  add32(Field(cycles), Field(cycles), imm(1));
+  and32(reg(2), reg(1), imm(PageSize - 1));
+  mov64_u32(reg(2), reg(2));
+  add64(reg(3), reg(3), reg(2));
+  mov32_u8(reg(0), mem(reg(3), 0));
+  mov32(Reg(mar), reg(1));
+  mov32_u8(Reg(mdr), reg(0));
+  auto done = jump();
+  setLabel(slow);
+  call(&WDC65816::readTrampoline);
+  setLabel(done);
+}
+
+//writes one byte of sreg(3)
+auto WDC65816::Recompiler::write(Address address, u32 offset, u32 shift) -> void {
+  lshr32(reg(0), sreg(3), imm(shift));
+  and32(reg(0), reg(0), imm(0xff));
+
+  if(!address.indexed) {
+    u32 target = (address.base + offset & address.mask) | address.bits;
+    auto& page = pages[target >> PageBits];
+    //the remainder of the block may have been compiled from the bytes being written
+    if(target >= start && target < end) ended = true;
+    if(page.write) {
+      mov32_u8(mem0((sljit_sw)(page.write + (target & PageSize - 1))), reg(0));
+      mov32(Reg(mar), imm(target));
+      mov32_u8(Reg(mdr), reg(0));
+      pendingClocks += page.clocks;
+      pendingCycles++;
+      return;
+    }
+    commit();
+    mov32(reg(2), reg(0));
+    mov32(reg(1), imm(target));
+    call(&WDC65816::writeTrampoline);
+    //the write may have changed the memory map or raised an interrupt
+    ended = true;
+    return;
+  }
+
+  dynamic = true;
+  commit();
+  emitLookup(address, offset);
+  mov64(reg(3), mem(reg(2), offsetof(Page, write)));
+  cmp64(reg(3), imm(0), set_z);
+  auto slow = jump(flag_z);
+  add32(Field(clocks), Field(clocks), mem(reg(2), offsetof(Page, clocks)));
+  add32(Field(cycles), Field(cycles), imm(1));
+  and32(reg(2), reg(1), imm(PageSize - 1));
+  mov64_u32(reg(2), reg(2));
+  add64(reg(3), reg(3), reg(2));
+  mov32_u8(mem(reg(3), 0), reg(0));
+  mov32(Reg(mar), reg(1));
+  mov32_u8(Reg(mdr), reg(0));
+  auto done = jump();
+  setLabel(slow);
+  mov32(reg(2), reg(0));
+  call(&WDC65816::writeTrampoline);
+  setLabel(done);
+}
+
+//computes a runtime address into reg(1), and a pointer to its page into reg(2)
+auto WDC65816::Recompiler::emitLookup(Address address, u32 offset) -> void {
+  static_assert(sizeof(Page) == 32);
+  add32(reg(1), sreg(2), imm(address.base + offset));
+  and32(reg(1), reg(1), imm(address.mask));
+  if(address.bits) or32(reg(1), reg(1), imm(address.bits));
+  lshr32(reg(2), reg(1), imm(PageBits));
+  mov64_u32(reg(2), reg(2));
+  shl64(reg(2), reg(2), imm(5));
+  add64(reg(2), reg(2), imm((sljit_sw)pages.data()));
+}
+
+//readDirect(): in emulation mode with a page-aligned D, the direct page wraps within itself
+auto WDC65816::Recompiler::direct(u32 offset, bool indexed) const -> Address {
+  if(e && !(n8)d) return {.base = offset, .mask = 0xff, .bits = d, .indexed = indexed};
+  return {.base = d + offset, .mask = 0xffff, .indexed = indexed};
+}
+
+auto WDC65816::Recompiler::load(reg target, Register source) -> void {
+  switch(source) {
+  case Register::A: return mov32_u16(target, Reg(a.w));
+  case Register::X: return mov32_u16(target, Reg(x.w));
+  case Register::Y: return mov32_u16(target, Reg(y.w));
+  case Register::Z: return mov32(target, imm(0));
+  case Register::S: return mov32_u16(target, Reg(s.w));
+  case Register::D: return mov32(target, imm(d));
+  }
+}
+
+//stores the value, which must already be masked to the register width
+auto WDC65816::Recompiler::store(Register target, reg value, bool wide) -> void {
+  auto store = [&](auto field) {
+    if(wide) return mov32_u16(field, value);
+    mov32_u16(reg(3), field);
+    and32(reg(3), reg(3), imm(0xff00));
+    or32(reg(3), reg(3), value);
+    mov32_u16(field, reg(3));
+  };
+
+  switch(target) {
+  case Register::A: return store(Reg(a.w));
+  case Register::X: return store(Reg(x.w));
+  case Register::Y: return store(Reg(y.w));
+  case Register::S: return store(Reg(s.w));
+  case Register::D: return store(Reg(d.w));
+  case Register::Z: return;
+  }
+}
+
+auto WDC65816::Recompiler::flagsZN(reg value, bool wide) -> void {
+  cmp32(value, imm(0), set_z);
+  mov32_f(reg(3), flag_z);
+  mov32_u8(Reg(p.z), reg(3));
+  lshr32(reg(3), value, imm(wide ? 15 : 7));
+  and32(reg(3), reg(3), imm(1));
+  mov32_u8(Reg(p.n), reg(3));
+}
+
+auto WDC65816::Recompiler::length(n8 opcode, bool m, bool x) -> u32 {
+  u32 length = lengths[opcode];
+  if((opcode & 0x1f) == 0x09) length += !m;
+  if(opcode == 0xa0 || opcode == 0xa2 || opcode == 0xc0 || opcode == 0xe0) length += !x;
+  return length;
+}
+
+auto WDC65816::Recompiler::algorithm(u32 group, bool wide) -> auto (WDC65816::*)(u32) -> u32 {
+  #define op(name) (wide ? &WDC65816::algorithmTrampoline<&WDC65816::algorithm##name##16> \
+                         : &WDC65816::algorithmTrampoline<&WDC65816::algorithm##name##8>)
+  switch(group) {
+  case 0: return op(ORA);
+  case 1: return op(AND);
+  case 2: return op(EOR);
+  case 3: return op(ADC);
+  case 5: return op(LDA);
+  case 6: return op(CMP);
+  case 7: return op(SBC);
+  }
+  #undef op
+  return nullptr;
+}
+
+auto WDC65816::readTrampoline(u32 address) -> u32 {
+  recompiler.flush();
+  return read(address);  //virtual function call
+}
+
+auto WDC65816::writeTrampoline(u32 address, u32 data) -> void {
+  recompiler.flush();
+  recompiler.exit = true;
+  return write(address, data);  //virtual function call
+}
+
+auto WDC65816::exitTrampoline(u32 jump) -> void {
+  recompiler.flush();
+  recompiler.exit = false;
+  if(jump == Recompiler::Branch) idleBranch();  //virtual function call
+  if(jump == Recompiler::Jump) idleJump();      //virtual function call
+  lastCycle();  //virtual function call
+}
+
+auto WDC65816::readFlags() -> u32 {
+  return r.p;
+}
+
+//plp
+auto WDC65816::writeFlags(u32 data) -> void {
+  r.p = data;
+  if(r.e) r.p.x = 1, r.p.m = 1;
+  if(r.p.x) r.x.h = 0x00, r.y.h = 0x00;
+}
+
+#undef Reg
+#undef Field
+#undef offset
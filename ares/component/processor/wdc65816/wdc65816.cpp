@@ -32,9 +32,16 @@ auto WDC65816::power() -> void {
   r.mdr = 0x00;
 
   r.vector = 0xfffc;  //reset vector address
+
+  if constexpr(Accuracy::Recompiler) {
+    auto buffer = ares::Memory::FixedAllocator::get().tryAcquire(8_MiB);
+    recompiler.allocator.resize(8_MiB, bump_allocator::executable, buffer);
+    recompiler.reset();
+  }
 }
 
 #include "registers.hpp"
+#include "recompiler.cpp"
 #include "serialization.cpp"
 #include "disassembler.cpp"
 
@@ -4,9 +4,13 @@
 
 #pragma once
 
+#include <nall/recompiler/generic/generic.hpp>
+
 namespace ares {
 
 struct WDC65816 {
+  #include "accuracy.hpp"
+
   virtual auto idle() -> void = 0;
   virtual auto idleBranch() -> void {}
   virtual auto idleJump() -> void {}
@@ -19,6 +23,9 @@ struct WDC65816 {
 
   virtual auto readDisassembler(n24 address) -> n8 { return 0; }
 
+  //steps the bus cycles performed by a recompiled block through host memory
+  virtual auto stepBlock(u32 clocks, u32 cycles) -> void {}
+
   auto irq() const -> bool { return r.irq; }
   auto irq(bool line) -> void { r.irq = line; }
 
@@ -231,6 +238,17 @@ struct WDC65816 {
   //instruction.cpp
   auto instruction() -> void;
 
+  //recompiler.cpp
+  auto readTrampoline(u32 address) -> u32;
+  auto writeTrampoline(u32 address, u32 data) -> void;
+  auto exitTrampoline(u32 jump) -> void;
+  auto readFlags() -> u32;
+  auto writeFlags(u32 data) -> void;
+
+  template<auto op> auto algorithmTrampoline(u32 data) -> u32 {
+    return (this->*op)(data);
+  }
+
   //serialization.cpp
   auto serialize(serializer&) -> void;
 
@@ -290,6 +308,141 @@ struct WDC65816 {
     r24 v;  //temporary register
     r24 w;  //temporary register
   } r;
+
+  struct Recompiler : recompiler::generic {
+    WDC65816& self;
+    Recompiler(WDC65816& self) : self(self), generic(allocator) {}
+
+    static constexpr u32 PageBits = 11;  //2 KiB, the size of the SA-1 I-RAM
+    static constexpr u32 PageSize = 1 << PageBits;
+
+    //host memory the recompiler may access without going through the bus.
+    //filled in by the owner of the core, which must invalidate all blocks when it changes.
+    struct alignas(32) Page {
+      n8* read = nullptr;     //memory backing reads, or nullptr for bus reads
+      n8* write = nullptr;    //memory backing writes, or nullptr for bus writes
+      u32 clocks = 0;         //clock ticks per access
+      bool constant = false;  //contents never change (ROM)
+    };
+
+    struct Block {
+      auto execute(WDC65816& self) -> void {
+        ((void (*)(WDC65816*, Registers*))code)(&self, &self.r);
+      }
+
+      u8* code;      //nullptr if the first instruction is left to the interpreter
+      Block* next;   //block at the same address compiled for another entry state
+      u32 state;     //E, M, X, B and D at entry
+      u32 size;      //bytes of code covered by the block
+      n8* source;    //writable memory the code was compiled from
+      n8* bytes;     //copy of the code as it was compiled, when source is writable
+    };
+
+    struct Pool {
+      u32 generation;
+      Block* blocks[1 << 8];
+    };
+
+    enum class Mode : u32 {
+      Immediate, Direct, DirectX, DirectY, Bank, BankX, BankY, Long, LongX,
+      Indirect, IndexedIndirect, IndirectIndexed, IndirectLong, IndirectLongY, Stack, IndirectStack,
+    };
+
+    enum class Register : u32 { A, X, Y, Z, S, D };
+
+    //results of emitInstruction()
+    enum : u32 { Continue, End, Exited, Unsupported };
+
+    //idle cycles performed by emitExit(), and the flag that makes emitBranch() unconditional
+    enum : u32 { Fall, Branch, Jump, Always = ~0u };
+
+    //an effective address: ((base + index + offset) & mask) | bits, where the index is held in sreg(2)
+    struct Address {
+      u32 base = 0;
+      u32 mask = 0xffffff;
+      u32 bits = 0;
+      bool indexed = false;
+    };
+
+    auto reset() -> void {
+      allocator.release();
+      generation = 0;
+      pools.resize(1 << 16);
+      std::ranges::fill(pools, nullptr);
+      pages.resize(1 << 24 - PageBits);
+      clocks = 0;
+      cycles = 0;
+      exit = false;
+    }
+
+    auto invalidate() -> void {
+      generation++;
+    }
+
+    auto flush() -> void {
+      if(!cycles) return;
+      u32 clocks = this->clocks, cycles = this->cycles;
+      this->clocks = 0;
+      this->cycles = 0;
+      self.stepBlock(clocks, cycles);
+    }
+
+    auto state() const -> u32;
+    auto pool(u32 address) -> Pool*;
+    auto block() -> Block*;
+    auto emit(u32 address, u32 state) -> Block*;
+    auto emitInstruction() -> u32;
+    auto emitRead(Mode mode, auto (WDC65816::*op)(u32) -> u32, bool wide) -> void;
+    auto emitWrite(Mode mode, Register source, bool wide) -> void;
+    auto emitModify(Mode mode, auto (WDC65816::*op)(u32) -> u32, bool wide) -> void;
+    auto emitImplied(auto (WDC65816::*op)(u32) -> u32, Register target, bool wide) -> void;
+    auto emitTransfer(Register source, Register target, bool wide) -> void;
+    auto emitAddress(Mode mode, bool write) -> Address;
+    auto emitBranch(u32 flag, bool value) -> void;
+    auto emitExit(u32 target, u32 jump) -> void;
+    auto emitPush(bool wide) -> void;
+    auto emitPush(u32 shift, bool native) -> void;
+    auto emitPull(bool native) -> void;
+    auto emitPull(Register target, bool wide) -> void;
+    auto emitStackFixup() -> void;
+    auto emitLookup(Address address, u32 offset) -> void;
+    auto commit() -> void;
+    auto fetch() -> n8;
+    auto idle() -> void;
+    auto read(Address address, u32 offset) -> void;
+    auto write(Address address, u32 offset, u32 shift) -> void;
+    auto direct(u32 offset, bool indexed) const -> Address;
+    auto load(reg target, Register source) -> void;
+    auto store(Register target, reg value, bool wide) -> void;
+    auto flagsZN(reg value, bool wide) -> void;
+
+    static auto length(n8 opcode, bool m, bool x) -> u32;
+    static auto algorithm(u32 group, bool wide) -> auto (WDC65816::*)(u32) -> u32;
+
+    bool enabled = false;
+    u32 generation;
+    u32 idleClocks = 0;  //clock ticks per idle cycle
+    bump_allocator allocator;
+    std::vector<Pool*> pools;
+    std::vector<Page> pages;
+
+    //bus cycles performed through host memory and not yet stepped
+    u32 clocks = 0;
+    u32 cycles = 0;
+    bool exit = false;  //a bus write ends the block after the current instruction
+
+    //state of the block being emitted
+    n24 pc;
+    bool e, m, x;
+    n8 b;
+    n16 d;
+    u32 pendingClocks;   //clock ticks of accesses known at compile time
+    u32 pendingCycles;
+    u32 start;           //first and last+1 address of the code in the block
+    u32 end;
+    bool ended;          //the current instruction must end the block
+    bool dynamic;        //the current instruction writes to a runtime address
+  } recompiler{*this};
 };
 
 }
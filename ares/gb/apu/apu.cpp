@@ -16,7 +16,7 @@ auto APU::load(Node::Object parent) -> void {
 
   stream = node->append<Node::Audio::Stream>("PSG");
   stream->setChannels(2);
-  stream->setFrequency(2 * 1024 * 1024);
+  stream->setFrequency(lazy ? 48'000 : 2 * 1024 * 1024);
   stream->addHighPassFilter(20.0, 1);
 }
 
@@ -26,13 +26,37 @@ auto APU::unload() -> void {
   node.reset();
 }
 
+//one APU clock is four ticks: two CPU clocks at normal speed, or four at double speed.
+auto APU::step(u32 ticks) -> void {
+  if(lazy) this->ticks += ticks;
+}
+
+auto APU::synchronize() -> void {
+  if(!lazy) return;
+  while(ticks >= 4) {
+    ticks -= 4;
+    run();
+  }
+  flush();
+}
+
 auto APU::main() -> void {
+  run();
+  Thread::step(1);
+  Thread::synchronize(cpu);
+}
+
+auto APU::run() -> void {
   square1.run();
   square2.run();
   wave.run();
   noise.run();
   sequencer.run();
-  stream->frame(sequencer.left / 32768.0, sequencer.right / 32768.0);
+  if(lazy) {
+    output.sample(sequencer.left, sequencer.right);
+  } else {
+    stream->frame(sequencer.left / 32768.0, sequencer.right / 32768.0);
+  }
 
   if(cycle == 0) {  //512hz
     if(phase == 0 || phase == 2 || phase == 4 || phase == 6) {  //256hz
@@ -52,13 +76,52 @@ auto APU::main() -> void {
     phase++;
   }
   cycle++;
+}
 
-  Thread::step(1);
-  Thread::synchronize(cpu);
+//used by the Super Game Boy while the DMG is held in reset: outputs silence for one APU clock.
+auto APU::idle() -> void {
+  if(!lazy) return stream->frame(0.0, 0.0);
+  output.sample(0, 0);
+  if(output.clocks >= 4096) flush();
+}
+
+auto APU::flush() -> void {
+  output.left.endFrame(output.clocks);
+  output.right.endFrame(output.clocks);
+  output.clocks = 0;
+  while(output.left.pending()) {
+    stream->frame(output.left.read(), output.right.read());
+  }
+}
+
+auto APU::setFrequency(f64 frequency) -> void {
+  if(!lazy) return stream->setFrequency(frequency);
+  flush();
+  output.left.setClockFrequency(frequency);
+  output.right.setClockFrequency(frequency);
+}
+
+auto APU::Output::sample(i16 left, i16 right) -> void {
+  if(left != lastLeft) {
+    this->left.addDelta(clocks, (left - lastLeft) / 32768.0);
+    lastLeft = left;
+  }
+  if(right != lastRight) {
+    this->right.addDelta(clocks, (right - lastRight) / 32768.0);
+    lastRight = right;
+  }
+  clocks++;
 }
 
 auto APU::power() -> void {
-  Thread::create(2 * 1024 * 1024, std::bind_front(&APU::main, this));
+  if(lazy) Thread::destroy();
+  else Thread::create(2 * 1024 * 1024, std::bind_front(&APU::main, this));
+  output.left.reset(2 * 1024 * 1024, 48'000);
+  output.right.reset(2 * 1024 * 1024, 48'000);
+  output.lastLeft = 0;
+  output.lastRight = 0;
+  output.clocks = 0;
+  ticks = 0;
 
   square1.power();
   square2.power();
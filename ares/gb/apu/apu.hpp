@@ -1,3 +1,6 @@
+//by default the APU runs as its own thread, one clock at a time.
+//when lazy, it is never scheduled: the CPU accrues time via step(), and the APU catches up
+//whenever its registers are accessed and once per frame, with band-limited output.
 struct APU : Thread {
   Node::Object node;
   Node::Audio::Stream stream;
@@ -6,7 +9,13 @@ struct APU : Thread {
   auto load(Node::Object) -> void;
   auto unload() -> void;
 
+  auto step(u32 ticks) -> void;
+  auto synchronize() -> void;
   auto main() -> void;
+  auto run() -> void;
+  auto idle() -> void;
+  auto flush() -> void;
+  auto setFrequency(f64 frequency) -> void;
   auto power() -> void;
 
   //io.cpp
@@ -170,8 +179,24 @@ struct APU : Thread {
     i16 right;
   } sequencer;
 
+  struct Output {
+    auto sample(i16 left, i16 right) -> void;
+
+    auto serialize(serializer&) -> void;
+
+    DSP::Resampler::Blip left;
+    DSP::Resampler::Blip right;
+    i16 lastLeft;
+    i16 lastRight;
+    u32 clocks;
+  } output;
+
   n3 phase;   //high 3-bits of clock counter
   n12 cycle;  //low 12-bits of clock counter
+  u32 ticks;  //8 MiHz ticks elapsed on the CPU that the APU has yet to run
+
+//unserialized:
+  bool lazy = false;  //set via the "Lazy APU" option before the system is loaded
 };
 
 extern APU apu;
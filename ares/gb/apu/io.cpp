@@ -1,4 +1,6 @@
 auto APU::readIO(u32 cycle, n16 address, n8 data) -> n8 {
+  if((address >= 0xff10 && address <= 0xff3f) || address == 0xff76 || address == 0xff77) synchronize();
+
   if(Model::GameBoyColor()) {
     //PCM12
     if(address == 0xff76 && cycle == 2) {
@@ -181,6 +183,7 @@ auto APU::readIO(u32 cycle, n16 address, n8 data) -> n8 {
 
 auto APU::writeIO(u32 cycle, n16 address, n8 data) -> void {
   if(address < 0xff10 || address > 0xff3f) return;
+  synchronize();
 
   if(!sequencer.enable) {
     bool valid = address == 0xff26;  //NR52
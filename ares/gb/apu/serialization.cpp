@@ -1,5 +1,12 @@
 auto APU::serialize(serializer& s) -> void {
-  Thread::serialize(s);
+  //the lazy APU has no thread, so there is no stack to save
+  if(lazy) {
+    s(_frequency);
+    s(_scalar);
+    s(_clock);
+  } else {
+    Thread::serialize(s);
+  }
   s(square1);
   s(square2);
   s(wave);
@@ -7,4 +14,14 @@ auto APU::serialize(serializer& s) -> void {
   s(sequencer);
   s(phase);
   s(cycle);
+  s(ticks);
+  s(output);
+}
+
+auto APU::Output::serialize(serializer& s) -> void {
+  s(left);
+  s(right);
+  s(lastLeft);
+  s(lastRight);
+  s(clocks);
 }
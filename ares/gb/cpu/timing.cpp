@@ -27,6 +27,8 @@ auto CPU::step(u32 clocks) -> void {
     Thread::synchronize();
   }
 
+  apu.step(clocks << !status.speedDouble);
+
   if(Model::SuperGameBoy()) {
     system.information.clocksExecuted += clocks;
   }
@@ -3,6 +3,7 @@
 
 #include <ares/ares.hpp>
 #include <vector>
+#include <nall/dsp/resampler/blip.hpp>
 #include <component/processor/sm83/sm83.hpp>
 #include <component/eeprom/m93lcx6/m93lcx6.hpp>
 
@@ -10,6 +11,7 @@ namespace ares::GameBoy {
   #include <ares/inline.hpp>
   auto enumerate() -> std::vector<string>;
   auto load(Node::System& node, string name) -> bool;
+  auto option(string name, string value) -> bool;
 
   struct Model {
     inline static auto GameBoy() -> bool;
@@ -85,6 +85,7 @@ auto PPU::main() -> void {
   if(!status.displayEnable || cpu.r.stop) {
     step(456 * 154);
     if(screen) screen->frame();
+    apu.synchronize();
     scheduler.exit(Event::Frame);
     return;
   }
@@ -133,6 +134,7 @@ auto PPU::main() -> void {
   if(status.ly == 144) {
     cpu.raise(CPU::Interrupt::VerticalBlank);
     if(screen) screen->frame();
+    apu.synchronize();
     scheduler.exit(Event::Frame);
 
     latch.displayEnable = 0;
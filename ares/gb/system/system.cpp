@@ -17,6 +17,11 @@ auto load(Node::System& node, string name) -> bool {
   return system.load(node, name);
 }
 
+auto option(string name, string value) -> bool {
+  if(name == "Lazy APU") apu.lazy = value.boolean();
+  return true;
+}
+
 Scheduler scheduler;
 System system;
 SuperGameBoyInterface* superGameBoy = nullptr;
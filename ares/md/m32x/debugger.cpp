@@ -42,6 +42,7 @@ auto M32X::VDP::Debugger::load(Node::Object parent) -> void {
     return m32x.vdp.dram[address >> 1].byte(!(address & 1));
   });
   memory.dram->setWrite([&](u32 address, u8 data) -> void {
+    m32x.vdp.wait();
     m32x.vdp.dram[address >> 1].byte(!(address & 1)) = data;
   });
 
@@ -9,6 +9,7 @@ M32X m32x;
 #include "io-internal.cpp"
 #include "io-external.cpp"
 #include "vdp.cpp"
+#include "renderer.cpp"
 #include "pwm.cpp"
 #include "debugger.cpp"
 #include "serialization.cpp"
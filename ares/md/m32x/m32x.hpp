@@ -75,6 +75,9 @@ struct M32X {
   };
 
   struct VDP {
+    //composites the framebuffer over each line on a separate thread, behind the Mega Drive VDP
+    static constexpr bool Threaded = true;
+
     maybe<M32X&> self;
     Memory::Writable<n16> dram;
     Memory::Writable<n16> cram;
@@ -96,16 +99,24 @@ struct M32X {
     auto unload() -> void;
     auto power(bool reset) -> void;
 
+    struct Line;
     auto scanline(u32 pixels[1280], u32 y) -> void;
-    auto scanlineMode1(u32 pixels[1280], u32 y) -> void;
-    auto scanlineMode2(u32 pixels[1280], u32 y) -> void;
-    auto scanlineMode3(u32 pixels[1280], u32 y) -> void;
-    auto plot(u32* output, u16 color) -> void;
+    auto scanline(const Line&) -> void;
+    auto scanlineMode1(const Line&) -> void;
+    auto scanlineMode2(const Line&) -> void;
+    auto scanlineMode3(const Line&) -> void;
+    auto plot(u32* output, u16 color, n1 priority) -> void;
     auto fill() -> void;
     auto selectFramebuffer(n1 active) -> void;
     auto framebufferEngaged() -> bool;
     auto paletteEngaged() -> bool;
 
+    //renderer.cpp
+    auto main(uintptr) -> void;
+    auto wait() -> void;
+    auto kill() -> void;
+    auto start() -> void;
+
     //serialization.cpp
     auto serialize(serializer&) -> void;
 
@@ -129,6 +140,21 @@ struct M32X {
       n1 priority;
       n1 dotshift;
     } latch;
+
+    //everything needed to composite one line, captured when the line is drawn
+    struct Line {
+      u32* pixels;
+      u32  y;
+      n16* fbram;
+      Latch latch;
+      bool kill;
+      n16  cram[256];
+    };
+
+    nall::thread handle;
+    queue_spsc<Line[256]> fifo;
+    u32 queued = 0;
+    atomic<u32> rendered = 0;
   };
 
   struct PWM : Thread {
@@ -0,0 +1,34 @@
+auto M32X::VDP::main(uintptr) -> void {
+  while(true) {
+    auto line = fifo.await_read();
+    if(line.kill) thread::exit();
+    scanline(line);
+    rendered++;
+  }
+}
+
+//blocks until every queued line has been composited.
+auto M32X::VDP::wait() -> void {
+  if constexpr(Threaded) {
+    while(rendered != queued) spinloop();
+  }
+}
+
+auto M32X::VDP::kill() -> void {
+  if constexpr(Threaded) {
+    Line line{};
+    line.kill = true;
+    fifo.await_write(line);
+    handle.join();
+  }
+}
+
+auto M32X::VDP::start() -> void {
+  if constexpr(Threaded) {
+    kill();
+    fifo.flush();
+    queued = 0;
+    rendered = 0;
+    handle = thread::create(std::bind_front(&M32X::VDP::main, this));
+  }
+}
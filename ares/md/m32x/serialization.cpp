@@ -40,6 +40,7 @@ auto M32X::SH7604::serialize(serializer& s) -> void {
 }
 
 auto M32X::VDP::serialize(serializer& s) -> void {
+  wait();
   s(dram);
   s(cram);
   s(mode);
@@ -5,12 +5,14 @@ auto M32X::VDP::load(Node::Object parent) -> void {
 }
 
 auto M32X::VDP::unload() -> void {
+  kill();
   debugger = {};
   dram.reset();
   cram.reset();
 }
 
 auto M32X::VDP::power(bool reset) -> void {
+  start();
   dram.fill(0);
   cram.fill(0);
   mode = 0;
@@ -32,48 +34,65 @@ auto M32X::VDP::power(bool reset) -> void {
 
 auto M32X::VDP::scanline(u32 pixels[1280], u32 y) -> void {
   if(!Mega32X() || !pixels || y >= (latch.lines ? 240 : 224)) return;
-  if(latch.mode == 1) return scanlineMode1(pixels, y);
-  if(latch.mode == 2) return scanlineMode2(pixels, y);
-  if(latch.mode == 3) return scanlineMode3(pixels, y);
+  if(latch.mode == 0) return;
+
+  //the framebuffer cannot be written while it is displayed, so only the palette needs to be copied.
+  Line line{pixels, y, fbram.data(), latch, false};
+  if(latch.mode.bit(0)) {
+    for(u32 index : range(256)) line.cram[index] = cram[index];
+  }
+
+  if constexpr(Threaded) {
+    queued++;
+    fifo.await_write(line);
+  } else if constexpr(true) {
+    scanline(line);
+  }
+}
+
+auto M32X::VDP::scanline(const Line& line) -> void {
+  if(line.latch.mode == 1) return scanlineMode1(line);
+  if(line.latch.mode == 2) return scanlineMode2(line);
+  if(line.latch.mode == 3) return scanlineMode3(line);
 }
 
-auto M32X::VDP::scanlineMode1(u32 pixels[1280], u32 y) -> void {
-  u16 address = fbram[y];
+auto M32X::VDP::scanlineMode1(const Line& line) -> void {
+  u16 address = line.fbram[line.y];
   for(u32 x : range(320)) {
-    u8 color = fbram[address + (x + latch.dotshift >> 1) & 0xffff].byte(!(x + latch.dotshift & 1));
-    plot(&pixels[x * 4], cram[color]);
+    u8 color = line.fbram[address + (x + line.latch.dotshift >> 1) & 0xffff].byte(!(x + line.latch.dotshift & 1));
+    plot(&line.pixels[x * 4], line.cram[color], line.latch.priority);
   }
 }
 
-auto M32X::VDP::scanlineMode2(u32 pixels[1280], u32 y) -> void {
-  u16 address = fbram[y];
+auto M32X::VDP::scanlineMode2(const Line& line) -> void {
+  u16 address = line.fbram[line.y];
   for(u32 x : range(320)) {
-    u16 pixel = fbram[address++ & 0xffff];
-    plot(&pixels[x * 4], pixel);
+    u16 pixel = line.fbram[address++ & 0xffff];
+    plot(&line.pixels[x * 4], pixel, line.latch.priority);
   }
 }
 
-auto M32X::VDP::scanlineMode3(u32 pixels[1280], u32 y) -> void {
-  u16 address = fbram[y];
+auto M32X::VDP::scanlineMode3(const Line& line) -> void {
+  u16 address = line.fbram[line.y];
   for(u32 x = 0; x < 320;) {
-    u16 word  = fbram[address++ & 0xffff];
+    u16 word  = line.fbram[address++ & 0xffff];
     u8 length = word >> 8;
     u8 color  = word >> 0;
-    u16 pixel = cram[color];
+    u16 pixel = line.cram[color];
     for(u32 repeat : range(min(length+1, 320-x))) {
-      plot(&pixels[x * 4], pixel);
+      plot(&line.pixels[x * 4], pixel, line.latch.priority);
       x++;
     }
   }
 }
 
-auto M32X::VDP::plot(u32* output, u16 color) -> void {
+auto M32X::VDP::plot(u32* output, u16 color, n1 priority) -> void {
   n1 throughbit = color >> 15;
 
   for(int i = 0; i < 4; i++) {
     n1 backdrop = output[i] >> 11;
 
-    if(latch.priority == 0) {
+    if(priority == 0) {
       //Mega Drive has priority
       if(throughbit || backdrop) output[i] = color | 1 << 15;
     } else {
@@ -96,6 +115,8 @@ auto M32X::VDP::selectFramebuffer(n1 select) -> void {
   framebufferSelect = select;
   if(!vblank && latch.mode) return;
 
+  //the displayed framebuffer is about to become writable: finish the lines still reading from it
+  if(framebufferActive != select) wait();
   framebufferActive = select;
   fbram = {dram.data() + 0x10000 * (select == 0), 0x10000};
   bbram = {dram.data() + 0x10000 * (select == 1), 0x10000};
@@ -86,6 +86,7 @@ auto VDP::DAC::fillRightBorder(n8 ofst) -> void {
 
 auto VDP::DAC::dot(n9 hpos, n9 color) -> void {
   if(!pixels) return;
+  if(Mega32X()) m32x.vdp.wait();  //the 32X overlay of this line must land first
 
   if(auto i = pixelIndex(hpos)) {
     u32 index = i();
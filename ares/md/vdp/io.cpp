@@ -72,6 +72,7 @@ auto VDP::write(n1 upper, n1 lower, n24 address, n16 data) -> void {
   //PSG
   case range8(0xc00010, 0xc00017): {
     if(!lower) return;  //byte writes to even PSG registers have no effect
+    psg.synchronize();
     return psg.write(data);
   }
 
@@ -89,6 +90,7 @@ auto VDP::write(n1 upper, n1 lower, n24 address, n16 data) -> void {
       //bit(0,5) is unknown
       dac.test.disableLayers    = data.bit(6);
       dac.test.forceLayer       = data.bit(7,8);
+      psg.synchronize();
       psg.test.volumeOverride   = data.bit(9);
       psg.test.volumeChannel    = data.bit(10,11);
       sprite.test.disablePhase1 = data.bit(12);
@@ -185,7 +185,7 @@ auto VDP::mainH32() -> void {
   if(dac.pixels) {
     blocks<false, true>();
     if(Mega32X()) m32x.vdp.scanline(pixels + 13, vcounter()); //approx 3 and 1/4 pixel offset in H40 pixels
-    if(MegaLD()) mcd.ld.scanline(dac.pixels, vcounter());
+    if(MegaLD()) m32x.vdp.wait(), mcd.ld.scanline(dac.pixels, vcounter());
   } else {
     blocks<false, false>();
     if(MegaLD()) mcd.ld.scanline(dac.pixels, vcounter());
@@ -250,7 +250,7 @@ auto VDP::mainH40() -> void {
   if(dac.pixels) {
     blocks<true, true>();
     if(Mega32X()) m32x.vdp.scanline(pixels, vcounter());
-    if(MegaLD()) mcd.ld.scanline(dac.pixels, vcounter());
+    if(MegaLD()) m32x.vdp.wait(), mcd.ld.scanline(dac.pixels, vcounter());
   } else {
     blocks<true, false>();
     if(MegaLD()) mcd.ld.scanline(dac.pixels, vcounter());
@@ -33,13 +33,12 @@ auto VDP::PSG::main() -> void {
 }
 
 auto VDP::PSG::step(u32 clocks) -> void {
-  Thread::step(clocks);
-  Thread::synchronize(cpu);
+  Passive::step(clocks);
 }
 
 auto VDP::PSG::power(bool reset) -> void {
   SN76489::power();
-  Thread::create(system.frequency() / 15.0, std::bind_front(&PSG::main, this));
+  Passive::create(system.frequency() / 15.0, std::bind_front(&PSG::main, this));
 
   test = {};
 
@@ -63,7 +63,7 @@ auto VDP::serialize(serializer& s) -> void {
 
 auto VDP::PSG::serialize(serializer& s) -> void {
   SN76489::serialize(s);
-  Thread::serialize(s);
+  Passive::serialize(s);
 
   s(test.volumeOverride);
   s(test.volumeChannel);
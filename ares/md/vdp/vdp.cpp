@@ -117,6 +117,7 @@ auto VDP::frame() -> void {
     screen->setViewport(x, y * yScale, width, height * yScale);
   }
 
+  if(Mega32X()) m32x.vdp.wait();
   screen->frame();
   scheduler.exit(Event::Frame);
 }
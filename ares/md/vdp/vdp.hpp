@@ -89,7 +89,7 @@ struct VDP : Thread {
   auto readControlPort() -> n16;
   auto writeControlPort(n16 data) -> void;
 
-  struct PSG : SN76489, Thread {
+  struct PSG : SN76489, Passive {
     Node::Object node;
     Node::Audio::Stream stream;
 
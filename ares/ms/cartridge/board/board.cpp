@@ -12,7 +12,7 @@ namespace Board {
 
 auto Interface::load(Memory::Readable<n8>& memory, string name) -> bool {
   if(auto fp = pak->read(name)) {
-    memory.allocate(fp->size());
+    memory.reset();
     memory.load(fp);
     return true;
   }
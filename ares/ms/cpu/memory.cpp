@@ -255,6 +255,7 @@ auto CPU::out(n16 address, n8 data) -> void {
   }
 
   else if((address & 0xc0) == 0x40) {
+    psg.synchronize(cpu);
     psg.write(data);
   }
 
@@ -276,6 +277,7 @@ auto CPU::out(n16 address, n8 data) -> void {
 
   else if((address & 0xff) == 0xf2 && opll.node) {
     if(Model::MarkIII()) data.bit(1) = 0;
+    psg.synchronize(cpu);
     if(data.bit(0,1) == 0) psg.io.mute = 0, opll.io.mute = 1;
     if(data.bit(0,1) == 1) psg.io.mute = 1, opll.io.mute = 0;
     if(data.bit(0,1) == 2) psg.io.mute = 1, opll.io.mute = 1;
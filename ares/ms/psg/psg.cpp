@@ -54,11 +54,11 @@ auto PSG::main() -> void {
 }
 
 auto PSG::step(u32 clocks) -> void {
-  Thread::step(clocks);
-  Thread::synchronize(cpu);
+  Passive::step(clocks);
 }
 
 auto PSG::balance(n8 data) -> void {
+  synchronize(cpu);
   if(Device::GameGear()) {
     io.enable = data;
   }
@@ -66,7 +66,7 @@ auto PSG::balance(n8 data) -> void {
 
 auto PSG::power() -> void {
   SN76489::power();
-  Thread::create(system.colorburst() / 16.0, std::bind_front(&PSG::main, this));
+  Passive::create(system.colorburst() / 16.0, std::bind_front(&PSG::main, this));
 
   io = {};
   for(u32 level : range(15)) {
@@ -1,4 +1,4 @@
-struct PSG : SN76489, Thread {
+struct PSG : SN76489, Passive {
   Node::Object node;
   Node::Audio::Stream stream;
 
@@ -1,6 +1,6 @@
 auto PSG::serialize(serializer& s) -> void {
   SN76489::serialize(s);
-  Thread::serialize(s);
+  Passive::serialize(s);
   s(io.mute);
   s(io.enable);
 }
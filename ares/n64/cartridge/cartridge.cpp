@@ -48,6 +48,10 @@ auto Cartridge::connect() -> void {
 
   rtc.load();
 
+  if constexpr(Accuracy::CPU::Recompiler) {
+    cpu.recompiler.loadProfile(pak->read("jit.profile"), pak->attribute("sha256"));
+  }
+
   if(rom.size <= 0x03ff'0000) {
     isviewer.ram.allocate(64_KiB);
     isviewer.tracer = node->append<Node::Debugger::Tracer::Notification>("ISViewer", "Cartridge");
@@ -78,6 +82,9 @@ auto Cartridge::disconnect() -> void {
   eeprom.reset();
   flash.reset();
   isviewer.ram.reset();
+  if constexpr(Accuracy::CPU::Recompiler) {
+    cpu.recompiler.unloadProfile();
+  }
   pak.reset();
   node.reset();
 }
@@ -98,6 +105,12 @@ auto Cartridge::save() -> void {
   }
 
   rtc.save();
+
+  if constexpr(Accuracy::CPU::Recompiler) {
+    if(auto fp = pak->write("jit.profile")) {
+      cpu.recompiler.saveProfile(fp);
+    }
+  }
 }
 
 auto Cartridge::power(bool reset) -> void {
@@ -39,6 +39,7 @@ auto CPU::main() -> void {
     if(instruction()) synchronize();
   }
 
+  rsp.worker.synchronize();
   vi.refreshed = false;
   queue.remove(Queue::GDB_Poll);
   if(GDB::server.hasClient()) {
@@ -62,6 +63,10 @@ auto CPU::queueInsert(u32 event, u32 clocks) -> void {
 }
 
 auto CPU::forceSynchronize() -> void {
+  if(RSP::Worker::active()) {
+    rsp.worker.deferredSynchronize = true;
+    return;
+  }
   jitClockTarget = 0;
 }
 
@@ -69,6 +74,7 @@ auto CPU::synchronize() -> void {
   auto clocks = Thread::clock;
   Thread::clock = 0;
   jitClockTarget = 0;
+  rsp.worker.synchronize();
 
    vi.clock -= clocks;
    ai.clock -= clocks;
@@ -77,7 +83,7 @@ auto CPU::synchronize() -> void {
   pif.clock -= clocks;
   vi.main();
   ai.main();
-  rsp.main();
+  if(!rsp.worker.enabled) rsp.main();
   rdp.main();
   pif.main();
 
@@ -107,6 +113,9 @@ auto CPU::synchronize() -> void {
   scc.count += clocks;
   profile.cpuCycles += clocks;
   if (scc.status.exceptionLevel) profile.cpuCyclesExc += clocks;
+
+  //the RSP batch runs last, so that it overlaps only with the CPU's next instructions
+  if(rsp.worker.enabled) rsp.worker.run();
 }
 
 auto CPU::setInterruptPending(u32 bit, bool value) -> void {
@@ -220,6 +229,7 @@ auto CPU::power(bool reset) -> void {
     auto buffer = ares::Memory::FixedAllocator::get().tryAcquire(63_MiB);
     recompiler.allocator.resize(63_MiB, bump_allocator::executable, buffer);
     recompiler.reset();
+    recompiler.armProfile();
   }
 }
 
@@ -27,6 +27,8 @@ struct CPU : Thread {
       Node::Debugger::Tracer::Notification tlb;
       Node::Debugger::Tracer::Notification emux;
     } tracer;
+
+    u64 registers[32] = {};  //general purpose registers as of the last binary trace record
   } debugger;
 
   //cpu.cpp
@@ -1103,6 +1105,28 @@ struct CPU : Thread {
       u32 icachePaddr = 0;
     };
 
+    //warm-up profile: block entry points compiled during play, kept per game in the cartridge pak.
+    //only addresses, keys and a checksum of the guest code are stored; host code is never persisted.
+    struct ProfileHeader {
+      char signature[8];
+      char sha256[64];
+      u32 entries;
+      u32 reserved;
+    };
+
+    struct ProfileEntry {
+      u32 address;
+      u32 size;
+      u32 checksum;  //CRC32 of the RDRAM words the block was compiled from
+      u32 reserved;
+      u64 vaddrPage;
+      u64 stateKey;
+    };
+
+    static constexpr char ProfileSignature[8] = {'a', 'r', 'e', 's', 'j', 'i', 't', '1'};
+    static constexpr u32 ProfileSize = 64_KiB;
+    static constexpr u32 ProfileCapacity = (ProfileSize - sizeof(ProfileHeader)) / sizeof(ProfileEntry);
+
     enum class EmitPcMode : bool { JitTime, Runtime };
     enum class EmitExecuteResult : u8 { Linear, MayBranch, MayFault };
 
@@ -1111,6 +1135,9 @@ struct CPU : Thread {
       sectionDirty.resize(SectionCount);
       std::ranges::fill(sections, nullptr);
       std::ranges::fill(sectionDirty, 0);
+      profileSections.resize(SectionCount);
+      codeSections.fill(0);
+      for(auto& entry : profile) markCode(entry.address);
       activeBlock = nullptr;
     }
 
@@ -1138,6 +1165,20 @@ struct CPU : Thread {
       return sectionOffset(address) >> SectionLineShift;
     }
 
+    //sections that may hold compiled code or profile entries; writes to any other section cannot
+    //affect the recompiler, so the bus skips invalidation for them without looking at the section.
+    auto hasCode(u32 address) const -> bool {
+      if(address >= RdramSize) return false;
+      u32 index = address >> SectionShift;
+      return codeSections[index >> 6] >> (index & 63) & 1;
+    }
+
+    auto markCode(u32 address) -> void {
+      if(address >= RdramSize) return;
+      u32 index = address >> SectionShift;
+      codeSections[index >> 6] |= 1ull << (index & 63);
+    }
+
     auto invalidate(u32 address) -> void {
       invalidateSection(address);
     }
@@ -1165,6 +1206,7 @@ struct CPU : Thread {
       u32 firstSection = u32(start >> SectionShift);
       u32 lastSection  = u32(end >> SectionShift);
       for(u32 sidx = firstSection; sidx <= lastSection; sidx++) {
+        if(!(codeSections[sidx >> 6] >> (sidx & 63) & 1)) continue;
         if(sectionDirty[sidx]) {
           if(activeBlock && activeBlock->sectionDirty == &sectionDirty[sidx]) {
             self.pipeline.state |= Pipeline::EndBlock;
@@ -1194,6 +1236,16 @@ struct CPU : Thread {
     auto updateStackPointerStateKey(s16 offset) -> void;
     auto section(u32 address) -> Section*;
     auto block(u64 vaddr, u32 address) -> Block*;
+    auto compile(u64 vaddr, u32 address, u64 stateKey) -> Block*;
+
+    auto checksum(u32 address, u32 size) const -> maybe<u32>;
+    auto loadProfile(VFS::File fp, const string& sha256) -> void;
+    auto saveProfile(VFS::File fp) -> void;
+    auto unloadProfile() -> void;
+    auto armProfile() -> void;
+    auto armProfile(u32 address, u32 length) -> void;
+    auto warmProfile() -> void;
+    auto recordProfile(Block* block) -> void;
 
     auto flushDeferredCycles() -> void;
     auto setupPipeline() -> void;
@@ -1243,6 +1295,11 @@ struct CPU : Thread {
     std::vector<SlowPath> slowPaths;
     std::vector<Section*> sections;
     std::vector<u8> sectionDirty;
+    std::array<u64, SectionCount / 64> codeSections{};
+    std::vector<ProfileEntry> profile;
+    std::vector<u8> profileSections;  //sections loaded by PI DMA since the profile was last checked
+    string profileSha256;
+    bool profilePending = false;
   } recompiler{*this};
   s64 jitClockTarget = 0;
 
@@ -2,6 +2,7 @@ auto CPU::Debugger::load(Node::Object parent) -> void {
   tracer.instruction = parent->append<Node::Debugger::Tracer::Instruction>("Instruction", "CPU");
   tracer.instruction->setAddressBits(64, 2);
   tracer.instruction->setDepth(64);
+  tracer.instruction->setArchitecture("VR4300");
   if constexpr(Accuracy::CPU::Recompiler) {
     tracer.instruction->setToggle([&] {
       cpu.recompiler.reset();
@@ -27,6 +28,22 @@ auto CPU::Debugger::unload() -> void {
 auto CPU::Debugger::instruction(u64 address, u32 instruction) -> void {
   if(unlikely(tracer.instruction->enabled())) {
     if(tracer.instruction->address(address)) {
+      if(tracer.instruction->binary()) {
+        //report every general purpose register that changed since the previous record:
+        //the first in the instruction's record, and any others in continuation records
+        constexpr u8 NoRegister = Core::Debugger::Tracer::Instruction::NoRegister;
+        u8 changed[31];
+        u32 count = 0;
+        for(u32 n : range(1, 32)) {
+          if(registers[n] == cpu.ipu.r[n].u64) continue;
+          registers[n] = cpu.ipu.r[n].u64;
+          changed[count++] = n;
+        }
+        if(!count) tracer.instruction->record(instruction, cpu.clock);
+        else tracer.instruction->record(instruction, cpu.clock, changed[0], registers[changed[0]]);
+        for(u32 n : range(1, count)) tracer.instruction->recordRegister(changed[n], registers[changed[n]]);
+        return;
+      }
       cpu.disassembler.showColors = 0;
       tracer.instruction->notify(cpu.disassembler.disassemble(address, instruction), {});
       cpu.disassembler.showColors = 1;
@@ -221,6 +221,20 @@ Invalidation is section-based but line-aware:
 
 This keeps write-side invalidation cheap (since it is bound to memory writes that
 are extremely common) and moves cleanup work to lookup time.
+
+Warm-up profile
+---------------
+Every block compiled on a lookup miss is recorded as (start address, size,
+vaddrPage, stateKey, CRC32 of the guest code). The profile is saved with the
+cartridge and keyed by the ROM sha256; host code itself is never persisted.
+
+On the next run, entries are precompiled from the dispatcher, ahead of the guest
+reaching them:
+- after power on and state loads, every entry is checked;
+- after a PI DMA, only entries in the sections it wrote to are checked.
+
+An entry is compiled only when RDRAM still holds the exact code it was recorded
+from, so overlays and not-yet-loaded code are simply skipped until a later DMA.
 */
 
 auto CPU::Recompiler::computeStateKey() const -> u64 {
@@ -305,6 +319,8 @@ auto CPU::Recompiler::section(u32 address) -> Section* {
 }
 
 auto CPU::Recompiler::block(u64 vaddr, u32 address) -> Block* {
+  if(unlikely(profilePending)) warmProfile();
+
   auto section = this->section(address);
   if(!section) return nullptr;
 
@@ -317,12 +333,19 @@ auto CPU::Recompiler::block(u64 vaddr, u32 address) -> Block* {
     }
   }
 
+  auto block = compile(vaddr, address, stateKey);
+  if(block) recordProfile(block);
+  return block;
+}
+
+//emits a block and links it, along with its alias entries, into the section tables.
+auto CPU::Recompiler::compile(u64 vaddr, u32 address, u64 stateKey) -> Block* {
+  rsp.worker.synchronize();  //code is read straight from RDRAM, which an RSP batch may be writing
   auto block = emit(vaddr, address, stateKey);
   if(block) {
-    if(emitAllocatorFlushed) {
-      section = this->section(address);
-      if(!section) return nullptr;
-    }
+    auto section = this->section(address);
+    if(!section) return nullptr;
+    auto index = blockIndex(address);
     block->next = section->blocks[index];
     section->blocks[index] = block;
     u32 firstLine = sectionLineIndex(block->startAddress);
@@ -331,6 +354,7 @@ auto CPU::Recompiler::block(u64 vaddr, u32 address) -> Block* {
       section->lineBlocks[line] = 1;
     }
     block->sectionDirty = sectionDirty.data() + sectionIndex(block->startAddress);
+    markCode(block->startAddress);
     auto registerAlias = [&](u32 aliasAddress) -> Block* {
       if(aliasAddress == block->startAddress) return block;
       auto aliasIndex = blockIndex(aliasAddress);
@@ -360,6 +384,123 @@ auto CPU::Recompiler::block(u64 vaddr, u32 address) -> Block* {
   return block;
 }
 
+//returns the CRC32 of a range of RDRAM, or nothing if it does not fit within RDRAM.
+auto CPU::Recompiler::checksum(u32 address, u32 size) const -> maybe<u32> {
+  if(!size || size > SectionSize) return nothing;
+  if(!isRdramAddress(address) || !isRdramAddress(address + size - 1)) return nothing;
+  return Hash::CRC32({rdram.ram.data + address, size}).value();
+}
+
+auto CPU::Recompiler::loadProfile(VFS::File fp, const string& sha256) -> void {
+  unloadProfile();
+  profileSha256 = sha256;
+  if(!fp || fp->size() < sizeof(ProfileHeader)) return;
+
+  ProfileHeader header{};
+  fp->seek(0);
+  fp->read((u8*)&header, sizeof(ProfileHeader));
+  if(memory::compare(header.signature, ProfileSignature, sizeof(ProfileSignature))) return;
+  if(sha256.size() != sizeof(header.sha256)) return;
+  if(memory::compare(header.sha256, sha256.data(), sizeof(header.sha256))) return;
+  if(header.entries > ProfileCapacity) return;
+  if(fp->size() < sizeof(ProfileHeader) + header.entries * sizeof(ProfileEntry)) return;
+
+  profile.resize(header.entries);
+  fp->read((u8*)profile.data(), header.entries * sizeof(ProfileEntry));
+  for(auto& entry : profile) markCode(entry.address);
+  armProfile();
+}
+
+auto CPU::Recompiler::saveProfile(VFS::File fp) -> void {
+  //a game that never ran under the recompiler leaves its profile untouched.
+  if(!fp || profile.empty()) return;
+  if(fp->size() < sizeof(ProfileHeader) + profile.size() * sizeof(ProfileEntry)) return;
+
+  ProfileHeader header{};
+  memory::copy(header.signature, ProfileSignature, sizeof(ProfileSignature));
+  memory::copy(header.sha256, profileSha256.data(), min(profileSha256.size(), sizeof(header.sha256)));
+  header.entries = profile.size();
+  fp->seek(0);
+  fp->write((const u8*)&header, sizeof(ProfileHeader));
+  fp->write((const u8*)profile.data(), profile.size() * sizeof(ProfileEntry));
+}
+
+auto CPU::Recompiler::unloadProfile() -> void {
+  profile.clear();
+  profileSha256 = {};
+  profilePending = false;
+}
+
+//schedules every profile entry to be checked against RDRAM on the next block lookup.
+//used after power on and state loads, when the whole block cache was discarded.
+auto CPU::Recompiler::armProfile() -> void {
+  if(profile.empty()) return;
+  profileSections.resize(SectionCount);
+  std::ranges::fill(profileSections, 1);
+  profilePending = true;
+}
+
+//schedules the profile entries in a range of RDRAM to be checked on the next block lookup.
+//used when a PI DMA has loaded the range; other RDRAM writes never trigger a warm-up pass.
+auto CPU::Recompiler::armProfile(u32 address, u32 length) -> void {
+  if(profile.empty() || !length || address >= RdramSize) return;
+  u32 first = sectionIndex(address);
+  u32 last = sectionIndex(min<u64>((u64)address + length, RdramSize) - 1);
+  for(u32 index = first; index <= last; index++) {
+    if(!hasCode(index << SectionShift)) continue;
+    profileSections[index] = 1;
+    profilePending = true;
+  }
+}
+
+//precompiles the profile entries whose sections were loaded by PI DMA since the last pass.
+//an entry is only compiled when RDRAM still holds the exact code it was recorded from;
+//entries that do not match yet are retried the next time their section is loaded.
+auto CPU::Recompiler::warmProfile() -> void {
+  rsp.worker.synchronize();
+  profilePending = false;
+  for(auto& entry : profile) {
+    if(!isRdramAddress(entry.address)) continue;
+    if(!profileSections[sectionIndex(entry.address)]) continue;
+    auto checksum = this->checksum(entry.address, entry.size);
+    if(!checksum || *checksum != entry.checksum) continue;
+
+    auto section = this->section(entry.address);
+    if(!section) continue;
+    bool compiled = false;
+    for(auto block = section->blocks[blockIndex(entry.address)]; block; block = block->next) {
+      if(block->stateKey == entry.stateKey && block->vaddrPage == entry.vaddrPage) {
+        compiled = true;
+        break;
+      }
+    }
+    if(compiled) continue;
+
+    compile(entry.vaddrPage | sectionOffset(entry.address), entry.address, entry.stateKey);
+  }
+  std::ranges::fill(profileSections, 0);
+}
+
+auto CPU::Recompiler::recordProfile(Block* block) -> void {
+  if(profile.size() >= ProfileCapacity) return;
+  u32 size = block->endAddress - block->startAddress;
+  auto checksum = this->checksum(block->startAddress, size);
+  if(!checksum) return;
+
+  ProfileEntry record{};
+  record.address = block->startAddress;
+  record.size = size;
+  record.checksum = *checksum;
+  record.vaddrPage = block->vaddrPage;
+  record.stateKey = block->stateKey;
+  for(auto& entry : profile) {
+    if(entry.address != record.address || entry.checksum != record.checksum) continue;
+    if(entry.vaddrPage != record.vaddrPage || entry.stateKey != record.stateKey) continue;
+    return;
+  }
+  profile.push_back(record);
+}
+
 #define IpuBase        offsetof(IPU, r[16])
 #define IpuReg(r)      sreg(1), offsetof(IPU, r) - IpuBase
 #define PipelineReg(x) mem(sreg(0), offsetof(CPU, pipeline) + offsetof(Pipeline, x))
@@ -812,7 +953,8 @@ auto CPU::Recompiler::emit(u64 vaddr, u32 address, u64 stateKey) -> Block* {
       const u32 burst = (slow.icachePaddr & ~0xfffu) | ((lineIndex << 5) & 0xfe0u);
       const u32 tagKey = (slow.icachePaddr & ~0xfffu) | 1u;
       const bool sdram = Model::Aleck64() && burst > 0xbfff'ffffu;
-      if(!emitStateKey.rdramMapIdentity() || (!sdram && burst + 0x1f >= rdram.ram.size)) {
+      //the inline refill reads RDRAM without going through the bus, which would skip waiting for an RSP batch
+      if(!emitStateKey.rdramMapIdentity() || rsp.worker.enabled || (!sdram && burst + 0x1f >= rdram.ram.size)) {
         callf(&CPU::icacheFillLine, imm64(slow.vaddr), imm(slow.icachePaddr));
       } else {
         const sljit_sw ramDataField = sdram ? (sljit_sw)(uintptr_t)&aleck64.sdram.data
@@ -133,5 +133,6 @@ auto CPU::serialize(serializer& s) -> void {
 
   if constexpr(Accuracy::CPU::Recompiler) {
     recompiler.reset();
+    recompiler.armProfile();
   }
 }
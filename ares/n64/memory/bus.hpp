@@ -2,24 +2,28 @@ template<u32 Size>
 inline auto Bus::read(u32 address, Thread& thread, RBusDevice device) -> u64 {
   static_assert(Size == Byte || Size == Half || Size == Word || Size == Dual);
 
-  if(address <= 0x03ff'ffff) return mi.readRdram<Size>(address, device, thread);
-  if(Size == Dual)           return freezeDualRead(address), 0;
-  if(address <= 0x0407'ffff) return rsp.read<Size>(address, thread);
-  if(address <= 0x040b'ffff) return rsp.status.read<Size>(address, thread);
-  if(address <= 0x040f'ffff) return freezeUnmapped(address), 0;
-  if(address <= 0x041f'ffff) return rdp.read<Size>(address, thread);
-  if(address <= 0x042f'ffff) return rdp.io.read<Size>(address, thread);
-  if(address <= 0x043f'ffff) return mi.read<Size>(address, thread);
-  if(address <= 0x044f'ffff) return vi.read<Size>(address, thread);
-  if(address <= 0x045f'ffff) return ai.read<Size>(address, thread);
-  if(address <= 0x046f'ffff) return pi.read<Size>(address, thread);
-  if(address <= 0x047f'ffff) return ri.read<Size>(address, thread);
-  if(address <= 0x048f'ffff) return si.read<Size>(address, thread);
-  if(address <= 0x04ff'ffff) return freezeUnmapped(address), 0;
-  if(address <= 0x1fbf'ffff) return pi.read<Size>(address, thread);
-  if(address <= 0x1fcf'ffff) return si.read<Size>(address, thread);
-  if(address <= 0x7fff'ffff) return pi.read<Size>(address, thread);
-  if(Model::Aleck64())       return aleck64.read<Size>(address, thread);
+  rsp.worker.synchronize();
+  auto region = Bus::region(address);
+  if(region == Region::RDRAM) return mi.readRdram<Size>(address, device, thread);
+  if(Size == Dual)            return freezeDualRead(address), 0;
+
+  switch(region) {
+  case Region::RSP:
+    rsp.worker.catchUp();
+    if(address <= 0x0407'ffff) return rsp.read<Size>(address, thread);
+    if(address <= 0x040b'ffff) return rsp.status.read<Size>(address, thread);
+    return freezeUnmapped(address), 0;
+  case Region::RDP:      return rdp.read<Size>(address, thread);
+  case Region::RDPIO:    return rdp.io.read<Size>(address, thread);
+  case Region::MI:       return mi.read<Size>(address, thread);
+  case Region::VI:       return vi.read<Size>(address, thread);
+  case Region::AI:       return ai.read<Size>(address, thread);
+  case Region::PI:       return pi.read<Size>(address, thread);
+  case Region::RI:       return ri.read<Size>(address, thread);
+  case Region::SI:       return si.read<Size>(address, thread);
+  case Region::Aleck64:  if(Model::Aleck64()) return aleck64.read<Size>(address, thread); break;
+  default: break;
+  }
   return freezeUnmapped(address), 0;
 }
 
@@ -30,6 +34,7 @@ inline auto Bus::readBurst(u32 address, u32 *data, Thread& thread) -> bool {
   if constexpr(Size == DCache) device = RBusDevice::VR4300_DCACHE;
   if constexpr(Size == ICache) device = RBusDevice::VR4300_ICACHE;
 
+  rsp.worker.synchronize();
   if(address <= 0x03ff'ffff) return mi.readRdramBurst<Size>(address, data, device, thread), true;
 
   if(Model::Aleck64()) {
@@ -43,27 +48,32 @@ inline auto Bus::readBurst(u32 address, u32 *data, Thread& thread) -> bool {
 template<u32 Size>
 inline auto Bus::write(u32 address, u64 data, Thread& thread, RBusDevice device) -> void {
   static_assert(Size == Byte || Size == Half || Size == Word || Size == Dual);
-  if constexpr(Accuracy::CPU::Recompiler) {
-    cpu.recompiler.invalidateRange(address, Size);
+  rsp.worker.synchronize();
+  auto region = Bus::region(address);
+  if(region == Region::RDRAM) {
+    if constexpr(Accuracy::CPU::Recompiler) {
+      if(cpu.recompiler.hasCode(address)) cpu.recompiler.invalidateRange(address, Size);
+    }
+    return mi.writeRdram<Size>(address, data, device, thread);
   }
 
-  if(address <= 0x03ff'ffff) return mi.writeRdram<Size>(address, data, device, thread);
-  if(address <= 0x0407'ffff) return rsp.write<Size>(address, data, thread);
-  if(address <= 0x040b'ffff) return rsp.status.write<Size>(address, data, thread);
-  if(address <= 0x040f'ffff) return freezeUnmapped(address);
-  if(address <= 0x041f'ffff) return rdp.write<Size>(address, data, thread);
-  if(address <= 0x042f'ffff) return rdp.io.write<Size>(address, data, thread);
-  if(address <= 0x043f'ffff) return mi.write<Size>(address, data, thread);
-  if(address <= 0x044f'ffff) return vi.write<Size>(address, data, thread);
-  if(address <= 0x045f'ffff) return ai.write<Size>(address, data, thread);
-  if(address <= 0x046f'ffff) return pi.write<Size>(address, data, thread);
-  if(address <= 0x047f'ffff) return ri.write<Size>(address, data, thread);
-  if(address <= 0x048f'ffff) return si.write<Size>(address, data, thread);
-  if(address <= 0x04ff'ffff) return freezeUnmapped(address);
-  if(address <= 0x1fbf'ffff) return pi.write<Size>(address, data, thread);
-  if(address <= 0x1fcf'ffff) return si.write<Size>(address, data, thread);
-  if(address <= 0x7fff'ffff) return pi.write<Size>(address, data, thread);
-  if(Model::Aleck64())       return aleck64.write<Size>(address, data, thread);
+  switch(region) {
+  case Region::RSP:
+    rsp.worker.catchUp();
+    if(address <= 0x0407'ffff) return rsp.write<Size>(address, data, thread);
+    if(address <= 0x040b'ffff) return rsp.status.write<Size>(address, data, thread);
+    return freezeUnmapped(address);
+  case Region::RDP:      return rdp.write<Size>(address, data, thread);
+  case Region::RDPIO:    return rdp.io.write<Size>(address, data, thread);
+  case Region::MI:       return mi.write<Size>(address, data, thread);
+  case Region::VI:       return vi.write<Size>(address, data, thread);
+  case Region::AI:       return ai.write<Size>(address, data, thread);
+  case Region::PI:       return pi.write<Size>(address, data, thread);
+  case Region::RI:       return ri.write<Size>(address, data, thread);
+  case Region::SI:       return si.write<Size>(address, data, thread);
+  case Region::Aleck64:  if(Model::Aleck64()) return aleck64.write<Size>(address, data, thread); break;
+  default: break;
+  }
   return freezeUnmapped(address);
 }
 
@@ -74,8 +84,9 @@ inline auto Bus::writeBurst(u32 address, u32 *data, Thread& thread) -> bool {
   if constexpr(Size == DCache) device = RBusDevice::VR4300_DCACHE;
   if constexpr(Size == ICache) device = RBusDevice::VR4300_ICACHE;
 
+  rsp.worker.synchronize();
   if constexpr(Accuracy::CPU::Recompiler) {
-    cpu.recompiler.invalidateRange(address, Size == DCache ? 16 : 32);
+    if(cpu.recompiler.hasCode(address)) cpu.recompiler.invalidateRange(address, Size == DCache ? 16 : 32);
   }
 
   if(address <= 0x03ff'ffff) return mi.writeRdramBurst<Size>(address, data, device, thread), true;
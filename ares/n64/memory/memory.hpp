@@ -30,6 +30,40 @@ namespace Memory {
 }
 
 struct Bus {
+  //the device decoding each 1 MiB page of the physical address space.
+  //devices always span whole pages, except the RSP page, which is split further on access.
+  enum class Region : u8 {
+    Unmapped, RDRAM, RSP, RDP, RDPIO, MI, VI, AI, PI, RI, SI, Aleck64,
+  };
+
+  static constexpr auto PageShift = 20;
+
+  static constexpr auto regions = [] {
+    std::array<Region, 1 << 32 - PageShift> regions{};
+    auto map = [&](u32 first, u32 last, Region region) {
+      for(u32 page = first >> PageShift; page <= last >> PageShift; page++) regions[page] = region;
+    };
+    map(0x0000'0000, 0x03ff'ffff, Region::RDRAM);
+    map(0x0400'0000, 0x040f'ffff, Region::RSP);
+    map(0x0410'0000, 0x041f'ffff, Region::RDP);
+    map(0x0420'0000, 0x042f'ffff, Region::RDPIO);
+    map(0x0430'0000, 0x043f'ffff, Region::MI);
+    map(0x0440'0000, 0x044f'ffff, Region::VI);
+    map(0x0450'0000, 0x045f'ffff, Region::AI);
+    map(0x0460'0000, 0x046f'ffff, Region::PI);
+    map(0x0470'0000, 0x047f'ffff, Region::RI);
+    map(0x0480'0000, 0x048f'ffff, Region::SI);
+    map(0x0500'0000, 0x1fbf'ffff, Region::PI);
+    map(0x1fc0'0000, 0x1fcf'ffff, Region::SI);
+    map(0x1fd0'0000, 0x7fff'ffff, Region::PI);
+    map(0x8000'0000, 0xffff'ffff, Region::Aleck64);
+    return regions;
+  }();
+
+  static auto region(u32 address) -> Region {
+    return regions[address >> PageShift];
+  }
+
   //bus.hpp
   template<u32 Size> auto read(u32 address, Thread& thread, RBusDevice device) -> u64;
   template<u32 Size> auto write(u32 address, u64 data, Thread& thread, RBusDevice device) -> void;
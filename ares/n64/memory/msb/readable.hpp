@@ -33,6 +33,16 @@ struct Readable {
 
   auto load(VFS::File fp) -> void {
     if(!size) allocate(fp->size());
+    if(auto source = std::as_const(*fp).data(); source && fp->offset() <= fp->size()) {
+      u32 length = min<u64>(size, fp->size() - fp->offset()) & ~3;
+      source += fp->offset();
+      for(u32 address = 0; address < length; address += 4) {
+        u32 word;
+        memcpy(&word, source + address, 4);
+        *(u32*)&data[address & maskWord] = word;
+      }
+      return fp->seek(length, vfs::relative);
+    }
     for(u32 address = 0; address < min(size, fp->size()); address += 4) {
       *(u32*)&data[address & maskWord] = bswap32(fp->readm(4L));
     }
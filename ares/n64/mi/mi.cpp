@@ -44,6 +44,10 @@ auto MI::lower(IRQ source) -> void {
 }
 
 auto MI::poll() -> void {
+  if(RSP::Worker::active()) {
+    rsp.worker.deferredInterrupt = true;
+    return;
+  }
   bool line = 0;
   line |= irq.sp.line & irq.sp.mask;
   line |= irq.si.line & irq.si.mask;
@@ -18,6 +18,7 @@ auto PI::dmaWrite() -> void {
   i32 length = io.writeLength+1;
   i32 maxBlockSize = 128;
   bool firstBlock = true;
+  u32 dramAddress = io.dramAddress;
 
   if constexpr(Accuracy::CPU::Recompiler) {
     cpu.recompiler.invalidateRange(io.dramAddress, (length + 1) & ~1);
@@ -61,6 +62,10 @@ auto PI::dmaWrite() -> void {
     firstBlock = false;
     maxBlockSize = distEndOfRow < 8 ? 128-misalign : 128;
   }
+
+  if constexpr(Accuracy::CPU::Recompiler) {
+    cpu.recompiler.armProfile(dramAddress, io.dramAddress - dramAddress);
+  }
 }
 
 auto PI::dmaFinished() -> void {
@@ -15,6 +15,7 @@ RSP rsp;
 #include "serialization.cpp"
 #include "disassembler.cpp"
 #include "emux.cpp"
+#include "worker.cpp"
 
 auto RSP::load(Node::Object parent) -> void {
   node = parent->append<Node::Object>("RSP");
@@ -24,6 +25,7 @@ auto RSP::load(Node::Object parent) -> void {
 }
 
 auto RSP::unload() -> void {
+  worker.kill();
   debugger.unload();
   dmem.reset();
   imem.reset();
@@ -119,6 +121,7 @@ auto RSP::instructionEpilogue(u32 clocks) -> s32 {
 }
 
 auto RSP::power(bool reset) -> void {
+  worker.kill();
   Thread::reset();
   dmem.fill();
   imem.fill();
@@ -173,6 +176,8 @@ auto RSP::power(bool reset) -> void {
   if constexpr(Accuracy::RSP::SISD) {
     platform->status("RSP vectorization disabled (no SSE 4.1 support)");
   }
+
+  worker.power();
 }
 
 }
@@ -275,6 +275,41 @@ struct RSP : Thread, Memory::RCP<RSP> {
   //serialization.cpp
   auto serialize(serializer&) -> void;
 
+  //worker.cpp
+  //optionally runs RSP tasks on a host thread, concurrently with the CPU.
+  //the RSP is advanced in batches that start at CPU synchronization points; the CPU waits for the
+  //batch in flight before any bus access, and catches the RSP up inline before touching SP registers
+  //or RSP memory. interrupts and synchronization requests raised by a batch are applied when the CPU
+  //waits for it, so emulation stays deterministic regardless of host thread timing.
+  struct Worker {
+    RSP& self;
+    Worker(RSP& self) : self(self) {}
+
+    static constexpr s64 Batch = 4096;  //minimum clocks the RSP must be behind before a batch starts
+
+    static auto active() -> bool { return onHostThread; }
+
+    auto synchronize() -> void { if(outstanding) await(); }
+    auto await() -> void;
+    auto catchUp() -> void;
+    auto run() -> void;
+    auto main(uintptr_t) -> void;
+    auto kill() -> void;
+    auto power() -> void;
+
+    bool enabled = false;
+    bool running = false;
+    bool outstanding = false;          //a batch was started that the CPU has not waited for yet
+    bool deferredInterrupt = false;    //written by the host thread, applied by await()
+    bool deferredSynchronize = false;
+    atomic<u32> requested = 0;
+    atomic<u32> completed = 0;
+    atomic<bool> quit = false;
+    nall::thread handle;
+
+    static inline thread_local bool onHostThread = false;
+  } worker{*this};
+
   struct DMA {
     struct Regs {    
       n1  pbusRegion;
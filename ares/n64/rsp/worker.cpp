@@ -0,0 +1,71 @@
+//waits for the batch in flight, then hands the CPU what the batch could not apply itself.
+auto RSP::Worker::await() -> void {
+  while(completed != requested) spinloop();
+  outstanding = false;
+  if(deferredInterrupt) {
+    deferredInterrupt = false;
+    mi.poll();
+  }
+  if(deferredSynchronize) {
+    deferredSynchronize = false;
+    cpu.forceSynchronize();
+  }
+}
+
+//brings the RSP up to the CPU's time before the CPU observes or modifies RSP state.
+auto RSP::Worker::catchUp() -> void {
+  synchronize();
+  if(enabled && self.Thread::clock < 0) self.main();
+}
+
+//called by the CPU at the end of each synchronization point, in place of RSP::main().
+auto RSP::Worker::run() -> void {
+  if(self.Thread::clock >= 0) return;
+
+  //halted cycles only step DMA, and tracing must stay on the emulation thread
+  if(!running || self.status.halted || system.homebrewMode || self.debugger.tracer.instruction->enabled()) {
+    return self.main();
+  }
+
+  if(self.Thread::clock > -Batch) return;
+  outstanding = true;
+  requested = requested + 1;
+}
+
+auto RSP::Worker::main(uintptr_t) -> void {
+  onHostThread = true;
+  u32 idle = 0;
+  while(!quit) {
+    u32 batch = requested;
+    if(batch == completed) {
+      //stay responsive while the CPU is running, but give up the core between frames
+      if(++idle < 65536) spinloop();
+      else usleep(100);
+      continue;
+    }
+    idle = 0;
+    self.main();
+    completed = batch;
+  }
+}
+
+auto RSP::Worker::kill() -> void {
+  if(!running) return;
+  synchronize();
+  quit = true;
+  handle.join();
+  quit = false;
+  running = false;
+}
+
+auto RSP::Worker::power() -> void {
+  kill();
+  outstanding = false;
+  deferredInterrupt = false;
+  deferredSynchronize = false;
+  requested = 0;
+  completed = 0;
+  if(!enabled) return;
+  handle = thread::create(std::bind_front(&RSP::Worker::main, this));
+  running = true;
+}
@@ -44,6 +44,7 @@ auto option(string name, string value) -> bool {
       rsp.recompiler.enabled = value.boolean();
     }
   }
+  if(name == "Threaded RSP") rsp.worker.enabled = value.boolean();
   if(Model::Nintendo64() && name == "Expansion Pak") system.expansionPak = value.boolean();
   if(Model::Nintendo64() && name == "Controller Pak Banks") {
     if (value == "32KiB (Default)") {
@@ -0,0 +1,104 @@
+auto VI::Scanout::frame(u32 depth, i32 dx0, i32 dx1) -> void {
+  u32 count = max(0, dx1 - dx0);
+  u32 x0 = self.io.xsubpixel + self.io.xscale * (dx0 - self.io.hstart);
+  bool changed = this->depth != depth || origin != dx0 || columns.size() != count;
+  if(columns.size() != count) columns.resize(count);
+  for(u32 n : range(count)) {
+    u32 column = x0 >> 10;
+    changed |= columns[n] != column;
+    columns[n] = column;
+    x0 += self.io.xscale;
+  }
+  contiguous = self.io.xscale == 0x400;  //one source pixel per output pixel
+  this->depth = depth;
+  origin = dx0;
+  if(changed) generation++;
+}
+
+auto VI::Scanout::line(u32 y, u32* target, u32 address) -> void {
+  if(columns.empty()) return;
+  if(y >= lines.size()) lines.resize(y + 1);
+  auto& line = lines[y];
+
+  u32 start = address + columns.front() * depth;
+  u32 bytes = (columns.back() - columns.front() + 1) * depth;
+  bool direct = rdram.mapIdentity && !system.homebrewMode && !(address & depth - 1);
+  direct &= start >= address && ((u64)start + bytes + 3 & ~3ull) <= rdram.ram.size;
+
+  if(!direct) {
+    //the accessors handle remapped RDRAM, out of range addresses and the memory debugger
+    line.valid = false;
+    for(u32 n : range(columns.size())) {
+      if(depth == 2) {
+        u16 data = rdram.ram.read<Half>(address + columns[n] * 2, RBusDevice::VI_DMA);
+        target[n] = 1 << 24 | data >> 1;
+      } else {
+        u32 data = rdram.ram.read<Word>(address + columns[n] * 4, RBusDevice::VI_DMA);
+        target[n] = data >> 8;
+      }
+    }
+    return;
+  }
+
+  //the screen clears its input buffer after every frame, so a line that is unchanged
+  //is copied from the pixels kept for it rather than converted again.
+  //RDRAM holds each word in host order, so the words that contain the line are compared.
+  u32 first = start & ~3;
+  u32 size = (start + bytes + 3 & ~3) - first;
+  const u8* source = rdram.ram.data + first;
+  if(!line.valid || line.address != start || line.depth != depth || line.generation != generation
+  || line.source.size() != size || memcmp(line.source.data(), source, size)) {
+    line.valid = true;
+    line.address = start;
+    line.depth = depth;
+    line.generation = generation;
+    line.source.assign(source, source + size);
+    line.pixels.resize(columns.size());
+    convert(line.pixels.data(), start);
+  }
+  memory::copy<u32>(target, line.pixels.data(), columns.size());
+}
+
+//reads RDRAM through its word layout, as rdram.ram.read<Half>() and read<Word>() would:
+//each 32-bit word is stored in host order, so the first of its two 16-bit pixels is its upper half.
+//the loops are kept branch-free so that they vectorize.
+auto VI::Scanout::convert(u32* target, u32 address) -> void {
+  const u8* data = rdram.ram.data;
+  u32 count = columns.size();
+  if(depth == 2) {
+    if(contiguous && !(address & 3)) {
+      auto words = (const u32*)(data + address);
+      for(u32 n : range(count >> 1)) {
+        u32 word = words[n];
+        target[n * 2 + 0] = 1 << 24 | (u16)(word >> 16) >> 1;
+        target[n * 2 + 1] = 1 << 24 | (u16)(word >>  0) >> 1;
+      }
+      if(count & 1) {
+        u16 half = words[count >> 1] >> 16;
+        target[count - 1] = 1 << 24 | half >> 1;
+      }
+    } else {
+      u32 first = columns.front();
+      for(u32 n : range(count)) {
+        u32 pixel = address + (columns[n] - first) * 2;
+        u16 half = *(const u16*)(data + (pixel ^ 2));
+        target[n] = 1 << 24 | half >> 1;
+      }
+    }
+  } else {
+    u32 first = columns.front();
+    auto words = (const u32*)(data + address);
+    if(contiguous) {
+      for(u32 n : range(count)) target[n] = words[n] >> 8;
+    } else {
+      for(u32 n : range(count)) target[n] = words[columns[n] - first] >> 8;
+    }
+  }
+}
+
+auto VI::Scanout::reset() -> void {
+  lines.clear();
+  depth = 0;
+  columns.clear();
+  generation++;
+}
@@ -6,6 +6,7 @@ VI vi;
 #include "io.cpp"
 #include "debugger.cpp"
 #include "serialization.cpp"
+#include "scanout.cpp"
 
 auto VI::step(u32 clocks) -> void {
   auto scaled = (u64)clocks * system.frequency() + clockFraction;
@@ -147,7 +148,14 @@ auto VI::refresh() -> void {
         auto source = rgba + width * y * sizeof(u32);
         auto target = screen->pixels(1).data() + y * vulkan.outputUpscale * 640;
         for(u32 x : range(width)) {
-          target[x] = source[x * 4 + 0] << 16 | source[x * 4 + 1] << 8 | source[x * 4 + 2] << 0;
+          //load whole pixels and swizzle RGBA to RGB, so that the loop vectorizes
+          u32 pixel;
+          memcpy(&pixel, source + x * 4, sizeof(u32));
+          #if defined(ENDIAN_LITTLE)
+          target[x] = (pixel & 0xff) << 16 | (pixel & 0xff00) | (pixel >> 16 & 0xff);
+          #else
+          target[x] = pixel >> 8;
+          #endif
         }
       }
     } else {
@@ -188,37 +196,16 @@ auto VI::refresh() -> void {
   if(dx1 <  hscan_stop)  dx1 -= 7;
 
   u32 pitch = vi.io.width;
-  if(vi.io.colorDepth == 2) {
-    //15bpp
+  if(vi.io.colorDepth == 2 || vi.io.colorDepth == 3) {
+    //15bpp or 24bpp
+    u32 depth = vi.io.colorDepth == 2 ? 2 : 4;
+    scanout.frame(depth, dx0, dx1);
     u32 y0 = vi.io.ysubpixel + vi.io.yscale * (dy0 - vi.io.vstart);
     for(i32 dy = dy0; dy < dy1; dy++) {
       if(!io.serrate || (dy & 1) == !io.field) {
-        u32 address = vi.io.dramAddress + (y0 >> 11) * pitch * 2;
+        u32 address = vi.io.dramAddress + (y0 >> 11) * pitch * depth;
         auto line = screen->pixels(1).data() + (dy - vscan_start) * hscan_len;
-        u32 x0 = vi.io.xsubpixel + vi.io.xscale * (dx0 - vi.io.hstart);
-        for(i32 dx = dx0; dx < dx1; dx++) {
-          u16 data = rdram.ram.read<Half>(address + (x0 >> 10) * 2, RBusDevice::VI_DMA);
-          line[dx - hscan_start] = 1 << 24 | data >> 1;
-          x0 += vi.io.xscale;
-        }
-      }
-      y0 += vi.io.yscale;
-    }
-  }
-
-  if(vi.io.colorDepth == 3) {
-    //24bpp
-    u32 y0 = vi.io.ysubpixel + vi.io.yscale * (dy0 - vi.io.vstart);
-    for(i32 dy = dy0; dy < dy1; dy++) {
-      if(!io.serrate || (dy & 1) == !io.field) {
-        u32 address = vi.io.dramAddress + (y0 >> 11) * pitch * 4;
-        auto line = screen->pixels(1).data() + (dy - vscan_start) * hscan_len;
-        u32 x0 = vi.io.xsubpixel + vi.io.xscale * (dx0 - vi.io.hstart);
-        for(i32 dx = dx0; dx < dx1; dx++) {
-          u32 data = rdram.ram.read<Word>(address + (x0 >> 10) * 4, RBusDevice::VI_DMA);
-          line[dx - hscan_start] = data >> 8;
-          x0 += vi.io.xscale;
-        }
+        scanout.line(dy - vscan_start, line + dx0 - hscan_start, address);
       }
       y0 += vi.io.yscale;
     }
@@ -231,6 +218,7 @@ auto VI::power(bool reset) -> void {
   io = {};
   refreshed = false;
   clockFraction = 0;
+  scanout.reset();
 
   #if defined(VULKAN)
   gpuOutputValid = false;
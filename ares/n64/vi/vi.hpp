@@ -31,6 +31,37 @@ struct VI : Thread, Memory::RCP<VI> {
   //serialization.cpp
   auto serialize(serializer&) -> void;
 
+  //scanout.cpp
+  //converts the framebuffer when it is not rendered by parallel-rdp.
+  //the source column of every output pixel is resolved once per frame, and lines that lie entirely in
+  //identity-mapped RDRAM are converted straight from memory. such a line is not converted again while
+  //its source bytes and columns match the last conversion; the pixels kept from it are copied instead.
+  struct Scanout {
+    VI& self;
+    Scanout(VI& self) : self(self) {}
+
+    auto frame(u32 depth, i32 dx0, i32 dx1) -> void;
+    auto line(u32 y, u32* target, u32 address) -> void;
+    auto convert(u32* target, u32 address) -> void;
+    auto reset() -> void;
+
+    struct Line {
+      bool valid = false;
+      u32 address;
+      u32 depth;
+      u64 generation;
+      std::vector<u8> source;
+      std::vector<u32> pixels;
+    };
+
+    u32 depth = 0;          //bytes per pixel
+    i32 origin = 0;         //first output pixel
+    bool contiguous = false;
+    std::vector<u32> columns;
+    u64 generation = 0;     //incremented whenever origin or columns change
+    std::vector<Line> lines;  //indexed by screen line
+  } scanout{*this};
+
   struct IO {
     n2  colorDepth;
     n1  gammaDither;
@@ -46,7 +46,6 @@ auto CPU::main() -> void {
 auto CPU::step(u32 clocks) -> void {
   timer.counter -= clocks;
   while(timer.counter < 0) {
-    synchronize(psg);
     timer.counter += 1024 * 3;
     if(!timer.value--) {
       timer.value = timer.reload;
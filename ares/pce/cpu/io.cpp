@@ -129,7 +129,7 @@ auto CPU::write(n8 bank, n13 address, n8 data) -> void {
 
     //$0800-0bff  PSG
     if((address & 0x1c00) == 0x0800) {
-      synchronize(psg);
+      psg.synchronize(*this);
       io.buffer = data;
       return psg.write(address, data);
     }
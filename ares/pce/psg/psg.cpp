@@ -84,12 +84,11 @@ template<int stepArg> auto PSG::frame(i16& outputLeft, i16& outputRight) -> void
 }
 
 auto PSG::step(u32 clocks) -> void {
-  Thread::step(clocks);
-  synchronize(cpu);
+  Passive::step(clocks);
 }
 
 auto PSG::power() -> void {
-  Thread::create(system.colorburst(), std::bind_front(&PSG::main, this));
+  Passive::create(system.colorburst(), std::bind_front(&PSG::main, this));
 
   io = {};
   for(auto C : range(6)) channel[C].power(C);
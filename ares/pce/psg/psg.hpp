@@ -1,6 +1,6 @@
 //Programmable Sound Generator
 
-struct PSG : Thread {
+struct PSG : Passive {
   Node::Object node;
   Node::Audio::Stream stream;
 
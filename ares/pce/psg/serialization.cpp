@@ -1,5 +1,5 @@
 auto PSG::serialize(serializer& s) -> void {
-  Thread::serialize(s);
+  Passive::serialize(s);
 
   s(io.channel);
   s(io.volumeLeft);
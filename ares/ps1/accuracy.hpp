@@ -13,8 +13,26 @@ struct Accuracy {
     static constexpr bool Breakpoints = 1 | Reference;
   };
 
+  struct GTE {
+    //matrix-vector products and IR saturation
+    static constexpr bool SISD = 0 | Reference | !ARCHITECTURE_SUPPORTS_SSE4_1;
+    static constexpr bool SIMD = !SISD;
+  };
+
   struct GPU {
     //performs GPU primitive rendering on a separate thread
     static constexpr bool Threaded = 1;
   };
+
+  struct SPU {
+    //Gaussian interpolation across voices
+    static constexpr bool SISD = 0 | Reference | !ARCHITECTURE_SUPPORTS_SSE4_1;
+    static constexpr bool SIMD = !SISD;
+  };
+
+  struct MDEC {
+    //IDCT and color conversion
+    static constexpr bool SISD = 0 | Reference | !ARCHITECTURE_SUPPORTS_SSE4_1;
+    static constexpr bool SIMD = !SISD;
+  };
 };
@@ -28,6 +28,8 @@ struct CPU : Thread {
       Node::Debugger::Tracer::Notification function;
     } tracer;
 
+    u32 registers[32] = {};  //general purpose registers as of the last binary trace record
+
   private:
     auto messageChar(char) -> void;
     auto messageText(u32) -> void;
@@ -490,7 +492,7 @@ struct CPU : Thread {
   auto NCS(bool lm, u8 sf) -> void;
   auto NCT(bool lm, u8 sf) -> void;
   auto OP(bool lm, u8 sf) -> void;
-  auto RTP(GTE::v16, bool last) -> void;
+  auto RTP(GTE::v64, bool last) -> void;
   auto RTPS(bool lm, u8 sf) -> void;
   auto RTPT(bool lm, u8 sf) -> void;
   auto SQR(bool lm, u8 sf) -> void;
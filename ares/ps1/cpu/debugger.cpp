@@ -20,6 +20,7 @@ auto CPU::Debugger::load(Node::Object parent) -> void {
   tracer.instruction = parent->append<Node::Debugger::Tracer::Instruction>("Instruction", "CPU");
   tracer.instruction->setAddressBits(32, 2);
   tracer.instruction->setDepth(32);
+  tracer.instruction->setArchitecture("R3000A");
 
   tracer.exception = parent->append<Node::Debugger::Tracer::Notification>("Exception", "CPU");
   tracer.interrupt = parent->append<Node::Debugger::Tracer::Notification>("Interrupt", "CPU");
@@ -36,6 +37,22 @@ auto CPU::Debugger::instruction() -> void {
   u32 address = cpu.pipeline.address;
   u32 instruction = cpu.pipeline.instruction;
   if(tracer.instruction->address(address)) {
+    if(tracer.instruction->binary()) {
+      //report every general purpose register that changed since the previous record:
+      //the first in the instruction's record, and any others in continuation records
+      constexpr u8 NoRegister = Core::Debugger::Tracer::Instruction::NoRegister;
+      u8 changed[31];
+      u32 count = 0;
+      for(u32 n : range(1, 32)) {
+        if(registers[n] == cpu.ipu.r[n]) continue;
+        registers[n] = cpu.ipu.r[n];
+        changed[count++] = n;
+      }
+      if(!count) tracer.instruction->record(instruction, cpu.clock());
+      else tracer.instruction->record(instruction, cpu.clock(), changed[0], registers[changed[0]]);
+      for(u32 n : range(1, count)) tracer.instruction->recordRegister(changed[n], registers[changed[n]]);
+      return;
+    }
     cpu.disassembler.showColors = 0;
     tracer.instruction->notify(cpu.disassembler.disassemble(address, instruction), {});
     cpu.disassembler.showColors = 1;
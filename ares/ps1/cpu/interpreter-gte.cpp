@@ -278,9 +278,32 @@ auto CPU::GTE::setMacAndIr(s64 value, bool lm) -> void {
 }
 
 auto CPU::GTE::setMacAndIr(const v64& vector) -> void {
-  setMacAndIr<1>(vector.x, lm);
-  setMacAndIr<2>(vector.y, lm);
-  setMacAndIr<3>(vector.z, lm);
+  if constexpr(Accuracy::GTE::SISD) {
+    setMacAndIr<1>(vector.x, lm);
+    setMacAndIr<2>(vector.y, lm);
+    setMacAndIr<3>(vector.z, lm);
+  }
+
+  if constexpr(Accuracy::GTE::SIMD) {
+    #if ARCHITECTURE_SUPPORTS_SSE4_1
+    checkMac<1>(vector.x);
+    checkMac<2>(vector.y);
+    checkMac<3>(vector.z);
+    mac.x = vector.x >> sf;
+    mac.y = vector.y >> sf;
+    mac.z = vector.z >> sf;
+
+    //saturate all three IR lanes at once; lanes that changed raise their flag
+    __m128i value = _mm_set_epi32(0, mac.z, mac.y, mac.x);
+    __m128i clamped = _mm_max_epi32(value, _mm_set1_epi32(lm ? 0 : -0x8000));
+    clamped = _mm_min_epi32(clamped, _mm_set1_epi32(+0x7fff));
+    u32 saturated = ~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(value, clamped))) & 7;
+    ir.x = _mm_extract_epi32(clamped, 0);
+    ir.y = _mm_extract_epi32(clamped, 1);
+    ir.z = _mm_extract_epi32(clamped, 2);
+    flag.value |= (saturated & 1) << 24 | (saturated & 2) << 22 | (saturated & 4) << 20;
+    #endif
+  }
 }
 
 auto CPU::GTE::setOtz(s64 value) -> void {
@@ -295,10 +318,57 @@ auto CPU::GTE::setOtz(s64 value) -> void {
 //
 
 auto CPU::GTE::matrixMultiply(const m16& matrix, const v16& vector, const v32& translation) -> v64 {
-  s64 x = extend<1>(extend<1>(extend<1>((s64(translation.x) << 12) + matrix.a.x * vector.x) + matrix.a.y * vector.y) + matrix.a.z * vector.z);
-  s64 y = extend<2>(extend<2>(extend<2>((s64(translation.y) << 12) + matrix.b.x * vector.x) + matrix.b.y * vector.y) + matrix.b.z * vector.z);
-  s64 z = extend<3>(extend<3>(extend<3>((s64(translation.z) << 12) + matrix.c.x * vector.x) + matrix.c.y * vector.y) + matrix.c.z * vector.z);
-  return {x, y, z};
+  if constexpr(Accuracy::GTE::SISD) {
+    s64 x = extend<1>(extend<1>(extend<1>((s64(translation.x) << 12) + matrix.a.x * vector.x) + matrix.a.y * vector.y) + matrix.a.z * vector.z);
+    s64 y = extend<2>(extend<2>(extend<2>((s64(translation.y) << 12) + matrix.b.x * vector.x) + matrix.b.y * vector.y) + matrix.b.z * vector.z);
+    s64 z = extend<3>(extend<3>(extend<3>((s64(translation.z) << 12) + matrix.c.x * vector.x) + matrix.c.y * vector.y) + matrix.c.z * vector.z);
+    return {x, y, z};
+  }
+
+  if constexpr(Accuracy::GTE::SIMD) {
+    #if ARCHITECTURE_SUPPORTS_SSE4_1
+    //checks each 44-bit accumulator lane for overflow, then wraps it to 44 bits.
+    //returns the out-of-range lanes; sign receives the lane sign bits before wrapping.
+    auto extendLanes = [](__m128i& value, u32& sign) -> u32 {
+      const __m128i bias = _mm_set1_epi64x(s64(1) << 43);
+      const __m128i mask = _mm_set1_epi64x((s64(1) << 44) - 1);
+      __m128i bounds = _mm_srli_epi64(_mm_add_epi64(value, bias), 44);
+      u32 outside = ~_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(bounds, _mm_setzero_si128()))) & 3;
+      sign = _mm_movemask_pd(_mm_castsi128_pd(value));
+      value = _mm_sub_epi64(_mm_xor_si128(_mm_and_si128(value, mask), bias), bias);
+      return outside;
+    };
+
+    //lanes: {x, y} and {z, unused}
+    __m128i xy = _mm_set_epi64x(s64(translation.y) << 12, s64(translation.x) << 12);
+    __m128i zw = _mm_set_epi64x(0, s64(translation.z) << 12);
+    const __m128i columns[3] = {
+      _mm_set_epi32(0, matrix.c.x, matrix.b.x, matrix.a.x),
+      _mm_set_epi32(0, matrix.c.y, matrix.b.y, matrix.a.y),
+      _mm_set_epi32(0, matrix.c.z, matrix.b.z, matrix.a.z),
+    };
+    const s32 scalars[3] = {vector.x, vector.y, vector.z};
+
+    u32 overflow = 0, underflow = 0;
+    for(u32 n : range(3)) {
+      __m128i product = _mm_mullo_epi32(columns[n], _mm_set1_epi32(scalars[n]));
+      xy = _mm_add_epi64(xy, _mm_cvtepi32_epi64(product));
+      zw = _mm_add_epi64(zw, _mm_cvtepi32_epi64(_mm_srli_si128(product, 8)));
+      u32 signxy, signzw;
+      u32 outside = extendLanes(xy, signxy) | (extendLanes(zw, signzw) & 1) << 2;
+      u32 sign = signxy | (signzw & 1) << 2;
+      overflow  |= outside & ~sign;
+      underflow |= outside &  sign;
+    }
+    flag.value |= (overflow  & 1) << 30 | (overflow  & 2) << 28 | (overflow  & 4) << 26;
+    flag.value |= (underflow & 1) << 27 | (underflow & 2) << 25 | (underflow & 4) << 23;
+
+    s64 x = _mm_cvtsi128_si64(xy);
+    s64 y = _mm_extract_epi64(xy, 1);
+    s64 z = _mm_cvtsi128_si64(zw);
+    return {x, y, z};
+    #endif
+  }
 }
 
 auto CPU::GTE::vectorMultiply(const v16& vector1, const v16& vector2, const v16& translation) -> v64 {
@@ -713,9 +783,9 @@ auto CPU::OP(bool lm, u8 sf) -> void {
   epilogue();
 }
 
-//meta-instruction: rotation, translation, and perspective transformation
-auto CPU::RTP(v16 vector, bool last) -> void {
-  auto [x, y, z] = matrixMultiply(rotation, vector, translation);
+//meta-instruction: perspective transformation of a rotated and translated vertex
+auto CPU::RTP(v64 transformed, bool last) -> void {
+  auto [x, y, z] = transformed;
   setMacAndIr<1>(x, gte.lm);
   setMacAndIr<2>(y, gte.lm);
   setMac<3>(z);
@@ -736,15 +806,20 @@ auto CPU::RTP(v16 vector, bool last) -> void {
 
 auto CPU::RTPS(bool lm, u8 sf) -> void {
   prologue(lm, sf);
-  RTP(v.a, 1);
+  RTP(matrixMultiply(rotation, v.a, translation), 1);
   epilogue();
 }
 
 auto CPU::RTPT(bool lm, u8 sf) -> void {
   prologue(lm, sf);
-  RTP(v.a, 0);
-  RTP(v.b, 0);
-  RTP(v.c, 1);
+  //the transforms do not depend on the perspective divides, and FLAG bits are sticky,
+  //so all three vertices can be transformed before any of them are projected.
+  v64 a = matrixMultiply(rotation, v.a, translation);
+  v64 b = matrixMultiply(rotation, v.b, translation);
+  v64 c = matrixMultiply(rotation, v.c, translation);
+  RTP(a, 0);
+  RTP(b, 0);
+  RTP(c, 1);
   epilogue();
 }
 
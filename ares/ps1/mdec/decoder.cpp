@@ -129,46 +129,153 @@ auto MDEC::decodeBlock(s16 block[64], u8 table[64]) -> bool {
   return true;
 }
 
+//the IDCT is separable: pass 0 transforms the columns and pass 1 the rows.
+//each output row is a weighted sum of the eight scale rows, so zero coefficients
+//(which dominate after quantization) can be skipped without changing the result.
 template<u32 Pass>
 auto MDEC::decodeIDCT(s16 source[64], s16 target[64]) -> void {
-  for(u32 x : range(8)) {
+  if constexpr(Accuracy::MDEC::SISD) {
     for(u32 y : range(8)) {
-      s32 sum = 0;
+      s32 sum[8] = {};
       for(u32 z : range(8)) {
-        sum += source[y + z * 8] * block.scale[x + z * 8];
+        s32 coefficient = source[y + z * 8];
+        if(!coefficient) continue;
+        const s16* scale = &block.scale[z * 8];
+        for(u32 x : range(8)) sum[x] += coefficient * scale[x];
+      }
+      for(u32 x : range(8)) {
+        if constexpr(Pass == 0) target[x + y * 8] = sum[x] + 0x8000 >> 16;
+        if constexpr(Pass == 1) target[x + y * 8] = sclamp<8>(sclip<9>(sum[x] + 0x8000 >> 16));
       }
-      if constexpr(Pass == 0) target[x + y * 8] = sum + 0x8000 >> 16;
-      if constexpr(Pass == 1) target[x + y * 8] = sclamp<8>(sclip<9>(sum + 0x8000 >> 16));
     }
   }
+
+  if constexpr(Accuracy::MDEC::SIMD) {
+    #if ARCHITECTURE_SUPPORTS_SSE4_1
+    //interleave the scale rows pairwise so that each madd accumulates two z terms
+    __m128i lo[4], hi[4];
+    for(u32 z : range(4)) {
+      __m128i a = _mm_loadu_si128((const __m128i*)&block.scale[(z * 2 + 0) * 8]);
+      __m128i b = _mm_loadu_si128((const __m128i*)&block.scale[(z * 2 + 1) * 8]);
+      lo[z] = _mm_unpacklo_epi16(a, b);
+      hi[z] = _mm_unpackhi_epi16(a, b);
+    }
+
+    const __m128i round = _mm_set1_epi32(0x8000);
+    for(u32 y : range(8)) {
+      __m128i sumlo = _mm_setzero_si128();
+      __m128i sumhi = _mm_setzero_si128();
+      for(u32 z : range(4)) {
+        u32 pair = (u16)source[y + (z * 2 + 0) * 8] | (u32)(u16)source[y + (z * 2 + 1) * 8] << 16;
+        __m128i coefficients = _mm_set1_epi32(pair);
+        sumlo = _mm_add_epi32(sumlo, _mm_madd_epi16(coefficients, lo[z]));
+        sumhi = _mm_add_epi32(sumhi, _mm_madd_epi16(coefficients, hi[z]));
+      }
+      sumlo = _mm_srai_epi32(_mm_add_epi32(sumlo, round), 16);
+      sumhi = _mm_srai_epi32(_mm_add_epi32(sumhi, round), 16);
+      if constexpr(Pass == 1) {
+        //sclip<9>
+        sumlo = _mm_srai_epi32(_mm_slli_epi32(sumlo, 23), 23);
+        sumhi = _mm_srai_epi32(_mm_slli_epi32(sumhi, 23), 23);
+      }
+      __m128i row = _mm_packs_epi32(sumlo, sumhi);
+      if constexpr(Pass == 1) {
+        //sclamp<8>
+        row = _mm_max_epi16(row, _mm_set1_epi16(-128));
+        row = _mm_min_epi16(row, _mm_set1_epi16(+127));
+      }
+      _mm_storeu_si128((__m128i*)&target[y * 8], row);
+    }
+    #endif
+  }
 }
 
 auto MDEC::convertY(u32 output[64], s16 luma[64]) -> void {
-  for(u32 y : range(8)) {
-    for(u32 x : range(8)) {
-      s16 Y = (i10)luma[x + y * 8];
-      Y = uclamp<8>(Y + 128);
-      output[x + y * 8] = Y;
+  if constexpr(Accuracy::MDEC::SISD) {
+    for(u32 y : range(8)) {
+      for(u32 x : range(8)) {
+        s16 Y = (i10)luma[x + y * 8];
+        Y = uclamp<8>(Y + 128);
+        output[x + y * 8] = Y;
+      }
+    }
+  }
+
+  if constexpr(Accuracy::MDEC::SIMD) {
+    #if ARCHITECTURE_SUPPORTS_SSE4_1
+    for(u32 y : range(8)) {
+      __m128i Y = _mm_loadu_si128((const __m128i*)&luma[y * 8]);
+      Y = _mm_srai_epi16(_mm_slli_epi16(Y, 6), 6);
+      Y = _mm_add_epi16(Y, _mm_set1_epi16(128));
+      Y = _mm_packus_epi16(Y, Y);
+      _mm_storeu_si128((__m128i*)&output[y * 8 + 0], _mm_cvtepu8_epi32(Y));
+      _mm_storeu_si128((__m128i*)&output[y * 8 + 4], _mm_cvtepu8_epi32(_mm_srli_si128(Y, 4)));
     }
+    #endif
   }
 }
 
 auto MDEC::convertYUV(u32 output[256], s16 luma[64], u32 bx, u32 by) -> void {
-  for(u32 y : range(8)) {
-    for(u32 x : range(8)) {
-      s16 Y  = luma[x + y * 8];
-      s16 Cb = block.cb[(x + bx >> 1) + (y + by >> 1) * 8];
-      s16 Cr = block.cr[(x + bx >> 1) + (y + by >> 1) * 8];
+  if constexpr(Accuracy::MDEC::SISD) {
+    for(u32 y : range(8)) {
+      for(u32 x : range(8)) {
+        s16 Y  = luma[x + y * 8];
+        s16 Cb = block.cb[(x + bx >> 1) + (y + by >> 1) * 8];
+        s16 Cr = block.cr[(x + bx >> 1) + (y + by >> 1) * 8];
 
-      s32 R = Y + (1.402 * Cr);
-      s32 G = Y - (0.334 * Cb) - (0.714 * Cr);
-      s32 B = Y + (1.722 * Cb);
+        s32 R = Y + (1.402 * Cr);
+        s32 G = Y - (0.334 * Cb) - (0.714 * Cr);
+        s32 B = Y + (1.722 * Cb);
+
+        u8 r = uclamp<8>(R + 128);
+        u8 g = uclamp<8>(G + 128);
+        u8 b = uclamp<8>(B + 128);
+
+        output[(x + bx) + (y + by) * 16] = r << 0 | g << 8 | b << 16;
+      }
+    }
+  }
+
+  if constexpr(Accuracy::MDEC::SIMD) {
+    #if ARCHITECTURE_SUPPORTS_SSE4_1
+    //the products are formed in double precision exactly as above and kept separate
+    //from the sums, so that truncation matches the scalar path without FMA contraction.
+    for(u32 y : range(8)) {
+      __m128i Y = _mm_loadu_si128((const __m128i*)&luma[y * 8]);
+      __m128i Ylo = _mm_cvtepi16_epi32(Y);
+      __m128i Yhi = _mm_cvtepi16_epi32(_mm_srli_si128(Y, 8));
+      __m128d Yd[4] = {
+        _mm_cvtepi32_pd(Ylo), _mm_cvtepi32_pd(_mm_srli_si128(Ylo, 8)),
+        _mm_cvtepi32_pd(Yhi), _mm_cvtepi32_pd(_mm_srli_si128(Yhi, 8)),
+      };
+
+      __m128i R[4], G[4], B[4];
+      for(u32 x : range(4)) {
+        s16 Cb = block.cb[(bx >> 1) + x + (y + by >> 1) * 8];
+        s16 Cr = block.cr[(bx >> 1) + x + (y + by >> 1) * 8];
+        __m128d RCr = _mm_set1_pd(1.402 * Cr);
+        __m128d GCb = _mm_set1_pd(0.334 * Cb);
+        __m128d GCr = _mm_set1_pd(0.714 * Cr);
+        __m128d BCb = _mm_set1_pd(1.722 * Cb);
+        R[x] = _mm_cvttpd_epi32(_mm_add_pd(Yd[x], RCr));
+        G[x] = _mm_cvttpd_epi32(_mm_sub_pd(_mm_sub_pd(Yd[x], GCb), GCr));
+        B[x] = _mm_cvttpd_epi32(_mm_add_pd(Yd[x], BCb));
+      }
 
-      u8 r = uclamp<8>(R + 128);
-      u8 g = uclamp<8>(G + 128);
-      u8 b = uclamp<8>(B + 128);
+      const __m128i bias = _mm_set1_epi16(128);
+      __m128i r = _mm_packs_epi32(_mm_unpacklo_epi64(R[0], R[1]), _mm_unpacklo_epi64(R[2], R[3]));
+      __m128i g = _mm_packs_epi32(_mm_unpacklo_epi64(G[0], G[1]), _mm_unpacklo_epi64(G[2], G[3]));
+      __m128i b = _mm_packs_epi32(_mm_unpacklo_epi64(B[0], B[1]), _mm_unpacklo_epi64(B[2], B[3]));
+      r = _mm_packus_epi16(_mm_add_epi16(r, bias), _mm_setzero_si128());
+      g = _mm_packus_epi16(_mm_add_epi16(g, bias), _mm_setzero_si128());
+      b = _mm_packus_epi16(_mm_add_epi16(b, bias), _mm_setzero_si128());
 
-      output[(x + bx) + (y + by) * 16] = r << 0 | g << 8 | b << 16;
+      __m128i rg = _mm_unpacklo_epi8(r, g);
+      __m128i b0 = _mm_unpacklo_epi8(b, _mm_setzero_si128());
+      u32* target = &output[bx + (y + by) * 16];
+      _mm_storeu_si128((__m128i*)&target[0], _mm_unpacklo_epi16(rg, b0));
+      _mm_storeu_si128((__m128i*)&target[4], _mm_unpackhi_epi16(rg, b0));
     }
+    #endif
   }
 }
@@ -7,6 +7,13 @@
 #include <nall/hashset.hpp>
 #include <component/processor/m68hc05/m68hc05.hpp>
 
+#if defined(ARCHITECTURE_AMD64)
+#include <nmmintrin.h>
+#elif defined(ARCHITECTURE_ARM64) && !defined(COMPILER_MICROSOFT)
+#define SSE2NEON_SUPPRESS_WARNINGS
+#include <sse2neon.h>
+#endif
+
 namespace ares::PlayStation {
   #include <ares/inline.hpp>
   auto enumerate() -> std::vector<string>;
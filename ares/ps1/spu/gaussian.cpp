@@ -42,3 +42,44 @@ auto SPU::Voice::gaussianInterpolate() const -> s32 {
   out += self.gaussianTable[  0 + g] * gaussianRead(s - 0);
   return out >> 15;
 }
+
+auto SPU::gaussianInterpolate() -> void {
+  if constexpr(Accuracy::SPU::SISD) {
+    for(auto& voice : this->voice) {
+      if(voice.active()) lanes.interpolated[voice.id] = voice.gaussianInterpolate();
+    }
+  }
+
+  if constexpr(Accuracy::SPU::SIMD) {
+    #if ARCHITECTURE_SUPPORTS_SSE4_1
+    for(auto& voice : this->voice) {
+      u32 n = voice.id;
+      u8 g = voice.counter >>  4 & 255;
+      u8 s = voice.counter >> 12 &  31;
+      lanes.weights[0][n] = gaussianTable[255 - g];
+      lanes.weights[1][n] = gaussianTable[511 - g];
+      lanes.weights[2][n] = gaussianTable[256 + g];
+      lanes.weights[3][n] = gaussianTable[  0 + g];
+      lanes.samples[0][n] = voice.gaussianRead(s - 3);
+      lanes.samples[1][n] = voice.gaussianRead(s - 2);
+      lanes.samples[2][n] = voice.gaussianRead(s - 1);
+      lanes.samples[3][n] = voice.gaussianRead(s - 0);
+    }
+
+    for(u32 n = 0; n < 24; n += 8) {
+      __m128i lo = _mm_setzero_si128();
+      __m128i hi = _mm_setzero_si128();
+      for(u32 tap : range(4)) {
+        __m128i weight = _mm_load_si128((const __m128i*)&lanes.weights[tap][n]);
+        __m128i sample = _mm_load_si128((const __m128i*)&lanes.samples[tap][n]);
+        __m128i productlo = _mm_mullo_epi16(weight, sample);
+        __m128i producthi = _mm_mulhi_epi16(weight, sample);
+        lo = _mm_add_epi32(lo, _mm_unpacklo_epi16(productlo, producthi));
+        hi = _mm_add_epi32(hi, _mm_unpackhi_epi16(productlo, producthi));
+      }
+      _mm_store_si128((__m128i*)&lanes.interpolated[n + 0], _mm_srai_epi32(lo, 15));
+      _mm_store_si128((__m128i*)&lanes.interpolated[n + 4], _mm_srai_epi32(hi, 15));
+    }
+    #endif
+  }
+}
@@ -53,6 +53,8 @@ auto SPU::sample() -> void {
   s32 rsum = 0, rreverb = 0;
   s16 lcdaudio = 0, rcdaudio = 0;
   s32 modulation = 0;
+  for(auto& voice : this->voice) voice.decode();
+  gaussianInterpolate();
   for(auto& voice : this->voice) {
     auto [lvoice, rvoice] = voice.sample(modulation);
     modulation = voice.adsr.lastVolume;
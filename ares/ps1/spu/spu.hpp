@@ -50,6 +50,7 @@ struct SPU : Thread, Memory::Interface {
 
   //gaussian.cpp
   auto gaussianConstructTable() -> void;
+  auto gaussianInterpolate() -> void;
 
   //serialization.cpp
   auto serialize(serializer&) -> void;
@@ -207,6 +208,8 @@ struct SPU : Thread, Memory::Interface {
     Voice(SPU& self, u32 id) : self(self), id(id) {}
 
     //voice.app
+    auto active() const -> bool;
+    auto decode() -> void;
     auto sample(s32 modulation) -> std::pair<s32, s32>;
     auto tickEnvelope() -> void;
     auto advancePhase() -> void;
@@ -311,6 +314,13 @@ struct SPU : Thread, Memory::Interface {
 
 //unserialized:
   s16 gaussianTable[512];
+
+  //per-sample voice state in structure-of-arrays form
+  struct Lanes {
+    alignas(16) s16 weights[4][24];
+    alignas(16) s16 samples[4][24];
+    alignas(16) s32 interpolated[24];
+  } lanes;
 };
 
 extern SPU spu;
@@ -1,5 +1,23 @@
+auto SPU::Voice::active() const -> bool {
+  return adsr.phase != ADSR::Phase::Off || self.irq.enable;
+}
+
+//a voice's block decode only depends on its own state and on SPU RAM,
+//so all voices are decoded ahead of mixing to allow batch interpolation.
+auto SPU::Voice::decode() -> void {
+  if(!active() || adpcm.hasSamples) return;
+
+  readBlock();
+  decodeBlock();
+  adpcm.hasSamples = 1;
+
+  if(block.loopStart && !adpcm.ignoreLoopAddress) {
+    adpcm.repeatAddress = adpcm.currentAddress;
+  }
+}
+
 auto SPU::Voice::sample(s32 modulation) -> std::pair<s32, s32> {
-  if(adsr.phase == ADSR::Phase::Off && !self.irq.enable) {
+  if(!active()) {
     adsr.lastVolume = 0;
     return {0, 0};
   }
@@ -7,21 +25,11 @@ auto SPU::Voice::sample(s32 modulation) -> std::pair<s32, s32> {
   s32 l = 0;
   s32 r = 0;
 
-  if(!adpcm.hasSamples) {
-    readBlock();
-    decodeBlock();
-    adpcm.hasSamples = 1;
-
-    if(block.loopStart && !adpcm.ignoreLoopAddress) {
-      adpcm.repeatAddress = adpcm.currentAddress;
-    }
-  }
-
   s32 volume = 0;
   if(non) {
     volume = self.noise.level;
   } else {
-    volume = gaussianInterpolate();
+    volume = self.lanes.interpolated[id];
   }
   volume = amplify(volume, adsr.volume);
   adsr.lastVolume = volume;
@@ -6,6 +6,7 @@ auto Cartridge::Debugger::load(Node::Object parent) -> void {
       return cartridge.rom.read(address);
     });
     memory.rom->setWrite([&](u32 address, u8 data) -> void {
+      cpu.recompiler.invalidate();
       return cartridge.rom.program(address, data);
     });
   }
@@ -78,7 +78,11 @@ auto Cartridge::loadMap(Markup::Node map, T& memory) -> n32 {
   auto base = map["base"].natural();
   auto mask = map["mask"].natural();
   if(size == 0) size = memory.size();
-  return bus.map(std::bind_front(&T::read, &memory), std::bind_front(&T::write, &memory), address, size, base, mask);
+  auto id = bus.map(std::bind_front(&T::read, &memory), std::bind_front(&T::write, &memory), address, size, base, mask);
+  if constexpr(std::is_same_v<T, ReadableMemory> || std::is_same_v<T, WritableMemory>) {
+    bus.direct(id, memory.data(), memory.size(), std::is_same_v<T, WritableMemory>);
+  }
+  return id;
 }
 
 auto Cartridge::loadMap(
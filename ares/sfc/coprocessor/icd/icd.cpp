@@ -38,7 +38,7 @@ auto ICD::main() -> void {
     GameBoy::system.run();
     Thread::step(GameBoy::system.clocksExecuted());
   } else {  //DMG halted
-    GameBoy::apu.stream->frame(0.0, 0.0);
+    GameBoy::apu.idle();
     Thread::step(2);  //two clocks per audio sample
   }
   Thread::synchronize(cpu);
@@ -81,7 +81,7 @@ auto ICD::power(bool reset) -> void {
   vcounter = 0;
 
   GameBoy::system.power();
-  GameBoy::apu.stream->setFrequency(clockFrequency() / 5.0 / 2.0);
+  GameBoy::apu.setFrequency(clockFrequency() / 5.0 / 2.0);
 }
 
 #endif
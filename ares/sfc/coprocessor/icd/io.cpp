@@ -66,7 +66,7 @@ auto ICD::writeIO(n24 address, n8 data) -> void {
     case 3: frequency /= 9; break;  //very slow
     }
     Thread::setFrequency(frequency);
-    GameBoy::apu.stream->setFrequency(frequency / 2.0);
+    GameBoy::apu.setFrequency(frequency / 2.0);
     r6003 = data;
     return;
   }
@@ -5,6 +5,7 @@ auto SA1::Debugger::load(Node::Object parent) -> void {
     return sa1.rom.read(address);
   });
   memory.rom->setWrite([&](u32 address, u8 data) -> void {
+    sa1.recompiler.invalidate();
     return sa1.rom.program(address, data);
   });
 
@@ -178,24 +178,28 @@ auto SA1::writeIOCPU(n24 address, n8 data) -> void {
   case 0x2220:
     io.cb     = data.bit(0,2);
     io.cbmode = data.bit(7);
+    mapPages();
     return;
 
   //(DXB) Super MMC bank D
   case 0x2221:
     io.db     = data.bit(0,2);
     io.dbmode = data.bit(7);
+    mapPages();
     return;
 
   //(EXB) Super MMC bank E
   case 0x2222:
     io.eb     = data.bit(0,2);
     io.ebmode = data.bit(7);
+    mapPages();
     return;
 
   //(FXB) Super MMC bank F
   case 0x2223:
     io.fb     = data.bit(0,2);
     io.fbmode = data.bit(7);
+    mapPages();
     return;
 
   //(BMAPS) S-CPU BW-RAM address mapping
@@ -206,11 +210,13 @@ auto SA1::writeIOCPU(n24 address, n8 data) -> void {
   //(SWBE) S-CPU BW-RAM write enable
   case 0x2226:
     io.swen = data.bit(7);
+    mapPages();
     return;
 
   //(BWPA) BW-RAM write-protected area
   case 0x2228:
     io.bwp = data.bit(0,3);
+    mapPages();
     return;
 
   //(SIWP) S-CPU I-RAM write protection
@@ -304,16 +310,19 @@ auto SA1::writeIOSA1(n24 address, n8 data) -> void {
   case 0x2225:
     io.cbm  = data.bit(0,6);
     io.sw46 = data.bit(7);
+    mapPages();
     return;
 
   //(CWBE) SA-1 BW-RAM write enable
   case 0x2227:
     io.cwen = data.bit(7);
+    mapPages();
     return;
 
   //(CIWP) SA-1 I-RAM write protection
   case 0x222a:
     io.ciwp = data;
+    mapPages();
     return;
 
   //(DCNT) DMA control
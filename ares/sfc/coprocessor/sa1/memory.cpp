@@ -106,6 +106,66 @@ auto SA1::write(n24 address, n8 data) -> void {
   return;
 }
 
+auto SA1::stepBlock(u32 clocks, u32 cycles) -> void {
+  for(u32 n : range(clocks / 2)) step();
+}
+
+//exposes ROM, I-RAM and linear BW-RAM to the recompiler.
+//this must be called again whenever the Super MMC, BW-RAM or I-RAM registers change.
+//bus conflict penalties with the S-CPU are not applied to accesses through these pages.
+auto SA1::mapPages() -> void {
+  if constexpr(Accuracy::Recompiler) {
+    auto pointer = [](AbstractMemory& memory, u32 address) -> n8* {
+      if(memory.size() < Recompiler::PageSize) return nullptr;
+      u32 first = Bus::mirror(address, memory.size());
+      u32 last = Bus::mirror(address + Recompiler::PageSize - 1, memory.size());
+      if(last != first + Recompiler::PageSize - 1) return nullptr;
+      return memory.data() + first;
+    };
+
+    for(u32 index : range(recompiler.pages.size())) {
+      auto& page = recompiler.pages[index];
+      n24 address = index << Recompiler::PageBits;
+      page = {};
+
+      if((address & 0x408000) == 0x008000  //00-3f,80-bf:8000-ffff
+      || (address & 0xc00000) == 0xc00000  //c0-ff:0000-ffff
+      ) {
+        n24 translated = ROM::translate(address);
+        if((translated & 0xfff800) == 0x007800) continue;  //reset vector overrides
+        n24 mapped = rom.bank(translated);
+        if((mapped & 0x400000) && bsmemory.size()) continue;
+        page.read = pointer(rom, mapped);
+        page.clocks = 2;
+        page.constant = true;
+        continue;
+      }
+
+      if((address & 0x40e000) == 0x006000  //00-3f,80-bf:6000-7fff
+      || (address & 0xe00000) == 0x400000  //40-5f:0000-ffff
+      ) {
+        if(!address.bit(22) && io.sw46) continue;  //bitmap projection
+        n24 linear = address;
+        if(!address.bit(22)) linear = (io.cbm & 0x1f) * 0x2000 + (address & 0x1fff);
+        page.read = pointer(bwram, linear);
+        if(io.swen || io.cwen || (n18)linear >= 0x100 << io.bwp) page.write = page.read;
+        page.clocks = 4;
+        continue;
+      }
+
+      if((address & 0x40f800) == 0x000000  //00-3f,80-bf:0000-07ff
+      || (address & 0x40f800) == 0x003000  //00-3f,80-bf:3000-37ff
+      ) {
+        page.read = pointer(iram, address);
+        if(io.ciwp == 0xff) page.write = page.read;
+        page.clocks = 2;
+        continue;
+      }
+    }
+    recompiler.invalidate();
+  }
+}
+
 //$230c (VDPL), $230d (VDPH) use this bus to read variable-length data.
 //this is used both to keep VBR-reads from accessing MMIO registers, and
 //to avoid syncing the S-CPU and SA-1*; as both chips are able to access
@@ -24,45 +24,50 @@ auto SA1::ROM::readCPU(n24 address, n8 data) -> n8 {
     if(address == 0x7fef && sa1.io.cpu_ivsw) return sa1.io.siv >> 8;
   }
 
-  static auto read = [](n24 address) {
-    if((address & 0x400000) && bsmemory.size()) return bsmemory.read(address, 0x00);
-    return sa1.rom.read(address);
-  };
+  address = bank(address);
+  if((address & 0x400000) && bsmemory.size()) return bsmemory.read(address, 0x00);
+  return read(address);
+}
 
+//applies the Super MMC bank registers to a translated address.
+//the result selects BS Memory rather than the ROM when bit 22 is set and BS Memory is present.
+auto SA1::ROM::bank(n24 address) const -> n24 {
   bool lo = address < 0x400000;  //*bmode==0 only applies to 00-3f,80-bf:8000-ffff
   address &= 0x3fffff;
 
   if(address < 0x100000) {  //00-1f,8000-ffff; c0-cf:0000-ffff
-    if(lo && sa1.io.cbmode == 0) return read(address);
-    return read(sa1.io.cb << 20 | address & 0x0fffff);
+    if(lo && sa1.io.cbmode == 0) return address;
+    return sa1.io.cb << 20 | address & 0x0fffff;
   }
 
   if(address < 0x200000) {  //20-3f,8000-ffff; d0-df:0000-ffff
-    if(lo && sa1.io.dbmode == 0) return read(address);
-    return read(sa1.io.db << 20 | address & 0x0fffff);
+    if(lo && sa1.io.dbmode == 0) return address;
+    return sa1.io.db << 20 | address & 0x0fffff;
   }
 
   if(address < 0x300000) {  //80-9f,8000-ffff; e0-ef:0000-ffff
-    if(lo && sa1.io.ebmode == 0) return read(address);
-    return read(sa1.io.eb << 20 | address & 0x0fffff);
-  }
-
-  if(address < 0x400000) {  //a0-bf,8000-ffff; f0-ff:0000-ffff
-    if(lo && sa1.io.fbmode == 0) return read(address);
-    return read(sa1.io.fb << 20 | address & 0x0fffff);
+    if(lo && sa1.io.ebmode == 0) return address;
+    return sa1.io.eb << 20 | address & 0x0fffff;
   }
 
-  return data;  //unreachable
+  //a0-bf,8000-ffff; f0-ff:0000-ffff
+  if(lo && sa1.io.fbmode == 0) return address;
+  return sa1.io.fb << 20 | address & 0x0fffff;
 }
 
 auto SA1::ROM::writeCPU(n24 address, n8 data) -> void {
 }
 
 auto SA1::ROM::readSA1(n24 address, n8 data) -> n8 {
+  return readCPU(translate(address), data);
+}
+
+//00-3f,80-bf:8000-ffff => 00-3f:0000-ffff
+auto SA1::ROM::translate(n24 address) -> n24 {
   if((address & 0x408000) == 0x008000) {
     address = (address & 0x800000) >> 2 | (address & 0x3f0000) >> 1 | address & 0x007fff;
   }
-  return readCPU(address, data);
+  return address;
 }
 
 auto SA1::ROM::writeSA1(n24 address, n8 data) -> void {
@@ -56,6 +56,10 @@ auto SA1::main() -> void {
     return;
   }
 
+  if(Accuracy::Recompiler && recompiler.enabled && !debugger.tracer.instruction->enabled() && !platform->cheats()) {
+    if(auto block = recompiler.block()) return block->execute(*this);
+  }
+
   debugger.instruction();
   instruction();
 }
@@ -309,4 +313,7 @@ auto SA1::power() -> void {
 
   //$230b
   io.overflow = false;
+
+  recompiler.idleClocks = 2;
+  mapPages();
 }
@@ -57,6 +57,8 @@ struct SA1 : WDC65816, Thread {
   auto write(n24 address, n8 data) -> void override;
   auto readVBR(n24 address, n8 data = 0) -> n8;
   auto readDisassembler(n24 address) -> n8 override;
+  auto stepBlock(u32 clocks, u32 cycles) -> void override;
+  auto mapPages() -> void;
 
   //io.cpp
   auto readIOCPU(n24 address, n8 data) -> n8;
@@ -80,6 +82,9 @@ struct SA1 : WDC65816, Thread {
 
     auto readSA1(n24 address, n8 data = 0) -> n8;
     auto writeSA1(n24 address, n8 data) -> void;
+
+    auto bank(n24 address) const -> n24;
+    static auto translate(n24 address) -> n24;
   } rom;
 
   struct BWRAM : WritableMemory {
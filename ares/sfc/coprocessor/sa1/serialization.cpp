@@ -137,4 +137,9 @@ auto SA1::serialize(serializer& s) -> void {
   s(io.mr);
 
   s(io.overflow);
+
+  if constexpr(Accuracy::Recompiler) {
+    recompiler.reset();
+    mapPages();
+  }
 }
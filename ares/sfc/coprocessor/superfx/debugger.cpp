@@ -5,6 +5,7 @@ auto SuperFX::Debugger::load(Node::Object parent) -> void {
     return superfx.rom.read(address);
   });
   memory.rom->setWrite([&](u32 address, u8 data) -> void {
+    superfx.recompiler.invalidate();
     return superfx.rom.program(address, data);
   });
 
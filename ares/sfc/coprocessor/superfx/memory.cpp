@@ -51,6 +51,8 @@ auto SuperFX::readOpcode(n16 address) -> n8 {
         cache.buffer[dp++] = read(sp++);
       }
       cache.valid[offset >> 4] = true;
+      //game RAM may have been written since code was last compiled from it
+      if(regs.pbr >= 0x60) recompiler.invalidate();
     } else {
       step(regs.clsr ? 1 : 2);
     }
@@ -86,6 +88,11 @@ inline auto SuperFX::pipe() -> n8 {
 
 auto SuperFX::flushCache() -> void {
   for(u32 n : range(32)) cache.valid[n] = false;
+  //lines written by the S-CPU will be refilled from the bus
+  if(recompiler.written) {
+    recompiler.written = false;
+    recompiler.invalidate();
+  }
 }
 
 auto SuperFX::readCache(n16 address) -> n8 {
@@ -96,5 +103,7 @@ auto SuperFX::readCache(n16 address) -> n8 {
 auto SuperFX::writeCache(n16 address, n8 data) -> void {
   address = (address + regs.cbr) & 511;
   cache.buffer[address] = data;
+  recompiler.written = true;
+  recompiler.invalidate();
   if((address & 15) == 15) cache.valid[address >> 4] = true;
 }
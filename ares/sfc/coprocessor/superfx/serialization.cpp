@@ -3,4 +3,8 @@ auto SuperFX::serialize(serializer& s) -> void {
   Thread::serialize(s);
   s(ram);
   s(bram);
+
+  if constexpr(GSU::Accuracy::Recompiler) {
+    recompiler.reset();
+  }
 }
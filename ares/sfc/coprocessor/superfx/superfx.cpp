@@ -28,6 +28,12 @@ auto SuperFX::unload() -> void {
 auto SuperFX::main() -> void {
   if(regs.sfr.g == 0) return step(6);
 
+  if(GSU::Accuracy::Recompiler && recompiler.enabled && !debugger.tracer.instruction->enabled()) {
+    if(auto block = recompiler.block()) {
+      return block->execute(*this);
+    }
+  }
+
   auto opcode = peekpipe();
   debugger.instruction();
   instruction(opcode);
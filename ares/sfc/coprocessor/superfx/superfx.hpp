@@ -78,7 +78,7 @@ struct SuperFX : GSU, Thread {
 
   auto syncROMBuffer() -> void override;
   auto readROMBuffer() -> n8 override;
-  auto updateROMBuffer() -> void;
+  auto updateROMBuffer() -> void override;
 
   auto syncRAMBuffer() -> void override;
   auto readRAMBuffer(n16 address) -> n8 override;
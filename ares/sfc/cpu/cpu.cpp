@@ -31,6 +31,14 @@ auto CPU::main() -> void {
   if(r.stp) return instructionStop();
 
   if(!status.interruptPending) {
+    //compiled code reads directly mapped memory without going through Bus::read(), which applies cheats
+    if(Accuracy::Recompiler && recompiler.enabled && !debugger.tracer.instruction->enabled() && !platform->cheats()) {
+      if(!status.dmaActive && !status.dmaPending && !status.hdmaPending) {
+        if(auto block = recompiler.block()) {
+          return block->execute(*this);
+        }
+      }
+    }
     debugger.instruction();
     return instruction();
   }
@@ -66,8 +74,8 @@ auto CPU::map() -> void {
 
   reader = std::bind_front(&CPU::readRAM, this);
   writer = std::bind_front(&CPU::writeRAM, this);
-  bus.map(reader, writer, "00-3f,80-bf:0000-1fff", 0x2000);
-  bus.map(reader, writer, "7e-7f:0000-ffff", 0x20000);
+  bus.direct(bus.map(reader, writer, "00-3f,80-bf:0000-1fff", 0x2000), wram, 0x2000, true);
+  bus.direct(bus.map(reader, writer, "7e-7f:0000-ffff", 0x20000), wram, 0x20000, true);
 
   reader = std::bind_front(&CPU::readAPU, this);
   writer = std::bind_front(&CPU::writeAPU, this);
@@ -110,6 +118,9 @@ auto CPU::power(bool reset) -> void {
   status.hdmaPosition = 1104;
   status.resetPending = 1;
   status.interruptPending = 1;
+
+  recompiler.idleClocks = 6;
+  mapPages();
 }
 
 }
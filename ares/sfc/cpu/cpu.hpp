@@ -49,6 +49,9 @@ struct CPU : WDC65816, Thread, PPUcounter {
   auto write(n24 address, n8 data) -> void override;
   auto wait(n24 address) const -> u32;
   auto readDisassembler(n24 address) -> n8 override;
+  auto stepBlock(u32 clocks, u32 cycles) -> void override;
+  auto mapPages() -> void;
+  auto mapPageTiming() -> void;
 
   //io.cpp
   auto readRAM(n24 address, n8 data) -> n8;
@@ -210,9 +210,14 @@ auto CPU::writeCPU(n24 address, n8 data) -> void {
     for(u32 n : range(8)) channels[n].hdmaEnable = data.bit(n);
     return;
 
-  case 0x420d:  //MEMSEL
-    io.romSpeed = data.bit(0) ? 6 : 8;
+  case 0x420d: {  //MEMSEL
+    u32 romSpeed = data.bit(0) ? 6 : 8;
+    if(io.romSpeed != romSpeed) {
+      io.romSpeed = romSpeed;
+      mapPageTiming();
+    }
     return;
+  }
 
   }
 }
@@ -44,3 +44,43 @@ alwaysinline auto CPU::wait(n24 address) const -> u32 {
 auto CPU::readDisassembler(n24 address) -> n8 {
   return bus.read(address, r.mdr);
 }
+
+//the accesses of a recompiled block are stepped back to back, in runs short enough that
+//step() cannot pass over the HDMA and DRAM refresh positions of a scanline.
+//H/DMA requested during the block begins once they are complete.
+auto CPU::stepBlock(u32 clocks, u32 cycles) -> void {
+  status.clockCount = clocks / cycles;
+  while(cycles) {
+    u32 count = min(cycles, 8u);
+    u32 ticks = count == cycles ? clocks : clocks / cycles * count & ~1;
+    step(ticks);
+    clocks -= ticks;
+    cycles -= count;
+    while(count--) aluEdge();
+  }
+  dmaEdge();
+}
+
+//exposes WRAM and cartridge memory that is mapped without side effects to the recompiler.
+//this must be called again whenever such memory is remapped.
+auto CPU::mapPages() -> void {
+  if constexpr(Accuracy::Recompiler) {
+    for(u32 index : range(recompiler.pages.size())) {
+      auto& page = recompiler.pages[index];
+      n24 address = index << Recompiler::PageBits;
+      page.read = bus.pointer(address, Recompiler::PageSize, false);
+      page.write = bus.pointer(address, Recompiler::PageSize, true);
+      page.constant = page.read && !page.write;
+    }
+    mapPageTiming();
+  }
+}
+
+auto CPU::mapPageTiming() -> void {
+  if constexpr(Accuracy::Recompiler) {
+    for(u32 index : range(recompiler.pages.size())) {
+      recompiler.pages[index].clocks = wait(index << Recompiler::PageBits);
+    }
+    recompiler.invalidate();
+  }
+}
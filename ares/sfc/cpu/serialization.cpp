@@ -104,4 +104,9 @@ auto CPU::serialize(serializer& s) -> void {
     s(channel.hdmaCompleted);
     s(channel.hdmaDoTransfer);
   }
+
+  if constexpr(Accuracy::Recompiler) {
+    recompiler.reset();
+    mapPageTiming();
+  }
 }
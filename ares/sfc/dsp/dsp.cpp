@@ -32,161 +32,178 @@ auto DSP::unload() -> void {
 }
 
 auto DSP::main() -> void {
+  if(accurate || stepped) {
+    if(stepped) stepped--;
+    return run<true>();
+  }
+
+  //SMP writes made during this sample take effect from the next sample,
+  //and SMP reads made before it catches up see the state at the end of this sample.
+  run<false>();
+  Thread::step(32 * 3 * 8);
+  Thread::synchronize(smp);
+}
+
+template<bool Stepped> auto DSP::run() -> void {
+  gaussianInterpolate();
+
   voice5(voice[0]);
   voice2(voice[1]);
-  tick();
+  tick<Stepped>();
 
   voice6(voice[0]);
   voice3(voice[1]);
-  tick();
+  tick<Stepped>();
 
   voice7(voice[0]);
   voice4(voice[1]);
   voice1(voice[3]);
-  tick();
+  tick<Stepped>();
 
   voice8(voice[0]);
   voice5(voice[1]);
   voice2(voice[2]);
-  tick();
+  tick<Stepped>();
 
   voice9(voice[0]);
   voice6(voice[1]);
   voice3(voice[2]);
-  tick();
+  tick<Stepped>();
 
   voice7(voice[1]);
   voice4(voice[2]);
   voice1(voice[4]);
-  tick();
+  tick<Stepped>();
 
   voice8(voice[1]);
   voice5(voice[2]);
   voice2(voice[3]);
-  tick();
+  tick<Stepped>();
 
   voice9(voice[1]);
   voice6(voice[2]);
   voice3(voice[3]);
-  tick();
+  tick<Stepped>();
 
   voice7(voice[2]);
   voice4(voice[3]);
   voice1(voice[5]);
-  tick();
+  tick<Stepped>();
 
   voice8(voice[2]);
   voice5(voice[3]);
   voice2(voice[4]);
-  tick();
+  tick<Stepped>();
 
   voice9(voice[2]);
   voice6(voice[3]);
   voice3(voice[4]);
-  tick();
+  tick<Stepped>();
 
   voice7(voice[3]);
   voice4(voice[4]);
   voice1(voice[6]);
-  tick();
+  tick<Stepped>();
 
   voice8(voice[3]);
   voice5(voice[4]);
   voice2(voice[5]);
-  tick();
+  tick<Stepped>();
 
   voice9(voice[3]);
   voice6(voice[4]);
   voice3(voice[5]);
-  tick();
+  tick<Stepped>();
 
   voice7(voice[4]);
   voice4(voice[5]);
   voice1(voice[7]);
-  tick();
+  tick<Stepped>();
 
   voice8(voice[4]);
   voice5(voice[5]);
   voice2(voice[6]);
-  tick();
+  tick<Stepped>();
 
   voice9(voice[4]);
   voice6(voice[5]);
   voice3(voice[6]);
-  tick();
+  tick<Stepped>();
 
   voice1(voice[0]);
   voice7(voice[5]);
   voice4(voice[6]);
-  tick();
+  tick<Stepped>();
 
   voice8(voice[5]);
   voice5(voice[6]);
   voice2(voice[7]);
-  tick();
+  tick<Stepped>();
 
   voice9(voice[5]);
   voice6(voice[6]);
   voice3(voice[7]);
-  tick();
+  tick<Stepped>();
 
   voice1(voice[1]);
   voice7(voice[6]);
   voice4(voice[7]);
-  tick();
+  tick<Stepped>();
 
   voice8(voice[6]);
   voice5(voice[7]);
   voice2(voice[0]);
-  tick();
+  tick<Stepped>();
 
   voice3a(voice[0]);
   voice9(voice[6]);
   voice6(voice[7]);
-  echo22();
-  tick();
+  echo22<Stepped>();
+  tick<Stepped>();
 
   voice7(voice[7]);
-  echo23();
-  tick();
+  echo23<Stepped>();
+  tick<Stepped>();
 
   voice8(voice[7]);
-  echo24();
-  tick();
+  echo24<Stepped>();
+  tick<Stepped>();
 
   voice3b(voice[0]);
   voice9(voice[7]);
-  echo25();
-  tick();
+  echo25<Stepped>();
+  tick<Stepped>();
 
   echo26();
-  tick();
+  tick<Stepped>();
 
   misc27();
   echo27();
-  tick();
+  tick<Stepped>();
 
   misc28();
   echo28();
-  tick();
+  tick<Stepped>();
 
   misc29();
   echo29();
-  tick();
+  tick<Stepped>();
 
   misc30();
   voice3c(voice[0]);
   echo30();
-  tick();
+  tick<Stepped>();
 
   voice4(voice[0]);
   voice1(voice[2]);
-  tick();
+  tick<Stepped>();
 }
 
-auto DSP::tick() -> void {
-  Thread::step(3 * 8);
-  Thread::synchronize(smp);
+template<bool Stepped> auto DSP::tick() -> void {
+  if constexpr(Stepped) {
+    Thread::step(3 * 8);
+    Thread::synchronize(smp);
+  }
 }
 
 auto DSP::sample(i16 left, i16 right) -> void {
@@ -206,6 +223,7 @@ auto DSP::power(bool reset) -> void {
   noise = {};
   brr = {};
   latch = {};
+  stepped = 0;
   for(u32 n : range(8)) {
     voice[n] = {};
     voice[n].index = n << 4;
@@ -16,6 +16,10 @@ struct DSP : Thread {
   n8 apuram[64_KiB];
   n8 registers[128];
 
+  //true: synchronize with the SMP between every stage of the voice pipeline.
+  //false: evaluate a whole sample at once, unless the SMP is polling voice state.
+  bool accurate = true;
+
   auto mute() const -> bool { return mainvol.mute; }
 
   //dsp.cpp
@@ -33,6 +37,15 @@ struct DSP : Thread {
   auto serialize(serializer&) -> void;
 
 private:
+  struct Accuracy {
+    //enable all accuracy flags
+    static constexpr bool Reference = 0;
+
+    //Gaussian interpolation across voices and echo FIR across taps
+    static constexpr bool SISD = 0 | Reference | !ARCHITECTURE_SUPPORTS_SSE4_1;
+    static constexpr bool SIMD = !SISD;
+  };
+
   struct Envelope { enum : u32 {
     Release,
     Attack,
@@ -139,7 +152,7 @@ private:
   //gaussian.cpp
   i16 gaussianTable[512];
   auto gaussianConstructTable() -> void;
-  auto gaussianInterpolate(const Voice& v) -> s32;
+  auto gaussianInterpolate() -> void;
 
   //counter.cpp
   static const n16 CounterRate[32];
@@ -179,10 +192,11 @@ private:
   auto echoOutput(n1 channel) const -> i16;
   auto echoRead(n1 channel) -> void;
   auto echoWrite(n1 channel) -> void;
-  auto echo22() -> void;
-  auto echo23() -> void;
-  auto echo24() -> void;
-  auto echo25() -> void;
+  auto echoFilter() -> void;
+  template<bool Stepped> auto echo22() -> void;
+  template<bool Stepped> auto echo23() -> void;
+  template<bool Stepped> auto echo24() -> void;
+  template<bool Stepped> auto echo25() -> void;
   auto echo26() -> void;
   auto echo27() -> void;
   auto echo28() -> void;
@@ -190,8 +204,21 @@ private:
   auto echo30() -> void;
 
   //dsp.cpp
-  auto tick() -> void;
+  template<bool Stepped> auto run() -> void;
+  template<bool Stepped> auto tick() -> void;
   auto sample(i16 left, i16 right) -> void;
+
+  n8 stepped;  //samples left to run cycle-stepped after the SMP last polled voice state
+
+//unserialized:
+  //per-sample voice and echo state in structure-of-arrays form
+  struct Lanes {
+    alignas(16) s16 weights[4][8];
+    alignas(16) s16 samples[4][8];
+    alignas(16) s16 interpolated[8];
+    alignas(16) s16 history[2][8];
+    alignas(16) s16 fir[8];
+  } lanes;
 };
 
 extern DSP dsp;
@@ -27,7 +27,52 @@ auto DSP::echoWrite(n1 channel) -> void {
   echo.output[channel] = 0;
 }
 
-auto DSP::echo22() -> void {
+//computes all eight FIR taps for both channels at once, as echo22() through echo25() do over four clocks.
+//the history entries echoRead() replaces are only used by the final tap, so the result is the same.
+auto DSP::echoFilter() -> void {
+  for(u32 tap : range(8)) {
+    lanes.fir[tap] = echo.fir[tap];
+    lanes.history[0][tap] = echo.history[0][(n3)(echo._historyOffset + tap + 1)];
+    lanes.history[1][tap] = echo.history[1][(n3)(echo._historyOffset + tap + 1)];
+  }
+
+  s32 sum[2];   //taps 0-6
+  s32 last[2];  //tap 7
+
+  if constexpr(Accuracy::SISD) {
+    for(u32 channel : range(2)) {
+      sum[channel] = 0;
+      for(u32 tap : range(7)) sum[channel] += lanes.history[channel][tap] * lanes.fir[tap] >> 6;
+      last[channel] = lanes.history[channel][7] * lanes.fir[7] >> 6;
+    }
+  }
+
+  if constexpr(Accuracy::SIMD) {
+    #if ARCHITECTURE_SUPPORTS_SSE4_1
+    __m128i fir = _mm_load_si128((const __m128i*)lanes.fir);
+    for(u32 channel : range(2)) {
+      __m128i history = _mm_load_si128((const __m128i*)lanes.history[channel]);
+      __m128i productlo = _mm_mullo_epi16(history, fir);
+      __m128i producthi = _mm_mulhi_epi16(history, fir);
+      __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(productlo, producthi), 6);
+      __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(productlo, producthi), 6);
+      __m128i total = _mm_add_epi32(lo, hi);
+      total = _mm_add_epi32(total, _mm_shuffle_epi32(total, 0x4e));
+      total = _mm_add_epi32(total, _mm_shuffle_epi32(total, 0xb1));
+      last[channel] = _mm_extract_epi32(hi, 3);
+      sum[channel] = _mm_cvtsi128_si32(total) - last[channel];
+    }
+    #endif
+  }
+
+  for(u32 channel : range(2)) {
+    s32 output = (i16)sum[channel];
+    output += (i16)last[channel];
+    echo.input[channel] = sclamp<16>(output) & ~1;
+  }
+}
+
+template<bool Stepped> auto DSP::echo22() -> void {
   //history
   echo._historyOffset++;
 
@@ -35,32 +80,41 @@ auto DSP::echo22() -> void {
   echoRead(0);
 
   //FIR
-  s32 l = calculateFIR(0, 0);
-  s32 r = calculateFIR(1, 0);
+  if constexpr(Stepped) {
+    s32 l = calculateFIR(0, 0);
+    s32 r = calculateFIR(1, 0);
 
-  echo.input[0] = l;
-  echo.input[1] = r;
+    echo.input[0] = l;
+    echo.input[1] = r;
+  }
 }
 
-auto DSP::echo23() -> void {
-  s32 l = calculateFIR(0, 1) + calculateFIR(0, 2);
-  s32 r = calculateFIR(1, 1) + calculateFIR(1, 2);
+template<bool Stepped> auto DSP::echo23() -> void {
+  if constexpr(Stepped) {
+    s32 l = calculateFIR(0, 1) + calculateFIR(0, 2);
+    s32 r = calculateFIR(1, 1) + calculateFIR(1, 2);
 
-  echo.input[0] += l;
-  echo.input[1] += r;
+    echo.input[0] += l;
+    echo.input[1] += r;
+  }
 
   echoRead(1);
 }
 
-auto DSP::echo24() -> void {
-  s32 l = calculateFIR(0, 3) + calculateFIR(0, 4) + calculateFIR(0, 5);
-  s32 r = calculateFIR(1, 3) + calculateFIR(1, 4) + calculateFIR(1, 5);
+template<bool Stepped> auto DSP::echo24() -> void {
+  if constexpr(Stepped) {
+    s32 l = calculateFIR(0, 3) + calculateFIR(0, 4) + calculateFIR(0, 5);
+    s32 r = calculateFIR(1, 3) + calculateFIR(1, 4) + calculateFIR(1, 5);
 
-  echo.input[0] += l;
-  echo.input[1] += r;
+    echo.input[0] += l;
+    echo.input[1] += r;
+  }
 }
 
-auto DSP::echo25() -> void {
+template<bool Stepped> auto DSP::echo25() -> void {
+  //without stepping, FIRx cannot change partway through the filter
+  if constexpr(!Stepped) return echoFilter();
+
   s32 l = echo.input[0] + calculateFIR(0, 6);
   s32 r = echo.input[1] + calculateFIR(1, 6);
 
@@ -22,18 +22,67 @@ auto DSP::gaussianConstructTable() -> void {
   }
 }
 
-auto DSP::gaussianInterpolate(const Voice& v) -> s32 {
-  //make pointers into gaussian table based on fractional position between samples
-  n8 offset = v.gaussianOffset >> 4;
-  const i16* forward = gaussianTable + 255 - offset;
-  const i16* reverse = gaussianTable       + offset;  //mirror left half of gaussian table
+//interpolates every voice from the state voice3c() will see, before any voice stage of the sample runs.
+//no stage touches a voice's buffer or offsets between the start of the sample and its own voice3c().
+auto DSP::gaussianInterpolate() -> void {
+  for(u32 n : range(8)) {
+    auto& v = voice[n];
 
-  offset = (v.bufferOffset + (v.gaussianOffset >> 12)) % 12;
-  s32 output;
-  output  = forward[  0] * v.buffer[offset] >> 11; if(++offset >= 12) offset = 0;
-  output += forward[256] * v.buffer[offset] >> 11; if(++offset >= 12) offset = 0;
-  output += reverse[256] * v.buffer[offset] >> 11; if(++offset >= 12) offset = 0;
-  output  = i16(output);
-  output += reverse[  0] * v.buffer[offset] >> 11;
-  return sclamp<16>(output) & ~1;
+    //voice3c() restarts the buffer and holds the position during KON before interpolating
+    n16 gaussianOffset = v.gaussianOffset;
+    n4  bufferOffset = v.bufferOffset;
+    if(v.keyonDelay) {
+      if(v.keyonDelay == 5) bufferOffset = 0;
+      gaussianOffset = (v.keyonDelay - 1) & 3 ? 0x4000 : 0;
+    }
+
+    //make pointers into gaussian table based on fractional position between samples
+    n8 phase = gaussianOffset >> 4;
+    lanes.weights[0][n] = gaussianTable[255 - phase];
+    lanes.weights[1][n] = gaussianTable[511 - phase];
+    lanes.weights[2][n] = gaussianTable[256 + phase];  //mirror left half of gaussian table
+    lanes.weights[3][n] = gaussianTable[  0 + phase];
+
+    u32 offset = (bufferOffset + (gaussianOffset >> 12)) % 12;
+    for(u32 tap : range(4)) {
+      lanes.samples[tap][n] = v.buffer[offset];
+      if(++offset >= 12) offset = 0;
+    }
+  }
+
+  if constexpr(Accuracy::SISD) {
+    for(u32 n : range(8)) {
+      s32 output;
+      output  = lanes.weights[0][n] * lanes.samples[0][n] >> 11;
+      output += lanes.weights[1][n] * lanes.samples[1][n] >> 11;
+      output += lanes.weights[2][n] * lanes.samples[2][n] >> 11;
+      output  = i16(output);
+      output += lanes.weights[3][n] * lanes.samples[3][n] >> 11;
+      lanes.interpolated[n] = sclamp<16>(output) & ~1;
+    }
+  }
+
+  if constexpr(Accuracy::SIMD) {
+    #if ARCHITECTURE_SUPPORTS_SSE4_1
+    auto product = [&](u32 tap, __m128i& lo, __m128i& hi) {
+      __m128i weight = _mm_load_si128((const __m128i*)lanes.weights[tap]);
+      __m128i sample = _mm_load_si128((const __m128i*)lanes.samples[tap]);
+      __m128i productlo = _mm_mullo_epi16(weight, sample);
+      __m128i producthi = _mm_mulhi_epi16(weight, sample);
+      lo = _mm_add_epi32(lo, _mm_srai_epi32(_mm_unpacklo_epi16(productlo, producthi), 11));
+      hi = _mm_add_epi32(hi, _mm_srai_epi32(_mm_unpackhi_epi16(productlo, producthi), 11));
+    };
+
+    __m128i lo = _mm_setzero_si128();
+    __m128i hi = _mm_setzero_si128();
+    product(0, lo, hi);
+    product(1, lo, hi);
+    product(2, lo, hi);
+    lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+    hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+    product(3, lo, hi);
+    __m128i output = _mm_and_si128(_mm_packs_epi32(lo, hi), _mm_set1_epi16(~1));
+    _mm_store_si128((__m128i*)lanes.interpolated, output);
+    #endif
+  }
 }
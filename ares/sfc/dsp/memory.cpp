@@ -1,4 +1,7 @@
 auto DSP::read(n7 address) -> n8 {
+  //ENVX, OUTX and ENDX change partway through a sample.
+  //while the SMP is polling them, run the voice pipeline cycle-stepped so it sees each change on time.
+  if(!accurate && ((n4)address == 0x08 || (n4)address == 0x09 || address == 0x7c)) stepped = 64;
   return registers[address];
 }
 
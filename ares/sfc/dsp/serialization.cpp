@@ -46,6 +46,8 @@ auto DSP::serialize(serializer& s) -> void {
   s(latch.pitch);
   s(latch.output);
 
+  s(stepped);
+
   for(auto& v : voice) s(v);
 }
 
@@ -74,8 +74,8 @@ auto DSP::voice3c(Voice& v) -> void {
     latch.pitch = 0;
   }
 
-  //gaussian interpolation
-  s32 output = gaussianInterpolate(v);
+  //gaussian interpolation (evaluated for every voice at the start of the sample)
+  s32 output = lanes.interpolated[v.index >> 4];
 
   //noise
   if(v._noise) {
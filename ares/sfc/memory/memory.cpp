@@ -14,6 +14,7 @@ auto Bus::reset() -> void {
     reader[id] = nullptr;
     writer[id] = nullptr;
     counter[id] = 0;
+    host[id] = {};
   }
 
   if(lookup) delete[] lookup;
@@ -41,6 +42,7 @@ auto Bus::map(
 
   reader[id] = read;
   writer[id] = write;
+  host[id] = {};
 
   auto p = nall::split(addr, ":", 1L);
   p.resize(2);
@@ -61,6 +63,7 @@ auto Bus::map(
           if(pid && --counter[pid] == 0) {
             reader[pid] = nullptr;
             writer[pid] = nullptr;
+            host[pid] = {};
           }
 
           u32 offset = reduce(bank << 16 | addr, mask);
@@ -97,6 +100,7 @@ auto Bus::unmap(const string& addr) -> void {
           if(pid && --counter[pid] == 0) {
             reader[pid] = nullptr;
             writer[pid] = nullptr;
+            host[pid] = {};
           }
 
           lookup[bank << 16 | addr] = 0;
@@ -107,4 +111,25 @@ auto Bus::unmap(const string& addr) -> void {
   }
 }
 
+//declares that the handlers of a mapping only read (and write, if writable) data[target],
+//so that processors may access it directly through pointer().
+auto Bus::direct(u32 id, n8* data, u32 size, bool writable) -> void {
+  if(!id || !data) return;
+  host[id] = {data, size, writable};
+}
+
+//returns host memory backing size bytes from address, if they are mapped linearly to a
+//single mapping declared via direct(); or nullptr if they must go through the bus.
+auto Bus::pointer(n24 address, u32 size, bool write) const -> n8* {
+  u32 id = lookup[address];
+  auto& memory = host[id];
+  if(!memory.data || (write && !memory.writable)) return nullptr;
+  if(address + size > 16_MiB || target[address] + size > memory.size) return nullptr;
+  for(u32 offset : range(size)) {
+    if(lookup[address + offset] != id) return nullptr;
+    if(target[address + offset] != target[address] + offset) return nullptr;
+  }
+  return memory.data + target[address];
+}
+
 }
@@ -41,6 +41,8 @@ struct Bus {
     const string& address, u32 size = 0, u32 base = 0, u32 mask = 0
   ) -> u32;
   auto unmap(const string& address) -> void;
+  auto direct(u32 id, n8* data, u32 size, bool writable) -> void;
+  auto pointer(n24 address, u32 size, bool write) const -> n8*;
 
 private:
   n8*  lookup = nullptr;
@@ -49,6 +51,13 @@ private:
   std::function<n8   (n24, n8)> reader[256];
   std::function<void (n24, n8)> writer[256];
   n24 counter[256];
+
+  //host memory that backs a mapping whose handlers are plain array accesses
+  struct Host {
+    n8* data = nullptr;
+    u32 size = 0;
+    bool writable = false;
+  } host[256];
 };
 
 extern Bus bus;
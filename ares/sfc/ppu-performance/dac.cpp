@@ -16,15 +16,15 @@ auto PPU::DAC::render() -> void {
   self.window.render(window, window.belowMask, windowBelow);
 
   auto vcounter = self.vcounter();
-  auto output = (n32*)self.screen->pixels().data();
+  auto output = self.output;
 
-  if(!self.state.overscan) vcounter += 8;
+  if(!self.frame.overscan) vcounter += 8;
   if(vcounter < 240) {
-    auto yScale = self.interlace() ? 2 : 1;
+    auto yScale = self.frame.interlace ? 2 : 1;
     output += vcounter * yScale * 564;
     //PAL systems have additional vertical border
     if(Region::PAL()) output += (20 * yScale) * 564;
-    if(self.interlace() && self.field()) output += 564;
+    if(self.frame.interlace && self.field()) output += 564;
 
     //Offset for horizontal border
     output += Region::PAL() ? 22 : 26;
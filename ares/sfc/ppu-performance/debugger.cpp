@@ -6,6 +6,7 @@ auto PPU::Debugger::load(Node::Object parent) -> void {
   });
   memory.vram->setWrite([&](u32 address, u8 data) -> void {
     self.vram.data[address >> 1 & self.vram.mask].byte(address & 1) = data;
+    if(self.renderer.threaded()) self.renderer.write(address >> 1 & self.vram.mask, self.vram.data[address >> 1 & self.vram.mask]);
   });
 
   memory.oam = parent->append<Node::Debugger::Memory>("PPU OAM");
@@ -26,6 +26,7 @@ alwaysinline auto PPU::writeVRAM(n1 byte, n8 data) -> void {
   if(!io.displayDisable && cpu.vcounter() < vdisp()) return;
   auto address = addressVRAM();
   vram[address].byte(byte) = data;
+  if(renderer.threaded()) renderer.write(address & vram.mask, vram[address]);
 }
 
 alwaysinline auto PPU::readOAM(n10 address) -> n8 {
@@ -8,14 +8,9 @@ inline auto PPU::Object::setFirstSprite() -> void {
   if(self.io.oamPriority) io.firstSprite = self.io.oamAddress >> 2;
 }
 
-auto PPU::Object::render() -> void {
+auto PPU::Object::evaluate() -> void {
   if(!io.aboveEnable && !io.belowEnable) return;
 
-  bool windowAbove[448];
-  bool windowBelow[448];
-  self.window.render(window, window.aboveEnable, windowAbove);
-  self.window.render(window, window.belowEnable, windowBelow);
-
   u32 itemCount = 0;
   u32 tileCount = 0;
   for(u32 n : range(32)) items[n].valid = false;
@@ -95,6 +90,18 @@ auto PPU::Object::render() -> void {
 
   io.rangeOver |= itemCount > 32;
   io.timeOver  |= tileCount > 34;
+}
+
+auto PPU::Object::draw() -> void {
+  if(!io.aboveEnable && !io.belowEnable) return;
+
+  bool windowAbove[448];
+  bool windowBelow[448];
+  self.window.render(window, window.aboveEnable, windowAbove);
+  self.window.render(window, window.belowEnable, windowBelow);
+
+  u32 width = 256;
+  s32 x1 = 0, x2 = 255;
 
   n8 palette[448];
   n8 priority[448];
@@ -130,6 +137,11 @@ auto PPU::Object::render() -> void {
   }
 }
 
+auto PPU::Object::render() -> void {
+  evaluate();
+  draw();
+}
+
 auto PPU::Object::power() -> void {
   for(auto& object : oam.objects) object = {};
   io = {};
@@ -16,6 +16,7 @@ PPU ppuPerformanceImpl;
 #include "object.cpp"
 #include "dac.cpp"
 #include "color.cpp"
+#include "renderer.cpp"
 #include "debugger.cpp"
 #include "serialization.cpp"
 
@@ -30,22 +31,28 @@ auto PPU::load(Node::Object parent) -> void {
   screen->colors(1 << 19, std::bind_front(&PPU::color, this));
   screen->setSize(564, height() * 2);
   screen->setScale(0.5, 0.5);
+  output = (n32*)screen->pixels().data();
   Region::PAL() ? screen->setAspect(55.0, 43.0) :screen->setAspect(8.0, 7.0);
   screen->refreshRateHint(system.cpuFrequency(), 1364, Region::PAL() ? 312 : 262);
 
   vramSize = node->append<Node::Setting::Natural>("VRAM", 64_KiB);
   vramSize->setAllowedValues({64_KiB, 128_KiB});
 
+  threadedRendering = node->append<Node::Setting::Boolean>("Threaded Rendering", true);
+
   debugger.load(node);
 }
 
 auto PPU::unload() -> void {
   debugger.unload(node);
+  renderer.kill();
   vramSize.reset();
+  threadedRendering.reset();
   deepBlackBoost.reset();
   screen->quit();
   node->remove(screen);
   screen.reset();
+  output = nullptr;
   node.reset();
 }
 
@@ -59,11 +66,18 @@ auto PPU::main() -> void {
   if(vcounter() == 0) {
     state.interlace  = io.interlace;
     state.overscan   = io.overscan;
+    frame            = {state.interlace, state.overscan};
+    output           = (n32*)screen->pixels().data();  //the screen swaps its buffers every frame
     obj.io.rangeOver = 0;
     obj.io.timeOver  = 0;
   }
 
-  if(vcounter() && vcounter() < vdisp() && !runAhead()) {
+  if(vcounter() && vcounter() < vdisp() && !runAhead() && renderer.threaded()) {
+    step(renderingCycle);
+    mosaic.scanline();
+    if(!io.displayDisable) obj.evaluate();
+    renderer.capture();
+  } else if(vcounter() && vcounter() < vdisp() && !runAhead()) {
     step(renderingCycle);
     mosaic.scanline();
     dac.prepare();
@@ -111,6 +125,7 @@ auto PPU::main() -> void {
       screen->setViewport(x, y, w, h * yScale);
     }
 
+    renderer.render();
     screen->frame();
     scheduler.exit(Event::Frame);
   }
@@ -137,6 +152,7 @@ auto PPU::power(bool reset) -> void {
   if(vram.mask != 0xffff) vram.mask = 0x7fff;
 
   state = {};
+  frame = {};
   latch = {};
   io = {};
   mode7 = {};
@@ -153,6 +169,7 @@ auto PPU::power(bool reset) -> void {
   }
   
   updateVideoMode();
+  renderer.power();
 
   string title;
   for(u32 index : range(21)) {
@@ -1,76 +1,12 @@
 #define PPU PPUPerformance
 
-struct PPU : PPUBase::Implementation, PPUcounter {
-  Node::Object node;
-  Node::Setting::Natural vramSize;
-  Node::Setting::Boolean deepBlackBoost;
-
-  struct Debugger {
-    PPU& self;
-
-    //debugger.cpp
-    auto load(Node::Object) -> void;
-    auto unload(Node::Object) -> void;
-
-    struct Memory {
-      Node::Debugger::Memory vram;
-      Node::Debugger::Memory oam;
-      Node::Debugger::Memory cgram;
-    } memory;
-
-    struct Graphics {
-      Node::Debugger::Graphics tiles2bpp;
-      Node::Debugger::Graphics tiles4bpp;
-      Node::Debugger::Graphics tiles8bpp;
-      Node::Debugger::Graphics tilesMode7;
-    } graphics;
-  } debugger{*this};
-
-  auto height() const -> u32 { return Region::PAL() ? 288 : 242; }
+//the state that rendering a line reads and writes. the PPU inherits it, and the threaded
+//renderer gives each of its threads a private copy instead of a whole PPU.
+struct PPUPerformanceRaster : PPUcounter {
   auto hires() const -> bool { return io.pseudoHires || io.bgMode == 5 || io.bgMode == 6; }
-  auto interlace() const -> bool { return state.interlace; }
-  auto overscan() const -> bool { return state.overscan; }
-  auto vdisp() const -> u32 { return state.vdisp; }
-
-  //ppu.cpp
-  auto load(Node::Object parent) -> void override;
-  auto unload() -> void override;
-
-  auto step(u32 clocks) -> void;
-  auto main() -> void;
-  auto map() -> void override;
-  auto power(bool reset) -> void override;
-  auto draw(u32* output) -> void;
-
-  //io.cpp
-  auto latchCounters() -> void override;
-  auto addressVRAM() const -> n16;
-  auto readVRAM() -> n16;
-  auto writeVRAM(n1 byte, n8 data) -> void;
-  auto readOAM(n10 address) -> n8;
-  auto writeOAM(n10 address, n8 data) -> void;
-  auto readCGRAM(n1 byte, n8 address) -> n8;
-  auto writeCGRAM(n8 address, n15 data) -> void;
-  auto readIO(n24 address, n8 data) -> n8;
-  auto writeIO(n24 address, n8 data) -> void;
-  auto updateVideoMode() -> void;
-
-  //color.cpp
-  auto color(n32 color) -> n64;
 
-  //serialization.cpp
-  auto serialize(serializer&) -> void override;
-
-//private:
   struct Source { enum : u32 { BG1, BG2, BG3, BG4, OBJ1, OBJ2, COL }; };
 
-  n32 renderingCycle;
-
-  struct {
-    n4 version;
-    n8 mdr;
-  } ppu1, ppu2;
-
   struct VRAM {
     auto& operator[](u32 address) { return data[address & mask]; }
     n16 data[64_KiB];
@@ -81,21 +17,6 @@ struct PPU : PPUBase::Implementation, PPUcounter {
     n1  mode;
   } vram;
 
-  struct Latches {
-    n16 vram;
-    n8  oam;
-    n8  cgram;
-    n8  bgofsPPU1;
-    n8  bgofsPPU2;
-    n8  mode7;
-    n1  counters;
-    n1  hcounter;
-    n1  vcounter;
-
-    n10 oamAddress;
-    n8  cgramAddress;
-  } latch;
-
   struct IO {
     //$2100  INIDISP
     n4  displayBrightness;
@@ -160,7 +81,7 @@ struct PPU : PPUBase::Implementation, PPUcounter {
   } mode7;
 
   struct Window {
-    PPU& self;
+    PPUPerformanceRaster& self;
     struct Layer;
     struct Color;
 
@@ -214,7 +135,7 @@ struct PPU : PPUBase::Implementation, PPUcounter {
   } window{*this};
 
   struct Mosaic {
-    PPU& self;
+    PPUPerformanceRaster& self;
 
     //mosaic.cpp
     auto enable() const -> bool;
@@ -233,9 +154,9 @@ struct PPU : PPUBase::Implementation, PPUcounter {
     struct ID { enum : u32 { BG1, BG2, BG3, BG4 }; };
     struct Mode { enum : u32 { BPP2, BPP4, BPP8, Mode7, Inactive }; };
 
-    PPU& self;
+    PPUPerformanceRaster& self;
     const u32 id;
-    Background(PPU& self, u32 id) : self(self), id(id) {}
+    Background(PPUPerformanceRaster& self, u32 id) : self(self), id(id) {}
 
     //background.cpp
     auto render() -> void;
@@ -266,7 +187,7 @@ struct PPU : PPUBase::Implementation, PPUcounter {
       n8  priority[2];
     } io;
 
-    PPU::Window::Layer window;
+    Window::Layer window;
   };
   Background bg1{*this, Background::ID::BG1};
   Background bg2{*this, Background::ID::BG2};
@@ -301,11 +222,13 @@ struct PPU : PPUBase::Implementation, PPUcounter {
   };
 
   struct Object {
-    PPU& self;
+    PPUPerformanceRaster& self;
 
     //object.cpp
     auto addressReset() -> void;
     auto setFirstSprite() -> void;
+    auto evaluate() -> void;
+    auto draw() -> void;
     auto render() -> void;
     auto power() -> void;
 
@@ -331,7 +254,7 @@ struct PPU : PPUBase::Implementation, PPUcounter {
       n8  priority[4];
     } io;
 
-    PPU::Window::Layer window;
+    Window::Layer window;
 
   //unserialized:
     struct Item {
@@ -353,7 +276,7 @@ struct PPU : PPUBase::Implementation, PPUcounter {
   } obj{*this};
 
   struct DAC {
-    PPU& self;
+    PPUPerformanceRaster& self;
     struct Pixel;
 
     //dac.cpp
@@ -383,7 +306,7 @@ struct PPU : PPUBase::Implementation, PPUcounter {
       n5 colorBlue;
     } io;
 
-    PPU::Window::Color window;
+    Window::Color window;
 
   //unserialized:
     struct Pixel {
@@ -395,6 +318,161 @@ struct PPU : PPUBase::Implementation, PPUcounter {
     bool windowAbove[448];
     bool windowBelow[448];
   } dac{*this};
+
+  //latched from the PPU state at the start of each frame
+  struct Frame {
+    n1 interlace;
+    n1 overscan;
+  } frame;
+
+  n32* output = nullptr;  //screen pixels
+};
+
+struct PPU : PPUBase::Implementation, PPUPerformanceRaster {
+  Node::Object node;
+  Node::Setting::Natural vramSize;
+  Node::Setting::Boolean deepBlackBoost;
+  Node::Setting::Boolean threadedRendering;
+
+  struct Debugger {
+    PPU& self;
+
+    //debugger.cpp
+    auto load(Node::Object) -> void;
+    auto unload(Node::Object) -> void;
+
+    struct Memory {
+      Node::Debugger::Memory vram;
+      Node::Debugger::Memory oam;
+      Node::Debugger::Memory cgram;
+    } memory;
+
+    struct Graphics {
+      Node::Debugger::Graphics tiles2bpp;
+      Node::Debugger::Graphics tiles4bpp;
+      Node::Debugger::Graphics tiles8bpp;
+      Node::Debugger::Graphics tilesMode7;
+    } graphics;
+  } debugger{*this};
+
+  auto height() const -> u32 { return Region::PAL() ? 288 : 242; }
+  auto interlace() const -> bool { return state.interlace; }
+  auto overscan() const -> bool { return state.overscan; }
+  auto vdisp() const -> u32 { return state.vdisp; }
+
+  //ppu.cpp
+  auto load(Node::Object parent) -> void override;
+  auto unload() -> void override;
+
+  auto step(u32 clocks) -> void;
+  auto main() -> void;
+  auto map() -> void override;
+  auto power(bool reset) -> void override;
+  auto draw(u32* output) -> void;
+
+  //io.cpp
+  auto latchCounters() -> void override;
+  auto addressVRAM() const -> n16;
+  auto readVRAM() -> n16;
+  auto writeVRAM(n1 byte, n8 data) -> void;
+  auto readOAM(n10 address) -> n8;
+  auto writeOAM(n10 address, n8 data) -> void;
+  auto readCGRAM(n1 byte, n8 address) -> n8;
+  auto writeCGRAM(n8 address, n15 data) -> void;
+  auto readIO(n24 address, n8 data) -> n8;
+  auto writeIO(n24 address, n8 data) -> void;
+  auto updateVideoMode() -> void;
+
+  //color.cpp
+  auto color(n32 color) -> n64;
+
+  //serialization.cpp
+  auto serialize(serializer&) -> void override;
+
+//private:
+  n32 renderingCycle;
+
+  struct {
+    n4 version;
+    n8 mdr;
+  } ppu1, ppu2;
+
+  struct Latches {
+    n16 vram;
+    n8  oam;
+    n8  cgram;
+    n8  bgofsPPU1;
+    n8  bgofsPPU2;
+    n8  mode7;
+    n1  counters;
+    n1  hcounter;
+    n1  vcounter;
+
+    n10 oamAddress;
+    n8  cgramAddress;
+  } latch;
+
+  //renders the visible lines of a frame on worker threads once the frame has completed.
+  //the emulation thread only captures the registers each line would be rendered from,
+  //plus a journal of VRAM writes, so that mid-frame raster effects are preserved.
+  struct Renderer {
+    PPU& self;
+
+    //renderer.cpp
+    auto threaded() const -> bool { return !shadows.empty(); }
+    auto capture() -> void;
+    auto write(n16 address, n16 data) -> void;
+    auto render() -> void;
+    auto power() -> void;
+    auto kill() -> void;
+
+  //private:
+    auto main(uintptr index) -> void;
+    auto renderLines(u32 index) -> void;
+
+    struct Line {
+      PPUcounter counter;
+      PPU::Frame frame;
+      PPU::IO io;
+      PPU::Mode7 mode7;
+      PPU::Window::IO window;
+      n5 mosaicSize;
+      n5 mosaicCounter;
+      struct Background {
+        PPU::Background::IO io;
+        PPU::Window::Layer window;
+      } bg[4];
+      struct Object {
+        PPU::Object::IO io;
+        PPU::Window::Layer window;
+        PPU::Object::Tile tiles[34];
+      } obj;
+      struct DAC {
+        n15 cgram[256];
+        PPU::DAC::IO io;
+        PPU::Window::Color window;
+      } dac;
+    };
+
+    struct Write {
+      u32 line;  //index of the first line that observes this write
+      n16 address;
+      n16 data;
+    };
+
+    std::vector<Line> lines;
+    std::vector<Write> writes;
+    std::vector<n16> vram;  //VRAM contents when the first line was captured
+    std::vector<std::unique_ptr<PPUPerformanceRaster>> shadows;  //one per thread, including the emulation thread
+    std::vector<nall::thread> workers;
+
+    mutex _mutex;
+    condition_variable _wake;
+    condition_variable _done;
+    u32 _generation = 0;
+    u32 _busy = 0;
+    bool _kill = false;
+  } renderer{*this};
 };
 
 extern PPU ppuPerformanceImpl;
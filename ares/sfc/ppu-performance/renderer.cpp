@@ -0,0 +1,151 @@
+auto PPU::Renderer::capture() -> void {
+  if(lines.empty()) {
+    vram.assign(self.vram.data, self.vram.data + self.vram.mask + 1);
+    writes.clear();
+  }
+
+  auto& line = lines.emplace_back();
+  line.counter = self;
+  line.frame = self.frame;
+  line.io = self.io;
+  line.mode7 = self.mode7;
+  line.window = self.window.io;
+  line.mosaicSize = self.mosaic.size;
+  line.mosaicCounter = self.mosaic.vcounter;
+  for(u32 id : range(4)) {
+    auto& bg = id == 0 ? self.bg1 : id == 1 ? self.bg2 : id == 2 ? self.bg3 : self.bg4;
+    line.bg[id].io = bg.io;
+    line.bg[id].window = bg.window;
+  }
+  line.obj.io = self.obj.io;
+  line.obj.window = self.obj.window;
+  for(u32 n : range(34)) line.obj.tiles[n] = self.obj.tiles[n];
+  for(u32 n : range(256)) line.dac.cgram[n] = self.dac.cgram[n];
+  line.dac.io = self.dac.io;
+  line.dac.window = self.dac.window;
+}
+
+inline auto PPU::Renderer::write(n16 address, n16 data) -> void {
+  //writes made before the first line of the frame is captured are already part of the VRAM copy
+  if(lines.empty()) return;
+  writes.push_back({(u32)lines.size(), address, data});
+}
+
+auto PPU::Renderer::render() -> void {
+  if(lines.empty()) return;
+
+  if(!workers.empty()) {
+    lock_guard<mutex> lock(_mutex);
+    _generation++;
+    _busy = workers.size();
+  }
+  _wake.notify_all();
+
+  renderLines(0);
+
+  if(!workers.empty()) {
+    unique_lock<mutex> lock(_mutex);
+    _done.wait(lock, [&] { return _busy == 0; });
+  }
+
+  lines.clear();
+  writes.clear();
+}
+
+auto PPU::Renderer::renderLines(u32 index) -> void {
+  //each thread renders one contiguous band of lines, starting from the VRAM copy
+  //and replaying the writes that were made before each of its lines was reached.
+  u32 first = lines.size() * (index + 0) / shadows.size();
+  u32 last  = lines.size() * (index + 1) / shadows.size();
+  if(first == last) return;
+
+  auto& ppu = *shadows[index];
+  ppu.output = self.output;
+  ppu.vram.mask = self.vram.mask;
+  memory::copy<n16>(ppu.vram.data, vram.data(), vram.size());
+
+  u32 write = 0;
+  for(u32 y = first; y < last; y++) {
+    for(; write < writes.size() && writes[write].line <= y; write++) {
+      ppu.vram.data[writes[write].address] = writes[write].data;
+    }
+
+    auto& line = lines[y];
+    (PPUcounter&)ppu = line.counter;
+    ppu.frame = line.frame;
+    ppu.io = line.io;
+    ppu.mode7 = line.mode7;
+    ppu.window.io = line.window;
+    ppu.mosaic.size = line.mosaicSize;
+    ppu.mosaic.vcounter = line.mosaicCounter;
+    for(u32 id : range(4)) {
+      auto& bg = id == 0 ? ppu.bg1 : id == 1 ? ppu.bg2 : id == 2 ? ppu.bg3 : ppu.bg4;
+      bg.io = line.bg[id].io;
+      bg.window = line.bg[id].window;
+    }
+    ppu.obj.io = line.obj.io;
+    ppu.obj.window = line.obj.window;
+    for(u32 n : range(34)) ppu.obj.tiles[n] = line.obj.tiles[n];
+    for(u32 n : range(256)) ppu.dac.cgram[n] = line.dac.cgram[n];
+    ppu.dac.io = line.dac.io;
+    ppu.dac.window = line.dac.window;
+
+    ppu.dac.prepare();
+    if(!ppu.io.displayDisable) {
+      ppu.bg1.render();
+      ppu.bg2.render();
+      ppu.bg3.render();
+      ppu.bg4.render();
+      ppu.obj.draw();
+    }
+    ppu.dac.render();
+  }
+}
+
+auto PPU::Renderer::main(uintptr index) -> void {
+  u32 generation = 0;
+  while(true) {
+    unique_lock<mutex> lock(_mutex);
+    _wake.wait(lock, [&] { return _kill || _generation != generation; });
+    if(_kill) return;
+    generation = _generation;
+    lock.unlock();
+
+    renderLines(index);
+
+    lock.lock();
+    if(--_busy == 0) _done.notify_one();
+  }
+}
+
+auto PPU::Renderer::power() -> void {
+  kill();
+  lines.clear();
+  writes.clear();
+  vram.clear();
+
+  u32 threads = min(8u, std::thread::hardware_concurrency());
+  if(!self.threadedRendering->value() || threads < 2) return;
+
+  lines.reserve(240);
+  for(u32 index : range(threads)) shadows.push_back(std::make_unique<PPUPerformanceRaster>());
+  for(u32 index : range(1, threads)) {
+    workers.push_back(nall::thread::create(std::bind_front(&PPU::Renderer::main, this), index));
+  }
+}
+
+auto PPU::Renderer::kill() -> void {
+  if(!workers.empty()) {
+    {
+      lock_guard<mutex> lock(_mutex);
+      _kill = true;
+    }
+    _wake.notify_all();
+    for(auto& worker : workers) worker.join();
+    workers.clear();
+  }
+  shadows.clear();
+  _kill = false;
+  _generation = 0;
+  _busy = 0;
+}
@@ -1,4 +1,7 @@
 auto PPU::serialize(serializer& s) -> void {
+  //finish the lines captured so far, so that loaded state does not leak into them
+  renderer.render();
+
   Thread::serialize(s);
   PPUcounter::serialize(s);
 
@@ -17,6 +20,7 @@ auto PPU::serialize(serializer& s) -> void {
   s(state.interlace);
   s(state.overscan);
   s(state.vdisp);
+  frame = {state.interlace, state.overscan};
 
   s(latch.vram);
   s(latch.oam);
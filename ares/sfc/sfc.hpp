@@ -3,6 +3,7 @@
 
 #include <ares/ares.hpp>
 #include <span>
+#include <thread>
 #include <vector>
 
 #include <component/processor/arm7tdmi/arm7tdmi.hpp>
@@ -12,6 +13,13 @@
 #include <component/processor/upd96050/upd96050.hpp>
 #include <component/processor/wdc65816/wdc65816.hpp>
 
+#if defined(ARCHITECTURE_AMD64)
+#include <nmmintrin.h>
+#elif defined(ARCHITECTURE_ARM64) && !defined(COMPILER_MICROSOFT)
+#define SSE2NEON_SUPPRESS_WARNINGS
+#include <sse2neon.h>
+#endif
+
 #if defined(CORE_GB)
   #include <gb/gb.hpp>
 #endif
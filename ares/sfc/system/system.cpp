@@ -18,7 +18,19 @@ auto load(Node::System& node, string name) -> bool {
 
 auto option(string name, string value) -> bool {
   if(name == "Pixel Accuracy") ppu.setAccurate(value.boolean());
+  if(name == "DSP Accuracy") dsp.accurate = value.boolean();
   if(name == "Deterministic Entropy") system.deterministicEntropy = value.boolean();
+  if(name == "Recompiler") {
+    if constexpr(WDC65816::Accuracy::Recompiler) {
+      cpu.recompiler.enabled = value.boolean();
+      sa1.recompiler.enabled = value.boolean();
+    }
+  }
+  if(name == "SuperFX Recompiler") {
+    if constexpr(GSU::Accuracy::Recompiler) {
+      superfx.recompiler.enabled = value.boolean();
+    }
+  }
   return true;
 }
 
@@ -133,6 +145,11 @@ auto System::power(bool reset) -> void {
   random.entropy(Random::Entropy::Low);
   if(deterministicEntropy) random.seed((n64)0);
 
+  //the S-CPU, SA-1 and SuperFX recompilers all acquire their code buffers while powering on
+  if constexpr(WDC65816::Accuracy::Recompiler || GSU::Accuracy::Recompiler) {
+    ares::Memory::FixedAllocator::get().release();
+  }
+
   cpu.power(reset);
   smp.power(reset);
   dsp.power(reset);
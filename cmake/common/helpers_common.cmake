@@ -18,6 +18,27 @@ function(add_sourcery_command target subdir)
   set_target_properties(${target}-resource PROPERTIES FOLDER "generated" PREFIX "")
 endfunction()
 
+# add_database_command: Function to compile the mia game databases into their indexed binary form
+function(add_database_command target)
+  file(GLOB database_files CONFIGURE_DEPENDS "${CMAKE_SOURCE_DIR}/mia/Database/*.bml")
+  set(outputs)
+  foreach(database_file IN LISTS database_files)
+    cmake_path(GET database_file STEM LAST_ONLY database_name)
+    set(output "${CMAKE_BINARY_DIR}/Database/${database_name}.db")
+    add_custom_command(
+      OUTPUT "${output}"
+      COMMAND "${CMAKE_COMMAND}" -E make_directory "${CMAKE_BINARY_DIR}/Database"
+      COMMAND bml2db "${database_file}" "${output}"
+      DEPENDS "${database_file}" bml2db
+      VERBATIM
+    )
+    list(APPEND outputs "${output}")
+  endforeach()
+  add_custom_target(${target}-database DEPENDS ${outputs})
+  add_dependencies(${target} ${target}-database)
+  set_target_properties(${target}-database PROPERTIES FOLDER "generated" PREFIX "")
+endfunction()
+
 # message_configuration: Function to print configuration outcome
 function(message_configuration)
   include(FeatureSummary)
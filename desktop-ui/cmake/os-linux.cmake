@@ -34,11 +34,12 @@ add_custom_command(
   COMMAND "${CMAKE_COMMAND}" -E make_directory "${ARES_BUILD_OUTPUT_DIR}/${ARES_INSTALL_DATA_DESTINATION}/Database"
   COMMAND
     cp -R "${CMAKE_SOURCE_DIR}/mia/Database/." "${ARES_BUILD_OUTPUT_DIR}/${ARES_INSTALL_DATA_DESTINATION}/Database/"
+  COMMAND cp -R "${CMAKE_BINARY_DIR}/Database/." "${ARES_BUILD_OUTPUT_DIR}/${ARES_INSTALL_DATA_DESTINATION}/Database/"
   COMMENT "Copying mia database to staging directory"
 )
 
 install(
-  DIRECTORY "${CMAKE_SOURCE_DIR}/mia/Database/"
+  DIRECTORY "${CMAKE_SOURCE_DIR}/mia/Database/" "${CMAKE_BINARY_DIR}/Database/"
   DESTINATION "${ARES_INSTALL_DATA_DESTINATION}/Database"
   USE_SOURCE_PERMISSIONS
   COMPONENT desktop-ui
@@ -62,6 +62,17 @@ function(target_install_database target)
       set_property(SOURCE "${data_file}" PROPERTY MACOSX_PACKAGE_LOCATION "Resources/Database/${relative_path}")
       source_group("Resources/Database/${relative_path}" FILES "${data_file}")
     endforeach()
+
+    # compiled indices produced by add_database_command
+    file(GLOB database_files "${CMAKE_SOURCE_DIR}/mia/Database/*.bml")
+    foreach(database_file IN LISTS database_files)
+      cmake_path(GET database_file STEM LAST_ONLY database_name)
+      set(compiled_file "${CMAKE_BINARY_DIR}/Database/${database_name}.db")
+      set_source_files_properties("${compiled_file}" PROPERTIES GENERATED TRUE)
+      target_sources(${target} PRIVATE "${compiled_file}")
+      set_property(SOURCE "${compiled_file}" PROPERTY MACOSX_PACKAGE_LOCATION "Resources/Database")
+      source_group("Resources/Database" FILES "${compiled_file}")
+    endforeach()
   endif()
 endfunction()
 
@@ -32,6 +32,9 @@ if(EXISTS "${CMAKE_SOURCE_DIR}/mia/Database")
     COMMAND
       "${CMAKE_COMMAND}" -E copy_directory "${CMAKE_SOURCE_DIR}/mia/Database/"
       "${ARES_EXECUTABLE_DESTINATION}/desktop-ui/rundir/Database/"
+    COMMAND
+      "${CMAKE_COMMAND}" -E copy_directory "${CMAKE_BINARY_DIR}/Database/"
+      "${ARES_EXECUTABLE_DESTINATION}/desktop-ui/rundir/Database/"
     COMMENT "Copying mia database to rundir"
   )
 endif()
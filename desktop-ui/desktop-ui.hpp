@@ -10,6 +10,8 @@ using namespace hiro;
 #include <mia/mia.hpp>
 
 #include <nall/instance.hpp>
+#include <nall/decode/lz4.hpp>
+#include <nall/encode/lz4.hpp>
 #include <nall/encode/png.hpp>
 #include <nall/encode/wav.hpp>
 #include <nall/hash/crc16.hpp>
@@ -143,6 +143,7 @@ auto Emulator::load(const string& location) -> bool {
   }
   setBoolean("Color Emulation", settings.video.colorEmulation);
   setBoolean("Deep Black Boost", settings.superFamicom.deepBlackBoost);
+  setBoolean("Threaded Rendering", settings.superFamicom.threadedRendering);
   setBoolean("Interframe Blending", settings.video.interframeBlending);
   setOverscan(settings.video.overscan);
   setColorBleed(settings.video.colorBleed);
@@ -210,6 +211,9 @@ auto Emulator::unload() -> void {
   system = {};
   root.reset();
   locationQueue.clear();
+  lock_guard<recursive_mutex> programinputLock(program.inputMutex);
+  inputBindingCount = 0;
+  inputBindingsFree.clear();
 }
 
 auto Emulator::load(mia::Pak& node, string name) -> bool {
@@ -273,50 +277,128 @@ auto Emulator::error(const string& text) -> void {
 }
 
 auto Emulator::input(ares::Node::Input::Input input) -> void {
-  //looking up inputs is very time-consuming; skip call if input was called too recently
-  //note: allow rumble to be polled at full speed to prevent missed motor events
-  if(!input->cast<ares::Node::Input::Rumble>()) {
-    auto thisPoll = chrono::millisecond();
-    if(thisPoll - input->lastPoll < 5) return;
-    input->lastPoll = thisPoll;
+  if(!input->binding || input->binding > inputBindingCount || inputBindings[input->binding - 1].node != input.get()) {
+    bindInput(input);
+    if(!input->binding) return;
+  }
+
+  auto& binding = inputBindings[input->binding - 1];
+  switch(binding.type) {
+  case InputBinding::Type::Button:
+    return static_cast<ares::Core::Input::Button&>(*input).setValue(binding.value.load(std::memory_order_relaxed));
+  case InputBinding::Type::Axis:
+  case InputBinding::Type::Pair:
+    return static_cast<ares::Core::Input::Axis&>(*input).setValue(binding.value.load(std::memory_order_relaxed));
+  case InputBinding::Type::Relative: {
+    //relative motion is consumed as it is read, so it is read here rather than sampled
+    lock_guard<recursive_mutex> programinputLock(program.inputMutex);
+    return static_cast<ares::Core::Input::Axis&>(*input).setValue(binding.input->effectiveMapping().value());
   }
+  case InputBinding::Type::Rumble: {
+    lock_guard<recursive_mutex> programinputLock(program.inputMutex);
+    if(auto target = dynamic_cast<InputRumble*>(&binding.input->effectiveMapping())) {
+      auto& rumble = static_cast<ares::Core::Input::Rumble&>(*input);
+      return target->rumble(rumble.strongValue(), rumble.weakValue());
+    }
+    return;
+  }
+  case InputBinding::Type::None:
+    return;
+  }
+}
 
+//finds the port, device and input that a node is mapped to, and assigns the node an entry in the binding table.
+//this is done once for each node, usually as the core creates it while connecting a peripheral.
+auto Emulator::bindInput(ares::Node::Input::Input input) -> void {
   lock_guard<recursive_mutex> programinputLock(program.inputMutex);
+  input->binding = 0;
+
   auto device = ares::Node::parent(input);
   if(!device) return;
 
   auto port = ares::Node::parent(device);
   if(!port) return;
-  
+
+  if(!inputBindings) inputBindings = std::make_unique<InputBinding[]>(InputBindingLimit);
+  u32 index = inputBindingCount;
+  if(!inputBindingsFree.empty()) {
+    index = inputBindingsFree.back();
+    inputBindingsFree.pop_back();
+  } else if(inputBindingCount >= InputBindingLimit) {
+    return;
+  } else {
+    inputBindingCount++;
+  }
+  auto& binding = inputBindings[index];
+  binding.node = input.get();
+  binding.type = InputBinding::Type::None;
+  binding.input = nullptr;
+  binding.pair = nullptr;
+  binding.value = 0;
+
   for(auto& inputPort : ports) {
     if(inputPort.name != port->name()) continue;
     for(auto& inputDevice : inputPort.devices) {
       if(inputDevice.name != device->name()) continue;
       for(auto& inputNode : inputDevice.inputs) {
         if(inputNode.name != input->name()) continue;
-        if(auto button = input->cast<ares::Node::Input::Button>()) {
-          auto pressed = inputNode.effectiveMapping().pressed();
-          return button->setValue(pressed);
-        }
-        if(auto axis = input->cast<ares::Node::Input::Axis>()) {
-          auto value = inputNode.effectiveMapping().value();
-          return axis->setValue(value);
-        }
-        if(auto rumble = input->cast<ares::Node::Input::Rumble>()) {
-          if(auto target = dynamic_cast<InputRumble*>(&inputNode.effectiveMapping())) {
-            return target->rumble(rumble->strongValue(), rumble->weakValue());
-          }
+        binding.input = &inputNode;
+        if(input->cast<ares::Node::Input::Button>()) binding.type = InputBinding::Type::Button;
+        if(input->cast<ares::Node::Input::Axis>()) {
+          binding.type = inputNode.type == InputNode::Type::Relative ? InputBinding::Type::Relative : InputBinding::Type::Axis;
         }
+        if(input->cast<ares::Node::Input::Rumble>()) binding.type = InputBinding::Type::Rumble;
+        break;
       }
+      if(binding.type != InputBinding::Type::None) break;
       for(auto& inputPair : inputDevice.pairs) {
         if(inputPair.name != input->name()) continue;
-        if(auto axis = input->cast<ares::Node::Input::Axis>()) {
-          auto value = inputPair.value();
-          return axis->setValue(value);
+        if(input->cast<ares::Node::Input::Axis>()) {
+          binding.pair = &inputPair;
+          binding.type = InputBinding::Type::Pair;
         }
+        break;
       }
+      if(binding.type != InputBinding::Type::None) break;
     }
+    if(binding.type != InputBinding::Type::None) break;
+  }
+
+  //unmapped nodes keep their entry as well, so they are not looked up again on every poll
+  input->binding = index + 1;
+  pollInput(binding);
+}
+
+//releases the entry of a node that the core has removed, usually as a peripheral is disconnected.
+auto Emulator::unbindInput(ares::Node::Input::Input input) -> void {
+  lock_guard<recursive_mutex> programinputLock(program.inputMutex);
+  u32 index = input->binding - 1;
+  input->binding = 0;
+  if(index >= inputBindingCount || inputBindings[index].node != input.get()) return;
+  auto& binding = inputBindings[index];
+  binding.node = nullptr;
+  binding.type = InputBinding::Type::None;
+  binding.input = nullptr;
+  binding.pair = nullptr;
+  binding.value = 0;
+  inputBindingsFree.push_back(index);
+}
+
+//samples the host inputs for every bound node; called after each poll of the host input devices.
+auto Emulator::pollInputs() -> void {
+  lock_guard<recursive_mutex> programinputLock(program.inputMutex);
+  for(u32 index : range(inputBindingCount)) pollInput(inputBindings[index]);
+}
+
+auto Emulator::pollInput(InputBinding& binding) -> void {
+  s16 value = 0;
+  switch(binding.type) {
+  case InputBinding::Type::Button: value = binding.input->effectiveMapping().pressed(); break;
+  case InputBinding::Type::Axis: value = binding.input->effectiveMapping().value(); break;
+  case InputBinding::Type::Pair: value = binding.pair->value(); break;
+  default: return;
   }
+  binding.value.store(value, std::memory_order_relaxed);
 }
 
 auto Emulator::inputKeyboard(string name) -> bool {
@@ -28,6 +28,9 @@ struct Emulator {
   auto save(mia::Pak& node, string name) -> bool;
   virtual auto input(ares::Node::Input::Input) -> void;
   auto inputKeyboard(string name) -> bool;
+  auto bindInput(ares::Node::Input::Input) -> void;
+  auto unbindInput(ares::Node::Input::Input) -> void;
+  auto pollInputs() -> void;
   auto handleLoadResult(LoadResult result) -> void;
   virtual auto load(Menu) -> void {}
   virtual auto load() -> LoadResult = 0;
@@ -58,6 +61,23 @@ struct Emulator {
   std::shared_ptr<mia::Pak> gamepad;
   std::shared_ptr<mia::Pak> gb;
   std::vector<InputPort> ports;
+
+  //resolved port/device/input mapping for each input node the core has created.
+  //nodes refer to their entry by index, and pollInputs() samples the host inputs into it,
+  //so that reading a button or axis from the emulator thread is a single atomic load.
+  struct InputBinding {
+    enum class Type : u32 { None, Button, Axis, Relative, Pair, Rumble };
+    const ares::Core::Input::Input* node = nullptr;
+    Type type = Type::None;
+    InputNode* input = nullptr;
+    InputPair* pair = nullptr;
+    atomic<s16> value = 0;
+  };
+  static constexpr u32 InputBindingLimit = 2048;
+  std::unique_ptr<InputBinding[]> inputBindings;
+  u32 inputBindingCount = 0;
+  std::vector<u32> inputBindingsFree;  //entries released by disconnected peripherals, reused first
+  auto pollInput(InputBinding&) -> void;
   std::vector<string> inputBlacklist;
   std::vector<string> portBlacklist;
 
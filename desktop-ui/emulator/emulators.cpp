@@ -39,6 +39,7 @@ namespace ares::Atari5200 {
 #ifdef CORE_GB
   namespace ares::GameBoy {
     auto load(Node::System& node, string name) -> bool;
+    auto option(string name, string value) -> bool;
   }
   #include "game-boy.cpp"
   #include "game-boy-color.cpp"
@@ -38,6 +38,8 @@ auto GameBoyColor::load() -> LoadResult {
   result = system->load();
   if(result != successful) return result;
 
+  ares::GameBoy::option("Lazy APU", settings.gameBoy.lazyAPU);
+
   if(!ares::GameBoy::load(root, "[Nintendo] Game Boy Color")) return otherError;
 
   if(auto port = root->find<ares::Node::Port>("Cartridge Slot")) {
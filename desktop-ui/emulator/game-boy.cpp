@@ -39,6 +39,8 @@ auto GameBoy::load() -> LoadResult {
   result = system->load();
   if(result != successful) return result;
 
+  ares::GameBoy::option("Lazy APU", settings.gameBoy.lazyAPU);
+
   if(!ares::GameBoy::load(root, "[Nintendo] Game Boy")) return otherError;
 
   if(auto port = root->find<ares::Node::Port>("Cartridge Slot")) {
@@ -121,7 +121,13 @@ auto SuperFamicom::load() -> LoadResult {
   if(result != successful) return result;
 
   ares::SuperFamicom::option("Pixel Accuracy", settings.video.pixelAccuracy);
+  ares::SuperFamicom::option("DSP Accuracy", settings.superFamicom.dspAccuracy);
   ares::SuperFamicom::option("Deterministic Entropy", settings.developer.deterministicEntropy);
+  ares::SuperFamicom::option("Recompiler", settings.superFamicom.recompiler && !settings.developer.forceInterpreter);
+  ares::SuperFamicom::option("SuperFX Recompiler", settings.superFamicom.superFXRecompiler && !settings.developer.forceInterpreter);
+  #if defined(CORE_GB)
+  ares::GameBoy::option("Lazy APU", settings.gameBoy.lazyAPU);
+  #endif
 
   auto region = Emulator::region();
   if(!ares::SuperFamicom::load(root, {"[Nintendo] Super Famicom (", region, ")"})) return otherError;
@@ -680,6 +680,7 @@ auto InputManager::poll(bool force) -> void {
       hotkeySettings.refresh();
     }
   }
+  if(emulator) emulator->pollInputs();
 }
 
 auto InputManager::eventInput(std::shared_ptr<HID::Device> device, u32 groupID, u32 inputID, s16 oldValue, s16 newValue) -> void {
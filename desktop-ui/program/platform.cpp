@@ -7,6 +7,10 @@ auto Program::attach(ares::Node::Object node) -> void {
     streams = emulator->root->find<ares::Node::Audio::Stream>();
     stream->setResamplerFrequency(ruby::audio.frequency());
   }
+
+  if(auto input = node->cast<ares::Node::Input::Input>()) {
+    emulator->bindInput(input);
+  }
 }
 
 auto Program::detach(ares::Node::Object node) -> void {
@@ -20,6 +24,10 @@ auto Program::detach(ares::Node::Object node) -> void {
     std::erase(streams, stream);
     stream->setResamplerFrequency(ruby::audio.frequency());
   }
+
+  if(auto input = node->cast<ares::Node::Input::Input>()) {
+    emulator->unbindInput(input);
+  }
 }
 
 auto Program::pak(ares::Node::Object node) -> std::shared_ptr<vfs::directory> {
@@ -197,40 +205,44 @@ auto Program::refreshRateHint(double refreshRate) -> void {
 auto Program::audio(ares::Node::Audio::Stream node) -> void {
   if(streams.empty()) return;
 
-  //process all pending frames (there may be more than one waiting)
-  while(true) {
-    //only process a frame if all streams have at least one pending frame
-    for(auto& stream : streams) {
-      if(!stream->pending()) return;
-    }
-
-    //mix all frames together
-    f64 samples[2] = {0.0, 0.0};
-    for(auto& stream : streams) {
-      f64 buffer[2];
-      u32 channels = stream->read(buffer);
-      if(channels == 1) {
-        //monaural -> stereo mixing
-        samples[0] += buffer[0];
-        samples[1] += buffer[0];
-      } else {
-        samples[0] += buffer[0];
-        samples[1] += buffer[1];
+  //process every frame that all streams have pending (there will usually be a batch waiting)
+  u32 frames = ~0u;
+  for(auto& stream : streams) frames = min(frames, stream->buffered());
+  if(frames == 0) return;
+
+  //mix all frames together
+  audioMix.assign(frames * 2, 0.0);
+  for(auto& stream : streams) {
+    audioStream.resize(frames * stream->channels());
+    u32 channels = stream->read(audioStream.data(), frames);
+    const f64* input = audioStream.data();
+    f64* output = audioMix.data();
+    if(channels == 1) {
+      //monaural -> stereo mixing
+      for(u32 n : range(frames)) {
+        output[n * 2 + 0] += input[n];
+        output[n * 2 + 1] += input[n];
+      }
+    } else {
+      for(u32 n : range(frames)) {
+        output[n * 2 + 0] += input[n * channels + 0];
+        output[n * 2 + 1] += input[n * channels + 1];
       }
     }
+  }
 
-    //apply volume, balance, and clamping to the output frame
-    f64 volume = !settings.audio.mute ? settings.audio.volume : 0.0;
-    f64 balance = settings.audio.balance;
-    for(u32 c : range(2)) {
-      samples[c] = max(-1.0, min(+1.0, samples[c] * volume));
-      if(balance < 0.0) samples[1] *= 1.0 + balance;
-      if(balance > 0.0) samples[0] *= 1.0 - balance;
-    }
-
-    //send frame to the audio output device
-    ruby::audio.output(samples);
+  //apply volume, clamping, and balance to the output frames
+  f64 volume = !settings.audio.mute ? settings.audio.volume : 0.0;
+  f64 balance = settings.audio.balance;
+  f64 gain[2] = {balance > 0.0 ? 1.0 - balance : 1.0, balance < 0.0 ? 1.0 + balance : 1.0};
+  f64* output = audioMix.data();
+  for(u32 n : range(frames)) {
+    output[n * 2 + 0] = max(-1.0, min(+1.0, output[n * 2 + 0] * volume)) * gain[0];
+    output[n * 2 + 1] = max(-1.0, min(+1.0, output[n * 2 + 1] * volume)) * gain[1];
   }
+
+  //send frames to the audio output device
+  ruby::audio.output(audioMix.data(), frames);
 }
 
 auto Program::input(ares::Node::Input::Input node) -> void {
@@ -250,3 +262,7 @@ auto Program::input(ares::Node::Input::Input node) -> void {
 auto Program::cheat(u32 address) -> maybe<u32> {
   return cheatEditor.find(address);
 }
+
+auto Program::cheats() -> bool {
+  return cheatEditor.active;
+}
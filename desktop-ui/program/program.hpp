@@ -15,6 +15,7 @@ struct Program : ares::Platform {
   auto audio(ares::Node::Audio::Stream) -> void override;
   auto input(ares::Node::Input::Input) -> void override;
   auto cheat(u32 address) -> maybe<u32> override;
+  auto cheats() -> bool override;
 
   //load.cpp
   auto identify(const string& filename) -> std::shared_ptr<Emulator>;
@@ -28,6 +29,9 @@ struct Program : ares::Platform {
   auto undoStateSave() -> bool;
   auto undoStateLoad() -> bool;
   auto clearUndoStates() -> void;
+  auto stateWrite(const string& location, const serializer& state) -> bool;
+  auto stateRead(const string& location) -> std::vector<u8>;
+  auto stateWait() -> void;
 
   //status.cpp
   auto updateMessage() -> void;
@@ -75,6 +79,8 @@ struct Program : ares::Platform {
 
   std::vector<ares::Node::Video::Screen> screens;
   std::vector<ares::Node::Audio::Stream> streams;
+  std::vector<f64> audioMix;     //interleaved stereo frames mixed from all streams
+  std::vector<f64> audioStream;  //frames read from one stream
 
   bool paused = false;
   bool fastForwarding = false;
@@ -88,6 +94,7 @@ struct Program : ares::Platform {
   struct State {
     u32 slot = 1;
     u32 undoSlot = 1;
+    thread writer;  //compresses and writes the most recent snapshot
   } state;
 
   //rewind.cpp
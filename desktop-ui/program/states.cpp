@@ -1,22 +1,143 @@
+//save states are stored as a small container of independently compressed LZ4 chunks,
+//so that both compression and decompression can be spread across all hardware threads:
+//  header: signature, uncompressed size, chunk size, chunk count
+//  table: compressed size of each chunk; the top bit marks a chunk that was stored uncompressed
+//  chunks, in order
+//states written before this container existed are raw serializer data, and still load as-is.
+namespace StateFile {
+  static constexpr char Signature[8] = {'a', 'r', 'e', 's', 'l', 'z', '4', 's'};
+  static constexpr u32 ChunkSize = 1_MiB;
+  static constexpr u32 Stored = 1u << 31;
+
+  struct Header {
+    char signature[8];
+    u64 size;
+    u32 chunkSize;
+    u32 chunks;
+  };
+
+  //runs task(0) .. task(count - 1), spread across the available hardware threads.
+  static auto parallel(u32 count, const std::function<void (u32)>& task) -> void {
+    atomic<u32> next = 0;
+    auto worker = [&](uintptr) {
+      for(u32 index = next++; index < count; index = next++) task(index);
+    };
+    u32 workers = min<u32>(max(1u, std::thread::hardware_concurrency()), count);
+    std::vector<thread> threads;
+    for(u32 n = 1; n < workers; n++) threads.push_back(thread::create(worker));
+    worker(0);
+    for(auto& thread : threads) thread.join();
+  }
+
+  static auto compress(std::span<const u8> input) -> std::vector<u8> {
+    Header header{};
+    memory::copy(header.signature, Signature, sizeof(Signature));
+    header.size = input.size();
+    header.chunkSize = ChunkSize;
+    header.chunks = (input.size() + ChunkSize - 1) / ChunkSize;
+
+    std::vector<std::vector<u8>> chunks(header.chunks);
+    parallel(header.chunks, [&](u32 index) {
+      auto chunk = input.subspan((u64)index * ChunkSize, min<u64>(ChunkSize, input.size() - (u64)index * ChunkSize));
+      chunks[index] = Encode::LZ4(chunk);
+      if(chunks[index].size() >= chunk.size()) chunks[index].assign(chunk.begin(), chunk.end());
+    });
+
+    std::vector<u8> output;
+    auto append = [&](const void* data, u64 size) {
+      auto p = (const u8*)data;
+      output.insert(output.end(), p, p + size);
+    };
+    append(&header, sizeof(Header));
+    for(u32 index : range(header.chunks)) {
+      u64 offset = (u64)index * ChunkSize;
+      u32 size = chunks[index].size();
+      if(size == min<u64>(ChunkSize, input.size() - offset)) size |= Stored;
+      append(&size, sizeof(u32));
+    }
+    for(auto& chunk : chunks) append(chunk.data(), chunk.size());
+    return output;
+  }
+
+  //returns raw serializer data: decompressed from the container, or the input itself if it is not one.
+  static auto decompress(std::vector<u8> input) -> std::vector<u8> {
+    if(input.size() < sizeof(Header)) return input;
+    Header header;
+    memory::copy(&header, input.data(), sizeof(Header));
+    if(memory::compare(header.signature, Signature, sizeof(Signature))) return input;
+    if(!header.chunkSize || header.chunks != (header.size + header.chunkSize - 1) / header.chunkSize) return {};
+
+    u64 tableOffset = sizeof(Header);
+    u64 dataOffset = tableOffset + (u64)header.chunks * sizeof(u32);
+    if(input.size() < dataOffset) return {};
+    std::vector<u64> offsets(header.chunks);
+    for(u32 index : range(header.chunks)) {
+      u32 size;
+      memory::copy(&size, input.data() + tableOffset + index * sizeof(u32), sizeof(u32));
+      offsets[index] = dataOffset;
+      dataOffset += size & ~Stored;
+    }
+    if(input.size() != dataOffset) return {};
+
+    std::vector<u8> output(header.size);
+    atomic<bool> failed = false;
+    parallel(header.chunks, [&](u32 index) {
+      u32 size;
+      memory::copy(&size, input.data() + tableOffset + index * sizeof(u32), sizeof(u32));
+      std::span<const u8> chunk{input.data() + offsets[index], size & ~Stored};
+      u64 offset = (u64)index * header.chunkSize;
+      std::span<u8> target{output.data() + offset, min<u64>(header.chunkSize, header.size - offset)};
+      if(size & Stored) {
+        if(chunk.size() == target.size()) return (void)memcpy(target.data(), chunk.data(), chunk.size());
+        failed = true;
+      } else if(!Decode::LZ4(chunk, target)) {
+        failed = true;
+      }
+    });
+    if(failed) return {};
+    return output;
+  }
+}
+
+auto Program::stateWrite(const string& location, const serializer& state) -> bool {
+  auto memory = StateFile::compress({state.data(), state.size()});
+  return file::write(location, {memory.data(), memory.size()});
+}
+
+auto Program::stateRead(const string& location) -> std::vector<u8> {
+  return StateFile::decompress(file::read(location));
+}
+
+//waits for the background writer, so that state files are complete before they are read, moved or removed.
+auto Program::stateWait() -> void {
+  state.writer.join();
+}
+
 auto Program::stateSave(u32 slot) -> bool {
   Program::Guard guard;
   if(!emulator) return false;
 
   auto location = emulator->locate(emulator->game->location, {".bs", slot}, settings.paths.saves);
   string undoLocation = {location.slice(0, (location.size() - 1)), "u"};
-  if(file::move(location, undoLocation)) {
-    state.undoSlot = slot;
+
+  auto snapshot = std::make_shared<serializer>(emulator->root->serialize());
+  if(!snapshot->size()) {
+    showMessage({"Failed to save state to slot ", slot});
+    return false;
   }
 
-  if(auto state = emulator->root->serialize()) {
-    if(file::write(location, {state.data(), state.size()})) {
+  //only the snapshot is taken on the emulation thread; compression and file I/O happen in the background.
+  stateWait();
+  if(file::exists(location)) state.undoSlot = slot;
+  state.writer = thread::create([=, this](uintptr) {
+    file::move(location, undoLocation);
+    if(stateWrite(location, *snapshot)) {
       showMessage({"Saved state to slot ", slot});
-      return true;
+    } else {
+      showMessage({"Failed to save state to slot ", slot});
     }
-  }
-
-  showMessage({"Failed to save state to slot ", slot});
-  return false;
+  });
+  return true;
 }
 
 auto Program::stateLoad(u32 slot) -> bool {
@@ -24,13 +145,17 @@ auto Program::stateLoad(u32 slot) -> bool {
   if(!emulator) return false;
 
   //Store current state for undo
+  stateWait();
   auto undoLocation = emulator->locate(emulator->game->location, {".blu"}, settings.paths.saves);
-  if(auto state = emulator->root->serialize()) {
-    file::write(undoLocation, {state.data(), state.size()});
+  auto snapshot = std::make_shared<serializer>(emulator->root->serialize());
+  if(snapshot->size()) {
+    state.writer = thread::create([=, this](uintptr) {
+      stateWrite(undoLocation, *snapshot);
+    });
   }
 
   auto location = emulator->locate(emulator->game->location, {".bs", slot}, settings.paths.saves);
-  auto memory = file::read(location);
+  auto memory = stateRead(location);
   if(!memory.empty()) {
     serializer state{memory.data(), (u32)memory.size()};
     if(emulator->root->unserialize(state)) {
@@ -47,6 +172,7 @@ auto Program::undoStateSave() -> bool {
   Program::Guard guard;
   if(!emulator) return false;
 
+  stateWait();
   auto undoLocation = emulator->locate(emulator->game->location, ".bsu", settings.paths.saves);
   string location = {undoLocation.slice(0, (undoLocation.size() - 1)), state.undoSlot};
   if(file::move(undoLocation, location)) {
@@ -62,8 +188,9 @@ auto Program::undoStateLoad() -> bool {
   Program::Guard guard;
   if(!emulator) return false;
 
+  stateWait();
   auto undoLocation = emulator->locate(emulator->game->location, ".blu", settings.paths.saves);
-  auto memory = file::read(undoLocation);
+  auto memory = stateRead(undoLocation);
   if(!memory.empty()) {
     serializer state{memory.data(), (u32)memory.size()};
     if(emulator->root->unserialize(state)) {
@@ -84,6 +211,7 @@ auto Program::clearUndoStates() -> void {
   Program::Guard guard;
   if(!emulator) return;
 
+  stateWait();
   auto location = emulator->locate(emulator->game->location, ".blu", settings.paths.saves);
   file::remove(location);
 
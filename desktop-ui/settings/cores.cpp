@@ -50,6 +50,12 @@ auto CoreSettings::construct() -> void {
     nintendo64ControllerPakBankLabel.setText("Controller Pak Size:");
     nintendo64ControllerPakBankHint.setText("Sets the size of a newly created Controller Pak's available memory").setFont(Font().setSize(7.0)).setForegroundColor(SystemColor::Sublabel);
 
+  nintendo64ThreadedRSPOption.setText("Threaded RSP").setChecked(settings.nintendo64.threadedRSP).onToggle([&] {
+    settings.nintendo64.threadedRSP = nintendo64ThreadedRSPOption.checked();
+  });
+  nintendo64ThreadedRSPLayout.setAlignment(1).setPadding(12_sx, 0);
+    nintendo64ThreadedRSPHint.setText("Runs RSP tasks on a separate host thread; uses one more CPU core").setFont(Font().setSize(7.0)).setForegroundColor(SystemColor::Sublabel);
+
     renderQualityLayout.setPadding(12_sx, 0);
 
   disableVideoInterfaceProcessingOption.setText("Disable Video Interface Processing").setChecked(settings.nintendo64.disableVideoInterfaceProcessing).onToggle([&] {
@@ -111,6 +117,13 @@ auto CoreSettings::construct() -> void {
   weaveDeinterlacingLayout.setCollapsible(true).setVisible(false);
   #endif
 
+  gameBoySettingsLabel.setText("Game Boy Settings").setFont(Font().setBold());
+  gameBoyLazyAPUOption.setText("Lazy APU").setChecked(settings.gameBoy.lazyAPU).onToggle([&] {
+    settings.gameBoy.lazyAPU = gameBoyLazyAPUOption.checked();
+  });
+  gameBoyLazyAPULayout.setAlignment(1).setPadding(12_sx, 0);
+    gameBoyLazyAPUHint.setText("Runs the APU only when it is accessed, with band-limited audio; faster, also used by the Super Game Boy").setFont(Font().setSize(7.0)).setForegroundColor(SystemColor::Sublabel);
+
   gameBoyAdvanceSettingsLabel.setText("Game Boy Advance Settings").setFont(Font().setBold());
   gameBoyPlayerOption.setText("Game Boy Player").setChecked(settings.gameBoyAdvance.player).onToggle([&] {
     settings.gameBoyAdvance.player = gameBoyPlayerOption.checked();
@@ -126,6 +139,26 @@ auto CoreSettings::construct() -> void {
   });
   superFamicomDeepBlackBoostLayout.setAlignment(1).setPadding(12_sx, 0);
   superFamicomDeepBlackBoostHint.setText("Applies a gamma ramp to crush black levels").setFont(Font().setSize(7.0)).setForegroundColor(SystemColor::Sublabel);
+  superFamicomThreadedRenderingOption.setText("Threaded Rendering").setChecked(settings.superFamicom.threadedRendering).onToggle([&] {
+    settings.superFamicom.threadedRendering = superFamicomThreadedRenderingOption.checked();
+  });
+  superFamicomThreadedRenderingLayout.setAlignment(1).setPadding(12_sx, 0);
+  superFamicomThreadedRenderingHint.setText("Renders each frame on several host threads; not used with Pixel Accuracy").setFont(Font().setSize(7.0)).setForegroundColor(SystemColor::Sublabel);
+  superFamicomDSPAccuracyOption.setText("DSP Accuracy").setChecked(settings.superFamicom.dspAccuracy).onToggle([&] {
+    settings.superFamicom.dspAccuracy = superFamicomDSPAccuracyOption.checked();
+  });
+  superFamicomDSPAccuracyLayout.setAlignment(1).setPadding(12_sx, 0);
+  superFamicomDSPAccuracyHint.setText("Synchronizes the DSP with the SMP every clock; disable to run a whole sample at a time").setFont(Font().setSize(7.0)).setForegroundColor(SystemColor::Sublabel);
+  superFamicomRecompilerOption.setText("CPU Recompiler").setChecked(settings.superFamicom.recompiler).onToggle([&] {
+    settings.superFamicom.recompiler = superFamicomRecompilerOption.checked();
+  });
+  superFamicomRecompilerLayout.setAlignment(1).setPadding(12_sx, 0);
+  superFamicomRecompilerHint.setText("Compiles S-CPU and SA-1 code; interrupts and HDMA are only taken between blocks; experimental").setFont(Font().setSize(7.0)).setForegroundColor(SystemColor::Sublabel);
+  superFamicomSuperFXRecompilerOption.setText("SuperFX Recompiler").setChecked(settings.superFamicom.superFXRecompiler).onToggle([&] {
+    settings.superFamicom.superFXRecompiler = superFamicomSuperFXRecompilerOption.checked();
+  });
+  superFamicomSuperFXRecompilerLayout.setAlignment(1).setPadding(12_sx, 0);
+  superFamicomSuperFXRecompilerHint.setText("Compiles SuperFX code running from its instruction cache; experimental").setFont(Font().setSize(7.0)).setForegroundColor(SystemColor::Sublabel);
 
   megaDriveSettingsLabel.setText("Mega Drive Settings").setFont(Font().setBold());
   megaDriveTmssOption.setText("TMSS Boot Rom").setChecked(settings.megadrive.tmss).onToggle([&] {
@@ -117,20 +117,27 @@ auto FirmwareSettings::findFirmware(string hash) -> string {
   auto firmwarePath = settings.paths.firmware ? settings.paths.firmware : locate("Firmware/");
   if(!directory::exists(firmwarePath)) return {};
 
+  std::vector<string> locations;
   for(auto& filename : directory::files(firmwarePath)) {
     auto location = string{firmwarePath, filename};
 
     if(auto result = fileHashes.find(location)) {
       if(!file::exists(location)) continue;  //file was removed from disk (or moved)
       if(*result == hash) return location;
+      continue;
     }
 
     if(file::size(location) >= 10_MiB) continue; //avoid stalling by hashing overly large files
-    auto digest = Hash::SHA256(file::read(location)).digest();
-    fileHashes.insert(location, digest);
-    if(digest != hash) continue;
-    return location;
+    locations.push_back(location);
   }
 
-  return {};
+  //hash every unknown file at once; later lookups are then answered from the cache
+  auto digests = Hash::batch<Hash::SHA256>(locations, 10_MiB);
+  string found;
+  for(u32 index : range(locations.size())) {
+    if(!digests[index]) continue;
+    fileHashes.insert(locations[index], digests[index]);
+    if(!found && digests[index] == hash) found = locations[index];
+  }
+  return found;
 }
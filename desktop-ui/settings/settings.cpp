@@ -127,15 +127,21 @@ auto Settings::process(bool load) -> void {
   bind(boolean, "Developer/ForceInterpreter", developer.forceInterpreter);
 
   bind(boolean, "Nintendo64/ExpansionPak", nintendo64.expansionPak);
+  bind(boolean, "Nintendo64/ThreadedRSP", nintendo64.threadedRSP);
   bind(string,  "Nintendo64/ControllerPakBankString", nintendo64.controllerPakBankString);
   bind(string,  "Nintendo64/Quality", nintendo64.quality);
   bind(boolean, "Nintendo64/Supersampling", nintendo64.supersampling);
   bind(boolean, "Nintendo64/DisableVideoInterfaceProcessing", nintendo64.disableVideoInterfaceProcessing);
   bind(boolean, "Nintendo64/WeaveDeinterlacing", nintendo64.weaveDeinterlacing);
 
+  bind(boolean, "GameBoy/LazyAPU", gameBoy.lazyAPU);
   bind(boolean, "GameBoyAdvance/Player", gameBoyAdvance.player);
 
   bind(boolean, "SuperFamicom/DeepBlackBoost", superFamicom.deepBlackBoost);
+  bind(boolean, "SuperFamicom/ThreadedRendering", superFamicom.threadedRendering);
+  bind(boolean, "SuperFamicom/DSPAccuracy", superFamicom.dspAccuracy);
+  bind(boolean, "SuperFamicom/Recompiler", superFamicom.recompiler);
+  bind(boolean, "SuperFamicom/SuperFXRecompiler", superFamicom.superFXRecompiler);
 
   bind(boolean, "MegaDrive/TMSS", megadrive.tmss);
 
@@ -113,6 +113,7 @@ struct Settings : Markup::Node {
 
   struct Nintendo64 {
     bool expansionPak = true;
+    bool threadedRSP = false;
     u8 controllerPakBankCount = 1;
     string controllerPakBankString = "32KiB (Default)";
     string quality = "SD";
@@ -121,12 +122,20 @@ struct Settings : Markup::Node {
     bool weaveDeinterlacing = true;
   } nintendo64;
 
+  struct GameBoy {
+    bool lazyAPU = false;
+  } gameBoy;
+
   struct GameBoyAdvance {
     bool player = false;
   } gameBoyAdvance;
 
   struct SuperFamicom {
     bool deepBlackBoost = false;
+    bool threadedRendering = true;
+    bool dspAccuracy = true;
+    bool recompiler = false;
+    bool superFXRecompiler = false;
   } superFamicom;
 
   struct MegaDrive {
@@ -394,6 +403,9 @@ struct CoreSettings : VerticalLayout {
       Label nintendo64ControllerPakBankLabel{&nintendo64ControllerPakBankLayout, Size{0, layoutVertSize}};
       ComboButton nintendo64ControllerPakBankOption{&nintendo64ControllerPakBankLayout, Size{0, 0}};
       Label nintendo64ControllerPakBankHint{&nintendo64ControllerPakBankLayout, Size{0, layoutVertSize}};
+    HorizontalLayout nintendo64ThreadedRSPLayout{this, Size{~0, 0}, 5};
+      CheckLabel nintendo64ThreadedRSPOption{&nintendo64ThreadedRSPLayout, Size{0, 0}, 5};
+      Label nintendo64ThreadedRSPHint{&nintendo64ThreadedRSPLayout, Size{0, layoutVertSize}};
     HorizontalLayout disableVideoInterfaceProcessingLayout{this, Size{~0, 0}, 5};
       CheckLabel disableVideoInterfaceProcessingOption{&disableVideoInterfaceProcessingLayout, Size{0, 0}, 5};
       Label disableVideoInterfaceProcessingHint{&disableVideoInterfaceProcessingLayout, Size{0, layoutVertSize}};
@@ -409,6 +421,11 @@ struct CoreSettings : VerticalLayout {
       CheckLabel renderSupersamplingOption{&renderSupersamplingLayout, Size{0, 0}, 5};
       Label renderSupersamplingHint{&renderSupersamplingLayout, Size{0, layoutVertSize}};
 
+  Label gameBoySettingsLabel{this, Size{~0, 0}, 5};
+    HorizontalLayout gameBoyLazyAPULayout{this, Size{~0, 0}, 5};
+      CheckLabel gameBoyLazyAPUOption{&gameBoyLazyAPULayout, Size{0, 0}, 5};
+      Label gameBoyLazyAPUHint{&gameBoyLazyAPULayout, Size{0, layoutVertSize}};
+
   Label gameBoyAdvanceSettingsLabel{this, Size{~0, 0}, 5};
     HorizontalLayout gameBoyPlayerLayout{this, Size{~0, 0}, 5};
       CheckLabel gameBoyPlayerOption{&gameBoyPlayerLayout, Size{0, 0}, 5};
@@ -418,6 +435,18 @@ struct CoreSettings : VerticalLayout {
     HorizontalLayout superFamicomDeepBlackBoostLayout{this, Size{~0, 0}, 5};
       CheckLabel superFamicomDeepBlackBoostOption{&superFamicomDeepBlackBoostLayout, Size{0, 0}, 5};
       Label superFamicomDeepBlackBoostHint{&superFamicomDeepBlackBoostLayout, Size{0, layoutVertSize}};
+    HorizontalLayout superFamicomThreadedRenderingLayout{this, Size{~0, 0}, 5};
+      CheckLabel superFamicomThreadedRenderingOption{&superFamicomThreadedRenderingLayout, Size{0, 0}, 5};
+      Label superFamicomThreadedRenderingHint{&superFamicomThreadedRenderingLayout, Size{0, layoutVertSize}};
+    HorizontalLayout superFamicomDSPAccuracyLayout{this, Size{~0, 0}, 5};
+      CheckLabel superFamicomDSPAccuracyOption{&superFamicomDSPAccuracyLayout, Size{0, 0}, 5};
+      Label superFamicomDSPAccuracyHint{&superFamicomDSPAccuracyLayout, Size{0, layoutVertSize}};
+    HorizontalLayout superFamicomRecompilerLayout{this, Size{~0, 0}, 5};
+      CheckLabel superFamicomRecompilerOption{&superFamicomRecompilerLayout, Size{0, 0}, 5};
+      Label superFamicomRecompilerHint{&superFamicomRecompilerLayout, Size{0, layoutVertSize}};
+    HorizontalLayout superFamicomSuperFXRecompilerLayout{this, Size{~0, 0}, 5};
+      CheckLabel superFamicomSuperFXRecompilerOption{&superFamicomSuperFXRecompilerLayout, Size{0, 0}, 5};
+      Label superFamicomSuperFXRecompilerHint{&superFamicomSuperFXRecompilerLayout, Size{0, layoutVertSize}};
 
   Label megaDriveSettingsLabel{this, Size{~0, 0}, 5};
     HorizontalLayout megaDriveTmssLayout{this, Size{~0, 0}, 5};
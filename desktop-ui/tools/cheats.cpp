@@ -59,6 +59,7 @@ auto CheatEditor::construct() -> void {
     if(auto item = cheatList.selected()) {
       if(auto cheat = item.attribute<Cheat*>("cheat")) {
         cheat->enabled = cell.checked();
+        active = std::ranges::any_of(cheats, [](auto& c) { return c.enabled; });
       }
     }
   });
@@ -116,6 +117,7 @@ auto CheatEditor::refresh() -> void {
 
   cheatList.resizeColumns();
   cheatList.column(0).setWidth(32);
+  active = std::ranges::any_of(cheats, [](auto& c) { return c.enabled; });
 }
 
 auto CheatEditor::unload() -> void {
@@ -44,6 +44,7 @@ struct CheatEditor : VerticalLayout {
 
   string location;
   std::vector<Cheat> cheats;
+  bool active = false;  //whether any cheat is enabled
 };
 
 struct MemoryEditor : VerticalLayout {
@@ -119,9 +120,22 @@ struct TraceLogger : VerticalLayout {
   auto construct() -> void;
   auto reload() -> void;
   auto unload() -> void;
+  auto binaryStart(ares::Node::Debugger::Tracer::Instruction tracer) -> void;
+  auto binaryStop(ares::Node::Debugger::Tracer::Instruction tracer) -> void;
+  auto binaryWrite(uintptr) -> void;
 
   file_buffer fp;
 
+  //binary instruction traces, drained from each tracer's ring buffer to disk by a background thread.
+  struct BinaryTrace {
+    ares::Node::Debugger::Tracer::Instruction tracer;
+    file_buffer fp;
+  };
+  std::vector<std::unique_ptr<BinaryTrace>> binaryTraces;
+  std::mutex binaryMutex;
+  thread binaryWriter;
+  atomic<bool> binaryWriting = false;
+
   Label tracerLabel{this, Size{~0, 0}, 5};
   TableView tracerList{this, Size{~0, ~0}};
   HorizontalLayout controlLayout{this, Size{~0, 0}};
@@ -14,6 +14,12 @@ auto TraceLogger::construct() -> void {
             instruction->setMask(cell.checked());
           }
         }
+        if(cell.offset() == 5) {
+          if(auto instruction = tracer->cast<ares::Node::Debugger::Tracer::Instruction>()) {
+            if(cell.checked()) binaryStart(instruction);
+            if(!cell.checked()) binaryStop(instruction);
+          }
+        }
       }
     }
   });
@@ -28,7 +34,7 @@ auto TraceLogger::reload() -> void {
   tracerList.append(TableViewColumn().setText("Log to Terminal").setAlignment(1.0));
   tracerList.append(TableViewColumn().setText("Log to File").setAlignment(1.0));
   tracerList.append(TableViewColumn().setText("Mask").setAlignment(1.0));
-
+  tracerList.append(TableViewColumn().setText("Binary Trace").setAlignment(1.0));
 
   for(auto tracer : ares::Node::enumerate<ares::Node::Debugger::Tracer::Tracer>(emulator->root)) {
     TableViewItem item{&tracerList};
@@ -39,14 +45,80 @@ auto TraceLogger::reload() -> void {
     item.append(TableViewCell().setCheckable().setChecked(tracer->file()));
     if(auto instruction = tracer->cast<ares::Node::Debugger::Tracer::Instruction>()) {
       item.append(TableViewCell().setCheckable().setChecked(instruction->mask()));
+      item.append(TableViewCell().setCheckable().setChecked(instruction->binary()));
     } else {
       item.append(TableViewCell());
+      item.append(TableViewCell());
     }
   }
 }
 
 auto TraceLogger::unload() -> void {
+  while(!binaryTraces.empty()) binaryStop(binaryTraces.back()->tracer);
   tracerList.reset();
   if(fp) fp.close();
 }
 
+auto TraceLogger::binaryStart(ares::Node::Debugger::Tracer::Instruction tracer) -> void {
+  if(tracer->binary()) return;
+  auto datetime = chrono::local::datetime().replace("-", "").replace(":", "").replace(" ", "-");
+  auto location = emulator->locate({Location::notsuffix(emulator->game->location), "-", tracer->component(), "-", datetime, ".trace"}, ".trace", settings.paths.debugging);
+  auto trace = std::make_unique<BinaryTrace>();
+  trace->tracer = tracer;
+  if(!trace->fp.open(location, file::mode::write)) {
+    return program.showMessage({"Failed to open binary trace file ", location});
+  }
+  auto header = tracer->fileHeader();
+  trace->fp.write({(const u8*)&header, sizeof(header)});
+
+  //the ring is reset before the writer thread can drain it into the new file
+  tracer->setBinary(true);
+  {
+    lock_guard<std::mutex> lock(binaryMutex);
+    binaryTraces.push_back(std::move(trace));
+  }
+  if(!binaryWriting) {
+    binaryWriting = true;
+    binaryWriter = thread::create(std::bind_front(&TraceLogger::binaryWrite, this));
+  }
+}
+
+auto TraceLogger::binaryStop(ares::Node::Debugger::Tracer::Instruction tracer) -> void {
+  //once binary mode is off, the emulation thread no longer waits for the ring to drain
+  tracer->setBinary(false);
+  bool empty = false;
+  {
+    lock_guard<std::mutex> lock(binaryMutex);
+    for(auto index : range(binaryTraces.size())) {
+      auto& trace = binaryTraces[index];
+      if(trace->tracer != tracer) continue;
+      trace->tracer->drain([&](auto records) {
+        trace->fp.write({(const u8*)records.data(), records.size_bytes()});
+      });
+      trace->fp.close();
+      binaryTraces.erase(binaryTraces.begin() + index);
+      break;
+    }
+    empty = binaryTraces.empty();
+  }
+  if(empty && binaryWriting) {
+    binaryWriting = false;
+    binaryWriter.join();
+  }
+}
+
+auto TraceLogger::binaryWrite(uintptr) -> void {
+  thread::setName("dev.ares.trace");
+  while(binaryWriting) {
+    {
+      lock_guard<std::mutex> lock(binaryMutex);
+      for(auto& trace : binaryTraces) {
+        trace->tracer->drain([&](auto records) {
+          trace->fp.write({(const u8*)records.data(), records.size_bytes()});
+        });
+      }
+    }
+    usleep(1000);
+  }
+}
+
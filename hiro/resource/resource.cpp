@@ -0,0 +1,6140 @@
+#include "resource.hpp"
+
+namespace Icon {
+namespace Action {
+const unsigned char Add1x[323] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,214,1,11,16,0,17,148,68,120,161,0,0,0,208,73,
+  68,65,84,56,203,205,145,189,14,193,96,20,134,31,210,197,96,183,114,7,210,186,129,198,96,54,91,59,116,113,7,68,
+  210,196,100,23,177,90,13,38,131,132,27,232,103,55,90,44,86,105,226,167,223,49,16,138,250,139,4,239,118,242,157,188,
+  249,158,231,192,175,147,184,247,96,57,61,31,48,143,163,242,187,21,43,110,47,249,160,220,244,92,27,207,181,137,20,189,
+  85,240,82,62,46,48,238,48,199,57,145,200,120,114,98,68,153,91,213,34,91,45,36,128,109,120,222,247,92,27,17,16,
+  57,88,175,119,198,230,205,15,0,86,235,144,249,50,64,4,180,22,180,64,176,17,194,80,216,105,65,107,200,101,82,241,
+  8,128,106,116,38,23,8,229,82,1,128,193,200,191,38,82,79,229,88,78,79,134,211,133,52,251,51,185,226,255,242,25,
+  243,217,244,107,103,140,137,170,181,79,182,21,127,155,61,84,114,75,11,139,178,119,142,0,0,0,0,73,69,78,68,174,
+  66,96,130,
+};
+const unsigned char Add2x[601] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,2,16,73,68,65,84,88,133,237,150,177,107,20,
+  65,20,198,127,187,155,187,189,72,36,4,68,43,65,176,16,20,171,88,165,20,196,63,193,66,91,67,180,17,253,15,196,
+  194,70,16,43,65,65,155,216,92,97,97,105,35,118,34,130,130,130,193,66,44,76,68,34,104,238,108,114,185,121,159,197,
+  204,237,133,77,118,207,221,139,90,120,31,12,59,188,157,247,222,247,190,153,55,187,48,193,4,19,252,99,68,85,29,230,
+  23,219,179,145,122,63,118,123,247,234,254,133,202,241,166,170,58,0,164,141,100,243,214,149,51,233,118,219,213,219,79,235,
+  132,34,174,229,21,176,178,218,97,101,181,51,78,136,241,8,236,5,246,132,128,169,190,111,173,51,144,65,32,192,100,127,
+  135,192,137,203,237,153,134,185,57,153,166,228,243,123,18,33,255,201,75,143,230,138,124,223,222,61,255,189,18,129,83,23,
+  151,119,8,27,247,183,122,14,34,226,40,145,133,242,137,178,45,216,103,172,237,22,203,153,90,20,180,124,169,2,119,174,
+  157,205,155,154,224,247,220,144,79,14,152,137,27,75,167,49,209,146,60,27,39,33,129,36,174,223,123,86,152,163,148,128,
+  51,241,225,75,151,56,242,228,205,132,9,156,249,192,78,222,246,230,211,6,206,129,19,244,157,178,117,125,39,142,28,108,
+  149,165,40,39,176,222,217,228,253,231,208,231,65,113,41,242,149,229,109,128,180,221,230,159,251,167,203,47,199,145,135,112,
+  225,216,1,20,212,48,27,86,237,76,188,254,184,129,20,113,252,240,12,38,111,51,9,115,194,240,10,140,234,208,82,2,
+  55,31,60,47,124,183,116,110,33,171,220,36,30,62,126,49,170,150,106,4,138,62,44,243,139,237,217,36,218,250,106,166,
+  116,32,179,11,109,80,231,99,84,251,38,116,166,108,175,157,171,127,21,86,37,16,245,126,126,139,51,2,3,5,148,17,
+  248,35,10,196,248,173,106,2,105,119,237,93,154,17,32,40,48,188,137,91,64,10,52,128,228,119,8,141,234,130,36,16,
+  72,6,243,94,119,189,73,72,124,244,208,52,78,134,134,10,164,128,11,195,114,243,90,4,180,99,30,39,50,83,186,252,
+  228,101,153,95,84,48,47,93,88,182,38,206,141,129,45,79,86,12,43,183,48,74,79,104,229,67,51,194,111,140,63,131,
+  9,254,87,252,2,243,76,15,230,168,240,118,155,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Attach1x[649] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,2,27,73,68,65,84,56,141,
+  133,211,223,107,146,81,24,192,241,175,250,170,140,114,25,221,76,47,212,205,233,88,233,162,112,51,2,7,131,193,198,168,
+  219,32,168,151,94,120,137,186,136,8,130,160,191,160,174,130,26,196,64,144,12,162,187,230,72,27,68,174,117,185,173,232,
+  231,42,236,23,25,182,145,166,108,110,234,252,213,133,89,175,154,235,92,29,158,243,240,57,207,121,120,142,170,90,173,210,
+  188,36,89,84,3,19,192,49,96,4,72,1,247,128,169,128,63,184,162,204,85,53,3,146,44,118,0,51,93,166,174,209,
+  189,253,253,216,29,118,54,55,54,137,197,98,44,45,62,253,94,169,84,60,1,127,48,81,207,87,183,92,15,151,157,125,
+  206,209,241,177,49,86,86,87,185,21,184,77,36,242,0,147,201,132,203,237,50,1,23,149,201,127,0,73,22,207,72,178,
+  248,25,56,231,243,249,152,158,14,177,252,102,121,106,107,171,48,148,254,153,62,31,141,62,198,235,245,2,156,250,39,0,
+  92,241,249,134,109,192,174,78,67,39,153,76,6,224,82,192,31,92,4,110,172,175,173,97,216,177,19,96,119,59,160,99,
+  208,51,8,128,86,208,214,99,21,73,22,143,2,215,0,4,65,7,208,208,52,65,177,87,105,117,186,102,192,12,132,204,
+  102,179,42,145,72,160,17,132,22,64,89,129,74,39,252,6,180,186,122,108,15,160,58,45,159,5,64,87,131,219,3,245,
+  155,133,191,21,84,149,21,105,212,255,1,234,39,149,114,21,181,90,13,208,3,80,42,149,0,40,150,138,219,3,249,92,
+  30,128,87,175,95,50,224,222,15,48,105,179,118,243,241,211,7,0,242,185,92,11,208,208,196,66,161,6,204,205,71,57,
+  113,252,36,86,139,205,104,177,88,9,71,102,0,40,20,10,219,2,235,217,108,214,160,215,235,73,38,127,100,38,111,94,
+  55,246,218,29,60,138,62,36,187,145,197,209,235,36,254,45,14,16,107,247,132,217,133,165,5,38,198,143,208,211,109,55,
+  106,52,26,222,189,127,75,185,82,198,181,207,205,161,161,195,204,63,153,3,184,218,174,130,11,207,95,60,27,72,165,146,
+  125,86,139,149,131,7,60,8,130,64,169,88,226,107,252,11,247,35,33,210,153,116,24,184,163,4,26,126,163,36,139,6,
+  106,179,62,2,12,83,155,131,52,48,11,220,5,194,1,127,176,172,4,126,1,41,32,186,81,242,76,218,213,0,0,0,
+  0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Attach2x[1747] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,6,138,73,68,65,84,88,133,237,150,109,108,83,
+  231,21,199,255,207,189,126,15,9,113,28,231,165,16,231,197,9,73,147,166,20,18,160,188,4,85,101,168,234,246,97,42,
+  213,186,15,149,170,105,107,181,142,106,211,82,134,77,156,160,93,68,18,39,6,153,173,91,85,65,217,86,169,83,55,105,
+  116,31,182,47,3,161,106,139,74,8,224,36,16,48,224,56,56,137,49,134,36,141,227,196,239,247,250,62,207,190,24,41,
+  74,141,33,172,210,190,244,72,71,231,232,234,158,243,255,233,232,220,231,62,192,183,246,127,54,242,77,53,234,57,209,83,
+  174,72,163,157,50,188,66,128,117,0,210,32,184,202,24,231,236,176,116,156,251,198,0,236,118,123,21,199,203,31,81,130,
+  185,84,44,253,174,32,8,113,187,163,251,7,60,167,248,184,186,166,106,109,105,121,41,180,90,45,192,128,80,40,4,207,
+  45,15,139,197,226,29,29,214,206,254,255,25,128,49,70,250,142,245,254,167,177,177,161,109,118,118,14,161,185,208,107,148,
+  176,162,53,58,221,233,109,59,182,145,240,194,34,124,62,31,194,225,48,83,42,148,196,100,170,128,169,210,132,193,11,23,
+  89,74,74,190,116,232,87,93,3,43,123,114,171,1,232,63,222,251,102,145,94,223,86,83,99,70,100,41,34,81,78,142,
+  42,21,138,15,119,238,218,65,124,19,147,24,25,30,25,90,88,88,122,85,167,206,215,166,69,86,225,187,115,231,95,211,
+  211,119,177,161,126,3,97,12,111,103,235,169,120,82,113,225,3,161,128,164,200,177,45,173,91,224,118,187,33,73,162,147,
+  80,238,151,141,207,55,105,194,225,37,76,77,79,94,75,198,211,123,4,65,136,103,74,2,118,187,253,103,193,123,129,201,
+  151,247,124,7,215,199,198,246,102,235,251,196,19,80,39,84,71,107,205,181,101,32,4,254,169,233,123,160,236,250,218,181,
+  5,223,171,53,215,225,218,216,152,76,40,222,94,38,14,0,72,165,82,65,81,148,160,211,105,1,144,162,167,6,232,235,
+  235,219,168,209,170,246,183,180,180,194,229,186,2,70,209,201,8,57,250,226,246,29,112,223,116,35,149,76,158,178,90,187,
+  92,43,235,52,26,197,214,130,130,2,196,99,113,0,196,243,84,0,140,49,194,56,249,119,91,90,183,41,252,254,105,132,
+  66,11,231,41,152,185,166,198,92,173,211,234,224,245,122,230,104,154,28,206,94,71,122,27,27,155,16,8,4,0,208,179,
+  79,5,224,112,216,223,42,53,150,180,153,171,205,112,13,187,68,16,250,129,74,165,180,236,220,190,11,131,23,47,64,150,
+  169,205,102,179,205,175,172,235,63,222,251,166,177,216,216,86,89,89,5,143,199,35,49,153,255,40,91,255,156,75,120,226,
+  132,80,40,202,232,223,221,246,18,46,14,13,66,20,83,78,2,188,187,117,203,139,234,96,48,136,153,153,153,161,67,7,
+  109,127,48,87,213,241,147,147,222,221,74,165,116,237,253,247,133,208,195,133,109,219,181,27,195,195,46,136,98,202,217,209,
+  209,233,91,245,4,146,162,234,72,125,93,67,105,50,153,132,119,98,220,15,66,220,133,122,195,119,107,170,205,24,28,250,
+  82,230,128,247,8,33,204,55,229,253,220,96,44,254,66,76,43,47,11,130,192,169,19,170,163,141,207,54,149,113,132,195,
+  132,119,252,94,34,38,117,63,74,227,145,0,14,71,207,11,26,141,250,189,166,198,102,124,121,97,0,140,177,195,4,164,
+  123,107,235,54,92,118,93,66,34,145,56,101,177,116,142,216,143,117,191,166,47,212,127,255,149,189,175,66,161,80,152,84,
+  58,213,118,173,86,189,127,243,166,86,252,123,224,11,200,140,182,11,130,16,93,21,0,99,140,48,224,247,207,53,53,243,
+  119,124,94,132,23,23,206,1,204,108,170,168,172,4,33,240,78,120,230,212,74,201,38,8,130,142,3,247,155,214,214,173,
+  184,226,186,140,116,58,125,154,128,217,55,189,208,162,24,247,222,198,252,124,232,124,135,165,235,111,185,166,156,21,192,225,
+  176,191,85,168,47,218,89,164,55,192,125,243,70,138,113,124,23,33,220,47,26,234,159,133,203,117,9,44,205,172,237,237,
+  66,88,163,83,116,86,172,55,153,24,3,38,124,222,57,66,216,109,131,190,168,173,196,88,138,145,209,97,145,114,248,121,
+  46,113,32,203,18,58,157,78,173,36,167,28,27,155,55,225,134,123,12,98,90,114,130,178,150,242,117,235,11,67,161,16,
+  66,161,249,27,22,139,237,19,66,228,58,94,169,58,208,80,223,136,43,195,151,192,168,220,11,112,29,27,159,223,132,145,
+  171,46,72,146,232,180,89,186,110,63,14,224,107,19,144,164,228,27,69,250,162,146,72,100,9,15,102,238,63,72,197,164,
+  110,66,72,155,190,176,8,254,128,31,20,248,237,145,35,71,148,20,220,95,106,205,27,212,247,130,1,44,132,67,131,140,
+  145,154,138,245,166,178,100,50,137,64,224,174,63,25,79,247,60,78,60,43,0,37,216,171,47,212,195,31,152,6,99,172,
+  55,115,188,214,42,120,5,226,241,24,8,97,51,26,157,242,51,163,177,164,165,32,191,0,158,241,91,34,161,228,148,82,
+  169,218,111,170,168,194,117,247,24,64,113,32,215,226,229,4,32,132,62,167,209,232,16,139,69,1,202,15,0,0,1,153,
+  140,68,35,208,106,117,224,57,197,63,158,41,95,247,122,197,250,74,220,184,57,6,89,150,14,130,176,119,42,77,85,124,
+  240,126,0,209,232,210,57,171,213,118,230,73,196,179,3,48,18,167,140,130,35,28,40,79,117,0,0,134,51,193,96,0,
+  101,165,229,216,216,188,25,121,186,53,112,187,199,228,104,52,102,1,229,22,243,214,228,239,204,95,83,128,105,255,84,138,
+  242,220,99,23,47,39,0,3,134,34,145,37,228,231,23,128,103,236,71,0,96,181,218,206,36,197,196,129,177,235,163,193,
+  145,171,87,22,188,19,158,129,84,58,249,178,70,37,125,12,14,199,42,43,170,224,191,59,133,52,149,157,182,3,182,241,
+  213,0,124,237,43,32,140,125,54,59,251,160,189,161,190,17,243,161,249,119,236,253,61,19,135,44,182,227,132,16,39,0,
+  231,242,119,251,28,61,159,150,24,75,140,148,82,132,22,230,253,169,28,39,222,163,44,235,149,172,223,209,251,87,131,161,
+  248,135,235,158,169,128,111,106,2,145,200,210,8,7,242,235,120,92,60,15,0,234,60,126,7,161,220,79,243,242,242,222,
+  168,171,107,128,103,252,22,146,241,196,235,86,171,237,239,171,5,200,250,51,74,196,197,31,127,197,230,202,101,42,239,174,
+  169,174,69,52,26,217,60,51,115,255,159,140,32,13,128,215,105,117,196,96,48,162,216,80,12,223,212,29,36,18,241,63,
+  31,178,118,174,90,28,200,113,41,61,121,242,164,50,20,254,234,48,207,115,7,75,140,101,26,131,161,24,74,165,18,0,
+  32,166,82,88,92,90,196,236,220,3,57,18,137,29,251,227,233,63,57,252,126,191,12,128,1,160,153,40,103,242,135,241,
+  137,1,20,0,84,153,168,216,183,111,95,85,83,115,195,79,52,26,205,30,142,227,202,24,3,210,114,250,126,60,26,27,
+  29,29,25,253,252,236,217,243,190,101,194,114,198,211,43,92,202,146,211,92,19,224,50,0,202,12,140,58,19,249,204,115,
+  62,227,100,89,15,186,12,98,37,192,67,97,49,147,203,185,38,144,203,72,142,200,50,57,91,145,127,107,57,237,191,56,
+  2,2,187,148,67,4,157,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Bookmark1x[686] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,10,17,21,6,52,65,49,61,207,0,0,2,59,73,
+  68,65,84,56,203,149,210,65,72,147,97,28,199,241,239,255,125,158,247,221,187,185,114,91,35,107,172,21,45,17,44,47,
+  129,66,69,247,194,168,32,130,14,65,135,162,123,208,161,162,118,176,67,167,162,171,116,173,131,224,37,40,138,40,43,208,
+  166,65,33,120,113,83,9,209,201,212,68,90,178,215,109,239,246,118,152,168,43,19,252,93,158,231,240,252,63,252,255,207,
+  243,8,107,233,58,115,231,22,240,24,240,216,136,7,32,34,243,247,174,231,146,221,167,127,181,129,238,130,218,34,212,210,
+  192,162,6,232,237,237,237,207,231,243,151,38,38,167,200,46,198,228,193,221,171,245,114,169,19,15,31,61,143,13,166,93,
+  167,53,17,231,192,161,19,24,214,65,86,150,62,12,238,9,142,221,80,0,157,157,157,125,169,84,138,93,193,32,3,233,
+  31,132,91,162,124,207,228,152,156,249,137,83,170,48,49,62,205,237,155,199,232,56,122,4,171,249,2,166,125,8,67,251,
+  19,218,253,58,167,55,181,75,161,80,192,173,20,89,90,94,102,126,97,25,0,91,215,112,43,69,10,191,93,220,154,139,
+  174,58,136,50,40,23,103,240,41,41,24,155,129,106,181,74,181,178,74,185,228,80,114,86,40,59,43,84,86,29,220,178,
+  195,216,120,137,153,156,80,45,14,224,21,223,49,59,157,6,175,242,173,1,0,16,101,161,181,133,105,249,80,166,15,165,
+  77,196,48,217,31,75,16,217,119,22,167,214,129,152,49,70,70,77,160,58,218,0,136,8,218,244,99,218,1,44,59,136,
+  207,223,132,105,251,209,166,159,220,108,142,76,118,10,79,98,96,29,103,110,161,9,221,242,114,85,255,221,129,97,40,12,
+  67,161,180,9,128,82,38,134,210,196,227,113,218,218,218,64,4,17,141,231,9,0,13,128,101,89,235,251,189,145,32,181,
+  218,198,151,176,253,138,173,210,48,66,32,16,168,255,30,15,190,188,31,102,120,96,4,207,171,35,77,129,102,68,100,123,
+  192,231,243,1,240,233,237,16,137,216,110,14,39,66,124,124,51,132,231,121,228,243,121,50,153,204,63,64,195,8,182,109,
+  3,112,237,242,41,174,92,60,137,97,24,244,191,26,230,217,139,207,180,183,183,147,76,38,183,7,162,209,40,79,238,159,
+  67,41,69,54,155,69,68,232,104,13,243,52,117,158,112,56,188,254,82,255,5,66,161,16,161,80,8,17,89,63,184,121,
+  221,234,14,26,128,72,36,194,78,163,215,90,127,221,211,211,211,189,147,194,104,52,218,7,240,7,70,86,184,198,50,151,
+  228,191,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Bookmark2x[1532] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,5,179,73,68,65,84,88,133,173,151,77,108,92,
+  87,21,199,127,231,222,251,222,155,111,59,78,227,38,8,236,196,45,173,99,199,177,131,32,86,128,42,32,181,8,35,216,
+  128,96,129,90,165,40,97,195,2,33,54,44,64,221,241,177,131,77,216,21,161,110,16,11,216,32,138,64,32,160,128,138,
+  42,210,150,58,114,82,199,174,191,38,118,211,169,237,216,30,123,102,236,119,223,101,241,102,220,241,188,25,167,33,61,210,
+  211,155,55,247,220,123,127,247,127,206,61,247,61,225,16,187,240,133,31,252,204,120,234,155,158,81,153,118,237,187,97,24,
+  133,81,244,194,191,127,247,163,111,28,54,206,97,102,58,53,124,124,226,123,19,31,27,237,187,50,60,120,44,147,233,122,
+  184,173,79,109,47,84,207,255,226,197,167,129,3,0,206,17,112,55,117,2,223,246,96,77,26,0,29,86,216,213,107,116,
+  87,151,69,216,109,248,74,235,160,87,175,94,253,178,231,121,191,124,237,230,122,126,97,101,151,59,165,53,158,121,246,139,
+  109,1,172,141,248,245,175,254,194,196,120,128,115,14,107,45,233,212,6,71,186,214,201,101,55,201,164,43,24,179,71,20,
+  69,88,171,107,199,123,75,63,127,98,252,173,223,32,149,105,201,83,106,171,128,214,250,249,203,151,47,231,69,132,242,118,
+  149,137,175,255,144,165,183,215,9,67,139,107,149,79,41,0,198,199,199,185,120,241,34,190,183,134,184,41,196,205,130,43,
+  130,43,33,84,112,206,129,100,131,191,254,109,251,91,136,55,135,68,25,231,106,215,68,88,75,0,132,97,216,45,34,204,
+  205,205,81,169,238,225,28,108,239,212,216,40,87,227,129,154,236,72,33,78,141,181,181,53,74,165,219,100,130,41,124,243,
+  38,70,205,226,153,101,180,148,112,18,71,64,201,46,31,254,208,78,0,169,17,28,176,165,118,156,171,188,156,0,104,76,
+  34,34,241,5,100,211,30,91,59,59,68,209,65,128,92,198,219,247,213,242,14,70,223,193,232,21,60,189,140,86,101,68,
+  63,14,114,180,238,189,70,239,177,73,16,127,16,162,50,68,37,202,185,91,9,128,40,138,14,0,32,96,148,67,162,16,
+  105,1,240,84,252,188,180,180,68,177,184,65,79,215,12,93,249,121,186,114,203,224,157,70,185,199,209,186,47,30,143,219,
+  104,111,11,88,253,8,232,34,168,99,72,245,225,67,1,234,146,64,100,113,145,197,181,0,184,40,2,231,232,235,235,99,
+  224,84,134,116,240,46,190,246,49,186,128,152,94,68,245,131,62,87,31,88,16,245,22,72,193,195,237,21,16,201,16,233,
+  124,91,128,230,48,0,56,44,206,133,137,28,112,206,2,176,184,184,200,226,98,134,158,238,18,93,185,50,185,108,136,18,
+  139,34,66,105,129,68,250,214,77,203,94,2,192,90,187,63,121,16,120,88,27,97,180,198,51,38,145,3,198,104,0,250,
+  251,251,25,120,228,33,60,85,195,211,27,24,181,138,168,13,68,150,193,190,90,247,190,141,139,222,5,183,25,130,221,194,
+  185,29,140,77,238,130,102,0,207,40,34,7,65,144,34,149,78,39,0,130,32,0,17,22,23,23,153,158,134,66,110,155,
+  66,78,200,103,179,164,130,89,148,177,104,115,167,238,189,142,221,155,7,236,34,216,21,136,74,220,173,189,125,40,64,195,
+  124,63,32,229,167,137,90,66,224,123,1,0,39,79,158,228,209,199,62,133,167,186,48,42,143,150,52,74,21,209,204,128,
+  189,93,247,174,114,231,157,42,71,10,181,55,97,119,14,113,55,229,56,219,29,1,154,33,98,5,246,18,0,65,42,5,
+  196,187,224,250,245,91,248,94,141,92,6,210,65,150,116,234,40,169,192,167,144,143,183,170,241,10,204,45,92,99,240,209,
+  218,27,176,251,6,217,234,36,180,169,132,214,90,156,115,239,109,67,192,243,60,124,223,75,0,24,47,238,62,56,56,200,
+  217,179,103,99,104,134,209,50,139,146,21,148,220,37,116,21,0,180,116,115,107,246,6,19,79,218,127,144,173,78,138,96,
+  59,2,180,154,210,10,173,53,70,132,124,54,96,179,92,37,114,14,173,226,36,44,22,139,76,78,78,54,41,23,224,153,
+  30,210,105,195,35,167,122,65,124,34,117,130,255,188,246,103,36,183,253,250,129,69,116,2,104,86,192,40,69,224,123,116,
+  23,210,84,182,43,244,30,205,179,190,89,65,235,248,44,24,26,26,98,100,100,36,1,14,196,203,116,224,200,176,83,81,
+  137,246,247,5,160,141,230,161,238,44,175,188,114,157,255,190,62,195,249,243,167,25,25,253,40,170,126,24,205,207,207,39,
+  106,4,128,49,134,225,225,97,32,46,241,141,34,119,79,128,214,193,172,181,188,244,247,87,113,187,85,158,251,246,83,188,
+  240,219,107,252,107,115,155,79,63,49,6,192,153,51,103,24,24,24,216,7,222,47,96,137,194,149,132,76,104,18,134,97,
+  194,233,197,223,255,147,158,172,225,187,87,62,203,208,224,41,126,242,253,175,209,149,82,252,241,15,47,3,113,61,216,63,
+  188,58,92,192,251,87,160,177,138,70,199,79,142,246,243,213,47,125,130,165,165,37,202,229,45,0,190,242,249,65,254,244,
+  210,52,75,197,18,51,51,51,172,174,174,30,168,29,0,90,235,3,185,113,95,0,13,251,206,149,39,249,220,103,198,112,
+  206,49,60,60,188,15,166,148,226,220,185,115,92,24,191,201,249,177,147,100,50,153,68,8,32,150,189,157,244,29,1,194,
+  240,224,161,115,241,194,105,148,82,68,81,196,141,27,55,176,214,30,152,168,43,13,211,211,211,7,198,216,223,61,198,116,
+  220,29,247,84,160,57,4,141,251,208,208,80,34,182,74,169,68,172,91,21,248,191,0,218,217,212,212,212,190,2,237,38,
+  107,253,79,107,205,232,232,232,131,133,160,217,26,10,180,174,186,157,26,240,94,252,91,147,243,80,128,7,81,192,243,60,
+  198,198,198,58,246,127,96,128,123,41,32,34,247,140,249,3,1,52,172,245,149,173,83,123,227,247,253,228,64,65,41,181,
+  233,156,43,20,10,5,68,4,107,45,198,152,251,94,89,195,154,195,229,251,254,22,112,28,88,7,106,173,0,121,224,88,
+  177,88,252,241,165,75,151,158,19,169,127,81,124,112,86,93,88,88,248,41,112,2,208,192,10,16,53,107,24,0,189,192,
+  81,160,187,254,172,63,168,201,137,23,187,13,172,1,75,64,25,218,124,156,214,39,78,213,239,157,247,207,253,153,5,246,
+  136,101,175,209,244,158,254,63,27,58,117,84,102,33,229,156,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Close1x[586] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,1,199,73,68,65,84,56,141,165,147,205,106,26,97,20,134,31,51,14,
+  5,77,71,218,136,100,83,20,131,67,118,198,149,76,93,185,51,5,23,221,100,153,69,46,32,189,130,118,81,122,3,189,
+  130,118,147,149,12,130,139,226,118,50,232,106,4,133,4,162,208,162,20,132,128,197,159,90,181,240,165,167,27,45,147,161,
+  41,20,15,156,205,57,231,121,57,63,223,23,18,17,182,177,157,173,232,7,4,18,64,26,136,250,98,81,224,96,157,251,
+  167,192,126,62,159,63,214,117,253,163,109,219,230,26,140,218,182,109,234,186,254,33,159,207,31,3,251,247,8,17,217,120,
+  194,178,172,83,160,11,92,105,154,118,89,173,86,143,170,213,234,145,166,105,151,192,21,208,181,44,235,84,68,18,27,46,
+  228,91,98,58,149,74,189,31,12,6,79,0,1,30,133,195,225,57,128,82,106,23,248,9,132,146,201,228,184,223,239,191,
+  2,190,4,71,184,245,60,239,34,147,201,92,3,11,96,172,148,210,148,82,26,48,6,22,153,76,230,218,243,188,11,224,
+  118,3,133,2,103,52,70,163,209,139,66,161,240,188,215,235,61,243,39,76,211,252,218,104,52,154,241,120,252,19,48,123,
+  104,137,119,173,86,171,183,92,46,247,214,93,252,241,213,106,245,180,221,110,119,129,59,63,224,239,32,90,175,215,15,202,
+  229,242,107,165,148,2,230,1,241,93,93,215,181,90,173,246,174,84,42,125,6,126,4,5,210,177,88,236,205,108,54,251,
+  5,124,7,200,102,179,223,0,58,157,206,222,186,230,177,97,24,59,211,233,244,237,223,150,56,175,84,42,205,72,36,50,
+  4,22,185,92,110,232,56,206,141,227,56,55,185,92,110,8,44,34,145,200,176,82,169,52,239,117,231,123,7,136,200,161,
+  235,186,103,197,98,241,124,50,153,156,136,136,33,34,198,100,50,57,41,22,139,231,174,235,158,137,200,161,159,9,10,32,
+  34,166,136,188,92,195,155,152,177,142,153,193,250,224,25,255,219,182,254,141,191,1,124,82,8,56,142,215,29,200,0,0,
+  0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Close2x[2045] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,4,0,0,0,217,115,178,
+  127,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,215,1,66,40,155,120,0,0,6,0,105,84,88,116,88,77,
+  76,58,99,111,109,46,97,100,111,98,101,46,120,109,112,0,0,0,0,0,60,63,120,112,97,99,107,101,116,32,98,101,
+  103,105,110,61,34,239,187,191,34,32,105,100,61,34,87,53,77,48,77,112,67,101,104,105,72,122,114,101,83,122,78,84,
+  99,122,107,99,57,100,34,63,62,32,60,120,58,120,109,112,109,101,116,97,32,120,109,108,110,115,58,120,61,34,97,100,
+  111,98,101,58,110,115,58,109,101,116,97,47,34,32,120,58,120,109,112,116,107,61,34,65,100,111,98,101,32,88,77,80,
+  32,67,111,114,101,32,53,46,54,45,99,49,52,53,32,55,57,46,49,54,51,52,57,57,44,32,50,48,49,56,47,48,
+  56,47,49,51,45,49,54,58,52,48,58,50,50,32,32,32,32,32,32,32,32,34,62,32,60,114,100,102,58,82,68,70,
+  32,120,109,108,110,115,58,114,100,102,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,49,57,
+  57,57,47,48,50,47,50,50,45,114,100,102,45,115,121,110,116,97,120,45,110,115,35,34,62,32,60,114,100,102,58,68,
+  101,115,99,114,105,112,116,105,111,110,32,114,100,102,58,97,98,111,117,116,61,34,34,32,120,109,108,110,115,58,120,109,
+  112,61,34,104,116,116,112,58,47,47,110,115,46,97,100,111,98,101,46,99,111,109,47,120,97,112,47,49,46,48,47,34,
+  32,120,109,108,110,115,58,100,99,61,34,104,116,116,112,58,47,47,112,117,114,108,46,111,114,103,47,100,99,47,101,108,
+  101,109,101,110,116,115,47,49,46,49,47,34,32,120,109,108,110,115,58,112,104,111,116,111,115,104,111,112,61,34,104,116,
+  116,112,58,47,47,110,115,46,97,100,111,98,101,46,99,111,109,47,112,104,111,116,111,115,104,111,112,47,49,46,48,47,
+  34,32,120,109,108,110,115,58,120,109,112,77,77,61,34,104,116,116,112,58,47,47,110,115,46,97,100,111,98,101,46,99,
+  111,109,47,120,97,112,47,49,46,48,47,109,109,47,34,32,120,109,108,110,115,58,115,116,69,118,116,61,34,104,116,116,
+  112,58,47,47,110,115,46,97,100,111,98,101,46,99,111,109,47,120,97,112,47,49,46,48,47,115,84,121,112,101,47,82,
+  101,115,111,117,114,99,101,69,118,101,110,116,35,34,32,120,109,112,58,67,114,101,97,116,111,114,84,111,111,108,61,34,
+  65,100,111,98,101,32,80,104,111,116,111,115,104,111,112,32,67,67,32,50,48,49,57,32,40,77,97,99,105,110,116,111,
+  115,104,41,34,32,120,109,112,58,67,114,101,97,116,101,68,97,116,101,61,34,50,48,50,49,45,48,56,45,50,55,84,
+  50,48,58,49,49,58,52,52,43,48,51,58,48,48,34,32,120,109,112,58,77,111,100,105,102,121,68,97,116,101,61,34,
+  50,48,50,49,45,48,57,45,48,49,84,49,57,58,52,56,58,49,55,43,48,51,58,48,48,34,32,120,109,112,58,77,
+  101,116,97,100,97,116,97,68,97,116,101,61,34,50,48,50,49,45,48,57,45,48,49,84,49,57,58,52,56,58,49,55,
+  43,48,51,58,48,48,34,32,100,99,58,102,111,114,109,97,116,61,34,105,109,97,103,101,47,112,110,103,34,32,112,104,
+  111,116,111,115,104,111,112,58,67,111,108,111,114,77,111,100,101,61,34,51,34,32,112,104,111,116,111,115,104,111,112,58,
+  73,67,67,80,114,111,102,105,108,101,61,34,115,82,71,66,32,73,69,67,54,49,57,54,54,45,50,46,49,34,32,120,
+  109,112,77,77,58,73,110,115,116,97,110,99,101,73,68,61,34,120,109,112,46,105,105,100,58,98,55,53,51,55,100,54,
+  52,45,54,49,101,52,45,52,97,98,57,45,56,53,101,49,45,55,51,97,53,51,52,50,98,49,56,102,55,34,32,120,
+  109,112,77,77,58,68,111,99,117,109,101,110,116,73,68,61,34,97,100,111,98,101,58,100,111,99,105,100,58,112,104,111,
+  116,111,115,104,111,112,58,49,100,98,48,50,49,99,101,45,97,51,55,50,45,102,99,52,98,45,57,57,50,52,45,98,
+  98,57,50,54,97,50,50,55,57,97,50,34,32,120,109,112,77,77,58,79,114,105,103,105,110,97,108,68,111,99,117,109,
+  101,110,116,73,68,61,34,120,109,112,46,100,105,100,58,54,54,51,56,49,56,98,51,45,56,102,52,57,45,52,100,56,
+  49,45,56,49,49,51,45,102,53,102,51,49,48,100,56,97,55,52,54,34,62,32,60,120,109,112,77,77,58,72,105,115,
+  116,111,114,121,62,32,60,114,100,102,58,83,101,113,62,32,60,114,100,102,58,108,105,32,115,116,69,118,116,58,97,99,
+  116,105,111,110,61,34,99,114,101,97,116,101,100,34,32,115,116,69,118,116,58,105,110,115,116,97,110,99,101,73,68,61,
+  34,120,109,112,46,105,105,100,58,54,54,51,56,49,56,98,51,45,56,102,52,57,45,52,100,56,49,45,56,49,49,51,
+  45,102,53,102,51,49,48,100,56,97,55,52,54,34,32,115,116,69,118,116,58,119,104,101,110,61,34,50,48,50,49,45,
+  48,56,45,50,55,84,50,48,58,49,49,58,52,52,43,48,51,58,48,48,34,32,115,116,69,118,116,58,115,111,102,116,
+  119,97,114,101,65,103,101,110,116,61,34,65,100,111,98,101,32,80,104,111,116,111,115,104,111,112,32,67,67,32,50,48,
+  49,57,32,40,77,97,99,105,110,116,111,115,104,41,34,47,62,32,60,114,100,102,58,108,105,32,115,116,69,118,116,58,
+  97,99,116,105,111,110,61,34,115,97,118,101,100,34,32,115,116,69,118,116,58,105,110,115,116,97,110,99,101,73,68,61,
+  34,120,109,112,46,105,105,100,58,98,55,53,51,55,100,54,52,45,54,49,101,52,45,52,97,98,57,45,56,53,101,49,
+  45,55,51,97,53,51,52,50,98,49,56,102,55,34,32,115,116,69,118,116,58,119,104,101,110,61,34,50,48,50,49,45,
+  48,57,45,48,49,84,49,57,58,52,56,58,49,55,43,48,51,58,48,48,34,32,115,116,69,118,116,58,115,111,102,116,
+  119,97,114,101,65,103,101,110,116,61,34,65,100,111,98,101,32,80,104,111,116,111,115,104,111,112,32,67,67,32,50,48,
+  49,57,32,40,77,97,99,105,110,116,111,115,104,41,34,32,115,116,69,118,116,58,99,104,97,110,103,101,100,61,34,47,
+  34,47,62,32,60,47,114,100,102,58,83,101,113,62,32,60,47,120,109,112,77,77,58,72,105,115,116,111,114,121,62,32,
+  60,47,114,100,102,58,68,101,115,99,114,105,112,116,105,111,110,62,32,60,47,114,100,102,58,82,68,70,62,32,60,47,
+  120,58,120,109,112,109,101,116,97,62,32,60,63,120,112,97,99,107,101,116,32,101,110,100,61,34,114,34,63,62,199,198,
+  29,147,0,0,1,163,73,68,65,84,72,199,237,148,79,75,2,65,24,198,159,69,156,253,26,230,189,252,58,117,232,15,
+  18,72,65,129,135,130,242,80,20,22,149,73,10,5,121,40,200,67,94,234,80,7,61,104,144,135,60,88,160,176,145,208,
+  135,169,103,103,198,101,255,202,130,167,160,253,49,243,142,207,251,206,51,195,236,172,248,193,116,224,223,192,54,8,121,18,
+  136,169,42,3,127,34,131,51,152,129,90,65,53,227,183,12,219,193,28,44,124,227,220,103,33,80,166,106,49,27,178,3,
+  239,244,1,190,48,34,110,11,129,146,212,70,24,122,45,252,6,179,248,192,39,177,100,59,209,22,130,35,203,225,157,85,
+  17,6,9,28,114,253,49,67,182,99,90,8,246,67,151,62,96,85,34,106,7,38,138,92,193,166,175,219,145,84,250,26,
+  59,83,116,159,78,240,12,76,28,160,231,240,70,220,177,199,172,57,249,16,109,139,61,116,241,234,52,187,239,234,126,223,
+  255,122,195,47,146,137,2,58,120,65,91,210,33,109,217,10,193,219,17,117,19,5,118,209,68,139,52,117,108,97,135,42,
+  226,27,108,225,137,60,203,94,177,29,223,64,32,143,7,201,163,142,138,124,208,34,204,64,96,19,13,220,147,134,140,13,
+  61,178,227,134,223,34,104,32,176,142,58,185,35,238,168,198,117,102,197,36,3,129,28,110,201,141,195,26,81,163,177,158,
+  115,91,120,13,12,172,160,134,107,82,211,113,149,197,130,253,181,86,85,204,178,50,98,7,105,92,224,202,33,171,215,18,
+  28,41,229,146,84,88,53,225,12,210,252,112,43,168,146,101,215,86,5,127,85,165,94,114,79,15,127,11,41,254,243,148,
+  177,132,164,71,77,98,145,234,41,102,226,220,131,20,22,124,211,149,197,60,51,222,199,136,186,137,6,98,170,81,6,177,
+  159,191,106,96,248,12,166,227,23,234,50,147,249,110,139,89,8,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char FullScreen1x[650] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,214,3,16,19,13,53,226,119,223,154,0,0,0,53,116,
+  69,88,116,67,111,109,109,101,110,116,0,40,99,41,32,50,48,48,52,32,74,97,107,117,98,32,83,116,101,105,110,101,
+  114,10,10,67,114,101,97,116,101,100,32,119,105,116,104,32,84,104,101,32,71,73,77,80,144,217,139,111,0,0,1,214,
+  73,68,65,84,56,203,157,147,59,104,147,81,20,199,127,255,155,27,53,21,105,211,37,72,241,5,113,8,8,130,32,148,
+  42,118,42,20,95,80,197,201,199,224,208,193,42,213,197,65,112,112,72,249,154,224,168,96,6,193,65,80,2,237,224,179,
+  86,81,116,80,113,13,45,138,37,45,22,69,106,77,83,21,77,76,251,117,248,146,216,188,28,114,224,192,133,115,207,239,
+  254,207,185,231,200,137,69,111,0,253,52,103,9,156,88,212,109,214,156,88,212,181,37,212,238,254,219,21,232,39,195,189,
+  0,72,6,112,233,185,248,168,34,254,46,113,28,0,83,173,201,24,253,75,6,36,144,196,211,248,126,140,81,77,13,166,
+  58,121,67,192,207,133,235,111,188,151,101,80,209,79,57,47,104,89,107,177,62,213,7,72,48,230,244,178,177,61,64,184,
+  163,149,123,175,103,144,60,25,119,158,127,100,199,214,118,66,193,0,227,241,131,248,86,41,41,247,96,60,118,0,128,107,
+  131,123,25,125,53,77,40,24,224,253,167,69,172,53,132,59,218,88,99,125,92,58,177,11,23,241,236,234,161,90,128,228,
+  85,45,160,111,223,54,38,166,51,68,182,180,97,100,248,48,187,64,103,36,92,190,231,174,170,188,12,176,182,116,244,32,
+  126,191,197,250,252,200,136,245,45,235,240,89,11,18,194,5,87,245,122,96,144,132,145,33,241,96,130,185,133,63,76,125,
+  206,50,59,247,147,236,175,60,35,47,167,138,191,98,74,114,43,1,221,231,71,145,12,199,174,60,102,114,38,67,42,253,
+  157,237,155,130,108,14,181,146,74,207,243,118,242,43,71,46,63,4,96,207,217,100,45,192,117,161,123,112,132,204,143,28,
+  233,47,139,156,59,186,19,73,72,226,100,79,132,84,122,158,111,217,223,116,13,36,27,207,193,178,11,185,191,75,220,119,
+  14,123,157,40,2,36,49,22,239,99,105,217,253,255,32,149,172,107,32,137,49,194,200,115,100,232,60,115,183,238,54,217,
+  234,217,110,100,141,226,182,80,40,220,28,142,15,157,110,102,151,243,185,252,173,21,142,211,185,159,81,219,35,189,0,0,
+  0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char FullScreen2x[1256] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,4,122,73,68,65,84,88,133,
+  197,151,91,136,84,117,28,199,63,255,115,206,220,207,156,85,103,103,103,156,53,161,242,18,186,42,162,75,79,70,145,100,
+  34,105,61,4,246,80,15,173,16,161,153,180,148,152,5,91,32,120,41,74,88,180,160,30,34,234,161,203,26,186,80,4,
+  18,148,61,42,230,178,187,230,150,91,176,151,185,24,237,220,111,103,230,223,131,59,235,236,204,153,113,36,183,190,240,99,
+  134,249,255,206,124,63,231,251,255,159,255,57,71,72,41,249,63,165,85,190,188,251,254,241,103,145,162,223,52,139,198,130,
+  155,106,182,4,66,238,235,61,240,218,167,115,0,72,209,223,179,231,5,195,227,114,47,180,63,233,108,198,248,248,163,15,
+  251,129,91,0,166,89,52,60,110,15,27,119,159,108,120,160,203,174,113,172,119,59,93,43,2,13,123,70,126,139,112,224,
+  216,32,153,92,177,97,207,240,64,47,149,164,149,58,186,76,193,178,74,102,153,190,189,91,155,154,3,172,89,17,224,157,
+  87,119,160,106,42,69,179,108,89,213,170,3,104,164,35,47,63,70,119,215,178,150,122,215,175,10,114,252,192,182,150,122,
+  91,6,248,246,194,53,10,5,19,1,183,173,66,193,228,187,159,175,225,114,218,254,61,128,0,2,62,157,216,95,41,62,
+  27,188,140,89,19,97,173,76,179,204,192,249,97,18,233,60,157,29,6,30,183,189,117,0,81,59,40,32,232,247,18,108,
+  215,9,182,123,73,229,138,92,184,252,39,101,9,66,136,186,146,192,149,177,48,229,146,36,228,55,8,249,189,116,250,13,
+  188,30,71,221,73,89,2,84,228,180,107,156,232,221,206,67,155,238,37,176,68,103,105,187,151,160,79,39,228,211,81,132,
+  96,50,60,3,178,62,250,108,166,128,219,105,163,51,96,208,217,97,16,234,184,9,241,112,247,125,156,58,188,211,114,74,
+  180,218,31,156,118,141,247,14,238,160,123,237,50,30,92,119,15,159,156,189,68,201,44,225,247,121,9,248,60,4,124,58,
+  134,238,68,212,198,5,232,30,7,157,126,3,101,54,17,69,8,150,117,24,60,249,232,90,156,118,141,211,135,119,242,226,
+  145,179,205,1,78,30,122,130,205,107,58,1,240,184,236,244,60,181,153,159,46,142,99,183,105,4,218,117,2,62,157,69,
+  94,151,85,112,0,44,50,92,40,138,64,81,4,139,189,78,186,86,6,177,105,42,0,235,86,45,229,244,27,187,154,3,
+  116,207,154,87,39,242,72,247,253,76,70,227,44,242,186,104,243,58,27,154,87,212,166,59,177,169,10,14,135,13,85,153,
+  31,213,250,149,193,230,0,86,210,52,133,229,75,23,91,198,222,72,110,87,243,213,223,16,64,52,112,185,19,243,59,209,
+  60,128,202,106,94,104,85,123,212,39,240,31,0,84,107,62,128,16,11,151,117,173,207,172,234,54,34,171,189,93,74,73,
+  46,95,108,233,62,48,183,41,101,11,148,203,210,114,172,90,117,0,163,215,35,243,154,75,102,153,43,215,194,76,76,207,
+  144,74,231,91,50,79,166,115,76,68,226,252,242,235,20,166,89,154,55,54,52,22,110,14,208,243,214,25,70,198,163,32,
+  4,5,179,204,87,231,135,25,249,61,194,68,44,201,100,44,65,60,157,191,53,85,22,53,147,202,51,25,77,50,17,77,
+  48,122,61,198,23,223,15,145,43,150,64,8,174,140,133,217,243,246,153,121,126,117,139,48,149,41,208,211,55,192,169,67,
+  187,56,247,227,40,127,39,114,132,252,94,164,4,164,4,9,170,16,117,55,24,128,100,58,207,84,52,206,84,44,193,244,
+  141,36,211,177,20,83,177,4,87,255,184,193,142,45,171,217,127,124,144,108,205,147,82,221,101,88,129,120,238,205,47,105,
+  211,29,132,252,6,101,41,41,75,137,148,18,175,199,129,199,101,183,188,90,116,183,157,108,174,200,84,44,57,91,9,166,
+  103,63,191,249,97,164,206,199,50,129,106,197,83,121,164,76,220,60,113,41,9,250,116,54,174,14,213,109,175,21,41,66,
+  176,113,117,136,209,241,40,19,209,248,156,121,42,83,104,232,113,219,7,146,68,58,207,68,52,142,219,105,227,153,199,55,
+  224,176,107,150,207,2,149,178,217,84,118,111,219,64,155,238,100,50,218,220,188,37,0,184,57,37,79,111,237,194,237,176,
+  181,116,21,56,237,26,59,183,60,64,58,219,220,188,101,0,128,125,199,206,49,124,61,210,82,239,165,171,83,188,116,98,
+  176,165,222,150,1,82,153,2,207,247,13,48,58,30,109,218,55,52,22,102,239,209,179,152,102,9,155,166,88,86,181,230,
+  22,161,170,106,137,108,54,107,140,124,253,74,83,3,85,81,208,180,198,220,155,214,46,231,226,231,251,155,254,71,54,155,
+  69,85,181,228,28,128,16,66,57,116,248,224,235,167,62,232,63,90,46,151,244,166,71,223,5,41,138,146,14,135,195,125,
+  66,8,183,168,188,29,11,33,124,128,15,88,2,120,129,248,93,246,85,129,197,64,6,152,1,34,64,68,84,191,158,11,
+  33,84,192,1,56,129,236,93,6,208,0,27,144,3,242,82,202,18,192,63,50,183,177,117,23,21,218,2,0,0,0,0,
+  73,69,78,68,174,66,96,130,
+};
+const unsigned char Mute1x[632] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,2,10,73,68,65,84,56,141,
+  165,147,207,75,84,81,24,134,159,115,61,215,51,214,140,46,100,26,17,141,22,226,70,178,50,23,21,65,11,33,152,85,
+  139,113,156,153,173,155,41,92,70,250,31,68,45,204,173,182,82,180,140,68,72,9,4,17,90,185,147,72,200,12,209,96,
+  108,51,11,113,225,189,206,56,115,127,124,45,6,103,97,72,86,31,156,213,199,251,188,223,11,239,81,34,194,255,140,117,
+  222,98,48,55,216,159,207,231,237,127,2,100,179,169,190,6,212,90,181,90,109,248,107,64,54,155,234,179,27,35,159,68,
+  164,249,79,98,0,157,201,165,29,32,162,181,62,70,100,210,110,140,60,25,30,30,110,158,122,61,21,92,4,96,41,84,
+  100,98,124,66,143,141,142,181,8,140,142,140,140,52,223,189,115,15,173,245,69,244,104,65,136,199,175,16,143,39,16,17,
+  117,235,230,109,140,49,40,165,46,6,0,216,250,246,181,238,184,179,243,29,219,182,241,60,143,135,11,239,243,243,211,211,
+  207,4,34,103,133,10,78,4,158,107,0,199,113,234,0,207,247,16,106,221,176,124,255,101,39,24,109,12,150,49,4,71,
+  71,232,214,86,252,195,67,2,17,10,240,202,2,112,92,7,199,117,16,17,188,170,135,87,245,78,141,204,37,99,232,89,
+  93,229,250,250,58,177,238,110,110,108,110,210,61,51,67,83,45,162,209,0,174,235,82,46,151,1,40,252,220,167,179,163,
+  163,126,170,233,234,226,114,127,63,202,24,122,182,183,1,104,73,38,209,137,4,20,139,88,34,34,139,139,139,193,202,202,
+  202,137,165,172,169,165,165,15,238,126,97,191,14,56,217,218,226,71,38,83,203,109,213,106,179,51,48,128,95,44,214,98,
+  2,49,17,137,134,97,24,125,251,230,221,99,175,18,36,151,63,46,187,97,24,90,0,118,123,59,87,39,39,65,41,36,
+  8,64,132,107,179,179,88,177,88,205,65,68,126,123,233,116,250,126,58,147,58,158,3,249,210,214,38,149,66,65,188,131,
+  3,217,203,229,36,40,149,196,221,216,144,207,209,168,204,129,168,243,126,227,208,208,208,131,71,11,11,107,93,160,35,137,
+  4,13,209,40,149,189,61,154,122,123,169,236,238,82,45,149,216,5,255,92,0,192,188,82,47,66,120,122,218,151,51,227,
+  91,48,254,11,41,211,229,38,66,238,34,57,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Mute2x[1789] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,6,180,73,68,65,84,88,133,237,150,127,108,85,
+  103,25,199,63,239,57,231,61,247,222,115,127,180,189,183,220,82,110,153,148,81,28,58,216,4,6,162,68,153,6,199,140,
+  26,153,178,63,156,17,100,145,24,246,135,109,98,76,76,150,88,51,19,253,3,215,198,100,49,49,209,176,136,50,19,208,
+  109,209,12,117,202,28,68,73,133,43,97,50,54,44,229,182,189,208,246,182,165,189,189,63,218,123,207,57,239,235,31,189,
+  109,96,20,115,23,150,248,207,190,201,147,156,243,158,39,207,247,147,39,231,125,222,23,222,215,251,250,63,75,188,155,228,
+  174,174,174,93,152,236,7,62,42,12,44,161,141,139,74,171,23,26,34,13,191,236,238,238,174,190,231,0,79,117,62,181,
+  77,104,241,19,32,37,132,104,109,75,181,177,126,253,253,52,196,98,20,10,69,74,229,18,153,76,134,236,181,107,104,173,
+  125,33,196,219,2,241,195,103,15,61,123,228,174,1,186,187,187,141,220,212,248,127,190,246,149,175,174,118,156,16,153,76,
+  134,134,134,70,14,31,249,53,255,58,127,1,165,20,78,216,225,147,31,223,198,186,251,58,168,86,93,44,203,228,205,75,
+  151,188,89,111,110,205,115,63,126,110,176,30,0,227,78,31,178,99,217,45,169,214,212,234,182,84,138,159,254,236,231,72,
+  59,192,211,223,255,1,215,178,195,172,106,91,206,154,246,20,203,154,162,244,157,77,243,226,239,79,16,139,69,121,241,229,
+  87,104,106,106,180,12,207,120,188,222,14,88,11,15,123,14,238,137,68,189,134,239,216,182,189,91,8,163,82,158,43,157,
+  84,202,199,117,93,190,249,141,39,249,238,211,223,35,222,16,193,150,38,134,105,32,45,137,25,49,73,36,4,55,166,10,
+  252,229,228,105,30,255,242,23,24,184,58,136,167,84,189,254,243,0,123,14,238,137,52,234,166,115,159,121,100,231,170,77,
+  31,217,104,143,142,142,242,183,83,175,111,184,220,223,79,121,182,204,111,142,253,22,91,26,72,203,64,218,146,128,29,64,
+  74,11,211,52,17,134,129,227,56,140,140,142,51,57,57,197,212,212,20,158,235,95,120,87,0,9,209,252,139,199,118,239,
+  110,255,208,186,117,242,79,175,158,96,100,100,148,137,27,55,228,242,229,173,84,230,42,100,50,87,145,150,129,109,219,4,
+  67,65,2,129,0,182,148,152,150,133,16,243,191,81,235,114,193,91,151,251,89,214,28,103,38,63,179,21,248,99,61,0,
+  198,19,251,246,173,15,4,131,187,30,218,188,73,158,75,255,147,66,161,128,175,20,107,215,172,229,222,246,118,206,95,120,
+  3,229,123,88,150,69,48,24,36,20,12,18,10,133,8,57,33,28,39,68,56,236,224,56,14,241,120,35,115,115,115,52,
+  196,98,248,90,61,90,111,7,140,80,64,30,252,236,174,93,78,62,63,67,246,218,48,45,201,22,158,252,250,126,198,114,
+  57,90,151,39,185,114,245,10,74,121,4,3,1,154,226,141,196,19,113,76,195,32,16,8,224,56,243,230,11,16,209,104,
+  4,223,247,208,154,77,7,14,28,144,117,1,128,216,217,150,106,51,135,178,131,40,165,72,36,226,196,98,141,12,13,101,
+  137,70,163,148,138,101,44,203,36,222,28,167,163,163,131,142,142,14,86,164,86,80,169,86,107,230,225,69,144,104,52,76,
+  165,82,197,150,82,150,203,229,213,245,0,88,174,231,222,99,75,73,62,159,7,192,83,154,139,23,47,80,44,149,208,90,
+  99,88,6,82,74,18,137,4,45,45,73,150,37,151,161,180,98,124,98,2,199,113,48,77,19,141,198,115,61,194,97,135,
+  74,213,69,24,6,30,94,162,46,0,165,148,84,90,81,42,21,1,40,206,228,41,22,10,120,158,135,231,185,216,82,34,
+  45,137,239,251,84,170,85,138,197,34,158,235,161,124,69,200,9,97,89,22,90,107,92,215,37,88,46,227,123,62,190,239,
+  81,173,170,186,198,188,37,12,195,155,157,157,181,132,152,159,73,19,147,19,40,165,81,218,103,110,174,66,48,24,192,180,
+  76,242,249,25,178,195,89,38,198,39,152,158,158,70,218,18,39,20,66,74,137,63,150,131,103,126,68,50,51,8,74,209,
+  62,95,251,244,99,75,24,10,240,5,92,208,176,251,9,24,180,76,211,188,62,51,147,191,199,52,230,129,75,165,50,74,
+  41,108,59,192,248,248,4,145,72,4,219,150,8,4,35,215,175,163,181,192,146,22,27,30,88,79,48,20,196,182,3,76,
+  31,234,165,189,41,78,203,167,62,141,48,238,56,92,1,208,74,153,185,116,250,129,129,116,250,40,240,49,75,107,253,106,
+  102,112,112,95,60,222,104,0,72,41,113,93,151,72,216,97,248,218,117,82,169,86,38,39,199,65,107,98,177,38,98,177,
+  24,209,88,148,112,56,140,109,7,112,156,16,99,151,222,166,101,255,126,110,60,255,60,218,117,255,39,128,144,146,228,222,
+  189,70,127,58,189,5,192,152,154,202,31,62,211,215,87,142,132,163,4,2,65,44,203,36,145,104,230,190,181,29,244,15,
+  92,33,28,10,177,172,57,137,16,98,49,140,90,88,150,73,48,24,68,43,133,48,12,180,235,34,44,139,200,246,237,183,
+  25,71,119,236,64,88,214,124,142,97,160,193,4,48,94,58,118,236,98,177,88,62,151,185,154,241,87,180,182,98,24,38,
+  99,185,49,218,218,218,24,28,202,82,169,86,136,68,162,132,195,81,180,214,181,0,173,53,190,175,168,86,111,189,6,56,
+  27,55,242,193,83,167,88,217,211,179,184,182,178,167,135,181,39,79,18,122,240,193,219,192,44,192,250,251,235,167,186,4,
+  250,196,214,45,155,19,45,201,164,25,176,3,252,227,204,25,213,220,28,55,180,82,4,164,69,107,170,149,201,241,113,148,
+  82,248,190,143,235,121,84,171,213,197,81,188,160,82,95,31,185,222,94,146,157,157,139,107,201,206,78,114,189,189,148,207,
+  158,93,18,64,244,247,247,79,87,85,245,75,229,185,217,111,59,65,103,187,214,202,31,25,25,125,179,161,177,105,135,235,
+  186,188,252,202,159,249,226,231,31,161,173,109,37,197,98,161,182,205,92,132,152,165,88,40,221,86,116,184,171,107,209,24,
+  32,215,219,187,184,182,20,128,7,120,67,3,67,185,161,129,161,110,32,4,4,77,211,12,111,218,182,237,254,145,209,177,
+  230,79,108,123,136,75,111,93,166,227,222,213,196,26,26,8,133,130,0,40,173,200,79,23,176,151,44,93,159,44,160,194,
+  252,197,100,161,151,62,224,250,190,95,185,158,205,62,115,252,165,63,124,203,52,205,85,66,8,163,255,74,134,117,107,215,
+  144,72,196,49,12,131,137,201,73,50,153,44,239,60,121,86,246,244,44,182,253,230,78,44,213,5,11,40,1,106,193,184,
+  6,100,3,86,54,147,249,107,54,147,57,185,144,60,243,225,245,59,7,50,131,159,179,12,107,147,48,12,91,105,255,223,
+  66,137,23,30,133,67,11,57,206,230,205,139,230,55,27,38,59,59,185,113,244,40,165,190,190,219,0,52,80,6,230,106,
+  198,1,64,50,191,77,110,238,140,190,124,241,141,35,192,225,90,110,165,6,13,55,1,204,158,63,207,229,135,31,166,240,
+  218,107,139,38,195,93,93,76,29,63,78,57,157,94,178,3,11,82,181,194,115,181,247,155,205,169,129,46,196,45,18,224,
+  107,165,76,33,37,218,117,111,49,95,80,241,244,233,249,92,41,231,231,70,13,222,186,45,243,86,160,186,100,64,95,46,
+  157,222,154,220,187,215,168,99,20,147,75,167,149,1,125,53,248,187,215,175,224,3,2,126,167,97,195,194,132,187,147,222,
+  121,24,189,23,254,119,165,255,2,42,94,210,26,247,166,50,222,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char NewFile1x[477] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,252,0,233,0,79,52,215,177,13,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,2,18,14,38,28,211,182,25,41,0,0,1,106,73,
+  68,65,84,56,203,173,144,79,75,91,81,16,197,127,115,239,141,86,36,125,37,130,208,202,91,22,220,212,238,92,102,169,
+  27,243,13,178,113,89,191,69,222,178,221,119,35,4,196,130,223,192,77,55,221,42,133,82,74,178,82,74,73,90,132,16,
+  255,69,98,155,222,119,199,133,38,198,24,147,84,122,54,51,12,115,230,156,51,82,46,151,183,107,181,90,145,17,152,157,
+  253,203,220,92,155,103,209,111,242,203,159,223,229,162,111,31,225,207,190,100,195,25,165,82,73,199,225,252,120,83,47,79,
+  223,104,231,188,160,151,39,43,157,139,198,226,174,182,178,235,218,50,51,174,171,210,108,54,9,33,0,32,34,61,245,140,
+  217,99,218,126,33,227,190,34,102,9,235,76,38,216,246,106,199,183,91,83,206,87,123,7,6,201,221,106,228,8,107,234,
+  136,121,133,184,2,96,49,42,70,211,95,139,224,94,186,254,172,131,228,235,94,111,58,11,76,129,56,16,11,130,0,23,
+  110,52,89,8,58,79,208,231,216,80,69,211,105,64,208,180,162,222,155,122,198,166,21,247,208,231,187,135,2,175,241,225,
+  39,224,177,90,1,20,239,95,232,233,89,235,211,204,252,247,131,145,17,68,4,229,41,29,93,67,117,129,52,253,1,60,
+  97,107,231,208,108,108,108,191,5,112,163,200,183,53,139,215,60,34,66,20,69,52,26,73,79,212,48,33,250,127,211,143,
+  123,17,134,57,120,136,124,199,193,176,165,193,217,176,29,51,169,221,177,17,114,185,28,143,129,139,227,248,67,146,36,197,
+  127,33,197,113,252,158,255,133,43,204,61,153,96,123,172,20,201,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char NewFile2x[1008] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,3,167,73,68,65,84,88,133,197,151,75,79,91,
+  71,20,128,191,51,115,109,12,198,46,16,76,32,37,155,170,82,217,100,209,13,21,139,238,186,233,182,127,128,5,187,254,
+  136,110,187,236,138,238,42,245,15,244,31,84,106,165,46,42,161,134,70,65,106,67,34,226,146,18,8,184,53,132,151,31,
+  220,153,211,197,181,145,177,239,195,184,84,61,210,104,102,52,215,115,190,243,154,241,192,255,44,242,95,108,170,202,24,39,
+  133,5,242,110,6,23,140,3,96,195,6,109,91,103,170,185,47,66,59,17,96,125,125,253,179,92,46,247,173,136,148,140,
+  49,24,99,240,222,227,189,39,12,67,156,115,177,125,119,60,94,120,203,244,59,199,76,22,79,153,24,111,16,4,87,120,
+  239,113,206,182,230,231,106,95,127,252,209,203,239,144,198,115,41,81,3,8,250,1,172,181,223,172,173,173,149,68,34,182,
+  48,12,9,130,160,99,153,246,89,170,55,199,250,6,209,223,16,221,1,221,3,173,33,52,162,53,41,142,253,240,227,197,
+  231,72,174,138,248,9,213,214,99,17,234,3,0,97,24,78,137,8,213,106,21,17,193,57,71,177,88,164,221,110,211,133,
+  234,239,163,113,155,188,221,34,31,108,19,152,29,114,193,62,86,106,168,68,17,48,210,102,241,193,229,24,20,30,161,192,
+  153,185,84,109,252,60,0,208,181,74,68,174,91,239,60,9,192,202,17,129,61,36,176,7,228,236,62,214,156,35,246,3,
+  144,123,157,47,234,204,85,182,64,242,75,224,207,193,215,56,159,124,49,0,224,189,143,85,152,6,2,16,4,167,88,243,
+  22,35,117,172,212,16,187,4,178,132,152,197,232,91,94,99,115,103,192,223,15,193,238,129,169,32,205,251,169,0,195,122,
+  162,235,98,145,38,70,154,32,227,32,51,136,121,8,246,195,206,198,130,152,151,32,229,28,122,85,70,100,2,111,75,177,
+  0,113,97,136,115,127,47,64,82,104,162,66,187,153,188,215,98,229,106,0,192,57,151,170,60,49,15,164,128,106,1,165,
+  128,250,75,196,212,163,74,112,221,157,95,163,254,47,208,211,16,220,25,170,151,4,110,176,10,226,0,146,230,55,173,157,
+  65,153,70,153,197,83,199,250,87,145,221,114,216,89,63,198,93,253,1,184,87,224,14,192,215,56,105,189,49,105,0,155,
+  155,155,177,0,113,205,115,31,229,1,94,223,197,249,69,156,47,130,219,6,247,164,211,182,57,60,106,130,182,182,209,118,
+  21,209,103,50,207,69,162,7,0,150,151,151,175,235,63,59,20,5,60,239,225,180,17,253,88,139,40,179,224,163,121,144,
+  43,83,221,125,204,210,251,173,167,208,126,74,177,185,5,49,39,161,115,14,85,141,172,186,101,73,42,21,156,62,2,38,
+  80,63,141,145,19,32,2,176,50,197,139,157,223,249,244,19,247,19,197,230,150,72,148,29,169,30,232,151,97,114,2,102,
+  113,76,163,28,227,57,66,244,28,36,143,55,11,252,242,235,247,200,228,197,147,222,61,135,174,130,44,229,55,75,47,64,
+  169,160,90,137,166,10,202,4,151,141,129,148,27,14,160,215,194,172,242,76,18,85,189,14,105,38,64,255,173,215,149,219,
+  158,13,105,183,103,34,64,24,134,177,74,179,128,226,0,250,101,104,15,196,41,206,58,7,70,5,72,60,136,0,54,54,
+  54,48,102,48,113,134,5,52,198,100,230,198,192,238,97,24,94,199,106,101,101,37,245,98,74,82,156,228,161,56,73,13,
+  65,255,213,156,230,137,248,51,33,91,82,67,48,140,210,172,181,44,152,216,42,72,42,195,81,192,186,199,122,146,140,228,
+  129,187,148,91,221,5,89,50,138,231,70,2,232,173,140,44,16,85,77,5,235,7,40,27,99,78,85,181,92,46,151,17,
+  137,222,5,65,16,252,235,188,0,200,231,243,103,192,60,112,12,180,250,1,74,64,101,111,111,239,203,213,213,213,47,68,
+  58,47,138,187,147,230,238,238,238,87,192,2,96,129,3,192,247,250,112,12,152,3,238,1,83,157,185,189,43,229,68,198,
+  94,0,117,224,79,224,28,226,95,199,99,64,161,211,223,213,235,217,1,87,68,110,111,209,243,63,253,31,124,49,200,214,
+  41,116,130,201,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char NewFolder1x[635] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,213,11,17,15,7,0,85,79,247,45,0,0,2,8,73,
+  68,65,84,56,203,165,144,61,104,83,97,20,134,159,239,246,222,150,123,83,73,219,180,36,164,181,10,86,92,21,7,21,
+  252,157,196,201,74,20,69,7,21,23,65,196,193,77,16,93,157,4,17,65,80,91,39,17,113,112,178,69,176,149,46,186,
+  212,64,37,14,45,65,45,66,219,104,171,33,189,247,230,187,63,199,33,33,173,165,65,197,135,15,190,225,156,243,158,247,
+  188,234,196,201,220,141,76,38,115,147,53,104,173,107,127,85,95,28,122,244,248,62,77,80,151,175,92,146,243,103,47,172,
+  91,244,125,143,135,67,15,40,151,203,167,159,61,125,254,36,156,63,170,0,11,8,204,244,11,105,8,228,142,29,167,240,
+  177,208,108,9,99,227,175,105,49,132,222,12,12,108,22,250,50,50,118,228,160,92,7,222,155,0,182,237,208,145,236,108,
+  42,144,27,28,164,187,227,27,3,27,103,233,72,245,16,132,214,161,216,40,222,85,241,220,109,83,107,141,231,185,188,250,
+  80,97,170,228,172,51,46,12,164,127,114,102,95,17,171,189,23,195,62,133,99,118,177,236,77,108,47,126,30,189,215,112,
+  48,85,114,184,115,245,48,190,142,126,15,137,144,100,235,52,89,187,132,237,100,105,49,83,40,101,96,153,54,161,72,194,
+  4,240,60,23,128,185,37,159,226,194,242,26,129,152,148,3,65,247,6,178,209,52,237,106,2,203,218,70,168,39,41,206,
+  181,98,250,190,143,109,59,77,239,23,12,150,188,30,10,165,157,84,244,12,253,250,45,118,91,30,55,72,48,146,239,199,
+  116,93,183,225,160,25,145,152,124,247,210,84,116,146,217,242,22,218,90,124,146,237,125,204,204,79,210,200,224,207,24,84,
+  35,135,170,91,235,109,179,109,170,129,137,177,58,131,191,37,138,98,252,64,0,86,28,88,70,140,0,34,130,82,10,17,
+  65,4,98,17,162,72,8,162,24,29,10,213,48,34,136,132,100,162,117,69,192,243,92,54,37,171,44,86,52,95,23,61,
+  16,69,140,80,127,136,128,32,136,212,133,129,48,90,229,96,190,180,192,142,61,123,201,127,250,81,31,170,109,23,129,24,
+  65,80,32,210,112,181,107,107,23,163,47,71,232,244,103,135,213,254,115,183,198,93,171,247,0,255,72,34,248,242,238,205,
+  240,181,221,252,47,191,0,92,182,248,138,55,225,154,169,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char NewFolder2x[1399] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,5,46,73,68,65,84,88,133,237,150,203,142,28,
+  73,21,134,191,136,204,172,172,123,85,219,237,246,116,247,152,49,140,25,152,25,216,33,193,14,137,89,176,2,36,216,120,
+  5,66,60,128,247,214,72,120,205,30,9,158,129,87,48,59,132,64,130,141,5,140,4,152,25,172,158,238,174,174,170,118,
+  221,178,50,43,35,226,28,22,229,174,190,84,219,110,35,143,52,18,28,233,72,169,80,196,249,191,248,79,68,102,194,255,
+  122,152,207,162,168,78,185,65,72,219,68,90,65,77,32,90,204,168,51,48,134,242,185,0,247,239,223,127,232,189,255,224,
+  42,2,81,20,61,76,211,244,187,15,30,60,144,53,97,155,220,38,36,219,216,184,139,152,20,36,96,116,10,190,135,231,
+  137,217,40,62,57,187,38,62,121,240,222,127,112,247,238,93,178,44,67,68,16,17,66,8,136,8,170,186,74,128,71,143,
+  30,125,179,223,239,127,7,120,184,18,207,216,65,171,239,33,233,29,140,189,133,38,55,176,84,193,56,8,35,112,7,68,
+  229,117,157,86,106,166,85,126,180,6,96,173,93,236,237,237,165,251,251,251,136,8,222,251,21,200,73,158,64,52,26,141,
+  186,136,252,224,4,64,143,233,32,213,119,48,213,247,161,242,30,38,254,18,68,111,128,109,0,14,227,7,104,244,111,34,
+  83,39,44,208,121,109,98,234,249,167,23,29,144,110,183,75,150,101,132,16,214,242,4,64,68,48,198,68,198,152,159,222,
+  187,119,239,103,198,24,126,241,235,99,251,133,221,190,185,245,230,200,238,110,103,118,163,27,153,40,222,5,211,36,137,23,
+  121,90,217,111,162,7,29,20,176,58,39,44,134,170,28,24,131,172,0,84,181,232,245,122,181,94,175,71,8,97,229,192,
+  137,248,89,0,128,122,189,222,216,220,220,164,211,169,113,115,243,99,182,54,3,91,215,23,92,219,112,216,248,93,108,116,
+  7,99,175,17,252,172,134,253,215,28,216,64,247,222,66,147,67,8,55,121,74,11,24,159,115,160,217,108,210,110,183,241,
+  222,227,189,95,115,224,36,159,1,47,207,75,24,210,172,30,226,218,199,24,51,69,233,2,59,152,232,43,216,232,109,148,
+  190,193,152,4,211,23,228,224,6,68,93,212,180,72,235,117,152,159,2,136,72,62,24,12,56,58,58,90,57,112,81,60,
+  132,176,118,32,27,245,156,110,107,76,81,100,72,40,17,137,176,164,64,27,27,127,121,57,207,212,13,164,6,76,12,26,
+  131,141,32,172,221,2,95,175,215,105,183,219,252,125,96,249,221,94,243,69,55,113,21,77,63,103,58,123,140,102,9,173,
+  66,169,134,146,138,76,80,191,143,240,7,68,38,204,221,211,182,47,75,70,211,173,27,143,62,222,254,226,95,158,220,250,
+  209,135,63,252,229,111,206,1,168,234,124,56,28,210,239,247,233,141,186,124,255,219,223,224,91,95,219,189,18,68,183,250,
+  103,58,213,14,157,106,133,102,250,152,40,62,192,216,4,232,97,77,65,148,236,35,118,136,154,29,190,254,206,87,249,253,
+  71,33,166,203,244,28,128,115,206,167,105,74,171,213,34,204,234,52,106,21,254,121,48,227,112,148,191,20,96,163,30,177,
+  219,173,177,221,105,115,179,189,201,102,227,19,226,228,24,99,150,183,80,228,152,241,188,201,113,118,29,175,215,120,50,76,
+  38,198,44,123,112,214,129,108,60,30,51,24,12,152,21,77,234,213,132,210,203,115,69,207,198,40,223,166,86,25,147,216,
+  2,128,50,84,105,84,38,36,209,132,160,49,69,249,6,163,252,26,227,252,77,202,240,22,123,125,25,156,172,93,1,132,
+  16,124,20,69,203,91,48,171,208,168,38,100,51,119,37,0,85,203,209,228,206,210,73,73,201,202,14,181,100,74,28,121,
+  68,44,11,223,96,148,117,152,150,111,147,23,239,163,252,181,127,25,192,108,50,153,48,26,141,40,220,54,181,52,161,124,
+  186,184,18,0,128,151,10,7,163,119,153,21,155,116,106,135,84,43,51,34,227,80,181,76,139,38,251,163,93,154,181,29,
+  140,119,4,180,183,6,224,156,43,163,40,162,213,106,225,198,150,90,26,227,194,213,90,176,114,2,195,164,216,98,82,108,
+  97,77,0,132,133,51,20,207,140,220,104,89,38,51,7,94,246,215,0,84,117,154,101,25,211,89,6,220,38,137,13,65,
+  244,149,0,78,107,193,34,88,74,7,162,167,53,42,145,101,150,151,33,160,159,174,1,56,231,74,85,37,109,116,104,104,
+  194,180,240,47,21,81,61,21,208,229,38,16,1,47,130,94,194,110,140,97,150,149,37,202,165,135,112,146,231,57,227,210,
+  211,172,199,100,103,0,84,33,136,34,170,4,89,230,101,2,47,11,81,101,156,229,94,141,30,175,1,148,101,89,136,8,
+  113,181,77,154,86,152,47,2,62,40,46,40,33,8,255,93,51,206,71,16,101,60,43,213,42,71,107,0,34,50,201,243,
+  156,145,45,177,13,195,241,172,36,47,195,107,144,61,13,23,132,172,112,198,112,201,123,192,123,175,34,178,136,170,205,52,
+  68,9,121,25,150,187,190,176,245,171,56,241,188,246,20,165,176,40,92,66,133,225,26,128,170,78,156,115,102,186,16,170,
+  54,34,43,2,206,159,86,122,161,176,190,104,206,114,212,0,147,220,227,36,84,254,244,171,31,31,195,79,214,0,140,136,
+  56,146,102,37,168,33,119,178,250,228,234,122,189,11,3,47,249,185,86,80,3,195,201,130,8,51,7,179,170,114,238,99,
+  180,40,189,29,46,170,236,196,9,11,247,42,47,161,171,29,209,209,211,41,170,254,49,208,5,70,231,0,142,142,142,254,
+  40,183,191,151,56,31,243,248,31,79,94,65,252,234,97,84,134,135,127,251,237,207,207,141,157,121,174,1,155,207,232,106,
+  64,250,26,181,29,32,64,6,28,1,3,158,217,118,177,121,230,153,112,13,72,94,51,128,3,114,78,254,197,254,31,159,
+  151,248,15,186,190,74,254,47,72,106,105,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Open1x[672] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,2,29,73,68,65,84,56,141,141,147,191,75,151,81,20,198,63,231,125,
+  175,111,73,160,107,4,225,210,82,208,24,168,75,63,164,37,13,114,106,208,165,197,193,160,230,134,254,130,134,16,55,135,
+  138,6,251,15,4,35,133,8,77,43,104,104,138,16,33,181,69,66,45,205,239,247,222,115,207,105,248,234,155,150,96,207,
+  112,238,185,151,123,159,231,57,231,222,43,67,67,67,28,68,202,205,134,136,148,238,46,34,2,64,81,20,34,34,180,181,
+  181,125,254,181,221,184,92,85,213,250,254,254,208,213,213,245,212,221,111,238,47,44,45,127,57,241,236,201,115,138,162,64,
+  68,216,39,17,17,38,95,76,158,159,158,158,250,128,115,17,248,1,16,204,108,112,112,112,176,211,204,200,57,51,54,254,
+  152,149,149,21,154,205,38,0,238,78,206,25,51,99,120,104,152,173,205,205,179,11,239,23,230,227,110,186,84,85,213,110,
+  72,41,185,170,178,190,190,142,170,238,91,102,241,221,226,161,210,122,186,187,1,24,29,189,43,229,68,184,48,55,255,102,
+  12,99,100,143,32,161,170,152,25,34,66,85,85,244,93,235,195,221,107,23,101,89,214,34,189,61,189,242,118,97,238,182,
+  25,35,65,85,77,53,147,115,174,29,132,16,152,153,125,69,206,185,118,112,245,202,53,98,140,173,137,128,153,21,80,16,
+  82,74,30,99,172,9,246,186,77,255,141,129,90,253,239,177,253,100,59,56,6,16,98,140,166,170,76,204,59,13,13,208,
+  121,139,129,135,47,113,107,137,249,129,216,34,216,75,218,251,59,202,162,88,13,170,74,74,137,157,8,143,238,95,231,40,
+  72,29,254,32,170,241,96,124,230,76,72,41,89,74,9,112,74,129,143,203,91,71,146,28,68,89,10,231,78,159,2,113,
+  15,41,37,83,77,8,80,136,80,133,226,88,130,108,142,27,8,98,123,215,152,17,9,196,100,148,114,176,226,195,208,236,
+  52,147,161,102,52,83,6,240,160,170,22,99,68,36,240,109,163,193,207,134,162,217,73,217,49,115,204,157,108,78,210,86,
+  14,16,74,97,245,251,46,136,88,16,17,51,51,4,216,216,142,108,55,148,164,255,122,8,165,212,157,44,10,216,220,137,
+  136,187,7,119,103,109,163,245,96,94,127,90,173,63,207,113,216,217,217,5,145,175,33,23,237,179,83,75,29,119,192,89,
+  94,90,251,175,195,180,188,108,100,228,222,111,248,2,75,29,117,50,217,195,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Open2x[1550] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,5,139,73,68,65,84,88,133,197,150,205,143,28,71,25,198,127,245,49,
+  221,51,187,227,241,238,26,17,197,6,129,129,149,18,11,129,76,62,128,56,201,58,7,98,229,224,68,33,144,61,244,197,
+  130,43,7,254,1,36,255,5,36,23,20,32,66,73,20,205,45,178,184,36,36,50,78,2,56,7,48,72,17,200,226,176,
+  9,193,33,235,104,179,51,59,187,179,51,211,31,213,85,197,97,103,123,103,122,102,140,197,70,202,35,149,234,179,223,231,
+  169,247,125,171,171,68,20,69,124,150,208,183,179,40,203,19,127,187,6,165,148,46,168,84,94,79,98,179,26,4,65,239,
+  208,2,154,205,166,248,225,234,83,252,230,249,23,168,215,235,51,215,121,191,167,177,221,110,203,23,95,122,225,177,119,255,
+  254,238,59,89,146,125,39,8,130,248,80,2,46,94,188,40,174,255,243,31,172,175,175,79,16,122,239,113,206,225,156,35,
+  207,115,140,49,196,113,204,183,78,223,35,142,223,121,252,27,191,123,227,181,183,230,107,243,15,245,251,125,51,203,190,252,
+  95,2,174,95,191,46,0,47,165,100,191,8,33,144,82,162,148,66,107,141,82,138,74,165,66,16,4,84,171,85,164,148,
+  60,254,248,19,60,250,189,115,247,247,227,222,27,89,150,169,91,122,96,121,121,89,103,89,118,197,90,251,64,121,129,247,
+  158,27,255,249,64,40,165,10,55,3,188,253,135,183,113,206,142,173,211,90,115,223,189,247,147,101,25,97,24,242,253,39,
+  159,18,222,251,179,151,175,92,254,237,242,87,150,159,88,91,91,115,83,5,36,73,242,229,106,181,122,239,249,243,231,117,
+  28,199,5,145,115,14,107,45,191,122,254,57,164,148,99,100,103,87,206,22,237,209,113,231,28,141,70,131,75,151,46,1,
+  240,133,19,95,20,167,191,121,250,177,107,127,253,203,79,181,12,126,62,85,64,150,101,105,173,86,243,55,111,222,164,213,
+  106,21,241,245,222,99,173,69,8,129,82,138,36,73,8,195,16,128,63,93,253,35,214,142,111,40,168,84,56,115,230,65,
+  148,82,156,58,117,10,99,12,121,158,115,247,93,119,171,247,255,181,246,179,231,126,241,235,103,162,40,242,19,2,140,49,
+  73,154,166,98,105,105,17,107,45,206,185,9,1,82,74,94,123,253,85,30,89,121,132,165,165,99,60,252,208,195,128,152,
+  240,130,148,146,32,8,80,74,97,173,197,24,67,16,4,116,58,219,141,11,23,46,132,198,152,100,66,0,144,166,105,170,
+  90,173,54,173,86,171,16,176,31,2,239,61,74,41,158,254,193,106,97,248,205,183,222,28,203,129,50,188,247,4,65,192,
+  3,223,61,131,214,26,63,170,178,44,224,216,177,99,73,167,211,81,139,139,11,24,99,198,4,24,99,138,236,223,135,82,
+  138,115,143,158,27,35,43,147,143,182,181,214,0,179,5,172,173,173,101,141,70,67,110,109,109,21,30,0,138,243,189,79,
+  58,106,252,247,87,46,99,173,155,32,31,69,80,169,176,178,114,182,248,118,26,196,254,93,48,63,63,111,86,87,87,245,
+  230,230,38,215,62,116,92,125,223,23,132,251,33,56,12,172,181,32,100,190,183,25,241,242,87,187,175,254,8,70,254,132,
+  222,123,211,110,183,117,187,221,230,70,171,206,143,159,252,54,95,59,177,200,193,252,176,190,21,203,20,111,148,70,244,122,
+  171,199,47,95,185,246,96,49,48,162,208,212,235,243,53,99,12,230,223,146,35,181,128,15,62,233,179,51,200,1,63,204,
+  247,18,166,14,150,38,196,65,85,15,53,89,102,16,130,214,254,116,145,89,214,90,211,233,108,211,110,183,233,103,142,122,
+  45,32,119,30,33,64,32,134,38,74,197,207,42,254,160,184,189,226,156,39,206,44,73,154,131,23,27,19,30,240,222,167,
+  213,106,200,194,194,2,105,46,152,11,53,222,165,104,57,185,77,63,179,51,219,53,189,36,103,238,136,166,187,147,227,156,
+  47,110,182,66,64,158,231,89,183,187,75,167,179,141,177,159,167,22,106,60,30,53,20,112,219,15,130,210,98,239,97,55,
+  49,100,185,35,212,146,56,49,206,218,252,230,132,0,107,109,26,4,21,106,71,22,105,204,5,120,64,34,110,17,231,91,
+  240,14,191,177,222,211,75,12,214,121,180,18,84,3,69,63,78,51,33,196,230,132,0,231,92,186,187,219,99,99,59,227,
+  232,252,18,38,119,40,37,166,88,159,185,217,49,164,198,49,72,45,120,81,132,49,80,146,221,126,154,11,14,146,112,212,
+  3,137,214,26,21,134,212,169,208,79,45,214,150,204,139,177,106,152,99,190,168,173,243,56,15,89,238,38,78,164,24,170,
+  221,222,77,93,238,253,164,0,231,92,220,235,245,104,109,107,106,11,1,189,216,144,230,14,49,220,101,110,29,198,122,76,
+  238,200,237,94,134,123,49,65,81,106,141,15,196,198,178,211,139,149,144,106,106,8,18,33,4,50,172,163,117,133,110,108,
+  216,141,13,113,102,49,198,237,185,90,148,237,78,73,144,146,151,70,209,79,115,250,137,209,204,8,193,96,48,232,179,213,
+  173,18,214,224,198,230,128,157,193,193,83,110,214,254,196,140,36,45,59,71,0,221,65,70,150,219,202,223,142,191,183,117,
+  215,90,73,128,115,110,0,2,167,231,72,173,163,59,48,100,198,141,89,152,117,32,103,68,98,108,92,74,193,230,78,130,
+  20,114,16,141,60,205,198,114,32,142,99,186,177,229,248,157,33,115,85,77,53,248,255,200,198,150,12,93,36,133,32,78,
+  82,164,20,59,163,243,163,2,250,0,198,87,168,87,5,243,122,226,253,88,24,155,133,242,252,104,223,121,79,167,147,34,
+  188,216,154,16,208,108,54,131,149,149,21,219,29,100,108,15,60,31,109,108,15,159,223,83,89,110,155,116,180,239,61,108,
+  108,236,216,204,12,254,220,108,54,117,20,69,57,236,121,78,2,159,59,121,242,228,211,39,238,91,125,54,57,250,117,53,
+  229,247,127,40,120,112,2,200,211,254,71,31,190,243,242,79,90,239,93,189,10,236,68,81,228,246,175,182,6,240,37,29,
+  134,119,84,171,71,27,148,78,248,97,224,156,51,214,90,159,35,156,29,116,186,192,199,192,58,16,71,81,228,69,20,69,
+  52,155,77,9,4,128,226,224,190,253,180,225,135,197,0,121,20,69,14,70,158,100,159,21,254,11,203,184,36,40,178,187,
+  82,47,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Properties1x[464] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,11,4,10,21,27,198,210,43,84,0,0,1,93,73,
+  68,65,84,56,203,173,147,189,106,194,80,24,134,159,175,186,25,13,145,108,14,14,130,34,222,130,102,117,232,216,161,215,
+  224,45,56,40,113,200,37,136,46,93,116,105,233,218,193,81,112,245,2,78,68,232,162,100,208,156,213,41,118,16,131,49,
+  162,8,125,167,195,251,113,158,239,239,28,1,24,143,199,223,65,16,188,241,156,222,251,253,254,23,0,174,235,30,159,149,
+  235,186,71,128,236,37,114,191,223,19,69,17,0,34,18,251,231,179,136,144,201,100,48,77,51,142,37,0,81,20,225,251,
+  126,226,194,165,68,132,122,189,158,240,178,215,141,213,106,53,0,122,189,94,236,117,58,29,74,165,82,10,8,240,114,157,
+  193,247,125,86,171,21,237,118,27,173,53,90,107,60,207,67,41,133,82,234,62,0,96,58,157,98,24,6,205,102,147,110,
+  183,139,101,89,88,86,129,106,181,26,87,119,23,112,206,184,88,44,240,60,15,17,65,36,203,118,251,123,115,151,169,22,
+  78,25,45,102,179,25,197,98,49,142,141,70,31,4,65,240,184,130,203,222,195,48,36,12,67,180,214,28,14,7,134,195,
+  33,187,221,238,254,22,90,173,22,142,227,196,21,109,54,27,38,147,9,133,66,129,92,46,199,124,62,167,82,169,220,6,
+  136,8,74,169,212,59,112,28,135,245,122,141,97,24,228,243,249,199,239,224,52,184,36,164,209,104,176,92,46,239,3,46,
+  135,118,45,211,52,41,151,203,41,63,11,96,219,246,207,96,48,120,125,230,43,218,182,253,201,127,232,15,224,142,163,230,
+  109,49,155,36,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Properties2x[1115] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,4,18,73,68,65,84,88,133,229,151,223,106,20,
+  73,20,198,127,167,170,187,39,155,56,99,194,152,33,131,130,160,56,147,68,80,17,17,124,141,125,1,23,124,143,189,221,
+  203,189,18,188,204,19,236,43,8,222,8,138,34,248,143,104,192,191,152,139,137,177,153,36,211,51,221,93,213,123,17,187,
+  232,233,244,100,50,113,239,246,192,161,186,206,64,125,95,125,231,156,170,26,248,191,155,148,3,247,239,223,255,221,247,253,
+  13,17,169,43,165,80,74,97,173,197,90,75,154,166,24,99,42,199,105,49,17,217,139,227,248,143,141,141,141,127,142,101,
+  244,224,193,131,31,198,152,204,90,155,89,107,179,56,142,221,183,49,102,204,211,52,117,158,36,201,152,199,113,236,124,52,
+  26,101,163,209,40,187,119,239,222,143,50,158,87,14,164,105,186,40,34,124,248,240,1,17,193,24,195,194,194,2,113,28,
+  35,114,40,88,121,116,114,202,17,65,1,200,178,140,86,171,69,146,36,139,83,9,100,89,230,22,203,189,56,63,13,129,
+  73,241,74,2,214,218,74,64,17,97,107,107,11,99,76,229,130,85,49,173,53,157,78,103,34,248,84,2,69,112,17,225,
+  202,149,43,149,74,76,34,80,182,92,221,169,4,170,210,32,34,188,127,255,30,99,76,37,224,36,5,186,221,238,108,4,
+  138,0,229,58,232,116,58,99,187,15,195,144,87,175,94,97,173,101,97,97,129,243,231,207,211,110,183,143,45,198,83,17,
+  200,231,101,5,210,52,37,138,34,210,52,101,48,24,176,179,179,195,214,214,22,205,102,19,17,65,107,205,234,234,234,233,
+  9,60,127,254,156,27,55,110,184,121,183,219,61,146,255,110,183,203,227,199,143,137,162,8,165,20,73,146,112,238,220,57,
+  218,237,246,175,41,0,112,251,246,109,215,255,34,194,187,119,239,42,107,160,217,108,242,241,227,71,172,181,24,99,120,253,
+  250,53,223,191,127,199,243,60,214,214,214,102,39,144,101,25,34,114,164,37,59,157,14,74,169,202,179,225,243,231,207,192,
+  97,225,137,8,215,174,93,59,2,150,175,119,98,5,138,54,24,12,120,250,244,41,75,75,75,248,190,239,226,34,66,150,
+  101,206,211,52,197,90,203,203,151,47,241,60,143,245,245,245,217,21,40,238,46,247,253,253,125,60,207,99,111,111,143,155,
+  55,111,82,175,215,93,33,62,124,248,144,225,112,72,173,86,67,41,197,242,242,50,215,175,95,255,53,5,202,93,48,55,
+  55,71,20,69,24,99,120,244,232,17,65,16,160,181,102,48,24,16,69,145,83,197,90,75,24,134,188,120,241,130,32,8,
+  184,122,245,170,219,253,137,9,84,73,213,104,52,88,90,90,226,224,224,128,36,73,136,227,152,36,73,220,209,44,34,248,
+  190,143,231,121,4,65,128,49,134,213,213,213,177,98,173,90,87,149,3,105,154,142,205,243,197,149,82,92,190,124,153,252,
+  141,160,148,194,243,60,124,223,39,8,2,167,136,231,121,40,165,136,162,136,205,205,77,183,70,174,206,137,20,40,2,23,
+  137,244,122,61,230,231,231,217,221,221,117,71,118,49,85,214,90,167,74,28,199,68,81,196,252,252,60,151,46,93,154,157,
+  0,192,147,39,79,184,117,235,150,155,175,173,173,185,55,66,24,134,68,81,68,173,86,163,213,106,49,24,12,120,246,236,
+  25,89,150,185,84,248,190,79,191,223,103,123,123,155,139,23,47,30,1,175,36,144,166,169,203,213,157,59,119,136,227,216,
+  41,240,246,237,219,177,235,56,31,123,189,30,0,103,206,156,161,215,235,49,28,14,209,90,163,181,102,101,101,133,126,191,
+  95,9,126,172,2,229,131,8,96,125,125,253,72,123,230,7,83,238,97,24,178,185,185,137,214,218,41,161,181,158,157,64,
+  149,189,121,243,102,172,234,139,228,138,223,121,43,106,173,185,112,225,194,108,4,138,41,40,91,174,64,121,215,85,106,132,
+  97,200,183,111,223,92,183,156,152,192,175,40,224,251,190,187,61,23,23,15,223,159,59,59,59,255,29,129,105,10,228,247,
+  66,110,103,207,158,69,68,78,87,132,199,89,241,201,118,220,239,112,216,25,199,89,153,64,67,41,213,207,178,172,209,104,
+  52,92,207,123,158,55,177,46,166,153,136,80,175,215,1,8,130,96,15,88,1,126,0,163,50,129,58,176,252,245,235,215,
+  191,238,222,189,251,167,136,252,118,42,196,201,54,252,244,233,211,223,64,27,208,192,54,96,139,26,214,128,22,208,4,22,
+  127,206,39,247,207,140,224,28,110,246,0,216,5,190,0,251,80,241,231,244,39,240,220,207,113,250,99,255,100,102,128,132,
+  67,217,71,128,203,231,191,94,165,116,248,246,108,4,213,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Quit1x[799] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,2,156,73,68,65,84,56,141,117,147,79,104,20,73,20,198,127,175,170,
+  186,187,122,178,131,123,136,30,140,32,234,206,97,47,226,69,65,133,16,209,171,104,80,195,170,228,40,30,12,44,26,15,
+  146,187,46,30,246,224,31,140,160,87,69,80,47,158,68,80,20,36,106,4,133,21,28,221,29,119,66,38,108,64,103,162,
+  201,244,100,58,157,238,169,61,196,25,255,63,248,168,122,151,175,126,95,61,158,28,28,220,127,50,73,146,17,126,80,34,
+  130,239,251,216,192,98,140,1,17,178,44,197,6,246,207,179,103,206,159,48,73,146,140,244,239,218,67,185,92,38,138,34,
+  26,141,6,205,102,147,56,142,73,211,148,11,23,206,163,148,66,107,131,82,10,128,102,220,228,236,185,51,195,192,105,3,
+  16,4,1,65,16,144,36,9,105,154,210,106,181,112,206,161,181,6,64,41,141,49,230,99,47,104,109,232,89,217,3,144,
+  87,0,249,124,158,48,12,201,229,114,132,97,216,185,91,107,1,65,4,68,20,165,209,139,60,216,190,29,17,193,218,16,
+  192,152,118,78,107,45,206,185,78,110,17,65,41,133,8,184,44,227,217,209,33,178,106,149,15,197,34,245,191,95,195,127,
+  211,252,51,58,218,109,150,16,21,90,107,180,214,248,190,79,150,101,29,179,180,94,231,201,254,131,116,23,10,172,30,24,
+  32,46,151,25,223,187,143,101,201,2,79,203,19,247,58,4,109,19,165,84,71,54,138,120,216,219,199,218,29,59,88,190,
+  110,29,233,244,52,235,15,29,2,17,196,24,238,28,62,188,20,161,77,209,150,214,154,220,212,20,171,110,222,164,176,115,
+  39,63,25,67,116,255,62,40,181,36,17,242,125,125,136,82,116,12,218,175,183,207,238,91,183,88,93,40,96,227,152,232,
+  249,115,90,113,76,171,209,160,53,63,143,238,234,34,88,179,6,68,80,159,19,124,30,225,237,224,32,111,94,189,98,186,
+  88,68,133,33,139,149,10,217,220,28,46,77,201,234,117,146,74,5,151,101,159,8,218,255,208,54,74,86,172,96,234,200,
+  17,114,55,174,19,55,155,172,220,176,1,29,134,44,46,44,208,82,138,249,106,21,156,147,14,193,247,166,145,134,33,183,
+  183,108,193,21,126,161,92,169,144,68,17,127,141,143,243,239,228,36,47,138,47,241,186,186,158,126,97,96,140,233,104,98,
+  98,130,192,250,12,13,31,227,215,203,151,88,214,191,155,215,165,18,218,90,54,62,30,99,242,248,48,251,162,168,255,139,
+  8,158,231,81,122,83,194,134,62,191,29,24,32,159,207,163,181,38,106,212,89,254,251,16,178,170,135,217,187,119,153,157,
+  251,64,181,246,14,96,222,0,120,158,71,173,86,37,89,92,96,243,214,77,120,158,143,115,45,230,234,179,128,124,218,204,
+  109,189,252,188,173,151,247,239,107,204,204,204,44,25,248,190,127,234,234,181,43,35,181,90,21,17,97,236,209,216,55,235,
+  252,117,57,231,8,130,224,15,32,253,31,63,61,253,93,147,0,165,101,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Quit2x[1725] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,6,58,73,68,65,84,88,133,157,151,77,104,92,215,21,199,127,247,125,
+  206,183,173,177,12,178,198,182,198,145,210,84,137,141,48,38,8,39,81,179,48,169,86,193,96,18,104,136,77,91,178,200,
+  166,197,219,224,85,55,77,19,39,133,102,149,77,10,73,63,232,190,116,81,104,67,178,72,198,166,245,34,24,34,172,34,
+  169,184,110,98,235,219,150,70,111,222,215,189,183,139,153,247,252,102,52,51,10,61,112,153,55,239,205,187,231,247,63,231,
+  204,189,231,10,173,53,255,135,9,192,4,28,192,234,92,39,166,1,9,68,157,161,58,247,250,154,5,240,250,149,215,126,
+  25,69,209,181,239,228,89,8,12,195,192,117,93,242,249,2,185,92,14,199,182,49,12,3,141,70,74,69,24,134,184,174,
+  251,193,245,119,222,187,6,4,29,160,193,0,81,20,93,251,241,149,159,178,184,184,72,171,213,34,138,34,130,32,32,12,
+  67,162,40,74,71,28,199,72,41,177,44,139,98,161,192,213,171,87,25,31,63,134,16,162,19,20,208,90,227,121,30,239,
+  253,250,250,85,224,237,142,243,129,81,176,210,11,203,194,52,77,44,203,66,74,153,94,43,165,80,74,145,164,202,48,12,
+  28,199,161,92,174,144,207,231,48,77,11,33,68,7,162,13,80,42,149,24,25,169,2,148,128,102,135,110,56,128,227,56,
+  88,150,133,109,219,72,41,209,90,119,141,196,180,214,56,142,67,177,88,196,178,218,161,55,12,35,19,1,5,64,169,84,
+  2,200,209,93,31,131,1,92,215,197,113,28,164,148,216,182,13,144,42,215,90,167,42,181,214,216,182,141,227,56,24,134,
+  145,81,47,58,51,25,128,198,105,207,97,102,30,12,7,112,28,39,5,72,20,39,142,129,212,89,2,96,119,10,47,49,
+  33,32,9,84,155,71,36,52,67,45,253,129,16,2,211,52,113,28,7,215,117,83,39,182,109,227,186,110,154,30,203,178,
+  210,122,73,224,250,137,20,143,239,137,191,60,253,116,225,143,66,156,27,26,129,36,148,134,97,96,154,38,174,235,166,247,
+  18,229,66,8,148,82,25,128,193,2,19,182,133,247,223,47,54,239,220,249,179,128,105,160,56,52,2,217,156,38,223,19,
+  197,89,245,143,1,6,135,22,96,253,139,47,74,183,223,122,235,175,83,175,188,50,147,63,118,172,111,49,118,1,100,29,
+  247,2,37,213,110,154,102,166,242,97,80,141,9,207,227,179,249,249,79,190,247,234,171,211,147,87,174,88,131,104,173,174,
+  151,50,16,189,64,174,235,50,53,53,197,222,222,30,219,219,219,153,252,239,183,112,107,139,252,175,174,243,228,203,47,215,
+  79,188,244,146,169,118,119,65,41,227,79,66,60,234,249,233,55,251,0,250,169,79,114,111,219,54,71,143,30,229,200,145,
+  35,52,155,201,250,146,125,31,252,245,13,62,155,251,1,211,115,115,140,159,63,111,122,55,111,82,56,119,142,185,119,223,
+  181,49,12,27,173,65,107,116,28,243,183,55,222,40,30,24,129,236,223,239,198,141,27,84,42,21,102,103,103,113,93,119,
+  159,114,127,109,141,79,159,127,129,227,51,51,28,59,125,26,175,209,64,75,201,206,231,159,35,204,118,9,104,165,32,142,
+  41,95,184,48,56,5,189,234,147,113,248,240,97,70,71,71,201,229,114,220,189,123,183,203,121,235,254,125,62,125,97,142,
+  218,244,52,71,79,157,162,217,104,128,148,96,89,109,231,73,205,40,133,150,18,229,121,251,1,122,163,208,155,142,74,165,
+  194,217,179,103,89,89,89,233,212,65,71,249,234,42,127,63,255,28,181,201,73,142,140,141,177,247,229,151,160,20,194,182,
+  193,52,17,166,137,142,34,180,82,24,174,59,28,96,144,122,219,182,153,153,153,97,115,115,147,133,133,5,106,181,218,99,
+  245,15,30,16,110,109,225,78,76,16,44,45,17,173,174,34,44,11,29,4,40,207,67,54,155,232,32,104,11,180,44,140,
+  66,129,252,233,211,109,127,131,34,208,171,126,122,122,154,56,142,105,52,26,233,106,153,216,200,204,12,179,191,251,132,197,
+  175,190,162,245,232,17,102,185,76,176,178,66,120,239,30,241,230,102,234,28,64,199,49,114,103,135,120,99,163,63,64,111,
+  26,132,16,148,74,37,132,16,220,186,117,11,203,178,200,229,114,233,58,144,164,161,118,241,34,103,63,254,152,127,45,47,
+  227,71,17,249,51,103,210,194,195,48,246,13,29,69,253,83,144,77,67,242,233,121,30,11,11,11,104,173,201,231,243,88,
+  150,149,62,75,204,247,125,14,189,248,34,79,125,248,33,119,222,124,147,201,177,49,138,103,206,208,250,250,107,138,207,62,
+  139,112,28,48,12,68,7,64,249,62,122,16,192,160,191,98,210,160,36,247,131,32,192,205,229,16,40,226,88,18,199,17,
+  165,231,159,227,248,7,191,97,241,103,63,103,42,12,169,60,243,12,82,74,110,55,26,145,12,67,187,199,213,195,129,0,
+  253,138,49,11,98,154,38,75,75,203,212,235,117,170,213,106,39,21,237,61,176,60,59,203,189,215,126,132,248,253,31,252,
+  39,162,40,87,154,152,64,105,29,94,134,243,128,15,180,146,49,112,59,235,117,154,180,104,73,51,162,148,194,107,121,236,
+  238,238,16,199,81,123,147,178,147,231,46,193,228,41,214,231,230,126,177,188,190,238,109,45,45,37,205,194,46,176,215,129,
+  8,128,189,161,0,217,13,40,233,11,28,199,33,12,67,132,128,98,161,64,169,84,74,187,166,180,83,206,231,48,77,147,
+  226,229,203,141,255,212,106,63,249,239,246,182,71,28,107,224,17,176,3,108,1,219,90,235,168,111,10,178,0,137,114,33,
+  4,15,31,110,163,208,212,39,234,212,235,19,84,171,85,92,215,37,150,113,218,120,11,3,242,249,28,134,16,92,186,116,
+  233,193,63,79,156,184,253,205,197,139,23,220,32,248,33,176,166,123,14,34,67,139,208,48,12,242,249,60,107,235,107,248,
+  45,143,122,189,206,201,147,39,41,87,202,184,142,139,0,162,40,76,222,2,52,74,105,100,28,227,7,62,213,106,213,159,
+  159,159,15,241,253,127,0,55,95,239,227,43,3,160,187,148,151,203,101,214,214,86,249,246,254,6,245,250,4,227,181,113,
+  10,133,2,182,237,32,12,65,20,71,196,50,218,55,161,210,26,41,37,173,150,15,237,60,31,124,50,130,118,141,152,166,
+  201,161,67,135,104,54,119,89,249,247,50,181,227,99,60,49,53,65,206,205,97,217,54,90,105,162,40,36,138,178,29,95,
+  247,244,90,107,164,146,248,173,22,64,72,59,57,7,3,0,140,140,28,230,254,234,183,148,203,37,158,250,254,147,56,174,
+  131,97,90,196,82,18,43,213,118,218,89,124,178,157,64,215,236,90,163,148,162,229,167,0,67,15,159,41,192,250,198,42,
+  74,199,140,142,86,59,69,7,113,20,33,227,184,237,240,160,6,240,177,127,148,82,4,237,245,63,57,156,14,7,176,109,
+  251,237,143,126,251,209,181,126,187,224,65,206,147,102,165,27,66,99,219,246,59,28,16,126,0,209,231,120,222,219,236,127,
+  55,233,221,166,51,99,168,253,15,134,203,141,231,99,92,133,151,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Refresh1x[912] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,3,34,73,68,65,84,56,141,
+  109,82,77,108,84,101,20,61,247,123,239,149,249,173,51,109,7,91,168,182,10,134,18,166,161,162,51,141,127,209,152,70,
+  55,196,96,88,168,188,68,140,144,129,240,179,97,7,27,12,77,12,17,116,97,162,224,3,163,49,76,37,152,52,1,55,
+  252,4,33,146,212,194,171,113,209,208,146,212,210,198,1,70,59,180,29,232,204,180,243,222,251,190,235,162,243,146,89,112,
+  146,155,220,197,61,39,39,231,92,98,102,248,72,101,178,207,52,232,218,17,16,222,244,164,106,213,132,152,39,194,184,227,
+  202,19,0,46,216,150,233,214,221,30,4,112,130,124,129,116,38,187,69,211,196,64,79,215,42,125,93,103,179,209,214,20,
+  1,152,81,40,86,48,50,118,191,124,103,250,161,39,21,239,182,45,243,108,122,87,54,195,140,239,0,196,136,153,145,202,
+  100,215,27,186,24,217,218,215,29,138,199,130,208,137,208,28,13,32,28,208,17,13,25,8,26,2,51,197,69,28,207,14,
+  87,10,197,138,29,13,53,244,62,46,87,13,102,52,17,51,227,213,61,103,79,245,172,107,251,52,24,48,196,173,209,28,
+  170,174,7,67,215,228,154,213,177,197,190,244,243,225,222,245,173,164,9,130,16,132,95,174,77,168,183,94,108,23,7,190,
+  190,234,56,174,108,209,1,128,153,63,188,51,93,16,174,167,88,49,47,50,227,51,199,149,103,198,167,103,147,19,247,230,
+  143,94,239,104,238,218,183,117,83,40,17,11,225,227,119,187,68,45,6,2,160,4,0,72,169,194,85,199,243,146,47,60,
+  251,131,148,234,17,128,65,219,50,243,182,101,94,249,227,219,143,94,26,157,44,236,221,125,236,18,238,63,44,97,122,166,
+  12,169,24,0,3,0,11,44,175,170,233,169,72,127,99,36,240,85,103,251,202,110,0,83,117,105,235,186,38,118,110,123,
+  39,233,118,62,29,69,162,113,5,52,65,190,3,214,107,119,241,95,63,223,188,128,39,227,180,39,213,107,23,135,39,171,
+  87,237,169,37,223,188,227,170,0,0,246,91,168,2,48,106,4,174,155,223,0,236,4,224,62,65,88,183,45,243,158,47,
+  224,157,63,250,190,6,16,152,25,23,237,127,212,169,243,127,229,164,84,61,182,101,22,235,89,135,179,99,171,74,229,165,
+  142,223,71,198,111,0,136,233,0,64,4,16,17,238,254,87,134,33,24,39,7,255,36,0,95,212,147,83,153,108,152,136,
+  238,246,110,92,123,38,63,51,151,2,160,1,168,10,0,16,68,4,0,29,137,16,86,183,132,241,229,254,183,169,173,37,
+  114,236,149,61,63,223,74,101,178,233,154,198,246,21,134,174,231,242,179,7,242,133,226,235,154,70,174,109,153,174,88,118,
+  64,120,92,113,113,97,104,138,61,143,209,190,50,138,195,59,222,8,125,208,151,124,185,181,57,114,45,189,107,192,53,116,
+  241,141,84,50,62,247,104,1,77,141,65,210,132,24,4,0,255,145,168,255,199,161,165,137,220,220,228,165,225,201,206,204,
+  150,77,225,68,44,136,238,181,9,122,174,61,30,42,150,93,252,59,91,130,227,120,20,9,26,56,119,121,180,226,73,117,
+  4,0,150,31,73,49,77,228,230,78,223,60,185,45,249,160,176,240,73,255,247,55,230,143,15,220,44,13,223,206,35,63,
+  91,70,213,149,16,68,40,204,151,228,185,203,163,139,82,169,140,109,153,99,0,224,183,240,19,128,237,182,101,114,45,48,
+  3,192,123,13,134,182,87,49,111,144,82,197,13,93,155,33,194,80,213,145,135,108,203,252,219,15,247,127,46,85,118,106,
+  19,101,204,198,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Refresh2x[2024] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,7,159,73,68,65,84,88,133,197,151,105,108,84,
+  215,21,199,255,247,222,183,204,230,25,15,182,217,113,13,105,106,132,161,44,6,92,53,228,3,40,37,37,81,139,66,21,
+  90,227,128,154,20,227,166,138,20,181,82,148,150,182,82,251,161,249,80,169,173,212,70,69,161,44,105,176,73,5,161,202,
+  210,170,9,17,113,67,9,77,0,99,150,26,18,136,177,13,120,183,103,179,103,230,173,247,244,195,204,208,231,5,219,223,
+  122,164,171,55,247,205,185,231,255,59,119,206,61,239,13,240,127,54,54,19,167,213,79,55,46,243,249,213,239,40,28,143,
+  59,14,85,56,174,91,196,57,115,24,88,150,11,214,110,187,242,35,215,117,222,49,147,190,51,109,199,183,91,83,197,90,
+  91,127,228,91,23,254,180,243,196,140,0,214,213,31,173,210,53,126,48,18,242,45,221,176,178,60,84,62,175,88,132,131,
+  26,116,77,129,35,37,76,195,198,112,202,64,207,96,202,189,124,115,32,125,183,63,69,140,211,65,211,162,223,183,30,172,
+  235,26,31,175,250,153,198,205,224,120,175,229,192,83,247,116,239,11,176,174,190,233,187,126,93,249,195,246,175,85,5,151,
+  46,46,101,68,128,36,2,73,130,75,4,41,115,126,4,128,51,64,225,12,169,140,141,214,27,125,246,233,243,157,182,67,
+  110,147,35,177,183,101,255,142,33,0,88,251,189,198,135,20,69,156,180,93,55,48,45,192,186,134,166,109,1,93,61,242,
+  252,183,107,2,197,97,31,100,94,144,64,32,153,3,113,36,129,136,32,37,65,18,32,41,7,162,171,28,174,36,124,116,
+  233,182,125,186,165,211,112,128,6,38,233,186,16,252,95,91,55,85,133,222,56,121,5,94,0,101,188,248,250,93,127,46,
+  225,140,31,106,120,162,58,48,43,226,131,75,4,195,114,16,75,100,97,88,14,20,33,80,20,212,16,9,233,32,2,108,
+  87,194,114,36,72,18,108,73,48,109,23,130,51,60,188,186,66,173,172,40,83,255,114,242,202,129,120,50,27,120,98,211,
+  50,90,56,55,60,33,217,9,0,20,80,235,215,47,159,175,207,43,43,194,213,246,1,122,255,227,91,114,48,145,225,140,
+  129,17,81,206,135,72,10,206,236,197,243,163,230,170,165,243,67,149,21,37,220,167,50,164,77,23,25,211,70,50,99,33,
+  149,73,33,168,43,216,177,101,85,32,107,216,208,116,149,185,146,166,7,208,5,223,83,83,181,192,119,232,237,139,238,173,
+  187,9,56,146,132,224,220,180,44,167,155,184,187,163,101,255,174,79,0,160,122,207,177,200,245,91,67,53,237,221,241,221,
+  128,124,124,77,229,2,182,162,114,158,31,92,32,109,184,112,37,16,79,219,24,53,93,204,137,232,104,239,27,197,178,133,
+  19,119,96,76,13,84,239,121,37,224,87,138,7,87,86,206,209,46,126,218,135,104,56,168,40,10,71,223,80,34,46,28,
+  245,139,255,62,184,61,54,89,205,172,120,182,41,234,119,249,179,130,179,159,124,101,229,34,223,202,202,121,202,96,210,68,
+  60,99,67,74,66,33,243,181,15,68,241,235,87,207,80,203,129,58,94,88,203,189,129,56,21,45,38,80,224,210,103,189,
+  226,11,11,74,88,73,52,24,19,66,244,131,88,219,253,196,1,224,234,190,186,248,185,253,181,47,25,22,85,158,189,220,
+  117,242,213,55,47,160,36,164,160,188,52,0,162,92,177,2,0,231,12,156,193,28,163,233,157,72,38,185,97,57,208,124,
+  190,225,144,223,247,65,64,215,63,112,28,231,38,145,59,225,76,79,102,173,135,106,123,0,250,88,81,184,165,40,10,226,
+  163,22,136,0,34,128,49,128,179,137,135,110,76,13,40,54,92,71,0,179,163,161,127,4,3,250,53,198,121,178,56,18,
+  12,12,13,143,204,168,99,86,215,55,126,63,236,215,127,92,251,216,42,173,63,105,32,145,182,32,145,235,21,133,29,152,
+  18,32,235,200,46,85,112,140,102,178,31,246,119,59,237,182,34,70,147,217,132,233,186,246,232,116,226,53,13,77,91,125,
+  186,246,219,93,223,88,237,215,117,21,65,159,134,242,210,0,192,0,6,6,85,112,8,6,15,78,206,38,32,173,123,250,
+  245,69,231,15,215,222,153,73,198,5,91,179,251,181,77,12,252,212,76,253,167,236,132,213,187,27,73,112,150,45,204,37,
+  145,66,4,117,178,64,210,213,102,183,30,222,62,56,83,225,39,159,60,38,186,34,70,249,185,3,187,58,10,247,38,244,
+  1,0,120,249,133,175,251,129,92,241,72,34,216,174,132,148,185,66,234,232,77,98,223,137,243,41,219,114,171,167,19,111,
+  110,238,240,109,220,184,216,40,204,219,139,173,111,50,226,127,133,39,113,62,217,66,73,132,203,157,9,180,118,196,113,185,
+  51,129,107,119,82,136,141,154,24,136,103,112,224,205,150,180,227,58,155,47,30,220,249,249,148,233,18,49,55,170,150,55,
+  183,13,204,253,159,24,185,64,174,137,77,9,48,222,102,133,52,168,130,225,143,199,206,73,195,118,235,10,221,112,42,251,
+  197,47,193,174,223,205,62,44,32,171,78,93,237,127,160,185,185,89,81,85,109,107,238,91,99,26,0,79,161,50,6,148,
+  20,105,200,100,109,0,196,5,120,109,245,158,163,165,211,1,116,70,46,133,227,105,247,171,0,95,166,112,170,106,139,207,
+  217,72,36,119,48,6,88,66,140,76,9,224,125,102,16,1,55,123,71,32,57,199,15,119,62,132,13,107,202,183,9,142,
+  246,117,245,71,158,175,169,107,156,216,220,243,150,150,246,163,170,194,170,56,163,101,137,180,181,246,248,233,235,77,69,225,
+  34,193,57,31,185,186,175,46,94,240,155,180,8,37,17,56,99,152,95,234,71,79,44,11,219,37,196,70,44,196,70,128,
+  37,139,202,212,89,209,34,245,242,167,189,47,117,118,15,253,106,125,195,209,19,182,35,95,211,12,156,255,164,233,169,84,
+  245,139,239,71,138,132,239,185,209,180,243,226,242,138,80,234,237,179,119,230,158,185,212,177,32,16,240,145,47,224,83,19,
+  137,212,5,175,214,164,199,240,119,63,218,140,172,229,34,145,202,34,28,242,163,47,145,69,247,112,22,253,9,19,174,148,
+  208,85,129,104,80,133,148,132,174,158,152,123,183,39,150,142,143,100,116,33,20,157,113,5,148,127,118,75,199,65,32,168,
+  187,209,104,88,209,3,126,220,233,234,25,201,154,230,15,46,190,178,163,113,202,29,32,2,110,222,73,200,195,111,181,240,
+  7,203,75,178,91,54,60,232,87,4,7,99,4,2,144,49,29,164,13,7,66,48,68,163,97,49,187,44,18,38,9,140,
+  164,13,164,13,27,142,75,224,156,49,174,104,112,73,42,142,11,164,146,105,88,134,49,106,198,213,99,94,173,241,0,12,
+  0,110,245,38,208,248,247,214,145,225,219,231,31,181,83,21,155,58,122,98,63,95,179,116,161,186,164,98,182,146,76,219,
+  136,165,45,216,14,193,114,36,76,91,66,18,221,91,206,53,29,66,230,250,134,229,186,0,49,100,50,89,12,246,245,103,
+  141,68,207,174,182,227,47,48,228,106,79,2,128,240,136,115,0,250,130,234,109,63,187,114,163,63,61,116,251,82,237,173,
+  119,127,115,171,191,237,189,207,204,108,242,111,35,124,246,188,207,111,199,23,250,117,5,115,162,33,238,215,21,48,134,252,
+  123,33,64,50,119,149,36,243,121,228,118,43,62,156,148,3,189,131,153,204,96,123,67,219,137,189,103,243,58,57,7,64,
+  178,123,232,128,6,64,171,222,221,152,202,38,110,63,115,237,141,189,205,133,123,133,81,90,245,200,146,249,203,31,171,245,
+  69,74,31,41,14,7,101,105,105,212,31,12,248,152,166,169,0,99,112,36,96,154,54,210,134,133,100,50,237,38,99,137,
+  172,109,102,254,211,125,241,173,159,246,95,121,167,3,128,53,110,152,204,147,189,6,64,255,114,237,203,123,174,188,254,220,
+  81,0,250,56,128,123,115,205,31,41,42,91,190,101,101,241,194,21,53,122,81,217,151,184,166,151,129,184,66,140,9,6,
+  57,42,29,179,215,136,247,125,56,116,227,159,239,14,92,63,213,89,16,243,10,231,175,134,247,20,76,42,150,31,234,184,
+  207,106,190,126,132,119,59,1,56,0,108,207,24,159,241,152,236,1,152,222,34,180,49,246,88,22,130,186,249,192,78,126,
+  97,65,88,96,108,35,163,188,175,215,223,246,172,243,66,25,249,235,164,127,76,10,63,135,138,177,217,142,23,46,20,83,
+  33,70,1,184,0,61,25,72,65,248,94,175,157,238,85,75,228,133,11,16,220,3,224,21,47,0,120,33,188,194,78,254,
+  222,4,155,209,187,222,36,107,188,163,32,238,133,152,248,15,228,62,246,95,132,61,194,136,109,50,115,118,0,0,0,0,
+  73,69,78,68,174,66,96,130,
+};
+const unsigned char Remove1x[247] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,214,1,11,15,59,34,0,92,18,194,0,0,0,132,73,
+  68,65,84,56,203,237,145,177,9,131,80,16,134,191,7,105,220,192,58,43,232,8,25,35,173,109,70,8,25,32,11,136,
+  173,115,196,5,116,136,212,182,34,68,243,238,79,33,202,179,179,51,133,31,28,28,7,255,119,28,7,7,251,227,230,38,
+  205,202,26,72,54,230,154,186,184,166,0,167,96,152,60,111,23,70,19,14,24,189,86,9,105,42,7,220,243,215,178,40,
+  20,208,125,60,239,182,71,2,51,97,130,126,16,222,139,175,9,51,56,199,209,74,28,10,154,71,94,109,62,225,248,254,
+  63,241,3,172,83,45,219,70,228,128,216,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Remove2x[317] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,244,73,68,65,84,88,133,237,146,33,78,67,
+  65,16,134,191,125,143,144,18,130,107,208,56,4,22,213,11,112,2,20,154,11,112,3,20,26,69,130,168,170,226,18,132,
+  51,32,72,170,73,16,8,146,162,200,235,204,143,152,82,210,164,111,43,26,130,153,207,236,230,207,238,206,55,147,133,36,
+  73,146,36,249,103,202,95,62,126,114,254,176,219,12,187,125,128,231,187,139,143,117,103,118,250,46,159,94,78,180,173,64,
+  41,157,53,78,103,174,1,61,205,246,10,0,220,94,157,173,205,5,72,194,5,18,184,132,75,200,99,47,129,197,218,74,
+  106,175,239,31,123,107,84,5,204,197,244,237,147,166,132,188,123,20,53,15,1,83,100,230,194,12,76,48,55,45,207,205,
+  77,28,29,14,106,37,234,2,239,179,47,94,94,103,203,182,163,243,130,22,251,149,140,152,198,111,22,235,193,94,253,155,
+  85,5,0,70,199,67,180,152,134,251,106,215,46,97,38,220,99,228,63,153,155,112,98,2,155,62,82,85,224,102,252,180,
+  201,47,73,146,36,73,182,230,27,50,111,151,157,5,100,235,163,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Save1x[911] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,11,10,13,55,15,158,42,216,191,0,0,0,140,116,
+  69,88,116,67,111,109,109,101,110,116,0,77,101,110,117,45,115,105,122,101,100,32,105,99,111,110,10,61,61,61,61,61,
+  61,61,61,61,61,10,10,40,99,41,32,50,48,48,51,32,74,97,107,117,98,32,39,106,105,109,109,97,99,39,32,83,
+  116,101,105,110,101,114,44,32,10,104,116,116,112,58,47,47,106,105,109,109,97,99,46,109,117,115,105,99,104,97,108,108,
+  46,99,122,10,10,99,114,101,97,116,101,100,32,119,105,116,104,32,116,104,101,32,71,73,77,80,44,10,104,116,116,112,
+  58,47,47,119,119,119,46,103,105,109,112,46,111,114,103,103,138,199,71,0,0,2,132,73,68,65,84,56,203,157,146,77,
+  72,84,97,20,134,159,185,221,241,230,207,228,76,224,181,49,205,145,178,81,108,81,81,52,38,20,184,200,22,69,20,46,
+  66,40,44,130,138,169,193,86,45,42,202,69,17,84,16,6,82,180,40,10,34,176,40,40,106,91,208,34,137,68,138,166,
+  69,153,84,106,134,164,232,220,155,206,253,249,78,11,97,108,178,54,189,155,243,193,225,60,156,247,61,95,224,200,217,227,
+  39,63,91,21,218,216,184,51,9,84,1,91,129,134,160,38,217,208,194,159,63,22,25,206,205,187,231,207,157,224,31,10,
+  52,119,116,237,141,173,172,143,85,151,155,131,171,107,202,58,170,35,133,107,109,207,39,253,45,195,235,222,231,234,195,215,
+  81,226,145,55,203,186,59,239,12,255,21,144,60,125,190,219,157,26,59,236,137,198,168,31,102,218,40,99,129,30,164,173,
+  101,35,203,43,22,115,249,254,11,252,161,62,98,5,227,127,155,239,36,121,44,37,95,70,6,68,68,100,224,115,90,122,
+  211,3,146,186,246,68,18,7,47,72,207,171,47,210,245,244,173,180,158,186,46,239,6,135,229,119,89,150,37,169,142,164,
+  232,134,238,179,180,60,198,196,196,4,225,146,114,180,192,36,133,226,0,208,247,113,20,179,68,231,251,120,134,247,3,159,
+  88,178,168,16,2,0,66,65,65,1,0,186,231,130,40,193,87,138,237,39,110,204,219,177,119,112,2,215,243,185,216,243,
+  146,139,61,47,1,120,124,118,31,200,108,95,3,80,162,80,190,162,235,80,35,0,237,187,119,210,152,88,199,204,140,77,
+  52,164,209,148,88,207,222,214,237,0,236,105,94,129,242,21,34,50,7,16,17,34,145,48,21,101,49,46,29,88,199,205,
+  187,15,136,199,170,208,8,160,17,32,81,95,205,173,123,143,104,219,92,195,142,166,245,20,21,23,229,3,0,44,203,194,
+  52,77,170,163,181,57,72,227,170,229,212,198,42,185,124,251,33,109,155,107,216,181,41,129,105,154,56,142,147,179,168,3,
+  40,165,176,109,27,0,211,52,49,77,147,238,163,133,28,187,218,67,214,245,217,223,82,79,251,182,45,104,154,198,212,212,
+  20,182,109,19,10,133,230,0,134,97,80,89,89,153,23,222,154,134,13,60,187,178,1,0,219,182,113,28,135,233,233,233,
+  121,33,235,0,253,253,253,184,174,155,215,240,60,15,93,215,115,239,63,21,137,68,242,51,240,60,143,116,58,205,200,200,
+  8,153,76,6,17,65,68,48,12,131,161,161,33,66,161,80,174,90,150,133,101,89,249,87,80,74,81,92,92,68,48,24,
+  204,125,18,0,215,117,17,53,11,19,53,123,62,229,251,249,22,194,225,48,165,165,165,68,163,81,0,178,217,44,64,46,
+  237,120,93,28,165,20,241,186,58,148,82,44,137,70,115,150,3,169,142,228,25,224,52,255,167,206,95,147,59,51,76,213,
+  34,98,109,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Save2x[1971] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,7,106,73,68,65,84,88,133,197,151,125,112,84,
+  213,21,192,127,247,190,183,187,201,110,54,107,214,64,48,31,16,140,13,33,161,148,154,26,20,144,34,200,231,16,104,133,
+  88,235,160,14,163,165,99,255,177,51,181,3,173,253,160,29,167,214,145,113,198,63,218,153,82,103,250,135,211,78,117,176,
+  142,45,45,149,14,209,66,139,58,104,149,160,29,32,160,1,3,164,139,38,155,205,190,151,221,247,222,189,183,127,132,125,
+  77,2,72,29,233,244,204,156,121,247,235,221,243,219,115,206,61,119,31,252,159,69,92,105,193,204,181,143,119,104,35,54,
+  73,97,22,131,136,34,112,140,210,7,48,226,185,190,61,91,95,251,159,1,212,175,124,50,109,219,222,111,18,241,216,130,
+  121,109,141,137,233,211,170,228,53,149,229,4,129,162,127,96,72,191,113,164,175,144,25,202,191,173,240,239,236,223,253,189,
+  51,87,21,160,110,245,227,245,17,105,246,183,207,153,145,155,63,183,169,74,72,49,61,98,91,88,18,44,41,145,82,32,
+  4,28,57,126,70,237,217,127,36,95,12,204,173,253,127,218,118,228,170,0,180,117,109,143,230,243,177,87,22,181,55,157,
+  3,81,127,54,51,60,205,138,216,149,211,167,165,43,231,182,212,73,75,74,138,158,66,27,67,60,102,51,240,97,142,95,
+  239,126,61,163,61,127,222,169,151,30,57,247,73,1,172,201,3,241,198,21,15,93,91,149,88,120,46,147,107,233,237,207,
+  236,31,202,186,143,14,13,59,47,244,157,57,95,126,236,228,185,153,55,52,214,68,236,136,69,209,83,228,11,62,233,84,
+  156,100,162,172,252,189,254,161,235,179,189,127,121,238,83,121,160,190,235,201,114,43,95,236,182,44,49,199,55,122,205,7,
+  127,252,238,129,241,243,141,171,126,122,87,186,58,241,203,123,215,47,168,24,26,41,18,40,141,49,134,154,116,130,95,61,
+  127,32,247,225,240,232,162,79,26,10,57,190,99,141,20,230,25,97,78,7,90,221,49,217,56,64,223,159,183,253,118,112,
+  112,244,247,199,251,50,202,182,36,126,160,41,250,26,103,212,231,243,173,141,9,11,179,249,147,24,135,73,30,152,177,230,
+  209,13,218,136,150,155,43,222,126,214,24,243,139,72,36,178,196,178,172,9,144,195,126,156,209,107,110,100,249,226,118,6,
+  6,243,4,106,44,23,202,162,146,103,95,124,153,47,84,30,195,24,19,174,87,74,41,223,247,159,119,93,247,222,61,123,
+  246,20,39,3,216,227,59,90,91,167,165,14,254,161,181,254,217,166,77,155,150,118,118,118,34,165,12,55,52,198,144,119,
+  139,220,182,229,105,164,4,47,208,104,109,24,25,245,169,73,167,144,118,156,157,59,119,98,140,25,175,214,51,207,60,115,
+  103,119,119,247,27,192,19,31,11,80,244,245,233,249,77,31,140,136,65,49,127,197,138,21,252,225,149,30,190,249,228,75,
+  23,185,205,182,37,66,8,60,95,161,181,65,27,67,44,98,225,20,60,102,111,124,106,194,218,47,125,177,153,135,186,86,
+  211,221,221,253,0,176,3,48,19,246,26,223,201,236,123,228,95,209,107,54,124,117,217,237,183,167,45,203,162,99,118,13,
+  223,191,127,17,79,191,216,195,210,133,159,165,188,44,138,37,5,182,37,17,128,231,107,180,49,104,109,48,2,182,109,89,
+  141,148,2,99,224,245,195,239,115,110,224,60,223,248,242,92,82,169,20,109,109,109,205,66,136,165,187,118,237,218,119,89,
+  128,11,114,255,170,85,171,200,231,243,248,190,207,202,142,70,50,131,46,187,15,254,147,219,110,105,35,147,29,197,45,4,
+  24,12,198,140,133,197,45,6,188,240,215,19,184,197,128,246,230,26,2,175,192,145,163,125,252,252,91,75,209,42,192,113,
+  28,150,47,95,206,187,239,190,251,117,96,2,192,132,4,219,176,97,195,245,83,167,78,93,90,87,87,135,227,56,216,182,
+  141,109,219,108,94,59,151,27,155,171,121,245,173,99,76,173,42,71,25,67,54,95,100,224,35,135,247,206,14,115,230,124,
+  158,108,190,72,83,109,138,50,27,254,254,230,49,30,123,112,49,233,84,28,41,37,163,163,163,52,55,55,83,81,81,177,
+  126,221,186,117,53,151,5,16,66,60,176,113,227,70,225,186,110,169,143,214,26,165,20,15,223,221,193,180,84,140,87,223,
+  58,65,58,89,70,118,164,72,206,245,80,122,44,164,181,213,21,204,188,174,146,125,7,223,225,219,119,183,51,243,186,74,
+  140,49,8,33,48,198,224,251,62,203,150,45,139,70,34,145,205,151,4,88,178,100,137,45,132,184,175,189,189,157,124,62,
+  143,109,219,24,99,80,74,17,4,1,42,240,249,193,230,249,68,241,57,217,119,134,155,102,79,35,26,25,43,164,149,137,
+  40,55,181,212,240,242,193,119,232,92,48,131,142,150,169,40,165,194,211,35,165,196,117,93,58,58,58,0,182,108,223,190,
+  93,94,4,144,78,167,215,44,90,180,168,54,18,137,80,40,20,144,82,18,4,1,158,231,81,44,22,41,22,139,104,21,
+  240,232,3,55,147,203,14,115,118,224,35,230,207,158,70,188,44,194,173,115,235,121,237,237,94,234,171,99,220,113,235,140,
+  112,189,231,121,4,65,128,109,219,120,158,71,50,153,100,206,156,57,51,15,31,62,188,226,34,0,33,196,215,86,174,92,
+  73,46,151,3,32,8,2,140,49,225,38,198,24,180,214,68,44,195,143,54,183,115,252,228,105,6,179,57,214,222,50,147,
+  222,247,207,145,203,14,243,96,103,51,158,231,225,251,62,190,239,19,4,1,82,74,148,82,104,173,113,93,151,197,139,23,
+  99,89,214,150,9,0,235,214,173,171,173,174,174,94,213,208,208,128,227,56,40,165,200,231,243,0,148,151,151,135,197,72,
+  41,133,82,138,202,114,201,15,239,249,28,111,30,238,229,111,111,158,160,231,104,31,15,119,181,96,9,67,16,4,104,173,
+  1,40,43,43,67,8,65,46,151,67,107,77,161,80,160,169,169,137,202,202,202,206,174,174,174,186,16,192,182,237,251,214,
+  175,95,111,187,174,139,16,34,212,209,209,81,124,223,39,145,72,16,143,199,137,70,163,8,33,176,44,139,218,234,4,91,
+  239,154,67,207,209,83,108,253,74,27,83,171,18,68,163,81,226,241,56,201,100,146,100,50,137,231,121,56,142,131,148,18,
+  41,37,145,72,4,165,20,11,23,46,180,181,214,247,195,133,58,32,132,184,187,189,189,29,215,117,169,173,173,37,155,205,
+  50,50,50,130,16,130,32,8,194,182,101,89,36,147,73,96,236,252,223,156,78,243,187,159,52,80,81,110,35,165,68,107,
+  141,214,122,44,95,180,14,223,145,82,146,74,165,168,174,174,166,191,191,159,142,142,14,246,238,221,123,15,240,227,82,33,
+  250,76,50,153,100,100,100,132,179,103,207,162,181,70,202,177,244,176,44,43,52,168,181,14,243,161,212,143,217,224,251,254,
+  4,207,197,98,49,132,248,207,61,103,140,33,159,207,227,56,14,90,107,166,76,153,130,214,250,134,208,3,64,204,243,60,
+  108,219,14,95,28,127,1,149,158,37,168,203,205,143,159,43,233,248,185,82,110,12,12,12,132,237,176,20,7,65,192,241,
+  227,199,47,218,64,107,61,249,118,187,228,216,127,187,22,160,182,182,54,132,13,127,82,137,8,224,208,161,67,244,244,244,
+  208,219,219,75,127,127,63,153,76,134,108,54,139,227,56,20,139,197,176,200,148,170,156,49,134,193,193,65,26,26,26,200,
+  102,179,52,52,52,48,52,52,196,244,233,211,201,102,179,52,54,54,134,207,201,182,66,128,241,238,42,197,253,114,114,41,
+  183,79,158,187,92,56,0,148,82,31,239,129,88,44,54,33,222,31,7,50,121,243,201,115,151,146,241,182,194,28,40,81,
+  25,99,104,109,109,69,41,21,150,208,146,203,149,82,8,33,38,212,249,43,193,76,30,43,29,109,64,135,0,198,152,190,
+  83,167,78,53,206,154,53,43,76,156,82,242,148,218,87,210,186,186,58,180,214,180,182,182,226,121,30,45,45,45,20,10,
+  5,154,155,155,113,28,135,166,166,38,114,185,28,169,84,170,116,212,143,1,101,54,128,235,186,223,217,177,99,199,19,82,
+  202,250,43,250,253,42,136,82,170,63,147,201,60,6,68,75,213,162,12,184,22,168,2,42,129,40,16,185,202,118,61,198,
+  62,132,10,64,14,56,15,156,31,255,183,92,0,137,11,90,198,37,190,154,62,165,4,23,180,0,228,47,0,241,111,88,
+  158,93,127,255,164,218,120,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Search1x[935] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,213,6,29,17,18,8,200,223,108,120,0,0,3,52,73,
+  68,65,84,56,203,165,147,91,104,84,119,16,198,103,254,231,178,231,156,205,222,226,110,54,169,27,52,136,26,139,151,54,
+  27,91,179,84,173,164,62,24,124,80,52,20,20,162,146,66,169,171,173,15,53,77,53,84,90,52,68,193,18,164,84,104,
+  107,21,164,133,38,47,125,170,180,198,16,47,72,172,104,64,163,193,91,196,100,147,205,222,183,155,205,238,158,61,57,243,
+  247,37,27,90,241,173,31,12,51,204,195,143,111,24,62,132,87,212,214,126,248,55,189,144,223,138,136,42,113,66,206,249,
+  140,205,102,191,216,121,188,235,19,120,141,196,210,240,69,251,225,13,185,124,254,175,230,157,205,178,195,81,142,69,195,228,
+  38,7,144,5,180,78,103,82,31,103,50,211,123,237,118,91,99,231,241,174,155,255,6,32,0,192,177,175,59,214,166,211,
+  233,91,193,253,159,97,223,221,201,226,72,82,44,40,154,166,154,196,165,92,54,155,241,191,1,74,227,219,62,185,251,204,
+  105,170,240,84,212,119,28,61,54,244,31,7,137,68,114,224,211,3,135,240,247,219,81,99,74,183,75,187,54,249,178,11,
+  23,104,255,152,68,174,161,231,233,196,141,145,216,162,233,191,195,197,131,193,67,114,247,153,111,175,1,128,173,4,16,58,
+  190,58,210,230,175,171,223,60,154,20,205,209,25,77,250,168,113,73,164,202,165,162,34,51,137,8,100,213,34,166,114,250,
+  236,195,231,73,170,177,80,206,240,186,20,92,189,102,85,246,234,192,181,91,0,0,44,145,136,159,244,215,249,165,193,23,
+  134,28,88,238,54,4,6,110,221,48,157,121,125,86,51,137,4,211,52,221,145,148,238,65,192,240,112,4,228,119,214,190,
+  171,68,163,145,238,249,19,36,73,226,4,12,173,118,7,40,178,120,47,147,55,152,98,114,93,20,176,72,196,151,246,220,
+  8,157,52,136,202,128,131,43,109,136,159,171,170,6,146,36,241,121,0,17,205,90,36,81,146,24,231,79,38,166,167,24,
+  218,152,171,12,76,189,104,134,199,98,185,144,78,20,23,56,18,48,174,204,26,134,169,235,186,64,68,198,60,192,235,245,
+  222,153,152,152,168,119,200,50,62,30,143,151,143,199,115,55,57,131,40,34,139,32,113,183,0,48,3,200,173,201,88,116,
+  125,237,162,114,76,38,19,122,101,101,213,96,9,192,68,81,252,177,127,224,74,120,171,223,43,168,86,53,96,114,178,1,
+  71,6,156,139,28,200,65,8,114,161,80,168,112,121,60,239,111,121,203,195,126,190,112,46,147,78,167,250,231,191,112,165,
+  175,127,104,197,155,181,109,86,139,168,175,92,86,163,141,198,139,245,177,112,200,163,170,234,51,226,84,27,25,127,177,221,
+  229,118,239,222,177,74,132,193,235,127,114,85,209,48,22,139,53,212,44,89,124,225,225,131,145,172,0,0,176,99,231,246,
+  203,195,15,238,239,231,185,212,212,174,166,128,221,0,177,114,166,200,63,224,40,172,169,91,90,81,181,205,239,134,115,103,
+  79,83,96,93,128,77,78,77,74,68,166,196,24,107,105,104,88,215,135,37,43,93,167,78,172,30,27,27,255,195,227,246,
+  20,156,206,114,217,95,231,119,86,87,87,219,122,122,123,30,61,121,250,72,213,243,198,55,78,151,253,167,166,45,77,112,
+  111,248,62,108,120,111,35,253,242,235,69,134,175,134,163,235,212,137,125,0,208,28,10,133,54,2,128,230,243,249,46,1,
+  64,111,123,219,209,243,193,96,176,19,25,255,114,79,203,94,176,90,203,224,251,179,223,1,190,38,96,108,174,176,148,149,
+  185,206,1,0,90,91,91,91,84,205,242,195,220,238,67,248,191,122,9,59,169,102,147,104,79,162,5,0,0,0,0,73,
+  69,78,68,174,66,96,130,
+};
+const unsigned char Search2x[2215] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,8,94,73,68,65,84,88,133,205,150,127,108,91,
+  213,21,199,191,247,253,138,253,158,237,216,78,76,146,214,169,11,73,91,210,31,33,45,180,5,211,65,167,166,77,233,8,
+  236,7,160,177,170,147,166,110,76,211,164,177,127,96,101,66,194,98,82,88,165,174,12,254,66,219,152,54,117,147,166,117,
+  160,34,164,77,41,76,77,210,210,101,26,140,244,87,146,166,182,227,196,109,176,99,59,241,143,247,236,231,247,227,222,253,
+  209,166,178,186,134,52,219,254,216,145,142,222,185,87,247,188,243,185,231,188,115,239,3,150,41,145,72,132,139,68,34,220,
+  114,253,22,19,178,212,130,195,135,15,187,9,33,95,163,148,62,65,8,249,18,207,243,18,0,216,182,109,19,66,254,204,
+  24,123,143,49,246,167,67,135,14,21,254,167,0,71,143,30,117,26,134,241,188,223,239,127,109,251,246,237,8,133,66,80,
+  20,5,60,207,131,82,10,195,48,144,201,100,48,54,54,134,209,209,81,152,166,249,114,165,82,121,35,18,137,168,255,53,
+  192,145,35,71,66,140,177,179,189,189,189,43,218,219,219,161,170,42,52,77,131,105,154,176,109,27,28,199,65,20,69,40,
+  138,2,183,219,141,82,169,132,161,161,33,140,143,143,151,9,33,157,47,190,248,98,236,63,6,56,124,248,112,80,150,229,
+  228,129,3,7,32,8,2,50,153,12,46,39,231,74,127,60,115,53,62,118,181,28,208,77,171,1,224,224,148,184,220,250,
+  160,43,251,236,163,171,214,220,191,62,228,148,101,25,159,124,242,9,206,156,57,3,203,178,214,188,244,210,75,209,101,3,
+  188,249,230,155,117,213,106,53,122,240,224,193,32,0,164,103,179,248,233,59,227,23,47,38,74,161,230,38,111,226,174,6,
+  79,218,165,56,52,0,80,53,93,153,205,21,155,82,233,252,221,93,109,158,107,175,126,115,235,186,198,6,31,134,135,135,
+  49,60,60,60,87,169,84,90,35,145,72,121,41,0,161,118,80,169,84,190,183,119,239,222,160,32,8,248,236,179,20,126,
+  240,203,145,137,170,205,203,143,60,184,110,240,161,123,3,254,182,102,87,200,229,16,28,186,73,205,108,177,90,186,152,44,
+  166,174,92,205,79,158,31,75,110,252,206,207,207,36,126,251,194,206,213,93,93,93,72,165,82,254,68,34,241,60,128,215,
+  150,2,224,23,140,163,71,143,58,101,89,62,221,221,221,141,217,217,89,188,254,222,196,165,180,74,133,93,225,117,227,95,
+  223,17,90,127,111,208,211,226,145,69,89,224,56,94,224,57,94,118,240,210,170,6,165,222,163,72,156,37,72,87,146,233,
+  66,227,196,84,54,255,216,67,237,126,69,81,48,49,49,177,43,28,14,255,108,96,96,192,248,60,128,155,253,108,89,214,
+  227,155,55,111,134,170,170,184,150,85,171,255,136,22,238,186,127,67,104,236,241,45,43,215,249,20,73,225,57,194,75,2,
+  47,240,60,33,60,71,24,207,17,74,8,216,170,70,185,126,133,223,41,223,215,177,234,210,223,198,231,234,175,76,165,105,
+  67,67,3,90,91,91,33,203,242,87,151,202,192,77,0,198,216,147,205,205,205,40,151,203,248,195,224,212,76,115,192,59,
+  211,213,222,224,119,57,4,135,77,25,163,140,153,166,77,117,198,80,5,80,229,65,170,28,129,78,56,162,23,52,35,207,
+  113,156,213,20,240,94,251,77,255,88,78,20,69,172,88,177,2,140,177,39,239,24,0,192,22,73,146,96,219,54,206,79,
+  171,238,70,191,43,211,234,119,122,76,219,182,109,74,117,211,100,101,211,102,154,77,161,49,202,202,148,161,12,160,82,212,
+  204,89,173,98,205,1,164,20,240,123,210,31,71,243,162,109,219,240,249,124,0,208,181,20,64,237,71,24,34,132,128,82,
+  138,178,78,221,178,203,161,213,137,188,104,81,232,156,5,10,80,202,81,216,28,71,44,202,152,201,192,76,198,96,93,72,
+  22,198,64,136,14,48,234,84,196,140,90,49,21,195,48,224,116,58,1,96,229,114,0,42,140,49,153,16,2,220,104,79,
+  221,180,117,145,231,24,33,176,97,115,22,199,193,226,24,51,193,96,216,148,89,87,210,106,116,114,86,77,130,65,225,8,
+  33,4,196,9,224,230,129,5,128,46,7,224,51,219,182,27,4,65,128,203,201,107,101,85,87,114,37,35,47,10,156,4,
+  192,4,165,6,39,240,134,64,72,149,49,166,199,82,218,232,233,139,233,105,2,200,0,33,12,76,40,21,43,14,143,34,
+  233,140,49,177,82,169,0,64,114,57,0,127,159,159,159,223,216,210,210,130,7,218,235,49,145,81,3,151,175,22,198,56,
+  2,167,207,45,65,22,121,195,210,237,124,177,106,78,159,143,23,70,83,243,154,202,24,100,142,112,28,5,234,8,96,206,
+  230,138,43,195,29,13,34,0,100,50,25,88,150,53,116,199,0,140,177,247,46,95,190,124,176,173,173,13,207,124,97,181,
+  239,249,95,140,32,147,15,140,228,138,198,12,5,242,0,242,28,80,176,129,60,24,242,4,204,6,136,72,193,108,0,212,
+  180,41,95,40,168,247,237,223,181,217,97,24,6,166,166,166,160,105,218,137,165,0,110,118,129,174,235,253,211,211,211,179,
+  243,243,243,88,223,30,196,23,55,53,138,231,198,167,31,164,28,207,129,35,28,7,198,83,48,142,112,76,0,199,156,140,
+  23,100,0,34,7,194,51,74,248,139,163,211,95,217,183,45,232,106,244,72,72,167,211,136,197,98,147,146,36,253,229,142,
+  1,34,145,136,65,41,253,241,224,224,32,0,224,71,223,216,230,106,116,146,224,200,185,216,99,86,197,116,81,2,137,128,
+  56,96,19,133,39,156,135,7,188,32,68,169,26,85,239,200,165,216,183,87,53,58,214,255,240,169,205,226,252,252,60,134,
+  134,134,160,170,106,49,145,72,72,75,1,240,181,131,231,158,123,238,124,50,153,124,212,48,140,213,161,80,8,79,236,104,
+  151,98,201,89,207,71,231,147,15,104,154,33,129,193,20,235,4,211,170,90,114,102,174,120,247,84,50,211,157,152,206,124,
+  119,207,150,214,150,87,191,181,93,152,159,203,161,174,174,14,94,175,23,213,106,181,57,26,141,238,10,6,131,239,199,98,
+  49,109,49,128,127,187,142,251,250,250,2,130,32,124,180,97,195,134,53,91,183,110,133,207,231,195,248,84,22,239,12,94,
+  182,135,199,178,86,174,84,21,0,70,26,61,14,123,199,166,22,225,169,157,247,146,70,5,200,229,114,112,56,28,136,199,
+  227,56,119,238,28,252,126,63,84,85,197,137,19,39,38,1,244,246,247,247,95,186,35,0,0,56,114,228,72,35,165,244,
+  120,115,115,243,206,206,206,78,52,53,53,65,81,20,136,162,8,158,231,97,219,54,44,203,66,185,92,134,166,105,72,167,
+  211,56,125,250,52,118,239,222,141,68,34,129,106,181,138,84,42,5,159,207,7,198,24,222,125,247,221,66,165,82,121,230,
+  131,15,62,56,249,185,37,88,144,147,39,79,150,31,126,248,225,99,186,174,79,197,227,241,174,76,38,227,45,149,74,80,
+  85,21,197,98,17,249,124,30,233,116,26,241,120,28,35,35,35,24,30,30,190,144,205,102,167,53,77,91,217,210,210,2,
+  195,48,224,245,122,145,205,102,33,138,34,58,59,59,29,201,100,242,217,96,48,152,137,197,98,31,47,153,129,90,137,68,
+  34,130,44,203,221,0,190,12,224,1,198,216,138,27,126,51,148,210,193,82,169,244,126,95,95,223,192,211,79,63,45,2,
+  248,125,71,71,199,83,225,112,24,229,242,245,127,145,84,42,5,73,146,32,203,50,78,157,58,133,100,50,249,186,219,237,
+  126,225,248,241,227,246,29,1,220,2,187,160,139,250,238,217,179,231,39,107,215,174,61,180,111,223,62,24,134,1,195,48,
+  80,40,20,96,219,54,60,30,15,62,253,244,83,92,184,112,225,125,93,215,159,25,24,24,208,111,91,2,92,111,79,30,
+  215,15,42,1,128,116,27,21,111,55,23,139,197,78,187,221,238,169,68,34,209,179,113,227,70,94,20,69,16,66,64,8,
+  65,125,125,61,122,123,123,113,237,218,181,117,217,108,86,136,70,163,127,173,221,5,185,17,148,171,1,88,176,185,99,199,
+  142,173,218,180,105,83,155,215,235,93,237,116,58,155,8,33,178,109,219,134,174,235,217,185,185,185,228,232,232,104,252,192,
+  129,3,113,0,12,0,13,135,195,219,2,129,192,239,246,239,223,239,85,20,5,148,82,116,116,116,64,146,36,204,204,204,
+  224,149,87,94,185,218,223,223,223,202,221,18,124,65,133,26,21,187,187,187,221,45,45,45,173,110,183,123,157,203,229,186,
+  207,229,114,237,168,175,175,223,235,241,120,30,85,20,101,139,162,40,107,117,93,247,6,2,1,23,128,58,0,117,103,207,
+  158,253,231,228,228,228,222,183,223,126,251,74,54,155,69,40,20,130,32,8,16,4,1,133,66,1,0,44,0,220,66,6,
+  106,119,205,47,98,115,78,167,83,232,236,236,116,4,131,65,103,93,93,157,152,201,100,236,201,201,73,51,26,141,26,184,
+  126,245,46,168,189,240,188,231,158,123,60,109,109,109,191,234,233,233,121,164,167,167,7,185,92,14,111,189,245,22,178,217,
+  236,203,31,126,248,97,223,98,37,88,180,20,55,214,45,60,107,253,89,141,214,194,80,183,219,205,111,219,182,237,251,130,
+  32,60,203,24,179,0,252,58,28,14,191,17,137,68,232,98,93,80,27,140,199,226,129,111,5,184,29,200,66,54,22,148,
+  213,248,44,187,13,111,245,89,176,107,95,202,110,51,247,255,43,255,2,77,26,246,122,177,134,64,221,0,0,0,0,73,
+  69,78,68,174,66,96,130,
+};
+const unsigned char Settings1x[611] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,9,26,12,19,57,139,99,194,72,0,0,1,240,73,
+  68,65,84,56,203,165,146,75,104,19,97,20,133,191,153,248,76,138,77,20,10,130,74,176,204,198,133,182,221,69,172,46,
+  52,20,98,102,235,66,112,33,84,164,168,181,45,18,82,2,21,3,67,66,160,107,65,116,101,64,138,226,194,137,141,208,
+  98,87,130,210,54,137,73,23,21,130,85,105,211,151,134,32,68,68,58,51,110,102,134,49,29,235,194,179,251,185,231,156,
+  123,239,185,63,252,39,4,231,35,157,81,162,128,10,200,241,88,34,247,23,77,52,157,81,108,142,216,82,84,251,175,246,
+  3,168,166,153,171,248,250,181,1,205,108,180,29,233,140,98,52,26,117,35,157,81,12,247,90,195,170,69,1,196,116,70,
+  137,90,100,171,171,215,219,230,102,28,5,120,240,240,62,241,88,66,6,114,0,34,160,14,222,28,50,158,62,155,48,0,
+  245,246,173,17,54,215,215,144,58,37,234,245,175,247,90,179,137,221,25,21,44,49,128,96,21,111,12,12,26,154,182,37,
+  232,186,110,232,186,70,97,126,78,40,188,47,2,200,59,5,43,180,116,176,17,233,187,72,185,82,97,185,246,5,32,25,
+  143,37,238,254,243,140,78,188,202,191,52,74,149,18,221,39,123,40,150,11,152,19,76,2,186,171,65,48,146,58,12,212,
+  172,247,149,144,78,215,9,137,163,71,142,209,108,54,121,55,247,22,183,53,60,78,241,248,112,152,190,80,39,29,1,47,
+  217,153,77,142,183,127,75,46,125,94,58,215,125,170,135,128,63,192,74,109,249,242,133,240,249,249,233,169,215,85,192,0,
+  16,131,145,84,23,80,123,52,38,51,91,94,100,182,188,72,199,65,31,0,230,222,114,46,255,2,73,146,56,123,186,215,
+  250,100,118,30,34,80,28,31,14,51,245,166,196,150,166,35,238,243,179,81,111,218,35,154,35,203,217,39,143,57,208,238,
+  231,76,168,23,96,204,105,0,192,238,93,30,246,248,14,241,243,199,47,178,249,5,128,112,171,73,46,175,82,253,88,253,
+  35,108,17,96,101,227,59,251,125,1,218,246,122,120,62,243,1,32,252,105,114,116,218,73,52,77,146,107,235,171,11,64,
+  210,190,66,48,146,186,4,76,56,184,219,196,59,225,55,55,226,213,246,234,188,84,188,0,0,0,0,73,69,78,68,174,
+  66,96,130,
+};
+const unsigned char Settings2x[2129] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,8,8,73,68,65,84,88,133,237,150,107,80,84,
+  231,25,199,255,231,186,247,93,129,101,193,101,65,46,106,21,144,155,58,136,241,66,172,162,226,68,99,106,173,237,76,167,
+  173,218,241,139,83,149,96,65,116,82,167,41,176,98,117,180,214,100,72,140,153,100,58,109,194,180,90,13,70,136,134,161,
+  157,198,154,78,210,40,226,133,5,21,185,45,236,194,194,46,44,123,238,167,31,194,102,86,5,177,147,15,253,210,103,230,
+  153,247,125,207,121,159,231,255,123,158,247,157,51,7,248,191,253,143,141,152,110,67,77,77,213,114,154,165,223,7,72,29,
+  8,220,151,5,225,195,96,80,120,235,240,225,195,220,243,138,84,31,127,167,72,3,245,139,146,146,157,190,255,10,224,200,
+  145,35,38,149,144,2,105,169,179,145,151,187,16,254,64,0,173,183,91,56,239,160,215,205,5,133,130,131,7,15,14,76,
+  39,126,228,196,187,251,21,85,169,161,40,170,91,16,164,229,135,74,119,62,138,124,79,62,43,184,172,172,108,148,38,169,
+  149,221,61,143,198,253,129,128,226,72,112,96,237,154,245,218,172,204,236,36,131,73,119,254,89,177,117,117,117,212,209,83,
+  239,157,101,117,154,95,45,46,40,64,98,74,138,157,97,168,127,87,158,120,59,235,185,1,0,160,180,180,252,239,156,40,
+  173,250,228,202,101,82,85,85,94,146,36,100,45,200,166,12,122,195,130,234,163,175,23,78,90,245,145,119,76,15,7,198,
+  155,76,102,243,214,156,188,69,6,86,163,65,130,195,65,217,29,142,104,82,37,111,214,214,214,50,83,2,84,85,85,197,
+  60,249,172,98,127,197,231,0,252,162,40,246,2,0,207,243,72,77,77,51,176,180,102,203,164,212,58,234,171,248,248,248,
+  252,172,220,28,3,69,83,0,0,89,145,225,245,122,130,4,65,252,120,215,174,93,226,164,0,78,103,229,90,146,86,7,
+  79,157,58,241,253,200,231,213,199,170,115,1,88,104,154,14,210,52,13,146,36,97,52,26,9,154,166,83,38,211,39,84,
+  196,204,153,157,162,17,4,1,162,192,67,18,121,180,223,109,227,4,94,108,40,223,187,253,15,145,123,31,3,96,52,204,
+  217,156,236,92,72,138,244,199,218,218,55,94,6,128,154,154,202,28,66,82,46,205,73,155,251,154,193,96,72,209,104,52,
+  208,106,181,224,56,78,5,224,126,82,220,233,172,181,200,138,60,67,146,68,8,124,8,178,40,96,208,227,81,125,67,222,
+  17,130,147,127,246,228,126,250,49,0,134,25,74,116,36,217,147,103,165,208,127,189,120,238,188,179,166,18,10,128,204,5,
+  11,78,173,88,86,88,161,170,170,86,146,36,208,52,141,222,222,30,73,20,197,199,10,56,92,91,171,39,56,182,121,254,
+  188,52,81,149,37,198,239,243,33,20,26,71,95,159,135,32,20,101,83,89,217,206,209,167,186,21,185,56,126,162,166,50,
+  125,126,102,89,110,206,66,138,36,31,191,30,178,44,35,24,12,66,81,20,48,12,3,94,224,209,208,80,207,9,146,184,
+  109,127,73,249,133,195,181,181,122,109,136,105,202,202,152,147,103,182,152,152,150,86,215,120,32,48,118,23,42,62,133,138,
+  107,229,37,219,47,76,122,92,145,139,202,202,202,56,163,89,239,218,242,202,86,51,203,178,144,101,25,36,73,130,32,8,
+  72,146,4,138,162,224,243,249,208,218,218,10,155,205,6,91,156,13,13,13,245,28,47,202,27,21,38,246,96,94,230,188,
+  130,168,40,35,123,227,86,251,248,240,176,255,205,178,189,219,75,39,19,141,52,42,114,209,212,212,20,44,90,183,198,237,
+  114,181,173,115,36,56,104,171,213,10,134,97,192,48,12,100,89,134,63,48,2,69,86,32,138,34,8,226,107,246,244,140,
+  12,218,245,112,224,71,89,233,223,113,196,217,162,217,214,59,29,33,239,224,200,219,229,251,182,151,76,39,254,84,7,194,
+  118,244,168,115,19,205,210,103,140,6,163,46,198,106,37,131,193,160,226,241,12,208,162,40,106,54,20,191,164,10,188,72,
+  0,128,170,170,104,117,117,195,26,19,13,251,204,88,180,220,233,224,251,221,222,51,229,251,118,236,126,30,241,41,1,128,
+  175,191,100,15,30,220,75,87,41,34,142,84,136,49,134,209,223,148,229,208,28,138,97,63,91,91,180,222,32,240,34,113,
+  235,94,39,44,22,11,18,29,241,184,211,246,16,238,158,46,129,87,134,102,31,122,245,80,247,183,6,152,204,146,214,87,
+  165,199,154,177,35,35,129,218,189,98,225,60,54,198,98,192,172,36,59,218,58,30,129,33,9,36,217,103,40,215,174,127,
+  54,52,62,198,103,84,84,84,120,159,39,231,180,159,226,176,165,110,168,222,174,101,153,127,189,178,110,197,158,144,38,149,
+  250,221,249,14,24,45,209,232,184,223,13,40,50,210,231,38,33,33,33,145,204,206,202,141,214,25,53,95,58,157,78,203,
+  243,228,165,166,223,2,164,108,168,218,200,178,236,217,31,110,46,212,23,46,76,38,181,122,3,57,60,202,227,131,198,155,
+  200,77,53,35,63,103,46,104,154,6,207,243,112,56,18,73,89,146,13,254,209,225,205,75,242,11,222,109,110,110,22,159,
+  149,123,90,128,228,226,170,124,154,162,46,110,46,94,166,15,242,42,254,113,203,141,78,247,48,236,54,11,6,60,126,89,
+  30,119,203,75,114,231,80,0,1,138,162,192,113,28,146,147,83,72,127,192,31,37,138,252,218,252,252,130,247,155,155,155,
+  229,169,242,63,243,8,102,173,175,94,69,145,212,149,245,171,243,245,10,65,193,235,27,131,251,126,11,186,239,126,142,241,
+  96,16,163,33,62,232,13,138,251,46,55,126,204,41,170,2,69,81,64,146,36,2,129,0,94,40,88,78,199,218,108,57,
+  49,214,25,245,117,117,117,83,22,58,37,64,90,113,213,46,134,165,62,218,92,188,204,164,213,233,136,62,143,31,195,125,
+  247,16,10,142,32,193,145,136,142,78,175,192,243,194,141,243,167,15,158,86,68,233,229,134,198,75,188,44,75,0,0,130,
+  32,16,12,6,81,184,98,21,107,54,91,86,14,120,251,254,164,170,234,164,23,254,41,128,185,47,253,214,154,178,193,89,
+  175,51,232,143,253,96,83,161,94,33,41,136,2,143,177,1,23,252,195,62,216,237,9,24,26,37,133,238,190,129,118,132,
+  212,141,0,80,90,90,222,168,168,202,150,203,141,151,4,94,224,65,16,4,100,89,6,207,243,88,253,221,34,86,171,209,
+  110,60,253,198,201,55,167,5,72,46,174,250,133,4,241,161,221,110,91,179,109,243,139,6,5,4,28,49,90,244,60,184,
+  13,239,224,32,226,227,227,49,52,70,9,157,61,3,46,112,120,225,193,213,114,127,56,246,213,189,191,172,135,130,109,159,
+  92,185,204,115,28,7,154,166,191,129,88,245,226,26,13,69,51,63,61,249,251,99,7,158,4,248,166,45,41,197,206,21,
+  172,134,249,40,115,126,154,57,43,35,5,51,244,20,102,70,105,113,238,227,102,116,118,245,32,46,214,10,129,178,72,109,
+  237,189,46,240,88,26,41,30,105,199,79,30,221,70,168,196,123,171,87,175,101,89,134,69,32,16,192,224,224,32,28,14,
+  7,26,175,92,230,68,94,182,31,56,112,96,248,169,14,168,80,87,197,217,98,76,171,151,206,67,70,146,25,105,51,77,
+  56,215,120,29,157,143,122,96,54,154,64,234,172,184,215,209,55,42,16,82,209,84,226,0,80,178,103,255,7,36,77,237,
+  188,122,181,81,8,113,33,248,253,126,120,60,30,4,2,1,68,69,69,201,36,169,44,154,226,8,148,78,45,67,134,76,
+  58,26,93,253,1,156,185,240,5,58,31,118,128,102,52,136,77,72,69,107,91,119,136,31,243,110,237,169,63,228,195,19,
+  255,17,17,221,164,1,104,246,236,222,247,103,158,227,75,154,155,63,21,162,162,163,144,158,158,14,131,209,128,145,145,97,
+  50,20,18,219,34,131,40,0,44,0,189,42,140,121,57,173,227,231,160,52,218,81,78,66,215,131,54,8,188,128,164,148,
+  185,232,118,251,5,159,183,255,98,79,147,243,47,0,180,0,52,19,113,228,132,40,11,64,63,225,6,0,134,171,87,155,
+  92,121,121,57,30,119,191,123,249,128,167,95,112,185,238,73,195,195,35,135,94,255,245,111,174,79,232,18,0,20,2,128,
+  101,34,169,214,182,232,39,43,77,51,231,215,46,93,156,169,229,3,253,0,163,135,66,25,240,229,87,183,199,251,254,249,
+  214,247,120,95,231,32,0,46,194,229,9,151,34,138,97,1,48,225,185,213,106,37,178,179,179,163,219,219,219,123,187,186,
+  186,2,0,4,0,226,196,200,19,0,76,97,0,0,26,219,226,29,69,6,91,218,81,179,217,32,147,20,67,13,251,252,
+  228,88,207,141,215,6,91,62,252,91,56,104,194,185,136,185,28,33,76,79,192,132,171,84,1,40,17,160,225,28,66,184,
+  3,68,4,177,14,0,99,76,204,138,54,38,44,89,8,146,212,7,123,91,110,140,62,186,230,137,168,86,136,232,128,56,
+  145,60,242,30,144,19,99,216,213,8,136,240,252,177,128,201,46,83,120,140,124,175,98,146,4,223,214,254,3,174,151,133,
+  37,87,153,47,161,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Stop1x[820] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,10,17,23,45,13,107,192,156,192,0,0,2,193,73,
+  68,65,84,56,203,109,147,187,79,83,97,24,135,159,115,233,5,109,141,198,200,224,37,134,198,64,43,120,105,106,184,9,
+  169,54,136,154,152,144,184,177,16,88,252,15,92,58,56,24,105,28,28,76,28,140,11,113,208,193,187,49,184,152,80,36,
+  154,176,136,193,196,14,14,40,181,212,22,74,105,161,7,225,180,231,59,159,3,165,130,242,38,95,190,228,77,158,223,123,
+  249,229,85,216,18,143,194,97,61,61,49,241,68,192,85,118,8,13,198,4,92,142,66,101,51,167,252,3,63,107,244,249,
+  46,93,188,118,205,173,104,26,0,82,74,16,2,105,89,124,120,248,208,252,50,51,243,94,192,149,40,88,53,129,42,252,
+  194,239,243,245,70,134,134,220,243,227,227,152,249,252,182,234,78,175,151,250,142,14,62,60,125,106,38,146,201,49,1,125,
+  81,176,180,145,80,200,145,157,156,124,25,56,118,172,55,50,56,184,1,175,174,130,101,109,19,16,170,202,90,58,77,32,
+  18,209,87,231,230,142,44,149,74,103,6,195,225,231,90,103,38,243,230,120,99,99,207,249,129,1,119,54,30,199,170,175,
+  71,143,197,32,153,68,102,179,27,179,159,56,193,222,187,119,169,36,18,24,95,191,114,60,28,214,141,84,234,232,143,68,
+  34,168,245,168,234,227,254,235,215,245,204,187,119,148,11,5,212,190,62,212,150,22,148,142,14,248,254,29,117,255,126,246,
+  12,15,227,218,183,15,69,74,74,227,227,252,46,20,104,14,135,245,169,207,159,3,186,162,40,32,37,229,66,97,163,213,
+  145,17,112,185,112,245,246,226,190,113,3,93,81,112,122,60,152,241,56,249,59,119,176,129,117,195,64,10,129,2,168,255,
+  121,37,37,226,254,125,228,212,20,206,93,187,112,122,189,88,211,211,228,98,49,132,109,99,3,54,32,171,59,82,119,244,
+  187,185,25,119,40,132,174,235,56,28,14,118,7,131,212,133,66,200,42,44,202,101,196,220,220,95,1,41,68,13,86,91,
+  90,240,222,186,133,211,235,101,61,30,103,117,116,20,167,199,131,239,222,61,60,237,237,152,185,28,198,183,111,200,149,21,
+  0,116,41,229,134,154,97,32,44,139,186,182,54,92,85,120,113,120,24,219,52,209,128,3,253,253,212,157,58,197,250,131,
+  7,160,105,216,213,162,218,5,41,187,43,197,226,225,64,91,155,86,74,36,40,189,126,77,229,231,79,22,110,222,164,156,
+  201,80,94,92,36,247,234,21,107,179,179,36,111,223,70,209,52,124,126,63,233,165,37,251,199,242,114,94,137,129,83,131,
+  183,39,27,26,186,91,131,65,87,42,30,103,173,88,172,45,107,235,83,28,14,26,154,154,72,23,10,226,99,58,189,96,
+  67,167,54,6,34,2,79,114,197,98,151,105,24,135,2,173,173,122,105,126,158,138,105,110,131,85,135,131,6,191,159,217,
+  124,94,76,254,250,149,178,161,61,10,169,218,49,109,118,226,63,120,176,251,236,233,211,46,69,8,108,203,66,90,86,237,
+  79,36,147,214,167,108,118,198,134,174,40,44,110,187,198,173,34,2,122,118,178,87,133,105,27,206,69,97,121,51,247,7,
+  199,77,82,246,215,134,247,20,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Stop2x[1927] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,7,62,73,68,65,84,88,133,157,151,105,108,84,
+  215,21,199,127,111,27,119,198,54,6,239,64,16,73,176,13,70,216,198,174,177,195,20,9,197,85,149,15,169,26,65,69,
+  105,43,53,33,74,213,170,18,107,17,4,21,85,21,173,90,225,136,134,144,20,26,41,249,128,149,68,9,249,18,85,170,
+  84,181,56,168,105,84,90,136,161,106,149,80,100,236,97,22,219,227,77,246,48,219,155,55,111,235,135,121,111,198,99,143,
+  107,183,87,58,122,219,153,251,251,223,115,206,93,70,96,21,237,151,240,125,1,222,90,141,175,219,36,248,205,203,112,100,
+  37,63,97,37,135,87,224,7,85,181,181,175,125,247,212,41,175,236,243,45,117,176,109,176,44,176,109,108,211,4,203,194,
+  54,77,126,247,230,155,234,88,40,116,249,52,156,250,191,5,156,135,31,173,171,171,251,245,183,143,30,245,166,195,97,226,
+  15,30,44,133,3,182,109,231,238,29,243,54,52,176,118,251,118,126,127,245,170,26,25,27,187,120,6,206,46,199,144,150,
+  251,208,15,135,107,234,235,47,28,60,118,204,155,142,68,136,143,142,130,32,20,12,242,215,197,163,48,146,73,12,85,165,
+  253,233,167,149,201,64,160,187,39,145,240,12,194,159,87,45,160,31,142,86,215,215,247,31,60,118,204,155,10,133,72,4,
+  2,32,8,8,162,136,176,8,238,182,82,34,204,76,134,182,189,123,149,104,32,208,211,155,76,218,131,240,233,138,2,94,
+  129,19,181,141,141,191,250,214,209,163,190,100,48,72,242,225,67,4,7,238,142,94,16,132,146,185,203,191,115,82,99,36,
+  147,152,154,70,219,158,61,202,88,32,224,247,167,82,153,65,248,219,178,2,250,225,100,93,99,227,47,14,28,57,226,75,
+  4,2,164,130,193,28,84,20,115,182,48,252,37,70,237,130,11,143,54,122,50,137,169,235,116,248,253,74,36,16,216,243,
+  149,116,58,117,29,110,45,17,208,15,167,26,214,175,255,249,55,143,28,241,37,70,71,73,134,66,185,112,59,2,202,101,
+  153,141,30,15,9,211,196,46,166,20,65,107,20,133,58,69,225,145,97,96,219,54,54,144,77,38,177,76,147,246,222,94,
+  37,28,8,236,245,171,234,220,32,12,229,5,156,135,51,141,27,54,252,108,255,225,195,190,248,240,48,169,112,56,31,106,
+  4,129,114,89,166,182,161,129,244,190,125,172,27,25,33,153,205,22,68,44,16,176,206,227,161,188,165,5,189,167,135,53,
+  225,48,113,199,207,6,52,71,196,142,238,110,37,28,8,244,61,165,105,83,55,224,174,4,208,7,159,190,116,238,156,18,
+  251,252,243,28,220,13,177,3,175,169,175,103,238,236,89,244,45,91,160,190,158,234,123,247,72,106,90,110,250,57,173,186,
+  172,140,138,230,102,98,167,79,147,109,107,67,54,77,214,134,195,60,210,180,188,79,38,153,4,219,166,107,247,110,229,206,
+  157,59,223,248,24,206,137,121,152,44,147,12,133,138,70,100,219,54,13,64,250,217,103,177,125,62,4,65,64,219,181,139,
+  204,139,47,178,177,178,18,209,153,247,213,94,47,229,173,173,196,207,156,65,244,120,16,69,17,245,153,103,168,4,202,36,
+  9,11,176,156,126,227,83,83,136,138,146,103,200,139,235,104,113,88,131,186,206,99,215,174,65,69,5,217,174,46,4,65,
+  64,239,237,69,144,101,54,14,12,144,74,167,41,111,109,37,121,252,120,110,166,216,54,98,58,77,213,133,11,4,179,89,
+  210,11,106,193,118,6,133,101,45,35,192,113,92,56,157,76,65,32,18,139,177,233,221,119,17,101,153,236,206,157,8,130,
+  128,177,107,23,162,36,81,121,227,6,137,19,39,64,20,17,1,33,149,162,242,226,69,38,66,33,226,170,90,4,206,11,
+  41,41,192,93,74,157,31,96,219,249,69,199,50,77,34,209,40,155,222,127,31,81,81,208,219,219,115,34,186,187,49,186,
+  187,201,231,49,149,162,252,245,215,153,24,29,37,158,72,20,160,255,75,4,176,237,252,124,95,40,196,178,109,34,193,32,
+  143,93,187,134,40,8,232,29,29,133,85,17,64,85,241,93,185,194,248,253,251,196,99,177,34,184,165,235,88,134,129,229,
+  166,35,155,45,29,1,219,178,138,59,117,196,184,213,110,90,22,233,120,156,202,155,55,49,59,59,139,124,165,201,73,164,
+  76,134,228,252,60,217,153,25,140,120,28,51,149,194,80,85,108,203,42,68,0,48,234,234,150,79,65,190,6,220,72,184,
+  5,41,8,84,111,222,76,69,79,15,153,231,159,71,20,69,231,181,147,166,166,38,212,231,158,227,137,112,152,127,13,13,
+  161,235,122,17,212,53,11,138,82,144,79,159,237,236,233,88,86,78,177,19,17,247,125,245,147,79,82,229,247,147,125,225,
+  5,4,89,70,20,69,36,93,71,154,154,114,244,219,152,157,157,216,135,15,211,126,240,32,146,199,179,4,108,185,207,37,
+  107,192,178,114,230,134,213,141,0,80,221,220,76,213,158,61,104,7,14,32,72,18,162,40,34,102,179,72,111,188,129,52,
+  49,129,126,232,16,102,123,59,150,101,97,117,117,33,202,50,29,62,31,255,24,24,64,215,180,2,152,5,133,88,74,128,
+  109,219,75,194,95,219,214,70,165,223,79,102,255,254,2,92,211,16,47,93,98,228,189,247,136,71,34,180,41,10,178,162,
+  96,180,182,230,106,165,173,13,241,208,33,186,42,42,248,236,242,101,76,77,43,18,80,50,5,150,105,82,190,97,195,146,
+  240,87,60,254,56,230,230,205,224,158,5,84,21,241,202,21,70,63,248,128,185,145,17,116,77,227,159,111,191,141,241,225,
+  135,72,195,195,185,173,90,16,176,214,175,199,215,216,136,178,102,77,17,92,16,197,162,20,72,0,95,131,154,233,96,176,
+  99,71,95,159,108,166,211,232,241,120,190,32,231,135,135,169,244,120,144,101,25,179,186,26,207,192,0,163,239,188,195,220,
+  253,251,249,78,77,195,96,234,238,93,234,107,107,17,27,27,65,146,240,124,244,17,67,175,190,74,114,114,178,8,254,68,
+  83,19,115,137,132,61,26,139,9,31,195,57,9,96,16,254,208,59,63,95,63,61,62,222,177,163,183,87,54,102,103,81,
+  199,198,208,103,103,209,34,17,102,62,249,132,181,85,85,84,141,141,49,124,245,42,115,95,124,177,164,186,13,195,96,242,
+  246,109,54,108,218,132,55,20,98,232,252,121,18,227,227,249,239,162,36,177,165,165,133,88,38,99,221,8,135,99,34,124,
+  121,16,102,139,206,20,253,112,177,161,166,230,135,95,239,235,243,78,223,190,77,34,20,42,228,77,146,240,212,212,160,78,
+  79,47,169,238,133,207,146,215,139,88,86,70,38,22,43,192,101,153,45,205,205,204,164,82,214,95,194,225,153,44,236,254,
+  41,60,204,167,192,109,131,240,199,221,170,90,61,17,141,238,236,240,251,21,35,149,66,123,244,40,95,185,122,42,245,95,
+  225,110,58,140,76,166,32,72,150,217,210,210,66,52,145,48,255,26,137,76,0,189,63,129,252,158,191,228,76,56,8,127,
+  242,103,50,107,199,162,209,206,206,222,94,197,76,167,201,196,227,43,130,75,153,172,40,52,109,221,74,56,22,51,254,62,
+  62,254,80,132,167,78,67,116,33,175,228,169,248,58,92,223,149,201,84,71,39,39,119,238,236,238,86,12,85,205,139,88,
+  45,92,241,120,104,218,182,141,145,217,89,227,179,104,244,193,29,248,234,107,48,185,152,181,220,255,130,242,27,48,180,93,
+  211,214,205,76,78,238,232,236,234,146,245,76,6,53,145,88,29,188,172,140,166,109,219,248,247,244,180,113,107,106,106,248,
+  45,248,222,77,72,147,91,229,179,11,65,203,157,174,43,93,59,9,47,111,173,168,248,206,190,189,123,203,4,119,105,182,
+  44,44,119,229,92,96,238,59,219,178,184,19,12,234,183,103,102,238,253,22,142,207,194,44,144,0,226,64,204,209,185,172,
+  0,55,50,107,128,10,160,226,199,112,178,22,94,90,198,183,100,75,195,173,75,112,42,1,243,64,138,220,53,142,179,31,
+  173,36,96,161,144,47,185,66,156,123,143,99,10,185,149,212,237,195,2,12,114,33,206,230,52,144,0,146,64,102,49,120,
+  181,2,74,249,139,142,48,23,46,80,60,65,76,10,181,186,98,251,15,67,43,9,239,189,81,246,108,0,0,0,0,73,
+  69,78,68,174,66,96,130,
+};
+}
+namespace Application {
+const unsigned char Browser1x[928] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,4,26,7,44,7,230,25,222,143,0,0,0,53,116,
+  69,88,116,67,111,109,109,101,110,116,0,40,99,41,32,50,48,48,52,32,74,97,107,117,98,32,83,116,101,105,110,101,
+  114,10,10,67,114,101,97,116,101,100,32,119,105,116,104,32,84,104,101,32,71,73,77,80,144,217,139,111,0,0,2,236,
+  73,68,65,84,56,203,173,147,93,104,91,101,28,135,159,247,156,247,156,99,147,52,105,155,230,163,141,109,214,208,162,44,
+  184,117,178,200,196,171,41,168,48,20,111,148,41,221,69,101,56,16,111,132,161,160,183,82,16,197,251,93,136,21,71,65,
+  196,233,141,76,134,55,179,48,181,179,150,141,118,43,174,235,92,63,179,156,44,31,77,114,146,115,146,156,215,11,217,196,
+  237,214,231,250,255,123,46,254,252,126,130,7,56,254,222,236,41,224,45,93,202,253,10,44,229,251,13,165,88,208,116,237,
+  236,220,204,212,23,15,222,139,251,193,247,191,156,52,117,237,199,137,177,100,226,200,129,52,99,169,40,1,203,162,92,111,
+  178,182,105,179,184,178,201,141,141,194,101,33,196,201,185,153,169,171,255,17,188,246,238,231,185,96,184,231,183,87,142,30,
+  20,7,39,226,148,235,77,236,157,13,100,40,14,61,253,224,216,164,18,81,22,86,182,57,63,191,114,23,33,158,189,39,
+  145,0,209,104,232,167,231,159,201,138,39,50,3,148,138,121,6,71,179,68,6,135,112,90,109,242,155,235,72,223,67,235,
+  54,121,46,151,161,235,171,232,133,75,215,207,0,79,3,104,111,126,248,213,71,201,120,127,248,104,110,28,67,243,233,200,
+  16,104,2,67,74,76,67,18,176,36,137,104,47,67,241,24,177,190,32,185,236,163,164,135,7,142,188,241,193,217,105,0,
+  45,28,9,156,60,156,29,165,82,46,114,199,13,16,31,222,135,82,224,43,64,104,8,223,99,183,212,224,251,139,203,92,
+  152,95,36,98,41,246,143,15,3,188,10,32,107,78,59,150,78,246,179,112,163,64,102,34,142,175,254,253,108,189,82,226,
+  169,201,44,66,8,148,82,108,239,222,161,213,108,50,20,139,0,28,6,208,90,94,71,179,44,19,45,20,167,82,111,97,
+  215,60,28,183,75,205,241,240,234,54,66,252,163,19,66,144,136,69,185,186,122,19,203,144,0,3,0,82,215,53,191,218,
+  104,105,193,214,14,33,105,81,104,12,82,52,76,58,93,159,86,169,195,100,187,141,235,122,244,134,130,56,142,195,190,84,
+  140,66,211,3,40,1,72,67,211,242,183,182,138,195,135,198,147,100,70,134,184,189,185,205,252,218,30,30,38,77,47,200,
+  167,223,94,193,18,93,222,126,249,0,181,90,141,165,107,55,161,55,13,240,59,128,166,186,221,115,75,171,91,120,190,4,
+  32,61,146,226,216,161,24,187,133,18,119,171,13,170,174,224,118,217,199,182,109,170,213,42,143,244,167,88,93,207,3,124,
+  3,160,47,253,124,238,252,120,238,165,211,66,215,205,72,208,160,199,212,249,101,113,153,229,188,162,214,112,217,107,184,236,
+  57,46,185,17,157,194,158,199,86,217,231,218,218,206,175,115,51,83,239,220,47,82,165,80,60,113,241,178,255,157,239,195,
+  147,143,37,248,225,74,149,178,103,226,117,186,184,94,7,203,16,108,84,20,127,21,218,92,250,99,173,44,132,56,245,208,
+  22,142,77,127,252,250,104,102,100,54,28,233,51,31,207,36,73,14,134,177,44,3,167,213,102,215,174,240,231,173,60,91,
+  59,197,235,66,151,199,31,218,194,61,250,6,198,204,23,78,156,158,213,173,192,139,232,178,15,132,80,202,239,168,78,123,
+  93,9,237,179,175,63,153,62,195,255,205,223,112,108,55,247,49,218,29,149,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Browser2x[2251] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,8,130,73,68,65,84,88,133,229,151,91,108,28,
+  213,29,198,127,115,217,93,239,174,215,246,198,107,99,135,56,118,156,196,77,76,46,96,211,4,227,38,65,9,41,215,22,
+  4,15,32,158,82,42,90,181,42,82,169,224,161,15,69,106,165,170,23,30,184,20,169,45,18,73,91,21,90,90,160,37,
+  226,78,82,2,152,36,228,98,147,196,33,49,113,156,248,146,245,250,186,182,119,119,46,103,206,204,244,97,199,38,14,14,
+  42,106,223,122,164,79,163,157,57,58,255,223,249,190,51,103,207,192,255,123,83,190,76,231,214,214,239,196,194,225,208,77,
+  161,146,232,189,138,162,92,227,73,89,229,186,78,66,213,66,57,85,213,198,60,223,239,114,133,245,87,33,156,183,142,30,
+  125,198,248,159,1,220,112,195,15,43,28,87,121,180,36,162,127,111,235,141,45,218,245,95,91,31,90,177,188,134,178,120,
+  132,80,72,103,52,107,144,30,47,208,119,126,132,3,239,117,230,79,28,249,68,115,164,247,187,72,72,249,217,190,125,79,
+  76,253,87,0,237,237,15,222,165,135,67,187,190,245,192,55,99,183,222,220,162,143,103,115,104,184,172,92,182,100,174,207,
+  111,159,253,51,205,109,55,163,248,30,97,93,5,207,229,213,87,58,196,7,111,126,104,73,207,219,113,160,227,169,127,92,
+  110,124,237,139,138,111,218,244,208,79,235,234,175,120,98,231,206,135,99,203,27,171,213,254,129,65,102,10,38,137,170,37,
+  36,99,26,7,15,29,230,133,151,119,179,100,229,58,34,241,36,134,237,146,205,217,172,172,141,178,173,189,73,187,250,171,
+  95,137,28,57,212,115,103,42,117,77,104,104,240,163,125,95,10,96,211,150,31,253,120,99,219,85,63,121,236,87,223,14,
+  31,56,114,140,41,195,5,85,163,255,194,48,53,181,181,188,191,247,109,102,220,24,27,54,223,132,149,159,194,83,116,244,
+  80,152,181,117,37,100,199,210,156,58,59,200,170,198,197,220,121,199,245,250,209,174,51,237,137,196,26,57,56,112,176,227,
+  210,58,11,70,176,105,211,131,183,213,53,92,249,210,31,119,62,28,217,223,117,154,104,117,35,45,117,17,210,233,12,134,
+  94,78,73,73,140,169,201,9,98,137,114,28,199,197,114,36,158,231,97,78,141,50,156,25,97,244,194,121,238,186,227,86,
+  22,37,162,152,166,137,109,59,60,240,221,39,237,201,241,220,221,251,247,255,230,181,47,4,104,107,123,40,90,154,8,15,
+  190,248,226,163,149,137,210,40,0,185,124,1,71,8,78,157,238,97,124,218,164,181,125,43,0,174,235,98,59,46,150,144,
+  100,199,71,209,157,41,218,90,215,162,170,42,0,158,231,145,203,229,16,66,48,58,154,229,251,63,248,253,164,20,44,57,
+  112,224,113,115,182,158,122,41,64,184,132,71,118,220,127,75,178,44,17,155,187,151,40,141,147,30,206,48,154,147,44,93,
+  185,26,31,240,1,85,211,80,85,21,69,85,40,79,166,88,187,106,5,150,109,35,28,167,56,184,170,162,105,26,82,74,
+  42,43,203,184,97,235,234,36,170,251,240,101,29,104,107,123,40,26,141,235,99,111,189,241,139,184,166,21,217,124,223,231,
+  249,23,254,142,12,149,177,225,250,205,196,99,241,121,192,142,116,49,108,135,218,168,160,239,108,47,47,239,57,68,235,85,
+  203,169,77,85,176,172,254,74,146,21,229,228,114,57,12,195,192,247,97,199,253,79,26,174,163,165,102,93,152,231,128,239,
+  59,219,111,220,222,18,214,245,207,214,230,191,246,125,64,178,126,29,91,182,221,66,44,26,159,155,253,172,60,223,199,247,
+  125,142,247,244,227,41,58,59,238,189,19,53,177,152,142,211,19,236,124,179,155,151,94,223,135,162,40,120,158,135,174,107,
+  52,53,213,70,124,223,217,62,59,190,62,207,254,104,228,190,155,182,183,134,92,215,229,227,227,221,40,138,66,231,185,41,
+  182,125,189,29,207,7,85,9,170,206,1,251,72,183,120,163,117,77,35,229,165,197,216,22,87,198,185,121,99,35,195,163,
+  89,162,17,29,223,247,176,44,27,91,8,174,219,184,66,59,221,147,185,15,216,253,57,0,77,211,54,52,46,171,229,231,
+  143,63,67,228,138,85,196,195,42,107,175,109,199,114,36,121,91,33,81,162,205,43,238,56,46,66,186,164,194,130,242,210,
+  178,185,103,101,137,82,0,86,212,215,178,251,141,61,84,46,74,82,26,13,241,183,215,143,208,188,180,26,87,202,141,179,
+  125,231,69,224,73,153,138,70,35,164,150,54,211,220,212,72,117,253,42,164,175,98,218,14,51,134,32,155,23,88,66,98,
+  9,137,105,75,76,33,177,133,36,85,94,194,66,205,243,60,190,182,177,149,174,79,135,137,132,195,220,181,117,61,99,5,
+  137,170,106,21,11,2,56,66,70,51,99,147,220,115,227,122,170,244,105,242,5,19,203,150,24,150,131,97,10,166,242,130,
+  177,105,155,169,188,77,222,20,24,182,131,226,251,68,194,225,5,1,28,199,193,247,61,116,207,164,183,63,205,47,159,254,
+  19,94,40,1,158,95,58,219,103,94,4,170,166,230,199,13,181,226,217,55,14,177,114,145,79,52,46,216,216,176,146,209,
+  241,9,44,98,76,152,33,84,69,41,46,62,207,195,117,125,28,41,137,203,81,154,155,26,63,55,123,33,4,66,8,218,
+  91,86,115,126,40,131,82,177,28,233,170,160,42,249,5,1,80,181,177,137,108,190,162,178,102,41,67,182,75,100,108,136,
+  186,234,86,234,170,203,40,20,12,62,252,36,195,132,19,11,10,248,72,215,67,72,151,189,163,57,210,233,15,249,180,183,
+  143,120,105,41,247,221,125,59,82,74,108,219,198,182,109,84,85,65,69,50,57,157,35,63,147,199,247,25,91,48,2,240,
+  186,206,158,203,144,136,104,88,66,114,237,213,107,230,158,196,227,49,182,181,212,147,240,39,49,44,65,222,180,201,155,54,
+  134,41,176,252,8,239,158,83,185,16,190,138,110,163,142,153,124,1,211,52,177,44,107,14,226,233,63,252,147,37,13,77,
+  140,103,38,125,85,241,59,23,4,144,182,243,92,231,193,19,185,84,121,4,195,114,168,154,191,231,160,105,26,183,183,55,
+  243,141,117,9,20,107,138,130,89,4,41,152,2,95,43,193,18,46,134,229,208,113,228,20,166,105,206,233,147,158,94,198,
+  212,165,212,36,99,164,251,6,243,158,235,63,191,32,128,162,132,222,57,221,117,26,197,243,208,20,159,3,199,122,145,82,
+  114,105,171,92,84,78,247,225,247,201,27,197,226,5,83,80,176,68,113,177,218,14,125,153,226,206,103,24,6,166,105,50,
+  61,61,195,162,100,37,97,197,99,34,61,142,162,132,222,153,155,212,197,3,15,13,29,148,245,13,27,67,121,219,107,91,
+  187,174,81,63,220,103,80,238,141,81,153,44,199,243,60,252,96,215,235,62,121,154,131,131,128,30,197,10,94,69,91,20,
+  95,75,75,56,44,75,133,168,45,211,230,28,24,25,25,69,141,148,211,119,162,207,44,76,78,253,122,255,254,167,246,94,
+  102,13,128,20,234,99,199,58,142,206,184,150,73,77,50,198,174,142,9,122,251,206,51,51,51,51,167,116,38,131,67,56,
+  112,224,51,23,140,89,23,114,211,20,10,5,12,195,160,183,239,60,123,142,156,39,162,192,240,217,161,188,231,133,31,155,
+  23,235,165,0,67,67,7,101,170,114,245,64,127,207,224,109,155,183,94,19,154,52,124,170,34,38,101,177,48,66,8,222,
+  126,183,131,93,175,29,37,156,90,142,237,184,216,193,198,100,57,18,203,46,170,96,152,52,215,232,152,166,201,133,244,8,
+  229,87,52,241,209,59,135,141,236,248,224,35,157,157,187,206,0,214,101,1,128,216,240,112,215,120,105,89,67,44,221,63,
+  190,126,243,150,245,186,34,13,74,195,32,132,96,247,222,67,152,169,13,8,39,176,62,184,90,66,34,132,131,231,88,204,
+  228,109,154,171,36,170,166,210,63,156,231,72,199,25,123,52,61,240,151,147,221,47,190,2,184,128,19,104,65,128,56,144,
+  24,25,62,214,27,9,85,87,156,59,53,208,180,185,125,181,94,93,89,198,222,247,15,178,231,100,14,162,169,34,128,35,
+  17,142,68,10,7,79,88,248,142,133,47,76,18,97,136,248,22,61,125,99,28,222,223,47,50,67,103,223,60,217,253,210,
+  115,128,8,228,0,230,229,0,34,64,20,136,142,100,186,207,120,50,52,245,113,215,88,75,122,100,66,45,169,170,85,150,
+  175,90,139,234,187,56,194,198,151,54,210,54,9,43,146,82,221,103,113,50,204,234,37,21,212,167,226,244,28,31,116,79,
+  117,246,203,129,115,135,158,63,219,187,231,117,192,8,100,2,57,192,134,133,207,132,17,160,18,88,20,40,25,139,37,151,
+  52,44,219,114,79,69,69,221,117,213,75,107,168,107,90,22,74,166,42,40,41,9,161,135,53,44,195,194,44,24,76,140,
+  76,114,161,119,64,102,71,179,100,179,3,157,231,250,222,123,213,178,102,210,64,22,152,12,52,1,12,3,222,229,0,8,
+  28,168,4,42,46,82,89,40,20,175,170,169,89,211,178,168,178,225,218,112,164,172,86,81,245,152,134,18,118,61,207,241,
+  124,105,8,123,102,100,98,252,220,241,145,145,19,199,165,180,38,129,153,64,83,129,38,128,76,176,14,248,34,128,217,120,
+  146,64,57,144,8,84,10,196,2,192,8,197,255,146,217,24,61,138,217,138,192,102,3,40,4,118,79,3,35,193,239,139,
+  142,52,255,217,167,153,26,20,44,11,32,74,2,133,2,128,217,189,196,11,102,38,40,230,91,8,102,61,151,247,66,237,
+  75,125,156,94,4,164,95,84,92,37,56,30,6,0,50,184,250,151,27,224,226,246,111,16,152,132,111,125,241,69,247,0,
+  0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Calculator1x[686] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,6,6,13,47,29,93,206,74,167,0,0,0,53,116,
+  69,88,116,67,111,109,109,101,110,116,0,40,99,41,32,50,48,48,52,32,74,97,107,117,98,32,83,116,101,105,110,101,
+  114,10,10,67,114,101,97,116,101,100,32,119,105,116,104,32,84,104,101,32,71,73,77,80,144,217,139,111,0,0,1,250,
+  73,68,65,84,56,203,157,147,193,106,83,65,20,134,191,57,51,193,94,210,214,146,54,8,90,109,11,117,97,82,72,218,
+  110,196,165,175,16,74,23,69,16,116,227,86,220,27,10,238,196,39,80,240,61,164,186,44,90,219,36,205,109,192,130,138,
+  74,139,168,237,197,132,18,99,114,231,184,72,188,165,139,34,118,54,195,240,207,124,115,254,255,204,152,165,229,210,67,160,
+  204,217,70,217,44,45,151,244,206,221,219,103,58,253,236,233,115,220,223,197,230,214,203,83,55,182,90,71,164,211,1,237,
+  118,7,107,133,161,161,115,44,46,220,4,56,6,52,155,7,167,2,62,188,223,195,90,33,58,108,209,108,30,113,253,198,
+  92,162,37,128,153,153,185,83,1,83,83,57,140,49,168,42,198,24,140,49,137,102,150,150,75,26,53,219,60,184,127,239,
+  191,252,175,62,122,194,165,11,153,126,5,221,110,143,242,234,99,126,117,58,125,85,21,253,7,64,68,142,45,220,90,89,
+  225,213,218,11,188,135,139,147,147,124,221,223,199,251,152,145,243,99,180,126,70,168,247,4,233,17,140,8,209,225,1,34,
+  134,254,13,30,23,4,1,149,173,55,92,157,157,69,85,9,195,144,124,62,143,181,150,48,12,201,229,114,136,8,141,70,
+  3,197,176,56,95,36,149,74,209,237,118,169,213,43,72,187,221,198,199,30,85,77,66,2,136,227,24,48,116,58,29,188,
+  247,0,120,85,172,181,232,96,78,44,92,153,154,225,245,250,58,24,195,68,54,203,206,78,3,239,99,198,50,227,188,219,
+  221,5,85,198,50,19,40,80,171,213,18,72,2,248,252,233,35,197,98,161,111,161,209,32,151,187,134,115,142,122,189,206,
+  124,177,136,136,80,173,214,112,206,81,40,20,146,42,55,43,27,200,32,118,156,115,120,239,241,189,30,214,90,156,115,136,
+  72,210,119,17,3,244,75,79,165,82,39,187,48,121,121,154,202,230,91,192,48,158,205,178,93,175,227,172,37,61,60,204,
+  118,24,98,84,25,10,2,126,15,218,60,58,58,74,20,69,39,95,226,252,194,2,0,214,90,226,233,105,12,96,68,208,
+  65,128,70,132,189,189,47,124,255,241,141,195,232,96,16,114,31,80,174,86,55,206,252,157,255,0,132,92,203,16,0,89,
+  204,210,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Calculator2x[1382] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,5,29,73,68,65,84,88,133,197,151,205,111,27,
+  69,24,198,127,227,100,109,199,113,252,149,214,105,226,56,31,36,166,31,170,148,210,164,45,81,123,66,21,161,23,75,28,
+  10,170,64,130,63,4,4,7,144,224,192,21,33,161,130,16,66,156,160,85,17,106,73,14,64,21,137,182,66,52,105,19,
+  209,10,218,180,77,19,103,109,39,177,173,216,142,119,237,29,14,254,168,157,181,99,71,8,241,28,86,154,103,102,223,121,
+  230,157,103,222,157,133,255,25,162,186,49,57,57,121,30,184,168,235,122,215,127,53,161,162,40,169,66,161,240,246,173,91,
+  183,46,1,180,239,232,255,252,131,15,63,234,10,6,3,187,6,145,178,97,79,157,62,89,245,132,229,39,203,174,247,223,
+  123,247,34,96,22,160,235,186,59,24,12,240,197,87,95,115,109,250,39,12,195,104,178,158,214,97,177,88,120,229,229,41,
+  222,122,243,13,52,77,243,150,249,157,25,0,224,231,95,127,225,194,235,175,114,108,236,40,66,136,122,67,246,4,41,37,
+  115,243,11,124,127,249,71,46,188,118,190,166,175,174,128,108,54,203,177,177,163,172,70,30,112,239,222,239,45,77,178,112,
+  231,1,35,163,253,228,11,5,98,209,77,124,62,23,137,196,22,67,195,189,76,140,159,229,216,216,81,190,249,246,59,52,
+  93,171,121,207,210,40,160,16,2,125,199,224,70,200,231,11,196,99,9,226,241,4,66,8,158,46,71,89,90,138,176,252,
+  68,5,64,215,181,74,38,181,92,109,204,186,25,40,67,81,172,45,9,104,107,179,112,252,196,33,58,58,108,24,134,100,
+  236,133,16,110,183,147,92,78,55,197,209,180,38,2,116,189,248,210,242,211,21,130,253,163,4,250,70,91,18,209,12,170,
+  26,5,32,215,138,0,171,213,202,167,159,125,201,169,83,19,28,57,28,194,231,241,34,44,123,55,163,52,36,201,84,138,
+  191,30,44,49,59,123,147,246,246,54,180,92,110,119,1,57,77,103,226,248,113,126,187,121,147,217,217,27,204,206,222,216,
+  243,196,141,48,16,12,182,144,1,45,71,104,52,132,213,106,99,113,113,145,248,198,58,178,113,229,105,10,33,4,142,14,
+  7,61,126,63,251,187,187,209,155,9,200,105,58,153,116,154,110,175,151,51,167,79,99,24,6,134,97,32,13,3,67,202,
+  74,187,33,183,163,93,205,101,178,89,211,49,172,227,1,141,116,38,195,221,249,219,168,107,17,0,252,254,30,66,135,142,
+  112,255,207,69,226,177,162,153,186,247,237,103,112,120,132,71,15,255,102,99,61,14,128,199,235,163,55,16,36,177,185,65,
+  60,186,86,49,180,162,40,236,243,31,192,229,246,152,74,181,73,128,150,211,200,100,50,168,107,17,194,225,48,0,87,174,
+  92,97,120,116,148,120,44,90,195,5,7,6,217,88,143,215,112,131,67,195,196,212,8,83,83,83,184,92,46,0,82,169,
+  20,211,211,211,120,188,94,211,135,196,44,64,211,72,167,211,0,36,18,137,10,47,44,210,196,217,29,86,19,215,209,105,
+  35,159,207,227,114,185,112,56,28,85,153,213,113,118,117,34,105,65,192,246,246,54,94,159,143,235,215,175,3,224,239,241,
+  3,180,204,41,138,66,42,149,170,196,76,165,82,40,138,66,155,197,210,124,11,202,8,14,12,113,226,228,68,165,173,70,
+  215,75,220,56,197,107,132,100,45,186,78,255,192,32,19,39,199,17,101,78,93,39,16,28,96,102,102,166,82,245,172,86,
+  43,135,14,31,164,80,40,52,223,130,114,138,30,63,90,226,206,220,31,0,184,61,94,122,250,2,168,171,43,181,92,111,
+  0,53,178,194,221,185,219,53,156,205,222,193,228,153,73,108,86,133,226,231,70,162,105,121,34,106,12,163,217,22,72,41,
+  145,72,146,137,205,90,115,13,15,215,225,134,76,220,192,240,16,81,53,202,195,191,238,215,156,2,223,126,63,46,183,199,
+  148,233,186,2,202,34,107,204,229,176,153,56,187,195,94,103,156,157,245,168,202,185,115,231,112,58,157,0,108,109,109,113,
+  245,218,85,60,158,22,78,65,73,134,201,92,146,22,77,40,33,159,207,87,38,7,112,58,157,228,245,60,93,174,78,140,
+  166,30,144,69,23,4,130,3,76,156,24,71,8,129,68,178,166,198,9,244,7,75,92,113,33,107,106,204,196,69,212,88,
+  37,150,219,237,6,32,153,76,2,208,102,177,180,98,194,34,150,31,63,98,97,126,174,24,200,227,193,127,160,143,232,218,
+  42,11,119,230,43,220,254,3,125,196,76,92,111,253,164,54,128,249,70,100,24,32,37,201,68,130,112,56,76,56,28,38,
+  153,72,96,179,91,77,156,189,46,103,171,132,74,38,147,149,213,151,23,183,243,195,86,55,3,229,33,213,230,114,212,49,
+  92,61,174,195,97,167,189,189,157,84,42,85,99,66,69,81,40,94,219,91,170,3,18,175,207,251,204,92,254,146,225,188,
+  181,156,172,195,129,164,47,24,100,122,102,26,93,43,29,67,171,194,243,7,67,24,5,243,53,223,124,10,12,16,8,250,
+  74,230,42,255,60,173,170,81,122,131,253,140,87,85,189,70,156,213,102,103,242,244,139,216,108,54,144,2,132,36,167,233,
+  168,107,241,234,153,236,192,118,141,0,33,68,250,201,211,229,206,179,103,95,170,236,67,185,50,142,140,132,138,237,42,126,
+  248,185,208,179,113,165,142,193,161,145,242,0,83,186,67,35,7,89,93,93,69,8,145,1,220,64,174,70,128,148,242,157,
+  31,46,95,250,88,88,106,46,128,255,254,207,164,34,9,33,13,67,102,179,217,79,40,213,104,83,112,135,195,209,171,40,
+  74,160,80,40,184,164,148,138,148,114,215,171,123,171,16,66,232,128,208,52,109,83,215,245,40,176,2,232,141,86,103,7,
+  58,1,7,187,252,188,236,17,121,64,7,210,64,134,210,230,253,3,159,9,192,80,44,64,103,237,0,0,0,0,73,69,
+  78,68,174,66,96,130,
+};
+const unsigned char Calendar1x[603] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,251,0,251,0,251,85,89,109,150,0,0,0,9,112,72,89,115,0,0,11,18,0,
+  0,11,18,1,210,221,126,252,0,0,0,7,116,73,77,69,7,213,6,3,15,29,43,75,94,175,19,0,0,0,62,116,
+  69,88,116,67,111,109,109,101,110,116,0,67,114,101,97,116,101,100,32,119,105,116,104,32,84,104,101,32,71,73,77,80,
+  10,10,40,99,41,32,50,48,48,51,32,74,97,107,117,98,32,39,106,105,109,109,97,99,39,32,83,116,101,105,110,101,
+  114,39,51,239,88,0,0,1,158,73,68,65,84,56,203,157,147,177,138,26,81,20,134,191,59,115,103,28,80,80,176,16,
+  123,11,5,17,130,1,21,124,5,43,9,193,98,11,193,224,110,49,181,181,189,196,128,32,90,167,77,47,250,2,98,37,
+  34,193,38,33,149,133,173,144,197,217,48,222,20,50,119,103,214,221,37,155,83,205,156,123,206,119,207,255,159,25,241,225,
+  99,243,27,208,228,255,98,34,129,102,247,211,221,155,59,227,241,56,159,191,12,110,101,144,216,108,54,0,8,33,254,9,
+  80,171,213,0,144,0,153,76,134,82,169,116,213,44,132,120,54,39,165,228,124,62,95,0,229,119,239,41,22,139,36,147,
+  201,200,4,225,230,167,32,199,113,72,165,82,44,22,11,228,75,55,62,125,14,194,52,77,12,195,0,192,243,78,24,225,
+  230,201,100,66,181,90,37,159,207,227,186,174,206,151,203,101,178,217,44,167,211,9,33,4,190,239,107,96,4,208,233,116,
+  88,173,86,244,251,125,102,179,153,214,57,26,141,46,122,165,196,182,109,76,211,212,0,25,6,236,118,59,218,237,54,135,
+  195,1,215,117,117,161,109,219,186,198,48,140,136,36,35,236,65,46,151,99,189,94,51,24,12,24,143,199,248,190,31,209,
+  44,165,68,41,133,101,89,215,19,0,244,122,61,150,203,37,158,231,209,237,118,113,28,7,203,178,104,181,90,212,235,117,
+  230,243,57,141,70,131,88,44,246,188,132,233,116,170,71,12,118,45,132,96,191,223,235,13,72,41,35,18,52,32,157,78,
+  107,211,2,151,149,82,40,165,16,66,160,148,194,247,125,125,150,72,36,30,1,199,227,145,225,112,120,245,13,188,246,94,
+  40,20,46,128,135,135,63,108,183,91,42,149,202,139,197,225,8,12,13,124,144,219,239,155,27,224,235,253,253,239,55,255,
+  145,63,127,253,184,249,11,104,130,125,246,45,41,107,239,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Calendar2x[1298] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,4,201,73,68,65,84,88,133,237,150,75,104,84,
+  87,24,199,127,231,220,185,51,99,154,52,153,196,196,196,73,66,26,243,180,46,138,34,166,19,95,20,2,109,22,21,52,
+  116,81,21,109,154,6,103,86,129,110,196,138,15,170,184,177,22,107,227,163,160,22,138,209,90,112,97,160,11,187,209,200,
+  160,118,225,19,68,226,104,2,9,84,146,48,36,205,99,94,247,222,211,69,50,151,76,50,177,218,196,69,105,255,48,12,
+  124,223,189,231,255,187,223,247,157,123,15,252,175,255,186,68,186,160,223,239,95,39,132,232,84,74,101,47,132,137,166,105,
+  97,195,48,62,58,125,250,244,239,51,115,142,57,110,248,206,231,243,101,87,85,85,241,232,209,35,202,202,202,230,5,16,
+  10,133,114,31,62,124,120,12,88,251,74,0,74,169,138,177,177,49,186,187,187,49,12,131,80,40,52,47,128,88,44,134,
+  101,89,213,233,114,114,102,224,192,129,3,210,178,172,12,211,52,25,31,31,159,151,177,109,34,37,192,219,233,114,105,103,
+  32,16,8,220,2,234,148,82,11,2,32,132,64,8,113,174,189,189,253,243,153,185,185,90,144,177,117,219,54,234,125,190,
+  215,54,179,166,160,147,79,38,132,160,235,230,77,46,93,188,152,147,238,250,180,0,186,174,87,148,150,150,50,50,58,74,
+  36,26,229,117,234,32,133,64,10,129,144,18,41,37,139,92,46,106,106,106,112,187,221,31,164,189,126,102,160,185,185,57,
+  75,74,185,104,113,94,30,134,97,216,230,177,88,140,93,173,173,172,89,181,138,119,171,171,249,176,161,129,223,174,93,3,
+  96,124,124,156,155,93,93,28,59,122,148,79,154,154,248,225,204,25,123,189,132,97,144,151,155,139,97,24,57,59,119,238,
+  116,255,45,128,148,114,181,148,82,184,221,110,12,195,176,227,67,131,131,20,21,21,113,240,208,33,246,238,219,71,207,243,
+  231,248,91,91,81,74,241,203,229,203,52,239,216,193,141,235,215,233,186,113,131,167,79,159,78,246,29,80,74,33,164,164,
+  188,188,92,57,28,142,173,51,253,102,181,64,74,217,80,190,108,25,134,105,98,77,139,123,139,139,217,127,240,32,76,45,
+  122,238,236,89,38,38,38,16,66,176,165,169,137,109,219,183,19,141,70,169,42,47,167,175,175,15,129,61,124,152,166,201,
+  154,186,58,209,221,221,253,41,112,246,165,0,154,166,53,44,95,190,156,196,180,167,79,234,199,243,231,121,22,10,113,255,
+  238,93,242,242,242,248,254,212,41,0,178,178,178,236,255,28,143,135,254,190,62,219,92,8,129,101,89,84,85,86,226,114,
+  185,234,94,165,5,213,101,101,101,24,137,196,44,128,103,161,16,189,61,61,252,241,226,5,15,30,60,224,254,189,123,41,
+  121,33,4,37,37,37,244,247,247,207,2,240,120,60,40,165,50,90,90,90,150,204,9,208,220,220,156,229,116,58,223,202,
+  207,207,39,158,166,2,95,31,62,204,79,29,29,220,186,115,7,221,225,160,253,196,137,20,115,33,4,197,197,197,76,76,
+  76,16,14,135,237,57,72,230,107,107,107,149,174,235,95,204,9,160,105,218,74,77,211,200,200,200,72,25,192,112,56,204,
+  165,142,14,6,6,6,248,115,100,132,171,87,175,18,14,135,217,176,113,99,42,0,80,82,82,2,48,57,7,51,170,208,
+  216,216,40,116,93,255,108,78,0,33,196,122,175,215,43,76,211,76,217,251,67,131,131,236,221,179,135,247,86,172,160,166,
+  178,146,175,118,239,102,151,223,207,190,253,251,83,204,133,16,148,148,150,2,76,182,97,90,101,44,165,240,22,23,227,245,
+  122,223,105,105,105,169,181,61,167,3,248,253,254,224,199,155,54,249,214,111,216,192,200,232,104,74,249,19,241,56,3,3,
+  3,56,116,157,252,252,252,228,251,125,242,41,132,64,78,189,120,146,229,207,95,188,152,156,236,108,59,46,165,68,147,146,
+  88,44,198,145,35,71,134,134,134,134,222,63,121,242,100,40,5,32,16,8,12,183,181,181,101,23,20,22,50,17,141,242,
+  42,18,144,98,34,165,180,129,180,52,49,33,38,45,219,218,218,72,36,18,235,236,109,24,8,4,50,93,46,87,214,146,
+  194,194,180,3,56,39,192,180,62,39,91,97,155,77,131,72,230,135,135,135,185,112,225,130,165,105,218,207,199,143,31,15,
+  218,0,166,105,174,212,117,157,183,167,246,244,124,164,148,66,41,133,105,154,68,163,81,194,225,48,79,158,60,33,24,12,
+  98,24,6,35,35,35,102,34,145,104,1,148,99,218,77,107,70,71,71,101,32,16,152,151,185,16,2,167,203,133,238,112,
+  224,116,58,201,204,204,36,51,51,147,220,220,92,170,171,171,121,252,248,49,69,69,69,177,222,222,222,141,192,175,54,128,
+  166,105,107,125,62,31,183,111,223,102,243,230,205,184,221,179,190,27,243,86,36,18,33,24,12,82,81,81,145,209,211,211,
+  179,37,5,64,41,181,218,227,241,80,88,88,200,149,43,87,176,44,235,37,75,253,51,73,41,89,186,116,41,5,5,5,
+  210,225,112,52,2,206,36,128,84,74,45,18,66,80,95,95,255,70,204,147,210,52,141,68,34,129,82,42,15,16,73,0,
+  43,18,137,124,217,217,217,249,173,105,154,105,207,110,11,41,33,132,25,143,199,191,1,226,51,207,132,89,76,30,30,221,
+  128,115,129,125,147,123,59,14,132,129,49,64,165,61,148,2,218,212,111,33,165,0,19,120,115,253,253,87,234,47,148,164,
+  196,128,74,9,165,126,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Chat1x[422] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,213,6,6,13,5,59,224,168,3,114,0,0,1,51,73,
+  68,65,84,56,203,149,147,65,78,132,48,24,133,223,79,155,176,109,34,18,247,19,111,97,244,30,198,149,196,3,152,56,
+  25,131,58,139,137,16,96,244,4,70,99,226,17,52,46,245,2,156,132,160,48,43,23,99,169,27,74,42,3,136,127,194,
+  162,180,239,235,123,253,91,130,81,81,18,28,1,120,194,248,154,163,5,80,255,169,40,9,20,239,194,230,121,14,165,20,
+  148,82,189,91,187,174,11,0,224,81,18,92,1,88,232,137,120,25,14,122,222,223,59,192,100,178,219,140,57,128,197,108,
+  234,143,14,29,47,195,13,0,0,32,203,178,94,17,17,129,136,224,56,78,51,222,0,12,9,77,193,104,128,41,110,67,
+  180,147,78,64,151,176,237,64,159,69,85,41,143,247,217,29,3,241,207,47,31,248,95,150,187,0,70,171,137,155,185,138,
+  162,0,17,65,8,49,216,74,249,45,79,24,103,119,0,20,133,209,245,177,101,209,253,108,234,163,44,75,41,132,96,67,
+  151,105,123,107,231,214,243,188,179,198,130,126,3,250,50,197,203,16,159,31,197,225,203,243,235,187,94,196,24,171,108,219,
+  150,0,214,105,154,126,1,88,155,93,32,51,215,170,92,157,38,241,205,91,61,103,1,144,0,170,250,83,245,255,95,0,
+  165,115,93,248,243,71,0,172,22,178,122,77,213,130,72,51,210,15,141,12,145,160,100,148,198,107,0,0,0,0,73,69,
+  78,68,174,66,96,130,
+};
+const unsigned char Chat2x[783] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,2,198,73,68,65,84,88,133,237,150,193,107,211,
+  80,28,199,191,239,189,98,176,89,87,102,139,194,168,76,25,136,245,62,240,54,112,12,143,130,199,30,118,23,198,96,151,
+  110,115,141,8,99,203,14,99,135,33,196,131,120,144,57,240,63,216,160,176,129,39,175,10,59,137,32,226,193,66,109,210,
+  144,84,109,242,158,135,53,37,75,147,44,233,244,180,125,225,145,240,242,222,251,126,242,126,191,223,75,128,75,93,116,145,
+  52,131,21,69,153,115,93,247,37,231,252,234,48,102,140,49,155,82,250,100,109,109,237,205,48,243,161,40,138,105,89,150,
+  24,86,237,118,91,212,106,53,211,191,102,38,13,64,183,219,29,201,102,179,176,109,123,224,153,16,98,160,5,251,199,198,
+  198,224,56,206,136,127,30,77,191,15,131,74,98,46,132,0,33,131,17,63,55,64,152,113,28,212,63,5,56,143,177,167,
+  129,28,80,20,101,78,8,161,57,142,147,13,155,176,178,178,18,187,160,36,73,152,157,157,69,185,92,30,8,69,34,0,
+  33,196,139,229,229,229,172,44,203,177,70,81,178,44,11,219,219,219,40,151,203,167,204,19,3,56,142,147,147,101,57,52,
+  211,3,160,167,12,188,251,209,209,81,216,182,157,56,20,169,202,208,111,30,5,16,28,147,58,7,206,50,78,11,16,236,
+  31,10,32,206,44,202,136,16,210,175,125,175,254,125,207,41,0,158,8,32,238,109,227,178,188,88,44,162,217,108,162,80,
+  40,128,115,14,0,104,181,90,96,140,217,240,125,131,34,1,210,152,134,1,28,30,30,58,211,211,211,25,0,88,93,93,
+  61,121,109,74,59,134,97,84,1,184,137,0,206,218,238,56,128,253,253,253,15,156,243,169,153,153,153,43,227,227,227,141,
+  133,133,133,251,0,244,94,235,43,242,36,12,150,16,231,60,244,62,170,212,52,77,123,84,175,215,95,169,170,218,177,109,
+  251,250,226,226,226,20,0,171,231,217,15,65,98,128,168,22,132,241,100,154,102,102,115,115,243,249,241,241,241,67,195,48,
+  126,74,146,244,174,82,169,76,244,118,157,121,16,193,16,244,129,188,44,246,135,32,78,33,153,206,0,116,119,119,119,63,
+  1,184,93,169,84,110,20,10,133,187,0,190,226,164,2,68,24,128,196,24,179,116,93,151,243,249,124,127,97,195,48,144,
+  207,231,67,65,130,125,173,86,11,153,76,198,238,153,252,234,93,221,189,189,189,47,0,62,123,198,158,130,0,66,215,245,
+  167,91,91,91,170,235,186,89,0,80,85,21,185,92,14,71,71,71,206,193,193,193,153,101,75,41,237,52,26,141,103,0,
+  218,0,226,207,243,16,17,0,215,0,220,4,48,185,179,179,243,67,8,33,234,245,250,239,165,165,165,247,146,36,221,1,
+  48,25,211,38,0,220,2,80,68,194,255,205,176,65,4,128,52,63,63,255,184,84,42,189,229,156,119,76,211,124,173,105,
+  90,77,215,117,55,100,188,95,28,128,3,224,15,2,91,157,6,0,213,106,181,68,41,253,70,8,105,18,66,30,108,108,
+  108,124,76,178,216,48,10,141,41,165,244,30,99,172,180,190,190,254,253,127,25,95,234,82,158,254,2,241,140,161,96,32,
+  125,197,246,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char FileManager1x[378] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,213,6,16,18,41,48,44,67,93,90,0,0,1,7,73,
+  68,65,84,56,203,189,146,189,74,3,65,28,196,127,251,145,69,177,176,73,44,124,128,128,207,225,19,8,130,136,31,129,
+  136,104,37,34,104,173,32,10,130,181,165,112,6,242,20,190,78,138,120,8,90,104,178,183,123,107,17,15,205,37,94,238,
+  82,56,229,252,255,59,179,179,179,226,168,221,4,216,19,130,136,10,8,129,125,224,73,103,135,175,78,46,73,146,1,225,
+  123,90,4,33,36,215,15,183,81,8,32,142,15,154,225,188,125,138,148,211,151,245,48,198,153,250,4,175,134,49,55,157,
+  14,58,35,30,163,59,250,214,148,186,254,138,177,180,118,47,70,6,25,217,183,134,237,213,151,82,2,221,94,131,193,231,
+  59,90,215,144,204,9,169,70,222,114,150,83,183,215,40,20,210,191,115,253,181,156,231,151,148,35,245,14,231,146,31,129,
+  245,250,219,92,81,52,128,181,31,60,199,203,149,90,216,202,71,168,218,130,79,253,236,71,44,213,6,64,234,221,255,182,
+  48,33,96,236,43,155,27,135,99,131,212,123,164,82,164,222,231,62,208,56,39,90,59,107,247,139,11,254,76,235,218,84,
+  7,231,146,194,8,95,134,90,101,183,231,143,210,134,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char FileManager2x[667] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,2,82,73,68,65,84,88,133,237,148,205,107,19,
+  81,20,197,127,153,36,218,84,48,65,138,164,74,186,16,108,236,34,75,65,148,110,252,8,214,165,127,128,165,160,224,206,
+  86,93,136,46,92,186,16,138,244,95,40,93,235,170,136,85,112,163,130,11,65,92,104,235,194,133,133,150,154,106,172,249,
+  232,100,230,189,235,98,38,166,38,157,201,100,38,208,133,30,120,48,195,220,243,238,185,119,238,61,240,31,255,58,98,221,
+  2,46,93,200,223,32,158,124,148,140,119,13,237,128,105,105,12,81,183,22,151,62,205,134,82,119,177,56,54,51,115,245,
+  108,93,153,191,68,180,45,90,53,68,219,166,104,171,46,186,81,21,213,168,136,50,183,68,109,255,20,85,255,33,118,109,
+  83,236,90,73,236,234,134,216,149,117,217,46,125,150,235,147,227,245,137,226,137,219,94,57,60,203,154,40,230,239,141,100,
+  15,223,157,155,91,24,180,54,222,83,253,178,212,115,1,169,163,167,48,210,199,152,190,115,179,190,250,109,243,254,211,103,
+  203,15,3,11,56,127,110,76,22,159,188,196,92,123,75,45,68,242,38,6,142,156,36,150,62,206,229,169,41,158,191,248,
+  216,145,47,225,71,54,146,41,222,205,95,9,157,220,193,60,133,201,199,158,95,125,5,104,219,4,224,195,87,155,181,178,
+  238,57,245,112,198,160,144,75,32,170,17,82,128,178,0,88,47,107,78,143,38,187,175,204,14,8,240,102,197,162,144,195,
+  87,128,225,123,137,75,20,2,236,107,27,98,46,15,90,133,132,16,224,77,236,5,161,59,160,125,136,189,192,239,158,64,
+  67,184,27,94,173,116,118,231,204,104,210,227,158,144,2,154,191,160,249,63,219,231,32,63,84,253,243,188,92,58,240,55,
+  119,71,124,132,45,112,136,217,140,193,235,93,42,110,79,218,222,149,225,140,225,10,240,158,165,64,29,40,228,18,20,114,
+  126,145,254,8,61,3,205,214,69,53,162,240,67,232,18,247,204,136,116,223,140,40,162,19,70,133,223,16,118,233,64,159,
+  156,48,180,15,248,16,123,50,162,168,67,24,213,136,34,175,97,31,141,40,5,212,131,8,24,132,150,242,62,26,209,8,
+  80,6,74,128,242,18,16,3,210,224,40,207,141,79,35,162,64,43,68,52,162,21,136,66,180,123,68,187,223,154,239,10,
+  180,118,98,155,188,150,128,44,206,224,91,192,119,47,1,113,247,112,237,193,66,248,178,119,199,190,246,156,94,254,114,8,
+  24,2,50,192,0,93,214,53,0,76,55,113,21,167,253,171,128,246,19,0,206,28,28,4,246,247,65,128,237,38,220,2,
+  42,180,76,114,239,241,27,4,79,89,165,234,42,236,66,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Mail1x[550] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,11,18,0,
+  0,11,18,1,210,221,126,252,0,0,0,7,116,73,77,69,7,213,6,6,12,23,54,231,47,101,43,0,0,1,179,73,
+  68,65,84,56,203,197,147,65,72,20,97,24,134,159,89,70,247,119,112,23,215,177,173,131,167,234,88,104,23,221,240,212,
+  146,134,134,129,6,65,25,102,97,68,68,224,69,139,60,111,108,219,65,17,4,145,144,78,118,232,32,136,29,234,166,201,
+  222,108,219,14,9,230,213,52,88,171,63,98,254,29,115,103,60,168,131,131,163,16,8,126,199,247,251,222,231,127,127,62,
+  62,56,238,210,130,196,116,38,85,15,228,2,90,23,158,14,12,126,62,148,152,206,164,234,211,153,148,27,84,233,76,202,
+  221,129,7,39,216,125,249,73,255,51,150,22,243,252,150,146,98,209,230,231,250,47,254,252,149,116,223,185,207,139,151,207,
+  125,73,180,131,204,185,124,158,120,252,20,85,85,49,52,45,132,82,54,170,88,36,153,76,250,32,250,158,0,185,219,183,
+  186,249,240,126,134,229,229,111,180,180,92,37,86,93,77,69,133,129,97,24,0,100,179,89,166,167,222,114,175,167,151,137,
+  215,175,114,128,182,23,128,105,214,96,89,54,61,119,31,120,166,221,42,20,10,152,166,137,8,235,68,34,81,79,247,1,
+  132,16,52,54,54,240,110,102,154,75,201,203,0,88,150,133,82,10,165,20,139,95,191,208,126,173,3,33,68,48,0,224,
+  68,60,78,226,98,130,55,147,147,156,61,115,26,128,242,176,206,202,202,15,58,175,119,162,135,252,155,215,131,86,25,141,
+  68,49,99,149,52,95,105,246,180,209,145,33,202,117,13,219,182,17,84,122,122,104,159,219,117,153,155,155,229,198,205,46,
+  79,114,74,155,60,124,244,152,143,243,243,40,101,249,198,247,1,62,45,44,208,218,214,198,230,134,141,235,56,148,254,109,
+  160,161,225,148,28,234,206,159,227,251,234,218,193,95,144,82,210,144,104,218,110,232,97,223,96,25,32,140,8,53,39,107,
+  145,82,6,2,134,199,198,71,251,254,227,142,134,143,228,26,183,0,252,253,172,100,78,184,216,168,0,0,0,0,73,69,
+  78,68,174,66,96,130,
+};
+const unsigned char Mail2x[1426] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,5,73,73,68,65,84,88,133,229,151,221,111,83,
+  101,28,199,191,207,233,122,90,250,198,216,218,181,180,101,51,93,183,142,173,142,224,54,50,221,165,198,12,8,226,32,128,
+  23,4,46,252,7,188,35,222,145,56,19,64,17,29,113,113,23,106,98,52,241,202,120,225,95,32,54,8,139,97,9,108,
+  48,88,193,185,141,85,100,221,218,158,246,156,211,115,158,231,241,98,235,241,244,101,172,19,18,47,252,37,191,156,243,188,
+  253,190,159,231,229,60,207,115,128,255,216,200,118,42,143,142,142,134,92,78,219,151,154,166,30,224,156,115,70,25,40,227,
+  224,156,129,82,6,193,34,204,229,114,153,51,151,46,125,54,251,194,73,47,95,24,125,109,252,243,79,255,204,100,50,156,
+  82,202,41,165,92,215,245,50,207,229,178,252,202,229,139,233,115,231,222,59,88,111,92,75,93,226,151,63,124,221,23,8,
+  254,120,230,236,187,94,66,8,36,73,66,161,80,48,92,146,36,72,146,4,171,85,196,224,171,67,59,150,22,254,56,210,
+  179,183,235,222,47,137,235,247,158,27,224,202,149,11,135,131,129,208,247,39,79,157,222,165,170,42,100,89,6,165,20,140,
+  177,50,167,148,26,101,3,7,6,109,139,139,243,135,186,246,118,204,37,18,191,206,252,107,128,241,171,31,191,29,10,183,
+  126,51,114,236,84,99,161,80,128,162,40,85,194,149,174,40,10,116,93,199,192,129,65,219,210,226,210,193,142,206,232,195,
+  235,215,111,76,111,27,96,124,236,163,55,90,130,193,239,142,30,61,209,152,207,231,235,18,47,185,170,170,208,117,29,125,
+  253,3,182,249,223,31,189,217,209,254,210,228,141,201,223,30,213,13,112,245,234,39,47,55,123,189,63,141,140,188,211,180,
+  93,241,146,203,178,12,198,24,250,251,7,108,179,247,103,15,199,186,34,63,76,78,222,74,111,9,48,54,118,49,220,184,
+  115,231,207,39,78,158,110,81,20,5,133,66,161,42,56,231,188,174,60,89,150,97,177,88,240,74,95,191,99,250,246,237,
+  99,237,209,206,111,167,166,166,10,102,189,178,125,96,98,98,194,33,54,240,91,39,79,157,238,164,140,33,155,205,150,5,
+  46,189,111,149,71,41,69,38,147,129,170,170,240,120,60,104,109,109,133,166,105,124,98,98,252,182,195,225,238,59,127,254,
+  188,94,210,20,204,0,54,145,140,13,31,122,43,74,4,1,153,76,6,148,210,186,92,215,117,72,146,132,133,133,5,200,
+  178,12,191,223,143,161,161,33,12,15,15,163,88,44,226,241,227,199,112,58,157,228,248,241,19,221,185,220,234,7,102,205,
+  6,115,130,81,253,152,207,215,34,44,47,47,27,159,218,102,189,149,101,25,233,116,26,162,40,34,20,10,33,26,141,194,
+  225,112,148,213,215,52,13,189,189,189,152,158,158,198,210,210,18,34,145,246,6,70,217,89,0,239,215,4,224,224,132,16,
+  2,206,121,21,128,174,235,72,167,211,80,85,21,187,119,239,70,36,18,193,254,253,251,65,8,41,91,253,156,243,245,88,
+  156,131,115,14,183,219,13,77,211,64,41,133,197,98,1,33,229,211,94,6,0,0,132,16,232,76,7,231,28,153,76,6,
+  107,107,107,104,106,106,66,48,24,68,44,22,67,67,67,131,49,207,197,98,209,16,50,11,155,1,24,99,136,199,227,88,
+  89,89,129,32,8,149,114,213,0,0,224,247,249,49,61,59,141,238,174,110,56,157,78,99,68,204,162,102,145,90,194,230,
+  247,84,42,133,96,48,184,158,102,124,107,0,198,24,98,237,49,220,189,127,23,177,104,12,130,32,212,45,102,46,103,140,
+  33,153,76,98,207,158,61,70,186,210,202,198,196,28,128,16,130,182,112,27,18,55,19,80,85,181,230,202,223,234,235,120,
+  240,224,1,188,94,47,172,86,107,25,224,166,0,230,158,48,198,32,138,34,122,98,61,184,118,227,26,100,89,70,177,88,
+  132,170,170,208,52,13,154,166,25,16,181,96,230,230,230,224,118,187,225,118,187,141,120,181,108,211,41,40,193,184,156,46,
+  196,162,49,36,110,38,176,175,123,31,128,245,133,90,217,27,115,94,42,149,130,197,98,129,207,231,219,180,231,207,4,168,
+  156,75,95,147,15,225,80,24,83,51,83,104,105,110,65,114,62,89,222,128,0,4,4,28,28,86,139,21,254,93,126,196,
+  227,241,154,235,162,110,128,202,134,145,214,8,82,79,82,88,89,91,193,200,225,17,184,156,46,99,42,204,83,179,184,188,
+  136,229,191,150,81,80,10,176,139,246,170,78,109,9,80,218,84,204,141,24,99,184,51,123,7,225,96,24,241,174,56,114,
+  185,28,158,62,125,90,86,135,16,2,81,20,17,105,139,192,219,236,197,204,253,25,116,70,58,225,220,225,124,230,40,212,
+  4,48,55,80,139,42,146,243,73,244,246,244,194,46,218,177,186,186,90,51,160,57,207,229,112,33,30,139,227,225,194,67,
+  4,188,1,184,157,110,163,30,101,186,104,214,171,222,154,54,130,48,198,144,147,114,72,103,210,24,236,27,4,24,32,73,
+  146,1,104,246,90,167,162,69,176,160,163,173,3,121,57,143,172,148,53,117,144,151,105,86,141,64,41,64,94,201,195,233,
+  114,194,223,226,175,217,235,205,158,149,22,240,6,32,21,36,228,229,60,28,14,71,85,121,77,128,162,86,132,223,231,135,
+  34,43,198,157,96,59,162,149,230,114,184,160,233,26,24,175,222,11,204,0,30,198,184,32,8,2,124,94,31,24,99,176,
+  219,237,176,217,108,85,219,237,102,7,208,86,38,8,2,8,17,4,0,65,0,18,128,108,9,192,3,160,137,82,221,243,
+  245,87,95,72,148,81,194,153,233,138,181,113,136,252,115,47,96,96,140,131,49,10,102,252,25,109,148,115,6,206,74,229,
+  188,34,205,160,40,178,7,64,0,64,26,0,47,157,205,34,128,102,0,141,0,220,0,172,27,254,34,173,136,245,59,168,
+  10,32,7,224,9,128,213,202,127,67,171,201,107,126,33,207,97,12,0,5,160,109,120,237,195,225,127,103,127,3,94,204,
+  217,235,137,31,210,117,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Monitor1x[611] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,10,19,17,58,52,159,194,36,103,0,0,1,240,73,
+  68,65,84,56,203,165,147,61,104,20,65,24,134,159,221,153,157,221,189,194,20,34,18,209,75,97,12,66,208,72,2,1,
+  33,96,97,115,96,17,36,106,180,17,82,88,137,193,70,17,15,46,133,164,176,178,49,130,149,86,134,147,72,136,88,156,
+  66,42,27,65,68,61,73,180,9,130,7,241,206,52,10,130,119,59,127,22,49,49,33,39,74,124,225,101,186,103,158,225,
+  251,38,40,149,138,15,128,115,108,35,222,251,105,74,165,162,111,181,154,190,217,106,250,191,197,57,231,51,157,173,183,84,
+  42,122,185,70,155,184,59,79,185,82,253,167,155,71,11,135,185,112,162,7,0,9,16,69,138,114,165,138,234,0,37,99,
+  136,20,103,142,46,67,16,50,251,166,11,156,7,60,24,139,54,134,114,165,202,248,233,62,0,194,141,100,21,167,68,105,
+  202,217,161,58,23,135,7,17,74,146,38,9,105,46,69,37,41,34,151,144,36,9,0,214,152,223,6,107,17,42,70,36,
+  49,253,61,123,8,115,5,250,187,27,168,232,19,143,23,14,32,188,3,35,201,66,13,128,177,118,171,65,148,40,70,6,
+  107,236,219,213,193,203,165,6,93,249,83,136,72,146,36,49,81,162,16,113,132,138,213,159,13,78,14,212,8,3,137,200,
+  21,224,219,44,65,48,130,144,130,171,199,159,179,80,223,141,179,14,235,44,83,111,3,140,109,3,184,60,122,157,128,128,
+  143,181,25,222,47,127,37,191,23,14,229,119,114,164,211,48,216,55,142,247,0,158,169,251,183,218,3,110,207,220,68,40,
+  129,148,17,66,10,62,55,230,232,221,63,202,195,215,53,204,247,59,88,99,177,198,254,122,130,221,10,120,242,174,155,40,
+  85,168,88,17,197,10,33,63,112,176,243,25,190,89,35,12,2,158,46,245,210,252,145,1,139,237,13,96,117,222,22,71,
+  232,29,206,57,46,61,234,192,249,29,104,109,208,86,99,113,171,6,27,1,90,103,140,13,15,112,111,238,213,38,220,226,
+  60,192,139,182,155,184,242,101,101,179,193,149,243,67,92,27,59,134,214,25,89,43,67,27,141,214,107,231,134,26,77,163,
+  81,95,135,73,96,122,114,242,198,246,127,227,255,230,39,112,67,0,83,217,168,244,129,0,0,0,0,73,69,78,68,174,
+  66,96,130,
+};
+const unsigned char Monitor2x[1886] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,7,21,73,68,65,84,88,133,181,151,223,111,92,
+  71,21,199,63,103,238,221,95,222,93,219,113,226,159,73,155,95,141,83,133,168,105,155,95,18,105,35,212,199,10,130,16,
+  188,32,30,170,138,7,158,16,249,19,64,149,16,18,15,20,144,90,85,85,5,130,135,70,205,3,8,36,4,10,130,134,
+  64,21,129,144,146,86,56,113,82,151,56,181,29,59,78,156,245,254,240,238,222,59,51,135,135,123,189,187,174,157,8,161,
+  48,210,232,158,153,185,247,252,252,158,51,231,10,192,187,239,254,242,69,9,194,31,199,113,116,200,198,46,231,189,39,153,
+  142,46,157,172,157,243,155,246,122,215,201,249,230,239,188,247,0,145,136,249,87,51,138,190,243,230,79,223,188,4,32,231,
+  206,157,59,98,2,249,235,169,207,159,42,141,140,140,18,134,33,143,99,168,42,170,218,85,220,123,214,214,26,92,159,190,
+  198,249,247,206,215,227,168,245,226,27,111,188,125,37,204,228,194,183,78,156,56,81,26,30,25,161,82,173,96,109,252,95,
+  9,16,145,46,141,64,186,84,175,88,103,113,206,226,172,75,105,135,243,14,35,194,222,189,251,56,243,229,51,165,223,254,
+  230,215,111,1,39,67,103,221,179,99,35,99,84,170,21,126,242,243,63,240,206,123,23,113,137,187,54,9,84,213,255,217,
+  35,198,8,175,124,229,36,223,56,115,146,3,79,29,32,142,226,103,1,66,239,125,46,12,51,88,107,121,231,252,69,246,
+  78,30,102,100,168,140,8,136,152,196,82,35,244,229,3,214,154,30,68,80,5,17,80,5,69,83,203,1,214,221,174,201,
+  190,87,84,19,28,220,123,80,227,23,191,250,59,95,255,226,49,178,217,44,206,251,44,192,134,128,59,231,217,53,186,141,
+  131,123,71,19,166,169,95,179,89,161,127,32,96,121,217,161,36,130,73,133,171,38,241,246,233,129,87,159,196,223,43,94,
+  21,245,30,239,21,49,134,217,25,143,136,193,247,120,114,19,226,28,130,117,235,118,1,34,12,244,9,195,59,50,44,46,
+  57,92,26,157,117,30,154,90,239,1,60,120,36,89,123,159,42,176,238,17,211,13,101,79,136,205,103,21,80,21,98,167,
+  196,22,98,7,206,41,99,99,25,198,71,179,96,192,250,100,58,4,235,5,235,32,246,116,158,201,119,218,115,38,88,15,
+  94,165,163,64,175,7,54,41,224,85,136,156,98,189,18,59,69,66,216,57,158,103,104,91,158,124,33,192,186,196,218,108,
+  86,137,215,133,167,66,172,23,156,118,215,177,131,86,228,153,95,174,115,103,165,209,85,160,199,3,155,66,224,211,16,128,
+  32,2,3,3,1,195,219,243,20,242,33,131,131,194,210,10,148,243,194,196,132,225,218,77,135,119,9,40,147,48,120,212,
+  67,59,246,84,235,45,86,235,77,42,213,38,214,186,78,200,146,108,218,66,129,245,188,158,95,174,83,111,122,10,133,44,
+  165,190,12,147,79,151,232,47,135,4,6,202,101,131,247,176,99,24,14,236,13,249,232,70,76,181,225,105,71,142,118,100,
+  105,69,150,102,219,18,69,113,26,127,7,18,96,2,65,125,194,223,136,121,180,7,154,145,210,174,180,48,213,152,193,65,
+  195,142,225,60,171,205,85,84,33,87,108,113,251,254,42,207,60,95,224,137,93,5,178,165,26,179,51,130,0,3,101,79,
+  182,160,100,242,130,106,6,239,60,234,77,82,134,173,39,138,225,94,98,233,214,89,32,8,153,140,161,92,54,136,49,24,
+  99,216,243,100,150,61,59,139,60,168,37,22,141,143,102,153,24,207,114,104,127,137,76,70,56,245,124,145,233,153,54,19,
+  35,202,203,95,40,146,207,102,211,186,144,164,39,29,75,61,213,102,141,215,127,152,199,124,38,11,186,30,16,216,189,167,
+  192,183,191,53,76,62,147,3,132,192,8,227,59,10,252,99,234,62,205,182,229,185,131,67,124,110,50,100,116,40,207,213,
+  233,7,28,218,95,230,232,51,49,167,143,23,57,242,212,16,102,51,166,59,227,94,61,75,161,207,60,26,132,34,66,33,
+  23,208,151,13,193,36,57,254,241,92,133,91,243,109,26,45,120,225,185,128,125,79,244,209,106,121,174,220,80,246,237,242,
+  156,121,169,159,209,161,62,254,118,245,62,83,51,45,212,43,138,79,139,146,130,247,88,239,240,214,210,90,243,105,26,62,
+  4,132,179,183,214,248,209,219,21,144,16,145,0,49,1,198,4,152,32,96,223,147,80,111,90,14,62,217,199,237,197,22,
+  55,111,229,184,58,211,226,244,145,65,62,184,82,227,247,151,148,187,247,243,73,1,178,201,237,231,157,195,123,197,59,193,
+  59,195,157,59,173,180,16,61,164,18,70,145,167,86,79,4,38,51,36,48,201,115,225,30,172,84,35,246,79,20,185,57,
+  103,105,52,115,252,115,202,162,186,202,159,47,103,89,174,100,81,60,138,67,69,16,113,136,40,72,0,162,32,154,222,33,
+  230,33,30,160,91,169,146,105,48,98,16,19,32,198,208,106,27,22,238,90,198,182,123,110,47,10,158,28,243,139,25,106,
+  141,144,149,106,14,99,28,105,65,78,97,167,136,6,24,85,84,12,34,190,195,127,107,12,172,95,239,29,5,164,135,54,
+  88,27,242,239,133,54,187,198,34,22,238,22,48,65,136,243,134,202,106,30,49,30,163,2,88,84,13,162,154,222,164,126,
+  35,63,54,23,34,211,149,47,61,79,73,169,148,78,25,220,93,9,248,228,78,147,218,90,136,49,6,19,134,72,152,208,
+  98,100,147,242,27,120,164,252,141,17,252,150,24,232,54,56,164,119,92,119,166,237,213,194,98,200,96,73,136,34,65,140,
+  118,242,57,105,191,122,95,87,54,108,116,38,15,207,2,16,130,208,224,92,140,4,65,143,26,218,97,216,104,26,102,230,
+  2,188,243,136,186,78,135,164,222,163,222,161,105,47,176,174,176,170,118,26,22,231,226,180,223,124,88,33,82,229,236,171,
+  47,243,250,207,126,135,179,155,91,178,20,30,20,10,33,107,107,118,203,243,71,141,32,12,56,251,202,75,68,81,180,53,
+  8,173,179,124,243,107,167,121,245,171,47,224,156,235,105,193,147,150,218,165,221,45,74,23,160,176,17,176,233,13,218,5,
+  221,58,38,18,15,199,113,196,210,242,210,6,197,58,10,168,42,205,86,147,216,198,88,27,99,99,219,161,99,107,177,54,
+  198,57,215,249,48,142,99,226,118,68,161,216,151,34,27,90,205,38,198,8,185,124,62,49,42,182,180,163,136,66,33,143,
+  49,221,50,157,9,51,29,186,179,235,189,79,90,104,219,219,78,91,172,115,73,139,189,65,184,229,211,217,57,170,213,58,
+  55,174,223,76,0,58,183,192,220,167,243,220,153,95,162,242,160,130,179,142,219,179,183,169,87,235,220,156,254,152,40,234,
+  134,173,23,132,198,24,211,142,109,140,17,131,179,137,192,71,9,7,104,212,234,12,13,13,113,244,232,177,142,245,10,28,
+  62,124,152,201,201,73,234,245,6,141,70,131,254,254,65,142,29,59,142,17,195,122,145,18,17,226,40,34,48,38,2,196,
+  24,35,31,46,44,204,51,180,109,59,97,38,211,73,159,20,223,160,96,140,33,8,130,100,154,128,254,193,1,86,86,86,
+  184,116,233,47,148,202,101,130,192,80,42,23,153,154,154,98,234,218,20,197,98,31,165,114,137,90,173,202,251,23,223,167,
+  88,42,146,201,100,59,216,88,92,90,2,145,105,96,48,156,189,245,201,89,107,253,133,19,39,142,247,141,141,141,19,140,
+  4,233,63,158,235,130,177,247,95,207,37,23,205,196,216,78,234,245,42,165,82,25,17,97,120,199,40,213,145,85,156,119,
+  20,10,5,64,201,61,157,103,173,182,70,190,47,135,49,134,118,20,113,103,97,129,203,31,92,110,126,120,245,163,239,1,
+  25,1,50,175,189,246,221,47,237,222,179,251,251,34,102,191,181,46,252,127,253,156,170,170,181,214,205,78,95,159,254,193,
+  133,11,127,250,35,176,184,94,255,12,208,15,148,128,28,91,180,106,143,97,248,36,166,196,192,42,80,3,156,108,241,98,
+  183,112,63,254,209,173,201,233,248,15,107,246,196,185,36,0,42,57,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Terminal1x[668] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,10,18,21,37,27,70,252,216,25,0,0,2,41,73,
+  68,65,84,56,203,125,147,207,75,84,81,20,199,63,119,124,51,42,100,65,134,209,194,192,18,10,87,174,92,181,168,69,
+  203,54,237,130,210,106,145,186,8,23,65,96,173,130,54,181,14,74,176,69,98,130,254,1,181,45,37,8,194,162,52,80,
+  35,157,177,24,43,29,125,142,153,239,221,95,167,197,27,103,70,45,15,28,238,189,220,115,63,247,123,14,231,168,161,231,
+  131,7,141,177,253,214,218,238,56,142,27,140,49,84,220,98,108,245,57,113,103,221,122,20,199,143,181,214,15,2,165,212,
+  253,163,77,199,122,78,182,180,166,51,181,117,128,128,240,79,243,222,177,94,44,146,95,202,55,142,79,188,190,157,91,204,
+  166,3,224,250,137,150,214,244,149,174,78,166,63,77,179,159,137,36,228,211,109,167,232,237,233,205,228,22,179,61,129,136,
+  212,41,149,226,203,220,28,163,47,31,225,197,33,34,120,113,120,239,17,73,220,121,65,196,225,189,163,243,66,63,169,148,
+  66,68,14,5,21,121,194,212,199,89,192,225,189,148,64,201,227,109,144,23,193,121,11,128,117,201,90,5,240,52,54,53,
+  36,193,222,227,177,120,239,240,37,64,108,182,8,215,151,9,55,11,0,56,231,118,2,68,132,169,15,51,244,245,222,229,
+  217,200,19,150,11,121,4,193,57,75,33,252,73,20,109,38,129,74,37,31,238,1,120,161,190,33,195,171,55,47,184,209,
+  213,71,97,109,153,193,145,135,172,21,126,65,141,165,254,64,109,9,64,41,133,93,0,47,158,217,233,121,86,127,252,161,
+  163,253,28,153,160,150,247,147,159,17,239,203,143,80,149,237,158,20,16,32,112,220,236,190,197,240,216,0,111,39,39,8,
+  210,10,168,41,41,87,59,20,184,221,69,4,248,58,251,141,75,87,47,130,8,40,120,55,62,83,190,211,58,230,204,249,
+  246,242,217,57,191,171,6,128,243,46,169,145,74,1,208,113,182,173,74,186,66,165,82,251,40,16,40,174,110,253,191,13,
+  171,242,223,81,3,165,148,6,169,111,62,222,204,194,194,66,185,93,247,179,198,35,135,137,226,8,165,212,239,0,212,112,
+  54,55,127,109,108,108,52,216,216,40,18,134,33,97,184,70,20,69,24,107,176,214,98,183,39,209,90,172,53,104,163,89,
+  89,41,104,224,105,32,226,239,228,151,190,147,205,205,95,54,198,100,180,214,149,81,54,166,12,217,30,101,173,53,70,155,
+  216,88,59,36,34,247,254,2,215,162,130,23,152,77,245,29,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Terminal2x[1488] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,5,135,73,68,65,84,88,133,229,150,239,143,93,
+  69,25,199,63,51,115,118,47,139,187,75,3,217,130,72,163,20,42,109,73,200,138,237,90,160,24,53,209,18,106,196,196,
+  87,96,98,124,97,136,9,137,127,128,33,17,21,2,34,63,94,25,224,133,188,64,8,9,63,92,107,196,20,66,2,68,
+  40,216,66,151,110,45,108,149,178,219,42,148,237,238,182,187,189,119,239,189,51,103,102,30,95,156,115,207,61,119,239,221,
+  198,148,26,95,248,220,204,61,115,158,51,231,121,190,243,253,206,51,115,224,255,221,20,192,19,79,255,118,139,70,255,38,
+  74,188,70,68,206,251,79,94,20,17,66,8,196,24,139,214,125,31,137,177,237,19,161,169,20,147,105,154,222,113,215,157,
+  247,188,13,160,158,124,242,241,205,186,223,188,117,237,232,216,224,218,145,139,85,146,36,231,124,150,34,130,136,224,156,227,
+  159,31,29,147,23,94,248,67,173,81,107,108,187,247,222,7,223,75,148,209,143,141,94,179,101,112,120,104,88,205,28,157,
+  198,123,127,206,1,180,44,73,18,70,46,90,171,118,124,115,231,224,174,63,141,63,6,220,152,120,252,214,75,46,254,172,
+  154,57,58,205,27,111,252,133,253,239,28,64,162,116,189,172,148,66,107,141,214,26,99,76,209,47,183,51,249,141,209,92,
+  177,97,61,178,65,88,183,238,243,170,209,104,110,5,72,136,84,146,36,193,90,203,196,254,3,76,76,190,137,73,250,64,
+  218,32,164,245,47,109,79,25,162,148,198,34,66,235,87,122,153,24,3,63,184,245,118,46,191,124,61,70,107,156,179,149,
+  12,64,110,33,4,148,82,40,165,249,233,221,63,70,0,145,152,5,202,53,108,5,205,52,141,121,252,88,104,12,165,113,
+  34,29,49,30,190,235,119,104,109,176,214,226,189,47,164,238,90,113,169,247,204,207,46,21,73,68,58,147,72,9,76,113,
+  141,49,131,34,89,226,40,17,132,236,154,131,240,62,96,140,193,57,75,122,38,0,32,36,231,181,102,169,16,178,96,146,
+  43,32,197,204,164,228,87,249,172,85,6,2,149,43,166,218,113,36,98,76,206,64,154,182,1,132,16,218,11,13,240,105,
+  96,238,248,41,204,96,133,180,218,204,88,136,173,25,231,140,228,180,118,82,159,61,203,102,47,56,239,104,52,107,212,27,
+  85,154,205,58,167,171,75,5,128,212,151,0,148,203,78,27,131,16,49,21,225,138,205,155,48,104,254,254,254,4,161,233,
+  242,100,237,154,206,102,88,150,4,66,76,105,212,171,84,151,23,105,218,122,30,20,250,62,147,85,145,49,6,103,45,169,
+  115,120,159,118,3,48,198,100,12,124,178,200,23,174,134,29,91,111,97,253,231,54,243,218,91,47,50,51,53,69,176,62,
+  219,209,144,54,43,49,226,125,202,201,165,57,170,181,197,82,69,40,148,106,11,219,90,3,214,90,92,154,226,125,232,13,
+  64,68,80,73,228,208,193,189,196,152,242,229,141,215,115,235,183,127,196,129,77,251,216,243,215,151,56,249,241,44,226,51,
+  186,67,244,156,174,158,164,86,95,66,148,48,48,212,79,145,115,69,71,145,49,96,157,195,57,87,228,76,188,247,197,54,
+  105,180,33,77,61,11,179,75,196,227,167,56,246,222,49,94,30,220,205,213,95,26,229,218,209,109,220,246,189,59,216,245,
+  242,51,188,253,210,107,212,235,53,22,171,11,196,16,59,215,176,162,167,121,31,81,74,21,18,116,2,136,17,231,44,74,
+  107,162,68,68,7,148,138,160,20,202,120,68,5,68,101,101,230,197,114,186,126,2,235,44,125,21,157,137,12,217,216,94,
+  153,85,241,24,0,107,45,214,218,78,0,49,230,12,24,141,79,3,11,179,139,12,95,122,33,99,55,108,231,235,99,223,
+  98,237,69,151,240,250,187,175,240,232,35,15,49,253,183,195,196,52,116,37,232,202,187,194,239,125,108,3,112,43,1,72,
+  196,185,20,163,13,49,6,210,96,217,242,213,235,249,225,77,183,243,238,209,9,30,121,250,1,38,223,220,139,175,123,140,
+  6,83,49,93,201,87,211,126,37,24,235,44,174,204,64,154,230,18,88,139,54,6,219,180,28,155,249,23,159,204,30,231,
+  254,39,126,201,238,93,127,164,49,95,43,157,3,173,216,171,80,190,146,148,124,108,244,89,0,103,45,205,94,18,88,231,
+  48,90,35,128,54,154,87,118,191,72,99,174,134,4,65,107,221,147,214,178,179,235,145,234,184,20,231,72,246,161,210,174,
+  188,188,10,178,69,104,140,33,134,72,189,106,169,87,109,87,148,177,91,182,115,213,134,141,171,78,245,195,15,63,96,207,
+  248,171,61,153,137,65,74,253,118,229,228,12,68,82,231,80,90,23,123,126,11,119,139,66,128,141,95,220,196,157,223,255,
+  121,143,240,153,61,248,251,95,177,103,252,213,78,181,114,52,229,35,219,175,100,32,22,251,128,38,70,161,89,247,160,186,
+  105,61,124,248,48,191,126,246,190,85,1,76,77,29,194,46,231,53,94,2,14,16,75,31,57,229,243,167,216,7,172,179,
+  36,73,31,90,107,22,142,159,238,153,224,249,135,198,121,158,241,85,1,156,201,180,54,133,246,93,0,162,196,188,52,52,
+  191,248,217,221,36,73,114,198,79,173,179,177,16,60,115,115,39,186,1,132,16,236,114,173,86,209,218,176,188,92,163,94,
+  175,157,85,130,178,125,231,39,163,76,46,252,153,153,167,46,101,113,113,177,240,175,89,179,166,56,144,148,82,22,64,7,
+  239,247,237,159,120,71,190,50,182,141,129,129,129,79,157,28,96,223,137,231,176,161,94,220,15,13,13,113,217,101,235,48,
+  198,112,193,240,5,204,205,207,137,68,38,129,97,117,243,119,111,30,93,51,60,244,250,206,29,59,207,191,242,202,13,170,
+  82,169,16,66,32,196,72,12,33,235,183,90,12,196,16,9,177,211,31,243,241,157,247,173,126,123,188,181,150,249,249,57,
+  57,50,125,164,57,117,104,234,182,131,7,223,223,171,128,254,237,95,187,238,27,35,35,35,247,107,173,175,2,233,63,39,
+  52,244,52,149,250,52,157,254,224,31,71,30,56,116,112,106,15,112,178,85,39,3,192,133,192,80,222,239,99,213,99,230,
+  172,77,128,8,4,160,1,156,2,230,203,73,20,208,95,106,255,13,75,1,15,216,28,200,255,222,254,13,111,233,1,150,
+  24,15,8,92,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char TextEditor1x[574] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,9,22,18,55,41,59,82,2,72,0,0,1,203,73,
+  68,65,84,56,203,165,147,77,104,19,65,20,199,127,51,221,163,72,22,34,45,226,177,224,41,160,88,43,1,15,130,21,
+  132,120,236,69,208,182,39,175,165,23,21,60,138,32,197,32,245,34,126,128,154,22,138,49,189,91,26,17,77,92,16,237,
+  193,98,211,141,27,76,253,192,213,108,235,16,21,90,145,205,120,48,67,179,109,106,43,190,203,255,13,204,251,207,111,102,
+  222,131,255,12,97,146,226,93,250,128,25,224,216,86,122,120,136,188,169,147,0,151,71,47,157,1,102,14,30,119,216,142,
+  182,18,88,77,189,1,240,237,249,57,182,163,87,79,74,221,172,59,45,141,211,222,84,64,89,21,88,221,147,167,172,10,
+  252,232,122,216,86,95,76,75,6,199,138,28,233,31,6,24,55,4,196,227,113,196,137,165,63,139,125,77,101,77,125,223,
+  39,127,79,50,116,237,25,31,158,140,51,183,16,132,64,135,213,122,31,165,20,245,122,125,195,75,7,65,128,155,73,173,
+  21,123,203,124,45,77,117,0,61,17,3,219,182,177,109,59,82,236,251,62,110,38,197,224,88,145,197,199,25,94,149,151,
+  81,165,28,64,207,200,100,99,246,175,4,230,228,129,116,129,197,124,134,185,183,10,85,202,241,115,255,69,206,159,189,48,
+  11,136,77,9,180,214,20,210,189,12,92,121,138,55,125,135,202,231,239,168,249,7,188,239,26,166,179,205,55,70,8,180,
+  214,100,179,89,126,201,67,204,59,14,239,62,213,89,122,61,5,189,105,118,173,172,0,218,52,161,110,75,16,134,33,187,
+  63,166,121,244,165,155,251,185,28,221,242,37,59,251,110,145,76,38,113,93,151,55,149,5,140,139,92,79,80,173,86,241,
+  60,143,145,201,6,71,59,43,172,238,72,16,30,24,37,145,72,96,89,22,150,101,69,186,120,3,65,44,22,67,107,77,
+  173,86,67,107,141,148,18,173,53,66,8,132,16,173,219,27,17,3,165,20,142,227,108,58,117,198,100,125,24,131,137,155,
+  183,175,159,250,135,41,158,48,201,111,90,157,232,152,121,9,252,18,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char TextEditor2x[1523] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,5,170,73,68,65,84,88,133,229,151,93,108,28,
+  87,21,199,127,119,230,206,236,108,179,107,59,235,143,196,41,37,45,9,109,66,82,160,164,47,128,65,248,35,171,180,10,
+  162,106,42,90,250,84,53,15,1,41,85,196,183,252,22,9,164,244,5,33,162,130,140,146,242,161,150,22,210,74,37,128,
+  146,216,177,13,201,3,34,162,193,78,105,140,149,15,187,137,237,218,105,156,196,245,218,222,217,221,153,123,120,168,103,187,
+  142,189,182,99,224,137,191,116,71,71,103,238,220,243,63,255,123,231,156,25,248,127,135,42,119,227,39,173,206,11,249,124,
+  248,140,235,218,191,2,88,169,189,239,64,97,239,178,8,28,60,120,176,194,117,221,158,208,132,31,67,132,204,197,231,248,
+  250,222,52,109,47,116,0,172,216,142,223,247,99,4,136,185,177,119,44,203,250,244,158,61,123,222,47,37,160,75,236,199,
+  214,223,251,209,123,170,171,171,1,161,251,130,144,72,122,32,2,176,98,123,235,39,183,130,8,227,227,227,31,185,54,118,
+  125,23,240,139,5,9,136,72,93,34,145,176,223,123,111,140,241,27,227,40,165,152,202,248,40,245,129,72,69,91,150,176,
+  41,153,143,226,236,217,55,169,175,175,167,178,162,202,86,74,213,221,190,5,69,2,90,235,90,203,182,173,208,132,0,36,
+  235,155,57,220,118,154,196,218,102,64,56,220,118,154,85,107,26,1,56,220,118,138,187,234,190,132,136,112,168,237,20,94,
+  205,23,1,56,212,118,138,88,245,23,144,89,219,73,53,16,0,97,16,96,89,182,210,90,175,93,140,192,186,212,234,20,
+  219,30,218,134,136,65,228,41,164,40,79,81,165,219,159,47,241,73,241,42,34,80,50,85,41,197,200,200,48,195,67,195,
+  229,21,80,74,213,85,86,84,162,181,94,34,80,121,95,185,57,74,41,18,137,36,182,109,175,41,75,0,168,113,28,7,
+  99,12,237,237,237,243,22,186,83,50,165,72,167,211,184,174,139,136,164,202,18,16,145,170,40,251,116,58,125,71,129,150,
+  82,66,68,34,101,87,151,37,96,140,169,116,28,7,17,161,163,163,99,209,140,238,132,12,64,75,75,11,90,107,38,111,
+  12,165,118,167,147,127,48,98,53,219,138,119,253,130,217,89,186,5,73,173,53,198,24,90,90,90,86,20,168,156,18,87,
+  46,157,227,216,43,7,184,220,247,102,114,103,227,227,59,91,182,61,169,206,116,255,122,227,239,122,142,255,86,3,236,223,
+  191,223,181,44,203,86,74,33,34,156,60,121,114,201,64,219,183,111,95,114,206,165,190,51,28,123,229,121,198,174,254,139,
+  237,59,158,230,153,111,255,156,100,239,63,149,247,250,27,52,244,143,240,146,54,91,52,64,109,109,109,202,117,221,130,136,
+  216,34,82,84,96,177,189,141,236,133,130,247,247,158,230,216,171,207,115,243,218,32,13,15,63,192,83,143,124,149,112,106,
+  132,194,208,85,134,253,28,250,196,81,126,115,127,62,112,44,117,84,3,228,243,249,213,53,53,53,5,17,241,68,100,69,
+  146,139,8,231,207,118,115,252,213,3,76,191,63,70,195,195,155,248,212,151,159,160,144,25,102,114,176,139,32,63,195,149,
+  203,175,113,166,167,195,12,108,156,206,163,172,23,167,51,153,239,106,0,203,178,170,61,207,19,17,193,24,67,103,103,231,
+  146,193,75,238,50,58,240,15,46,252,253,117,108,201,210,248,217,173,108,249,196,231,200,221,122,135,201,193,78,242,185,44,
+  125,67,62,23,199,224,250,196,75,226,38,106,94,158,118,172,111,190,214,62,121,19,62,124,11,170,61,207,179,140,49,136,
+  8,205,205,205,203,202,250,220,223,142,243,199,151,127,136,35,51,236,248,252,131,60,176,241,62,252,137,203,76,92,234,32,
+  231,231,120,235,74,150,75,215,20,185,192,165,101,215,115,216,21,27,166,7,6,175,254,126,223,190,125,55,163,53,34,5,
+  82,241,120,220,138,228,239,234,234,90,50,248,192,91,237,12,244,28,101,215,163,13,108,184,247,110,252,27,23,153,24,56,
+  193,84,182,192,185,129,44,23,70,13,98,175,98,195,103,190,194,211,187,191,71,252,174,85,244,246,246,218,150,53,60,167,
+  24,105,128,32,8,86,199,98,49,55,34,208,216,216,184,232,22,252,229,79,135,24,57,127,140,189,223,111,37,85,179,134,
+  177,206,31,48,145,241,233,25,244,25,188,38,164,214,172,231,137,111,124,139,205,15,53,22,187,169,49,6,207,243,28,99,
+  204,156,98,20,29,194,26,173,181,54,198,96,140,161,171,171,107,129,189,254,48,243,161,183,79,240,236,179,95,67,75,142,
+  161,139,111,243,231,158,12,3,163,57,42,107,215,179,165,241,49,82,245,31,103,244,150,48,218,221,13,64,83,83,83,84,
+  13,181,136,204,105,72,122,150,221,186,168,15,136,8,77,77,77,115,50,15,130,0,223,247,57,113,228,71,156,255,235,17,
+  60,47,206,207,126,250,75,148,82,172,170,72,145,170,127,144,29,233,39,89,123,207,253,196,98,49,92,215,197,243,60,226,
+  241,56,209,186,97,24,162,181,38,8,130,117,11,41,80,23,245,129,232,12,148,34,12,67,110,141,191,75,220,75,210,244,
+  248,119,72,166,238,198,137,87,97,176,41,20,10,216,182,77,44,22,99,102,102,166,72,58,42,235,198,152,98,50,142,227,
+  144,207,231,107,231,17,240,125,191,216,9,141,49,101,207,128,49,134,32,8,40,20,10,4,65,80,84,204,178,44,148,82,
+  104,173,113,28,7,203,178,176,44,139,210,154,98,140,65,107,141,239,251,53,243,8,100,179,217,148,235,186,132,97,184,96,
+  181,139,16,5,209,90,207,241,47,84,49,163,204,35,24,99,112,28,7,223,247,171,22,82,160,34,146,108,177,18,187,220,
+  15,144,114,62,199,113,152,158,158,158,79,32,147,201,36,171,170,170,176,44,107,222,195,229,176,156,118,125,59,140,49,76,
+  77,77,37,129,90,96,18,200,105,32,62,53,53,229,245,247,247,211,215,215,119,199,139,46,23,74,41,54,111,222,204,204,
+  204,140,51,75,64,3,215,53,224,228,114,185,48,12,67,123,211,166,77,255,51,2,0,190,239,147,203,229,12,16,7,166,
+  1,173,129,28,240,98,107,107,235,110,99,140,189,210,197,163,138,183,152,207,182,109,99,140,57,2,204,204,142,92,52,67,
+  3,149,64,2,112,102,199,127,27,1,31,124,172,103,129,91,179,4,22,252,57,181,202,248,255,83,72,201,40,226,223,231,
+  245,88,118,110,179,155,6,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+}
+namespace Device {
+const unsigned char Clock1x[897] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,213,9,15,8,58,5,128,132,46,85,0,0,3,14,73,
+  68,65,84,56,203,101,146,75,76,92,101,28,197,127,223,119,239,188,152,185,119,96,34,8,210,202,35,88,29,108,48,150,
+  190,226,162,177,59,220,152,138,193,186,32,26,54,38,68,87,181,53,38,44,77,99,26,31,137,198,68,77,172,53,177,139,
+  62,240,17,77,76,163,46,176,5,77,85,40,5,58,88,43,218,17,233,76,167,204,12,195,204,189,195,12,119,190,207,141,
+  109,40,158,228,236,206,57,255,71,142,96,19,142,28,24,25,210,146,23,5,226,97,148,14,8,67,122,90,138,27,85,181,
+  126,230,157,207,94,127,101,179,94,108,48,246,104,248,116,247,190,71,123,182,247,198,9,71,194,8,1,90,67,113,181,196,
+  204,84,130,75,151,230,211,131,195,231,142,245,60,146,10,34,117,146,80,242,180,185,193,124,97,112,120,192,46,27,138,85,
+  159,131,40,190,118,103,138,221,113,140,120,224,65,26,59,83,205,141,205,149,55,61,189,115,213,208,191,172,8,183,93,73,
+  0,141,62,62,56,60,96,223,88,43,208,254,80,136,104,245,237,187,214,180,235,45,182,110,107,161,119,111,142,104,195,46,
+  131,192,187,13,200,167,163,192,14,121,228,192,200,208,238,125,59,118,150,180,71,91,87,35,45,91,226,155,207,68,74,137,
+  16,2,51,16,67,178,68,165,116,2,167,52,19,4,253,131,4,6,182,247,198,89,46,103,105,109,109,166,144,255,135,248,
+  227,167,72,103,125,119,63,75,8,42,94,31,158,232,39,149,172,114,242,195,7,170,120,242,156,169,209,123,194,145,48,150,
+  23,66,41,133,207,103,81,118,139,132,234,44,70,94,218,134,223,222,203,115,109,57,108,219,66,200,24,210,127,16,195,187,
+  201,194,212,199,209,161,23,250,131,18,168,23,2,154,154,26,200,23,242,40,165,168,41,141,227,20,57,250,222,239,68,98,
+  221,76,76,76,160,148,66,107,133,97,26,152,134,4,165,5,208,101,2,43,90,19,43,187,85,58,58,218,169,84,214,80,
+  74,81,44,22,233,238,238,230,229,195,175,114,237,218,85,106,181,26,82,74,180,82,104,13,72,52,176,32,5,226,162,83,
+  114,88,252,59,141,82,10,207,243,240,60,143,67,135,14,147,72,36,200,100,210,88,150,69,173,86,195,178,108,202,110,25,
+  167,228,128,207,112,63,57,253,150,35,129,179,115,147,243,216,134,133,83,114,241,249,252,140,141,141,49,58,58,74,42,181,
+  116,39,48,28,142,160,53,44,95,207,50,55,57,79,133,218,12,128,124,227,203,163,39,126,62,63,53,217,24,182,25,255,
+  254,87,180,214,244,245,61,65,58,157,98,173,82,65,107,77,32,16,192,52,77,242,153,28,238,178,203,197,31,167,171,95,
+  77,156,121,6,192,0,232,188,183,107,110,97,54,249,236,254,253,143,249,255,252,99,145,92,33,207,253,109,91,8,6,130,
+  4,131,33,252,190,0,55,255,202,144,191,190,194,201,15,206,234,217,165,217,247,167,230,127,154,3,178,6,192,76,114,58,
+  239,55,253,87,150,174,102,246,52,53,196,162,109,45,173,120,69,143,74,126,141,114,182,204,173,228,45,46,143,207,242,245,
+  231,223,174,143,255,118,225,248,249,233,239,190,1,210,64,78,108,232,74,61,208,249,228,174,254,231,239,187,103,235,83,117,
+  254,186,22,41,164,169,209,202,93,119,139,233,66,58,241,197,248,169,143,128,20,112,5,88,4,180,224,255,136,252,23,118,
+  155,26,40,3,171,64,22,40,0,234,182,248,95,201,36,100,6,22,194,54,223,0,0,0,0,73,69,78,68,174,66,96,
+  130,
+};
+const unsigned char Clock2x[2399] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,9,22,73,68,65,84,88,133,141,151,105,108,92,
+  213,25,134,159,115,183,241,44,158,205,123,28,219,177,147,24,39,33,161,9,4,74,22,82,32,165,4,165,128,74,35,74,
+  91,10,5,68,69,161,42,21,8,90,80,85,255,65,173,232,78,68,171,178,41,164,85,171,4,138,18,168,26,34,90,53,
+  133,70,80,8,33,100,113,98,156,56,118,226,125,118,123,60,119,238,157,185,247,244,135,199,19,59,113,3,159,244,233,110,
+  71,223,251,220,247,158,239,232,92,193,103,140,206,206,78,165,255,68,118,181,170,170,95,147,82,94,231,74,119,1,18,47,
+  72,16,194,84,132,232,147,142,252,135,20,236,108,233,8,124,208,217,217,233,126,150,186,226,211,6,108,217,242,3,111,64,
+  211,190,7,242,71,117,13,117,70,243,194,182,138,104,77,149,162,235,58,186,166,225,184,46,102,206,100,114,210,36,17,139,
+  185,67,103,6,114,227,201,84,81,40,202,79,179,197,226,214,157,219,127,93,131,171,87,83,212,116,84,199,68,218,195,162,
+  146,216,103,2,184,247,142,199,110,21,10,207,47,94,218,81,185,124,213,10,143,64,144,76,167,73,165,198,177,76,11,51,
+  103,226,74,7,77,85,81,84,21,191,223,139,207,31,160,80,40,50,218,127,196,242,85,124,156,191,246,154,238,63,95,190,
+  186,111,4,87,120,16,100,193,25,64,152,93,194,95,248,16,64,251,127,206,124,251,142,199,158,10,70,66,15,95,119,211,
+  23,189,186,161,115,118,96,132,137,76,6,143,199,33,24,80,17,149,46,154,230,67,81,20,132,80,112,93,136,141,78,208,
+  119,106,4,143,33,88,185,186,232,169,142,122,60,138,234,189,63,30,175,27,171,174,202,197,17,110,6,89,56,137,75,88,
+  78,226,10,127,225,163,185,0,196,125,223,120,124,103,227,130,230,205,215,108,92,95,49,58,154,36,30,79,16,12,20,153,
+  223,168,209,214,182,136,154,112,30,97,247,80,48,135,169,172,191,9,205,59,31,211,204,19,139,197,24,27,75,80,200,119,
+  65,241,24,209,208,40,141,243,28,21,229,210,122,179,224,139,122,61,163,41,232,174,7,64,146,150,67,133,110,245,124,245,
+  123,190,254,232,143,27,90,154,239,217,112,253,53,222,254,190,33,204,92,134,104,164,200,170,85,203,88,88,219,131,217,223,
+  73,166,239,15,72,89,100,200,92,77,58,231,161,174,182,30,77,83,9,6,131,212,215,215,82,93,53,72,93,237,32,225,
+  96,63,154,177,12,163,98,173,80,212,229,154,43,67,154,170,76,186,144,0,156,81,132,56,165,157,39,190,177,50,20,122,
+  124,253,181,235,188,189,167,206,128,98,82,87,107,176,230,170,14,70,14,127,159,209,201,211,68,155,182,96,84,182,131,44,
+  144,24,243,1,160,40,10,0,174,235,34,132,32,224,87,208,21,29,77,49,144,162,14,161,118,160,25,87,96,155,127,175,
+  40,58,199,189,154,80,66,72,2,168,174,167,12,176,101,203,22,85,160,188,120,205,245,95,240,15,14,142,98,23,178,204,
+  111,244,178,238,234,37,156,126,103,19,190,200,231,168,94,246,4,210,181,113,157,113,164,99,179,32,154,165,122,225,151,202,
+  194,231,210,3,194,131,170,8,164,154,195,117,134,41,218,7,64,38,201,91,102,192,111,72,75,168,210,66,81,39,203,0,
+  149,106,243,189,45,11,91,107,80,21,98,177,24,205,77,6,107,215,172,226,23,63,108,225,195,158,90,126,191,245,6,92,
+  199,4,215,68,58,121,92,199,194,149,204,18,158,14,87,134,145,162,10,71,214,160,202,83,40,2,236,156,7,68,2,199,
+  62,173,12,39,253,202,188,134,137,17,2,185,184,82,110,71,161,60,181,116,229,114,239,153,190,65,170,162,42,43,87,174,
+  192,83,17,224,190,135,158,38,24,170,229,246,187,127,70,42,25,195,41,140,227,20,50,20,237,20,142,53,54,75,124,250,
+  220,113,23,80,116,90,41,56,139,40,22,117,40,30,64,225,29,178,153,131,196,18,81,113,224,224,188,14,91,154,111,11,
+  129,173,0,220,125,251,35,87,68,107,171,61,2,129,153,203,18,10,121,168,171,171,5,4,245,237,247,179,125,199,126,214,
+  174,185,154,219,238,250,29,3,3,67,56,118,6,183,4,49,87,72,130,20,220,21,20,156,21,88,197,149,228,139,151,147,
+  47,44,231,248,137,122,250,7,91,233,234,110,151,223,189,247,193,96,121,29,16,10,95,109,108,110,246,39,19,41,188,62,
+  65,115,115,227,236,190,20,130,167,127,245,2,181,117,79,114,251,253,47,240,252,211,235,104,110,80,113,157,60,82,74,164,
+  148,231,196,75,231,174,172,199,114,55,32,104,69,48,140,91,44,144,202,14,115,248,136,192,52,61,222,162,210,127,27,240,
+  190,50,229,191,178,41,92,21,86,50,169,12,225,176,65,67,67,67,185,216,204,124,244,241,167,232,236,252,9,119,61,188,
+  143,67,71,7,113,236,204,5,99,102,134,235,26,20,138,109,228,237,171,177,156,245,52,183,222,72,124,212,162,50,20,84,
+  132,100,83,217,1,41,221,22,77,55,200,231,77,60,158,0,62,159,119,86,81,215,117,203,78,124,243,174,7,136,86,55,
+  240,208,131,223,1,4,170,190,132,103,159,221,202,134,13,27,230,132,153,89,163,166,182,10,219,50,209,13,15,82,208,82,
+  6,0,188,170,170,98,229,45,52,45,140,148,146,99,199,15,3,130,229,203,46,67,81,148,89,173,118,227,166,155,49,42,
+  158,96,207,155,123,0,216,116,227,38,14,29,58,120,1,128,148,146,222,190,30,164,132,230,249,11,208,117,29,219,178,209,
+  61,6,2,225,157,9,64,177,232,224,186,18,85,85,113,93,23,41,65,136,217,111,63,61,219,211,233,52,217,108,22,215,
+  117,103,45,66,115,1,76,25,49,229,134,170,40,32,102,127,42,173,244,216,52,77,83,87,20,129,34,20,164,148,116,180,
+  47,69,8,81,182,111,26,32,30,143,179,121,243,205,36,18,9,214,173,93,135,223,239,231,153,103,126,83,30,119,62,72,
+  107,203,194,242,125,33,4,154,174,83,176,109,36,210,60,215,5,130,126,115,50,183,92,209,84,138,69,137,101,89,120,60,
+  158,11,172,143,199,19,220,114,203,173,156,56,113,130,142,142,14,222,120,99,55,145,72,228,2,241,185,64,52,77,35,17,
+  79,99,232,30,172,124,30,33,101,63,128,50,101,31,123,82,177,132,235,243,249,24,60,27,39,149,74,151,139,204,204,59,
+  239,252,86,73,252,18,118,237,122,141,112,56,60,235,249,180,248,204,137,55,125,109,24,30,222,219,127,144,64,36,194,68,
+  50,233,74,33,246,148,1,4,188,26,27,30,201,122,253,1,134,135,82,36,147,153,89,5,92,215,197,113,28,66,161,32,
+  87,94,185,154,215,94,251,43,145,72,100,78,200,243,129,206,125,66,141,247,223,61,68,164,186,134,137,84,58,43,16,175,
+  150,1,182,237,248,229,1,51,55,105,155,102,14,132,198,208,64,188,60,201,102,230,246,237,47,179,123,247,174,178,184,227,
+  56,115,138,158,127,172,168,240,210,117,248,19,138,82,80,176,242,152,249,188,189,109,199,47,15,148,1,0,233,58,242,201,
+  129,222,211,185,72,77,45,7,15,116,51,54,154,40,11,204,37,52,211,153,139,57,0,224,49,188,236,248,227,235,52,47,
+  92,204,96,95,95,14,215,125,114,186,53,166,1,200,113,230,197,137,84,58,81,176,242,120,253,33,246,255,251,99,98,177,
+  212,44,1,199,113,102,229,197,132,167,143,193,202,8,219,158,123,5,127,164,10,59,159,35,55,49,145,122,107,255,142,63,
+  77,235,150,119,68,93,93,93,250,252,198,182,62,199,42,110,158,223,218,170,199,70,226,88,121,147,154,186,40,186,174,207,
+  185,52,159,238,63,73,58,147,36,20,12,95,240,76,8,65,56,92,197,155,175,239,227,200,145,147,52,182,182,209,219,125,
+  194,60,59,216,251,200,225,99,31,244,3,22,224,206,220,146,249,63,57,117,36,217,60,191,221,111,231,243,43,22,44,190,
+  68,235,63,61,200,200,224,24,173,139,154,208,84,5,201,108,145,116,38,13,64,101,32,56,235,190,207,23,160,178,50,196,
+  182,231,118,114,244,216,105,90,151,44,165,231,232,17,107,108,228,236,95,246,254,235,149,93,128,3,20,1,123,38,128,15,
+  240,157,232,249,168,123,97,83,199,50,51,155,173,111,106,91,164,141,103,38,249,239,59,7,168,170,169,34,26,141,160,168,
+  42,32,113,28,135,96,101,136,96,101,168,220,231,62,159,159,128,63,72,239,201,51,252,246,231,47,81,112,117,26,154,154,
+  233,57,114,212,78,198,199,62,218,189,119,251,214,210,155,79,103,126,230,127,65,16,136,0,97,32,122,211,198,59,30,172,
+  175,109,250,114,75,123,187,225,11,4,24,62,123,6,199,202,177,98,229,37,92,249,249,203,136,86,133,169,168,168,64,81,
+  20,10,133,34,169,100,154,119,255,115,144,15,222,59,132,170,123,105,108,91,200,228,196,56,103,79,158,178,135,134,251,222,
+  218,187,239,149,151,128,36,144,2,210,192,24,96,206,4,208,103,0,132,129,240,85,171,174,223,216,222,182,236,129,202,96,
+  208,51,111,65,155,238,13,4,200,164,146,76,164,82,88,86,30,219,178,65,186,232,134,142,238,169,32,24,137,18,137,86,
+  49,57,49,193,96,95,111,97,50,155,181,143,127,114,232,229,15,15,191,189,15,200,148,132,211,76,109,139,19,165,53,104,
+  86,24,37,136,80,41,131,94,111,160,106,205,21,55,124,101,94,93,211,205,154,174,43,161,104,181,17,8,7,133,97,24,
+  24,134,7,0,203,182,40,88,22,227,169,140,204,164,18,5,167,88,116,6,134,122,247,190,119,240,159,127,203,231,115,9,
+  96,2,24,47,65,36,74,78,200,185,0,96,170,53,67,165,79,18,152,78,85,85,253,75,22,175,188,180,185,113,209,250,
+  80,101,244,82,77,55,170,20,161,24,0,174,116,10,182,109,37,198,51,201,174,254,161,158,119,187,79,29,238,114,28,39,
+  7,228,128,108,41,199,129,24,144,159,41,118,177,127,67,5,240,151,64,124,128,23,168,40,185,100,48,213,194,106,169,134,
+  100,106,102,59,128,93,202,124,9,32,93,18,183,231,18,249,212,191,227,25,48,122,73,184,162,116,174,207,0,112,153,106,
+  171,2,231,102,184,93,186,119,209,248,31,47,161,150,21,248,147,82,198,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Display1x[662] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,2,19,73,68,65,84,56,141,165,147,203,106,20,65,20,134,191,83,85,
+  115,109,72,50,32,6,98,18,35,38,11,183,222,54,186,112,99,6,29,240,25,124,4,55,130,184,81,80,4,241,49,124,
+  131,108,92,8,9,17,34,226,222,96,188,129,38,16,131,97,72,156,233,234,233,158,238,58,46,58,17,19,3,65,60,155,
+  42,170,234,255,207,119,206,161,164,221,110,243,63,225,58,157,206,29,17,121,168,170,181,127,17,138,136,87,213,187,78,85,
+  31,183,111,92,143,154,141,38,121,174,199,103,116,130,181,134,110,183,91,95,90,124,245,196,169,106,109,116,116,132,249,155,
+  207,73,233,3,160,122,132,209,222,81,77,34,94,190,184,205,200,232,40,64,195,237,223,167,161,207,133,171,99,136,200,30,
+  34,128,148,171,0,90,238,223,44,111,179,250,238,61,83,83,147,37,81,154,166,128,160,226,136,211,80,10,20,68,228,128,
+  73,54,204,217,238,254,4,28,103,103,103,49,18,74,3,239,61,33,20,24,99,24,228,82,102,43,155,4,148,194,205,31,
+  59,196,62,5,160,97,90,124,88,91,99,122,122,146,36,73,112,73,146,80,20,1,140,35,201,203,108,138,32,64,156,164,
+  236,244,18,84,29,149,250,94,181,137,101,122,230,52,21,103,240,222,227,226,56,70,131,98,76,133,65,112,251,0,36,233,
+  144,108,104,112,181,232,224,248,172,229,243,199,79,204,205,205,210,239,247,75,2,69,17,107,73,131,3,5,69,81,107,169,
+  216,35,134,97,135,76,156,154,192,24,202,18,188,247,0,24,227,176,213,232,111,197,161,24,154,62,69,81,160,8,113,28,
+  227,66,40,187,217,106,56,178,205,193,177,6,81,213,33,70,49,34,37,129,115,174,183,254,109,163,245,236,209,249,99,197,
+  191,41,210,156,245,245,13,128,29,233,116,58,183,106,181,218,3,17,141,64,12,48,83,169,56,87,169,86,197,26,3,64,
+  17,2,89,150,105,62,204,135,192,87,208,160,202,174,247,201,125,151,231,249,66,158,231,11,0,170,26,181,78,140,189,157,
+  111,183,207,93,186,120,153,241,147,227,168,42,91,91,223,89,121,189,162,75,203,75,171,73,111,112,37,203,50,191,79,35,
+  135,191,179,49,102,164,222,172,63,109,70,205,107,214,154,51,128,22,161,248,50,240,131,197,222,110,255,158,136,196,127,190,
+  255,5,119,143,242,70,185,147,13,30,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Display2x[1596] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,5,185,73,68,65,84,88,133,197,87,75,143,99,71,21,254,170,234,86,
+  213,117,143,237,238,118,55,25,38,45,2,211,243,32,201,116,195,130,36,104,68,136,130,130,176,102,17,20,101,1,172,88,
+  231,47,100,17,177,67,72,72,217,5,137,5,10,108,16,63,33,222,33,196,35,68,76,147,153,70,48,81,128,105,210,120,
+  218,73,63,252,106,191,110,85,157,195,194,247,58,190,182,211,67,70,35,229,147,142,235,212,173,242,57,223,61,231,212,227,
+  138,106,181,138,207,18,242,51,245,14,32,202,148,27,55,110,60,173,181,126,147,153,191,112,191,63,49,51,136,8,68,52,
+  209,153,9,33,208,252,24,19,152,198,207,132,16,125,231,220,79,119,118,118,94,159,35,160,181,126,109,107,251,218,181,205,
+  205,47,157,237,124,234,55,83,57,55,202,227,62,207,143,13,6,195,242,155,191,248,213,143,183,183,183,127,190,187,187,219,
+  203,17,0,176,177,182,94,193,111,127,183,143,95,254,250,38,172,149,16,16,0,0,33,4,192,12,164,173,16,98,162,51,
+  11,224,227,238,120,44,117,40,0,248,64,248,206,183,174,226,251,223,187,134,165,165,115,136,162,40,180,219,237,10,128,57,
+  2,69,29,105,252,253,31,31,225,177,171,17,76,44,144,135,152,105,103,245,124,140,50,180,58,3,252,229,102,29,215,158,
+  16,216,218,222,130,214,218,43,165,74,217,248,132,0,51,23,117,20,225,228,164,143,96,60,134,163,5,182,31,0,33,16,
+  194,48,193,19,79,94,133,16,4,99,13,123,239,203,11,8,208,82,164,35,52,91,35,168,117,6,232,225,16,32,22,112,
+  73,192,123,119,222,199,230,230,37,88,99,4,17,205,71,128,136,11,42,138,224,124,0,19,47,182,246,41,208,235,143,112,
+  220,234,226,168,217,197,230,185,203,184,116,101,19,90,71,176,133,88,56,231,242,17,184,126,253,186,20,66,24,165,36,156,
+  39,48,45,202,237,253,209,237,13,209,236,244,209,234,244,144,56,159,62,21,24,185,128,123,245,123,88,89,174,96,169,16,
+  75,102,206,19,168,84,42,69,33,132,99,134,241,129,1,250,116,251,83,183,55,192,193,97,27,163,36,115,170,160,34,53,
+  25,119,142,113,254,243,231,97,180,65,28,23,244,92,10,6,131,65,185,84,42,6,102,134,15,12,254,63,243,63,74,2,
+  142,90,93,244,7,9,0,9,165,205,194,121,201,128,113,80,63,192,234,234,26,226,66,28,17,209,92,17,150,180,49,30,
+  204,112,129,192,164,22,26,202,64,76,104,117,6,56,29,140,0,8,40,109,207,156,239,78,25,143,156,255,28,140,177,40,
+  196,177,20,66,172,230,8,132,16,202,58,210,76,96,36,1,16,252,201,41,232,13,19,244,250,9,136,1,21,157,237,120,
+  66,128,25,206,7,68,17,193,198,49,32,177,150,35,192,204,101,99,13,64,12,151,16,20,235,57,35,158,8,253,161,67,
+  8,12,17,105,156,29,163,60,72,6,116,59,9,172,49,136,109,12,14,92,201,17,32,162,146,49,70,18,19,28,1,153,
+  121,102,32,48,195,7,66,8,0,164,134,122,128,243,147,116,130,118,123,136,202,90,1,113,108,193,204,203,57,2,33,132,
+  178,181,70,245,251,1,36,5,28,71,233,73,150,238,7,82,61,144,227,12,35,29,208,110,39,160,192,176,214,34,4,159,
+  39,224,189,47,89,99,85,191,55,2,69,10,44,199,181,249,176,46,11,28,57,180,90,67,4,10,176,177,69,8,84,204,
+  17,32,162,178,141,173,238,245,28,160,228,212,137,246,112,16,217,8,135,199,67,132,16,80,92,138,225,156,203,19,16,66,
+  84,172,177,194,198,10,87,87,52,112,186,232,36,122,240,237,153,13,112,249,114,9,68,1,214,26,132,16,150,114,4,0,
+  174,168,72,161,88,210,120,237,213,175,220,215,32,5,194,104,224,32,132,132,144,2,38,158,62,213,63,153,40,19,67,41,
+  5,102,142,115,4,146,196,29,237,239,239,187,71,31,253,186,86,114,126,9,46,196,234,253,167,204,66,41,137,198,65,3,
+  66,136,94,142,0,51,255,236,15,191,255,227,203,111,255,233,237,13,107,99,102,48,152,8,68,60,115,239,99,16,147,98,
+  34,61,59,70,76,12,230,209,184,159,191,23,102,112,206,161,219,237,146,16,226,213,28,129,221,221,221,187,0,46,93,188,
+  120,241,17,41,123,18,0,188,247,162,211,233,136,36,73,164,82,74,14,70,131,31,90,107,126,0,224,138,142,166,67,62,
+  6,131,197,104,152,28,122,10,239,156,182,79,127,66,68,31,74,41,89,74,201,74,169,73,203,204,77,34,154,20,153,152,
+  253,46,168,213,106,18,227,21,168,51,249,238,75,47,190,181,188,92,126,242,169,167,159,90,234,247,123,184,245,215,219,115,
+  4,180,214,120,246,185,111,224,159,239,255,43,185,115,231,61,95,63,184,247,226,206,59,59,127,3,224,166,196,3,160,106,
+  181,58,9,203,228,85,106,181,154,0,160,0,152,84,44,128,248,153,103,190,246,124,177,84,218,122,225,219,47,196,165,82,
+  17,205,102,19,143,63,254,229,5,249,85,88,95,95,71,169,92,54,182,96,117,226,220,143,0,188,2,96,52,35,73,173,
+  86,115,213,106,149,114,4,210,183,54,0,226,105,169,215,27,199,23,54,54,100,227,195,6,172,253,34,182,183,190,138,231,
+  190,249,60,86,150,87,16,199,5,120,239,209,110,183,208,108,53,209,104,28,224,223,119,247,240,81,227,40,52,143,155,117,
+  0,107,0,58,105,36,85,234,67,0,160,90,173,198,213,106,149,103,147,41,82,201,210,32,235,245,250,209,250,221,245,55,
+  136,232,149,253,199,62,80,183,119,119,181,181,86,8,136,244,11,128,33,133,132,243,30,189,211,158,255,207,222,7,124,116,
+  120,248,238,237,91,183,223,194,248,102,169,166,236,205,237,112,211,4,40,205,83,54,57,35,132,91,239,222,250,205,222,221,
+  189,63,95,216,184,240,236,185,115,75,87,86,87,87,46,197,113,225,60,51,23,133,16,206,59,127,210,110,183,254,219,110,
+  119,247,78,142,79,118,27,141,198,77,0,199,0,134,11,100,4,32,100,117,144,43,194,180,14,178,2,204,234,192,224,227,
+  130,52,0,10,89,122,148,82,133,16,130,79,137,143,0,244,211,214,3,72,210,231,73,234,56,235,135,233,34,156,91,5,
+  83,68,50,50,89,8,163,41,125,58,172,89,244,50,9,105,235,83,61,96,188,61,230,170,255,76,2,103,16,194,130,54,
+  3,207,182,139,28,206,226,127,22,79,15,83,151,84,77,105,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Joypad1x[812] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,172,0,77,0,0,52,214,215,123,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,4,7,15,10,39,178,201,163,153,0,0,0,140,116,
+  69,88,116,67,111,109,109,101,110,116,0,77,101,110,117,45,115,105,122,101,100,32,105,99,111,110,10,61,61,61,61,61,
+  61,61,61,61,61,10,10,40,99,41,32,50,48,48,51,32,74,97,107,117,98,32,39,106,105,109,109,97,99,39,32,83,
+  116,101,105,110,101,114,44,32,10,104,116,116,112,58,47,47,106,105,109,109,97,99,46,109,117,115,105,99,104,97,108,108,
+  46,99,122,10,10,99,114,101,97,116,101,100,32,119,105,116,104,32,116,104,101,32,71,73,77,80,44,10,104,116,116,112,
+  58,47,47,119,119,119,46,103,105,109,112,46,111,114,103,103,138,199,71,0,0,2,33,73,68,65,84,56,203,149,146,203,
+  107,83,65,20,198,127,147,220,228,38,214,210,164,177,54,245,209,135,160,184,73,176,20,255,130,130,123,17,138,136,130,168,
+  32,88,8,193,133,173,15,180,221,136,46,68,10,10,130,72,22,93,213,186,19,68,208,133,187,34,84,179,19,68,20,42,
+  21,53,53,183,105,244,230,117,111,230,184,184,105,154,66,178,232,129,3,195,240,205,55,191,249,230,40,58,212,199,179,132,
+  255,170,221,51,97,41,95,2,124,235,42,178,96,80,191,58,62,95,40,181,234,84,167,195,117,124,223,250,14,237,141,27,
+  225,16,162,53,142,93,102,237,251,186,181,161,122,6,79,204,231,237,77,173,175,157,129,70,165,99,67,177,184,175,43,140,
+  235,247,99,21,107,216,174,143,129,35,253,189,192,253,86,173,175,195,11,82,129,93,97,252,166,137,17,12,16,12,26,252,
+  94,181,136,14,198,137,200,198,153,86,161,145,74,79,206,0,119,90,55,203,86,6,167,84,193,202,217,116,71,187,40,230,
+  255,225,214,28,220,170,67,69,153,209,84,250,178,52,164,179,42,149,158,148,185,135,143,182,93,255,235,229,61,170,203,115,
+  88,185,34,249,181,18,162,96,223,240,30,162,177,46,234,135,47,112,240,212,109,108,219,230,198,173,41,12,0,173,53,133,
+  66,97,11,235,248,57,114,111,30,211,63,212,199,200,104,15,134,25,160,248,243,15,185,85,135,3,231,47,98,89,22,65,
+  51,184,149,129,104,241,90,188,86,129,16,3,215,151,88,212,167,249,186,244,133,207,239,62,241,170,52,206,254,155,239,81,
+  129,16,34,2,141,71,120,4,162,209,34,32,226,125,172,0,134,137,27,234,101,228,193,42,43,43,43,228,223,190,134,128,
+  137,214,26,192,51,105,18,136,96,189,184,198,143,233,97,214,23,167,26,68,26,183,238,182,36,35,72,93,35,186,209,13,
+  3,163,153,252,242,2,82,43,81,90,94,160,251,228,93,0,142,37,71,121,250,236,73,115,93,23,221,68,111,230,181,25,
+  98,104,108,130,202,135,231,132,198,38,208,90,163,68,72,36,146,36,18,73,68,20,74,137,135,223,48,216,70,96,154,38,
+  71,175,100,128,76,219,169,178,109,111,114,203,229,50,0,149,74,101,59,65,54,155,197,117,93,118,82,74,169,45,131,72,
+  36,210,68,2,168,86,171,0,212,106,181,142,6,142,227,120,70,237,70,121,7,53,251,31,168,192,0,159,97,230,172,204,
+  0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Joypad2x[1470] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,5,117,73,68,65,84,88,133,189,151,95,104,28,
+  199,29,199,63,179,187,247,87,90,89,177,122,190,107,108,85,137,26,53,142,173,66,74,193,134,22,218,218,14,174,75,98,
+  21,25,29,20,154,151,56,24,185,137,91,8,121,233,139,193,121,11,42,24,10,37,57,75,15,125,40,121,177,176,221,60,
+  53,208,66,31,74,177,67,193,170,147,56,86,28,169,142,49,178,106,199,145,238,180,187,183,187,183,59,51,125,144,111,209,
+  233,228,68,231,226,252,96,216,157,239,236,124,127,223,157,249,206,204,174,224,33,226,248,241,227,195,90,235,223,106,173,127,
+  14,116,3,174,16,226,93,33,196,155,149,74,229,163,78,184,68,167,201,143,29,59,246,203,140,37,254,248,194,51,91,82,
+  187,158,216,70,46,155,199,171,215,245,7,243,11,226,189,235,94,20,41,94,154,154,154,122,231,145,8,24,31,31,31,74,
+  33,63,250,245,143,31,79,247,233,37,244,205,247,33,88,65,102,122,48,158,252,33,139,97,150,202,197,47,26,74,24,195,
+  103,206,156,249,116,51,156,70,39,2,180,214,175,253,108,208,72,247,70,119,145,31,255,133,108,180,66,87,74,144,14,171,
+  132,87,222,165,79,126,206,254,126,149,214,90,191,182,89,206,142,4,0,35,187,6,182,17,204,93,68,8,129,97,128,101,
+  8,132,88,29,74,255,63,239,179,187,255,49,128,145,205,18,90,157,100,55,81,133,180,101,82,175,87,177,82,38,129,128,
+  134,80,52,164,34,86,154,40,116,200,24,26,224,27,143,68,128,196,184,229,174,212,190,173,204,28,65,228,35,149,70,8,
+  144,74,19,70,146,216,204,209,112,61,128,207,54,203,217,233,20,252,249,234,66,21,81,120,138,122,67,226,133,113,82,252,
+  134,68,244,126,139,143,239,4,8,33,206,63,42,1,111,255,125,193,10,150,205,109,24,59,190,135,219,80,184,65,140,215,
+  144,136,210,46,150,178,253,252,243,78,202,23,66,76,62,18,1,147,147,147,243,129,20,191,121,231,19,3,227,187,35,4,
+  185,109,184,17,120,153,34,193,119,158,231,236,124,138,134,100,188,82,169,124,182,89,206,142,60,0,32,132,56,219,208,98,
+  210,26,250,9,93,165,239,227,186,46,158,231,65,54,75,164,174,49,53,53,245,167,78,248,58,157,130,36,180,214,45,117,
+  165,212,67,241,60,180,128,245,9,191,78,1,229,76,38,211,6,106,173,177,44,139,163,71,143,218,157,144,181,157,5,71,
+  142,28,121,93,8,241,58,240,205,141,58,20,10,5,78,156,56,129,82,138,40,138,240,60,15,215,117,145,82,82,42,149,
+  168,84,42,84,171,213,141,186,126,168,181,126,249,252,249,243,255,122,160,128,114,185,156,214,90,135,19,19,19,244,247,247,
+  183,188,93,243,26,4,1,158,231,17,69,17,190,239,227,251,62,82,74,108,219,38,149,74,97,24,6,91,183,110,69,107,
+  221,82,174,93,187,198,233,211,167,63,61,119,238,220,211,64,98,160,150,85,160,181,62,178,119,239,94,182,111,223,206,194,
+  194,2,90,107,132,16,8,33,200,102,179,164,211,105,28,199,161,90,173,98,219,54,125,125,125,152,166,73,20,69,220,187,
+  119,143,185,185,57,10,133,2,185,92,14,215,117,137,162,40,225,24,26,26,98,112,112,112,104,116,116,244,185,11,23,46,
+  252,181,153,179,197,3,74,169,227,35,35,35,172,172,172,36,166,210,90,147,207,231,73,167,211,0,56,142,131,148,146,187,
+  119,239,50,59,59,203,204,204,12,51,51,51,204,207,207,19,134,33,75,75,75,152,166,73,79,79,79,210,71,41,133,239,
+  251,28,58,116,8,195,48,94,93,155,51,17,48,58,58,250,76,177,88,252,209,192,192,0,158,231,37,67,103,89,22,166,
+  105,38,245,56,142,209,90,163,148,74,176,230,189,82,138,32,8,146,41,203,231,243,73,162,122,189,206,206,157,59,217,178,
+  101,203,225,114,185,252,100,155,0,195,48,198,199,198,198,68,189,94,79,146,172,95,235,0,189,189,189,109,88,51,50,153,
+  12,195,195,195,27,182,41,165,136,227,152,3,7,14,24,74,169,87,154,184,0,40,151,203,57,33,196,237,201,201,201,222,
+  90,173,70,163,209,64,136,85,127,10,33,176,109,27,211,52,91,8,29,199,73,204,104,154,38,93,93,93,244,244,244,180,
+  136,118,28,167,101,68,44,203,66,107,205,201,147,39,171,192,227,211,211,211,190,5,160,181,254,197,193,131,7,123,133,16,
+  132,97,136,122,239,20,119,254,253,55,178,150,65,225,217,231,112,126,250,70,139,15,0,108,219,166,187,187,187,69,84,51,
+  145,82,10,207,243,8,195,176,165,45,138,34,108,219,102,207,158,61,189,151,46,93,122,17,152,50,238,55,190,188,127,255,
+  126,28,199,89,117,237,226,135,12,244,229,121,162,208,197,242,236,69,110,221,186,133,235,186,212,106,53,234,245,58,81,20,
+  33,165,108,73,24,199,49,97,24,226,56,14,75,75,75,132,97,216,54,141,90,107,124,223,103,223,190,125,0,191,7,176,
+  78,157,58,101,204,206,206,238,45,22,139,220,190,125,27,173,53,181,231,255,192,63,206,190,197,205,185,5,6,127,240,2,
+  135,138,197,196,128,113,28,227,251,126,219,91,63,232,218,188,111,214,163,40,98,199,142,29,100,50,153,220,225,195,135,243,
+  214,213,171,87,109,107,53,40,222,79,84,42,149,120,122,248,76,155,145,54,50,229,102,176,245,245,32,8,154,155,87,38,
+  217,136,92,215,229,242,229,203,45,138,215,47,179,175,194,54,131,27,134,65,177,88,108,142,134,50,30,164,114,109,231,141,
+  240,78,158,253,178,163,219,88,11,10,33,54,77,212,73,210,245,245,166,128,235,215,175,119,91,211,211,211,43,99,99,99,
+  255,189,113,227,70,105,247,238,221,109,59,91,179,104,173,19,231,175,197,149,82,72,41,219,176,181,248,250,246,197,197,69,
+  26,141,198,226,149,43,87,66,11,208,113,28,255,106,98,98,226,119,66,136,167,248,26,66,74,121,115,121,121,249,13,192,
+  89,123,28,155,192,99,172,254,237,102,120,136,239,197,175,8,197,234,49,28,3,53,96,25,136,31,244,115,106,242,127,124,
+  174,125,73,200,251,34,18,67,252,15,38,245,181,113,211,146,231,231,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Keyboard1x[587] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,1,200,73,68,65,84,56,141,181,146,177,107,83,81,20,198,127,247,222,
+  115,95,95,8,73,159,136,180,209,38,177,21,7,165,21,26,16,204,228,34,102,8,8,34,212,168,127,72,193,191,160,131,
+  45,174,29,178,184,180,116,17,212,12,25,4,23,137,32,168,56,85,227,146,162,85,112,145,212,190,151,52,125,185,14,109,
+  53,29,164,193,226,7,151,115,46,231,124,223,189,231,240,169,82,169,196,113,160,15,146,122,189,174,142,37,48,191,48,159,
+  30,134,80,169,84,252,193,187,58,24,161,88,156,157,242,60,223,3,239,187,136,216,100,210,88,99,196,199,152,139,190,245,
+  175,2,87,28,76,3,30,74,189,72,38,82,229,106,181,26,203,31,45,127,195,57,123,201,250,186,108,69,143,59,103,50,
+  32,99,86,108,216,239,179,174,148,187,15,242,174,213,106,253,204,159,157,104,110,111,255,40,0,175,127,11,52,26,141,93,
+  224,205,254,249,219,247,131,252,228,196,50,142,157,173,173,206,251,67,59,56,10,115,119,230,174,163,226,183,202,169,200,104,
+  175,80,171,213,186,0,114,20,113,239,229,91,151,193,61,82,112,111,101,101,237,249,96,77,45,173,45,37,78,118,131,166,
+  159,24,57,163,181,70,27,141,86,123,209,104,131,214,10,173,13,206,57,0,246,123,94,61,88,120,88,4,144,157,86,120,
+  45,83,184,112,106,102,122,6,107,61,68,4,43,22,99,4,173,13,56,71,223,245,137,162,136,48,10,49,90,211,104,188,
+  156,173,84,110,158,95,93,125,220,20,17,239,118,144,62,225,133,97,135,205,175,159,72,37,211,160,0,20,74,41,218,237,
+  54,249,92,142,56,142,249,178,249,153,108,54,79,106,52,144,245,15,31,111,0,139,98,180,46,7,65,0,206,145,61,157,
+  99,183,31,31,154,127,52,157,166,215,235,1,138,169,201,115,116,186,93,50,99,227,102,196,179,119,129,69,137,227,120,227,
+  233,179,39,90,169,225,157,236,156,3,199,55,24,112,226,191,98,104,31,252,55,129,95,252,113,137,228,164,151,154,151,0,
+  0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Keyboard2x[1110] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,3,211,73,68,65,84,88,133,237,150,223,107,28,85,20,199,191,231,222,
+  153,77,154,233,166,249,225,210,186,73,154,154,70,27,53,105,139,52,32,90,83,10,202,4,69,2,21,161,248,15,232,67,
+  81,8,17,243,32,228,41,184,134,60,36,245,69,48,65,31,4,245,49,80,194,142,232,203,62,232,67,226,131,144,110,37,
+  80,147,218,184,77,141,117,127,38,155,157,153,123,143,15,211,221,164,41,52,33,166,86,48,95,184,204,185,151,59,231,124,
+  238,185,231,206,29,178,109,27,143,82,226,145,70,223,7,216,7,216,7,216,10,16,143,199,255,117,32,99,75,63,28,143,
+  199,171,138,40,134,22,146,191,212,46,47,223,90,213,90,51,14,84,67,175,234,245,117,107,189,104,230,76,23,0,10,133,
+  2,183,181,181,113,62,159,231,149,149,21,6,128,100,50,201,67,67,67,220,219,219,203,59,5,160,205,95,194,120,60,46,
+  22,22,174,181,20,138,174,109,8,227,188,97,154,103,0,110,55,164,1,105,24,16,66,64,10,1,33,36,136,0,173,25,
+  74,249,240,125,31,190,239,193,43,63,61,15,74,41,93,114,75,127,248,190,183,232,251,222,117,205,124,93,17,125,62,22,
+  27,91,124,80,6,120,126,254,183,188,172,226,164,214,58,74,160,39,4,137,18,9,97,73,41,106,164,144,53,82,202,16,
+  17,17,64,96,214,196,204,196,0,152,25,0,72,107,69,172,153,24,44,0,28,97,198,17,128,158,7,51,36,243,7,3,
+  239,191,123,25,28,26,30,29,29,205,222,151,129,189,212,224,224,160,225,186,110,11,75,239,152,36,58,198,192,43,0,93,
+  4,64,4,92,25,29,25,127,29,120,136,167,32,22,139,249,174,235,222,54,137,231,161,49,203,192,167,96,254,4,0,24,
+  120,174,60,111,79,51,48,60,60,108,66,248,31,10,97,244,41,237,29,245,125,85,239,251,30,60,215,131,175,252,205,83,
+  111,248,37,156,24,31,31,47,109,173,129,93,107,96,224,210,81,179,90,254,40,200,140,102,115,25,120,174,11,173,84,94,
+  177,254,11,140,52,4,50,96,164,153,232,187,236,159,249,137,201,201,73,23,184,191,8,119,47,41,206,134,204,80,52,149,
+  186,121,67,51,247,27,164,127,24,249,248,242,242,118,175,85,182,192,113,28,250,246,251,233,143,0,12,0,144,123,6,182,
+  33,87,10,122,123,36,54,246,197,230,65,163,28,188,185,185,185,154,64,239,180,182,182,72,203,10,223,61,243,18,66,202,
+  13,187,210,68,208,40,168,97,205,26,90,151,155,130,214,10,74,171,160,175,2,59,147,77,135,150,110,46,245,59,142,243,
+  53,0,215,182,109,93,1,0,96,188,215,127,233,101,16,204,194,218,26,32,104,35,69,20,216,4,2,40,232,7,118,240,
+  36,194,38,59,152,155,203,229,224,186,37,68,34,135,65,129,19,120,190,2,3,39,250,250,94,61,53,53,53,253,51,128,
+  245,205,0,178,165,185,249,205,134,250,250,170,199,15,71,3,71,68,72,223,185,131,108,46,139,187,145,43,43,14,226,148,
+  33,2,168,227,199,219,43,64,181,225,122,172,172,164,80,92,45,33,26,141,2,0,172,3,97,228,115,89,188,116,238,220,
+  27,83,83,211,201,10,128,227,56,4,32,100,29,172,121,205,178,194,50,100,86,87,86,159,206,100,113,178,235,212,182,155,
+  155,74,165,144,201,100,80,119,168,14,204,229,204,25,88,186,245,59,34,143,69,64,130,32,165,68,93,109,99,168,169,41,
+  122,1,64,204,113,28,97,219,182,54,0,200,193,193,129,51,107,171,197,154,171,215,174,98,241,215,43,21,199,79,182,183,
+  99,98,226,179,109,1,26,27,27,176,186,86,64,54,151,171,140,117,117,117,194,178,44,124,245,205,151,80,204,96,197,232,
+  232,120,10,0,90,123,122,122,90,19,137,68,14,128,54,0,136,131,181,135,222,138,70,155,204,103,58,158,5,206,158,191,
+  199,249,139,47,108,27,255,129,234,124,250,228,61,253,153,159,102,244,233,211,157,23,19,137,196,28,16,212,128,118,221,98,
+  116,102,102,6,179,179,179,222,63,11,183,189,152,89,122,74,55,0,80,0,130,26,2,96,116,119,119,55,70,34,225,170,
+  221,56,149,82,236,248,254,95,88,88,46,205,205,205,165,109,219,118,129,135,120,27,238,84,255,173,127,194,125,128,255,37,
+  192,223,118,68,166,42,45,136,103,210,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Microphone1x[703] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,234,0,234,0,234,127,141,58,17,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,213,11,3,22,42,33,208,235,186,119,0,0,2,76,73,
+  68,65,84,56,203,125,147,95,72,83,97,24,198,127,147,205,182,83,179,72,234,44,200,180,11,239,148,4,217,148,88,151,
+  94,118,37,178,65,116,209,77,105,119,65,212,141,12,138,254,152,55,117,227,134,32,212,244,106,30,70,187,216,31,208,139,
+  188,137,8,141,109,72,77,93,218,137,153,108,122,108,24,56,143,121,56,235,34,119,218,104,250,192,199,247,247,121,222,231,
+  123,191,247,51,113,136,1,79,255,35,192,199,209,152,3,178,82,40,124,187,122,209,84,33,187,156,46,95,111,239,85,186,
+  174,116,213,176,138,197,34,0,91,202,22,35,47,158,1,220,147,66,225,87,149,253,134,195,222,231,118,95,163,245,82,43,
+  197,98,209,104,138,162,160,170,42,11,11,243,172,173,174,242,224,254,67,128,151,213,1,204,149,129,67,188,128,215,235,5,
+  32,22,139,17,143,199,25,27,27,51,14,90,173,39,176,9,86,132,147,2,245,4,30,139,162,232,243,251,253,104,154,134,
+  162,40,184,221,110,186,187,187,255,94,126,238,29,0,171,107,95,145,191,203,117,5,124,51,51,51,140,142,142,26,14,162,
+  209,40,129,64,160,198,129,165,209,66,211,105,59,117,147,24,124,61,229,91,89,89,65,211,52,44,22,11,130,32,96,54,
+  155,89,94,94,70,150,191,241,99,99,131,66,33,207,230,102,129,125,245,55,246,38,251,155,233,144,116,235,72,7,137,68,
+  130,137,137,137,154,104,103,206,158,198,227,241,146,74,37,153,159,255,116,3,48,4,158,244,245,245,13,183,183,183,163,235,
+  58,249,124,158,142,142,14,130,193,32,187,187,187,200,178,76,38,147,225,195,199,247,164,82,73,50,95,150,48,97,106,168,
+  206,193,240,236,236,172,225,32,18,137,144,72,36,24,31,31,199,106,181,26,14,218,46,183,145,74,166,41,151,203,216,237,
+  167,226,53,207,216,211,211,131,36,73,0,100,179,89,68,81,100,114,114,210,32,71,99,81,28,162,131,240,91,9,193,38,
+  80,218,43,93,175,17,40,108,230,17,207,59,72,167,211,0,168,170,202,226,226,34,154,166,161,235,58,7,218,1,219,63,
+  21,0,154,155,155,41,173,151,106,11,201,31,240,51,120,103,136,206,206,78,116,93,167,92,46,163,235,58,154,166,177,243,
+  107,135,204,210,103,82,169,36,192,158,211,233,178,229,214,115,255,4,164,80,216,52,116,119,112,255,249,200,211,70,142,199,
+  18,224,0,108,255,149,178,178,189,53,221,114,177,133,220,122,14,41,20,190,121,148,194,128,167,127,170,238,95,0,34,78,
+  167,235,92,197,218,49,136,84,79,254,0,227,216,1,121,79,52,137,54,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Microphone2x[2105] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,7,240,73,68,65,84,88,133,173,150,91,108,19,
+  235,17,199,255,223,174,215,27,219,123,98,156,216,73,144,109,200,5,37,193,28,236,36,194,96,34,113,41,137,26,9,68,
+  85,144,128,7,36,46,47,71,66,58,82,165,230,129,34,46,77,185,168,170,84,9,142,196,11,229,33,15,160,22,129,80,
+  105,9,10,226,4,26,14,36,32,66,210,132,198,164,185,223,3,198,141,99,199,142,217,205,238,247,109,31,48,41,61,61,
+  113,128,211,145,70,251,48,159,102,126,223,204,236,55,67,240,9,114,226,196,137,221,6,131,225,215,154,166,125,73,8,1,
+  207,243,175,116,93,191,175,105,90,19,128,239,206,157,59,55,250,41,254,0,128,124,236,193,186,186,186,11,70,163,241,171,
+  64,32,96,42,42,42,2,33,4,83,83,83,24,29,29,213,199,199,199,229,104,52,106,228,56,110,154,49,246,55,93,215,
+  255,34,8,194,159,235,234,234,228,255,11,192,201,147,39,191,146,36,233,194,193,131,7,77,132,16,168,170,10,74,41,8,
+  33,224,56,14,60,207,67,211,52,12,15,15,99,108,108,76,31,25,25,121,171,40,74,28,192,174,51,103,206,60,249,81,
+  0,123,246,236,225,61,30,207,155,29,59,118,100,173,92,185,18,138,162,0,0,24,99,160,148,46,192,80,74,193,243,60,
+  120,158,135,201,100,66,107,107,171,30,12,6,101,0,107,206,158,61,59,188,152,127,110,41,128,226,226,98,63,33,68,50,
+  26,141,152,157,157,5,199,113,32,228,29,183,174,235,11,95,198,24,146,201,36,34,145,8,38,38,38,224,247,251,137,211,
+  233,52,114,28,247,155,116,254,13,75,1,16,66,106,50,51,51,185,219,183,111,163,171,171,11,115,115,115,40,42,42,66,
+  109,109,45,198,198,198,32,73,18,204,102,243,2,12,0,168,170,138,215,175,95,195,235,245,242,175,94,189,218,241,163,0,
+  12,6,195,174,178,178,50,131,199,227,65,36,18,65,87,87,23,226,241,56,24,99,56,118,236,24,218,218,218,80,88,88,
+  8,175,215,11,175,215,11,159,207,135,101,203,150,65,85,85,216,237,118,48,198,178,210,94,48,157,241,232,209,163,86,65,
+  16,34,86,171,149,19,4,1,102,179,25,110,183,27,165,165,165,208,52,13,148,82,76,76,76,224,201,147,39,120,254,252,
+  57,186,187,187,33,203,50,138,138,138,176,101,203,22,108,221,186,21,205,205,205,209,51,103,206,216,62,43,3,130,32,84,
+  73,146,164,108,222,188,217,212,214,214,134,199,143,31,163,165,165,5,245,245,245,120,241,226,5,90,91,91,225,245,122,225,
+  247,251,81,83,83,3,77,211,16,14,135,209,219,219,139,137,137,9,116,116,116,232,0,154,211,102,56,157,145,231,249,29,
+  217,217,217,162,217,108,70,77,77,13,182,111,223,14,198,24,24,99,8,133,66,80,85,21,151,47,95,198,208,208,16,92,
+  46,23,54,108,216,0,159,207,135,146,146,18,84,87,87,227,238,221,187,138,174,235,127,77,23,35,109,9,78,157,58,21,
+  178,219,237,57,193,96,16,3,3,3,224,121,30,251,246,237,67,101,101,37,226,241,56,68,81,132,166,105,136,68,34,232,
+  232,232,64,95,95,31,38,38,38,160,105,26,114,115,115,225,118,187,153,193,96,88,113,238,220,185,201,79,6,56,118,236,
+  88,177,32,8,193,35,71,142,24,98,177,24,70,71,71,209,222,222,14,143,199,3,158,231,177,123,247,110,228,228,228,96,
+  237,218,181,240,249,124,40,47,47,71,83,83,19,20,69,65,126,126,62,166,166,166,16,141,70,229,155,55,111,154,62,43,
+  3,39,79,158,252,218,108,54,255,222,108,54,139,178,44,35,55,55,23,165,165,165,144,36,9,140,49,196,98,49,60,123,
+  246,12,237,237,237,24,28,28,68,60,30,199,242,229,203,225,245,122,81,86,86,6,85,85,113,237,218,53,218,212,212,148,
+  182,204,139,26,57,142,219,85,80,80,32,10,130,128,150,150,22,92,191,126,29,186,174,163,190,190,30,151,46,93,130,195,
+  225,128,215,235,69,32,16,0,165,20,201,100,18,87,174,92,65,56,28,70,103,103,39,194,225,48,140,70,99,48,93,240,
+  69,51,80,87,87,103,164,148,206,6,2,1,209,225,112,64,20,197,5,27,165,20,23,47,94,196,211,167,79,209,219,219,
+  139,194,194,66,84,84,84,96,205,154,53,112,56,28,184,121,243,230,194,75,105,177,88,86,221,186,117,107,240,147,1,142,
+  31,63,30,16,4,161,217,100,50,137,15,30,60,64,50,153,68,118,118,54,106,107,107,145,145,145,177,48,7,18,137,4,
+  122,122,122,48,58,58,138,233,233,105,204,207,207,35,20,10,97,91,245,22,124,215,220,194,238,221,187,199,47,149,129,31,
+  44,1,33,196,37,73,146,186,119,239,94,49,16,8,32,24,12,162,167,167,7,28,199,225,252,249,243,184,127,255,62,60,
+  30,15,214,173,91,7,143,199,131,170,170,42,200,178,140,217,217,89,92,189,122,21,0,160,235,140,45,21,124,81,0,93,
+  215,71,20,69,97,140,49,8,130,128,178,178,50,248,124,62,80,74,113,232,208,33,148,151,151,163,187,187,27,157,157,157,
+  120,244,232,17,236,118,59,10,10,10,144,155,155,11,65,16,82,62,64,63,27,160,175,175,239,239,30,143,135,13,12,12,
+  32,47,47,15,161,80,104,97,226,81,74,177,122,245,106,20,23,23,67,211,52,204,207,207,35,28,14,35,22,139,65,85,
+  213,15,39,228,71,101,224,7,199,241,141,27,55,168,174,235,191,106,105,105,145,103,103,103,225,114,185,96,181,90,33,8,
+  194,2,200,123,5,0,155,205,6,151,203,133,202,202,202,255,154,138,159,13,0,0,167,79,159,190,68,41,61,213,216,216,
+  168,52,54,54,202,109,109,109,144,101,25,133,133,133,112,185,92,176,217,108,16,69,17,132,16,136,162,136,252,252,124,204,
+  205,205,125,82,112,0,72,219,165,15,31,62,108,221,180,105,83,125,50,153,12,53,55,55,255,228,209,163,71,252,157,59,
+  119,64,41,101,28,199,145,172,172,44,228,229,229,193,96,48,160,191,191,159,189,124,249,82,158,156,154,132,219,237,226,199,
+  199,39,19,67,67,67,191,91,10,224,163,151,210,154,154,154,167,107,189,107,54,12,244,15,42,162,152,49,183,106,213,42,
+  27,0,242,126,47,148,36,73,55,155,205,115,13,13,13,230,64,165,159,107,125,252,52,114,239,222,183,217,75,249,93,114,
+  33,121,47,148,210,134,161,193,97,191,175,124,173,56,58,50,46,246,252,179,7,137,120,2,70,163,17,22,139,5,118,187,
+  157,240,60,47,89,36,11,52,85,131,36,125,97,171,175,175,255,197,225,195,135,191,249,190,175,235,215,175,243,110,183,219,
+  199,24,139,45,249,80,0,200,88,183,110,93,69,70,70,198,31,50,50,76,198,193,129,97,194,113,28,172,214,76,184,87,
+  184,144,155,235,128,217,98,70,34,30,71,34,145,64,225,170,2,68,103,162,208,117,16,191,223,255,211,173,91,183,146,134,
+  134,134,118,0,12,0,11,6,131,70,163,209,248,75,93,215,145,76,38,187,211,149,128,7,96,6,96,170,170,170,186,187,
+  126,253,250,50,187,221,78,230,231,231,145,76,38,209,215,215,135,153,153,25,48,157,129,16,130,47,36,9,89,217,54,204,
+  207,171,248,87,120,26,21,21,21,80,20,69,175,174,174,214,100,89,190,240,246,237,219,54,155,205,198,73,146,116,128,16,
+  242,237,198,141,27,191,33,132,232,139,1,144,84,112,51,0,115,117,117,117,223,254,253,251,141,147,147,147,16,4,1,162,
+  40,66,16,4,188,121,243,6,145,72,4,186,174,67,20,69,200,178,12,66,8,114,114,114,192,24,131,44,203,24,28,28,
+  212,14,28,56,240,71,139,197,178,146,227,184,36,165,244,79,219,182,109,187,74,8,209,129,197,123,128,75,41,15,128,103,
+  140,245,76,79,79,123,237,118,59,9,133,66,160,148,66,16,4,88,173,86,216,108,239,214,61,74,41,52,77,131,170,170,
+  80,85,21,162,40,34,30,143,235,211,211,211,61,59,119,238,252,45,128,36,128,57,0,9,0,11,143,197,98,61,160,167,
+  224,120,0,188,32,8,255,152,153,153,249,185,211,233,20,242,243,243,9,33,4,138,162,64,81,20,200,178,12,69,81,192,
+  216,187,82,88,44,22,56,28,14,68,163,81,189,189,189,61,57,50,50,242,117,36,18,121,13,64,73,105,242,251,169,78,
+  39,166,84,25,76,37,37,37,95,58,157,206,11,86,171,117,69,73,73,137,232,116,58,57,73,146,22,70,181,162,40,72,
+  36,18,152,156,156,100,189,189,189,74,44,22,27,31,31,31,175,237,239,239,15,2,120,155,186,249,220,135,183,255,24,0,
+  224,93,41,140,41,16,209,235,245,250,51,51,51,127,38,138,226,38,0,206,20,36,82,65,38,21,69,121,28,141,70,27,
+  186,187,187,219,0,200,169,160,10,222,253,5,255,35,31,253,16,125,112,158,195,127,202,243,190,87,144,10,192,0,208,15,
+  116,201,193,240,111,115,166,151,162,61,90,180,242,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Mouse1x[720] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,4,8,13,24,4,51,189,102,0,0,0,0,53,116,
+  69,88,116,67,111,109,109,101,110,116,0,40,99,41,32,50,48,48,52,32,74,97,107,117,98,32,83,116,101,105,110,101,
+  114,10,10,67,114,101,97,116,101,100,32,119,105,116,104,32,84,104,101,32,71,73,77,80,144,217,139,111,0,0,2,28,
+  73,68,65,84,56,203,141,144,205,75,84,81,24,198,127,247,220,201,171,115,239,117,162,146,92,40,217,31,208,166,85,208,
+  252,5,17,148,182,9,114,178,77,66,187,208,106,22,5,35,76,16,238,91,180,107,51,109,98,80,35,218,181,9,68,87,
+  34,81,249,17,129,76,14,51,166,57,141,227,215,124,220,243,158,22,126,52,234,72,190,155,195,251,156,231,252,206,195,99,
+  113,104,210,233,116,39,48,80,46,151,111,27,99,60,192,120,190,251,170,251,102,207,147,122,223,216,187,209,235,91,155,91,
+  253,138,163,115,105,187,188,29,243,124,247,123,44,22,243,61,223,237,43,254,89,187,150,74,165,150,82,111,82,217,209,177,
+  145,27,187,190,23,97,55,60,109,29,126,157,76,38,95,182,182,250,189,197,226,218,38,240,49,145,72,244,213,165,187,80,
+  171,85,223,27,216,106,110,118,230,122,186,111,221,179,158,39,135,18,74,169,33,108,11,165,20,149,237,128,104,52,74,46,
+  159,101,97,33,67,147,99,163,131,0,9,164,168,148,250,240,244,89,162,183,254,195,80,40,20,26,186,223,255,192,216,182,
+  109,133,195,97,134,135,135,209,90,227,52,181,96,97,49,240,240,49,165,82,137,194,234,239,200,200,72,250,14,112,0,160,
+  0,42,213,170,245,115,113,113,95,204,229,114,84,42,149,127,123,62,143,215,26,177,26,244,197,145,18,227,241,56,249,124,
+  158,108,54,75,60,30,231,127,19,170,95,86,86,86,104,107,107,99,112,112,240,128,118,98,192,106,161,192,106,161,128,239,
+  251,116,118,116,48,51,59,123,178,4,27,165,117,206,157,57,187,47,214,130,26,203,191,150,15,104,27,165,245,227,1,158,
+  231,238,68,181,192,194,194,24,65,139,32,70,16,173,209,34,180,159,111,231,184,18,167,196,24,180,209,136,104,180,14,208,
+  162,17,17,68,11,34,6,35,178,231,159,106,4,152,213,90,99,43,155,32,16,180,214,232,96,23,38,130,136,208,116,202,
+  217,243,79,55,2,124,154,159,159,195,243,60,90,90,154,177,148,66,139,160,245,78,124,215,117,137,156,142,48,51,243,13,
+  224,71,163,14,222,126,253,242,185,207,113,156,104,87,215,69,60,207,195,0,24,195,206,97,200,100,22,88,90,202,1,188,
+  110,4,168,85,171,213,187,147,19,227,143,38,39,198,47,3,87,26,116,149,1,174,2,107,135,47,254,2,161,171,0,195,
+  167,31,206,166,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Mouse2x[1695] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,6,86,73,68,65,84,88,133,197,151,95,104,20,
+  219,29,199,191,231,204,204,254,153,108,54,113,187,27,99,122,81,73,150,108,72,215,52,18,80,193,10,62,220,218,198,102,
+  69,175,38,246,226,165,197,71,41,148,66,185,80,218,23,159,90,251,231,166,237,75,223,74,222,20,214,136,198,63,247,225,
+  170,8,1,145,114,137,52,1,55,49,133,120,89,37,6,179,217,53,153,157,153,157,153,243,167,15,118,246,110,226,110,186,
+  94,161,61,240,123,152,51,156,243,253,252,126,191,239,25,230,0,255,231,161,252,175,5,47,93,186,212,214,221,221,45,102,
+  102,102,4,0,168,239,179,217,228,228,228,39,156,243,95,10,33,168,148,242,95,156,243,127,72,41,167,151,150,150,190,188,
+  120,241,162,168,183,38,18,137,180,15,12,12,244,3,120,4,0,244,125,0,0,124,166,40,202,79,133,16,71,85,85,253,
+  44,28,14,163,165,165,229,207,233,116,250,171,108,54,251,233,212,212,84,235,214,5,193,96,176,18,137,68,50,254,243,123,
+  85,0,128,16,66,172,157,59,119,174,132,55,25,61,2,240,199,108,54,155,162,148,254,138,49,182,116,237,218,181,191,114,
+  206,255,50,54,54,86,6,128,142,142,14,203,178,172,147,0,126,13,0,164,89,165,19,39,78,36,41,165,35,145,72,228,
+  7,82,202,148,148,178,117,231,206,157,223,34,132,200,149,149,149,85,66,200,87,174,235,126,233,186,238,23,129,64,224,193,
+  213,171,87,203,215,175,95,239,225,156,95,148,82,126,159,16,242,7,199,113,38,52,77,107,167,148,62,56,115,230,204,222,
+  166,0,78,157,58,245,221,96,48,248,183,112,56,60,120,250,244,105,117,223,190,125,129,88,44,134,108,54,139,100,50,137,
+  74,165,130,124,62,143,99,199,142,225,217,179,103,114,122,122,186,60,55,55,167,82,74,111,216,182,253,243,91,183,110,21,
+  38,39,39,191,3,224,55,0,142,19,66,60,33,196,239,71,71,71,255,244,95,179,206,100,50,250,216,216,88,241,241,227,
+  199,194,117,93,105,219,182,52,77,83,46,45,45,201,241,241,113,249,252,249,115,249,244,233,83,57,62,62,46,231,231,231,
+  101,177,88,148,229,114,89,22,139,69,121,229,202,21,239,236,217,179,143,107,247,155,152,152,8,93,190,124,57,94,59,183,
+  173,7,8,33,31,30,62,124,56,208,215,215,71,74,165,18,84,85,69,32,16,128,97,24,32,132,160,84,42,225,245,235,
+  215,144,82,194,52,77,172,175,175,195,117,93,80,74,49,60,60,172,62,124,248,176,247,228,201,147,131,55,110,220,248,39,
+  0,156,63,127,190,2,160,82,171,177,237,41,8,133,66,195,135,14,29,210,109,219,134,16,95,159,170,64,32,0,207,243,
+  240,242,229,75,228,243,121,112,206,17,14,135,171,239,29,199,129,105,154,56,114,228,72,0,192,240,118,26,219,2,16,66,
+  134,247,236,217,67,28,199,129,148,18,82,74,8,33,16,141,70,65,8,193,204,204,12,242,249,60,8,33,104,107,107,131,
+  148,178,186,214,178,44,164,82,41,45,24,12,158,250,70,0,153,76,38,174,105,90,103,52,26,133,235,186,16,66,128,115,
+  14,206,57,162,209,40,82,169,20,150,151,151,177,188,188,140,84,42,133,72,36,82,5,148,82,194,178,44,116,117,117,129,
+  49,54,48,58,58,26,110,164,211,16,128,82,122,244,192,129,3,172,82,169,128,49,86,21,103,140,65,85,85,140,140,140,
+  160,191,191,31,253,253,253,24,25,25,1,165,180,42,46,132,0,99,12,140,49,244,245,245,185,142,227,124,175,145,78,67,
+  19,106,154,54,60,56,56,168,219,182,13,206,57,10,133,2,132,16,32,132,32,16,8,96,112,112,16,23,46,92,0,0,
+  8,33,176,184,184,8,211,52,65,200,155,147,29,14,135,97,154,38,246,239,223,223,178,176,176,240,35,0,119,223,9,128,
+  16,114,108,247,238,221,164,88,44,194,182,109,36,18,9,80,74,171,177,182,182,134,246,246,118,0,64,161,80,64,107,107,
+  43,116,93,175,86,202,48,12,24,134,129,238,238,110,74,41,205,0,248,69,221,74,215,155,60,126,252,120,167,166,105,137,
+  182,182,54,8,33,160,235,58,92,215,133,231,121,213,40,151,203,120,241,226,5,242,249,60,12,195,216,212,34,198,24,52,
+  77,131,109,219,136,199,227,0,240,237,209,209,209,68,211,0,170,170,30,29,26,26,98,126,249,183,110,94,11,226,121,222,
+  38,143,248,102,21,66,192,243,60,88,150,133,116,58,205,61,207,251,176,105,128,80,40,244,195,116,58,173,155,166,249,150,
+  248,214,168,5,172,133,240,223,111,108,108,160,175,175,79,87,20,37,83,79,171,174,7,8,33,251,118,237,218,69,202,229,
+  50,56,231,0,176,233,59,224,27,205,159,23,66,84,99,43,236,198,198,6,58,59,59,65,8,25,104,26,128,115,254,129,
+  174,235,88,89,89,1,33,4,82,202,170,249,8,33,111,1,212,66,212,182,137,49,6,199,113,208,213,213,5,41,229,7,
+  77,3,8,33,162,138,162,192,113,28,80,74,161,170,42,20,69,129,16,2,148,110,238,90,45,192,214,236,125,143,40,138,
+  2,206,121,75,211,0,148,82,195,178,172,144,223,83,95,192,175,2,128,106,101,106,179,247,1,252,236,125,143,88,150,5,
+  74,169,221,52,0,33,100,181,84,42,37,8,33,112,28,7,66,8,40,138,178,169,13,245,202,95,175,2,148,82,172,175,
+  175,131,16,178,254,46,45,248,124,113,113,49,213,219,219,171,148,203,229,77,0,245,60,80,11,176,181,10,209,104,20,249,
+  124,94,74,41,31,212,173,118,189,73,198,216,196,244,244,180,213,210,210,2,198,24,92,215,133,227,56,112,28,7,174,235,
+  54,21,126,255,195,225,48,158,60,121,98,122,158,119,173,105,128,169,169,169,156,105,154,179,179,179,179,34,145,72,188,181,
+  185,15,178,29,148,47,190,186,186,138,229,229,229,210,208,208,208,173,166,1,0,128,115,254,241,157,59,119,214,43,149,10,
+  226,241,120,93,241,218,185,218,103,223,249,173,173,173,184,127,255,190,201,57,255,89,163,123,66,195,155,209,252,252,252,70,
+  111,111,239,211,185,185,185,76,50,153,12,116,116,116,192,178,172,77,255,6,190,203,183,126,29,35,145,8,118,236,216,129,
+  187,119,239,86,86,86,86,166,110,222,188,249,187,70,58,219,94,205,22,22,22,22,122,122,122,30,229,114,185,143,24,99,
+  36,153,76,42,186,174,67,74,89,21,247,60,15,192,155,99,169,235,58,98,177,24,42,149,10,110,223,190,109,191,122,245,
+  234,139,96,48,248,227,92,46,39,27,105,52,117,47,200,100,50,113,74,233,111,85,85,253,201,222,189,123,89,79,79,79,
+  75,44,22,67,40,20,130,166,105,112,28,7,134,97,160,88,44,202,92,46,103,21,10,5,102,24,198,167,247,238,221,251,
+  59,128,186,165,127,39,0,127,28,60,120,112,103,36,18,25,209,117,253,35,85,85,251,1,236,144,82,134,1,84,8,33,
+  5,198,216,124,169,84,202,206,206,206,126,110,24,198,26,128,134,153,127,35,128,255,12,10,32,12,64,7,160,225,107,35,
+  115,0,22,0,19,0,107,118,179,127,3,133,1,126,93,19,53,41,250,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Network1x[408] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,11,18,0,
+  0,11,18,1,210,221,126,252,0,0,0,7,116,73,77,69,7,214,2,16,22,3,20,11,54,9,17,0,0,1,37,73,
+  68,65,84,56,203,157,146,61,75,195,80,20,134,159,155,92,242,63,164,46,221,2,226,238,32,226,38,82,255,131,17,10,
+  34,56,74,196,42,232,228,80,63,210,95,32,4,99,5,255,134,131,110,46,130,56,152,22,170,129,214,170,225,82,18,7,
+  13,26,242,97,240,29,207,121,207,203,121,206,189,130,2,181,246,182,61,160,65,185,58,178,164,217,88,152,95,164,86,55,
+  115,155,131,167,7,188,174,107,149,5,80,171,155,44,55,47,48,140,180,77,169,9,87,206,10,0,165,1,66,8,12,67,
+  98,206,78,3,49,32,0,184,189,190,39,138,190,60,178,140,245,180,189,207,220,20,168,151,30,143,98,134,247,15,197,235,
+  56,76,121,100,69,86,122,207,111,223,21,29,128,56,142,127,16,170,176,70,163,97,170,254,123,131,74,172,238,225,82,102,
+  179,204,17,117,93,163,63,24,231,178,58,71,7,121,132,118,42,224,230,174,15,177,200,101,93,91,109,166,38,53,77,227,
+  196,105,183,100,98,82,106,130,49,28,101,110,144,40,8,130,220,35,203,132,231,242,184,81,248,10,0,238,249,89,97,64,
+  199,235,186,214,31,127,222,182,183,118,118,139,2,172,141,245,77,194,48,204,157,76,88,129,194,0,124,223,231,191,146,101,
+  124,85,244,9,241,192,132,130,214,14,135,66,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Network2x[1293] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,214,5,29,7,1,11,233,166,171,236,0,0,4,154,73,
+  68,65,84,88,195,205,151,75,108,84,85,24,199,127,231,156,25,218,78,157,233,240,144,204,240,46,76,5,130,44,52,81,
+  140,209,88,154,152,152,200,74,18,93,216,133,34,104,35,49,196,13,66,42,154,32,138,184,112,99,212,241,65,140,80,37,
+  168,113,163,11,162,66,52,38,36,128,137,218,5,218,70,10,212,148,86,233,195,233,157,231,109,239,249,92,220,153,210,150,
+  182,76,59,36,122,147,201,156,123,238,189,231,252,207,247,253,127,223,61,23,254,227,67,205,230,230,103,119,62,243,104,44,
+  30,59,94,201,132,217,108,238,203,215,95,123,99,107,233,60,48,155,135,99,241,216,241,109,79,60,197,224,208,224,156,38,
+  143,132,163,131,71,218,62,122,100,124,95,96,182,131,20,10,238,149,237,173,63,30,86,129,200,190,114,159,17,47,211,214,
+  246,102,83,115,58,227,140,78,190,54,107,1,74,169,128,10,68,246,61,190,117,35,34,130,69,240,68,16,15,68,9,214,
+  10,98,5,107,45,0,174,107,57,113,242,66,115,95,111,47,1,51,47,92,185,0,173,3,0,162,1,81,190,141,60,1,
+  37,40,5,32,160,53,34,10,17,97,192,201,1,80,95,191,26,39,149,118,129,154,138,4,136,181,166,40,196,95,45,2,
+  6,148,82,120,30,40,101,16,132,238,62,135,254,225,2,133,130,31,137,139,23,187,8,152,96,117,197,17,64,161,199,0,
+  82,130,66,161,81,88,229,11,193,131,223,46,12,49,156,29,1,32,24,84,215,34,224,164,71,129,170,74,61,96,0,172,
+  242,167,182,34,215,96,214,154,95,59,175,226,186,22,19,52,40,41,102,9,232,232,248,157,218,80,184,106,218,8,148,203,
+  248,209,182,143,67,15,223,9,195,157,93,215,93,27,40,132,241,212,29,152,224,152,97,64,252,230,218,181,235,200,102,114,
+  50,173,128,74,25,15,204,11,243,197,231,71,184,42,26,109,193,106,13,22,180,154,72,208,140,30,152,11,227,225,133,181,
+  188,179,231,118,134,82,105,127,192,128,6,140,63,177,8,50,174,216,106,163,213,140,2,230,200,56,125,189,189,88,235,15,
+  213,113,238,210,148,133,200,29,113,155,141,186,190,242,7,110,22,227,169,161,97,0,94,217,185,152,53,107,18,24,99,198,
+  15,221,236,56,195,132,107,35,51,11,168,144,113,0,54,172,219,80,242,29,34,190,102,1,234,194,11,232,253,171,199,66,
+  9,227,169,48,172,128,241,161,161,127,0,104,59,214,54,173,95,220,130,171,175,92,233,219,59,147,7,42,97,28,128,166,
+  198,38,242,249,60,133,66,1,215,117,57,115,246,204,215,198,152,45,74,169,253,198,152,216,202,149,203,159,60,120,232,192,
+  99,74,169,29,123,118,183,254,52,89,128,6,80,70,33,162,80,158,32,34,244,14,102,248,59,149,199,67,79,203,120,218,
+  201,0,112,242,212,201,9,171,174,169,169,217,82,108,190,212,221,253,103,83,109,109,232,72,40,20,186,191,186,186,250,43,
+  32,62,201,132,62,167,90,52,86,89,196,40,58,46,167,200,100,70,177,74,97,130,106,90,198,181,246,179,151,88,125,91,
+  105,49,100,50,89,26,26,26,40,20,242,156,63,127,158,21,43,56,149,203,229,79,136,216,186,84,42,117,8,152,55,81,
+  0,126,10,206,253,49,80,92,157,248,198,8,154,162,57,100,90,198,77,192,119,125,9,209,250,250,122,186,186,186,232,238,
+  190,76,34,145,32,82,23,33,26,157,207,80,106,224,161,211,167,79,183,124,114,244,216,119,64,100,130,0,99,140,18,47,
+  211,214,113,246,98,115,185,133,232,190,187,22,225,142,184,148,24,223,180,233,238,98,52,13,139,22,47,242,163,163,12,155,
+  227,49,60,107,65,4,199,25,78,2,235,1,51,201,3,112,248,224,189,205,209,186,249,99,125,158,245,232,236,236,24,59,
+  159,130,113,198,51,126,236,248,167,55,20,221,223,223,255,22,144,3,114,19,4,100,210,25,187,112,193,173,90,198,194,239,
+  171,223,176,126,99,17,104,185,33,227,123,118,183,46,43,178,62,158,119,13,216,98,123,20,40,0,89,32,63,38,224,151,
+  159,219,31,4,190,157,73,121,85,117,85,57,140,247,84,178,45,215,128,222,127,224,229,145,205,141,155,137,70,231,83,83,
+  19,2,32,151,203,146,207,231,102,100,92,41,213,8,100,75,140,151,45,160,165,165,69,37,147,201,224,174,231,159,187,39,
+  30,143,253,48,151,215,113,145,113,183,200,248,174,189,47,188,24,47,235,53,14,144,76,38,131,219,159,222,246,64,60,30,
+  251,102,73,108,57,145,186,48,203,150,46,229,210,165,203,211,237,138,202,98,28,112,111,36,192,0,180,238,219,187,45,30,
+  143,125,182,108,201,10,18,13,9,180,82,244,244,244,34,248,149,16,241,255,75,191,85,171,86,225,56,195,164,82,41,226,
+  241,56,78,218,33,90,183,0,19,208,137,246,246,246,87,223,125,251,189,19,165,15,161,178,34,16,14,223,242,254,142,237,
+  45,164,29,7,109,20,214,179,36,18,165,50,52,213,214,188,60,198,203,78,129,181,246,251,15,62,76,54,222,140,143,205,
+  241,140,207,134,2,93,204,89,117,81,84,112,18,25,215,145,82,14,227,227,250,255,191,199,191,167,170,113,206,159,129,237,
+  192,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Optical1x[720] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,4,5,17,7,21,115,1,202,165,0,0,0,140,116,
+  69,88,116,67,111,109,109,101,110,116,0,77,101,110,117,45,115,105,122,101,100,32,105,99,111,110,10,61,61,61,61,61,
+  61,61,61,61,61,10,10,40,99,41,32,50,48,48,51,32,74,97,107,117,98,32,39,106,105,109,109,97,99,39,32,83,
+  116,101,105,110,101,114,44,32,10,104,116,116,112,58,47,47,106,105,109,109,97,99,46,109,117,115,105,99,104,97,108,108,
+  46,99,122,10,10,99,114,101,97,116,101,100,32,119,105,116,104,32,116,104,101,32,71,73,77,80,44,10,104,116,116,112,
+  58,47,47,119,119,119,46,103,105,109,112,46,111,114,103,103,138,199,71,0,0,1,197,73,68,65,84,56,203,157,146,77,
+  107,19,81,20,134,159,51,153,102,22,195,224,100,96,22,83,157,44,252,248,3,69,212,141,40,110,10,34,234,90,93,184,
+  149,72,200,63,208,130,80,68,132,88,104,69,65,17,17,68,255,129,74,214,217,104,73,180,38,168,203,102,25,33,208,132,
+  4,146,185,199,197,164,205,4,233,34,61,171,195,185,231,62,239,123,238,61,82,174,148,30,2,15,56,90,172,81,174,148,
+  244,40,209,239,247,181,92,41,169,13,96,140,161,215,235,45,36,157,119,242,0,216,0,106,20,53,10,178,0,65,153,1,
+  140,26,140,42,232,20,50,61,76,211,255,10,233,125,213,140,3,85,140,73,0,65,208,131,78,157,245,131,128,152,140,129,
+  44,96,223,133,0,70,1,145,153,160,234,1,216,72,150,152,29,193,24,52,209,84,83,4,85,69,84,81,217,87,19,68,
+  20,213,67,70,112,28,135,229,227,203,135,190,215,96,48,0,96,56,28,2,48,26,141,230,29,52,26,13,198,227,241,66,
+  223,232,121,94,10,48,137,33,159,207,243,230,237,171,133,0,151,46,94,73,1,98,9,237,118,11,128,167,79,170,76,38,
+  19,70,163,33,221,191,93,154,205,6,182,189,196,141,235,55,169,213,106,4,65,64,20,69,172,63,126,68,16,4,83,128,
+  8,190,239,19,134,33,219,219,95,89,89,57,139,239,23,240,253,2,167,79,157,1,160,94,175,227,186,46,97,24,242,249,
+  203,39,28,199,193,117,93,0,114,231,47,156,147,223,127,126,93,222,219,235,179,243,243,7,190,239,83,140,139,0,116,58,
+  29,186,221,46,158,231,17,69,17,31,62,190,167,213,222,33,73,18,154,223,27,136,200,218,220,242,150,238,223,187,150,179,
+  173,103,241,137,248,228,234,234,85,138,113,140,101,229,216,237,236,154,23,47,183,44,160,5,172,111,84,55,223,101,246,139,
+  108,110,221,190,115,107,169,16,28,123,110,89,214,221,185,213,87,125,45,34,91,27,213,205,111,217,250,63,189,144,236,196,
+  0,156,143,39,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Optical2x[1338] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,4,241,73,68,65,84,88,133,237,151,77,107,27,
+  87,20,134,159,59,51,146,70,182,136,109,197,56,49,162,162,182,28,74,49,66,100,103,199,49,73,136,146,58,24,28,210,
+  32,10,134,54,110,146,210,254,12,183,244,63,20,186,113,23,165,139,64,32,139,236,146,69,26,67,233,162,14,56,31,16,
+  146,69,157,144,16,108,35,33,91,31,51,250,184,115,187,240,204,100,236,140,108,53,93,148,66,95,24,116,239,209,204,57,
+  207,57,71,119,238,21,252,175,127,89,34,204,56,55,55,119,36,26,141,254,168,148,154,1,162,255,48,70,19,248,185,88,
+  44,126,125,239,222,189,246,222,47,141,176,39,162,209,232,79,215,175,95,159,201,231,243,104,154,134,82,10,96,215,231,222,
+  113,216,92,41,133,227,56,209,165,165,165,171,203,203,203,127,0,63,28,8,80,40,20,116,199,113,114,83,83,83,148,74,
+  37,44,203,66,8,129,16,162,99,144,253,236,177,88,140,217,217,89,150,151,151,191,10,3,208,246,26,148,82,231,39,38,
+  38,134,163,209,168,31,220,83,112,28,84,39,59,128,109,219,36,147,73,70,71,71,143,95,190,124,249,120,55,0,11,179,
+  179,179,212,106,181,208,236,222,71,245,122,157,124,62,15,112,109,95,128,249,249,249,129,120,60,62,151,201,100,168,86,171,
+  65,168,208,241,126,182,160,44,203,98,124,124,156,72,36,50,191,176,176,96,118,4,104,52,26,159,205,205,205,153,205,102,
+  19,41,101,104,79,247,246,189,27,136,118,187,141,166,105,76,78,78,14,108,111,111,127,218,17,0,184,114,242,228,73,42,
+  149,202,129,191,252,189,182,176,121,80,245,122,157,19,39,78,32,132,184,26,10,112,233,210,165,143,71,70,70,38,6,6,
+  6,176,109,251,192,236,247,107,75,24,68,163,209,32,149,74,49,52,52,116,166,80,40,140,188,3,160,105,218,23,23,47,
+  94,164,86,171,225,56,206,174,140,14,90,114,221,86,163,209,104,112,234,212,41,77,74,249,229,46,128,197,197,69,77,211,
+  180,207,179,217,44,213,106,181,171,245,221,41,248,126,213,177,109,155,92,46,135,97,24,11,139,139,139,154,15,240,232,209,
+  163,115,211,211,211,41,33,4,205,102,179,235,242,135,205,195,2,123,247,72,41,137,199,227,140,143,143,127,176,186,186,122,
+  62,216,130,43,103,207,158,245,179,15,58,232,6,34,236,254,78,213,176,109,155,211,167,79,163,235,250,181,32,192,153,116,
+  58,77,189,94,239,42,251,110,91,17,86,141,86,171,197,177,99,199,80,74,157,131,183,123,193,145,72,36,194,209,163,71,
+  223,235,109,215,233,153,78,47,45,219,182,1,250,130,0,162,86,171,177,178,178,178,43,147,224,229,56,206,123,219,130,118,
+  128,84,42,229,3,249,187,161,183,244,110,220,184,225,143,247,147,183,67,6,129,15,186,95,215,117,38,39,39,119,249,247,
+  1,60,7,66,8,18,137,4,133,66,1,41,165,31,168,94,175,83,175,215,1,216,220,220,228,225,195,135,62,128,148,146,
+  233,233,105,18,137,4,74,41,122,123,123,137,199,227,187,170,113,243,230,77,255,249,80,0,207,56,54,54,198,214,214,22,
+  195,195,195,72,41,125,40,219,182,217,222,222,70,8,65,38,147,97,112,112,144,90,173,6,192,161,67,135,72,167,211,187,
+  230,166,105,226,56,14,66,8,44,203,34,145,72,208,215,215,119,48,64,46,151,227,217,179,103,72,41,57,124,248,48,142,
+  227,160,105,26,134,97,96,89,150,239,52,153,76,98,89,150,95,129,70,163,65,34,145,32,30,143,251,129,148,82,232,186,
+  206,235,215,175,25,26,26,242,237,94,98,176,179,12,35,158,49,22,139,17,141,70,73,167,211,220,185,115,7,165,20,134,
+  97,160,105,26,142,227,16,139,197,48,12,131,118,187,205,250,250,58,165,82,137,98,177,72,185,92,70,74,137,105,154,120,
+  7,25,203,178,104,181,90,148,203,101,86,86,86,232,235,235,67,215,117,116,93,247,0,36,16,53,128,30,165,212,159,15,
+  30,60,24,201,100,50,0,12,14,14,34,165,228,246,237,219,92,184,112,1,195,48,252,237,217,203,44,145,72,248,153,232,
+  186,238,103,212,108,54,17,66,96,24,6,229,114,153,187,119,239,146,76,38,137,197,98,126,165,159,63,127,142,227,56,79,
+  129,94,3,80,165,82,233,187,165,165,165,111,117,93,79,123,142,164,148,36,147,73,222,188,121,67,62,159,103,116,116,212,
+  183,55,155,205,119,2,107,154,134,16,2,77,211,144,82,242,248,241,99,86,87,87,121,242,228,9,149,74,5,93,215,137,
+  68,34,8,33,144,82,174,109,108,108,124,15,180,4,59,71,243,126,118,94,12,9,118,142,225,17,183,61,102,54,155,253,
+  112,102,102,230,155,254,254,254,92,54,155,213,83,169,148,209,211,211,131,105,154,254,65,85,41,69,173,86,163,88,44,242,
+  242,229,203,246,139,23,47,228,250,250,250,239,183,110,221,250,229,213,171,87,27,128,13,148,129,22,59,199,244,26,176,9,
+  84,130,167,73,13,136,185,151,151,154,14,244,0,230,216,216,216,145,169,169,169,79,82,169,212,148,105,154,31,185,208,154,
+  219,18,169,148,42,87,171,213,167,107,107,107,191,221,191,127,255,215,141,141,141,45,55,176,5,84,129,58,208,14,64,40,
+  232,240,199,100,143,52,32,14,152,1,192,8,59,43,72,119,191,87,238,37,221,0,45,160,225,2,84,220,192,161,234,6,
+  192,147,238,66,120,45,50,220,224,158,15,15,160,237,6,183,92,144,125,245,119,0,130,210,120,155,189,231,195,113,1,28,
+  23,230,191,161,191,0,81,45,240,203,178,133,12,186,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Printer1x[481] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,17,0,
+  0,11,17,1,127,100,95,145,0,0,0,7,116,73,77,69,7,213,8,18,15,53,11,122,248,175,234,0,0,1,110,73,
+  68,65,84,56,203,165,147,205,78,34,81,16,133,191,91,176,224,33,122,235,204,138,16,34,179,49,242,24,227,248,48,218,
+  254,60,129,154,209,103,16,120,2,122,199,154,37,59,113,167,38,36,205,95,104,18,187,105,238,45,87,32,61,252,77,244,
+  38,149,155,186,73,157,58,85,231,92,248,230,49,171,73,189,81,187,2,252,255,168,187,62,249,253,231,98,237,181,222,168,
+  105,146,36,59,35,142,99,173,55,106,186,168,201,111,130,111,183,219,91,91,87,42,149,76,190,17,160,88,44,126,206,104,
+  76,230,86,213,221,0,206,57,58,157,14,0,34,178,6,84,46,151,247,51,240,60,15,17,193,24,179,22,123,25,168,42,
+  173,86,107,217,81,68,168,86,171,187,101,60,247,207,174,0,191,80,40,240,227,224,39,206,185,12,253,213,241,140,49,116,
+  159,159,136,227,24,224,122,193,192,191,240,47,177,214,146,166,233,94,19,76,38,199,136,8,247,15,127,125,89,93,82,183,
+  219,37,73,18,130,32,64,85,9,195,144,209,104,196,96,48,96,56,28,210,239,247,233,245,122,52,155,77,222,94,95,178,
+  59,136,162,136,248,253,157,241,120,76,169,84,34,12,67,0,210,52,93,82,7,176,214,50,232,135,196,201,44,11,32,34,
+  76,162,136,32,104,50,157,78,1,152,207,231,136,49,56,103,153,91,139,72,142,124,46,199,209,113,117,179,10,214,90,14,
+  43,191,254,49,140,226,156,98,173,69,68,150,242,46,150,188,4,152,205,102,120,158,183,213,113,11,21,68,4,85,197,57,
+  151,1,120,188,189,187,57,253,194,111,126,252,0,186,104,203,229,25,65,188,29,0,0,0,0,73,69,78,68,174,66,96,
+  130,
+};
+const unsigned char Printer2x[917] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,3,76,73,68,65,84,88,133,229,151,203,79,36,
+  85,20,198,127,213,93,213,213,205,99,44,170,7,131,163,221,24,96,101,156,16,135,137,255,128,137,243,7,176,101,43,48,
+  147,134,224,78,73,70,89,184,109,196,16,99,34,11,183,44,92,139,186,115,246,44,93,25,67,120,100,228,17,98,117,3,
+  61,118,61,238,113,209,213,61,93,5,13,253,192,153,133,95,250,164,206,189,231,220,251,125,125,238,173,91,85,240,127,135,
+  214,42,176,182,182,246,93,181,90,157,5,18,61,114,40,211,52,191,95,90,90,122,124,85,80,111,53,202,117,221,217,197,
+  197,197,94,201,1,18,235,235,235,179,64,103,2,68,36,1,112,120,120,216,19,251,200,200,72,99,174,142,4,52,99,127,
+  127,191,99,226,92,46,215,86,222,141,2,12,195,96,108,108,236,198,137,68,164,45,194,174,4,236,237,237,117,76,158,207,
+  231,111,79,192,248,248,120,71,228,157,160,45,1,187,187,187,29,19,143,142,142,222,158,128,137,137,137,142,200,59,65,91,
+  2,118,118,118,90,146,91,150,197,208,208,80,203,241,158,231,245,38,160,92,46,147,205,102,209,180,151,135,102,220,175,84,
+  42,87,246,3,36,147,201,238,5,184,174,219,56,136,174,19,112,157,63,60,60,220,190,128,249,249,249,15,147,201,228,79,
+  190,239,103,1,78,79,79,57,57,57,137,76,28,39,186,169,93,175,192,220,220,156,232,186,126,228,186,238,71,27,27,27,
+  191,55,114,235,206,194,194,130,169,235,250,159,203,203,203,111,91,150,197,234,234,42,147,147,147,156,159,159,95,154,252,186,
+  77,216,28,215,52,141,254,254,126,182,183,183,41,20,10,56,142,67,177,88,252,195,182,237,247,86,86,86,252,72,5,52,
+  77,251,124,102,102,230,77,203,178,0,176,109,155,227,227,227,150,68,237,226,226,226,130,193,193,65,42,149,10,3,3,3,
+  76,79,79,191,187,185,185,249,25,240,85,36,177,80,40,252,29,4,129,40,165,218,178,32,8,186,50,223,247,229,201,147,
+  199,141,178,54,42,224,121,158,37,34,252,245,252,0,195,48,56,56,120,78,38,99,98,219,54,74,1,72,88,218,218,85,
+  132,154,17,58,8,162,106,237,230,126,17,65,41,225,236,188,140,239,249,124,240,96,138,32,80,253,151,4,0,4,65,128,
+  227,56,228,243,121,252,192,99,240,206,48,153,76,95,24,149,250,239,101,155,144,59,2,137,245,213,6,29,29,31,241,207,
+  139,23,84,171,213,72,118,228,57,29,4,62,63,255,242,43,190,31,144,123,39,71,218,76,147,74,165,66,51,73,153,38,
+  102,195,210,152,102,154,116,58,110,25,50,153,102,235,3,77,227,217,179,223,128,218,173,221,140,75,21,184,119,239,45,158,
+  126,241,229,165,19,172,151,227,215,48,116,238,223,127,31,0,239,38,1,15,31,78,49,53,245,0,165,4,17,213,88,67,
+  17,133,40,65,73,204,87,97,142,8,18,230,213,125,21,230,213,226,53,223,245,162,2,34,75,160,84,208,245,191,108,23,
+  241,37,136,237,129,255,94,128,231,70,151,246,149,11,136,47,65,125,15,164,18,137,132,123,118,118,150,170,221,118,130,82,
+  32,162,162,190,8,74,174,243,5,68,53,124,105,236,1,16,20,162,160,92,42,161,105,90,0,216,128,163,135,85,120,163,
+  82,169,124,91,44,126,253,233,109,190,108,92,5,77,211,40,149,74,63,132,2,68,3,146,192,93,32,251,232,209,199,133,
+  108,246,238,39,34,210,214,235,122,23,8,28,199,249,113,107,107,235,27,224,20,56,170,63,13,211,161,162,59,64,31,96,
+  208,251,39,89,28,94,56,167,11,92,0,39,64,41,254,109,104,0,169,208,110,27,10,8,66,33,46,205,167,250,235,196,
+  191,89,213,31,195,110,216,55,104,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Speaker1x[592] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,1,226,73,68,65,84,56,141,
+  165,147,191,79,83,81,20,199,63,231,246,245,165,68,168,3,193,201,63,64,99,66,4,139,128,113,100,241,71,88,40,88,
+  162,46,36,242,106,58,233,0,127,132,49,93,173,12,13,137,160,169,105,2,196,133,196,168,131,131,137,16,23,69,172,147,
+  58,176,184,152,247,76,244,93,222,61,14,198,218,22,140,65,191,227,57,159,156,123,190,223,123,175,168,42,255,35,243,167,
+  70,126,58,159,11,130,32,253,79,3,10,133,137,193,20,242,56,142,227,212,129,7,20,10,19,131,105,63,243,84,85,179,
+  173,245,161,224,94,112,122,118,121,172,147,247,46,77,79,134,64,198,243,188,175,168,222,73,251,153,235,51,51,51,217,202,
+  221,74,210,10,58,167,239,141,104,53,23,60,236,223,168,76,126,105,110,32,72,166,124,187,236,205,207,205,31,86,152,43,
+  149,74,217,209,145,51,120,158,7,64,110,118,169,56,114,109,233,232,230,194,213,39,10,235,104,124,179,205,130,162,244,245,
+  29,225,248,177,19,168,170,12,156,60,69,38,211,133,136,0,32,66,111,34,148,1,68,101,69,144,209,61,25,188,217,122,
+  205,187,198,91,0,26,141,109,182,183,183,176,214,2,144,114,44,2,99,34,136,26,247,10,116,72,4,105,102,0,16,134,
+  97,115,101,187,107,81,126,191,141,93,163,137,168,164,0,172,209,196,79,164,45,120,3,16,70,33,97,20,162,170,216,216,
+  98,99,219,4,4,83,64,244,153,42,234,37,169,1,96,83,91,78,48,0,81,20,177,179,179,3,192,135,79,31,137,109,
+  220,26,191,167,164,111,252,132,245,130,194,139,182,107,84,85,173,215,235,137,136,88,35,102,113,117,117,229,242,248,197,241,
+  238,95,192,203,133,43,183,0,134,139,247,71,129,60,98,250,59,45,244,168,106,183,115,174,123,121,233,65,209,126,79,206,
+  173,61,90,139,156,115,109,94,93,226,134,65,139,27,149,233,207,173,117,217,239,51,77,77,77,157,197,184,245,67,93,61,
+  189,213,106,245,219,30,160,51,196,78,213,106,181,231,56,115,222,247,253,100,191,254,95,55,56,136,126,0,228,148,200,42,
+  201,231,90,24,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Speaker2x[1854] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,6,245,73,68,65,84,88,133,237,150,109,140,84,
+  87,25,199,127,231,220,123,238,220,59,47,251,50,51,187,203,178,3,97,23,22,104,129,54,186,84,216,180,81,191,212,82,
+  99,141,47,133,15,181,49,8,149,24,136,81,162,49,49,105,226,26,141,126,209,126,48,161,77,27,209,38,162,169,66,76,
+  109,212,154,168,188,108,181,32,150,82,177,11,21,22,152,93,102,223,119,217,183,153,217,153,251,114,142,31,118,169,200,80,
+  163,169,137,137,225,159,60,185,247,230,156,156,255,239,220,231,121,78,14,220,209,29,253,143,37,254,147,201,251,247,239,223,
+  134,197,46,96,171,144,216,194,200,62,109,244,11,245,201,250,31,245,244,244,248,255,117,128,125,95,220,215,45,140,248,30,
+  208,38,132,104,205,181,229,216,180,105,35,245,117,117,204,207,23,41,149,75,228,243,121,10,67,67,24,99,34,33,196,223,
+  4,226,219,79,125,231,169,67,239,26,160,167,167,71,142,79,79,92,250,244,99,143,119,196,227,30,249,124,158,250,250,6,
+  158,63,244,19,206,190,113,14,173,53,241,68,156,15,220,223,205,93,235,59,241,253,0,219,182,56,127,225,66,184,16,86,
+  214,28,248,238,129,129,27,107,117,237,121,86,193,114,117,230,185,71,202,183,250,200,119,2,40,140,21,222,215,214,218,214,
+  145,107,107,227,153,231,14,162,156,24,79,126,253,155,12,21,174,177,42,183,140,53,237,109,52,53,166,56,253,218,235,188,
+  248,203,223,80,87,151,226,197,151,94,166,177,177,193,150,161,220,241,79,187,140,188,117,68,51,143,221,206,199,190,241,178,
+  125,239,246,100,42,172,255,138,227,56,31,23,66,86,203,149,210,49,173,35,130,32,224,115,159,221,205,87,159,252,26,233,
+  250,36,142,178,144,150,68,217,10,43,105,145,201,8,174,79,207,243,251,99,127,96,199,163,31,229,202,213,1,66,173,1,
+  216,242,196,161,220,159,190,255,120,97,97,206,189,24,111,244,119,110,216,123,32,217,247,244,190,98,13,192,246,189,219,147,
+  13,166,241,204,135,30,122,112,85,215,123,222,235,140,142,142,114,226,149,222,123,46,246,247,83,94,40,243,211,35,63,199,
+  81,18,101,75,148,163,136,57,49,148,178,177,44,11,33,37,241,120,156,145,209,9,166,166,166,153,158,158,38,12,162,115,
+  244,244,200,112,72,124,163,123,247,207,190,116,242,224,142,235,93,123,126,60,24,243,27,214,1,103,106,82,144,17,217,31,
+  108,255,196,163,237,221,91,182,58,199,123,143,114,236,196,81,198,39,199,213,178,101,173,84,43,85,242,249,171,40,91,226,
+  56,14,158,231,225,197,61,226,241,56,241,68,98,241,25,143,211,186,44,203,91,23,251,73,165,82,232,40,216,66,79,143,
+  150,198,188,25,200,234,3,0,50,18,87,45,193,250,154,26,248,212,206,157,155,98,174,187,237,190,205,93,234,204,235,127,
+  102,126,126,158,72,107,214,174,89,203,234,246,118,222,56,247,87,116,20,98,219,54,174,235,226,185,238,77,16,30,137,196,
+  34,64,58,221,64,165,82,161,190,174,142,200,232,135,1,48,166,207,24,185,25,32,18,102,216,8,179,170,6,192,139,169,
+  189,31,222,182,45,62,59,59,71,97,232,26,45,205,45,236,254,204,46,198,198,199,105,93,214,204,229,171,151,209,58,196,
+  141,197,104,76,55,144,206,164,177,164,36,22,139,189,189,251,27,16,169,84,146,40,10,49,134,174,61,123,246,40,109,137,
+  33,41,244,58,0,133,25,3,179,178,6,0,196,131,185,182,156,53,88,24,64,107,77,38,147,166,174,174,129,193,193,2,
+  169,84,138,82,177,140,109,91,164,179,105,58,59,59,233,236,236,100,121,219,114,170,190,191,100,254,143,52,164,82,9,170,
+  85,31,71,41,85,46,151,59,64,207,34,196,10,128,162,227,204,8,68,182,6,32,8,131,149,142,82,204,206,206,2,16,
+  106,67,95,223,57,138,165,18,198,24,164,45,81,74,145,201,100,104,105,105,166,99,117,59,141,233,70,228,82,241,45,214,
+  66,28,207,91,76,71,104,52,66,74,66,194,140,147,112,39,180,97,53,64,83,115,83,69,27,145,168,105,67,173,181,210,
+  70,83,42,45,118,71,113,110,150,226,252,60,97,24,18,134,1,142,82,40,91,17,69,17,85,223,167,88,44,18,6,33,
+  58,210,120,113,15,219,182,49,198,16,4,1,110,185,76,20,70,68,81,136,239,107,1,32,32,121,195,76,220,230,220,177,
+  133,148,225,194,194,130,45,196,226,216,228,212,36,90,27,180,137,168,84,170,184,110,12,203,182,152,157,157,163,112,173,192,
+  228,196,36,51,51,51,40,71,17,247,60,148,82,24,99,168,250,62,74,57,88,86,21,191,234,35,162,104,106,97,186,212,
+  98,41,167,31,128,241,9,23,204,66,13,128,101,89,195,115,115,179,43,45,185,120,42,151,74,101,180,214,56,78,140,137,
+  137,73,146,201,36,142,163,16,8,70,134,135,49,70,96,43,155,123,238,221,132,235,185,56,78,12,99,12,66,74,140,214,
+  216,150,69,177,180,16,218,82,94,81,202,185,91,99,6,1,74,68,141,192,100,77,13,24,99,126,151,31,24,208,174,231,
+  1,160,148,66,74,73,50,17,231,218,208,48,233,198,52,201,84,10,91,89,100,178,89,58,86,183,179,97,227,221,36,18,
+  9,28,39,70,60,238,225,121,46,142,163,208,6,74,197,18,190,239,255,229,240,225,195,62,82,172,16,112,30,192,84,117,
+  43,194,92,171,1,152,158,158,125,254,212,233,211,229,100,34,69,44,230,98,219,22,153,76,150,245,107,59,233,191,114,153,
+  132,231,209,148,109,70,8,241,118,200,165,176,109,11,215,117,113,28,135,32,8,145,82,48,62,57,73,168,245,175,0,180,
+  54,247,74,56,5,32,4,57,97,100,190,6,224,23,71,142,244,21,139,229,51,249,171,249,104,121,107,43,82,90,140,141,
+  143,145,203,229,24,24,44,80,245,171,36,147,41,18,137,20,198,152,165,0,99,12,81,164,241,125,159,48,12,153,24,159,
+  162,90,169,48,62,49,133,14,195,63,2,72,204,22,75,87,78,0,104,65,39,152,190,26,0,192,126,181,247,149,253,199,
+  122,123,167,6,175,21,162,230,166,102,154,179,77,156,60,117,74,103,179,105,140,214,196,148,77,107,91,43,182,109,163,181,
+  38,138,34,130,48,196,247,125,202,229,5,134,135,71,8,194,128,40,12,105,108,104,64,27,179,17,32,12,253,93,39,15,
+  62,113,253,225,207,255,58,38,132,105,47,43,231,66,77,17,2,162,191,191,127,198,215,254,39,203,149,133,47,199,221,248,
+  3,198,232,104,100,100,244,124,125,67,227,7,131,32,224,165,151,127,203,199,30,121,136,92,110,5,197,226,252,82,155,5,
+  8,177,64,113,190,68,181,82,97,230,250,117,142,246,158,100,101,110,57,81,24,58,0,103,127,184,107,2,96,34,152,236,
+  52,70,92,237,123,122,71,241,118,0,33,16,14,94,25,28,31,188,50,216,3,120,128,107,89,86,162,171,187,123,227,200,
+  232,88,246,253,221,247,113,225,173,139,116,174,238,160,174,190,30,207,115,1,208,70,51,59,51,207,165,75,253,4,65,200,
+  253,91,55,243,234,201,215,116,53,12,143,220,108,210,62,229,94,56,187,44,121,233,86,115,88,188,17,37,151,76,61,192,
+  5,98,75,225,228,86,173,218,156,109,110,249,130,101,89,171,132,16,114,69,110,57,119,173,93,67,38,147,70,74,201,228,
+  212,20,249,124,129,43,3,131,104,173,145,66,20,140,224,91,167,78,156,120,230,118,102,239,4,32,110,49,119,150,194,6,
+  44,110,186,182,173,221,176,233,65,47,225,125,196,150,118,151,144,210,209,38,122,83,104,241,66,197,115,158,237,59,126,188,
+  230,247,254,187,0,55,36,151,140,99,128,90,50,151,55,205,49,64,196,98,202,42,64,117,233,251,93,233,95,221,138,229,
+  45,227,230,166,184,163,255,31,253,29,127,37,1,140,156,153,51,57,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Storage1x[603] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,4,5,15,53,8,235,207,124,119,0,0,0,140,116,
+  69,88,116,67,111,109,109,101,110,116,0,77,101,110,117,45,115,105,122,101,100,32,105,99,111,110,10,61,61,61,61,61,
+  61,61,61,61,61,10,10,40,99,41,32,50,48,48,51,32,74,97,107,117,98,32,39,106,105,109,109,97,99,39,32,83,
+  116,101,105,110,101,114,44,32,10,104,116,116,112,58,47,47,106,105,109,109,97,99,46,109,117,115,105,99,104,97,108,108,
+  46,99,122,10,10,99,114,101,97,116,101,100,32,119,105,116,104,32,116,104,101,32,71,73,77,80,44,10,104,116,116,112,
+  58,47,47,119,119,119,46,103,105,109,112,46,111,114,103,103,138,199,71,0,0,1,80,73,68,65,84,56,203,165,147,77,
+  110,194,48,16,133,191,160,64,164,32,203,201,38,106,36,246,112,55,36,196,13,218,222,144,21,39,64,44,216,65,108,16,
+  249,153,233,34,224,40,237,162,85,153,133,237,25,207,123,126,51,182,225,69,139,54,219,245,7,240,254,79,252,39,155,237,
+  90,255,99,206,57,221,108,215,26,3,136,8,231,243,25,85,133,40,2,213,177,76,64,159,67,4,160,204,102,51,0,98,
+  0,21,165,19,233,179,69,6,0,16,17,33,170,125,140,168,199,247,206,64,32,42,72,39,68,15,144,2,168,62,0,202,
+  83,24,170,61,177,208,171,13,10,84,201,243,140,211,233,244,167,206,101,89,70,215,117,0,76,158,65,231,28,69,81,252,
+  10,46,138,130,186,174,131,31,154,232,189,15,9,0,215,235,149,170,170,0,48,198,144,166,41,147,201,132,203,229,130,247,
+  30,99,204,64,144,36,9,139,197,98,116,146,181,22,107,45,0,222,123,234,186,230,118,187,253,80,20,3,236,118,59,154,
+  166,25,109,180,109,75,28,199,97,253,221,242,60,31,247,160,109,91,246,251,61,199,227,145,170,170,80,85,84,149,36,73,
+  56,28,14,24,99,194,236,156,195,57,55,16,168,42,34,194,124,158,50,157,78,195,35,1,104,154,6,149,158,76,69,250,
+  220,199,13,132,18,178,44,195,90,75,89,150,0,220,239,119,128,208,237,229,106,137,136,176,92,173,16,17,222,202,50,148,
+  252,250,103,122,213,190,0,151,85,237,38,182,108,181,11,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Storage2x[1155] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,4,58,73,68,65,84,88,133,237,150,205,111,19,
+  71,24,198,127,179,179,142,13,246,218,106,10,84,178,235,40,109,168,65,9,183,72,233,1,132,34,34,66,168,148,68,21,
+  73,15,136,22,42,40,253,27,122,203,173,7,114,234,173,103,206,61,115,203,63,64,47,112,43,92,138,20,33,20,36,99,
+  217,187,235,253,240,204,244,146,157,174,191,128,74,220,202,43,189,154,143,29,189,207,51,207,59,243,206,194,71,251,191,155,
+  152,52,185,187,187,123,214,24,243,123,161,80,88,149,82,58,255,53,168,49,198,246,149,82,42,77,211,63,194,48,252,225,
+  209,163,71,241,232,90,119,82,0,173,245,111,183,110,221,186,178,185,185,137,227,56,54,224,164,54,243,209,113,206,229,195,
+  135,15,191,59,56,56,248,19,120,240,78,2,119,238,220,41,249,190,255,245,250,250,58,157,78,135,32,8,16,66,32,132,
+  120,43,208,180,249,74,165,194,245,235,215,57,56,56,184,7,236,3,38,143,55,38,111,175,215,251,118,109,109,109,86,74,
+  73,28,199,20,139,69,0,132,16,184,174,59,228,142,227,88,114,66,8,164,148,118,14,160,84,42,17,199,49,181,90,141,
+  165,165,165,214,206,206,206,149,81,188,73,249,189,187,177,177,129,239,251,164,105,74,154,166,22,48,11,108,140,65,107,141,
+  214,26,99,12,82,74,92,215,181,109,230,113,28,147,36,9,65,16,112,245,234,85,140,49,63,191,149,192,141,27,55,190,
+  60,115,230,204,149,70,163,65,16,4,67,192,25,160,82,10,165,20,90,107,171,74,182,235,209,148,100,138,244,251,125,90,
+  173,22,149,74,101,123,107,107,235,179,169,4,132,16,247,118,118,118,68,24,134,86,246,60,104,230,198,152,33,201,129,33,
+  69,242,158,17,75,211,148,181,181,181,153,66,161,240,227,68,2,171,171,171,174,16,226,246,242,242,50,190,239,227,186,46,
+  198,152,49,112,0,199,113,144,82,90,130,121,192,108,60,4,226,56,132,97,200,202,202,10,192,253,189,189,61,103,140,192,
+  236,236,236,55,151,46,93,170,23,10,5,162,40,194,113,28,187,171,44,104,6,156,223,245,232,121,24,189,170,66,8,138,
+  197,34,105,154,226,121,30,23,46,92,248,226,201,147,39,235,99,4,132,16,63,93,187,118,141,110,183,107,3,100,36,178,
+  124,230,119,253,54,240,188,205,204,204,216,126,191,223,231,242,229,203,72,41,239,15,17,216,218,218,170,159,58,117,106,163,
+  217,108,18,4,1,198,24,130,32,192,113,28,202,229,178,61,136,121,192,81,117,38,201,94,46,151,145,82,226,251,62,0,
+  113,28,179,176,176,64,181,90,221,220,221,221,109,88,2,174,235,222,222,222,222,118,195,48,28,42,56,65,16,16,199,49,
+  39,79,158,228,196,137,19,184,174,107,213,201,192,243,114,75,41,41,22,139,84,42,21,42,149,10,253,126,223,42,154,125,
+  87,74,113,241,226,69,87,107,125,215,18,16,66,220,92,94,94,38,12,67,234,245,58,158,231,217,93,69,81,68,187,221,
+  166,215,235,161,148,178,0,158,231,81,173,86,173,215,106,53,74,165,18,0,189,94,143,118,187,77,28,199,54,142,231,121,
+  204,205,205,161,148,98,101,101,5,215,117,191,135,127,75,241,87,158,231,209,235,245,120,249,242,37,90,107,123,208,50,203,
+  110,65,20,69,99,121,206,171,144,181,163,111,136,239,251,4,65,128,214,154,211,167,79,163,181,62,155,39,80,76,146,100,
+  172,218,141,182,249,60,79,123,160,242,107,71,191,101,41,123,245,234,149,237,219,199,104,48,24,240,236,217,179,177,0,147,
+  138,203,164,185,247,93,11,80,175,215,45,89,171,115,198,8,224,241,227,199,60,125,250,148,231,207,159,115,120,120,200,209,
+  209,145,125,25,227,56,30,170,134,89,224,118,187,77,179,217,164,211,233,208,108,54,121,243,230,13,115,115,115,116,58,29,
+  230,231,231,109,59,138,101,9,228,229,146,82,78,204,243,52,249,39,125,155,150,14,192,86,212,169,10,20,139,197,177,67,
+  56,141,200,180,2,52,109,126,20,203,158,129,140,149,49,134,197,197,69,148,82,184,174,75,146,36,86,114,165,20,66,8,
+  59,126,31,50,163,115,66,8,6,131,1,128,182,4,140,49,127,191,120,241,98,254,220,185,115,99,229,117,82,229,155,228,
+  141,70,3,173,53,139,139,139,36,73,194,249,243,231,137,162,136,86,171,69,16,4,44,44,44,208,237,118,169,213,106,217,
+  85,255,11,40,185,0,97,24,254,178,191,191,255,192,113,156,207,223,169,251,7,48,165,212,225,209,209,209,175,192,76,246,
+  87,92,2,62,5,62,1,170,192,12,80,248,192,184,9,32,129,8,232,2,175,129,215,249,223,114,1,148,143,189,116,188,
+  248,67,218,224,216,35,192,63,38,244,209,62,26,255,0,149,96,129,13,164,124,187,62,0,0,0,0,73,69,78,68,174,
+  66,96,130,
+};
+const unsigned char Tape1x[403] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,9,112,72,89,115,0,0,11,19,0,0,11,19,1,0,154,156,24,0,0,0,1,115,82,71,66,0,174,
+  206,28,233,0,0,0,4,103,65,77,65,0,0,177,143,11,252,97,5,0,0,1,40,73,68,65,84,120,1,221,82,59,
+  78,195,64,16,157,153,93,76,202,28,193,220,32,220,192,169,19,20,124,2,112,109,144,72,133,68,19,209,4,82,225,6,
+  81,18,78,0,5,18,101,114,4,223,0,31,33,21,8,127,102,152,32,89,178,55,40,18,37,121,205,206,206,188,183,111,
+  102,180,0,255,30,88,7,87,247,175,2,127,192,52,30,254,104,109,51,41,72,1,136,204,53,76,181,154,58,154,158,0,
+  247,0,205,41,10,47,235,100,235,1,242,36,43,63,57,34,194,137,182,19,184,174,156,151,125,232,88,48,141,94,173,75,
+  154,157,31,45,47,30,159,211,36,10,87,117,78,239,221,245,153,196,225,234,242,225,205,111,242,91,59,192,125,244,249,139,
+  35,4,156,0,74,86,161,58,66,71,29,121,161,163,249,34,48,102,99,94,12,87,239,245,14,200,237,128,0,71,149,224,
+  177,8,102,134,189,145,41,56,80,97,74,204,161,150,79,92,254,198,8,44,240,100,81,230,42,130,170,200,35,227,121,93,
+  2,185,19,162,64,0,147,77,67,7,55,103,195,68,137,253,143,162,56,152,141,195,108,26,15,210,50,55,135,235,220,109,
+  60,184,118,249,237,29,176,244,173,45,51,216,130,178,180,190,16,46,126,255,7,90,40,120,15,182,130,96,215,240,13,101,
+  255,122,237,68,126,124,225,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Tape2x[664] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,9,112,72,89,115,0,0,11,19,0,0,11,19,1,0,154,156,24,0,0,0,1,115,82,71,66,0,174,
+  206,28,233,0,0,0,4,103,65,77,65,0,0,177,143,11,252,97,5,0,0,2,45,73,68,65,84,120,1,237,85,205,
+  142,18,65,16,174,154,129,141,97,61,224,27,192,27,240,8,123,85,48,44,79,32,155,120,113,197,56,156,54,192,97,225,
+  128,132,211,78,2,163,71,227,19,56,6,86,143,226,19,192,27,236,248,4,114,80,212,193,233,178,122,126,192,221,136,51,
+  35,108,214,196,249,146,73,79,87,87,87,125,93,93,85,13,144,32,193,255,14,188,42,104,26,99,130,107,196,179,199,165,
+  75,62,21,184,97,164,54,45,16,41,85,166,103,41,36,76,14,73,150,191,9,160,210,134,40,32,209,230,99,30,16,16,
+  239,87,52,233,133,28,50,99,17,80,110,209,164,251,176,248,177,49,28,119,16,225,76,26,100,86,26,2,205,33,204,191,
+  212,117,127,176,221,173,21,223,156,188,120,151,83,193,129,88,4,2,244,106,37,189,97,140,203,46,1,160,195,168,9,66,
+  128,102,175,86,124,21,166,23,74,64,66,216,234,145,186,39,30,64,12,8,219,14,117,30,153,64,191,126,215,226,161,3,
+  215,128,72,4,36,180,151,175,179,153,197,94,206,81,236,121,255,81,197,218,164,179,255,57,85,248,114,251,199,76,63,170,
+  132,230,138,68,164,50,108,13,199,218,254,34,125,193,55,59,85,69,250,130,19,243,236,170,78,211,24,233,153,69,250,19,
+  41,248,62,243,53,53,109,12,70,237,40,182,67,9,52,141,243,2,113,21,200,82,12,100,92,21,26,203,79,131,121,195,
+  144,206,240,233,106,19,97,14,21,60,61,25,140,14,194,236,135,18,64,36,63,249,208,92,216,203,59,236,92,247,230,162,
+  186,54,130,101,57,58,128,154,99,171,121,183,103,72,185,234,201,183,34,64,132,254,201,105,174,215,43,115,36,180,124,249,
+  234,142,185,228,178,254,143,37,19,22,209,91,67,90,71,237,175,9,56,66,4,229,84,229,119,98,42,128,220,8,112,36,
+  102,129,14,71,201,237,114,42,143,82,135,217,29,122,36,189,72,108,69,160,255,228,254,100,29,118,40,184,134,1,102,142,
+  189,92,149,101,234,251,178,195,81,176,46,233,240,30,110,98,187,105,68,221,227,82,189,241,252,173,137,14,21,72,197,89,
+  239,248,222,135,95,215,59,117,183,228,242,173,225,121,153,79,157,251,157,206,86,4,36,124,131,127,52,42,251,62,196,196,
+  191,251,28,195,55,40,180,6,163,60,236,0,180,20,57,80,33,30,1,146,153,141,8,187,193,230,55,244,198,175,32,65,
+  130,4,63,1,14,152,215,207,251,210,128,127,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+}
+namespace Edit {
+const unsigned char Clear1x[773] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,2,151,73,68,65,84,56,141,
+  149,146,75,104,148,103,20,134,159,239,155,153,232,76,18,155,219,72,66,147,72,188,213,168,20,43,38,139,10,210,130,139,
+  74,75,118,130,151,133,139,209,141,130,34,252,11,5,93,24,23,6,28,144,82,16,132,142,198,133,96,75,117,161,11,233,
+  141,22,49,45,180,105,52,49,138,49,141,154,113,70,73,147,201,101,204,63,243,79,254,255,251,142,43,69,99,33,248,172,
+  207,251,112,206,203,81,71,190,96,115,56,196,5,17,162,198,178,247,212,13,249,145,247,64,135,52,223,175,109,142,173,218,
+  176,162,188,49,164,185,122,116,155,218,250,94,2,96,113,69,84,179,180,42,194,199,45,177,88,72,115,246,244,126,165,83,
+  73,213,153,74,170,218,5,5,86,232,28,124,82,116,125,35,212,215,148,17,93,172,234,171,26,233,5,142,3,75,23,20,
+  136,240,141,235,153,139,183,6,243,238,76,201,167,169,157,202,149,173,27,55,196,227,77,47,128,186,133,4,74,68,0,232,
+  218,167,78,196,87,114,252,147,182,207,85,115,75,59,61,167,187,189,233,127,198,114,236,84,147,198,200,37,17,206,39,28,
+  25,255,95,65,42,169,118,105,173,190,253,116,115,71,180,174,174,129,127,191,254,155,167,87,31,178,254,236,118,106,215,85,
+  145,30,237,247,238,223,253,67,140,245,190,51,70,142,37,28,201,206,23,236,209,154,100,83,125,107,57,151,36,106,38,93,
+  182,116,111,101,81,141,6,21,133,80,53,126,80,206,189,193,95,253,129,254,223,13,226,255,96,12,41,224,230,235,19,82,
+  73,181,40,114,142,59,21,205,181,171,58,46,31,14,105,253,28,66,13,96,198,192,100,177,65,30,207,182,224,205,213,144,
+  201,12,200,227,145,1,119,106,50,91,212,175,86,73,56,82,242,119,211,85,123,176,177,164,35,101,96,103,33,24,1,147,
+  5,243,31,94,225,25,179,185,235,204,140,157,35,94,141,218,212,254,85,133,86,74,194,111,53,82,193,207,217,76,90,91,
+  171,80,254,8,34,62,254,156,135,87,154,165,88,152,161,80,152,70,68,208,225,74,210,79,122,3,148,252,166,223,204,39,
+  28,121,230,207,77,143,164,211,119,153,113,99,76,76,140,146,203,165,153,204,101,112,221,41,68,132,88,245,54,10,69,205,
+  208,131,254,146,49,56,111,9,0,2,35,135,250,122,127,41,250,172,198,117,61,138,197,60,214,6,232,112,13,149,241,29,
+  228,221,152,220,186,121,37,111,76,240,101,194,145,204,235,18,223,164,251,140,234,89,253,81,123,219,242,21,173,17,47,255,
+  39,101,177,53,232,200,50,30,13,247,4,67,67,125,227,214,242,89,194,145,135,0,225,119,210,128,49,116,12,61,248,235,
+  118,229,146,134,15,63,168,106,211,163,163,247,252,225,225,159,2,107,188,235,214,114,32,225,200,196,59,159,56,159,84,82,
+  45,83,138,62,165,16,224,154,181,156,76,56,242,120,254,220,75,126,7,67,8,40,132,18,218,0,0,0,0,73,69,78,
+  68,174,66,96,130,
+};
+const unsigned char Clear2x[1682] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,6,73,73,68,65,84,88,133,181,213,125,108,93,
+  117,29,199,241,247,57,247,220,199,246,222,219,118,109,215,173,118,237,186,149,135,181,133,217,177,177,141,61,176,17,16,204,
+  136,137,147,177,100,86,83,54,106,226,3,49,232,98,68,209,9,70,13,160,24,216,50,21,18,202,64,99,218,49,19,148,
+  2,219,68,93,93,217,68,217,67,87,186,167,146,62,220,199,222,182,247,225,220,199,243,232,31,222,226,157,148,116,118,235,
+  55,249,230,228,119,114,114,206,235,247,57,191,115,126,2,5,245,220,125,216,41,179,188,100,194,125,152,104,2,102,55,170,
+  241,237,71,186,136,48,71,37,20,14,158,223,33,253,164,230,134,91,30,109,185,231,107,246,92,38,129,111,224,152,118,246,
+  248,235,35,186,170,55,61,218,69,102,46,0,210,149,28,243,75,183,220,217,102,63,114,224,187,40,170,70,73,69,141,180,
+  176,190,113,97,224,195,254,86,208,127,51,23,0,177,112,96,24,166,87,142,6,177,184,202,120,240,169,139,200,209,49,234,
+  27,215,59,4,129,31,238,217,115,229,181,115,2,16,17,222,77,199,124,166,161,164,57,248,88,51,18,57,42,107,155,240,
+  148,86,122,61,23,45,247,207,5,192,82,56,184,183,217,252,32,52,124,161,245,238,29,143,91,93,70,4,183,17,4,12,
+  138,189,149,182,176,255,242,210,55,207,154,47,204,41,224,173,62,130,159,105,50,132,9,255,249,213,77,27,91,173,169,80,
+  31,217,232,16,165,139,150,51,124,249,131,210,187,110,214,186,15,159,35,116,61,1,31,123,175,209,6,227,167,147,161,145,
+  115,23,78,30,210,74,22,175,67,83,50,200,193,1,22,84,85,217,156,14,225,7,239,254,214,254,252,223,59,48,59,59,
+  175,196,207,182,132,233,78,254,124,59,53,22,139,165,191,229,246,141,110,51,51,78,58,30,194,86,33,98,43,153,96,65,
+  195,122,37,50,242,15,139,145,78,46,185,99,23,195,115,2,0,248,229,131,150,7,172,14,235,75,55,223,186,176,200,94,
+  26,196,61,175,134,250,21,173,64,25,175,180,127,95,185,112,56,150,80,85,179,125,31,252,97,78,0,189,175,176,52,35,
+  11,199,139,188,222,202,134,149,95,192,91,177,140,19,175,246,240,198,158,163,212,57,139,88,96,136,28,9,4,100,13,106,
+  247,67,116,182,0,105,186,147,61,29,124,203,48,196,103,22,222,116,163,94,185,232,54,130,125,97,246,239,126,13,41,97,
+  210,222,178,26,175,40,226,243,249,112,132,195,98,90,215,91,128,63,207,22,48,109,2,199,14,176,81,52,56,34,8,213,
+  198,251,29,154,125,228,196,56,107,28,110,86,214,47,161,180,170,138,247,2,126,254,56,208,71,205,109,166,190,234,97,6,
+  76,195,248,206,186,54,186,175,27,0,224,196,171,120,186,218,9,213,231,112,46,211,193,83,82,130,236,245,242,183,68,4,
+  235,124,193,220,182,175,93,88,188,162,142,88,100,144,225,115,175,167,179,242,208,65,175,131,135,27,183,161,92,23,0,192,
+  35,48,180,14,106,221,192,89,135,200,184,13,182,252,120,11,235,119,182,99,230,122,33,247,62,138,110,69,49,26,9,14,
+  246,102,39,125,199,206,228,52,238,221,212,70,236,186,0,190,2,159,181,11,116,9,86,156,159,222,90,204,246,103,159,16,
+  108,118,21,211,136,163,101,199,176,8,227,232,186,31,57,145,194,176,173,33,25,79,171,161,129,206,81,12,125,195,218,47,
+  227,191,102,64,30,209,176,245,23,60,209,184,233,254,237,243,171,171,64,11,163,83,74,38,149,196,238,80,209,179,126,20,
+  45,65,44,26,197,230,94,135,40,46,49,134,207,252,106,194,204,165,54,172,109,227,252,76,247,159,113,135,251,53,92,42,
+  154,71,82,51,84,20,53,5,70,12,37,29,196,110,19,72,140,135,65,144,208,114,6,118,135,151,88,160,27,77,27,16,
+  235,87,61,86,46,57,203,79,246,28,224,246,107,6,0,96,224,87,51,113,67,85,65,211,100,116,117,18,65,72,98,104,
+  57,178,169,52,74,86,199,212,51,20,121,235,153,28,121,155,108,162,71,168,95,253,184,167,200,221,240,206,241,151,249,226,
+  53,3,12,129,15,211,137,72,86,211,236,164,146,9,16,50,164,19,65,74,202,139,137,4,130,184,60,94,146,49,13,132,
+  8,238,138,102,38,134,143,18,15,117,82,183,114,183,171,164,122,243,11,189,7,120,177,183,19,231,172,1,2,252,43,35,
+  135,117,67,240,144,146,19,24,134,66,34,58,142,69,82,40,42,113,19,30,245,225,242,84,35,71,82,152,218,40,101,53,
+  107,137,250,254,201,216,224,126,22,222,244,128,163,250,214,111,182,138,90,241,200,241,14,182,206,10,112,199,16,3,90,78,
+  22,52,53,69,78,181,161,228,146,40,74,142,100,60,74,105,85,29,137,9,25,139,148,67,148,170,73,199,38,49,244,81,
+  42,151,222,73,106,124,144,145,211,63,195,93,214,96,187,97,253,115,229,162,205,123,176,167,131,246,194,123,95,213,150,250,
+  163,191,98,238,252,60,45,54,151,103,153,40,21,161,164,71,17,68,137,180,156,198,233,46,198,238,90,68,120,168,159,138,
+  186,102,162,254,8,130,101,28,171,195,139,103,254,114,76,205,74,224,194,33,82,227,103,148,100,98,116,239,87,159,225,233,
+  72,4,227,255,74,0,144,98,113,94,142,5,251,101,167,187,137,148,172,98,181,219,136,79,100,200,36,252,20,151,215,131,
+  88,76,42,122,145,121,139,87,33,143,9,168,153,48,46,207,26,138,43,150,163,103,227,185,160,175,191,99,211,67,60,217,
+  223,143,19,112,2,54,64,184,154,4,172,128,173,187,23,255,182,205,233,93,158,202,6,183,97,120,81,149,203,88,29,117,
+  200,19,1,28,30,15,78,79,45,161,193,211,148,85,55,224,240,52,19,29,189,76,42,126,94,9,93,122,51,254,151,147,
+  250,67,59,247,208,153,159,176,80,216,51,1,44,121,128,53,155,69,186,103,53,178,195,18,221,80,81,187,197,154,24,59,
+  133,187,162,150,88,32,132,40,37,113,149,46,199,196,129,146,210,177,57,75,140,120,232,180,22,10,70,122,191,241,20,187,
+  186,14,227,43,120,104,97,153,51,253,9,165,124,84,86,192,230,116,98,123,107,47,239,124,170,113,243,82,201,190,66,52,
+  245,83,72,214,26,70,251,187,168,107,249,58,233,248,160,30,26,56,36,78,200,250,123,191,251,19,123,127,255,54,151,0,
+  21,80,62,233,56,19,224,163,4,166,32,187,219,184,241,115,27,133,238,234,198,29,174,108,50,133,213,150,54,38,125,167,
+  212,108,58,66,96,204,124,163,235,40,7,95,59,194,48,160,3,90,190,213,255,233,41,128,58,227,94,144,79,193,90,208,
+  210,190,239,177,185,121,9,79,234,38,70,60,193,137,211,23,57,252,244,139,244,165,84,204,169,104,243,173,79,3,41,4,
+  229,174,6,0,255,121,119,31,1,242,109,41,104,145,255,46,176,66,128,145,239,41,196,212,81,201,247,140,107,96,186,178,
+  20,32,196,252,88,224,227,159,116,33,98,106,214,83,137,92,49,179,107,173,194,213,93,152,64,33,226,19,235,223,52,193,
+  219,4,57,147,41,1,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Copy1x[498] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,10,26,20,8,47,131,20,52,155,0,0,1,127,73,
+  68,65,84,56,203,149,147,75,75,2,81,24,134,223,35,51,99,218,128,253,10,207,8,221,22,253,143,8,90,182,136,160,
+  117,23,240,66,182,176,69,145,118,219,68,68,68,27,177,54,5,254,4,49,179,54,129,101,48,163,191,160,154,48,5,55,
+  205,237,180,105,116,70,71,177,111,245,157,195,121,31,222,247,227,59,228,232,36,51,175,235,250,44,70,40,193,207,189,109,
+  174,197,239,156,119,156,97,24,211,241,232,214,40,122,164,15,246,38,1,184,1,118,211,106,53,193,24,235,19,17,66,0,
+  0,161,208,132,39,148,115,30,106,181,26,94,171,149,133,198,119,99,102,144,139,253,204,110,202,238,121,158,191,117,1,36,
+  73,66,177,84,152,250,71,164,69,23,64,81,148,78,140,86,171,57,84,108,71,114,1,40,165,40,150,10,157,179,44,203,
+  158,226,72,36,210,63,3,198,24,100,89,118,13,210,249,112,80,185,0,148,82,148,202,197,161,14,122,161,156,45,182,44,
+  6,69,25,205,65,48,56,142,118,187,221,5,232,186,14,198,24,194,97,138,242,83,105,168,3,74,37,152,166,129,202,75,
+  165,11,208,180,31,4,2,99,176,44,54,212,238,229,213,5,30,30,239,221,17,4,158,175,158,157,159,186,22,135,49,203,
+  211,182,40,138,88,89,94,133,101,153,80,191,84,228,174,179,224,54,214,163,121,0,121,199,114,108,27,134,225,235,21,59,
+  75,85,85,228,110,178,0,240,236,243,26,146,166,233,240,251,253,16,4,1,162,40,130,16,130,122,189,14,128,224,227,243,
+  221,22,167,18,177,228,28,233,21,31,30,167,179,166,105,46,121,125,172,191,42,0,40,36,98,201,29,0,248,5,66,89,
+  166,3,21,136,247,216,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Copy2x[723] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,2,138,73,68,65,84,88,133,205,151,77,107,19,
+  65,24,199,255,207,206,238,154,120,73,14,150,126,130,100,139,18,191,129,224,65,164,167,28,252,14,61,232,45,132,70,145,
+  130,39,75,27,209,130,248,130,120,240,164,130,87,239,82,45,197,163,162,30,2,106,85,132,134,234,33,73,217,164,75,94,
+  102,60,196,221,236,44,59,251,162,27,244,129,144,153,157,217,249,255,230,255,60,179,217,0,255,56,8,0,182,182,154,23,
+  157,225,104,49,203,133,77,211,248,89,175,53,238,198,205,211,1,192,25,142,22,175,52,174,102,169,143,141,230,250,66,146,
+  121,186,191,211,237,118,51,17,47,22,139,137,231,106,153,40,254,69,232,241,83,146,7,231,124,62,0,79,159,61,190,116,
+  216,235,37,202,169,27,68,192,70,243,250,53,213,184,97,24,239,235,181,198,233,80,128,86,171,37,245,15,123,189,133,203,
+  171,217,22,233,230,141,245,10,160,112,96,105,105,73,234,191,220,121,1,32,155,34,37,34,20,10,5,175,255,127,22,97,
+  48,5,89,133,16,34,25,128,42,5,89,8,7,33,34,79,129,234,88,165,113,200,21,20,66,160,84,42,65,215,101,73,
+  101,10,162,206,116,208,161,40,225,32,68,172,3,156,115,148,203,101,233,218,206,238,118,172,96,156,112,216,120,40,64,16,
+  38,44,84,41,136,18,180,44,43,244,30,9,192,21,76,155,130,168,93,7,199,136,72,13,224,66,4,83,176,251,250,85,
+  40,72,82,187,231,146,130,164,130,192,212,126,21,132,7,192,57,247,4,163,236,23,66,120,249,140,179,219,253,246,183,137,
+  72,90,95,2,72,34,158,68,48,110,126,36,128,63,130,215,220,5,84,41,136,131,177,44,11,68,148,77,10,254,164,0,
+  25,99,234,39,97,214,41,240,143,105,154,6,198,152,7,160,105,179,31,97,9,32,151,203,73,16,254,137,193,98,74,178,
+  123,34,146,132,221,246,126,123,31,2,98,6,96,154,198,193,157,123,183,149,255,11,136,102,80,105,236,38,34,60,124,244,
+  0,166,105,2,0,76,195,196,112,52,68,62,151,159,46,234,2,212,107,141,251,42,113,96,250,110,199,57,87,218,28,101,
+  55,0,156,59,123,30,238,253,142,227,224,237,187,55,32,208,19,15,32,73,132,1,248,219,42,187,25,99,224,156,163,211,
+  233,64,8,129,79,123,31,97,31,217,61,167,63,92,73,13,160,218,181,74,88,215,117,112,206,49,24,12,96,219,54,190,
+  125,255,138,193,145,221,57,89,169,156,169,46,87,7,169,0,38,147,9,242,249,188,84,140,68,4,34,130,166,105,210,135,
+  49,6,33,4,250,125,27,0,176,247,229,51,218,63,218,2,2,219,199,78,28,191,80,93,174,122,111,183,20,46,39,199,
+  205,91,155,31,70,227,241,169,164,176,110,136,223,181,174,49,118,48,230,147,149,181,213,181,231,105,215,152,123,252,2,86,
+  84,12,239,30,77,244,187,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Cut1x[807] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,10,28,22,29,49,104,65,100,94,0,0,2,180,73,
+  68,65,84,56,203,133,147,93,72,147,81,24,199,159,115,222,119,175,175,219,212,125,165,219,108,248,21,104,120,209,85,16,
+  116,97,148,73,87,69,222,100,34,17,104,105,150,88,168,105,129,144,4,149,165,125,129,136,16,148,24,232,16,244,74,144,
+  36,186,12,2,181,48,109,51,54,242,99,239,54,117,155,238,117,95,239,118,206,219,77,206,97,90,231,238,252,255,15,63,
+  254,207,243,156,131,32,229,60,235,125,114,14,0,222,243,60,239,109,186,121,187,116,143,215,207,178,236,165,59,205,173,186,
+  84,29,167,94,24,134,25,187,213,216,172,141,70,163,203,125,253,175,59,83,61,5,171,184,112,230,116,185,230,197,171,158,
+  79,7,2,8,33,252,79,135,29,215,213,214,87,16,66,142,237,232,79,123,30,151,153,115,205,166,237,144,136,40,165,39,
+  14,4,96,140,67,75,75,191,128,79,75,67,177,88,172,116,39,5,203,178,83,133,133,133,224,113,123,40,165,212,241,175,
+  4,21,54,155,13,86,93,43,168,174,182,190,56,145,72,156,234,121,222,61,80,82,82,162,64,128,193,225,116,0,0,88,
+  15,4,220,109,189,247,25,99,188,188,184,104,7,62,141,71,146,36,29,215,235,244,215,100,10,176,190,177,70,1,96,162,
+  173,165,227,225,129,0,0,0,74,105,229,194,143,5,121,109,205,3,141,55,154,84,241,68,28,137,98,16,230,230,230,36,
+  0,232,218,91,255,23,160,173,165,99,26,99,60,100,95,180,209,96,112,11,107,52,26,16,220,130,44,203,242,187,182,150,
+  142,233,255,2,254,164,152,154,157,153,198,78,167,3,210,57,30,50,223,14,70,16,66,111,246,171,69,123,133,49,163,177,
+  151,80,122,61,190,185,169,38,229,101,50,51,249,17,21,24,115,64,32,116,11,33,52,80,233,241,180,239,11,24,51,153,
+  58,227,126,255,131,163,38,19,36,40,69,222,173,77,217,23,222,30,102,101,84,85,144,157,195,240,28,71,37,89,6,231,
+  250,58,40,178,178,174,86,186,221,67,201,22,198,205,230,26,201,231,235,42,54,26,233,194,202,202,84,48,18,150,2,65,
+  17,215,196,105,77,148,35,58,150,193,52,16,18,19,142,213,213,15,71,244,122,18,243,249,6,199,205,230,221,151,58,106,
+  48,8,243,69,69,100,132,97,238,3,0,204,88,44,33,171,82,153,216,241,71,24,134,124,201,53,7,1,0,134,49,110,
+  255,150,159,79,70,13,6,97,119,136,177,152,94,146,36,82,69,200,163,9,149,234,165,130,101,121,132,177,61,57,105,142,
+  155,81,243,233,170,201,140,140,190,203,148,118,131,44,83,32,196,176,11,224,56,65,173,84,50,95,243,242,98,38,157,174,
+  105,94,16,188,138,204,204,43,201,143,164,213,54,124,119,185,54,14,31,58,212,48,107,177,196,8,165,24,48,14,0,0,
+  48,0,0,213,90,173,207,229,247,159,244,75,18,27,0,144,57,181,250,236,69,65,72,238,220,42,138,238,234,236,108,143,
+  55,16,200,241,135,195,26,95,36,226,83,168,84,231,173,162,232,254,13,160,243,58,7,220,52,193,60,0,0,0,0,73,
+  69,78,68,174,66,96,130,
+};
+const unsigned char Cut2x[2087] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,7,222,73,68,65,84,88,133,173,151,123,108,20,
+  199,29,199,191,51,59,183,119,183,119,231,59,227,183,77,252,136,13,152,98,140,2,177,17,52,16,48,143,166,85,162,182,
+  127,212,17,36,45,85,19,176,42,148,170,34,1,108,55,68,151,64,169,29,67,77,155,166,141,251,84,74,147,54,52,81,
+  136,212,170,34,96,16,161,64,138,129,6,48,88,54,196,6,191,176,207,216,24,223,237,61,118,119,102,250,135,57,100,30,
+  118,108,165,63,233,167,93,237,252,230,251,251,236,204,254,102,102,9,38,176,159,239,217,181,221,48,98,47,71,195,166,199,
+  239,247,135,38,138,189,215,118,215,215,214,155,166,245,99,149,57,181,77,155,54,69,198,139,163,227,53,212,214,214,102,114,
+  193,55,165,165,166,197,60,94,231,171,83,73,94,83,243,218,92,128,86,164,164,164,198,4,172,23,39,138,29,23,192,166,
+  210,119,23,150,44,84,87,173,92,109,7,200,15,119,238,218,89,56,153,228,82,74,162,218,157,123,23,47,250,170,125,245,
+  202,175,217,21,74,183,78,212,247,129,0,53,53,59,22,219,84,219,130,25,5,51,153,148,4,139,22,46,178,59,108,234,
+  219,147,1,168,219,93,179,222,227,241,228,231,100,231,80,33,36,74,75,75,53,39,83,107,167,4,0,74,231,101,101,78,
+  87,56,231,144,82,34,55,247,97,234,112,56,230,212,238,250,217,51,19,37,223,185,115,103,10,165,116,87,217,242,149,110,
+  195,48,33,165,68,122,122,38,149,82,150,76,9,64,0,231,63,111,191,162,72,72,0,128,105,90,88,85,182,210,165,16,
+  250,134,255,151,254,132,241,196,156,154,250,198,156,175,20,169,140,217,32,165,4,165,20,103,206,54,69,56,231,39,167,4,
+  80,189,165,250,56,64,234,79,156,56,30,166,148,66,74,9,135,67,67,65,65,129,195,195,93,53,15,234,83,179,107,199,
+  82,66,201,83,115,139,138,237,156,115,0,128,174,7,209,217,217,165,235,161,232,186,41,1,0,128,30,140,188,214,213,221,
+  21,10,6,111,129,16,2,206,5,74,30,45,117,82,138,117,117,117,63,45,30,27,219,208,208,96,83,21,251,159,203,150,
+  173,208,76,211,2,0,168,170,13,141,71,26,117,110,90,235,39,42,225,113,1,252,126,127,216,226,198,134,198,195,135,116,
+  85,29,29,82,195,48,241,216,226,165,14,197,166,190,45,165,36,241,216,80,104,184,50,53,45,53,217,231,155,6,33,4,
+  8,33,184,124,185,205,138,25,209,83,91,183,86,239,31,47,199,132,0,0,80,185,249,229,143,12,195,104,106,187,220,106,
+  17,66,32,37,144,145,145,69,61,110,79,65,93,93,205,58,0,168,171,219,158,7,138,202,165,143,45,119,25,134,1,41,
+  37,20,133,160,233,108,147,97,68,248,15,38,210,255,66,0,0,136,69,173,231,78,159,105,50,24,99,144,82,34,22,139,
+  97,69,217,42,55,101,228,23,245,245,126,31,179,57,255,88,90,178,72,53,205,209,175,222,110,183,227,147,127,31,213,169,
+  68,77,85,85,213,213,47,13,80,85,85,213,46,165,216,115,252,196,177,112,124,42,8,161,152,61,187,72,229,82,251,64,
+  117,216,75,114,115,242,88,124,232,135,111,13,33,16,8,12,186,221,190,7,126,172,83,6,0,128,208,72,116,123,119,79,
+  103,48,20,10,2,0,44,203,194,188,185,243,28,138,66,151,151,44,40,117,69,34,17,72,41,161,105,26,14,31,105,212,
+  45,195,252,94,69,69,133,249,127,3,240,251,253,81,211,178,158,107,60,114,72,215,52,13,82,74,68,34,81,44,91,90,
+  70,206,157,255,12,66,8,48,198,112,161,249,156,193,5,255,215,150,45,213,71,39,163,59,105,0,0,168,220,252,147,127,
+  26,166,249,233,149,207,219,44,198,24,46,95,105,69,98,98,34,84,85,197,213,107,29,80,152,130,11,205,23,98,220,208,
+  55,78,86,115,74,0,0,192,141,200,250,166,211,167,12,187,221,142,238,158,110,4,2,1,60,190,100,25,90,219,90,112,
+  168,241,128,206,5,175,220,188,217,31,152,138,166,50,149,224,131,7,143,12,63,153,157,241,252,160,20,137,101,43,158,64,
+  124,149,36,225,48,174,31,59,106,186,15,28,46,255,199,245,235,98,42,154,108,42,193,111,105,120,212,246,209,251,121,131,
+  121,249,56,123,230,20,172,63,53,32,114,233,34,98,131,55,224,52,98,46,120,124,175,0,216,54,21,77,242,197,33,163,
+  214,0,216,152,135,92,154,159,254,112,62,203,206,37,29,211,51,209,247,193,94,20,120,83,48,221,147,4,80,224,88,103,
+  107,88,112,57,107,125,4,221,95,26,224,29,32,17,148,110,100,148,174,229,66,76,39,4,42,101,10,43,202,201,83,92,
+  78,39,206,244,93,141,12,233,193,15,153,66,190,53,63,241,33,77,181,219,209,167,15,91,157,195,55,110,217,35,176,1,
+  160,84,81,186,44,203,250,27,19,226,87,229,192,208,164,1,222,1,190,67,40,253,67,138,207,199,178,82,83,157,94,151,
+  11,18,64,255,208,16,218,187,187,225,72,116,70,7,162,250,97,247,8,255,118,208,67,222,75,119,123,191,158,198,60,118,
+  183,166,161,121,168,7,171,139,74,64,0,220,28,25,65,71,79,79,164,103,96,192,2,231,207,175,5,246,125,33,192,95,
+  41,125,137,42,138,191,56,63,223,101,90,22,58,251,251,111,5,117,93,85,20,197,54,127,246,108,22,142,68,112,177,179,
+  163,95,137,89,89,229,0,127,51,5,110,103,140,126,146,239,77,157,231,130,141,82,135,13,237,157,61,35,66,8,146,148,
+  144,64,242,178,178,220,148,82,52,181,180,232,22,231,219,215,88,214,93,167,163,187,202,240,93,160,156,82,250,234,130,194,
+  66,87,103,127,127,248,98,123,123,215,205,96,240,251,138,16,73,17,110,86,95,106,111,71,90,82,18,164,41,18,202,1,
+  14,0,27,7,16,10,49,177,172,99,40,0,203,70,112,181,171,119,36,22,139,173,225,166,89,120,125,112,176,242,63,205,
+  205,55,175,245,245,69,23,23,23,187,24,165,219,254,162,40,79,63,16,96,31,224,37,148,254,174,120,198,12,173,163,183,
+  55,60,52,50,114,202,43,196,140,239,2,251,203,129,136,42,240,247,72,44,22,185,189,41,221,85,61,63,26,194,136,45,
+  34,185,203,229,130,97,154,140,0,103,214,0,189,207,2,111,42,66,228,245,6,2,109,87,186,186,98,37,115,230,184,24,
+  240,219,125,192,180,251,0,44,74,43,146,19,19,25,0,220,184,121,51,228,229,252,137,111,0,177,120,187,0,150,248,220,
+  110,51,168,235,96,140,117,220,59,117,76,97,29,46,197,14,143,166,89,2,88,22,127,94,14,220,82,132,88,218,27,8,
+  68,9,128,172,212,84,155,69,233,134,251,0,20,74,215,77,79,73,209,186,7,6,194,92,136,29,99,147,55,0,154,162,
+  40,175,207,204,201,73,232,236,235,139,10,206,247,222,11,32,56,223,219,213,215,23,205,205,200,72,80,40,221,221,0,104,
+  99,33,4,240,250,181,190,190,104,110,86,150,211,198,216,157,35,218,29,0,206,121,158,219,229,130,30,14,27,0,206,142,
+  77,238,101,236,227,140,148,20,175,170,170,232,14,4,76,67,136,223,220,11,160,8,241,235,158,64,192,84,85,21,73,62,
+  95,82,130,162,28,28,11,33,132,104,10,234,122,212,235,241,192,180,172,220,251,0,64,136,5,0,110,167,83,33,64,241,
+  11,64,194,239,129,181,30,69,105,207,72,78,126,100,78,65,129,243,228,185,115,250,16,176,105,29,32,1,36,1,72,142,
+  123,57,64,110,16,242,226,103,109,109,250,204,236,108,71,178,207,247,136,155,210,142,6,96,237,51,64,2,161,116,129,91,
+  211,108,148,82,16,224,206,114,125,167,12,223,99,236,195,153,57,57,223,156,230,245,146,83,205,205,186,197,185,146,224,118,
+  155,133,185,185,30,135,170,226,228,249,243,225,235,156,55,188,96,89,111,221,6,167,184,187,140,37,0,177,135,177,13,89,
+  148,86,204,159,53,75,139,154,38,218,123,122,130,65,93,87,25,99,98,197,194,133,206,225,145,17,121,186,165,229,192,211,
+  134,241,36,0,30,23,96,181,192,140,108,69,249,180,48,55,215,253,80,122,58,181,49,134,145,80,8,29,189,189,209,238,
+  64,128,183,72,233,223,46,196,199,0,108,24,221,67,226,174,96,180,36,173,184,87,83,186,178,8,216,150,153,154,170,228,
+  101,102,58,146,124,62,0,64,79,127,191,248,111,107,107,176,205,178,30,127,5,104,5,96,142,125,3,90,15,20,167,49,
+  182,27,163,127,50,148,80,218,55,196,249,254,247,133,216,123,4,8,222,78,22,119,50,198,229,24,231,0,248,18,192,83,
+  78,233,179,201,140,61,5,206,51,8,32,4,165,103,187,76,243,165,173,192,185,219,176,114,188,189,32,46,76,239,73,74,
+  31,224,192,232,156,202,49,87,126,251,62,62,50,98,76,219,93,246,63,75,63,123,197,52,72,87,169,0,0,0,0,73,
+  69,78,68,174,66,96,130,
+};
+const unsigned char Delete1x[680] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,141,0,142,0,139,33,244,163,126,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,214,6,19,15,29,9,72,179,203,198,0,0,0,15,116,
+  69,88,116,67,111,109,109,101,110,116,0,105,100,32,108,111,103,111,134,198,119,185,0,0,2,26,73,68,65,84,56,203,
+  165,144,191,79,19,113,24,198,159,251,165,119,45,180,165,215,214,90,42,20,162,12,180,14,110,110,80,40,131,236,154,56,
+  105,106,127,128,17,77,77,220,26,233,96,82,7,147,66,212,52,197,70,5,55,39,117,49,49,182,22,249,3,100,48,186,
+  181,139,169,24,19,56,174,114,87,238,122,119,14,114,23,67,137,81,124,167,247,251,230,121,62,239,251,124,9,236,213,226,
+  253,194,59,89,150,198,241,23,197,113,182,218,141,185,76,20,0,104,115,40,203,210,248,108,250,26,20,69,177,132,134,97,
+  116,153,13,195,192,147,229,178,181,136,14,77,231,231,1,228,0,29,146,36,65,16,132,46,163,249,102,24,6,36,73,2,
+  0,66,211,121,3,64,142,6,144,203,102,46,160,190,186,4,81,20,209,108,54,15,52,3,0,69,81,32,8,2,162,40,
+  34,155,73,225,78,225,121,206,138,240,177,209,130,32,8,104,52,26,127,140,96,106,135,199,246,34,152,195,186,28,68,252,
+  110,165,75,76,16,7,33,130,86,103,1,34,103,99,56,76,89,128,216,25,254,255,0,159,190,136,255,100,28,13,58,126,
+  69,12,157,203,215,64,96,236,80,235,13,172,90,95,52,119,253,170,113,249,82,92,125,84,46,41,147,147,83,204,218,218,
+  123,38,26,157,208,170,213,10,25,139,77,105,181,90,149,154,136,198,244,183,149,55,228,226,194,3,170,43,2,203,178,170,
+  218,81,183,121,175,71,107,181,126,16,67,161,225,94,93,55,228,193,193,33,90,211,116,201,225,112,248,105,134,217,228,56,
+  155,237,247,35,72,179,225,121,126,135,36,201,215,54,155,13,35,167,70,32,237,238,40,3,3,39,116,151,203,41,187,251,
+  220,109,0,136,132,195,71,189,94,175,218,5,40,44,220,43,1,208,34,225,211,23,125,30,223,177,141,111,95,125,0,100,
+  158,247,144,36,73,212,123,29,61,157,254,254,32,88,150,211,237,118,187,84,44,62,76,239,191,32,113,51,115,139,95,94,
+  121,172,3,248,188,181,181,41,240,110,222,239,114,58,233,93,165,205,172,175,127,56,9,0,43,207,158,58,211,169,217,182,
+  218,81,206,239,7,148,75,75,69,248,253,199,143,36,19,233,209,100,34,221,167,40,10,94,190,122,209,67,81,116,224,74,
+  60,73,164,146,51,68,32,16,152,185,61,159,253,206,178,220,134,9,248,9,228,204,195,8,165,247,44,101,0,0,0,0,
+  73,69,78,68,174,66,96,130,
+};
+const unsigned char Delete2x[2049] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,7,147,73,68,65,84,88,133,
+  197,87,91,136,93,87,25,254,254,117,219,151,179,207,57,115,102,78,51,151,36,77,38,147,180,182,209,166,22,196,22,131,
+  32,241,82,8,45,120,121,42,125,168,8,130,20,251,32,82,43,8,125,13,45,212,27,62,136,130,214,130,104,132,42,213,
+  228,65,176,182,182,181,72,105,83,219,166,65,51,201,76,154,100,46,205,153,57,115,230,156,125,246,117,173,223,135,153,9,
+  51,211,153,196,80,193,239,101,237,189,214,191,255,255,251,191,197,218,251,219,196,204,248,127,66,109,183,240,212,247,159,120,
+  179,40,203,67,255,139,34,82,202,153,111,127,235,59,59,111,136,0,136,198,31,254,198,35,80,74,225,70,85,218,28,255,
+  227,159,252,96,108,187,216,15,16,24,63,122,204,3,48,240,240,17,34,102,70,187,221,6,51,95,77,186,21,153,205,115,
+  204,12,34,2,17,161,209,104,172,229,221,3,96,102,234,196,99,197,182,4,38,238,123,226,123,32,122,92,10,81,20,214,
+  249,204,12,107,45,102,103,103,145,101,217,182,4,182,34,227,121,30,70,70,70,174,222,43,165,79,59,103,139,137,251,158,
+  120,244,220,31,31,253,217,90,60,173,5,140,31,61,54,38,132,56,119,215,61,135,125,109,12,246,247,79,226,161,7,31,
+  68,167,211,185,170,192,181,58,221,78,137,102,179,137,95,60,253,115,76,70,95,68,119,185,131,211,167,94,239,179,115,99,
+  83,39,30,235,108,86,224,193,225,209,81,23,85,124,100,133,67,28,199,104,181,90,232,116,58,104,181,90,87,21,216,220,
+  169,49,6,205,102,243,154,91,19,199,125,32,2,170,181,58,26,67,67,104,183,90,95,7,240,228,6,5,246,223,255,228,
+  212,221,247,124,114,175,14,35,76,191,243,10,246,203,127,194,51,6,236,220,53,37,191,30,164,148,176,214,226,212,226,46,
+  236,189,235,94,116,151,59,120,247,212,27,45,231,236,232,212,137,199,74,5,0,227,71,143,29,242,125,175,185,115,116,8,
+  151,90,9,138,172,143,23,38,151,0,16,132,16,0,8,36,4,64,4,2,1,36,86,100,39,2,109,121,189,121,78,34,
+  210,29,200,60,193,96,99,0,65,37,240,227,110,239,43,0,126,163,0,64,8,241,181,219,110,157,240,173,99,48,128,155,
+  239,56,130,155,239,56,242,161,58,95,131,233,119,112,251,139,79,99,223,171,39,129,151,126,137,115,119,127,25,253,143,126,
+  33,58,245,238,228,227,235,8,200,195,19,123,135,85,55,41,110,248,204,95,15,94,214,195,39,162,24,19,143,124,19,112,
+  14,213,55,222,193,66,179,134,83,224,189,227,71,143,141,40,0,112,236,170,134,44,22,23,90,232,37,197,245,114,226,70,
+  40,46,65,227,201,143,60,132,91,95,127,1,133,50,56,119,240,171,184,89,104,68,149,32,235,44,199,187,20,0,176,115,
+  203,231,47,204,240,193,125,195,68,20,108,95,152,1,6,131,29,195,241,10,21,231,86,231,152,193,12,184,213,145,153,225,
+  86,30,0,3,112,163,247,66,0,216,207,12,231,250,200,179,92,2,40,137,153,49,126,244,216,157,128,123,14,16,187,111,
+  160,185,15,7,230,223,79,157,252,238,151,174,30,195,7,30,184,191,121,231,199,15,63,117,232,208,199,14,189,253,206,219,
+  103,210,52,165,35,159,249,236,231,147,52,77,1,160,223,239,167,245,90,61,90,92,92,232,140,142,142,13,79,95,152,186,
+  228,121,190,105,54,155,131,90,105,53,55,63,183,80,22,133,29,104,52,170,141,129,70,125,110,126,246,74,28,199,105,24,
+  132,222,75,175,252,237,181,3,251,15,68,251,246,237,219,161,148,161,31,253,240,169,135,143,31,127,246,101,0,16,107,132,
+  202,210,79,123,113,183,0,96,108,89,42,2,68,94,20,165,179,206,173,190,241,200,58,203,245,122,61,210,90,235,34,47,
+  10,33,132,80,82,74,107,173,5,179,85,74,177,86,90,50,179,115,206,89,65,2,74,41,169,164,162,40,170,120,129,31,
+  120,214,22,5,192,201,90,93,177,78,148,36,238,197,185,49,134,140,167,115,109,116,46,133,132,16,196,66,8,39,132,112,
+  96,182,188,82,72,10,41,172,16,194,50,96,165,20,144,74,58,18,100,25,92,10,33,72,41,237,148,214,37,17,21,213,
+  90,212,175,215,235,101,88,9,93,89,150,61,64,127,144,192,241,227,199,109,63,137,99,99,12,41,165,115,165,84,238,7,
+  62,60,207,99,99,140,243,60,99,149,82,37,128,146,136,40,8,2,167,148,42,141,214,214,247,3,225,121,158,213,74,91,
+  165,84,225,121,30,249,190,207,70,107,43,149,42,140,49,153,231,121,206,24,131,44,207,98,231,92,186,149,2,40,138,162,
+  163,148,38,207,168,92,43,149,215,170,53,51,58,58,54,168,181,46,194,32,228,48,12,65,130,250,190,239,187,122,189,174,
+  194,32,176,82,202,172,86,171,25,99,76,25,85,35,210,74,229,97,24,98,176,49,232,51,115,95,43,149,5,190,159,6,
+  190,207,70,27,244,251,253,132,121,235,45,64,146,38,61,165,36,107,19,148,32,81,54,26,141,112,105,169,61,93,175,213,
+  84,165,82,193,142,29,195,131,23,166,167,206,248,190,143,198,64,67,7,65,224,140,49,5,17,186,97,16,186,90,173,174,
+  180,214,133,82,42,27,26,26,138,74,91,180,61,207,179,198,243,172,210,218,42,173,168,31,199,125,231,220,214,4,132,16,
+  169,115,46,11,2,143,118,141,237,26,142,162,72,189,123,230,244,155,245,122,221,107,12,14,86,181,214,229,114,175,123,177,
+  40,242,247,27,141,193,40,12,67,246,124,159,243,60,111,251,129,239,42,97,69,105,99,10,33,68,90,173,86,253,52,77,
+  219,59,119,238,28,17,66,66,107,93,106,165,209,94,234,100,89,150,109,77,128,8,9,24,153,16,74,221,113,232,206,131,
+  66,136,114,185,219,153,51,198,80,84,169,152,43,87,222,63,179,123,247,206,229,153,153,203,167,131,32,168,41,165,108,24,
+  132,94,146,38,173,60,203,59,149,74,165,34,165,44,181,86,112,206,37,75,75,139,51,97,24,86,234,181,129,166,148,210,
+  42,165,168,187,220,73,78,158,60,153,109,73,128,153,251,165,45,243,70,163,78,127,127,245,229,151,230,230,102,47,75,33,
+  185,23,199,201,197,75,23,167,206,78,254,123,202,24,227,38,207,159,125,203,57,167,242,60,151,73,210,239,207,207,207,189,
+  127,225,226,244,244,226,226,194,188,179,86,245,147,36,95,238,46,247,164,148,197,159,78,60,247,107,99,84,75,74,193,0,
+  84,183,219,139,215,215,220,96,201,74,203,113,81,228,185,148,198,16,97,230,175,47,254,229,183,59,134,111,42,158,127,254,
+  207,199,147,36,243,71,199,134,151,140,49,110,104,104,48,121,246,15,191,251,169,146,202,19,82,36,158,49,54,8,3,251,
+  218,235,255,152,75,146,212,16,96,133,20,28,85,42,54,170,70,179,67,67,141,250,170,196,106,177,221,238,108,79,160,44,
+  227,60,47,114,227,105,61,50,50,124,117,159,170,213,106,1,160,183,118,239,251,190,189,229,150,3,203,0,224,156,35,33,
+  4,3,192,192,192,64,14,160,143,77,144,74,41,96,197,183,165,105,210,91,191,182,113,11,192,73,158,21,169,20,194,108,
+  78,178,29,214,138,95,51,134,72,9,33,148,45,203,130,8,201,250,181,141,182,156,144,196,105,156,14,202,129,32,203,50,
+  157,231,249,246,255,13,55,128,74,165,82,169,2,170,40,139,156,216,109,79,32,77,211,162,189,176,96,119,142,140,53,157,
+  227,189,204,164,9,0,136,32,8,0,129,152,9,180,226,205,64,96,128,4,173,140,107,131,88,21,155,137,136,192,76,148,
+  166,121,152,229,69,213,113,143,91,139,109,67,68,85,102,238,110,32,64,68,242,192,129,3,252,214,174,189,249,225,79,125,
+  122,212,243,189,168,40,138,85,191,189,22,197,155,205,200,202,199,31,91,152,148,117,207,16,9,242,61,63,188,240,222,133,
+  165,249,217,121,9,96,152,136,20,51,183,215,43,96,206,158,61,219,159,216,63,62,119,254,252,228,149,219,110,63,56,70,
+  0,173,210,91,99,185,210,248,134,114,27,67,54,94,174,232,103,93,233,102,46,207,118,158,249,213,51,151,207,157,155,110,
+  1,8,0,120,192,58,91,78,68,2,64,115,226,214,137,131,123,118,239,249,156,20,116,19,136,62,156,39,95,135,210,217,
+  238,197,247,46,158,158,252,215,228,219,0,218,0,46,49,115,70,235,77,40,173,252,226,248,0,170,88,57,33,215,55,136,
+  255,61,130,213,124,61,0,9,51,59,0,248,15,136,226,182,218,114,146,70,188,0,0,0,0,73,69,78,68,174,66,96,
+  130,
+};
+const unsigned char Find1x[617] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,240,0,240,0,239,52,6,103,27,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,11,5,16,15,5,37,253,173,47,0,0,1,246,73,
+  68,65,84,56,203,157,146,77,107,19,81,24,133,159,59,201,36,77,154,102,134,74,82,10,10,181,93,104,26,69,20,193,
+  133,184,20,10,85,119,226,38,191,192,111,169,244,31,136,182,36,65,68,20,116,89,119,85,16,197,77,168,59,65,236,162,
+  84,40,164,137,86,171,150,80,53,141,205,71,39,77,50,51,215,69,72,73,66,82,170,103,119,15,239,61,239,225,188,71,
+  60,121,250,120,49,247,39,119,140,61,64,85,213,231,19,183,38,47,182,144,211,209,187,150,220,35,238,77,223,145,237,162,
+  78,41,235,92,62,191,185,235,118,77,211,59,242,78,33,196,206,35,153,76,118,28,10,133,66,93,133,119,28,180,15,102,
+  50,25,102,95,204,2,144,152,75,0,208,180,107,119,7,223,190,175,146,74,167,57,122,106,140,109,197,139,105,43,184,100,
+  133,212,252,107,38,110,223,140,196,162,247,159,53,254,40,237,14,52,93,35,149,78,115,232,228,24,159,11,94,6,7,2,
+  140,28,8,82,18,62,180,209,113,252,154,62,115,237,198,149,227,93,29,36,230,18,12,135,79,179,82,112,115,233,204,16,
+  190,30,21,211,182,81,29,10,239,150,37,193,35,227,54,75,111,22,0,1,160,116,10,75,122,3,12,13,232,88,182,100,
+  219,52,169,212,44,202,85,139,126,159,155,95,101,181,37,9,69,74,137,148,118,75,48,110,183,11,132,160,92,181,168,214,
+  36,155,91,53,220,170,131,253,253,30,164,16,45,93,112,2,182,105,154,45,78,108,99,131,53,163,138,223,163,162,247,185,
+  176,45,137,223,227,228,211,70,129,125,61,150,157,107,114,174,212,43,234,66,211,116,52,77,231,194,185,243,164,23,222,18,
+  236,19,124,249,153,39,155,43,145,55,42,124,92,89,167,84,174,144,91,122,229,44,21,139,63,26,2,34,26,159,154,177,
+  44,43,210,124,13,195,48,112,56,84,78,156,141,176,188,86,100,203,84,24,236,149,172,47,190,100,248,224,8,0,31,230,
+  223,167,30,62,120,116,88,116,107,216,213,235,151,167,2,129,224,100,51,231,235,245,17,30,13,243,59,155,173,247,101,245,
+  43,130,127,68,44,30,149,13,145,255,18,0,148,88,60,106,1,148,13,131,191,6,140,246,211,127,51,231,46,0,0,0,
+  0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Find2x[1636] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,6,27,73,68,65,84,88,133,229,151,109,104,91,
+  215,25,199,127,231,94,93,189,217,150,228,55,217,142,95,106,167,177,164,188,180,201,210,96,199,91,154,82,210,146,213,77,
+  250,161,73,26,146,177,102,52,140,81,216,151,177,15,27,12,214,48,6,131,49,24,131,101,152,80,152,201,150,177,145,224,
+  116,30,219,242,201,29,93,94,214,120,13,109,236,206,155,95,102,47,56,78,228,151,72,178,101,201,186,247,220,123,247,33,
+  150,144,21,41,118,194,190,237,129,135,115,207,209,229,60,191,251,63,207,115,206,17,252,191,155,40,28,56,123,246,236,155,
+  154,166,245,10,33,42,20,69,65,81,20,44,203,194,178,44,164,148,152,166,89,180,93,111,76,8,177,164,235,250,215,122,
+  123,123,251,30,75,212,211,211,19,51,77,211,182,44,203,182,44,203,214,117,61,247,108,154,230,26,151,82,230,220,48,140,
+  53,174,235,122,206,51,153,140,157,201,100,236,211,167,79,199,10,227,57,10,7,164,148,1,33,4,147,147,147,8,33,48,
+  77,147,178,178,50,116,93,71,136,135,130,21,182,57,57,197,35,130,2,96,219,54,193,96,16,195,48,2,235,2,216,182,
+  157,155,44,235,249,253,167,1,40,53,94,20,192,178,172,162,1,133,16,140,143,143,99,154,102,209,9,139,141,169,170,74,
+  40,20,42,25,124,93,128,252,224,66,8,218,219,219,139,42,81,10,160,208,178,234,174,11,80,108,25,132,16,140,141,141,
+  97,154,102,209,128,165,20,8,135,195,79,6,144,31,160,48,15,66,161,80,201,60,248,159,41,80,12,32,219,127,26,5,
+  34,145,200,211,3,220,186,117,139,93,187,118,229,250,225,112,248,177,95,190,158,10,79,4,0,208,209,209,145,171,127,33,
+  4,163,163,163,185,223,147,201,37,162,115,247,89,90,90,68,74,137,162,168,148,151,149,83,89,89,69,77,117,45,138,162,
+  224,112,56,216,186,117,235,147,3,216,182,141,16,226,145,146,12,135,195,164,82,203,92,255,219,53,92,46,23,95,62,248,
+  26,181,181,65,156,154,19,105,74,226,137,24,195,159,15,49,60,52,196,254,125,47,209,220,220,178,102,238,236,124,27,86,
+  160,208,110,15,221,102,120,248,51,14,29,126,131,150,230,86,250,255,58,66,223,251,159,50,49,179,72,125,149,151,131,123,
+  26,57,249,106,39,207,239,216,201,111,127,247,27,154,26,91,216,255,226,75,143,85,64,41,5,80,88,5,66,8,166,239,
+  222,161,187,251,117,124,254,90,142,188,247,39,254,117,223,224,155,111,117,240,203,239,117,243,157,183,191,68,198,118,114,236,
+  204,21,166,162,41,78,158,248,10,147,83,19,44,167,150,115,185,81,76,129,13,1,0,204,204,220,197,227,113,211,220,220,
+  202,59,63,25,224,196,129,48,95,125,37,196,230,186,114,124,30,7,65,159,198,129,221,141,156,234,222,198,119,223,255,152,
+  197,180,197,190,125,47,242,201,39,131,8,33,176,109,123,227,0,197,164,26,155,24,229,133,221,123,248,224,163,17,118,182,
+  111,162,115,123,19,170,195,129,170,170,104,14,7,78,77,195,237,114,81,83,233,231,192,222,16,63,189,52,196,182,173,219,
+  153,152,28,71,74,185,241,37,200,190,156,181,172,10,179,209,40,222,50,47,253,55,102,216,25,10,34,77,11,67,90,232,
+  210,68,90,22,96,163,8,155,21,67,210,84,91,193,237,201,7,44,167,51,84,6,2,204,205,207,149,92,130,117,55,162,
+  172,101,244,12,186,158,97,122,126,9,83,207,176,148,76,161,107,10,14,69,0,15,229,253,207,253,24,11,11,73,12,75,
+  224,209,4,119,238,45,224,114,123,48,116,189,36,64,201,28,0,184,121,243,38,138,242,240,21,77,115,98,72,131,96,192,
+  203,162,14,170,230,196,161,57,113,186,93,184,221,30,76,225,32,80,89,73,219,51,141,52,109,170,39,35,193,182,12,22,
+  19,9,156,78,231,35,129,75,42,32,165,204,173,85,87,87,23,250,42,125,125,93,61,233,212,10,47,63,23,224,227,219,
+  119,80,101,154,114,183,138,3,19,97,27,168,194,70,90,144,49,5,211,11,6,213,229,26,213,126,23,115,115,115,212,213,
+  213,151,4,120,108,21,228,111,68,145,200,54,134,134,135,56,241,234,14,22,226,43,36,50,42,21,254,42,130,245,13,180,
+  182,182,17,14,133,216,178,165,157,170,96,3,215,71,30,240,173,55,67,76,77,77,145,72,36,152,157,141,110,92,129,82,
+  27,209,166,134,77,220,184,113,141,249,185,40,231,190,189,159,119,126,252,33,35,19,51,60,223,234,163,186,66,197,48,44,
+  70,239,165,184,249,207,7,188,247,246,110,34,109,53,140,141,37,232,216,211,73,207,185,30,14,31,122,99,99,10,228,47,
+  65,161,117,191,118,136,15,255,50,64,34,54,203,229,31,30,230,208,222,22,254,62,190,196,207,250,39,249,253,224,2,109,
+  13,213,92,250,193,235,108,123,38,192,196,196,24,137,216,18,233,116,134,23,190,176,135,254,254,203,104,78,7,103,206,156,
+  89,19,243,145,227,235,248,241,227,246,249,243,231,137,197,98,8,33,144,82,226,245,122,49,77,147,145,145,17,86,86,210,
+  140,255,123,140,170,170,42,186,246,118,17,172,173,67,115,58,49,165,73,44,254,128,79,63,187,197,192,192,0,225,80,132,
+  166,198,22,164,148,68,163,81,52,77,99,124,98,140,207,255,49,252,7,44,229,228,197,139,23,147,69,1,142,30,61,106,
+  95,184,112,161,40,64,182,52,21,69,97,118,54,202,232,248,40,51,119,167,73,46,39,209,28,26,126,127,128,112,56,66,
+  168,61,76,207,185,95,80,81,81,65,251,150,48,134,110,48,63,63,143,211,233,100,118,62,202,181,107,87,135,76,205,62,
+  216,247,235,190,123,79,116,24,101,237,225,53,187,142,250,250,134,220,94,145,61,65,179,246,141,175,191,203,249,95,245,114,
+  253,198,85,246,118,124,145,154,154,26,226,241,56,145,80,132,96,93,237,115,151,251,46,255,28,56,82,152,3,62,69,81,
+  22,109,219,198,231,243,225,243,249,240,251,253,120,60,30,202,202,202,240,122,189,184,92,174,220,191,37,93,215,73,165,82,
+  44,47,47,147,76,38,73,36,18,36,18,9,226,241,56,169,84,138,163,71,222,98,115,219,179,252,249,202,31,177,44,147,
+  166,230,70,90,54,55,210,217,217,9,240,10,172,173,130,10,160,118,122,122,250,71,167,78,157,250,190,16,194,83,248,229,
+  217,11,107,246,96,41,246,156,175,70,214,85,135,194,165,190,75,28,59,118,140,86,119,11,131,131,131,88,182,125,21,80,
+  243,115,192,5,4,129,106,32,176,218,87,11,24,212,60,87,86,93,205,107,69,158,219,128,181,234,233,182,103,219,90,119,
+  108,223,126,194,229,118,70,44,203,252,40,37,51,239,94,249,224,202,84,177,75,156,11,112,175,182,165,46,121,162,0,32,
+  31,104,141,104,171,174,3,25,32,5,164,87,199,0,248,47,32,222,70,11,170,8,255,164,0,0,0,0,73,69,78,68,
+  174,66,96,130,
+};
+const unsigned char Paste1x[561] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,9,112,72,89,115,0,0,11,19,0,0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,
+  10,14,0,28,21,175,226,241,24,0,0,1,208,73,68,65,84,56,203,149,147,177,107,83,81,20,198,127,247,189,52,130,
+  36,49,141,212,148,12,133,34,6,92,92,180,106,98,4,209,18,112,118,208,33,56,20,69,109,29,196,197,65,151,130,56,
+  8,142,250,15,52,131,187,155,168,75,213,46,186,56,41,145,82,168,209,72,66,94,111,108,208,70,239,57,14,161,49,47,
+  109,32,126,219,253,206,61,63,206,249,224,24,6,84,42,149,140,239,123,207,157,147,217,126,223,247,189,23,206,73,177,92,
+  46,107,191,111,0,110,206,154,43,6,30,42,140,43,30,118,242,18,185,220,17,60,207,0,32,162,172,172,124,96,95,237,
+  41,6,1,104,170,234,173,199,47,89,50,243,103,137,248,158,9,46,156,57,24,251,210,201,240,46,200,210,180,29,166,167,
+  167,48,102,27,32,172,173,173,147,76,68,57,154,252,204,164,191,206,179,215,171,86,84,83,17,32,230,121,102,44,26,241,
+  121,95,207,178,120,255,17,65,16,80,169,84,66,171,205,205,29,34,149,74,113,239,238,109,46,102,190,33,170,49,32,26,
+  233,255,212,222,130,68,34,129,170,48,51,115,108,48,30,226,241,56,91,127,192,169,233,121,61,128,106,40,27,150,223,188,
+  13,189,11,249,28,187,41,194,16,157,62,149,231,31,92,16,113,195,1,186,75,97,123,2,85,69,69,200,157,60,254,127,
+  19,20,242,57,68,4,17,65,85,176,214,50,49,145,30,13,208,223,40,210,109,110,253,104,141,62,129,136,235,65,170,95,
+  171,52,26,245,29,33,135,1,3,53,231,186,128,86,203,210,168,215,41,22,207,15,219,20,111,216,4,214,110,80,251,94,
+  67,68,122,254,245,249,171,92,158,90,30,190,194,222,49,165,25,52,73,167,51,164,211,25,178,217,195,88,187,129,170,112,
+  99,225,90,175,217,55,26,2,108,138,232,239,246,47,183,231,68,242,35,15,22,239,240,211,237,140,166,176,255,19,171,237,
+  3,0,36,181,138,49,102,83,85,59,6,96,225,92,247,26,49,140,51,130,84,187,215,248,228,21,75,127,1,79,230,225,
+  152,120,105,196,218,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Paste2x[1027] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,3,186,73,68,65,84,88,133,173,151,221,139,27,
+  85,24,135,159,249,202,199,166,179,217,15,104,137,120,163,173,36,87,5,175,74,23,10,11,46,94,8,171,66,175,132,69,
+  2,254,1,186,98,45,248,7,8,186,32,10,165,34,40,20,217,11,189,17,69,172,80,86,65,42,182,122,163,20,75,22,
+  170,166,149,165,136,44,217,166,155,143,205,36,115,94,47,178,51,153,153,76,146,73,221,23,14,156,153,57,231,252,158,243,
+  254,206,156,57,163,49,101,172,173,173,221,1,78,141,120,252,199,230,230,230,83,211,140,103,78,11,0,156,58,119,238,105,
+  116,93,11,221,84,74,184,126,253,215,81,96,35,67,155,220,4,202,229,151,223,237,245,212,235,128,1,112,250,244,19,52,
+  155,141,80,155,92,238,24,183,110,85,189,75,215,52,245,247,174,92,249,244,205,196,0,23,95,56,190,209,85,242,154,136,
+  54,148,149,221,249,103,89,89,57,139,97,12,30,237,239,215,67,109,108,59,239,215,93,183,199,214,214,13,22,107,215,208,
+  34,83,212,144,158,161,105,239,111,124,253,239,5,8,88,208,85,172,159,95,90,48,162,29,0,46,255,14,133,194,227,212,
+  235,123,104,135,13,50,153,76,127,192,72,7,77,211,152,157,157,67,228,6,171,103,242,100,83,122,232,121,183,39,230,87,
+  63,63,88,7,194,0,34,248,226,191,89,231,121,232,230,2,221,42,228,243,243,136,8,32,136,0,136,215,111,232,222,204,
+  76,191,239,143,218,75,164,245,52,0,89,26,44,254,243,57,79,30,183,16,233,91,25,2,8,198,67,55,199,197,11,111,
+  249,215,229,114,153,106,245,14,166,105,5,68,61,240,192,197,33,64,173,86,195,48,12,214,95,125,3,219,182,1,120,103,
+  227,109,84,176,233,56,0,47,234,245,7,0,172,172,60,195,213,171,91,40,165,198,53,247,67,215,117,150,150,206,210,104,
+  236,163,148,75,62,63,215,199,139,233,62,4,160,100,24,115,117,117,149,229,229,101,154,205,86,34,0,0,211,52,252,117,
+  50,110,236,97,0,5,3,135,6,97,219,182,159,206,164,33,34,33,139,18,89,16,3,57,117,4,69,195,245,4,0,113,
+  148,219,219,219,143,36,92,42,149,66,162,137,50,16,231,83,169,84,74,44,62,106,246,137,1,166,181,96,32,12,227,246,
+  134,56,160,88,128,164,22,196,205,52,40,88,40,60,198,236,172,253,40,22,12,55,138,90,16,77,247,168,217,71,51,240,
+  191,45,24,231,115,56,237,209,250,232,177,19,45,194,74,165,18,18,25,22,12,222,131,98,177,24,130,240,118,208,169,45,
+  240,102,215,127,157,38,47,182,184,217,139,200,0,32,134,96,162,5,147,133,227,33,66,59,224,33,64,50,11,2,31,12,
+  111,144,168,5,209,129,108,219,166,80,40,68,96,250,103,3,195,24,236,235,83,111,68,158,96,177,88,98,242,236,195,179,
+  54,12,195,47,222,161,101,170,183,32,122,248,72,42,172,235,186,47,108,154,38,189,94,143,234,189,42,130,196,30,64,71,
+  46,66,239,75,54,206,231,104,186,77,211,228,163,79,62,12,141,151,178,82,56,93,103,232,232,54,17,64,41,53,102,97,
+  13,251,28,76,247,243,207,189,232,11,58,78,135,239,127,248,14,167,211,73,6,32,62,128,27,43,56,202,103,175,136,136,
+  47,94,219,171,113,243,151,159,104,53,91,164,82,86,210,12,244,5,92,87,141,20,142,250,236,213,29,199,33,157,78,163,
+  148,226,118,229,54,127,221,253,19,231,160,131,157,59,70,167,219,153,110,13,40,165,200,102,103,134,78,53,154,166,161,235,
+  122,168,120,175,218,189,191,239,210,233,116,248,246,218,55,180,219,109,84,215,101,126,126,142,133,133,69,118,238,239,36,203,
+  128,8,100,164,193,165,203,31,196,118,24,23,66,255,79,199,237,117,73,89,22,88,22,173,131,54,173,251,59,88,110,3,
+  119,12,128,142,134,234,246,68,63,121,194,226,164,124,17,252,136,29,77,232,64,41,67,219,17,208,80,192,9,96,215,3,
+  72,31,116,212,199,95,222,220,123,5,180,152,35,233,81,134,184,123,77,245,25,48,3,24,193,117,145,5,22,129,60,144,
+  58,44,71,25,14,253,60,28,0,187,64,13,232,254,7,111,237,85,69,232,242,20,202,0,0,0,0,73,69,78,68,174,
+  66,96,130,
+};
+const unsigned char Redo1x[591] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,214,7,26,10,39,21,63,184,237,33,0,0,1,220,73,
+  68,65,84,56,203,157,147,77,107,19,81,24,133,159,59,95,77,140,164,66,76,99,131,31,109,54,213,118,211,210,42,126,
+  84,99,13,66,169,56,110,68,43,130,184,26,112,173,59,193,191,224,126,86,221,117,41,68,10,133,138,197,82,186,106,164,
+  168,27,193,77,117,33,41,98,76,38,77,154,201,100,198,205,24,39,157,65,130,103,249,94,158,195,185,231,190,23,250,144,
+  110,106,158,110,106,211,81,103,18,253,107,91,55,181,194,127,27,60,126,96,0,188,209,77,109,46,56,23,17,113,7,128,
+  60,176,8,76,1,147,1,3,150,150,77,128,27,69,195,94,15,25,232,166,118,1,120,62,39,180,84,182,112,117,88,77,
+  141,230,16,2,85,142,97,217,63,41,125,91,225,202,232,189,30,19,17,128,23,128,23,143,242,249,243,242,80,78,170,217,
+  101,188,218,167,158,116,31,155,53,128,174,201,185,61,123,86,248,240,4,240,242,225,181,235,55,99,153,51,88,149,117,44,
+  79,35,238,218,0,12,58,13,54,219,206,223,226,132,196,165,145,187,44,45,155,40,254,236,233,157,179,227,147,177,116,150,
+  250,175,119,36,90,13,18,52,24,110,85,120,69,2,71,234,237,58,61,120,178,123,13,5,96,64,213,102,143,143,77,167,
+  227,214,123,178,251,85,118,164,4,154,34,168,29,137,51,238,67,23,21,48,235,22,153,99,167,217,92,253,208,237,64,1,
+  232,184,110,70,200,130,84,195,98,171,84,247,214,90,149,208,235,76,92,62,17,130,187,123,224,116,156,228,209,198,87,182,
+  119,118,89,107,181,45,224,25,48,85,52,108,81,52,108,1,240,54,57,20,130,129,110,7,236,55,171,238,74,93,72,192,
+  253,162,97,175,30,78,224,195,51,69,195,46,69,110,162,170,200,7,128,23,5,251,10,193,193,4,27,205,189,178,90,144,
+  189,24,166,54,127,216,228,207,53,162,36,3,140,221,150,221,47,7,237,250,173,153,220,143,212,110,249,148,208,213,173,207,
+  175,59,118,63,127,36,184,137,35,192,2,80,5,54,158,36,221,239,2,188,249,69,167,243,47,131,223,215,75,186,5,94,
+  207,53,222,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Redo2x[1502] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,5,112,73,68,65,84,88,133,
+  197,150,91,108,20,85,24,199,255,223,153,217,157,221,182,212,222,236,133,82,139,5,41,22,161,222,184,71,66,184,84,12,
+  77,86,99,136,70,209,23,89,68,158,124,145,71,163,81,76,76,212,248,164,137,75,98,192,132,168,36,132,53,65,84,66,
+  64,20,42,210,2,133,130,148,90,74,233,133,222,119,233,118,47,115,59,159,15,236,110,182,235,110,161,144,192,217,124,57,
+  231,204,156,57,191,223,249,230,204,206,16,51,227,65,22,113,175,19,120,124,218,151,30,159,118,215,243,220,179,0,128,237,
+  66,193,175,30,159,230,126,80,2,180,112,246,138,85,66,193,41,143,79,43,121,16,2,88,60,127,141,115,89,221,250,58,
+  18,104,245,248,180,57,247,93,64,144,130,218,170,122,101,237,211,47,150,147,16,205,30,159,182,248,190,9,16,8,2,42,
+  70,205,110,204,44,173,22,27,151,191,82,160,8,245,168,199,167,53,222,31,1,34,8,18,32,8,4,140,30,60,148,95,
+  8,207,170,55,114,53,167,235,7,207,46,109,219,109,175,159,206,255,128,199,167,229,0,104,32,129,87,137,232,89,102,46,
+  21,172,206,216,214,248,17,250,245,11,176,217,132,205,6,114,149,98,144,165,226,231,166,239,195,19,177,241,175,14,188,165,
+  239,184,103,1,143,79,91,77,2,251,102,22,87,107,181,213,79,230,21,207,40,163,60,173,16,57,206,124,8,82,209,31,
+  189,0,139,77,72,54,97,177,9,151,200,131,138,28,28,254,123,127,248,102,40,112,144,37,54,251,189,186,57,109,1,143,
+  79,115,146,192,103,5,238,242,45,13,139,95,118,87,23,45,68,212,10,66,231,48,76,25,131,41,163,48,56,10,155,13,
+  216,108,193,102,3,49,59,132,254,88,27,84,114,161,204,89,139,243,151,206,69,6,135,111,156,101,137,23,252,94,61,116,
+  199,2,30,159,86,78,2,127,44,123,108,67,213,242,249,27,53,27,58,162,242,38,36,91,176,216,72,214,137,212,39,4,
+  174,69,154,17,181,131,0,0,77,228,161,210,181,8,255,116,92,212,123,250,186,175,177,196,18,191,87,31,79,48,212,169,
+  86,47,20,124,179,116,254,250,71,87,206,107,84,66,214,48,4,110,109,54,224,214,238,79,212,148,114,36,100,13,39,225,
+  0,144,171,22,195,52,45,140,142,140,88,0,246,167,194,167,20,240,248,180,181,85,197,181,235,151,204,221,160,4,205,62,
+  0,0,147,10,128,147,63,36,123,137,22,48,164,119,36,231,40,113,214,64,179,11,113,226,244,241,136,110,198,222,247,111,
+  209,191,72,231,100,20,136,223,247,221,235,158,218,228,10,219,163,176,88,135,128,10,6,131,152,224,82,102,64,33,71,202,
+  21,132,190,216,121,140,155,131,48,100,4,0,80,166,205,3,233,57,56,209,114,60,98,154,230,118,191,87,223,157,137,149,
+  45,3,155,107,42,22,20,229,230,230,34,96,244,64,144,10,6,144,175,150,193,193,110,252,59,216,202,189,35,87,162,35,
+  227,67,50,24,26,205,121,179,225,61,193,44,49,108,116,2,0,42,92,117,176,194,2,167,206,252,25,177,109,235,53,191,
+  87,247,103,203,116,102,1,194,130,154,242,58,215,132,53,2,201,22,8,2,249,206,50,244,143,117,226,112,203,190,104,40,
+  26,216,203,140,163,0,218,5,41,127,49,75,12,232,237,136,217,55,49,211,245,4,162,227,54,154,207,157,12,75,41,27,
+  253,94,253,88,54,120,86,1,161,208,227,69,185,21,100,200,40,108,182,80,224,168,68,103,127,155,125,168,229,187,1,150,
+  216,228,247,234,77,137,177,47,237,114,243,96,172,3,163,122,23,102,185,235,17,28,157,144,103,219,90,66,44,121,157,223,
+  171,55,79,5,207,158,1,70,141,195,225,128,46,67,80,133,19,81,35,130,95,154,247,26,204,88,234,247,234,125,169,67,
+  37,75,132,237,81,204,114,215,99,120,96,204,190,208,222,26,96,201,207,249,189,250,229,219,193,179,10,48,115,137,69,81,
+  72,182,161,81,46,90,59,155,162,12,251,211,116,120,162,88,28,67,207,245,94,171,163,235,202,0,75,172,244,123,245,235,
+  119,2,7,178,188,140,4,161,45,16,25,194,173,71,75,226,218,64,59,51,35,227,46,6,128,203,29,151,140,142,174,43,
+  87,89,226,153,233,192,179,10,104,49,185,103,44,216,109,18,8,38,27,48,141,136,101,134,101,144,136,4,17,41,68,164,
+  38,2,0,122,251,123,218,2,93,114,197,79,91,141,177,248,121,37,62,150,238,74,192,109,242,254,254,158,139,103,108,105,
+  193,144,17,20,106,238,64,232,178,116,2,72,15,77,90,124,176,237,71,235,249,227,59,173,88,218,57,7,0,7,17,57,
+  226,178,25,133,254,39,64,68,226,219,119,237,9,115,52,242,201,141,145,75,17,83,70,80,250,72,105,81,229,108,177,58,
+  29,14,192,121,236,3,115,75,231,111,210,206,0,79,109,171,137,58,158,157,164,136,72,1,19,17,41,0,20,0,202,129,
+  157,198,145,254,206,142,29,227,225,193,96,97,113,133,40,124,68,219,240,112,21,114,210,38,119,78,12,65,77,200,164,175,
+  62,14,78,132,146,26,68,36,128,148,183,97,252,128,18,151,74,182,183,30,40,105,156,91,179,232,237,88,116,220,108,255,
+  189,237,235,67,159,199,78,143,13,194,6,64,105,25,100,0,242,54,97,167,247,137,153,17,79,201,36,112,106,123,227,199,
+  69,85,203,27,234,95,15,155,99,206,139,77,87,15,30,249,48,212,17,14,37,51,40,210,224,246,52,218,118,122,6,210,
+  5,146,253,226,57,138,115,205,59,149,213,5,179,149,154,161,171,19,55,78,237,9,116,15,180,89,102,60,19,169,25,200,
+  148,137,244,149,75,0,54,51,219,147,62,72,50,220,134,68,36,51,228,200,33,81,177,80,117,22,207,81,221,138,3,74,
+  176,87,234,221,39,245,152,25,5,199,225,153,68,210,165,44,102,150,147,246,64,138,4,101,129,167,214,137,85,167,63,86,
+  156,33,82,37,108,102,182,39,241,166,250,36,139,203,164,10,101,130,83,124,242,76,18,73,56,103,1,77,235,179,60,77,
+  44,217,77,21,200,6,202,86,254,3,228,143,217,228,225,119,212,115,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Replace1x[776] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,214,1,6,22,4,3,245,118,104,130,0,0,2,149,73,
+  68,65,84,56,203,173,147,77,108,12,97,24,199,127,51,179,179,181,72,183,204,44,193,129,86,208,137,224,160,137,131,160,
+  184,52,113,32,82,73,137,175,99,75,138,90,65,164,68,16,130,138,34,113,173,68,19,196,54,18,209,131,75,125,180,68,
+  72,137,143,157,165,69,98,91,149,212,110,119,103,63,186,93,187,59,175,3,59,105,47,78,254,201,147,60,239,155,252,127,
+  121,158,55,255,87,98,156,246,29,104,212,52,77,139,20,207,209,104,84,191,218,122,45,202,63,36,21,27,255,161,3,107,
+  75,189,101,93,75,86,212,136,20,83,37,85,140,137,190,151,15,164,132,21,95,119,169,165,245,209,63,1,141,251,247,106,
+  186,238,139,44,172,170,97,32,237,97,229,226,89,152,225,24,233,100,2,43,212,137,203,165,160,40,178,99,82,85,53,224,
+  111,58,188,5,192,5,160,235,190,72,249,226,149,124,177,74,168,91,93,206,36,183,130,170,200,116,135,4,51,150,108,96,
+  248,125,39,199,142,54,59,128,243,23,207,214,22,123,151,115,59,217,199,188,233,165,20,108,65,54,87,32,155,179,241,149,
+  150,240,117,104,12,9,176,172,56,0,94,111,25,37,111,142,115,121,171,44,128,29,206,92,106,33,193,224,112,130,112,36,
+  67,60,157,103,142,230,193,45,23,208,167,216,0,132,66,33,0,90,183,41,236,186,210,67,117,237,126,128,155,50,64,194,
+  138,175,235,123,221,197,204,82,9,115,96,132,145,212,24,47,204,239,196,82,25,162,239,239,179,105,227,38,12,195,160,173,
+  65,99,247,213,103,12,62,109,231,157,57,88,0,144,1,166,149,77,239,170,40,159,79,248,213,61,42,124,37,244,132,126,
+  146,28,205,50,252,186,3,93,211,24,77,143,58,230,129,39,55,121,215,31,101,196,236,80,128,42,233,204,153,83,98,238,
+  188,114,124,186,78,208,12,146,74,167,156,103,89,182,116,25,213,107,170,105,107,208,216,121,169,155,112,79,59,111,63,69,
+  137,153,1,128,170,166,91,118,175,11,112,204,7,155,252,88,86,220,217,23,248,99,110,121,74,255,195,54,62,126,79,18,
+  51,3,252,90,84,207,145,147,215,123,1,73,110,110,62,33,5,205,32,249,194,47,187,104,50,12,3,195,48,168,172,172,
+  228,155,188,130,224,243,231,244,15,89,196,130,119,169,59,253,2,219,51,219,201,144,12,224,63,120,72,2,16,194,97,32,
+  132,224,198,30,157,207,63,162,220,9,4,136,124,232,96,85,125,7,147,180,5,228,114,185,98,4,132,60,46,149,118,62,
+  159,159,0,104,186,101,179,126,230,103,106,54,239,102,121,195,99,196,228,57,36,147,73,114,185,60,128,50,49,72,128,170,
+  186,241,122,221,14,32,147,201,144,72,36,200,102,179,40,138,130,170,170,127,203,5,96,79,0,40,138,114,251,66,203,185,
+  237,66,136,9,83,20,75,146,156,127,135,199,227,105,7,114,252,15,253,6,121,205,27,12,206,189,173,89,0,0,0,0,
+  73,69,78,68,174,66,96,130,
+};
+const unsigned char Replace2x[2104] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,7,239,73,68,65,84,88,133,229,151,121,112,85,
+  213,29,199,63,119,121,75,222,35,203,3,178,188,144,132,132,16,72,66,22,53,213,72,234,6,197,182,1,161,81,234,82,
+  91,17,165,213,46,58,195,76,157,218,25,151,193,58,116,58,142,254,225,140,180,113,148,74,59,130,211,113,68,173,67,103,
+  40,54,3,76,213,8,68,36,219,51,132,132,188,188,23,8,121,201,203,246,214,187,157,254,129,188,33,144,8,214,254,215,
+  223,204,111,206,189,103,238,185,191,207,253,222,223,57,191,115,224,255,221,164,75,59,118,236,216,113,151,205,102,219,37,73,
+  82,186,44,203,200,178,140,101,89,88,150,133,97,24,152,166,57,107,123,165,62,73,146,166,53,77,219,188,107,215,174,189,
+  95,73,212,220,220,60,110,154,166,176,44,75,88,150,37,52,77,75,93,155,166,57,195,13,195,72,185,174,235,51,92,211,
+  180,148,39,147,73,145,76,38,197,150,45,91,198,47,141,167,94,218,97,24,70,150,36,73,156,62,125,26,73,146,48,77,
+  19,183,219,77,60,30,199,63,56,64,48,24,32,60,30,198,48,116,236,118,59,57,57,185,148,149,46,35,39,39,23,73,
+  186,76,80,0,132,16,228,228,228,160,235,122,214,21,1,132,16,231,255,141,36,165,124,104,40,200,199,173,31,81,93,83,
+  205,247,27,27,201,202,244,160,42,42,154,174,17,10,141,208,250,233,39,116,249,58,89,89,223,128,203,229,190,12,96,46,
+  176,89,1,44,203,154,1,16,28,10,208,213,221,193,143,239,255,9,178,234,100,207,129,46,246,31,251,136,225,112,140,210,
+  252,12,238,186,169,136,13,119,52,49,24,24,224,131,15,222,167,124,249,10,28,14,7,0,138,162,176,108,217,178,57,131,
+  95,17,32,22,143,241,217,241,99,108,126,240,33,250,206,68,121,234,141,67,252,112,85,57,191,121,96,37,138,44,49,28,
+  142,115,240,184,159,191,28,216,199,206,39,110,163,177,113,45,45,45,45,220,217,180,113,214,175,190,160,238,197,38,207,6,
+  112,225,193,206,206,118,110,190,249,22,34,9,193,115,111,30,231,249,45,13,172,185,174,128,236,12,59,46,187,132,215,99,
+  103,67,67,49,117,21,185,60,252,98,11,69,69,37,216,157,118,14,29,62,132,207,231,227,228,201,147,41,37,175,26,192,
+  52,205,84,59,24,244,179,172,108,57,47,252,237,4,15,223,81,67,137,215,131,59,205,65,154,195,78,154,195,129,43,205,
+  73,186,219,69,105,97,54,133,121,243,217,255,233,41,214,172,94,67,56,60,202,138,21,43,40,47,47,255,239,1,194,227,
+  97,60,89,89,76,69,19,116,13,140,83,234,205,36,150,208,136,37,146,104,154,134,166,37,209,147,113,166,167,167,152,28,
+  31,195,235,81,121,251,240,0,89,89,243,241,249,124,116,119,119,211,211,211,115,69,128,203,114,32,165,128,97,224,112,56,
+  25,28,30,35,221,101,199,176,4,154,9,178,44,33,201,10,78,135,140,162,168,132,163,38,5,222,108,50,99,6,7,63,
+  59,139,166,39,137,198,162,84,85,85,93,22,236,107,1,216,29,14,226,137,56,170,108,18,137,105,140,78,37,16,166,142,
+  132,133,36,4,177,120,156,179,161,113,226,73,29,83,72,12,79,104,164,59,101,194,225,16,8,232,236,236,68,85,85,42,
+  42,42,0,208,146,113,230,197,63,227,233,251,75,134,166,163,211,147,145,132,182,97,231,254,169,83,179,2,8,33,88,48,
+  127,1,211,147,211,120,23,166,147,191,208,205,209,158,115,44,93,148,73,70,154,138,77,6,155,108,163,168,192,11,72,196,
+  53,11,223,25,63,43,203,51,232,59,61,64,121,121,5,53,53,53,169,119,70,38,199,104,126,105,51,63,93,191,145,27,
+  22,221,146,63,122,248,239,249,191,239,220,243,22,112,253,156,10,76,78,78,144,212,146,12,14,6,216,218,180,148,167,255,
+  218,137,42,188,100,58,193,161,88,56,84,176,203,22,146,36,113,106,56,73,123,239,24,175,60,254,45,254,188,243,85,86,
+  148,87,211,209,209,129,170,170,100,123,210,120,243,197,45,52,174,251,21,43,240,192,190,125,44,252,168,21,123,158,40,128,
+  57,146,176,179,171,131,127,181,124,72,117,85,13,105,78,39,101,69,57,60,115,127,13,7,142,6,8,142,11,220,153,217,
+  228,230,45,66,157,151,203,17,191,197,225,238,73,94,126,236,70,2,254,1,210,28,46,214,174,93,71,109,109,45,118,49,
+  201,238,23,31,160,233,158,173,24,11,203,56,230,114,97,124,248,33,251,28,1,17,145,196,9,184,164,26,110,219,182,77,
+  22,152,102,78,110,54,139,188,133,132,66,163,8,33,168,187,254,90,138,10,23,163,216,156,236,57,208,205,254,99,103,56,
+  27,142,81,150,159,193,15,26,10,104,186,181,146,174,174,14,154,95,109,230,206,166,141,184,93,110,250,78,252,147,96,251,
+  59,220,125,199,106,100,43,74,242,76,6,193,37,141,156,221,241,184,209,102,141,126,28,138,219,215,189,125,48,20,145,46,
+  10,62,207,225,82,247,228,230,228,173,159,159,181,16,191,223,79,52,26,165,172,172,12,75,232,244,245,247,81,87,87,71,
+  77,205,53,44,240,44,64,81,85,180,164,70,112,104,144,119,246,238,69,75,38,217,252,224,195,100,102,102,242,143,61,191,
+  39,212,179,159,181,223,91,133,62,21,32,50,252,57,19,97,27,71,250,220,4,194,61,175,231,221,48,253,232,182,109,88,
+  41,5,182,111,223,238,149,85,177,127,241,226,226,106,135,45,141,190,190,62,20,69,161,164,164,132,104,108,10,93,215,249,
+  206,234,239,210,127,186,143,142,206,118,2,129,0,145,72,4,167,211,201,210,210,50,26,86,54,176,100,73,41,150,105,176,
+  251,229,95,144,46,2,220,220,208,64,108,180,155,248,104,15,254,17,157,246,33,59,189,163,89,188,181,175,109,134,234,42,
+  128,162,242,202,117,117,117,213,194,146,56,122,228,24,30,143,135,252,252,124,66,225,17,210,28,78,110,250,246,173,36,18,
+  9,162,145,24,69,5,197,44,46,44,65,150,101,36,73,66,81,20,206,157,27,97,40,56,200,39,239,62,207,245,21,89,
+  84,87,213,19,57,115,148,196,100,16,95,32,193,23,161,121,220,247,216,14,158,122,254,229,217,215,1,33,196,154,229,203,
+  151,19,141,71,136,70,43,144,36,137,193,160,31,85,86,169,187,166,142,120,60,142,174,235,228,230,230,2,231,11,149,205,
+  102,195,102,179,33,203,50,177,233,81,222,109,254,45,183,215,151,80,80,176,136,169,193,127,147,136,140,113,188,63,201,153,
+  120,54,143,60,187,27,111,225,82,96,14,0,100,14,245,247,247,175,95,82,90,74,150,39,147,246,246,19,84,87,213,146,
+  239,93,68,60,30,71,150,101,20,69,161,183,183,23,195,48,80,20,37,245,245,211,99,126,124,135,254,196,221,141,55,146,
+  153,225,100,114,224,32,145,72,132,99,167,116,38,40,96,235,31,222,199,233,74,191,44,240,12,0,89,24,191,108,253,180,
+  213,106,109,109,93,29,141,198,210,31,249,217,207,145,144,176,44,11,69,81,112,58,157,232,186,78,93,93,29,146,36,165,
+  128,122,142,183,208,117,228,53,30,216,184,26,155,136,50,57,112,136,240,84,146,182,1,9,79,241,106,30,221,250,71,100,
+  89,153,117,9,158,1,240,228,147,219,130,64,19,192,166,77,155,68,94,110,30,225,112,24,73,146,80,85,21,151,203,133,
+  105,154,248,124,62,76,211,68,146,36,34,19,35,124,178,119,59,155,238,107,196,152,12,48,53,124,130,224,168,70,219,128,
+  76,97,237,122,170,26,238,163,179,179,139,218,218,218,43,3,92,108,134,97,204,57,160,178,178,50,165,192,235,219,239,101,
+  195,61,27,73,175,188,133,177,35,175,113,114,40,65,215,176,139,166,71,94,160,182,126,45,112,190,248,8,33,190,222,150,
+  236,194,82,60,155,117,119,119,99,154,38,103,7,78,160,26,33,114,243,11,208,38,252,124,225,159,226,243,33,55,171,238,
+  125,142,154,27,26,231,28,255,141,1,42,43,43,17,194,162,101,247,175,89,181,110,19,7,223,219,77,95,96,138,229,215,
+  222,206,19,47,189,65,122,230,130,175,148,251,27,3,0,236,221,249,12,253,167,122,96,223,30,234,111,127,136,250,31,221,
+  134,101,9,70,70,39,56,23,26,79,37,232,133,105,106,179,217,82,121,116,53,0,25,178,44,79,9,33,50,50,50,50,
+  82,231,2,85,85,17,66,96,154,6,238,116,15,191,123,245,99,178,189,37,51,78,66,151,238,166,21,69,65,85,85,20,
+  69,65,81,20,100,89,198,110,183,79,3,121,192,56,144,132,153,197,40,29,200,169,175,175,191,187,184,184,248,89,73,146,
+  210,174,82,197,171,181,68,111,111,239,11,109,109,109,239,1,35,192,89,192,186,24,192,1,228,0,11,128,172,47,239,149,
+  255,85,112,206,171,29,5,194,64,0,136,192,44,135,211,47,3,59,191,108,231,158,63,95,207,76,64,231,188,236,73,32,
+  149,169,255,1,125,174,253,144,40,89,191,100,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Undo1x[650] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,214,7,26,10,14,0,22,35,150,33,0,0,2,23,73,
+  68,65,84,56,203,149,147,79,104,146,97,28,199,191,207,243,190,207,212,229,254,232,198,26,210,136,214,193,242,16,20,132,
+  65,131,21,4,66,176,67,120,8,130,98,68,80,93,59,140,60,120,40,199,140,29,34,186,116,169,88,65,16,52,233,80,
+  44,22,193,82,140,90,118,138,148,180,104,13,114,19,92,190,58,231,134,239,235,243,60,29,194,165,155,150,125,111,207,23,
+  190,159,231,121,126,207,247,1,154,40,58,5,137,22,164,110,53,230,238,161,151,41,200,162,69,209,218,133,223,199,108,76,
+  65,214,237,13,181,154,255,115,2,191,143,217,60,78,35,231,246,134,128,194,213,205,107,232,164,39,195,5,205,128,182,197,
+  195,201,236,197,241,9,189,84,11,32,91,195,70,110,28,42,213,0,139,23,144,21,112,46,1,136,242,155,217,199,95,25,
+  5,121,149,40,120,2,65,227,71,21,160,248,125,172,221,227,52,86,221,222,16,140,159,215,65,40,69,185,12,128,47,66,
+  95,79,65,91,137,65,202,146,58,232,58,209,103,182,40,189,54,228,79,15,236,171,188,142,68,197,50,0,40,19,23,132,
+  94,13,83,170,252,166,170,12,82,74,8,193,33,132,128,224,107,40,175,167,96,178,152,200,142,174,93,157,157,98,237,208,
+  238,253,250,163,72,84,24,244,101,146,217,231,67,94,176,142,147,0,0,206,117,44,124,251,136,197,239,113,164,211,95,234,
+  6,86,212,226,176,247,187,96,110,103,7,134,157,221,225,237,51,24,25,195,66,226,38,246,184,174,64,240,98,93,88,20,
+  239,34,147,101,40,235,28,61,142,75,248,244,118,186,116,252,108,218,170,2,64,32,104,104,240,49,59,48,153,115,143,140,
+  1,0,98,51,119,234,223,203,66,224,58,114,25,133,204,3,152,204,58,8,145,106,93,15,2,65,67,155,77,50,251,252,
+  179,201,205,204,208,40,200,208,40,8,128,131,165,188,60,149,152,187,253,190,111,224,28,184,232,0,145,210,132,191,213,184,
+  81,149,195,247,225,120,55,77,229,234,242,13,17,121,104,147,219,154,88,187,115,35,127,248,60,150,20,97,149,27,197,56,
+  132,106,207,55,5,52,131,68,167,48,216,237,56,44,180,236,18,0,220,106,248,153,254,161,163,93,59,247,206,124,142,61,
+  169,28,59,163,93,251,111,128,108,235,183,166,62,60,127,65,117,237,105,213,251,5,5,22,226,37,43,190,36,20,0,0,
+  0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Undo2x[1601] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,5,211,73,68,65,84,88,133,
+  197,150,125,108,85,119,25,199,63,207,57,231,222,222,190,93,144,118,117,27,20,186,14,161,50,100,171,194,34,173,155,56,
+  230,31,37,154,249,135,36,51,1,6,203,162,115,9,38,154,104,50,199,98,124,153,38,102,70,17,255,113,142,217,209,45,
+  234,166,46,190,100,217,116,51,200,104,129,241,166,161,172,140,82,70,75,129,74,105,239,229,246,246,190,156,151,223,227,31,
+  237,189,94,46,151,174,47,75,124,146,39,191,223,185,247,119,206,247,243,123,126,207,243,156,35,170,202,255,211,172,217,223,
+  42,210,245,188,124,255,232,51,50,111,46,0,206,108,110,58,244,162,68,141,242,71,133,245,99,97,126,50,23,128,25,71,
+  96,255,30,89,102,140,156,88,180,226,193,123,45,219,113,231,34,62,99,128,206,118,217,224,56,149,199,150,181,126,187,190,
+  174,241,243,33,133,57,39,208,180,1,14,236,145,39,35,243,26,254,112,199,250,167,43,43,170,171,4,100,174,218,192,52,
+  114,224,111,29,82,89,13,191,93,176,232,190,251,23,55,127,37,162,222,59,4,217,51,88,225,219,248,32,32,166,4,56,
+  216,46,13,213,142,245,247,197,119,62,182,164,118,241,250,80,144,57,130,6,151,65,156,15,68,124,74,128,174,95,203,125,
+  118,164,250,149,166,214,31,84,151,207,175,151,32,125,20,53,73,192,102,226,228,4,17,177,195,54,23,15,188,32,113,132,
+  115,26,240,123,49,188,186,118,171,158,154,46,128,148,106,68,93,123,228,27,229,209,165,79,45,107,253,94,196,9,5,4,
+  217,211,160,89,84,179,249,49,84,213,6,102,140,192,143,227,187,35,184,201,62,18,87,222,115,135,251,255,229,171,113,223,
+  240,60,30,185,103,155,14,207,8,96,111,187,68,194,54,237,11,22,174,127,160,161,249,171,17,13,250,81,127,8,0,197,
+  7,245,38,1,92,48,30,106,174,18,248,67,96,198,16,171,10,187,236,163,136,83,207,232,224,191,253,75,125,135,50,158,
+  55,250,104,235,38,125,113,90,0,157,207,73,181,21,162,243,214,166,77,203,111,94,246,64,216,79,31,1,77,146,47,20,
+  13,0,31,85,15,76,18,111,124,47,26,92,191,65,177,62,132,83,126,55,106,223,69,127,247,159,51,227,163,61,7,98,
+  163,180,181,109,215,108,41,128,124,25,182,62,172,99,8,187,71,6,247,7,94,54,134,229,212,162,38,3,38,13,38,141,
+  106,6,213,44,26,196,112,147,175,151,20,7,80,19,195,27,127,157,32,213,65,99,243,231,34,11,22,54,183,204,159,207,
+  143,166,117,4,0,157,123,164,205,9,71,95,94,222,250,120,69,164,34,42,126,230,48,168,15,24,52,72,224,141,191,9,
+  154,102,162,10,166,238,67,98,215,224,68,31,162,247,237,63,101,50,241,190,123,91,182,234,225,247,5,0,232,234,144,149,
+  96,255,99,233,154,199,22,68,63,124,167,237,143,239,195,120,3,248,233,183,65,83,0,68,106,119,128,6,168,166,65,51,
+  104,48,138,159,57,129,113,79,3,65,254,89,118,217,199,240,204,26,237,61,244,92,255,188,8,203,87,108,212,107,218,119,
+  201,78,216,178,89,187,33,88,217,119,100,87,207,197,158,223,184,226,220,130,241,206,229,197,39,208,133,238,127,238,242,123,
+  246,63,159,58,123,252,47,99,255,233,239,117,125,86,83,86,243,53,236,200,154,252,178,32,123,146,72,165,74,244,166,37,
+  55,197,210,124,169,88,235,134,173,184,101,179,94,206,250,172,185,124,246,205,215,206,30,253,93,218,169,250,34,118,100,245,
+  255,22,168,135,239,101,2,119,60,182,46,49,124,225,193,75,103,143,127,171,247,80,199,197,247,142,181,167,196,110,194,169,
+  88,55,249,120,67,144,62,66,180,182,190,66,132,21,211,6,0,88,183,85,51,159,220,196,23,146,163,231,118,158,234,124,
+  54,173,214,42,156,202,251,1,11,53,19,209,112,161,183,117,171,190,250,169,45,186,51,30,163,49,49,28,251,233,201,206,
+  151,50,190,95,129,93,118,7,0,38,24,33,84,230,136,37,172,154,17,192,228,86,117,237,102,125,220,77,199,191,252,110,
+  103,71,42,155,14,17,170,218,128,154,113,138,147,176,109,187,102,91,30,210,29,26,100,159,24,56,185,47,101,133,26,64,
+  194,168,73,226,132,64,225,35,179,0,152,176,150,45,250,130,241,188,207,158,57,250,218,213,248,229,11,102,162,18,74,219,
+  133,114,118,166,147,201,243,137,145,126,21,187,14,193,66,100,28,85,106,102,13,0,176,118,155,118,121,170,205,131,239,30,
+  63,127,241,244,91,158,168,150,124,35,109,220,168,129,26,158,73,93,189,226,137,132,193,170,32,51,54,140,8,239,204,10,
+  64,38,204,18,17,251,211,91,24,232,235,225,19,35,131,231,15,27,99,194,221,103,8,137,136,83,224,182,136,88,198,48,
+  230,123,105,31,12,34,101,36,70,227,89,19,240,215,105,1,20,8,58,34,18,2,66,64,56,231,155,127,72,122,251,207,
+  217,224,186,236,238,191,64,8,40,43,252,31,8,103,125,162,106,44,65,3,60,215,16,27,74,248,150,207,47,175,211,42,
+  108,68,34,34,147,80,57,151,162,121,177,19,141,34,137,68,62,27,21,208,187,155,112,126,246,4,7,151,52,213,213,150,
+  87,133,130,193,211,35,214,200,72,230,233,207,60,204,143,1,163,170,38,167,233,20,136,91,69,226,165,92,40,130,73,36,
+  242,194,185,209,124,125,27,109,149,213,33,55,20,49,167,134,6,98,243,227,241,204,129,29,187,217,197,196,199,132,76,110,
+  212,168,170,138,170,230,118,110,23,137,21,95,23,254,86,8,146,51,3,152,103,191,203,218,166,165,214,35,117,245,225,84,
+  42,238,70,71,135,205,201,239,252,130,167,222,58,78,42,183,102,210,3,85,53,57,128,27,9,79,103,46,128,185,125,17,
+  246,147,143,178,174,177,129,213,149,81,178,233,36,161,115,3,188,241,205,157,236,187,116,9,183,80,56,55,87,213,160,48,
+  2,165,118,93,42,10,215,68,96,245,42,42,238,249,56,53,119,53,113,251,45,117,44,244,125,198,98,49,134,246,30,228,
+  196,175,94,225,74,177,104,193,117,144,63,130,201,28,184,17,196,53,137,88,85,133,93,83,131,211,120,43,225,149,183,81,
+  89,123,51,229,21,22,142,103,240,135,6,72,238,239,38,113,236,20,217,34,65,45,2,9,116,82,248,186,215,113,209,113,
+  188,111,21,20,216,53,149,80,36,156,27,125,45,18,44,249,61,80,0,51,21,64,126,89,145,120,110,204,71,160,88,116,
+  218,0,83,64,149,18,159,80,158,225,3,255,11,231,4,232,84,96,74,192,97,0,0,0,0,73,69,78,68,174,66,96,
+  130,
+};
+}
+namespace Emblem {
+const unsigned char Archive1x[540] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,213,6,16,18,24,9,181,27,210,224,0,0,1,169,73,
+  68,65,84,56,203,173,146,49,104,84,65,16,134,191,217,219,221,119,119,201,61,98,12,65,174,16,17,4,145,32,73,35,
+  138,77,196,198,82,9,40,135,141,88,40,150,17,11,59,175,72,41,30,164,17,148,20,177,9,104,21,44,4,69,15,181,
+  20,244,154,136,98,108,140,152,34,42,81,162,225,93,222,219,177,120,57,21,35,120,81,167,153,217,129,255,155,217,153,129,
+  127,52,1,104,212,204,48,240,108,147,218,145,241,153,208,146,70,205,52,129,209,179,87,23,244,253,252,99,21,91,54,160,
+  0,24,35,185,23,72,62,47,98,74,3,25,105,34,47,158,222,51,115,15,167,1,234,22,224,244,229,86,150,44,191,49,
+  179,147,167,196,59,7,192,218,90,27,31,69,8,130,115,14,83,112,248,184,90,56,118,241,14,75,111,159,179,251,192,24,
+  175,91,247,71,45,176,67,140,152,144,165,98,10,158,52,228,253,69,189,3,0,84,250,171,32,6,128,234,174,125,180,87,
+  222,17,40,80,217,178,13,13,217,176,5,250,146,149,15,188,124,114,155,147,23,166,64,179,13,159,85,5,80,8,109,210,
+  143,175,72,86,63,225,138,49,0,22,40,62,186,57,33,135,143,158,131,244,11,100,171,160,1,213,12,66,138,106,200,125,
+  88,7,107,96,207,222,253,60,152,189,14,104,209,2,126,112,251,144,98,140,224,43,64,229,199,122,80,36,175,189,254,166,
+  51,95,134,70,14,178,48,215,140,164,81,51,151,128,250,95,158,65,189,115,7,122,228,196,121,150,231,155,93,169,226,157,
+  135,184,123,235,10,227,51,65,108,39,233,163,50,61,241,214,174,0,206,71,223,227,159,0,37,136,251,187,2,152,168,184,
+  17,224,74,61,216,46,1,169,251,93,7,113,149,224,123,255,32,205,247,17,130,252,2,176,229,107,211,19,199,207,108,102,
+  252,95,19,189,193,255,176,111,224,210,135,204,19,41,165,180,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Archive2x[1067] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,3,226,73,68,65,84,88,133,237,150,95,136,212,
+  85,20,199,63,231,222,251,251,253,102,102,103,255,142,166,27,150,150,88,144,102,127,31,218,40,49,200,36,136,68,200,30,
+  20,218,212,13,89,84,8,138,30,138,222,10,122,232,205,212,44,89,55,145,192,146,32,168,232,37,42,208,212,84,212,165,
+  32,162,168,101,21,203,221,213,253,51,237,56,51,191,223,189,61,252,134,217,217,117,86,155,26,240,161,253,194,225,222,115,
+  239,253,157,251,189,231,158,223,57,23,102,49,139,255,59,228,90,147,189,47,164,151,26,63,120,51,12,243,107,156,184,60,
+  14,59,229,75,135,2,130,234,70,5,45,114,196,89,121,233,185,247,198,142,215,68,96,223,150,166,37,126,144,58,168,148,
+  190,115,249,163,107,82,205,109,237,68,81,136,32,24,63,0,229,163,76,2,209,1,202,76,138,232,4,202,11,80,58,32,
+  180,206,253,240,117,143,244,159,250,232,47,27,113,209,138,125,165,115,87,246,208,117,9,236,239,106,190,77,18,254,137,101,
+  43,58,91,231,45,186,67,141,12,156,117,103,15,127,38,78,0,231,112,81,30,163,4,163,193,211,130,209,130,167,193,76,
+  235,39,146,45,100,30,123,195,93,56,190,215,133,131,167,213,207,231,70,115,69,203,182,141,239,142,247,84,238,167,43,149,
+  3,93,201,5,36,147,199,239,93,221,221,182,248,129,213,122,252,66,31,167,191,249,88,10,133,43,216,40,196,218,8,37,
+  160,68,80,10,180,18,148,18,180,2,53,173,47,46,79,225,242,79,114,83,199,139,146,255,227,20,173,137,208,27,30,203,
+  175,122,250,65,51,240,233,201,98,223,85,30,120,191,171,97,94,50,149,60,185,108,229,166,246,246,37,29,218,141,253,138,
+  23,52,80,140,38,157,100,157,5,107,65,25,68,123,177,168,88,40,181,162,13,136,46,27,78,54,207,167,144,27,167,175,
+  119,45,162,52,191,93,24,155,112,214,110,234,220,147,61,88,38,208,179,49,61,55,104,76,29,107,91,176,116,161,56,114,
+  67,3,125,233,71,158,121,141,230,185,183,146,27,57,55,121,95,162,64,52,136,138,5,13,74,226,13,69,202,115,18,7,
+  40,0,65,67,134,200,193,151,59,214,227,108,33,151,12,252,68,54,151,15,113,172,239,220,147,61,36,123,55,55,181,25,
+  99,135,1,252,32,117,62,44,230,191,187,253,190,39,215,221,179,122,27,209,200,47,224,44,206,89,112,46,182,234,92,172,
+  151,250,255,100,204,207,220,69,118,228,34,95,125,240,242,69,92,120,38,178,246,9,0,177,108,85,198,68,111,3,160,100,
+  205,149,98,126,69,208,152,121,106,249,170,173,68,163,191,99,139,19,216,98,14,23,94,41,139,13,167,233,197,220,117,199,
+  242,127,158,165,113,206,34,238,94,185,161,69,180,30,182,74,47,22,56,234,20,59,167,252,5,7,182,207,57,252,248,230,
+  221,15,167,51,11,175,153,31,254,11,190,221,191,61,55,116,254,199,141,157,187,42,98,0,96,95,119,211,67,98,237,81,
+  165,117,81,68,121,162,52,206,70,53,152,118,51,206,136,196,182,28,46,111,163,40,0,120,126,79,86,166,16,112,32,31,
+  118,55,183,0,20,109,116,169,99,237,171,12,28,235,169,110,177,70,220,124,255,58,190,255,124,7,158,210,109,0,158,248,
+  197,103,119,13,102,1,76,153,37,56,118,143,94,6,232,221,146,38,145,74,147,76,165,235,66,32,72,54,2,176,161,100,
+  191,18,230,170,213,37,40,109,240,147,13,117,33,160,141,55,227,220,140,4,180,241,240,19,245,241,128,54,126,237,4,140,
+  246,8,18,245,241,128,249,247,30,184,145,4,60,143,160,78,49,96,252,242,21,248,64,225,90,4,2,160,21,226,138,103,
+  252,20,184,90,114,65,21,136,66,169,114,209,189,5,24,3,46,1,81,53,2,205,64,198,41,111,112,184,255,204,220,204,
+  194,142,210,112,69,146,113,149,9,199,149,117,87,117,77,220,14,245,247,97,197,27,2,230,151,246,140,74,36,166,16,208,
+  37,221,251,226,244,196,91,216,157,175,11,97,75,141,231,173,10,135,25,249,228,196,196,59,64,2,240,168,120,135,76,207,
+  249,173,64,166,212,6,196,119,86,15,20,0,5,100,137,79,126,30,40,86,35,0,144,4,90,74,155,207,24,164,53,34,
+  36,190,143,81,96,28,38,31,183,215,171,122,245,170,138,51,87,170,89,220,104,252,13,162,179,143,166,193,167,182,66,0,
+  0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Audio1x[688] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,2,45,73,68,65,84,56,141,165,146,63,104,83,113,16,199,63,247,123,
+  239,165,125,201,139,173,182,52,181,162,130,72,139,184,57,84,193,81,232,32,69,28,44,22,43,213,65,176,168,139,131,139,
+  130,116,18,156,156,85,4,7,55,209,81,23,5,65,28,28,212,69,7,161,96,165,54,109,109,211,166,77,94,146,247,239,
+  119,14,117,146,196,165,55,222,113,31,190,119,124,68,85,217,73,153,29,109,3,110,187,230,165,27,123,159,138,232,49,85,
+  12,136,3,8,162,70,21,71,20,163,130,128,56,40,171,109,1,89,166,231,199,199,79,117,15,244,13,179,43,216,71,193,
+  239,195,243,2,140,113,200,178,136,86,84,165,222,92,230,209,147,7,253,109,1,0,131,3,251,201,251,62,65,16,80,44,
+  148,8,252,33,114,94,145,86,84,161,22,46,144,247,3,16,180,35,160,90,155,39,177,91,196,73,141,122,163,76,87,174,
+  7,193,33,73,67,162,100,147,40,222,0,171,210,17,144,164,13,94,188,124,95,111,54,50,81,139,108,255,3,81,85,227,
+  229,76,58,49,49,230,91,181,157,1,160,108,85,211,32,197,61,136,155,196,110,230,165,41,205,164,133,159,20,163,116,83,
+  85,81,254,147,64,213,34,34,60,127,88,94,208,127,100,153,154,41,97,53,67,173,74,71,15,172,166,128,232,236,44,210,
+  118,110,83,64,59,139,100,109,138,8,188,235,32,155,181,9,86,255,158,48,53,51,112,218,245,204,109,207,20,142,231,186,
+  242,226,122,110,166,196,136,160,195,101,100,242,106,105,172,203,53,247,242,249,222,67,34,226,56,174,177,86,99,80,196,189,
+  120,109,240,130,231,57,143,207,158,57,151,31,57,124,146,176,185,196,74,229,147,179,81,155,67,21,66,51,120,179,191,183,
+  231,238,244,228,173,194,158,221,67,132,205,21,150,42,31,217,10,231,0,196,117,140,92,25,57,90,200,71,250,149,239,63,
+  23,105,69,235,52,163,53,204,118,56,5,123,103,244,196,129,194,239,173,183,44,87,83,154,113,133,36,9,49,198,67,21,
+  227,42,250,225,199,92,99,180,216,83,46,248,254,10,105,170,132,245,140,122,173,129,181,214,184,142,172,46,150,127,21,115,
+  221,137,136,24,162,86,68,101,189,65,101,173,145,0,70,84,149,233,235,165,251,32,151,179,76,251,68,36,113,92,153,71,
+  245,115,26,235,43,208,111,142,103,158,101,153,30,49,70,98,133,204,49,242,37,77,236,27,140,121,253,7,117,49,14,53,
+  175,233,38,194,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Audio2x[1486] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,5,75,73,68,65,84,88,133,237,151,91,111,92,213,21,199,127,107,159,
+  57,103,46,190,197,30,103,198,78,99,55,14,77,104,176,73,105,170,132,136,84,85,81,73,145,202,11,237,131,165,10,247,
+  1,9,138,210,34,168,4,66,45,79,230,3,180,223,160,162,125,168,90,241,208,23,30,42,40,106,131,68,133,40,74,155,
+  42,81,19,40,40,41,132,56,246,140,61,227,185,156,57,115,46,123,241,224,51,48,197,9,216,181,43,94,186,164,165,45,
+  29,237,181,214,127,255,215,101,239,35,170,202,231,41,230,115,141,254,127,0,64,230,127,225,116,126,94,28,179,103,252,54,
+  199,152,57,148,59,29,215,156,16,116,220,180,187,247,63,255,124,173,190,107,0,158,123,78,204,165,235,165,25,81,153,53,
+  98,231,50,158,185,27,203,81,119,172,188,111,116,116,172,187,255,11,251,101,188,88,44,12,143,228,205,75,47,191,226,183,
+  221,164,4,252,247,0,22,30,157,56,105,141,126,195,245,228,36,112,52,142,202,83,147,227,19,209,161,195,115,220,54,115,
+  52,63,53,121,196,236,25,217,71,46,55,132,181,161,215,233,86,105,119,86,8,163,117,94,249,211,159,19,215,138,253,164,
+  207,109,1,208,12,103,79,158,56,158,153,218,119,208,217,55,113,152,210,248,97,6,10,101,207,117,6,200,56,89,68,28,
+  18,219,165,27,214,169,53,223,165,214,120,139,70,235,61,28,227,146,36,33,145,35,155,122,126,123,41,80,117,190,114,231,
+  172,147,113,115,136,211,166,214,124,139,181,198,37,162,184,69,16,214,233,4,21,130,176,70,28,119,48,38,131,49,30,34,
+  6,193,224,152,156,120,182,189,51,6,0,26,254,53,154,254,123,8,138,72,6,207,29,34,159,29,167,144,47,81,28,185,
+  131,40,246,89,171,93,167,186,182,66,181,90,141,155,205,102,248,213,99,135,10,168,146,168,217,57,128,56,246,25,30,152,
+  194,117,10,4,65,66,171,229,179,252,193,138,173,84,223,246,111,44,45,219,70,163,149,51,25,89,17,229,66,28,219,55,
+  92,207,251,201,236,172,45,128,197,102,119,88,3,61,121,245,236,185,214,210,7,235,158,24,26,198,200,63,147,216,190,161,
+  150,127,168,114,33,94,223,123,249,133,23,46,134,189,189,15,63,57,253,24,176,199,162,226,132,193,206,106,64,68,80,96,
+  101,197,247,146,40,153,249,237,47,43,215,183,98,167,170,144,168,36,118,115,10,182,63,9,213,130,85,73,114,210,216,202,
+  118,35,130,98,81,32,201,109,78,193,54,1,8,86,19,20,21,178,217,100,43,22,86,21,213,4,139,74,38,220,220,134,
+  219,102,64,53,65,85,165,21,231,54,157,230,150,32,108,130,42,196,201,46,164,192,218,24,107,213,116,138,239,108,137,1,
+  0,171,9,88,149,124,193,217,5,0,26,3,200,217,69,182,14,192,70,40,74,108,91,187,195,0,40,186,141,167,148,181,
+  49,170,42,94,103,199,53,160,36,54,66,132,45,231,95,84,213,218,8,85,149,104,104,23,106,32,73,162,13,36,91,20,
+  77,65,131,74,152,108,174,129,207,28,68,243,243,115,94,118,116,185,216,173,85,87,220,177,18,113,18,97,63,65,255,119,
+  158,56,148,29,11,154,167,141,199,67,106,185,207,24,49,32,161,162,177,181,148,32,66,85,201,181,204,103,79,66,17,145,
+  239,63,82,190,55,227,201,143,17,115,255,216,244,80,214,117,39,163,96,112,204,233,248,117,172,141,16,62,30,40,11,143,
+  22,247,23,189,204,235,163,123,135,70,78,28,191,103,240,75,7,191,38,195,131,147,116,187,77,58,65,141,229,213,243,212,
+  218,231,81,144,96,220,253,116,6,22,206,148,159,89,248,81,249,233,3,95,252,114,225,212,201,251,10,7,166,238,16,171,
+  62,157,238,106,198,239,84,184,182,252,230,198,77,152,214,192,252,188,56,185,189,19,127,189,253,72,177,244,189,7,158,117,
+  134,7,166,9,163,22,237,206,18,173,224,10,141,246,85,252,240,93,170,149,0,35,178,62,59,114,173,123,75,0,63,120,
+  124,242,231,249,130,243,216,177,227,19,3,223,254,250,83,128,16,197,109,252,78,133,90,227,109,106,205,127,17,68,55,104,
+  53,19,140,145,42,128,41,150,143,184,174,51,116,207,221,167,157,27,213,115,196,177,79,16,173,179,90,191,68,165,118,158,
+  40,246,169,173,69,92,252,123,203,239,118,237,131,139,139,232,226,162,72,127,7,101,122,180,63,116,166,252,195,111,222,59,
+  59,128,105,115,245,250,31,25,29,62,68,24,54,88,93,191,76,165,126,1,107,67,86,43,17,23,207,55,253,40,100,81,
+  68,220,111,125,119,104,201,157,40,4,103,95,123,49,63,94,202,58,142,121,25,107,45,137,141,168,175,197,250,239,43,29,
+  63,10,181,225,119,226,103,127,255,171,213,115,105,60,43,34,182,7,66,216,232,4,111,225,76,249,111,7,14,14,222,62,
+  125,208,53,158,187,241,188,178,106,241,253,14,75,215,2,251,254,213,110,144,196,90,93,175,39,63,123,241,119,213,63,164,
+  182,114,234,244,200,204,244,76,246,167,142,35,167,0,85,84,5,52,142,184,188,244,126,248,235,87,95,170,191,6,68,64,
+  183,79,19,32,81,85,149,20,213,224,220,93,131,119,29,57,150,255,133,155,145,163,8,168,226,0,10,18,181,155,201,235,
+  87,222,233,254,230,194,155,205,191,0,62,96,83,224,210,183,122,169,175,12,224,164,223,109,95,112,63,213,14,16,2,177,
+  170,218,158,131,60,48,6,76,228,243,206,1,43,90,138,34,235,218,136,128,141,103,116,5,168,2,235,169,67,219,99,32,
+  181,55,105,80,183,15,128,108,28,128,24,8,82,237,164,107,212,207,192,71,105,72,129,12,164,107,38,165,170,155,26,118,
+  83,228,253,189,44,252,39,16,167,239,244,38,221,107,83,16,113,26,56,238,5,135,141,73,73,175,16,251,232,236,169,222,
+  68,111,38,114,19,237,151,158,173,5,180,191,11,100,55,127,207,211,67,220,82,110,118,129,125,8,131,154,186,48,34,246,
+  217,6,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Binary1x[560] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,213,4,22,20,7,56,114,185,172,74,0,0,1,189,73,
+  68,65,84,56,203,181,147,205,78,19,97,20,134,159,239,155,111,102,164,77,72,40,130,164,96,59,13,144,9,198,40,104,
+  32,97,163,27,72,240,6,184,0,55,77,220,176,96,227,206,112,1,46,154,184,97,195,5,52,222,128,209,149,113,229,66,
+  170,9,218,81,204,12,161,105,11,180,252,101,250,135,40,46,148,102,20,102,118,188,201,89,62,79,78,242,158,3,33,89,
+  92,90,157,156,89,120,122,182,184,180,58,73,68,100,24,236,57,238,250,243,103,143,241,28,119,61,74,34,163,224,98,105,
+  135,137,123,118,164,68,134,193,155,149,26,186,210,184,51,62,76,98,100,40,84,34,47,93,123,119,31,93,73,116,77,131,
+  51,232,49,12,44,59,115,169,68,252,15,151,234,135,8,4,66,128,16,130,79,197,18,166,161,56,61,253,201,23,183,138,
+  231,184,88,118,102,42,159,203,22,0,100,16,174,30,28,163,107,26,186,250,51,237,246,15,248,5,137,222,56,183,70,147,
+  12,247,247,5,55,153,3,80,231,112,237,184,129,174,52,132,16,8,4,141,86,135,218,190,207,221,137,155,92,51,21,239,
+  222,111,34,17,164,7,250,1,240,28,247,53,32,164,101,103,230,151,87,214,184,222,27,167,213,58,193,111,180,249,238,237,
+  178,181,93,167,92,57,164,217,232,80,174,28,161,164,36,102,26,108,237,213,241,28,151,212,88,234,62,128,204,231,178,111,
+  44,59,51,181,188,178,198,200,96,31,27,197,50,123,53,31,223,239,48,150,30,36,149,76,208,106,158,16,51,13,156,114,
+  181,11,191,124,241,228,67,183,133,124,46,91,56,151,60,122,120,155,184,105,16,55,13,142,14,154,72,33,80,66,242,209,
+  43,93,128,255,169,49,40,121,48,59,78,204,52,24,77,15,96,234,138,183,27,223,240,28,151,164,117,99,58,8,119,107,
+  12,59,166,175,197,29,94,21,62,95,168,46,82,16,148,252,173,44,20,142,76,224,27,231,184,202,252,6,31,155,240,68,
+  82,120,70,77,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Binary2x[1675] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,6,66,73,68,65,84,88,133,229,151,217,115,84,
+  85,30,199,191,231,119,238,146,78,210,183,59,107,147,116,167,151,132,152,72,132,208,128,27,13,9,104,160,28,202,146,161,
+  3,79,83,214,164,242,52,207,62,251,224,195,252,13,62,88,53,37,102,134,69,12,250,162,165,14,58,162,65,81,17,179,
+  66,7,59,91,111,233,108,244,96,210,33,73,247,237,123,231,161,23,110,98,2,1,103,158,230,86,253,234,156,170,123,239,
+  249,124,206,249,253,234,87,117,128,255,247,135,253,158,159,143,118,116,119,106,76,239,37,157,94,253,234,139,191,125,242,36,
+  107,208,239,129,103,152,126,94,177,213,32,67,218,135,109,199,186,78,60,201,58,252,73,225,26,99,231,188,190,131,242,169,
+  147,29,88,211,56,159,137,70,207,184,234,247,254,28,154,24,8,254,79,5,142,118,116,119,106,132,243,222,67,62,217,225,
+  170,195,59,189,223,224,224,179,45,40,85,20,30,143,68,30,91,226,177,4,142,118,116,119,130,211,133,87,94,123,69,42,
+  171,182,225,131,43,55,161,105,192,157,169,89,28,122,174,5,102,197,194,167,195,225,199,146,216,182,64,91,71,151,159,56,
+  191,248,122,215,105,241,233,150,167,240,246,197,175,0,157,65,32,2,17,67,48,52,7,223,129,93,48,91,44,60,22,10,
+  159,113,55,236,187,25,26,239,31,251,175,8,180,117,116,249,193,232,194,159,94,247,75,45,45,77,24,15,207,195,251,180,
+  19,7,118,185,112,247,94,18,43,171,105,16,99,24,11,207,227,57,111,19,20,139,149,71,67,83,219,146,120,164,64,91,
+  71,151,159,49,186,112,224,240,33,105,207,158,102,68,226,255,6,24,64,44,187,243,249,68,18,139,75,171,16,56,129,24,
+  195,100,100,1,251,91,159,202,74,132,31,45,241,80,129,60,124,223,33,159,84,235,172,67,96,124,6,85,21,102,16,17,
+  194,211,119,241,237,207,227,152,187,187,4,129,19,4,226,16,136,192,115,239,188,187,119,66,177,150,241,72,40,116,198,221,
+  224,221,82,98,203,62,208,126,172,251,20,35,186,224,245,249,164,29,14,59,62,191,54,130,180,154,1,39,2,103,12,137,
+  123,247,113,127,37,5,81,224,16,57,135,40,80,97,78,68,184,118,115,12,110,143,27,190,246,118,137,129,125,212,126,188,
+  251,15,219,22,104,63,214,125,10,76,191,232,61,152,133,255,235,251,81,112,70,133,99,38,202,206,69,158,135,103,71,129,
+  19,132,220,156,51,194,15,131,147,112,215,123,224,59,210,38,211,22,18,191,73,65,30,190,247,69,159,84,227,112,224,155,
+  159,126,1,129,65,224,4,119,109,5,170,203,205,32,98,208,52,29,43,43,41,168,25,173,112,244,198,84,8,156,192,25,
+  97,110,97,17,187,154,60,80,172,86,33,58,21,58,237,118,183,254,52,53,57,48,182,169,192,145,227,93,127,4,195,251,
+  173,47,100,119,254,93,255,120,1,46,16,161,209,85,13,171,82,12,98,12,101,74,49,26,221,54,164,83,42,150,150,215,
+  10,223,100,225,188,48,231,68,88,72,36,209,220,232,130,181,204,42,132,67,225,51,70,137,7,41,120,235,45,210,117,246,
+  81,149,221,37,181,182,54,227,198,208,36,56,123,144,87,145,115,216,42,20,112,198,178,117,64,12,196,24,86,83,234,186,
+  111,178,115,130,73,22,81,91,109,133,44,8,224,140,16,28,159,197,97,223,126,212,185,93,178,78,236,211,223,158,192,213,
+  171,122,125,189,119,96,121,121,209,207,4,19,111,110,116,98,62,177,84,200,125,185,165,4,205,245,59,64,68,88,76,174,
+  224,202,181,0,198,166,230,145,74,169,133,221,154,100,17,12,217,230,100,171,84,240,236,30,55,146,203,107,72,165,51,216,
+  183,219,133,196,92,28,125,125,215,83,200,104,175,230,79,96,93,10,166,38,6,238,120,26,90,71,102,98,81,191,217,98,
+  229,77,13,78,220,189,151,4,39,194,174,134,26,84,150,149,130,17,67,40,150,192,226,210,202,131,156,115,66,133,181,4,
+  109,207,55,98,109,85,133,36,114,212,213,150,67,49,155,80,93,105,198,254,221,78,68,67,97,156,59,255,97,42,147,86,
+  79,94,253,242,236,103,91,22,225,212,248,192,168,167,161,117,36,30,139,250,45,214,50,190,211,227,192,210,242,26,246,63,
+  227,130,32,16,136,17,130,147,179,80,85,173,80,108,2,113,232,58,208,224,172,66,173,205,10,103,109,5,44,102,19,136,
+  8,149,229,165,24,25,30,197,63,206,93,78,111,132,111,42,96,148,152,142,70,252,86,107,57,63,122,112,55,100,89,0,
+  67,182,251,217,42,21,36,147,107,40,41,150,80,95,87,133,213,149,20,158,105,178,67,49,155,10,29,146,136,80,102,41,
+  198,224,208,109,244,252,253,114,58,147,86,95,219,8,223,82,96,189,68,180,179,185,201,195,157,142,26,164,83,42,136,8,
+  178,40,64,18,57,100,81,64,131,179,26,110,71,37,148,210,34,16,35,176,28,220,170,152,48,56,20,64,79,207,229,116,
+  38,157,222,20,254,80,129,188,132,171,222,59,50,60,28,232,116,56,106,72,42,50,97,240,86,12,153,140,134,88,252,30,
+  150,146,171,112,218,203,193,11,13,42,11,87,204,121,120,239,67,225,143,20,0,128,208,68,255,168,211,179,119,100,104,232,
+  182,159,139,197,188,178,170,28,247,151,83,80,211,26,154,118,238,128,82,106,2,203,117,71,34,6,115,105,81,246,216,123,
+  122,211,170,150,57,249,245,23,239,110,9,223,150,64,78,34,104,119,182,4,98,145,200,201,138,138,42,254,114,219,30,216,
+  119,88,97,46,41,42,180,102,34,134,210,146,34,12,15,7,240,94,79,111,122,117,109,229,116,223,151,239,253,51,183,132,
+  254,36,2,4,64,2,80,4,64,14,79,14,133,170,108,158,224,108,60,126,130,139,37,188,169,209,9,77,211,11,69,87,
+  82,44,99,104,56,128,119,123,46,169,139,191,46,252,249,135,190,75,87,1,8,57,70,190,225,105,219,21,16,1,200,27,
+  99,58,18,8,91,202,107,39,98,177,217,227,110,151,157,219,107,170,161,105,58,138,77,89,248,217,158,75,234,194,124,244,
+  47,253,63,126,220,103,128,231,5,8,217,107,128,110,60,145,205,4,120,78,64,50,68,65,98,102,58,24,43,85,42,38,
+  127,25,139,190,228,114,216,169,206,97,195,224,208,109,156,237,185,164,198,167,39,222,24,233,191,114,61,7,55,66,141,247,
+  15,29,64,230,81,2,66,78,66,200,9,228,133,100,0,242,220,204,68,188,200,100,14,7,39,166,219,18,137,69,250,248,
+  211,43,153,104,248,206,155,163,195,95,223,48,64,141,64,45,23,25,195,184,165,128,102,176,231,134,49,47,198,1,136,11,
+  115,161,184,44,149,196,18,191,174,30,142,132,110,253,53,24,184,126,99,3,72,221,16,105,67,20,82,240,176,171,89,190,
+  14,36,195,104,12,209,32,152,223,101,30,144,218,16,107,134,113,93,33,110,231,110,152,79,135,132,245,169,201,195,141,133,
+  149,49,236,222,40,179,110,215,143,43,176,217,63,70,120,126,141,141,185,222,214,243,31,50,77,124,34,176,20,164,223,0,
+  0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char File1x[741] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,0,18,116,69,88,116,84,105,116,108,101,0,80,97,112,101,114,32,83,
+  104,101,101,116,115,185,175,145,249,0,0,0,23,116,69,88,116,65,117,116,104,111,114,0,76,97,112,111,32,67,97,108,
+  97,109,97,110,100,114,101,105,223,145,26,42,0,0,0,39,116,69,88,116,68,101,115,99,114,105,112,116,105,111,110,0,
+  119,105,116,104,32,97,32,72,85,71,69,32,104,101,108,112,32,102,114,111,109,32,74,97,107,117,98,134,84,7,179,0,
+  0,1,238,73,68,65,84,56,141,133,147,77,107,83,65,20,134,159,51,247,166,26,80,209,104,177,181,136,27,107,55,138,
+  127,64,68,220,248,1,42,184,240,71,40,226,170,11,23,130,63,65,20,44,85,132,46,42,22,63,176,208,160,155,254,27,
+  181,177,109,154,144,80,53,201,153,153,227,226,222,155,220,166,130,7,14,51,12,243,62,231,61,51,28,49,51,234,95,87,
+  111,136,200,98,8,241,52,24,102,134,25,128,1,252,1,89,143,49,60,191,123,231,222,58,227,97,102,172,174,125,252,190,
+  211,106,90,140,113,95,14,6,125,219,104,252,176,181,47,171,191,87,62,188,125,156,193,71,233,0,250,253,254,204,177,163,
+  53,118,127,237,210,233,182,217,105,111,179,213,108,176,241,243,27,155,219,13,186,157,14,55,175,221,170,78,158,152,124,178,
+  252,110,105,190,108,192,1,168,122,0,66,80,124,240,132,16,178,140,17,245,202,86,115,19,231,28,87,46,95,173,30,152,
+  56,248,244,205,210,171,75,99,0,5,216,39,142,49,16,99,36,196,192,251,79,43,212,235,117,46,156,191,88,197,108,126,
+  15,192,171,2,150,139,125,46,204,196,209,34,83,211,83,204,205,205,50,115,230,20,206,57,233,245,122,215,95,188,124,150,
+  236,113,96,249,131,154,25,6,8,130,147,81,86,171,85,142,28,62,196,236,217,115,168,250,68,85,43,0,105,249,13,138,
+  16,192,4,16,65,196,145,166,46,59,23,161,40,24,45,50,2,120,45,62,53,147,11,8,142,196,9,137,75,70,224,2,
+  224,21,139,86,2,104,1,112,56,103,24,130,12,189,148,151,108,227,189,39,134,184,23,32,128,115,110,120,187,168,38,185,
+  163,50,64,213,19,67,40,3,60,32,164,105,2,150,139,165,228,162,0,152,32,34,120,85,66,25,224,243,22,146,36,29,
+  86,23,100,228,34,95,45,27,16,84,149,48,222,2,64,226,146,76,92,206,146,131,108,182,254,1,16,145,70,187,221,154,
+  174,213,142,243,191,232,118,59,128,180,212,107,63,107,203,140,135,143,30,220,78,43,233,130,14,6,39,205,192,48,200,71,
+  186,188,7,163,82,153,216,86,213,251,139,11,175,63,3,252,5,198,186,65,227,184,230,144,207,0,0,0,0,73,69,78,
+  68,174,66,96,130,
+};
+const unsigned char File2x[1342] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,0,18,116,69,88,116,84,105,116,108,101,0,80,97,112,101,114,32,83,
+  104,101,101,116,115,185,175,145,249,0,0,0,23,116,69,88,116,65,117,116,104,111,114,0,76,97,112,111,32,67,97,108,
+  97,109,97,110,100,114,101,105,223,145,26,42,0,0,0,39,116,69,88,116,68,101,115,99,114,105,112,116,105,111,110,0,
+  119,105,116,104,32,97,32,72,85,71,69,32,104,101,108,112,32,102,114,111,109,32,74,97,107,117,98,134,84,7,179,0,
+  0,4,71,73,68,65,84,88,195,197,87,77,107,36,85,20,61,247,117,119,58,213,233,84,156,24,69,226,4,50,42,126,
+  164,231,63,136,46,20,68,24,21,71,112,239,70,119,130,11,183,34,35,184,14,40,184,49,132,97,132,12,204,66,144,129,
+  1,127,195,68,6,52,66,86,58,147,196,40,249,48,31,83,211,211,239,30,23,245,222,171,87,213,221,73,103,16,166,160,
+  40,186,186,186,207,185,247,156,251,81,66,18,143,243,48,120,204,71,189,122,227,214,207,55,223,81,181,223,169,234,83,0,
+  224,51,148,95,24,174,229,239,8,17,233,137,200,31,74,254,212,165,253,250,242,219,151,239,141,66,64,170,18,220,188,245,
+  227,159,175,189,250,198,249,241,230,248,144,159,16,17,135,112,220,207,142,241,247,63,219,216,216,220,232,110,109,109,244,64,
+  249,248,221,75,239,47,159,57,3,189,158,125,166,57,214,196,253,236,24,170,10,85,5,65,80,1,82,65,40,168,132,82,
+  65,42,148,132,170,162,94,175,35,77,167,144,36,227,99,211,211,231,198,214,214,126,255,118,229,198,15,157,15,222,251,240,
+  243,126,186,39,120,64,85,195,85,85,65,18,84,230,192,80,168,50,39,194,92,14,42,1,2,221,110,23,135,135,7,104,
+  79,164,152,62,55,131,206,194,66,43,73,146,79,86,174,95,187,14,64,70,38,96,109,68,192,69,73,20,128,65,2,175,
+  161,228,255,45,16,0,196,230,214,38,166,159,152,70,123,50,197,194,43,11,237,250,88,227,205,107,43,87,191,56,67,6,
+  172,51,150,7,173,158,222,144,49,137,60,70,49,6,89,118,12,64,48,213,158,66,163,209,64,167,211,105,67,249,217,242,
+  242,247,151,206,38,129,3,84,39,65,142,90,156,225,163,39,1,192,136,160,86,171,67,4,72,146,22,90,201,4,90,201,
+  4,58,23,47,38,48,122,117,105,105,105,252,84,19,122,9,200,220,108,33,233,172,38,63,198,47,36,54,70,240,203,157,
+  219,56,60,60,66,150,101,72,167,166,48,55,55,135,86,187,173,123,123,123,111,1,184,49,162,4,204,221,239,83,239,16,
+  139,178,101,201,90,226,164,168,213,106,16,49,168,25,3,146,184,119,247,46,182,255,218,198,75,47,190,156,214,196,124,116,
+  186,4,33,3,229,166,83,138,159,94,248,178,7,0,65,171,213,194,204,204,147,120,118,238,60,46,60,119,1,243,243,243,
+  216,217,217,193,243,243,47,160,251,240,225,235,139,139,139,205,19,37,80,106,145,94,18,148,24,20,16,34,191,231,18,64,
+  199,64,2,39,129,49,6,117,0,205,177,38,38,219,147,152,157,157,69,146,180,32,16,88,107,19,0,15,78,240,128,141,
+  0,115,52,138,251,115,250,124,8,196,51,145,56,13,101,73,170,213,175,3,6,223,16,19,22,253,95,92,212,136,34,12,
+  18,136,175,255,1,104,3,154,31,93,133,157,44,65,120,136,16,145,64,34,64,73,145,242,161,161,198,36,88,60,55,18,
+  1,47,129,72,30,169,24,7,93,34,33,229,152,69,6,98,123,163,208,253,210,82,1,236,143,146,1,129,136,1,132,14,
+  188,0,14,208,65,254,33,209,75,81,57,18,85,216,254,169,18,184,50,52,34,32,4,82,5,23,41,116,47,121,96,200,
+  232,142,172,96,213,86,19,48,64,2,245,18,24,8,24,0,165,98,186,210,16,26,194,33,95,84,226,224,70,168,2,159,
+  1,49,2,176,12,28,64,93,231,233,51,103,165,0,40,149,205,233,44,85,224,35,19,41,3,199,224,125,230,140,244,207,
+  181,167,171,162,156,128,165,29,161,10,212,150,83,236,53,143,200,4,99,246,153,179,212,52,243,78,10,130,238,91,159,221,
+  83,36,96,225,226,168,134,99,240,144,137,62,127,160,188,192,250,18,117,18,88,85,0,123,167,16,112,105,146,190,38,227,
+  183,14,9,211,39,38,227,73,248,22,78,22,89,40,130,235,85,224,79,48,97,209,138,89,73,71,156,227,114,207,41,221,
+  96,188,190,68,109,126,127,200,56,150,252,48,222,132,3,95,152,220,98,228,118,162,210,198,164,84,80,243,51,236,146,110,
+  151,40,36,32,118,119,119,107,34,69,113,214,61,184,35,211,240,173,56,76,127,14,235,241,110,74,146,160,111,219,213,49,
+  20,150,26,247,209,170,172,175,175,79,0,56,16,145,30,73,173,87,228,72,65,238,28,28,252,251,116,154,166,67,166,220,
+  163,29,89,150,33,235,102,118,117,117,53,117,3,225,72,68,88,47,59,12,141,219,171,119,190,185,242,213,151,159,82,48,
+  137,234,107,89,136,170,124,29,244,234,54,224,217,236,183,95,215,86,142,142,142,154,46,88,3,192,138,123,175,19,119,51,
+  1,144,2,104,3,104,68,15,202,35,166,194,59,218,2,232,185,77,232,192,157,15,2,1,231,3,227,192,76,4,250,127,
+  105,16,109,178,80,71,72,73,242,63,40,12,148,104,246,75,213,115,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Folder1x[581] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,1,194,73,68,65,84,56,141,165,144,49,107,147,81,20,134,159,115,239,
+  87,44,41,226,224,16,186,20,28,156,50,118,235,46,153,28,130,208,213,95,160,187,208,63,224,226,86,87,255,135,40,196,
+  185,96,196,89,41,138,36,146,80,105,191,38,37,223,189,231,158,227,144,38,54,88,90,193,119,57,220,123,207,121,238,121,
+  95,233,118,187,252,143,170,221,221,221,55,238,254,248,154,183,11,119,127,50,24,12,142,110,4,152,89,175,215,235,221,51,
+  51,204,12,119,7,224,244,244,244,126,191,223,63,236,116,58,207,151,205,57,103,66,8,101,56,28,126,172,235,186,0,84,
+  57,103,87,85,38,147,9,165,148,21,36,132,192,246,246,118,7,120,187,132,2,76,167,211,170,148,242,170,174,235,131,43,
+  128,140,170,98,102,107,144,118,187,221,218,220,220,164,213,106,17,99,36,132,192,104,52,98,60,30,63,92,89,80,85,83,
+  45,28,126,72,204,154,63,63,129,0,224,204,129,249,234,214,61,0,123,251,236,236,237,199,24,190,85,57,103,79,41,49,
+  109,156,151,207,30,33,114,217,120,53,41,95,59,1,144,212,57,120,253,126,167,74,41,153,170,2,78,12,240,233,248,236,
+  234,2,203,178,158,124,20,30,180,183,64,220,43,85,37,231,140,136,16,131,16,227,117,35,235,202,106,184,57,130,120,149,
+  115,182,156,51,184,19,68,216,184,1,160,197,105,178,81,204,9,65,0,22,0,213,197,6,243,84,8,128,249,162,185,184,
+  99,230,152,59,89,23,117,105,161,73,182,2,184,106,65,164,98,82,55,12,127,205,105,212,110,180,80,69,97,114,54,95,
+  0,84,213,82,74,224,145,47,163,115,78,166,13,127,103,190,174,24,132,159,103,151,22,68,196,204,12,17,161,201,70,235,
+  78,117,107,136,34,194,69,82,128,82,185,59,199,39,134,8,124,254,58,186,117,120,169,217,108,142,192,81,101,27,91,253,
+  119,199,119,159,130,243,227,251,248,159,1,34,140,69,194,139,223,71,22,33,158,28,99,167,49,0,0,0,0,73,69,78,
+  68,174,66,96,130,
+};
+const unsigned char Folder2x[1176] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,4,21,73,68,65,84,88,133,237,151,61,111,28,69,24,199,127,51,187,
+  119,123,175,246,57,145,48,9,5,86,148,194,31,0,9,5,33,83,110,149,130,26,137,2,90,58,62,64,36,62,64,74,
+  132,68,133,104,161,67,72,167,64,23,201,138,2,138,210,69,194,198,196,40,22,198,247,186,119,222,151,153,157,25,138,123,
+  201,58,119,142,19,114,82,40,248,75,143,118,118,118,247,121,126,243,60,51,179,187,34,12,67,94,167,228,107,141,254,95,
+  0,240,1,110,220,184,225,43,165,126,54,198,188,119,209,3,66,136,220,90,251,249,195,135,15,191,92,25,64,154,166,91,
+  149,74,229,157,155,55,111,250,73,146,224,156,3,192,90,11,48,63,159,182,253,59,119,238,220,222,222,222,254,254,209,163,
+  71,199,43,1,80,74,101,213,106,213,29,29,29,209,233,116,112,206,45,53,0,33,4,155,155,155,249,193,193,193,71,192,
+  237,149,0,104,173,211,44,203,196,165,75,27,24,99,176,214,158,9,92,204,132,16,130,106,181,90,63,60,60,252,98,123,
+  123,251,214,172,127,153,156,115,218,90,251,241,222,222,222,143,207,5,0,178,44,203,188,78,167,75,167,211,153,3,204,142,
+  179,32,197,64,91,91,91,245,70,163,65,179,217,68,8,129,16,2,0,41,229,188,29,69,17,247,238,221,187,5,60,31,
+  224,242,229,203,105,191,223,247,54,54,90,104,173,23,0,150,149,98,166,56,142,1,230,16,69,139,227,24,99,76,237,188,
+  224,115,128,221,221,93,117,237,218,53,217,235,245,230,25,0,150,130,204,178,81,212,108,196,197,224,82,202,25,64,229,66,
+  0,0,99,140,109,54,215,100,154,102,220,63,180,220,221,63,27,228,188,58,63,171,25,204,228,153,22,206,93,185,206,219,
+  31,232,226,61,158,39,190,93,255,253,155,79,206,0,56,231,116,183,219,245,187,221,46,143,59,13,62,253,240,93,174,191,
+  181,81,112,54,61,62,47,250,18,200,105,207,60,206,147,206,152,175,190,187,255,254,236,188,152,1,221,104,212,171,90,107,
+  212,31,146,102,181,204,254,223,99,162,56,159,140,108,233,104,207,35,17,11,77,1,52,42,62,42,211,8,65,103,118,121,
+  190,21,27,99,116,191,63,160,219,237,18,103,150,122,181,132,53,147,27,228,212,193,179,134,59,207,220,83,179,19,179,214,
+  145,100,134,52,203,193,137,249,6,86,44,65,86,169,4,180,90,45,50,35,168,5,37,172,83,120,114,53,175,139,113,154,
+  83,111,250,140,134,57,214,186,39,11,0,121,158,171,40,26,209,239,15,208,230,13,170,129,143,115,14,79,158,155,231,23,
+  147,131,81,170,209,185,37,240,37,113,170,173,49,249,209,2,128,49,38,43,151,75,84,155,27,172,213,202,56,64,10,177,
+  188,248,47,40,227,28,163,84,147,91,135,231,9,130,178,199,105,146,41,33,196,201,2,128,181,54,27,141,198,28,15,20,
+  235,245,75,232,220,190,210,232,51,109,137,51,3,78,224,79,253,148,61,201,232,84,229,130,167,147,176,152,129,212,247,125,
+  188,32,160,73,153,76,217,11,131,76,230,152,195,186,201,62,97,236,196,84,110,151,173,72,156,131,193,40,181,185,115,139,
+  0,214,218,100,60,30,211,25,248,84,90,101,162,68,147,233,233,75,8,200,141,69,27,135,206,45,185,153,110,203,47,153,
+  149,68,25,134,227,196,19,210,91,90,130,84,8,129,12,26,148,74,62,163,68,19,37,154,84,25,148,182,47,29,108,153,
+  226,44,231,52,209,62,231,148,32,142,227,83,122,81,133,74,13,30,159,196,12,99,189,212,209,191,145,0,134,177,66,25,
+  83,250,245,234,94,47,124,252,12,128,181,54,6,129,245,107,100,185,37,138,53,74,95,60,15,94,84,82,10,78,134,9,
+  82,200,56,220,221,157,59,62,51,7,146,36,33,74,12,87,175,4,84,3,143,160,188,186,111,86,41,4,105,170,144,82,
+  12,139,253,197,18,36,0,154,18,235,85,143,122,105,21,85,127,42,231,28,253,36,65,88,59,88,0,104,183,219,98,103,
+  103,199,68,177,98,112,234,248,243,100,136,236,190,226,14,184,68,199,199,67,155,36,195,7,187,237,118,45,12,195,120,14,
+  0,120,81,20,253,244,203,161,248,76,173,227,255,182,255,202,31,187,103,228,192,2,88,157,30,28,63,248,225,235,226,53,
+  49,251,53,107,183,219,205,96,109,237,205,90,208,218,116,56,41,133,92,201,18,200,141,49,42,75,107,185,16,121,62,58,
+  233,1,127,133,97,216,91,0,152,66,72,32,96,146,153,124,21,0,83,5,64,10,168,48,12,207,44,45,241,255,207,233,
+  235,6,248,7,188,50,165,151,203,8,55,43,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char FolderOpen1x[625] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,1,238,73,68,65,84,56,141,165,147,59,79,148,65,20,134,159,153,239,
+  219,93,195,71,178,33,94,18,27,45,181,48,33,86,212,118,22,90,108,225,63,48,177,163,38,196,206,146,248,11,44,164,
+  129,127,161,198,80,24,45,76,136,196,196,74,140,72,34,176,11,24,216,203,156,51,231,88,44,139,44,40,20,158,100,170,
+  57,239,115,46,239,76,112,119,254,39,194,252,252,252,75,119,127,248,151,187,174,136,60,90,88,88,120,127,46,96,110,110,
+  110,175,213,106,53,205,12,51,99,212,81,167,211,97,101,101,229,85,85,85,15,70,201,235,235,235,0,44,46,46,14,252,
+  40,177,20,17,87,85,182,183,183,201,57,143,65,106,181,218,76,187,221,62,112,119,220,157,170,170,112,119,102,103,103,63,
+  1,119,79,0,4,85,197,204,198,32,211,211,211,147,83,83,83,84,85,69,81,20,196,24,233,118,187,44,45,45,221,25,
+  117,85,170,170,169,102,114,254,115,70,0,17,161,219,237,18,66,32,132,64,140,17,128,148,210,241,230,75,17,241,148,210,
+  24,32,231,204,168,109,119,63,3,80,213,227,37,150,41,37,83,85,114,206,44,127,140,236,245,34,80,59,215,58,171,238,
+  215,102,158,44,247,66,140,95,75,85,69,68,200,57,179,219,139,60,125,124,143,34,134,35,143,128,127,188,147,164,118,233,
+  217,139,183,183,75,17,49,17,193,204,8,56,19,141,130,181,239,191,112,31,234,9,167,124,7,98,12,220,184,60,65,8,
+  88,41,34,166,58,4,20,49,80,196,64,12,225,140,240,68,101,250,253,76,188,10,128,31,217,56,92,90,89,20,20,49,
+  208,40,227,25,225,64,140,94,202,100,115,26,69,28,141,105,165,170,90,74,137,131,1,52,39,235,108,237,15,232,167,140,
+  251,176,218,64,51,73,109,108,21,101,17,216,218,235,15,71,8,33,152,153,241,101,167,206,245,107,77,118,15,133,190,24,
+  189,164,199,162,211,35,197,16,216,216,57,36,134,184,85,186,195,234,38,172,254,172,115,171,89,231,205,234,15,178,93,252,
+  67,59,237,125,178,219,235,50,55,174,188,251,176,89,221,4,103,237,243,183,11,133,39,98,3,179,231,191,1,223,162,81,
+  163,208,43,119,152,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char FolderOpen2x[1184] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,4,29,73,68,65,84,88,133,205,151,205,139,28,69,24,135,159,234,233,
+  249,218,153,217,221,201,230,3,226,193,69,242,71,136,135,28,188,228,148,163,32,10,222,221,139,1,79,57,45,17,9,4,
+  84,114,72,4,239,66,254,128,16,69,163,39,81,201,69,48,7,13,38,176,184,230,147,157,217,233,249,216,254,170,122,235,
+  245,144,244,48,155,153,221,108,178,43,235,11,47,221,116,117,245,239,169,95,189,69,85,27,85,229,48,35,56,84,245,255,
+  3,64,8,112,225,194,133,48,207,243,31,69,228,173,23,117,48,198,56,239,253,199,151,46,93,250,242,32,0,140,170,114,
+  254,252,249,83,181,90,237,247,179,103,207,206,37,73,66,81,23,222,123,0,38,235,68,85,185,121,243,102,182,181,181,245,
+  250,229,203,151,159,236,23,32,4,200,243,60,171,215,235,250,240,225,67,58,157,14,170,58,51,1,140,49,156,56,113,194,
+  173,173,173,189,15,124,113,32,0,214,218,52,203,50,115,228,72,27,17,193,123,191,77,120,210,9,99,12,245,122,189,177,
+  190,190,254,201,185,115,231,86,139,231,179,66,85,173,247,254,131,43,87,174,124,179,43,0,144,101,89,86,234,116,186,116,
+  58,157,49,64,113,45,68,38,133,150,151,151,27,205,102,147,86,171,133,49,6,99,12,0,65,16,140,239,7,131,1,183,
+  110,221,90,5,118,7,88,90,90,74,123,189,94,169,221,94,196,90,59,5,48,107,42,138,136,227,24,96,12,49,153,113,
+  28,35,34,115,59,137,143,1,86,87,87,243,149,149,149,96,115,115,115,236,0,48,19,164,112,99,50,138,17,79,138,7,
+  65,80,0,212,94,8,0,32,34,190,213,154,15,210,52,195,123,191,171,11,147,16,179,196,139,44,151,203,56,231,170,123,
+  2,80,85,219,237,118,195,110,183,59,5,48,233,198,44,7,118,2,200,243,28,17,217,27,128,136,216,102,179,81,47,106,
+  224,249,220,173,14,158,119,161,40,196,103,0,149,61,3,244,122,17,133,3,185,83,190,91,63,74,230,130,29,71,189,83,
+  20,64,80,67,26,103,22,222,252,240,90,127,178,189,20,152,27,63,95,125,247,189,109,0,170,154,213,106,85,22,23,23,
+  17,17,250,137,226,77,200,167,43,111,239,89,120,39,30,96,30,64,129,78,148,240,249,215,191,158,41,26,199,0,206,185,
+  124,48,24,18,69,17,170,74,47,49,52,235,11,24,19,112,251,239,104,191,16,0,84,203,1,141,208,80,42,153,199,83,
+  0,34,146,85,42,229,177,3,137,129,134,45,147,228,14,241,251,63,51,168,66,37,132,238,32,1,53,235,83,0,222,251,
+  108,56,28,21,107,151,40,46,83,41,159,100,16,59,172,219,31,128,170,146,230,158,90,185,196,70,47,193,138,220,157,2,
+  16,145,52,12,67,22,22,22,16,17,30,101,1,245,185,42,131,196,146,59,217,135,56,164,86,16,175,56,41,179,17,109,
+  89,175,186,54,5,224,189,79,70,163,17,206,57,68,132,7,253,54,175,29,111,48,74,28,153,245,175,44,158,88,193,63,
+  155,66,43,158,110,63,78,21,238,207,2,72,141,49,180,219,109,156,115,244,31,207,113,170,94,97,152,58,114,121,57,0,
+  239,33,23,143,117,219,251,89,81,186,253,216,171,215,127,166,0,68,36,142,227,45,172,181,164,214,211,79,154,212,107,21,
+  250,113,190,167,34,244,30,156,247,136,40,110,198,251,97,96,232,111,229,12,71,105,189,170,149,191,102,57,16,195,83,7,
+  126,187,15,199,150,230,137,51,79,146,109,31,133,87,69,188,162,10,226,21,175,138,247,202,11,17,203,1,15,158,244,9,
+  2,115,231,151,175,222,217,156,5,144,36,73,66,175,23,113,251,201,113,150,223,152,103,115,16,147,59,143,149,98,100,158,
+  87,61,197,139,11,216,216,232,165,222,251,107,219,156,25,191,32,146,0,220,29,29,165,84,46,83,9,21,103,115,212,123,
+  66,32,44,65,181,244,106,226,0,206,89,162,104,168,163,71,127,124,63,5,96,140,49,167,79,159,150,123,81,131,53,91,
+  162,214,12,233,245,71,4,129,153,253,181,151,12,85,37,138,210,44,237,119,110,252,121,253,98,207,152,139,115,170,26,143,
+  1,128,210,96,48,248,225,222,232,200,71,90,194,12,163,132,97,148,28,136,56,128,130,207,162,7,63,221,249,246,179,171,
+  64,121,178,205,76,28,44,90,173,163,39,79,134,38,60,166,104,16,152,192,30,132,184,19,145,120,43,170,185,116,148,2,
+  35,224,177,170,142,139,208,76,110,179,198,152,0,168,242,212,25,119,16,0,207,162,10,164,64,174,170,219,150,149,121,153,
+  125,254,191,136,67,255,55,60,116,128,127,1,16,0,26,26,62,130,17,220,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char FolderTemplate1x[429] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,1,42,73,68,65,84,56,141,165,147,189,78,66,65,16,133,207,254,112,
+  67,110,76,172,120,0,236,180,161,247,13,160,208,6,223,194,119,241,5,76,72,40,120,1,11,254,172,165,177,176,39,177,
+  177,147,144,72,65,76,238,236,156,177,187,202,37,144,92,60,201,169,102,231,219,57,217,89,103,102,248,143,226,124,62,123,
+  4,236,182,90,32,177,85,213,126,175,215,123,61,6,112,211,233,228,171,221,190,56,15,33,236,20,54,155,13,86,171,213,
+  76,85,111,170,77,221,110,183,0,96,0,224,85,213,154,205,38,242,60,223,113,171,213,66,8,225,154,212,109,213,147,201,
+  248,173,140,32,34,230,189,71,140,113,55,91,140,232,116,58,103,251,209,136,197,226,229,170,60,151,82,98,8,97,15,112,
+  72,36,33,34,191,23,29,154,224,56,32,253,5,36,214,1,152,25,72,229,112,56,252,246,222,191,71,17,65,157,8,0,
+  208,239,223,101,170,9,163,209,232,50,170,10,157,3,170,207,120,76,33,4,144,17,69,33,244,69,145,72,214,223,70,51,
+  131,136,152,23,17,35,89,27,64,18,41,37,122,85,229,41,255,161,4,0,56,9,176,94,175,209,104,52,62,61,0,168,
+  106,109,192,114,185,52,85,125,142,206,185,167,193,96,112,95,23,144,101,217,135,136,60,252,0,218,142,189,133,140,36,139,
+  153,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char FolderTemplate2x[772] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,2,129,73,68,65,84,88,133,237,151,177,110,19,65,16,134,255,221,189,
+  156,157,24,26,36,139,23,8,138,197,3,240,6,1,43,125,92,208,211,165,227,17,120,4,20,202,180,73,149,14,89,17,
+  5,70,138,76,77,19,132,100,217,33,70,81,10,11,139,203,217,222,187,189,153,161,72,46,114,18,99,159,149,51,161,96,
+  164,45,110,52,187,243,237,191,179,186,89,37,34,184,79,211,247,154,253,95,0,240,0,160,209,104,120,113,28,125,18,145,
+  103,25,230,36,34,120,93,173,86,223,229,1,160,68,4,7,7,7,171,74,225,203,234,234,147,149,153,217,147,4,157,78,
+  59,18,65,165,90,173,30,223,21,64,3,128,82,42,210,90,179,214,26,179,134,239,251,40,149,74,78,41,169,221,53,57,
+  112,169,64,189,94,47,27,163,190,87,42,79,151,179,76,138,162,8,199,199,157,1,17,209,140,208,152,89,94,110,108,108,
+  124,248,83,128,151,174,73,196,90,41,149,137,186,88,44,98,109,173,82,34,74,166,198,5,193,57,78,79,79,223,0,152,
+  14,16,134,161,45,20,124,79,235,249,46,133,49,102,6,104,12,102,154,90,87,26,0,54,55,55,99,17,209,89,106,96,
+  158,97,140,1,51,23,167,1,164,71,0,34,38,0,115,171,48,205,140,241,64,148,17,64,132,93,254,0,6,204,137,159,
+  9,128,153,29,128,229,60,1,60,207,67,146,112,54,0,17,56,17,65,158,0,190,239,131,153,30,236,237,237,254,26,247,
+  107,109,222,215,106,181,151,55,0,56,202,27,64,107,141,245,245,231,75,68,180,148,250,134,195,1,154,205,207,47,210,239,
+  177,35,144,56,111,0,224,66,133,113,11,195,16,0,206,38,0,112,196,204,185,3,220,52,107,45,152,249,100,34,192,34,
+  20,184,105,195,225,16,206,185,214,36,0,251,55,20,24,12,6,113,28,199,157,73,0,35,102,90,56,64,16,4,150,153,
+  187,183,0,68,196,18,45,94,129,32,8,132,153,127,220,2,32,162,33,209,98,21,32,34,244,251,253,101,231,220,183,137,
+  0,73,50,253,247,122,87,235,118,187,48,198,124,221,218,218,250,153,250,174,182,235,156,27,45,26,160,213,106,141,70,163,
+  209,238,184,239,26,128,115,110,97,201,173,181,56,58,58,66,187,221,190,214,156,164,61,161,58,63,15,40,142,227,133,36,
+  143,162,8,251,251,251,113,175,215,171,111,111,111,247,149,82,87,77,74,90,3,230,228,164,251,177,217,108,190,58,60,60,
+  204,212,23,2,192,60,175,170,94,175,215,216,217,217,121,11,96,105,220,175,210,69,148,82,15,203,229,242,99,102,126,116,
+  217,29,229,117,30,202,90,187,18,134,161,5,16,2,56,19,145,171,34,84,227,187,80,74,105,0,5,92,40,147,103,69,
+  22,0,88,0,177,136,240,53,186,255,143,211,251,6,248,13,135,18,101,93,66,12,61,82,0,0,0,0,73,69,78,68,
+  174,66,96,130,
+};
+const unsigned char Font1x[627] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,2,5,73,68,65,84,56,141,
+  157,147,205,75,148,81,20,198,127,51,119,26,103,116,104,132,176,15,130,138,172,137,92,181,16,218,106,6,173,219,105,229,
+  190,93,224,127,16,109,6,134,105,33,17,33,180,210,162,77,68,84,16,168,45,114,81,65,37,83,145,31,73,58,99,56,
+  78,227,152,54,239,124,221,251,222,247,180,136,25,169,209,192,14,28,184,220,115,249,61,231,121,224,250,18,201,248,85,32,
+  97,173,141,176,139,82,74,57,192,16,137,100,188,88,169,148,197,243,188,93,181,83,114,36,145,140,23,253,214,218,72,40,
+  20,102,108,98,14,128,177,137,57,68,132,209,241,89,60,207,50,58,62,67,177,92,101,248,233,60,90,107,180,174,81,171,
+  85,105,107,109,195,90,27,241,215,87,186,114,254,20,0,151,251,98,136,8,151,206,157,68,68,24,232,61,193,147,183,171,
+  164,243,37,106,198,34,34,136,72,195,74,3,80,87,254,187,231,87,138,188,251,186,129,118,45,217,245,202,206,128,186,242,
+  214,3,161,102,44,83,51,5,180,54,24,237,178,178,94,218,221,6,227,169,60,61,93,251,136,134,20,218,184,44,231,255,
+  1,168,123,174,171,103,214,202,212,140,203,209,142,48,29,123,131,104,227,146,206,57,59,3,238,77,206,55,134,174,245,120,
+  254,62,199,133,51,29,136,8,7,219,131,104,237,178,148,43,54,1,2,245,195,64,111,103,99,56,249,33,207,199,244,6,
+  67,119,215,208,198,160,181,139,49,46,217,82,133,82,85,19,14,6,154,1,247,95,44,208,223,211,73,110,179,74,106,241,
+  7,55,6,78,227,67,240,60,97,41,87,228,250,88,10,109,44,153,239,14,177,195,209,102,11,253,61,199,241,196,227,193,
+  203,12,23,207,30,162,173,69,17,14,42,90,91,20,7,218,67,104,227,162,141,203,98,246,231,246,25,120,158,240,248,205,
+  10,1,37,28,219,223,250,71,160,126,31,191,1,218,101,250,75,1,216,6,240,240,213,55,166,62,231,89,93,175,242,122,
+  54,223,0,204,45,111,50,252,232,19,65,191,16,218,227,99,122,161,192,200,179,217,173,12,148,82,78,185,92,138,12,246,
+  197,24,236,163,169,186,187,162,116,119,29,105,186,119,28,7,165,148,19,0,134,110,223,185,117,243,63,191,243,181,95,46,
+  181,156,109,120,254,28,88,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Font2x[1121] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,4,24,73,68,65,84,88,133,197,151,203,111,27,
+  69,28,199,63,235,212,33,206,131,60,169,162,34,46,165,68,2,212,107,203,177,18,226,218,188,91,241,79,128,4,55,206,
+  164,74,83,132,128,43,18,28,56,180,182,99,59,85,40,66,1,21,16,66,170,42,90,41,16,30,45,1,218,6,165,105,
+  94,78,156,216,251,156,249,113,176,119,99,199,143,216,169,10,63,105,52,187,179,179,251,253,206,231,55,51,187,11,255,115,
+  24,254,193,135,31,189,31,53,45,115,188,184,237,9,133,68,90,34,241,55,223,120,235,124,73,235,197,75,23,180,252,71,
+  113,241,210,5,237,235,134,2,91,34,37,35,143,198,46,83,116,45,40,90,107,180,214,40,165,80,74,225,121,30,158,231,
+  225,186,110,161,56,56,142,131,227,216,216,182,141,109,91,88,150,133,101,153,152,166,89,166,117,164,26,167,243,231,94,15,
+  196,11,54,200,31,86,175,139,251,151,215,123,125,138,35,180,191,193,31,121,52,118,25,17,33,22,191,2,8,209,88,190,
+  142,197,163,128,16,159,142,1,194,116,34,14,8,137,100,28,17,33,145,156,70,68,72,166,18,136,8,169,153,36,34,194,
+  204,213,68,69,3,65,76,78,77,148,228,73,107,93,40,74,148,82,162,148,39,158,231,137,231,185,226,186,174,184,174,35,
+  142,227,136,227,216,226,56,182,216,182,37,182,109,137,101,153,98,89,166,152,102,78,76,51,39,185,92,86,114,185,172,100,
+  179,187,146,205,238,138,136,200,228,212,68,224,164,140,128,143,45,22,191,82,200,251,193,248,139,113,123,74,184,185,184,85,
+  49,13,117,165,192,239,60,62,230,175,146,198,114,255,195,157,13,110,252,145,174,40,46,21,50,80,147,64,163,226,59,166,
+  203,119,191,166,89,223,113,209,133,85,179,127,16,13,17,104,20,255,220,79,235,88,174,194,83,154,244,174,27,180,151,222,
+  87,39,129,248,116,180,33,2,203,105,139,197,149,108,240,140,181,140,243,184,4,206,213,45,46,192,181,219,107,140,156,234,
+  15,246,241,213,140,83,38,94,55,129,226,117,94,79,238,23,30,100,104,111,105,226,248,209,8,93,109,225,188,129,109,187,
+  226,42,170,139,128,8,140,141,142,215,149,123,215,83,124,253,243,6,175,157,236,5,160,175,35,140,82,154,71,91,214,227,
+  17,240,119,184,131,8,124,255,251,22,3,199,90,233,105,15,35,34,244,117,132,209,90,179,178,101,85,189,239,0,3,249,
+  206,163,35,99,7,138,103,76,143,91,127,109,115,230,197,222,128,200,51,29,97,148,22,114,150,98,59,231,53,78,192,239,
+  92,139,128,47,54,55,191,198,233,19,157,180,132,141,192,84,223,211,205,104,165,81,90,179,186,101,29,72,160,194,219,176,
+  62,2,75,27,38,11,75,25,94,122,246,24,139,43,89,180,22,64,48,237,188,184,136,176,178,101,241,124,127,107,77,2,
+  101,6,252,209,37,146,211,140,12,143,86,220,82,181,192,236,143,43,228,44,197,39,223,60,64,180,4,59,159,214,123,245,
+  195,205,67,17,200,139,85,19,23,129,249,123,219,172,109,59,188,51,124,156,35,77,161,50,129,15,62,255,147,229,13,139,
+  135,105,127,34,238,127,206,94,84,221,136,146,169,68,201,185,191,60,109,87,115,237,214,35,94,61,217,67,71,36,76,164,
+  57,68,75,184,41,168,91,194,33,250,59,155,81,90,179,188,97,214,20,175,104,192,239,60,60,52,82,145,192,87,243,171,
+  0,156,58,209,77,181,249,113,180,243,41,180,210,108,238,218,152,142,170,42,94,147,64,106,166,148,0,8,75,235,38,223,
+  254,178,206,153,151,123,104,10,81,81,92,68,232,237,104,70,233,252,60,248,103,61,87,85,188,38,129,161,193,82,2,155,
+  59,14,159,94,191,143,235,41,158,235,141,212,92,158,121,113,141,86,154,133,251,153,198,12,236,17,72,6,231,55,238,166,
+  153,76,221,101,61,227,160,148,240,241,220,223,124,113,123,165,204,196,230,174,195,123,169,59,124,118,253,94,176,23,204,222,
+  92,230,221,232,111,108,236,216,21,13,84,93,5,67,131,195,129,153,87,6,186,56,253,66,87,217,136,247,227,239,110,11,
+  243,246,208,64,205,156,87,35,16,124,167,251,55,207,92,77,249,45,117,191,150,139,235,58,162,27,48,124,2,237,197,87,
+  68,132,193,179,67,21,63,40,234,49,81,103,116,1,174,111,32,100,24,134,0,70,107,107,91,35,15,57,84,20,180,66,
+  128,248,6,114,134,97,204,78,78,77,156,53,140,39,251,111,90,248,189,251,18,72,3,185,98,53,3,104,1,90,11,117,
+  213,223,182,67,134,87,40,22,144,45,28,243,47,118,211,151,170,126,248,225,254,0,0,0,0,73,69,78,68,174,66,96,
+  130,
+};
+const unsigned char Image1x[558] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,213,11,10,16,7,18,54,148,178,182,0,0,1,187,73,
+  68,65,84,56,203,157,211,77,107,19,65,24,192,241,255,236,219,52,221,152,212,5,161,165,5,161,224,165,133,92,196,162,
+  23,83,232,201,131,159,64,232,103,40,158,235,49,24,131,245,11,8,222,122,245,32,210,64,181,216,30,10,213,158,84,68,
+  15,42,210,67,34,5,149,38,155,110,183,217,153,233,97,233,234,98,10,33,3,3,243,250,123,102,134,103,68,189,81,91,
+  3,238,51,90,121,66,189,81,51,90,235,145,106,189,81,51,14,128,49,134,7,143,158,178,181,243,110,168,176,75,213,5,
+  86,87,150,1,112,0,132,16,236,238,127,102,238,230,29,44,203,194,181,21,133,130,226,247,145,77,162,52,137,210,40,165,
+  1,72,148,97,107,231,77,30,48,198,224,216,130,160,236,51,51,25,115,183,90,36,40,5,108,236,126,231,237,123,63,67,
+  82,64,211,254,231,52,206,121,195,178,44,46,249,146,27,243,49,179,83,139,8,225,114,251,122,151,111,7,167,68,39,2,
+  165,83,64,41,147,187,206,95,64,8,74,227,146,78,104,19,39,45,92,187,204,159,163,46,190,156,64,58,160,207,1,125,
+  1,32,128,98,193,163,125,120,133,215,123,95,8,202,167,124,61,8,40,142,123,104,109,104,255,248,196,228,213,57,244,133,
+  128,5,37,95,130,16,244,142,125,122,61,131,231,128,235,167,111,244,106,239,37,133,49,143,153,217,249,193,64,210,239,19,
+  117,14,115,147,6,3,6,180,73,163,238,111,63,167,31,71,131,129,78,55,228,217,250,139,244,46,233,110,180,214,132,199,
+  17,97,24,81,153,78,135,155,205,38,120,151,51,192,202,105,158,196,118,36,8,135,190,22,196,137,193,113,199,168,76,159,
+  100,107,166,38,24,124,2,128,197,91,21,90,63,127,13,200,189,107,185,94,235,195,199,255,129,165,234,2,27,155,219,67,
+  167,114,14,16,66,176,186,178,156,165,231,48,69,74,153,1,235,141,199,15,239,141,250,157,207,0,181,88,225,150,139,66,
+  18,171,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Image2x[1163] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,4,66,73,68,65,84,88,133,237,150,219,107,92,
+  85,20,135,191,125,206,220,50,147,73,50,147,54,77,108,165,84,20,5,13,213,71,17,161,47,253,39,44,62,248,55,248,
+  170,32,244,65,139,248,238,75,81,74,235,155,193,23,159,26,104,104,75,45,5,173,86,75,91,76,27,218,230,126,153,201,
+  153,235,153,179,47,203,135,185,156,73,166,109,20,67,65,236,130,205,94,251,194,249,125,123,173,181,55,7,94,216,255,221,
+  20,192,197,185,139,23,16,62,120,206,202,223,157,60,113,242,20,0,179,115,179,78,158,179,205,206,205,58,128,4,128,136,
+  40,128,249,249,249,24,80,169,158,47,34,59,224,187,227,103,245,207,90,155,158,158,238,105,38,118,71,230,235,179,231,81,
+  202,195,235,7,64,16,39,56,17,156,115,136,115,56,231,176,157,222,185,246,188,181,182,51,142,155,181,182,179,175,189,231,
+  244,167,31,239,208,219,1,160,148,34,225,251,108,165,223,194,243,20,74,65,62,171,201,102,45,181,166,34,168,120,104,163,
+  112,78,176,78,176,214,117,252,184,183,78,118,172,219,46,156,19,38,155,215,7,74,97,32,2,190,239,147,207,165,241,61,
+  56,118,164,193,187,111,251,76,140,21,169,212,171,92,251,173,193,173,187,195,68,150,182,184,72,44,108,227,8,117,253,126,
+  72,39,130,223,242,246,6,80,10,178,233,36,249,92,196,123,199,125,222,124,229,125,18,94,145,201,241,128,84,242,42,165,
+  64,179,182,57,212,9,105,71,168,95,188,59,223,91,139,65,41,15,232,15,2,32,194,80,58,201,72,46,162,56,54,68,
+  194,43,2,30,190,26,163,144,31,227,64,97,149,90,61,213,203,169,235,213,70,220,219,86,21,93,93,195,27,61,182,35,
+  53,213,93,197,60,0,208,173,222,76,58,129,72,134,74,45,192,140,111,226,123,227,136,11,168,54,3,140,25,34,155,73,
+  246,21,101,187,23,137,79,94,94,185,131,232,16,193,144,42,190,142,181,10,1,2,107,7,110,212,19,0,44,217,76,18,
+  72,114,111,33,196,75,92,161,144,31,166,30,54,185,119,31,116,52,65,54,163,16,137,129,219,16,237,113,105,233,54,186,
+  89,65,146,195,172,255,121,141,163,239,28,36,55,58,9,192,166,167,216,109,79,140,192,80,58,129,66,81,173,29,226,230,
+  31,33,153,84,139,200,140,211,108,165,201,164,188,110,166,98,0,105,95,213,70,165,196,195,219,87,73,231,39,200,101,178,
+  32,66,101,233,22,147,135,143,2,116,110,150,122,58,0,128,115,142,108,58,69,188,47,141,49,224,1,185,180,116,132,1,
+  36,134,0,162,200,112,227,250,143,132,205,6,227,83,35,36,253,246,7,196,132,140,230,50,29,0,239,217,0,34,2,206,
+  49,146,75,210,191,77,118,121,93,97,0,235,132,72,27,230,127,191,206,246,230,50,0,133,66,129,141,149,135,0,188,250,
+  198,113,14,140,182,1,252,189,34,32,34,212,27,33,63,255,122,159,254,125,253,117,211,19,182,142,176,165,105,69,6,163,
+  27,84,214,151,24,57,248,26,0,139,203,27,4,171,143,24,46,30,99,45,72,178,121,227,46,0,205,48,218,27,64,107,
+  77,80,169,0,244,32,98,0,65,27,71,171,165,209,198,244,230,117,24,80,171,71,56,103,0,240,84,132,75,191,68,181,
+  105,96,187,76,42,163,129,118,122,247,4,136,180,166,210,1,0,133,115,14,99,44,198,90,180,177,237,7,101,192,60,252,
+  220,20,97,181,76,45,216,196,57,203,104,225,16,205,70,149,82,112,135,252,216,4,185,124,113,111,0,107,45,65,16,16,
+  233,117,156,147,129,59,187,167,169,20,153,145,67,52,170,91,172,173,60,98,180,56,69,163,82,166,94,95,160,48,225,200,
+  58,7,64,169,92,66,58,254,19,82,16,177,189,189,253,207,132,119,155,151,33,145,245,41,149,214,56,243,201,135,125,11,
+  39,88,90,93,100,105,101,17,173,245,32,0,180,243,84,169,85,255,29,64,207,210,104,99,121,121,234,8,174,115,98,99,
+  12,75,43,75,210,8,27,95,61,21,224,112,118,99,159,0,32,10,67,172,181,108,109,109,225,251,62,43,107,43,18,182,
+  194,199,231,190,57,119,102,0,64,41,197,151,95,156,238,249,253,243,187,253,191,59,119,243,214,47,24,99,208,90,243,120,
+  249,177,171,213,170,107,223,207,204,156,154,155,155,51,49,128,194,57,231,188,233,233,233,125,59,57,180,163,121,229,167,203,
+  220,127,48,207,214,246,150,93,93,94,189,120,254,220,133,207,23,22,22,22,129,70,12,0,223,94,186,114,233,163,238,127,
+  218,126,152,136,176,177,190,65,181,82,165,92,222,126,112,237,242,213,207,102,102,126,184,9,212,129,13,32,2,216,45,168,
+  128,161,78,75,237,23,12,237,55,60,234,180,6,224,246,241,219,47,236,63,110,127,1,15,19,154,238,130,175,215,178,0,
+  0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Markup1x[709] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,4,22,20,19,51,203,197,162,151,0,0,2,82,73,
+  68,65,84,56,203,149,146,189,79,83,81,24,198,127,231,246,210,43,80,108,122,129,66,33,66,172,124,72,136,128,24,28,
+  28,140,68,93,48,33,38,14,70,101,209,77,227,232,162,49,33,93,252,7,12,38,24,163,131,31,3,49,46,234,224,228,
+  96,92,64,38,33,166,45,1,77,173,20,232,237,135,45,247,182,183,237,189,14,166,216,43,198,132,103,122,79,242,158,231,
+  252,222,243,188,98,118,118,246,101,34,145,184,192,222,116,113,122,122,122,14,128,80,40,100,239,85,161,80,200,174,58,201,
+  213,66,211,52,44,203,2,64,8,177,243,84,181,22,66,224,114,185,240,122,189,14,148,29,3,203,178,136,68,34,142,11,
+  181,18,66,48,48,48,176,107,22,185,246,208,223,223,255,95,130,127,73,174,109,172,37,168,234,243,90,134,165,175,89,178,
+  134,69,217,178,113,203,18,82,169,157,203,119,158,93,125,113,111,234,137,131,160,175,175,111,199,224,251,230,79,30,190,90,
+  32,208,166,50,121,230,24,7,59,155,105,80,20,210,121,131,149,216,22,139,203,177,199,151,110,63,189,238,48,136,70,163,
+  0,36,82,6,175,23,54,56,63,62,204,112,175,159,116,222,96,53,250,5,217,227,135,122,31,77,251,224,202,196,8,243,
+  203,241,49,199,8,85,130,185,71,239,153,60,53,196,145,160,74,42,153,160,165,107,16,111,75,0,189,80,34,17,91,69,
+  182,76,164,138,193,233,177,160,243,19,35,145,8,159,194,26,62,223,126,198,199,122,200,101,52,202,178,7,36,65,157,36,
+  227,174,179,105,80,100,124,13,10,1,127,43,138,226,222,157,194,219,197,143,156,24,237,34,147,78,146,52,27,241,119,116,
+  96,219,96,3,8,9,97,153,172,167,44,22,87,150,240,213,219,206,20,194,225,48,9,77,167,187,221,199,124,116,147,96,
+  175,31,203,134,106,46,249,76,138,227,35,131,8,33,176,109,155,248,250,6,210,223,4,5,179,140,162,184,145,60,126,50,
+  249,2,91,57,19,189,88,33,167,155,152,249,45,199,94,180,181,54,255,33,80,85,245,247,98,200,18,217,237,2,141,133,
+  31,120,100,133,205,237,22,146,117,110,202,21,139,66,170,204,72,169,68,177,104,210,228,105,68,215,117,196,204,204,204,155,
+  100,50,121,174,106,20,183,14,113,246,228,48,71,123,84,130,7,2,124,139,197,249,176,98,96,226,198,40,150,201,102,82,
+  40,162,194,141,201,33,52,77,99,215,126,94,187,251,252,126,123,64,189,57,53,49,202,225,238,86,0,210,153,44,15,222,
+  173,81,193,197,118,193,196,48,76,110,77,116,146,203,229,248,5,131,250,25,20,161,246,118,40,0,0,0,0,73,69,78,
+  68,174,66,96,130,
+};
+const unsigned char Markup2x[1759] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,6,150,73,68,65,84,88,133,229,151,91,108,28,
+  87,25,199,127,51,179,222,171,215,94,123,125,141,227,56,73,235,93,231,130,27,163,218,78,218,16,53,18,23,137,10,25,
+  33,17,16,79,1,69,2,97,196,229,165,226,1,161,192,11,188,128,68,69,64,136,22,252,208,130,132,74,170,144,54,148,
+  244,66,210,96,146,90,216,77,28,219,145,47,201,58,177,29,103,237,181,215,59,51,59,179,187,115,227,33,222,205,218,94,
+  187,78,37,158,248,164,163,57,231,204,217,243,253,230,255,125,231,178,240,255,110,194,250,142,51,103,206,124,201,229,114,245,
+  1,65,73,146,16,69,17,219,182,177,44,171,80,76,211,44,60,139,235,91,245,1,138,105,154,39,251,250,250,206,22,251,
+  115,109,32,18,132,151,79,157,58,21,92,173,99,154,38,46,151,11,199,113,214,140,43,110,111,179,30,236,237,237,125,25,
+  216,26,192,178,172,16,64,44,22,67,16,4,44,203,34,16,8,144,203,229,242,128,8,194,35,225,138,235,165,218,121,144,
+  186,186,58,114,185,92,104,253,187,13,0,142,227,20,156,228,39,91,95,47,245,220,204,249,71,217,6,0,219,182,215,56,
+  45,118,52,53,53,85,120,191,29,167,146,36,17,137,68,214,124,220,182,0,242,42,172,7,105,109,109,253,223,43,96,89,
+  214,154,9,139,85,248,56,10,68,163,209,66,123,219,10,148,114,46,8,2,145,72,228,99,41,144,239,223,22,64,94,129,
+  82,73,56,57,57,137,101,89,219,150,93,146,36,218,218,218,10,237,199,2,0,24,26,26,162,163,163,163,0,144,151,179,
+  24,206,178,28,6,6,198,185,210,127,139,241,137,57,148,148,10,64,176,178,156,104,164,137,100,18,58,59,35,143,7,144,
+  79,194,174,174,174,53,235,127,98,98,98,141,2,163,163,115,252,237,141,155,180,125,226,73,158,61,214,193,55,190,217,67,
+  77,200,143,150,49,137,205,43,12,143,222,229,252,219,35,252,238,247,255,224,7,223,251,226,227,135,192,182,237,53,18,71,
+  163,209,66,251,143,125,239,112,125,100,142,159,252,236,91,180,237,173,101,65,206,210,88,233,38,24,44,231,82,255,0,222,
+  218,39,232,58,188,159,231,142,238,103,124,114,150,223,190,116,129,116,170,28,30,110,255,5,18,105,61,192,209,163,71,79,
+  31,63,126,28,85,85,17,4,1,199,113,112,187,221,56,142,195,196,196,4,11,11,11,188,242,234,37,230,151,12,94,252,
+  197,41,44,199,100,226,222,60,57,19,116,121,153,193,91,119,241,148,215,144,115,36,52,69,33,40,166,121,250,192,46,58,
+  187,91,249,96,104,158,96,96,159,119,118,102,224,157,188,63,113,171,16,172,79,194,182,182,54,12,195,71,108,70,229,151,
+  63,63,73,108,54,142,145,203,210,84,229,167,190,161,129,64,221,94,90,247,181,83,85,219,128,79,200,129,169,18,95,146,
+  113,123,220,52,55,134,249,233,143,78,80,17,174,234,237,238,238,253,204,166,0,171,39,87,73,27,27,187,197,139,103,222,
+  224,133,23,190,140,223,231,229,96,164,133,61,205,13,204,220,143,163,167,21,220,30,15,110,183,11,151,75,194,178,161,115,
+  223,46,62,123,172,19,159,215,139,40,138,132,171,130,124,253,228,49,191,224,42,251,13,156,22,55,85,160,248,171,139,139,
+  162,136,236,216,211,204,161,131,123,0,208,52,157,203,215,174,211,28,237,160,162,170,22,199,1,81,16,17,4,145,250,160,
+  195,197,247,255,195,185,183,251,153,188,29,195,229,114,97,24,6,159,234,222,39,238,216,221,212,112,228,200,98,207,150,0,
+  165,236,242,149,49,62,247,233,67,136,171,185,241,214,149,65,90,159,122,6,183,199,135,3,216,249,226,56,44,165,210,28,
+  235,110,199,231,245,49,56,149,224,221,171,55,86,231,55,233,234,108,246,35,73,95,131,143,88,134,235,243,224,230,72,140,
+  111,247,246,112,254,189,15,88,210,37,26,91,158,34,165,25,84,7,202,112,120,152,222,134,105,145,94,158,231,240,161,125,
+  0,52,53,214,3,48,116,99,12,53,173,49,52,50,73,83,83,53,192,209,146,10,20,231,192,192,192,0,162,248,104,136,
+  166,102,240,251,61,212,132,42,48,93,229,100,13,27,57,157,37,161,100,209,179,38,90,198,64,213,13,124,146,177,65,189,
+  39,118,239,228,218,245,113,118,212,86,146,22,131,14,182,19,222,84,129,188,29,57,114,132,108,54,91,80,0,199,225,206,
+  3,157,233,184,76,184,12,124,89,27,77,19,208,203,27,72,186,36,68,192,180,108,2,153,244,154,57,29,199,193,52,13,
+  26,195,65,94,187,52,70,164,173,189,240,110,211,16,228,235,197,97,168,168,10,178,176,172,144,150,106,88,80,84,190,115,
+  60,138,36,73,92,184,52,192,178,167,5,219,113,48,12,139,76,198,207,252,155,151,73,172,104,124,245,249,103,112,187,36,
+  116,93,167,170,50,128,102,72,168,41,205,68,20,146,37,67,176,254,56,46,182,157,77,33,70,199,238,81,238,145,168,242,
+  154,72,210,195,125,236,243,207,117,17,13,174,160,44,221,103,69,209,89,209,76,198,228,106,98,217,58,38,238,204,160,170,
+  42,233,116,154,215,47,94,35,24,170,103,102,110,81,4,254,85,18,32,159,3,165,78,185,47,60,127,152,91,31,142,83,
+  233,151,152,142,171,24,198,163,88,119,28,140,98,164,230,73,42,26,43,138,78,74,213,145,211,25,62,28,159,69,150,101,
+  20,69,33,177,146,166,49,28,96,122,228,118,6,203,250,211,166,10,148,58,52,0,42,42,28,82,241,7,220,26,159,33,
+  28,174,229,87,175,188,133,44,203,104,154,70,54,155,37,182,12,203,178,190,10,144,65,78,103,48,115,25,82,169,20,51,
+  179,247,9,85,215,49,31,87,244,165,185,7,241,171,87,107,207,109,25,130,82,16,7,14,236,231,251,223,237,225,253,115,
+  239,81,233,17,200,122,155,88,92,92,36,145,72,240,235,190,179,36,114,62,146,178,70,178,8,98,228,110,146,100,50,73,
+  124,41,69,69,77,51,55,222,253,183,163,41,241,31,194,105,123,203,16,108,102,237,237,187,249,100,251,14,206,189,122,129,
+  29,149,101,100,178,57,98,211,247,184,114,199,38,169,102,73,202,58,73,69,35,169,232,164,85,133,184,34,178,184,44,163,
+  218,33,250,255,222,79,226,65,236,220,240,240,159,111,2,101,176,113,21,4,69,81,148,29,199,169,8,133,66,5,69,202,
+  202,202,10,138,152,166,201,87,78,60,139,250,135,139,156,125,233,175,100,123,158,198,91,25,98,127,100,55,115,9,149,180,
+  150,197,227,24,120,3,2,245,149,229,52,132,27,25,190,175,50,252,207,107,172,44,141,155,195,215,95,123,29,240,240,112,
+  211,92,243,215,44,8,212,118,119,119,159,104,105,105,249,49,224,219,76,133,92,46,135,174,235,104,154,27,195,222,73,67,
+  203,46,118,70,159,164,174,33,132,63,224,195,182,29,20,89,101,33,158,98,110,124,138,196,236,44,142,21,179,230,230,70,
+  255,50,59,59,123,30,24,4,166,0,187,24,192,13,212,3,97,32,180,74,185,225,190,176,110,124,149,40,122,170,155,154,
+  14,117,134,170,247,30,242,122,67,59,93,146,232,5,48,45,59,163,235,203,15,146,75,183,71,231,231,135,7,109,59,39,
+  3,119,129,73,96,26,80,215,43,144,55,15,224,93,117,176,157,139,190,184,58,62,0,248,87,127,39,1,22,144,1,52,
+  64,89,117,152,1,178,20,221,136,254,11,210,252,122,24,159,159,101,167,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Program1x[609] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,214,1,5,14,9,17,179,225,58,161,0,0,1,238,73,
+  68,65,84,56,203,165,147,61,104,83,81,20,128,191,123,238,123,105,140,177,105,82,7,155,162,173,70,170,77,148,214,90,
+  39,7,21,7,103,135,110,65,156,93,172,17,7,137,173,58,184,137,139,160,131,63,136,118,214,69,212,69,196,216,165,40,
+  175,138,105,165,224,79,138,144,34,181,146,180,9,36,105,124,215,193,164,160,77,176,234,129,51,221,251,125,231,222,115,207,
+  133,255,12,213,108,193,137,211,1,100,1,180,176,175,239,46,175,214,108,117,226,116,56,113,76,241,83,202,93,154,121,104,
+  156,56,38,125,156,45,141,246,74,179,202,59,206,63,49,75,233,123,106,254,241,9,182,158,188,70,165,202,108,35,137,52,
+  130,35,137,91,110,110,226,178,18,81,40,183,76,46,53,74,100,248,122,67,137,172,134,111,186,185,231,103,197,242,172,199,
+  246,111,194,227,11,98,89,54,249,241,139,68,78,173,150,72,13,238,7,178,219,19,55,220,252,139,17,209,150,141,29,236,
+  166,58,55,129,50,101,188,225,189,248,163,67,84,191,56,244,156,187,79,165,202,236,155,99,12,2,88,53,209,100,228,244,
+  109,55,159,74,138,214,22,118,107,39,246,134,48,170,180,128,39,180,13,29,236,1,37,24,99,112,23,51,196,174,76,49,
+  149,136,189,4,212,202,21,90,2,93,69,221,226,199,14,108,198,183,115,136,106,118,28,17,176,55,198,16,109,163,68,106,
+  169,49,197,249,82,157,171,159,32,60,61,122,56,219,155,124,144,255,94,204,4,150,63,62,66,219,62,172,64,23,162,53,
+  198,24,20,6,227,130,132,98,165,233,145,131,94,96,207,74,15,6,198,152,3,194,239,46,29,13,216,109,209,69,74,95,
+  49,133,207,136,183,13,37,130,136,70,41,141,213,190,171,14,135,7,198,120,253,203,43,212,37,83,23,142,180,174,235,27,
+  94,176,124,65,68,129,136,254,153,109,189,165,116,242,64,29,158,107,54,202,250,234,33,186,247,119,242,62,122,230,206,55,
+  41,204,132,116,168,7,183,125,112,249,109,98,183,253,59,252,199,81,46,125,120,90,168,100,158,149,157,56,166,54,39,127,
+  245,153,250,129,201,122,147,215,84,249,95,226,7,144,100,183,170,35,108,244,94,0,0,0,0,73,69,78,68,174,66,96,
+  130,
+};
+const unsigned char Program2x[1490] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,5,137,73,68,65,84,88,133,237,150,91,108,20,
+  231,21,199,127,231,155,155,151,181,124,89,3,181,113,193,183,13,16,81,82,21,225,52,50,1,132,91,53,20,212,132,155,
+  212,84,149,18,161,40,82,213,151,72,68,81,108,212,74,121,168,122,81,165,190,24,171,125,141,218,226,66,171,66,91,37,
+  65,145,82,225,2,9,6,148,132,40,73,9,55,219,4,112,146,58,49,23,239,125,102,190,62,204,236,120,236,176,182,1,
+  169,79,29,233,232,236,203,156,255,239,252,207,249,190,29,248,255,115,31,79,182,135,157,153,94,116,102,47,91,239,181,134,
+  186,31,113,173,216,159,173,249,10,90,243,215,76,47,91,254,103,0,217,30,118,106,225,143,183,219,215,219,250,225,103,201,
+  180,173,179,53,28,186,23,136,187,6,8,58,151,253,147,233,13,142,151,106,97,226,76,63,238,194,54,50,237,143,222,19,
+  132,220,173,56,134,57,144,95,243,3,43,111,8,147,31,253,3,180,7,98,80,189,226,123,152,159,95,102,193,197,227,69,
+  129,237,201,95,240,234,124,106,206,219,129,108,47,59,48,204,1,111,211,139,150,145,254,22,217,11,175,160,68,163,148,66,
+  137,38,123,225,21,252,133,105,114,233,245,129,19,123,249,238,124,234,206,203,129,108,47,59,180,48,224,111,124,193,150,150,
+  46,138,19,23,64,107,4,184,253,225,1,220,155,163,160,65,139,34,153,222,140,57,62,76,213,197,227,69,17,182,37,127,
+  206,107,179,213,158,211,129,64,92,6,178,15,108,180,189,134,86,74,19,23,17,64,68,16,17,204,68,93,224,130,161,80,
+  2,185,203,175,227,54,180,145,79,175,179,181,230,240,92,78,204,234,64,36,158,126,212,246,83,203,64,187,56,141,107,65,
+  160,52,126,142,252,245,147,248,185,207,167,94,208,58,72,8,137,214,110,140,241,17,170,46,189,57,171,19,21,29,200,246,
+  176,93,139,12,228,210,235,108,63,245,85,242,163,255,68,187,249,168,115,63,51,6,133,137,160,251,40,12,68,41,148,8,
+  249,43,71,241,26,150,145,111,127,196,22,164,226,78,220,17,32,219,195,118,95,228,79,217,116,151,237,213,53,147,191,50,
+  136,8,129,128,8,34,10,17,65,41,99,70,168,169,12,20,174,30,195,91,216,66,182,173,211,169,4,241,37,128,178,120,
+  174,227,17,219,175,91,66,225,234,49,20,160,68,161,172,5,80,158,125,205,82,204,228,226,105,226,18,101,21,65,20,175,
+  158,192,75,45,37,219,182,214,17,228,208,100,15,155,43,2,100,122,217,22,136,63,108,251,117,77,20,174,190,137,8,72,
+  185,168,83,27,117,111,47,92,73,242,107,79,97,47,94,61,189,243,16,72,194,113,136,64,113,108,8,175,174,153,108,235,
+  26,71,41,57,28,135,136,0,244,75,40,224,80,177,190,209,102,201,215,41,140,157,14,108,151,169,249,154,53,205,136,72,
+  232,66,0,34,165,201,169,217,71,89,97,88,85,88,245,29,40,195,10,156,248,236,29,212,3,143,81,168,89,236,136,76,
+  45,100,4,32,47,225,227,179,205,158,248,164,40,215,222,193,105,90,19,21,20,81,24,201,69,40,59,137,136,160,115,227,
+  228,222,221,71,238,221,126,252,204,245,72,220,176,18,209,8,140,154,165,44,88,190,29,179,182,5,49,76,18,45,221,56,
+  185,12,206,237,255,20,181,158,218,133,105,35,72,254,138,191,9,250,251,137,225,51,69,243,198,117,236,198,111,32,202,68,
+  148,194,94,180,122,234,4,220,188,140,200,116,203,205,234,38,18,15,61,131,149,90,142,89,221,136,149,90,142,8,36,58,
+  182,80,219,245,83,18,84,33,39,250,139,190,231,63,81,253,75,142,68,141,223,233,20,100,122,217,134,200,129,98,251,90,
+  219,79,53,225,223,184,68,98,245,110,148,225,128,8,197,243,127,70,231,198,131,113,68,173,88,56,171,118,163,37,236,73,
+  107,52,160,18,13,232,145,33,244,241,254,146,246,220,199,227,226,21,1,166,65,164,59,109,107,197,86,84,162,1,9,174,
+  64,40,78,226,126,252,6,160,49,106,59,240,198,223,195,88,210,133,170,237,8,133,53,104,144,170,122,244,232,16,254,177,
+  59,139,207,10,80,134,208,168,131,170,251,121,75,45,93,131,206,127,17,118,45,248,55,47,66,225,38,102,227,90,180,214,
+  81,169,224,183,6,39,20,255,215,190,138,226,115,2,64,120,47,24,230,65,99,211,30,83,39,171,241,174,31,199,168,107,
+  71,223,56,15,94,1,107,229,15,65,153,83,215,176,214,96,215,161,71,79,226,205,33,62,47,128,50,132,54,140,3,254,
+  242,78,75,234,27,17,237,66,241,22,214,146,46,164,174,131,80,25,173,65,236,26,252,209,33,188,193,190,146,214,238,19,
+  115,253,27,206,247,131,196,248,108,15,59,146,85,242,7,86,126,211,182,59,127,140,246,242,168,240,78,40,3,96,85,227,
+  141,156,194,27,236,43,77,228,220,93,205,191,225,53,192,3,252,138,133,103,17,85,128,13,84,1,206,175,223,98,244,201,
+  85,92,72,101,174,109,241,201,24,102,115,39,248,110,112,52,145,72,188,52,216,231,190,255,169,251,244,131,253,28,5,204,
+  80,163,124,220,191,4,82,9,192,2,156,153,241,219,51,92,249,118,27,151,155,115,195,223,145,69,29,134,170,95,134,248,
+  46,88,73,252,145,33,74,131,125,238,209,97,247,71,221,47,115,44,38,94,6,80,4,142,135,91,90,25,192,8,1,236,
+  88,68,16,47,159,229,90,103,147,30,110,187,117,170,91,26,90,149,212,183,226,143,156,164,56,216,231,30,254,183,187,103,
+  215,65,222,10,197,227,162,241,81,107,130,177,204,10,96,134,16,102,8,80,6,114,0,231,192,7,140,173,72,249,87,86,
+  76,158,218,160,111,127,170,74,111,255,197,251,253,89,247,39,207,252,157,211,49,209,184,160,31,134,23,203,21,1,252,24,
+  189,17,203,101,48,3,176,14,159,99,172,165,198,191,182,218,26,89,255,187,51,254,207,158,59,194,233,25,66,238,140,40,
+  197,34,26,193,108,167,160,188,7,118,44,199,195,138,1,150,187,44,11,20,103,68,33,150,167,45,226,124,142,97,121,28,
+  54,211,71,83,22,143,47,150,23,235,62,14,51,173,235,187,5,184,211,59,113,241,114,141,153,179,158,215,243,95,119,198,
+  63,107,9,247,71,127,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Script1x[516] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,236,0,236,0,236,29,35,22,54,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,9,15,10,59,4,237,28,251,236,0,0,1,145,73,
+  68,65,84,56,203,149,147,191,142,218,64,16,198,127,131,86,162,12,206,3,32,10,10,55,72,199,91,68,138,168,82,240,
+  8,185,154,198,13,7,114,7,244,20,52,244,156,174,35,77,36,222,129,148,84,200,72,8,176,131,43,26,104,152,43,214,
+  235,24,78,119,209,141,52,187,171,209,206,55,223,252,147,201,100,242,114,56,28,126,240,57,105,247,251,253,103,0,194,48,
+  212,207,74,24,134,234,144,140,123,164,105,154,195,11,130,10,72,49,166,216,227,171,231,221,80,49,247,220,68,36,187,45,
+  16,128,170,3,211,55,185,152,98,4,231,128,8,162,5,187,100,12,84,222,7,144,34,3,205,12,130,5,18,7,252,17,
+  3,196,230,238,254,139,229,227,124,149,251,162,88,41,21,83,80,209,236,143,228,183,138,213,36,137,121,252,249,200,110,183,
+  123,7,64,29,135,2,227,76,255,38,49,189,94,143,32,8,232,116,58,92,175,215,183,0,82,228,231,10,42,16,39,49,
+  79,79,214,121,179,217,224,251,62,171,213,138,32,8,30,110,106,160,242,175,255,37,4,69,73,226,36,143,188,221,110,49,
+  198,80,175,215,73,211,148,40,138,150,65,16,52,239,230,64,17,205,134,72,36,119,222,239,247,24,99,242,25,41,151,203,
+  212,106,53,162,40,90,150,238,219,104,251,173,40,202,104,52,98,56,28,98,140,201,245,116,58,225,251,62,81,20,1,52,
+  115,0,207,243,240,60,143,74,165,98,245,75,133,106,181,202,96,48,96,58,157,98,140,225,114,185,0,176,88,44,0,154,
+  179,217,236,143,140,199,227,95,199,227,241,251,71,171,119,62,159,89,175,215,180,90,45,230,243,57,141,70,227,119,183,219,
+  253,118,195,252,191,251,219,110,63,0,75,23,217,217,95,1,152,44,191,17,163,238,139,75,0,0,0,0,73,69,78,68,
+  174,66,96,130,
+};
+const unsigned char Script2x[1416] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,215,8,23,10,12,43,51,207,145,74,0,0,5,21,73,
+  68,65,84,88,195,229,151,205,107,83,89,24,198,127,247,158,99,76,111,123,147,104,167,31,177,54,81,40,214,15,168,13,
+  84,69,92,248,63,12,210,133,185,139,161,10,69,3,66,113,97,177,210,157,152,216,224,66,200,136,3,98,23,22,92,205,
+  98,150,210,10,110,12,116,225,184,16,68,169,182,58,126,129,227,208,244,38,99,211,185,55,119,22,147,155,185,73,147,180,
+  21,102,53,7,14,247,205,201,225,60,207,251,188,239,121,207,57,240,127,111,74,237,64,38,147,249,94,74,57,13,232,66,
+  8,84,85,165,84,42,97,219,118,165,91,150,85,249,122,237,102,99,128,105,89,214,15,211,211,211,63,123,241,228,58,70,
+  138,114,231,236,217,179,122,217,198,178,44,164,148,56,142,83,53,207,251,123,147,182,158,72,36,238,0,205,9,216,182,29,
+  2,88,92,92,68,81,20,108,219,166,181,181,149,181,181,53,151,32,138,162,120,9,215,58,176,78,102,199,113,232,236,236,
+  100,109,109,45,84,251,159,172,55,217,5,113,23,171,181,235,125,27,129,111,212,214,17,40,149,74,85,160,94,160,87,175,
+  94,109,25,160,191,191,191,110,72,154,18,112,85,168,37,210,215,215,247,223,43,96,219,118,213,130,94,21,22,22,22,182,
+  12,112,224,192,129,173,43,208,40,4,251,246,237,251,38,5,220,241,77,17,112,21,168,151,132,47,95,190,108,232,233,193,
+  131,7,55,12,193,150,8,0,60,121,242,132,88,44,86,33,176,127,255,254,134,187,194,181,77,211,4,64,215,245,111,39,
+  224,38,225,209,163,71,171,246,127,35,101,220,246,233,211,39,50,153,12,0,151,46,93,90,71,162,30,1,181,89,8,74,
+  165,210,58,15,27,245,124,62,79,38,147,97,100,100,132,139,23,47,146,74,165,48,77,179,138,164,155,95,155,34,80,155,
+  68,141,138,147,43,123,42,149,34,145,72,48,59,59,203,221,187,119,137,199,227,85,36,182,164,128,183,26,54,218,17,110,
+  95,89,89,33,149,74,113,230,204,25,150,151,151,241,249,124,0,60,120,240,0,195,48,72,38,147,149,188,216,148,2,229,
+  147,171,241,241,89,199,243,120,60,206,163,71,143,40,22,139,28,58,116,8,93,215,177,44,139,217,217,89,12,195,224,218,
+  181,107,228,114,185,186,4,54,220,134,141,186,105,154,36,147,73,226,241,56,217,108,150,92,46,135,101,89,188,121,243,134,
+  66,161,128,16,2,203,178,152,155,155,195,48,12,38,39,39,235,58,180,169,28,168,109,43,43,43,36,147,73,12,195,32,
+  155,205,98,154,38,82,74,124,62,31,189,189,189,232,186,142,16,2,33,4,182,109,243,240,225,67,12,195,160,171,171,139,
+  209,209,209,240,150,114,160,54,238,94,217,31,63,126,76,62,159,71,85,85,130,193,32,66,8,62,127,254,12,128,223,239,
+  71,8,65,95,95,31,82,74,150,150,150,24,30,30,6,248,224,37,209,52,7,230,231,231,81,213,127,167,184,224,167,79,
+  159,38,155,205,86,164,150,82,210,219,219,139,227,56,124,248,240,1,219,182,137,70,163,196,98,49,162,209,40,39,78,156,
+  96,247,238,221,152,166,201,185,115,231,214,202,36,6,55,12,193,241,227,199,43,137,147,207,231,73,165,82,92,184,112,129,
+  249,249,121,10,133,2,170,170,86,188,239,238,238,230,235,215,175,68,34,17,142,28,57,66,36,18,97,199,142,29,168,170,
+  138,162,40,168,170,74,40,20,98,121,121,217,55,49,49,81,2,126,29,29,29,13,55,12,129,107,187,210,235,186,78,34,
+  145,224,230,205,155,12,13,13,177,109,219,54,132,16,4,131,65,6,6,6,200,231,243,188,120,241,2,0,77,211,170,128,
+  93,91,81,20,194,225,176,115,245,234,85,85,74,185,247,246,237,219,31,213,141,142,99,111,219,181,107,23,227,227,227,220,
+  191,127,159,147,39,79,210,223,223,207,224,224,32,171,171,171,104,154,70,169,84,162,167,167,167,10,220,155,75,221,221,221,
+  220,184,113,67,145,82,238,205,100,50,75,77,115,160,209,201,22,8,4,184,124,249,50,51,51,51,196,98,49,86,87,87,
+  121,246,236,25,79,159,62,101,207,158,61,248,253,254,117,94,123,192,241,130,55,221,5,205,90,32,16,96,98,98,130,116,
+  58,77,87,87,23,82,254,83,78,190,124,249,130,123,149,247,42,208,217,217,73,58,157,118,15,171,165,77,213,129,102,36,
+  28,199,33,16,8,112,229,202,21,110,221,186,197,208,208,16,66,8,194,225,112,197,99,23,188,163,163,131,116,58,205,228,
+  228,100,221,42,187,229,82,236,37,209,214,214,198,248,248,56,247,238,221,227,240,225,195,188,123,247,142,98,177,88,33,209,
+  222,222,206,212,212,20,99,99,99,104,154,182,169,195,72,87,85,117,197,113,28,66,161,16,129,64,128,96,48,136,166,105,
+  180,181,181,209,218,218,138,166,105,180,180,180,0,80,44,22,17,66,112,254,252,121,102,102,102,24,24,24,160,80,40,160,
+  40,10,59,119,238,228,250,245,235,140,140,140,32,132,32,151,203,161,40,74,30,216,11,104,245,158,102,58,208,113,236,216,
+  177,225,104,52,58,9,180,52,242,222,251,76,115,159,109,138,162,16,137,68,24,27,27,67,74,201,212,212,20,111,223,190,
+  197,178,44,84,85,69,74,89,124,253,250,245,143,207,159,63,255,5,248,13,88,4,74,94,2,62,160,11,104,7,66,192,
+  118,64,52,185,77,111,47,119,159,107,183,183,183,127,119,234,212,169,9,128,185,185,185,159,22,22,22,150,128,34,96,2,
+  22,176,12,124,4,22,128,223,235,62,78,203,139,249,203,11,43,27,92,233,253,229,222,82,254,110,239,233,233,233,6,148,
+  247,239,223,255,1,252,85,38,240,39,144,47,19,200,1,171,238,34,127,3,163,217,113,200,236,96,85,42,0,0,0,0,
+  73,69,78,68,174,66,96,130,
+};
+const unsigned char Text1x[333] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,4,22,20,15,56,186,96,38,66,0,0,0,218,73,
+  68,65,84,56,203,173,146,61,110,132,48,16,133,191,7,72,187,91,33,33,159,129,159,179,108,153,34,199,65,230,22,28,
+  33,81,218,28,6,115,1,26,250,173,76,138,136,21,36,94,88,162,188,106,44,123,222,124,51,30,181,109,251,49,12,195,
+  11,199,244,90,215,245,59,0,214,218,233,168,172,181,211,236,148,204,193,56,142,120,239,1,144,116,47,53,199,146,136,227,
+  152,52,77,87,40,119,3,239,61,206,185,85,194,82,146,168,170,234,87,47,201,242,80,20,197,38,65,72,201,242,225,146,
+  224,167,158,34,200,243,60,80,241,198,52,157,136,162,104,155,0,160,239,251,213,101,89,150,192,5,184,1,231,253,22,66,
+  4,146,144,46,15,23,98,69,224,156,219,28,222,55,209,206,47,132,9,180,79,32,137,174,235,130,149,231,233,135,140,130,
+  4,33,147,221,61,200,178,140,191,40,49,198,124,54,77,115,61,146,100,140,121,227,191,244,5,84,81,95,185,252,185,63,
+  236,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Text2x[744] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,2,159,73,68,65,84,88,133,229,151,77,106,27,
+  49,20,199,127,51,82,220,150,224,98,40,77,219,3,248,43,78,32,1,99,200,53,122,129,116,145,93,238,208,109,151,93,
+  121,25,240,9,122,144,44,188,181,177,13,1,23,210,93,11,77,3,177,59,26,117,17,107,170,145,53,95,110,187,234,131,
+  97,36,205,248,189,191,126,239,105,36,195,255,110,129,59,48,28,14,223,74,41,71,64,93,8,65,24,134,196,113,140,82,
+  42,185,162,40,74,238,118,59,111,12,184,139,162,232,221,104,52,250,100,199,147,91,138,130,224,234,226,226,162,190,105,19,
+  69,17,82,74,180,214,169,247,236,126,201,118,253,242,242,242,10,200,23,160,148,106,0,220,220,220,16,4,1,74,41,246,
+  247,247,89,175,215,70,32,65,240,27,156,221,246,245,141,144,131,131,3,214,235,117,195,125,182,37,64,107,157,4,49,206,
+  220,182,239,158,21,188,200,182,4,196,113,156,10,106,7,90,44,22,201,243,50,65,133,16,180,90,173,212,228,74,9,48,
+  20,92,33,205,102,243,223,19,80,74,165,28,218,20,118,33,208,110,183,147,126,105,2,190,224,65,16,208,106,181,118,34,
+  96,198,75,9,48,4,124,69,56,159,207,81,74,149,198,46,132,160,211,233,36,253,74,2,0,198,227,49,167,167,167,137,
+  0,131,211,183,42,138,196,84,18,96,138,112,48,24,164,214,255,108,54,171,76,160,219,237,86,23,96,28,199,113,156,10,
+  208,110,183,51,191,15,69,98,128,173,2,206,21,96,155,9,100,8,100,5,115,199,132,16,28,30,30,38,253,202,41,112,
+  103,106,10,202,183,66,178,68,217,86,138,192,102,231,242,218,116,58,77,57,41,218,7,132,16,244,122,189,106,2,220,101,
+  104,95,221,110,183,212,62,225,51,173,245,238,53,144,101,89,169,240,5,135,10,4,178,118,196,233,116,154,90,134,69,219,
+  178,16,130,163,163,163,45,33,185,2,236,26,184,190,190,166,223,239,39,125,55,5,190,203,22,227,11,88,138,128,177,179,
+  179,51,86,171,85,226,212,16,176,131,228,225,151,82,114,124,124,92,93,128,81,110,112,27,231,101,8,216,239,255,49,1,
+  119,86,147,201,36,115,179,242,253,102,39,2,166,6,124,72,13,129,48,12,75,81,208,90,23,82,200,77,129,107,134,64,
+  86,254,165,148,156,156,156,84,58,25,101,166,192,62,150,25,179,107,32,139,130,123,44,47,162,80,233,83,108,155,113,234,
+  138,44,83,120,121,2,234,97,24,126,215,90,63,111,52,30,143,240,74,41,246,246,246,42,59,54,102,11,172,213,106,119,
+  192,107,224,27,176,114,5,212,129,151,183,183,183,31,206,207,207,223,3,207,118,138,152,45,228,97,185,92,126,4,222,0,
+  2,248,2,196,54,191,26,240,10,120,1,52,128,39,155,23,255,134,61,240,56,217,123,224,43,240,25,248,1,158,63,167,
+  155,192,79,55,130,170,31,244,253,22,3,63,121,196,190,2,146,124,254,2,1,73,132,34,19,146,251,201,0,0,0,0,
+  73,69,78,68,174,66,96,130,
+};
+const unsigned char Video1x[592] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,213,4,28,9,32,30,1,50,75,149,0,0,1,221,73,
+  68,65,84,56,203,165,147,191,170,26,81,16,198,127,251,71,55,55,70,238,53,32,65,13,168,205,54,194,86,203,130,205,
+  54,10,130,104,231,59,228,33,146,34,16,244,17,52,15,96,17,172,197,70,43,27,219,72,34,9,11,130,141,165,138,112,
+  37,146,213,157,20,234,230,154,164,72,110,6,206,97,102,190,153,57,243,13,103,20,203,118,94,37,19,119,239,1,2,225,
+  44,114,190,5,4,68,4,80,78,30,57,97,135,195,33,248,238,251,175,177,108,71,122,189,158,108,183,91,25,14,135,82,
+  42,149,174,108,215,117,255,136,183,90,45,177,108,71,176,108,71,14,135,131,172,86,43,73,167,211,226,186,238,95,217,205,
+  102,83,44,219,17,149,255,20,237,69,58,243,54,249,60,129,105,154,56,142,195,100,50,33,22,139,133,246,120,60,38,30,
+  143,255,134,111,54,27,62,127,249,138,98,217,142,36,19,119,60,102,136,247,223,246,170,14,144,121,153,225,126,187,253,167,
+  214,159,221,222,6,31,63,205,84,21,224,137,97,0,208,237,118,169,86,171,24,134,65,52,26,37,18,137,80,175,215,209,
+  52,13,85,85,169,215,235,40,138,194,57,71,7,80,1,162,209,40,34,66,16,4,100,179,89,114,185,220,245,160,52,45,
+  76,20,57,209,208,117,29,128,83,149,51,56,157,78,201,231,243,152,166,73,173,86,3,192,243,60,42,149,10,166,105,226,
+  121,30,134,97,176,223,239,209,53,141,176,131,167,55,55,136,8,237,118,155,217,108,198,104,52,162,211,233,176,88,44,240,
+  125,159,76,38,67,54,155,101,50,153,224,251,62,34,18,210,86,1,34,145,8,0,229,114,153,245,122,77,185,92,166,84,
+  42,145,203,229,40,20,10,44,151,75,82,169,20,197,98,145,227,241,200,133,118,72,225,120,60,34,34,12,6,131,144,39,
+  64,191,223,7,32,159,207,211,104,52,174,102,16,4,193,207,2,23,231,229,132,191,225,172,207,231,243,80,255,53,78,191,
+  4,219,182,29,82,121,152,12,132,175,61,212,119,187,29,0,138,101,59,239,128,55,143,92,133,15,63,0,208,50,35,119,
+  229,61,168,67,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Video2x[1797] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,6,188,73,68,65,84,88,133,181,151,91,76,83,
+  93,22,199,127,231,244,6,167,104,65,10,109,211,130,14,166,145,64,21,5,9,32,40,26,103,38,51,18,18,131,10,98,
+  120,250,136,153,239,69,39,70,125,51,62,249,228,211,224,37,25,231,193,33,38,227,131,68,162,35,23,141,196,91,58,64,
+  212,185,136,22,33,96,64,229,90,185,89,164,20,122,217,243,128,237,199,165,31,223,120,153,149,52,107,159,221,189,215,255,
+  191,46,123,237,115,36,254,191,98,5,10,12,6,195,94,149,74,181,219,239,247,39,76,79,79,151,0,255,12,47,144,190,
+  35,152,14,216,170,86,171,11,13,6,195,239,252,126,127,78,66,66,130,186,160,160,64,147,150,150,22,107,50,153,24,31,
+  31,231,242,229,203,45,227,227,227,191,249,30,128,86,224,144,193,96,248,115,98,98,98,151,193,96,248,148,145,145,49,187,
+  111,223,190,208,137,19,39,196,139,23,47,196,200,200,136,120,247,238,157,168,168,168,16,138,162,136,139,23,47,10,69,81,
+  166,23,27,145,191,192,187,2,181,90,125,210,104,52,182,196,197,197,125,52,153,76,189,123,246,236,249,219,185,115,231,254,
+  112,247,238,221,77,29,29,29,250,157,59,119,198,120,189,94,169,173,173,13,149,74,197,216,216,24,157,157,157,220,184,113,
+  3,128,152,152,24,172,86,43,128,61,108,88,189,138,119,59,18,18,18,126,173,86,171,139,253,126,191,109,203,150,45,161,
+  162,162,34,197,108,54,171,100,89,230,253,251,247,56,28,14,10,11,11,241,249,124,212,212,212,112,229,202,21,0,78,158,
+  60,137,70,163,65,171,213,50,49,49,193,249,243,231,17,66,240,230,205,27,62,125,250,4,32,150,19,72,208,233,116,63,
+  196,199,199,255,126,118,118,54,39,41,41,73,149,158,158,174,179,88,44,218,244,244,116,118,239,222,205,198,141,27,153,159,
+  159,167,180,180,148,103,207,158,161,209,104,120,244,232,17,94,175,23,89,150,233,238,238,230,224,193,131,216,237,118,170,171,
+  171,233,234,234,162,181,181,53,116,231,206,157,249,190,190,62,52,26,205,96,40,20,122,252,241,227,199,235,64,111,152,128,
+  4,144,156,156,220,84,89,89,249,219,210,210,82,85,75,75,11,141,141,141,196,198,198,226,243,249,112,187,221,180,182,182,
+  162,209,104,120,242,228,9,85,85,85,216,108,54,170,170,170,56,118,236,24,26,141,6,151,203,197,133,11,23,232,235,235,
+  11,13,15,15,207,207,204,204,248,116,58,221,127,60,30,79,243,252,252,124,43,11,85,63,27,45,212,106,0,73,146,212,
+  37,37,37,170,194,194,66,170,171,171,169,175,175,231,236,217,179,60,127,254,156,178,178,50,244,122,61,42,149,138,64,32,
+  192,165,75,151,232,233,233,193,227,241,132,42,42,42,102,94,190,124,41,3,35,192,227,169,169,169,22,224,31,192,187,233,
+  233,233,104,120,209,9,76,76,76,52,60,126,252,120,79,81,81,145,58,16,8,144,144,144,192,169,83,167,56,115,230,12,
+  178,44,115,251,246,109,156,78,167,175,165,165,69,120,60,30,127,76,76,204,191,166,166,166,154,3,129,128,19,248,247,207,
+  121,247,37,178,37,39,39,231,227,228,228,164,176,90,173,226,193,131,7,162,161,161,65,92,189,122,85,108,218,180,41,104,
+  54,155,31,2,135,129,212,111,5,90,46,225,70,36,165,164,164,188,153,158,158,254,149,94,175,167,166,166,6,175,215,139,
+  215,235,101,116,116,148,107,215,174,161,40,10,90,173,246,155,1,67,161,144,208,235,245,127,113,58,157,63,194,79,167,64,
+  36,38,38,154,159,62,125,202,246,237,219,81,20,133,161,161,33,0,178,178,178,40,47,47,167,190,190,158,35,71,142,32,
+  203,50,249,249,249,100,100,100,32,73,18,67,67,67,220,189,123,23,33,4,241,241,241,28,56,112,0,157,78,135,199,227,
+  161,174,174,142,185,185,57,180,90,45,229,229,229,24,141,70,66,161,144,148,155,155,123,20,248,113,9,179,172,172,172,217,
+  145,145,17,81,82,82,34,82,83,83,69,106,106,170,216,176,97,131,176,219,237,194,110,183,139,226,226,98,97,50,153,4,
+  32,52,26,141,168,173,173,21,175,94,189,18,157,157,157,226,248,241,227,130,133,179,45,246,238,221,43,222,190,125,43,6,
+  6,6,68,93,93,157,208,104,52,2,16,235,215,175,23,189,189,189,98,110,110,78,100,102,102,70,250,64,228,46,216,186,
+  117,171,183,185,185,57,86,150,101,26,27,27,233,233,233,1,32,51,51,147,188,188,60,214,172,89,195,248,248,56,245,245,
+  245,4,2,1,98,99,99,57,116,232,16,113,113,113,72,146,196,189,123,247,232,237,93,56,222,249,249,249,20,20,20,32,
+  203,50,93,93,93,52,53,53,33,132,192,102,179,81,89,89,201,142,29,59,68,71,71,135,188,132,64,94,94,222,159,252,
+  126,255,31,21,69,249,170,220,10,33,8,133,66,145,103,149,74,21,45,255,248,124,62,20,69,249,171,211,233,252,97,9,
+  1,0,171,213,42,142,30,61,74,119,119,55,146,180,240,87,88,135,65,132,16,95,61,54,26,141,52,55,55,51,56,56,
+  24,49,186,226,50,90,236,69,52,81,171,213,232,245,122,138,138,138,86,93,23,77,162,217,94,113,25,133,23,9,33,112,
+  56,28,164,167,167,99,177,88,184,126,253,58,235,214,173,163,184,184,152,238,238,110,114,114,114,120,253,250,53,31,62,124,
+  136,236,13,123,155,148,148,132,219,237,94,49,31,214,191,72,64,8,129,36,73,12,12,12,96,179,217,48,26,141,236,223,
+  191,159,109,219,182,49,59,59,75,90,90,26,42,149,138,93,187,118,113,243,230,205,21,70,205,102,243,18,2,95,20,129,
+  96,48,24,97,59,57,57,73,87,87,23,14,135,131,91,183,110,161,40,10,181,181,181,172,93,187,22,189,94,31,105,76,
+  139,61,91,109,252,63,167,64,8,65,82,82,18,38,147,9,69,81,176,217,108,88,44,22,30,62,124,72,74,74,74,196,
+  96,48,24,196,225,112,44,1,139,139,139,3,96,243,230,205,145,121,151,203,69,32,16,248,50,2,110,183,59,146,95,151,
+  203,197,204,204,76,4,36,59,59,155,169,169,41,60,30,15,99,99,99,24,141,70,20,69,161,191,191,159,211,167,79,51,
+  51,51,195,224,224,32,77,77,77,164,166,166,70,162,26,214,171,18,8,6,131,43,138,229,243,91,76,196,163,236,236,108,
+  218,219,219,57,124,248,48,138,162,208,222,222,142,197,98,161,161,161,129,177,177,49,10,11,11,177,219,237,184,92,46,122,
+  123,123,35,246,162,69,96,69,31,40,43,43,99,120,120,152,228,228,100,204,102,243,138,13,97,18,203,199,97,157,155,155,
+  139,78,167,195,233,116,70,250,64,56,5,90,173,150,182,182,182,37,125,224,103,143,161,219,237,142,90,201,203,9,44,39,
+  209,209,209,177,130,84,88,127,117,10,126,137,196,106,17,89,172,191,168,8,147,147,147,49,153,76,171,146,232,239,239,199,
+  227,241,68,5,140,54,183,40,2,106,32,176,156,64,76,120,145,16,130,209,209,81,70,71,71,87,37,176,90,42,162,145,
+  89,244,108,5,60,192,100,152,128,12,172,149,36,41,20,12,6,101,131,193,16,217,176,252,183,216,88,56,172,139,199,240,
+  83,20,151,147,249,220,97,5,144,244,25,211,191,152,128,44,73,210,223,239,223,191,191,127,85,183,191,81,132,16,15,88,
+  136,188,10,150,30,195,53,192,58,192,0,232,1,205,119,198,246,179,224,232,60,48,13,124,0,38,150,127,29,171,63,131,
+  199,178,240,61,248,61,37,200,66,225,249,128,79,159,199,252,23,167,27,171,202,82,178,3,134,0,0,0,0,73,69,78,
+  68,174,66,96,130,
+};
+}
+namespace Go {
+const unsigned char Down1x[683] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,2,61,73,68,65,84,56,141,
+  133,147,77,104,19,65,24,134,223,153,236,230,15,107,192,96,210,67,252,193,170,245,34,26,143,73,180,224,193,139,241,34,
+  20,47,30,42,226,65,20,234,161,85,241,42,8,210,21,60,169,80,132,156,20,33,162,82,83,91,114,177,214,85,8,181,
+  45,20,123,168,85,180,84,205,154,174,253,11,233,38,179,179,159,135,214,26,155,24,223,227,55,223,60,243,190,243,205,48,
+  34,66,181,226,221,106,30,132,48,234,137,193,208,123,68,115,117,73,169,105,34,132,111,93,72,195,118,4,108,71,96,201,
+  42,96,201,50,1,0,119,31,221,168,1,215,2,0,48,198,144,155,121,142,178,93,66,161,56,131,143,115,99,104,63,120,
+  181,174,41,94,175,88,29,202,163,248,235,110,108,8,0,17,136,28,16,17,20,238,110,8,80,18,151,85,157,28,196,214,
+  237,187,96,57,36,189,146,108,72,178,177,92,54,81,189,22,239,82,215,13,50,142,55,10,57,72,69,66,45,209,139,39,
+  175,251,20,151,10,34,199,43,73,130,152,4,184,68,81,22,160,122,57,184,194,112,254,212,53,47,8,16,162,130,116,54,
+  85,154,95,156,75,49,34,66,162,91,77,183,69,143,39,143,68,147,158,247,249,87,144,92,64,162,140,21,123,17,211,243,
+  57,16,104,45,22,71,219,246,211,24,157,24,41,79,78,141,247,189,238,17,237,124,45,114,199,203,177,140,241,197,152,162,
+  72,112,47,136,87,0,151,141,66,101,26,170,143,193,237,227,80,125,46,68,35,71,97,46,152,52,249,97,220,32,194,153,
+  245,75,212,53,81,4,33,249,112,240,158,229,229,77,8,248,131,40,209,79,148,93,139,112,123,57,220,62,23,182,109,217,
+  131,144,175,5,217,161,140,69,14,146,186,38,138,127,77,65,215,196,68,69,172,116,62,24,188,83,218,17,56,0,155,149,
+  160,122,86,79,222,188,41,128,253,161,99,232,203,62,46,9,81,233,212,53,49,81,119,140,186,38,122,103,141,79,47,134,
+  199,6,68,107,48,1,174,48,40,110,142,67,225,19,200,189,123,91,249,97,126,235,215,53,209,219,240,29,144,131,142,161,
+  145,129,239,166,177,64,187,155,98,216,229,143,193,252,186,76,185,81,61,239,200,213,220,13,1,186,38,138,36,145,204,100,
+  159,89,91,177,15,65,167,21,79,251,159,88,142,252,147,187,90,108,227,111,252,173,120,151,122,46,210,188,243,54,0,204,
+  230,63,95,218,104,253,191,0,0,56,124,69,189,15,0,195,55,197,217,127,245,252,2,115,74,18,42,134,104,28,203,0,
+  0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Down2x[1187] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,4,90,73,68,65,84,88,133,237,151,75,108,84,
+  85,24,199,127,231,220,123,167,45,136,80,192,52,106,164,166,74,133,38,8,49,32,6,35,226,2,35,77,148,5,232,198,
+  4,19,20,81,23,110,208,184,37,238,8,52,65,99,98,98,208,196,4,23,4,173,152,64,8,226,163,60,218,130,242,48,
+  66,169,60,3,161,180,180,5,250,160,157,199,189,231,156,207,197,204,180,211,50,45,23,35,97,195,151,252,115,103,230,156,
+  57,255,223,247,157,199,189,23,238,199,61,14,21,167,211,162,117,190,248,94,0,128,136,96,157,185,237,127,18,147,76,89,
+  195,122,210,183,235,231,199,1,0,248,116,205,215,56,103,177,98,176,206,96,197,224,156,193,58,139,43,248,45,178,33,223,
+  212,215,133,253,41,83,2,255,35,0,192,129,11,219,137,76,154,200,101,136,108,134,200,166,137,108,134,208,166,137,108,72,
+  198,36,89,54,251,93,4,36,238,152,58,110,71,149,155,45,165,110,157,181,124,27,18,219,247,206,1,226,132,195,221,61,
+  0,201,85,85,138,100,153,111,139,179,56,255,51,64,206,29,65,16,25,169,124,155,187,155,0,34,130,19,151,203,54,47,
+  134,128,34,151,25,170,196,93,1,200,90,57,68,28,174,64,144,5,75,71,131,119,108,14,69,182,225,162,117,126,54,13,
+  69,10,64,9,9,33,159,105,22,64,16,80,130,210,130,136,97,48,186,142,40,139,26,222,12,37,37,214,239,94,244,17,
+  38,199,94,6,208,84,103,110,217,66,183,158,3,162,62,88,88,179,244,243,229,139,87,149,129,67,200,102,42,34,88,177,
+  160,29,10,135,86,66,104,7,232,13,187,16,207,226,123,26,17,72,36,74,88,243,250,58,196,17,32,4,34,194,15,191,
+  124,27,94,235,237,248,164,88,5,138,30,197,207,127,236,125,185,114,241,251,171,159,168,172,78,156,232,104,192,216,8,35,
+  33,142,8,43,33,41,219,207,141,116,27,25,155,28,113,46,136,8,226,64,156,160,8,120,169,106,21,199,79,254,153,110,
+  61,127,172,254,224,70,251,102,49,175,162,107,32,221,103,63,220,209,184,229,68,79,111,143,173,156,58,7,135,1,109,65,
+  91,122,194,54,186,82,231,48,42,133,31,104,252,64,225,39,20,94,160,134,190,123,129,230,217,202,90,174,118,119,184,83,
+  231,143,95,244,39,218,183,139,249,140,9,112,244,43,162,200,164,107,183,254,252,89,223,4,61,69,42,38,87,34,218,114,
+  61,115,153,126,211,137,14,192,11,116,214,56,161,115,159,53,94,206,188,186,98,1,101,186,156,134,67,187,7,196,153,87,
+  198,187,41,141,185,11,154,54,209,53,48,120,115,217,119,123,190,200,204,152,60,135,132,95,66,95,120,21,207,215,120,254,
+  112,166,126,34,91,129,108,37,52,15,61,248,24,51,203,23,178,107,111,125,42,50,230,141,166,58,46,141,229,1,224,141,
+  215,216,118,200,93,153,58,111,160,179,247,230,245,165,115,171,159,11,58,146,173,56,29,101,51,245,53,158,159,189,106,79,
+  161,60,69,105,48,145,133,15,175,100,79,195,206,100,103,79,251,166,166,141,102,203,120,227,223,22,0,224,114,179,59,86,
+  90,211,254,164,88,53,235,153,234,23,252,246,100,43,218,147,97,243,64,227,121,10,79,107,22,84,172,160,165,165,37,58,
+  113,250,175,198,198,13,102,204,121,47,140,88,7,81,239,68,187,246,88,107,227,63,93,237,55,236,188,138,151,209,158,66,
+  123,249,133,167,240,18,138,154,233,75,184,217,147,148,198,35,251,186,83,68,43,136,121,75,142,5,208,178,158,80,133,166,
+  118,111,227,206,222,68,56,149,170,201,243,81,26,148,86,104,95,241,232,164,217,148,171,42,126,220,85,159,138,172,94,118,
+  116,3,125,113,198,141,13,0,112,96,51,29,153,76,248,218,142,221,219,83,51,202,230,51,189,244,113,0,30,240,166,49,
+  115,194,18,190,255,105,91,210,100,82,107,15,111,10,255,142,59,38,196,88,3,57,72,31,8,218,154,93,215,180,167,163,
+  222,171,221,109,47,46,153,183,60,232,9,47,51,183,252,85,126,221,247,91,250,194,197,51,219,26,235,236,102,32,200,73,
+  23,36,56,230,116,140,5,144,55,45,201,169,52,175,43,127,184,83,147,106,250,159,50,198,84,45,158,181,194,111,61,115,
+  210,52,31,62,112,238,232,86,243,158,25,196,7,18,5,16,126,206,195,99,248,212,29,1,83,12,96,40,227,81,74,228,
+  84,210,117,86,246,171,71,58,107,147,201,228,148,166,35,7,147,103,247,132,111,245,93,32,85,96,150,207,94,141,18,48,
+  242,177,105,188,10,140,214,208,32,54,133,24,227,126,79,79,232,88,125,237,140,125,231,210,126,57,157,27,216,1,118,212,
+  181,80,102,52,192,120,239,5,58,7,88,88,198,194,236,242,80,249,144,81,102,54,103,152,151,163,200,90,136,245,98,82,
+  208,183,152,10,1,10,117,231,79,168,247,227,94,196,191,235,53,47,22,118,148,109,219,0,0,0,0,73,69,78,68,174,
+  66,96,130,
+};
+const unsigned char Home1x[606] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,213,10,14,20,37,19,83,42,210,59,0,0,1,235,73,
+  68,65,84,56,203,149,147,191,107,83,81,20,128,191,123,251,222,75,211,64,242,36,160,85,135,100,81,123,19,104,85,172,
+  17,92,28,140,66,19,167,135,212,74,39,145,162,163,24,92,58,180,110,193,169,254,24,234,212,37,139,245,199,96,19,240,
+  15,240,63,16,121,91,92,196,90,219,240,98,81,137,33,121,215,33,246,217,151,80,33,103,186,92,206,247,221,115,14,231,
+  194,1,225,41,85,172,128,174,128,246,148,122,200,48,177,7,123,74,105,79,169,61,73,113,104,120,177,56,163,203,55,111,
+  252,87,34,250,225,154,235,110,20,148,98,253,220,89,182,39,78,113,228,240,56,39,188,38,83,107,107,212,92,151,130,82,
+  215,14,185,110,117,64,176,31,126,83,156,97,247,248,49,148,202,50,22,141,210,106,181,24,219,252,74,182,92,30,144,136,
+  126,184,122,251,22,157,100,146,116,42,77,42,149,2,64,107,104,183,219,236,214,235,156,44,149,66,18,177,31,126,247,160,
+  68,199,48,201,229,46,96,219,118,208,154,214,26,0,223,247,249,185,181,69,114,110,46,144,136,10,232,130,82,188,127,84,
+  198,107,54,57,63,157,35,30,143,35,132,8,9,124,223,15,206,134,16,140,230,243,212,92,23,3,184,3,172,78,157,62,
+  195,253,210,61,54,170,111,3,240,201,202,51,86,30,63,69,139,17,116,167,133,48,70,209,221,223,44,47,45,209,238,165,
+  204,202,121,120,190,48,153,33,17,79,0,160,212,4,153,140,34,155,205,244,94,20,146,145,244,149,222,196,83,121,144,22,
+  90,107,22,38,51,204,195,186,236,239,211,178,44,76,211,196,48,140,224,254,75,227,7,0,31,234,59,116,187,126,144,11,
+  48,32,144,82,34,165,196,146,159,1,232,96,241,241,83,3,128,111,222,47,58,34,18,90,36,99,96,179,254,14,207,231,
+  40,0,151,46,78,115,53,26,67,234,113,46,75,147,237,77,66,21,24,253,21,252,155,126,239,165,239,222,14,162,217,56,
+  112,245,3,65,36,18,193,182,109,18,137,4,2,137,16,16,139,197,112,28,103,0,178,44,43,252,23,174,207,58,175,0,
+  135,225,98,245,229,139,215,119,255,0,86,248,213,163,133,187,128,26,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Home2x[1774] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,6,165,73,68,65,84,88,133,213,151,105,108,84,
+  215,21,199,127,119,121,111,54,143,199,96,199,118,48,120,12,184,200,20,8,187,218,34,71,8,186,56,106,80,165,162,42,
+  180,105,138,132,148,168,74,34,65,84,5,169,223,218,74,249,148,79,17,81,149,46,18,4,186,80,86,41,105,43,149,6,
+  21,53,4,137,184,13,132,8,154,64,98,226,98,48,216,96,60,216,99,207,246,238,189,253,48,11,94,134,85,202,135,30,
+  233,74,119,222,61,239,156,255,57,231,127,206,220,7,255,207,178,79,202,151,255,32,196,173,189,48,231,97,109,136,135,121,
+  105,63,248,40,181,167,177,161,225,137,150,154,154,218,211,189,189,253,129,49,223,120,26,62,249,194,1,236,129,198,136,214,
+  239,44,152,55,111,65,219,172,89,225,220,208,16,35,233,52,167,251,250,6,242,65,240,157,31,66,247,131,216,147,15,162,
+  252,59,88,17,11,133,78,175,90,190,124,113,91,91,91,24,41,113,64,196,247,89,222,218,218,20,246,188,191,254,17,190,
+  249,133,0,216,175,212,143,106,107,106,254,222,217,217,57,171,190,177,81,34,37,40,5,66,224,128,144,231,177,44,153,108,
+  8,249,254,159,246,41,245,131,251,181,123,207,18,252,28,228,66,165,94,111,104,106,122,122,197,170,85,117,74,74,48,6,
+  172,197,166,82,216,225,97,50,198,96,0,7,4,214,114,238,242,229,155,153,92,238,23,155,172,221,113,47,251,234,174,81,
+  67,226,17,173,143,182,119,116,60,177,100,245,234,90,169,74,234,66,96,135,134,112,195,195,20,140,33,164,20,198,57,140,
+  115,32,4,245,181,181,145,145,92,238,171,223,181,182,246,128,181,255,120,168,12,236,134,5,49,207,59,178,108,205,154,217,
+  77,173,173,26,107,193,24,92,16,96,47,93,34,184,117,139,51,195,67,92,29,188,193,202,100,146,230,104,148,113,107,201,
+  58,135,3,44,112,113,96,96,100,52,157,62,248,61,99,158,21,197,4,77,147,170,28,216,171,212,147,181,53,53,239,117,
+  110,216,208,214,212,222,174,81,10,164,196,25,131,189,120,145,241,155,55,121,127,104,144,196,75,219,88,117,234,20,255,77,
+  196,232,73,143,18,149,146,112,137,19,56,199,220,198,198,218,153,137,196,83,7,180,126,235,24,232,251,202,192,1,173,127,
+  22,111,104,216,246,149,174,174,25,94,36,82,140,218,90,220,200,8,230,252,121,110,142,142,114,46,147,38,249,203,55,136,
+  44,121,12,99,12,194,90,174,253,244,101,212,169,51,44,138,215,146,3,70,140,193,81,12,123,32,149,202,12,14,15,127,
+  48,28,4,93,63,134,241,170,0,118,65,56,166,212,161,57,11,22,60,190,120,253,250,184,152,72,182,129,1,204,133,11,
+  92,74,167,185,18,9,51,255,205,221,200,250,122,130,32,64,74,137,148,18,107,45,67,191,122,131,244,222,189,44,79,212,
+  97,132,32,101,12,22,112,206,145,74,167,115,253,55,110,156,79,7,193,218,45,144,42,251,85,0,191,135,217,81,173,79,
+  44,237,236,92,249,165,181,107,163,229,246,66,8,108,111,47,193,133,11,156,75,167,73,127,121,33,237,187,247,32,227,113,
+  140,49,68,34,17,102,206,156,73,44,22,195,24,67,120,197,74,188,214,57,124,124,228,8,205,218,35,170,53,89,231,176,
+  128,239,251,58,234,251,245,217,241,241,167,190,237,220,129,183,32,93,201,192,62,41,251,31,223,184,177,57,49,127,126,49,
+  35,214,226,130,0,243,209,71,100,251,250,248,112,116,148,25,155,55,211,244,194,11,24,99,176,214,18,139,197,8,135,195,
+  147,202,151,201,100,200,100,50,100,207,158,165,231,249,231,89,18,10,81,19,10,113,221,24,10,37,114,230,179,89,219,123,
+  245,234,21,107,204,186,239,67,143,4,208,74,229,18,237,237,2,165,64,41,156,49,4,221,221,140,124,254,57,221,35,35,
+  204,126,245,85,154,95,124,17,231,28,74,41,18,137,4,190,239,99,173,173,44,99,12,190,239,83,83,83,67,108,233,82,
+  58,14,29,226,172,148,220,200,100,104,212,26,191,68,78,29,10,201,185,45,45,115,164,82,255,156,220,5,165,201,230,198,
+  198,8,222,125,151,107,151,47,243,161,181,44,58,120,144,196,186,117,56,231,208,90,19,141,70,75,73,154,236,188,188,23,
+  66,16,137,68,8,183,180,176,248,237,183,185,212,216,72,239,216,24,141,90,19,41,129,144,158,135,86,202,77,107,67,55,
+  48,64,225,216,49,46,12,14,114,233,209,71,89,126,228,8,225,121,243,0,240,60,15,207,243,38,57,158,234,124,226,242,
+  60,15,47,145,96,225,254,253,140,173,94,205,127,70,71,121,68,41,226,82,34,197,237,230,171,0,48,159,125,70,238,248,
+  113,78,246,247,19,172,95,207,99,135,15,35,227,113,156,115,72,41,17,66,220,151,243,169,217,144,158,199,188,215,94,35,
+  252,204,51,188,63,52,196,12,41,153,33,111,199,173,1,2,99,194,215,78,158,228,124,42,53,58,190,105,83,108,197,43,
+  175,72,107,45,184,226,240,114,206,225,220,228,65,86,254,45,132,64,107,141,16,98,154,78,89,207,24,67,203,214,173,28,
+  239,233,41,4,71,143,6,29,241,120,36,31,4,53,21,0,57,107,215,255,187,175,239,196,220,45,91,126,114,184,174,110,
+  215,215,149,34,8,2,142,30,125,135,177,241,177,138,163,169,18,141,196,232,234,234,98,199,142,215,201,231,115,211,206,1,
+  60,63,196,75,219,182,146,207,231,25,156,63,63,104,59,113,226,91,31,244,247,255,165,96,237,154,10,128,205,240,49,206,
+  205,100,231,78,182,111,223,190,171,194,234,144,207,167,61,231,39,25,20,66,84,192,44,236,88,132,115,142,124,62,135,73,
+  62,137,239,41,60,45,49,198,146,47,88,114,133,0,174,252,13,231,28,133,66,1,165,84,102,99,127,255,123,64,221,52,
+  14,76,148,114,13,91,231,180,162,181,174,16,208,247,253,202,222,243,60,146,173,73,172,181,37,96,32,5,40,33,138,36,
+  155,144,176,114,25,172,181,211,106,84,245,15,194,57,135,181,150,100,50,137,214,85,85,0,104,104,104,168,0,24,207,6,
+  228,242,134,241,92,192,173,177,28,35,99,57,50,57,195,215,162,197,128,74,99,59,255,64,0,148,214,149,72,68,105,35,
+  25,71,139,94,242,174,3,4,21,0,255,250,228,90,117,148,81,38,118,69,97,234,241,93,75,80,118,44,40,165,84,128,
+  39,62,101,195,154,63,163,196,40,80,157,249,213,196,24,131,115,46,152,250,252,142,25,48,198,128,115,147,217,47,32,207,
+  50,14,28,95,92,41,77,113,232,248,172,171,59,83,213,177,246,138,35,187,80,40,32,165,204,62,16,0,237,121,20,131,
+  159,220,130,158,231,21,241,8,200,102,179,60,247,220,179,85,219,180,108,43,151,203,149,203,122,207,12,132,202,81,89,107,
+  145,66,86,53,60,17,80,62,159,39,159,191,205,173,106,37,145,82,82,40,20,8,130,192,2,13,20,239,3,193,84,0,
+  62,80,47,132,8,178,217,172,142,199,227,147,122,254,78,18,143,199,239,122,94,6,116,253,250,117,10,133,130,1,154,75,
+  126,7,1,59,17,128,6,252,84,42,245,230,206,157,59,183,56,231,238,122,99,6,248,205,175,127,123,47,149,138,8,33,
+  178,221,221,221,123,129,48,197,96,5,76,190,19,10,160,190,180,106,75,74,119,30,2,15,38,121,138,183,175,12,112,11,
+  184,12,100,167,2,40,139,7,68,74,72,31,234,227,181,138,56,160,80,114,154,101,194,21,253,127,69,252,95,225,237,227,
+  107,122,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Left1x[655] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,2,33,73,68,65,84,56,141,
+  133,147,79,72,20,113,20,199,191,111,102,126,179,59,187,82,98,108,173,27,181,66,8,17,9,130,149,110,91,135,220,34,
+  86,211,76,68,34,136,14,37,116,178,162,45,186,122,137,16,3,59,196,30,36,240,208,37,10,130,176,110,29,36,87,138,
+  142,21,30,34,75,247,80,185,108,146,187,237,204,238,204,239,247,235,48,153,174,140,238,131,119,122,127,248,188,239,123,15,
+  82,74,212,242,163,55,181,43,241,91,90,198,43,166,97,11,139,167,88,29,17,38,163,225,230,174,133,31,159,13,175,28,
+  101,139,226,22,16,62,157,60,220,223,115,109,224,158,103,49,0,111,130,120,138,13,25,190,186,241,139,201,97,99,207,206,
+  102,82,104,115,208,170,200,42,242,190,200,129,174,193,83,87,13,147,175,224,227,247,105,28,137,246,128,84,88,241,20,147,
+  85,213,132,159,36,165,92,135,76,83,137,67,125,141,29,7,59,217,215,95,31,80,176,242,208,84,134,88,83,31,136,20,
+  16,0,9,64,74,1,33,5,238,164,47,184,4,241,20,27,10,26,219,31,244,159,184,228,175,175,111,160,247,139,175,192,
+  165,3,166,232,16,146,99,102,254,25,136,8,4,130,132,171,126,123,180,215,29,225,216,109,246,168,169,113,255,249,238,227,
+  131,70,174,180,128,119,223,222,128,49,31,116,77,7,87,4,44,81,128,105,22,80,180,86,80,182,75,80,72,133,159,5,
+  209,186,59,177,166,1,231,54,44,251,15,76,231,55,74,50,15,112,1,135,155,168,8,19,92,114,72,46,193,29,9,199,
+  22,224,142,59,114,174,152,117,215,56,51,106,95,206,46,125,185,254,248,101,218,132,237,147,173,123,19,144,122,25,66,47,
+  129,5,0,127,64,133,30,80,193,12,5,204,175,64,213,168,90,199,245,34,146,130,169,182,150,88,184,189,45,166,207,21,
+  94,35,95,153,135,144,192,233,200,13,136,127,20,220,118,29,0,210,79,238,174,53,248,191,70,21,147,187,118,68,146,231,
+  206,12,4,138,108,17,115,203,211,232,12,13,227,254,196,136,197,43,240,111,186,198,141,135,196,116,125,188,183,251,172,17,
+  14,135,40,168,132,48,250,112,4,153,49,155,54,230,122,158,114,102,204,158,176,43,149,142,231,47,158,102,103,103,223,150,
+  203,229,138,87,90,181,6,94,182,58,82,195,182,80,50,191,156,11,120,17,212,124,229,90,239,252,23,109,243,52,116,236,
+  202,203,9,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Left2x[1200] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,4,103,73,68,65,84,88,133,237,150,109,104,213,
+  85,28,199,63,231,156,255,127,187,206,204,138,28,164,34,195,180,21,17,20,89,179,221,169,101,86,155,217,131,74,11,2,
+  83,18,77,123,145,216,230,94,198,32,164,94,168,65,65,208,19,204,55,69,77,202,48,240,69,74,150,232,69,3,137,5,
+  234,22,101,234,124,218,117,222,61,222,187,123,239,121,232,197,255,191,219,189,215,173,246,64,239,246,133,31,191,63,231,207,
+  249,253,190,231,247,116,14,76,97,10,147,196,226,70,85,95,221,224,185,137,238,151,147,240,45,162,59,188,157,11,238,186,
+  127,175,239,149,78,216,200,132,8,60,221,200,244,154,38,239,192,226,251,86,188,245,250,11,111,71,60,229,79,152,128,55,
+  222,13,85,77,204,77,226,31,90,179,116,211,252,69,247,46,243,149,84,19,118,14,227,140,64,117,163,247,216,116,239,214,
+  182,55,86,191,179,240,225,202,37,126,123,215,73,172,211,147,34,48,230,8,68,27,212,250,89,51,103,127,180,245,197,230,
+  50,229,43,58,186,78,146,49,105,28,32,192,252,127,4,154,145,209,164,183,187,114,206,67,91,54,212,237,136,244,101,226,
+  156,239,254,29,99,53,206,89,112,14,7,106,44,157,112,124,183,22,227,34,16,109,98,6,131,222,254,154,7,234,170,159,
+  139,110,136,92,234,105,39,145,186,138,117,6,107,13,198,105,164,144,52,191,246,9,214,89,28,6,235,108,40,6,23,106,
+  99,13,239,182,188,57,52,174,8,212,108,143,204,119,194,28,94,187,108,227,156,69,149,79,248,29,93,39,72,102,250,112,
+  184,156,97,235,12,177,191,190,197,88,141,177,26,29,106,99,179,104,155,205,233,229,247,188,58,234,33,71,36,80,211,232,
+  61,94,226,251,223,173,171,219,49,99,246,157,243,68,219,229,31,201,154,116,248,215,225,176,32,28,22,131,197,224,164,198,
+  162,113,46,208,195,228,172,51,56,44,206,141,158,157,155,8,68,27,252,45,119,204,44,223,179,174,118,251,52,233,67,219,
+  229,35,65,174,133,64,8,16,18,16,0,22,43,12,22,27,144,16,26,39,13,228,165,39,8,191,6,44,14,70,236,215,
+  2,2,209,38,255,171,138,242,202,231,215,175,108,140,92,234,59,75,103,247,89,4,2,33,4,82,6,90,0,66,16,156,
+  12,75,202,244,147,204,244,50,164,147,104,147,198,26,135,112,10,233,124,20,37,97,109,88,112,140,56,173,10,8,88,107,
+  171,133,7,131,153,4,125,67,215,209,38,3,4,206,149,16,1,25,28,131,153,30,250,51,113,250,179,215,201,216,84,208,
+  9,14,156,5,107,29,86,59,172,113,24,237,240,136,144,214,169,177,165,96,238,121,83,113,142,179,187,62,222,191,115,243,
+  179,75,95,42,83,210,231,204,181,24,165,37,62,210,3,67,26,45,210,32,13,82,9,132,20,120,82,224,16,224,28,214,
+  130,48,97,134,0,231,32,155,77,229,19,80,20,205,140,130,73,216,218,138,57,182,75,111,239,237,75,108,221,247,195,222,
+  164,111,202,220,163,21,117,164,237,32,3,217,110,50,12,34,148,69,121,18,229,137,64,124,129,231,139,127,214,148,64,122,
+  2,169,4,82,129,84,5,173,239,83,84,11,35,141,98,25,219,99,190,238,191,146,169,253,254,167,125,137,43,87,175,234,
+  39,23,174,231,182,178,89,161,209,192,129,242,36,202,23,40,95,162,124,137,244,67,199,57,231,65,234,130,218,41,136,120,
+  65,212,71,106,67,9,200,83,45,186,109,222,18,150,28,179,135,91,111,36,186,238,94,90,245,74,233,111,221,7,137,167,
+  255,68,229,57,89,89,209,0,142,176,6,130,52,4,218,97,117,88,19,198,21,216,14,197,142,70,32,135,11,71,137,247,
+  118,232,85,186,190,109,79,79,95,162,118,213,83,107,35,157,67,191,114,126,240,151,128,132,23,212,193,123,31,52,255,155,
+  153,124,140,105,20,187,144,157,3,108,239,53,134,78,124,104,182,101,55,118,110,254,98,160,165,97,205,170,250,200,237,229,
+  229,156,238,63,132,80,38,151,227,227,187,117,20,208,161,100,243,36,147,247,109,243,236,231,66,82,12,83,36,26,208,167,
+  62,215,159,118,158,238,217,244,229,55,45,3,131,113,231,170,202,235,153,230,223,18,12,166,0,73,96,8,72,23,57,213,
+  121,98,194,181,28,70,123,77,184,17,190,93,252,140,187,32,21,7,47,167,206,172,136,168,178,178,71,22,60,163,74,84,
+  41,71,99,71,184,24,179,239,23,157,184,152,68,54,36,87,208,134,163,213,128,11,13,216,60,209,128,119,238,103,221,62,
+  112,137,229,206,30,253,172,171,59,94,181,186,182,62,146,23,129,225,240,22,71,112,152,208,77,151,194,127,189,167,134,29,
+  155,112,179,1,116,50,65,234,98,204,182,150,46,184,49,189,227,143,246,7,147,67,3,222,197,152,221,89,116,242,116,158,
+  76,238,217,84,4,17,18,247,0,127,241,54,245,114,248,24,241,195,181,220,117,53,133,41,140,5,127,3,141,99,70,166,
+  140,152,25,26,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Right1x[676] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,2,54,73,68,65,84,56,141,
+  149,146,75,72,84,97,28,197,127,223,227,206,195,70,195,20,82,196,94,68,32,104,20,4,133,211,70,104,209,34,130,4,
+  91,70,129,66,184,201,114,140,54,66,43,55,141,144,139,40,114,19,20,189,164,69,98,62,112,17,45,102,208,41,164,20,
+  55,209,34,44,51,157,177,129,30,227,120,239,220,251,181,8,95,51,19,212,129,179,249,254,135,195,249,159,255,135,49,134,
+  124,134,187,116,172,177,83,183,21,155,229,83,82,4,198,163,113,119,245,129,190,112,151,53,16,142,88,161,98,154,53,20,
+  53,0,184,210,210,27,60,121,244,236,105,4,179,225,136,213,240,223,6,74,106,154,14,159,241,181,55,95,175,13,250,67,
+  19,225,136,213,86,76,39,26,35,250,43,134,157,91,30,21,217,155,237,131,129,169,207,99,84,149,237,195,39,183,241,120,
+  252,214,202,135,249,153,97,99,56,31,139,58,63,55,12,58,181,233,185,120,31,41,20,74,40,132,144,8,4,0,137,79,
+  67,120,184,148,249,119,176,171,188,158,248,244,184,51,54,57,176,128,49,167,98,81,103,6,64,3,184,94,142,216,199,103,
+  40,169,81,66,129,16,8,1,66,1,194,99,217,158,35,189,52,207,193,186,35,86,77,213,158,218,167,99,119,39,194,17,
+  171,35,22,117,250,53,64,206,91,37,157,89,192,118,179,216,110,22,165,52,165,37,101,148,4,66,248,45,63,70,184,216,
+  94,142,119,75,163,212,132,234,68,107,115,87,201,208,171,71,125,199,175,90,199,52,192,210,143,57,222,39,95,175,119,160,
+  125,130,148,35,209,89,137,214,10,191,47,136,79,6,80,248,41,205,149,163,76,144,172,157,49,235,43,108,41,80,130,212,
+  2,101,201,63,244,129,167,178,160,44,26,42,154,72,47,102,204,131,151,119,86,178,171,153,141,21,0,90,14,93,91,55,
+  80,150,64,105,201,200,92,47,218,39,169,14,237,167,110,251,9,38,223,196,237,196,219,248,87,227,178,169,68,193,226,237,
+  39,61,91,206,40,45,178,151,206,117,7,148,82,212,87,54,81,161,247,50,240,252,97,102,49,249,101,196,184,121,103,52,
+  198,20,124,142,112,196,50,151,91,187,249,229,37,73,166,82,230,197,232,224,138,237,216,29,177,27,78,127,190,182,160,131,
+  53,56,57,155,196,84,98,117,122,118,106,209,219,20,185,160,179,191,37,168,40,175,204,124,251,158,26,54,46,23,54,71,
+  254,167,4,66,18,95,78,167,238,197,162,133,145,243,241,27,65,222,9,180,110,118,229,182,0,0,0,0,73,69,78,68,
+  174,66,96,130,
+};
+const unsigned char Right2x[1219] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,4,122,73,68,65,84,88,133,237,150,127,104,85,
+  101,24,199,63,239,123,206,113,222,100,234,166,206,20,51,83,11,138,126,151,46,231,40,42,19,45,9,203,250,67,138,50,
+  35,40,12,66,55,35,9,194,160,162,200,254,145,68,35,44,132,229,15,164,133,24,101,172,105,179,54,220,114,42,230,175,
+  208,205,153,83,55,155,218,182,187,187,123,126,188,239,219,31,247,156,121,119,221,230,156,224,95,123,224,185,207,203,61,231,
+  121,190,223,243,125,158,243,190,7,6,109,208,6,104,5,69,182,153,81,108,61,119,189,117,228,245,36,79,30,123,231,198,
+  194,98,123,37,32,6,90,195,26,104,226,45,5,114,229,135,175,125,107,199,147,173,143,48,181,110,122,222,108,189,237,220,
+  111,248,215,90,231,186,20,144,82,48,191,112,241,208,5,143,189,49,39,150,112,246,229,191,203,132,27,74,192,83,46,71,
+  155,171,184,103,106,190,243,250,188,247,111,31,102,101,31,44,40,182,103,220,48,2,90,7,36,131,56,71,155,42,25,57,
+  98,184,124,251,133,143,114,70,13,31,91,94,176,204,90,212,223,26,61,14,79,65,145,109,16,116,246,153,105,136,125,250,
+  214,119,28,104,44,195,83,46,198,104,198,100,79,100,76,108,18,155,203,214,36,235,155,14,127,61,190,65,45,221,186,21,
+  53,32,2,31,44,94,139,101,57,72,36,66,8,4,2,162,24,102,74,97,243,231,169,31,241,181,139,214,10,131,38,59,
+  107,52,83,70,63,72,121,77,105,178,250,232,206,61,73,25,204,175,253,140,214,222,8,216,189,83,51,236,62,177,9,41,
+  172,46,23,66,164,145,185,44,133,214,26,109,12,218,40,90,58,78,211,158,188,192,163,15,205,29,58,42,103,108,225,207,
+  85,155,255,202,95,46,159,172,254,220,61,222,19,76,175,51,160,140,194,87,30,190,246,8,180,135,175,93,124,149,90,7,
+  120,40,60,116,24,149,240,80,194,69,145,186,222,238,94,160,230,212,118,38,78,184,205,126,105,206,146,9,195,156,172,218,
+  153,69,246,83,215,68,192,24,157,2,83,30,190,114,241,181,27,130,132,46,124,2,225,161,132,143,22,62,10,151,184,223,
+  194,197,100,35,231,59,78,114,174,173,142,221,199,55,225,89,113,241,234,188,119,178,115,70,228,109,155,185,220,89,218,239,
+  22,104,173,8,180,135,64,34,165,196,22,86,138,175,148,97,255,5,202,4,116,120,151,104,75,182,144,240,219,209,74,161,
+  149,73,115,104,254,187,129,59,242,166,243,242,220,37,177,109,21,37,31,83,124,124,86,229,170,224,153,171,18,240,181,75,
+  194,107,195,146,54,142,227,16,104,131,9,20,70,5,4,198,197,213,113,60,149,192,8,0,131,180,9,103,4,82,63,26,
+  99,12,70,67,160,61,60,237,162,77,32,128,41,253,82,32,225,181,211,212,86,143,144,96,57,18,203,22,88,182,64,218,
+  2,105,9,164,4,233,164,222,9,131,192,104,131,142,192,133,1,35,192,8,238,30,255,4,121,177,201,108,217,177,174,179,
+  181,253,226,234,202,85,193,138,171,17,232,54,23,210,18,72,43,140,182,192,10,163,148,2,17,222,105,12,24,29,41,96,
+  0,131,45,98,60,60,233,89,252,184,54,223,151,109,232,76,116,116,190,89,189,90,109,2,76,95,4,68,250,127,66,166,
+  246,123,41,195,167,142,192,187,84,16,33,1,131,209,225,147,3,195,156,92,166,221,252,60,245,39,235,130,138,154,178,182,
+  214,70,179,224,208,102,85,75,234,240,83,233,36,50,9,200,116,5,94,124,96,69,23,80,164,130,144,41,249,133,76,245,
+  187,236,204,151,248,129,139,86,169,154,99,98,19,185,55,247,105,42,247,238,246,14,30,169,173,59,245,71,176,240,76,13,
+  103,195,186,225,36,95,222,29,123,106,129,0,88,187,229,147,30,46,117,183,226,37,43,176,28,129,14,135,239,214,236,251,
+  152,20,203,103,251,47,165,201,134,211,13,59,143,108,84,203,218,91,136,167,215,37,99,247,205,36,96,0,93,245,69,48,
+  28,24,2,56,161,167,175,29,192,41,44,182,43,16,100,89,150,64,27,139,187,70,62,78,204,29,71,73,233,6,247,223,
+  127,46,174,169,253,70,173,3,252,176,102,186,119,59,27,50,9,232,208,21,16,132,108,35,239,34,216,85,68,8,134,102,
+  221,196,253,185,179,184,116,182,211,148,252,180,62,113,238,88,114,233,177,31,212,174,48,63,114,149,182,238,115,8,73,3,
+  190,66,153,180,66,22,128,45,134,48,45,103,33,251,247,239,11,118,253,254,107,75,227,62,253,202,201,114,117,34,3,220,
+  79,139,87,124,49,245,68,192,0,94,8,24,1,7,225,189,22,209,32,9,140,242,161,172,162,220,61,112,100,239,193,250,
+  29,254,162,166,195,252,151,65,52,138,46,244,124,44,247,231,99,210,190,2,28,100,65,145,125,33,47,119,156,223,116,254,
+  108,201,161,245,234,189,120,156,128,203,45,140,72,251,189,1,247,165,64,166,69,82,70,179,208,245,170,54,55,55,45,223,
+  179,90,125,69,247,1,139,84,27,180,65,235,151,253,15,204,19,30,41,201,138,88,137,0,0,0,0,73,69,78,68,174,
+  66,96,130,
+};
+const unsigned char Up1x[652] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,2,30,73,68,65,84,56,141,
+  149,147,79,104,19,65,20,198,191,55,187,51,217,141,133,122,104,76,255,209,130,4,237,193,64,42,168,208,213,138,104,68,
+  98,69,45,20,114,107,74,201,73,144,98,22,193,171,199,82,145,160,23,15,69,79,30,165,66,241,226,77,42,94,68,80,
+  208,67,41,180,42,149,148,52,137,166,154,38,217,217,25,15,81,172,33,169,246,29,223,251,230,199,124,223,155,33,173,53,
+  218,213,201,155,124,30,0,150,102,189,233,118,26,214,110,224,184,60,221,223,21,73,246,117,29,76,58,46,79,239,9,224,
+  184,60,26,16,251,178,87,206,76,6,199,70,147,193,128,8,102,29,151,71,255,11,224,184,188,3,132,197,137,115,211,214,
+  150,151,199,150,183,137,248,200,37,11,132,69,199,229,29,255,4,16,225,209,232,112,162,167,55,52,72,159,75,31,240,177,
+  244,30,157,157,157,20,27,58,209,13,194,195,93,1,142,203,211,253,7,34,137,179,71,199,249,74,254,13,12,198,97,50,
+  142,87,107,11,136,13,29,23,161,253,61,137,230,60,216,142,195,81,193,237,108,42,225,218,235,229,101,104,242,32,132,137,
+  58,125,199,54,21,241,46,255,28,23,78,95,13,154,166,248,43,15,182,211,247,212,88,198,82,228,161,34,75,16,1,1,
+  30,224,40,203,117,8,219,64,65,174,162,168,86,113,254,212,69,139,216,159,60,216,111,223,241,99,227,221,135,250,98,148,
+  175,172,193,228,6,56,55,80,81,5,84,141,175,16,54,131,176,25,150,191,189,64,184,55,68,71,14,15,135,137,53,242,
+  160,145,140,153,30,232,142,100,111,76,220,177,5,15,64,65,194,135,135,215,185,5,188,45,60,131,100,21,16,35,36,6,
+  50,208,90,67,41,160,94,175,225,241,211,249,74,177,180,57,99,18,67,234,83,110,197,158,185,119,185,225,137,163,122,247,
+  250,19,171,44,115,240,141,109,112,193,192,76,130,193,9,115,15,110,87,101,77,91,191,236,7,137,33,101,46,205,122,78,
+  211,38,180,214,10,165,250,23,48,131,96,112,6,30,104,64,100,77,91,47,231,60,218,245,29,0,128,210,62,126,212,139,
+  141,43,251,26,178,174,160,85,235,63,99,182,106,250,74,162,90,219,134,50,53,160,21,124,73,240,189,61,0,164,47,17,
+  31,188,6,98,0,49,2,17,246,0,32,108,220,186,63,25,110,37,38,194,70,115,239,39,48,247,197,219,182,208,154,34,
+  0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Up2x[1193] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,4,96,73,68,65,84,88,133,237,150,91,108,21,
+  85,20,134,191,53,123,79,79,123,106,67,209,88,229,22,16,68,169,36,74,90,77,161,165,4,49,84,226,37,165,68,76,
+  68,209,68,162,49,193,75,144,2,79,18,12,198,24,19,140,36,198,7,194,19,193,224,131,81,12,225,1,19,12,81,210,
+  234,131,196,11,105,20,17,164,180,180,182,5,122,161,237,233,57,51,123,249,48,231,148,114,122,7,53,62,176,146,149,61,
+  151,61,235,255,214,218,107,207,12,220,180,235,180,133,59,200,41,223,98,171,110,52,142,119,189,15,22,246,153,61,190,228,
+  28,41,175,245,95,255,207,1,42,54,251,175,204,188,125,254,218,87,159,126,155,91,242,10,222,45,175,181,43,254,51,128,
+  138,45,182,114,74,193,173,187,170,151,61,27,239,13,46,178,250,225,231,242,173,245,63,95,178,41,118,247,191,14,176,236,
+  77,102,249,38,231,208,83,143,108,136,95,184,114,138,227,103,62,35,48,9,170,150,172,46,240,108,240,85,233,54,166,76,
+  22,192,76,116,98,233,14,226,38,180,117,107,150,191,56,45,22,183,210,208,242,45,78,67,90,187,255,96,193,244,135,196,
+  154,88,126,91,123,83,249,226,233,110,127,67,3,58,209,184,19,173,128,228,246,218,3,203,23,61,49,103,214,157,115,188,
+  134,214,227,128,32,34,56,13,249,254,220,33,22,45,88,156,115,215,180,249,101,205,115,236,174,137,138,195,4,43,80,81,
+  107,223,42,158,93,242,194,202,178,53,185,39,154,142,48,144,234,195,105,152,246,128,100,208,79,71,111,35,75,239,123,210,
+  63,219,116,234,254,59,74,18,77,141,245,250,211,63,2,80,94,107,30,47,154,58,99,247,51,85,27,227,191,182,213,211,
+  157,104,31,20,15,53,24,60,238,29,232,164,63,213,67,217,130,149,254,111,231,78,86,205,92,204,209,198,58,215,60,94,
+  252,49,151,160,98,107,236,222,88,44,254,233,250,85,155,226,45,61,167,233,236,255,107,204,96,127,94,250,133,214,222,211,
+  60,186,180,38,95,61,14,151,109,101,230,117,3,148,110,99,138,186,224,232,243,171,222,200,15,164,143,11,93,191,95,115,
+  95,7,251,236,106,191,169,58,126,110,254,26,155,11,149,37,43,11,125,181,71,74,119,16,159,52,192,218,181,152,152,179,
+  95,86,87,174,47,42,154,58,93,78,183,159,64,85,35,81,81,196,3,99,4,207,130,103,5,49,74,64,2,149,16,69,
+  169,63,123,144,217,51,230,154,226,185,15,204,203,237,181,7,0,25,13,96,196,30,40,124,204,126,248,96,241,178,234,21,
+  37,53,177,147,173,223,144,12,163,224,78,2,144,16,53,33,206,115,168,164,72,184,110,18,97,15,120,14,207,19,196,3,
+  167,1,45,93,103,169,92,88,109,91,219,155,103,221,182,232,138,223,88,231,142,141,164,53,140,108,105,173,89,55,163,104,
+  222,222,141,53,59,243,16,33,21,246,227,8,49,158,225,216,153,125,4,12,16,184,36,61,169,14,186,19,109,56,13,81,
+  64,29,168,42,53,197,219,80,141,142,213,129,11,149,253,135,63,238,239,25,232,92,87,255,126,120,48,91,207,102,95,112,
+  42,159,180,116,156,103,251,222,13,17,161,224,84,241,182,191,244,17,98,20,65,233,74,94,160,55,184,140,248,96,240,96,
+  80,80,240,140,176,123,223,59,136,146,194,35,36,130,203,19,228,139,145,18,30,6,80,183,43,16,8,6,207,75,95,198,
+  143,21,216,36,158,130,113,92,236,63,71,66,59,177,57,2,146,142,151,22,119,78,17,3,162,132,97,104,239,177,126,162,
+  11,64,12,132,3,36,70,90,130,97,0,217,246,195,30,82,229,155,1,148,75,3,231,73,104,23,198,23,36,189,222,81,
+  134,130,58,69,156,224,121,2,30,97,202,38,46,127,247,30,93,227,197,31,23,32,99,41,77,208,19,182,97,108,84,102,
+  207,128,164,43,160,170,184,80,144,80,17,111,212,134,191,49,128,190,160,19,207,128,103,36,130,176,130,151,174,128,115,130,
+  72,244,62,144,201,233,79,28,32,233,250,240,109,12,188,212,85,8,19,169,73,168,81,35,58,29,99,199,223,32,128,162,
+  8,130,10,145,136,48,8,224,50,194,50,105,253,9,1,216,52,65,122,127,71,153,106,40,132,184,232,86,152,190,166,87,
+  95,204,29,63,18,7,6,136,182,84,48,82,224,177,0,12,224,15,113,172,228,80,53,251,53,60,143,104,7,200,181,77,
+  152,1,115,14,80,228,74,51,133,128,3,82,89,30,142,7,96,128,156,44,231,131,189,59,71,45,209,8,230,39,218,177,
+  64,94,90,195,16,125,119,132,168,42,46,51,113,164,37,19,32,150,206,60,3,224,15,25,51,62,52,176,75,103,22,100,
+  101,155,28,50,38,211,226,201,108,177,209,204,203,130,176,67,68,51,194,67,191,166,110,8,200,80,152,140,104,0,195,255,
+  21,39,211,180,153,18,102,143,164,3,103,60,3,146,57,191,105,255,111,251,27,250,226,227,129,148,124,126,213,0,0,0,
+  0,73,69,78,68,174,66,96,130,
+};
+}
+namespace Media {
+const unsigned char Back1x[770] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,12,6,17,45,2,189,124,103,101,0,0,2,143,73,
+  68,65,84,56,203,165,83,75,72,84,81,24,254,206,189,215,251,56,231,58,51,62,152,115,238,216,66,169,241,65,153,20,
+  101,66,104,17,33,210,178,168,36,104,17,73,45,42,90,181,13,83,194,32,13,119,17,101,49,52,139,138,158,154,101,229,
+  34,136,44,180,32,113,81,173,194,69,138,66,216,99,102,238,189,94,157,211,194,81,52,90,8,254,240,111,190,255,255,126,
+  190,255,5,172,209,200,42,114,20,0,38,0,9,192,253,7,183,53,0,206,127,72,147,185,4,150,115,146,35,187,0,12,
+  0,145,92,28,26,179,25,154,154,26,39,22,153,3,207,95,196,8,33,150,162,40,249,144,80,67,225,112,69,60,190,97,
+  255,200,200,135,11,65,16,148,100,179,217,226,104,52,26,41,47,143,31,24,30,30,238,208,120,84,0,0,238,222,185,135,
+  195,205,135,32,184,3,69,85,34,233,116,58,182,62,94,118,212,102,246,9,0,129,174,235,215,77,211,204,171,170,170,56,
+  98,231,219,167,8,33,243,130,59,29,138,227,136,21,218,253,89,63,42,132,104,222,182,125,107,255,142,218,218,99,125,189,
+  253,150,150,167,233,149,149,241,157,117,117,181,189,155,106,170,79,62,126,244,196,84,85,85,229,142,128,198,163,28,148,90,
+  0,0,74,41,118,237,105,232,41,42,40,44,107,109,109,43,8,133,66,68,102,37,108,102,27,156,243,203,29,23,47,177,
+  130,194,66,34,179,18,148,82,104,170,14,77,56,2,127,82,191,150,20,116,95,233,174,9,135,34,154,55,235,34,157,74,
+  129,82,134,150,227,45,164,190,190,193,246,102,189,37,140,217,12,69,5,22,52,193,57,130,57,31,0,96,154,38,166,166,
+  167,164,174,235,200,184,41,120,190,15,198,24,92,207,133,231,187,200,184,25,120,158,11,198,24,24,165,40,46,226,80,162,
+  130,195,48,116,0,128,97,232,120,248,224,254,183,151,131,3,191,45,147,33,38,214,65,81,84,188,29,122,35,147,201,132,
+  171,231,25,75,152,197,44,112,206,161,56,92,44,155,129,133,205,213,91,118,127,249,252,245,106,34,209,243,243,211,232,71,
+  55,152,11,64,41,243,77,202,206,222,74,220,152,233,127,214,231,7,115,1,24,165,16,66,64,227,130,195,52,141,92,11,
+  6,4,231,136,149,236,235,118,51,153,107,239,222,15,181,143,141,141,30,228,130,207,111,172,172,126,154,158,75,189,154,153,
+  254,113,250,118,242,230,153,108,86,18,193,57,52,46,22,214,216,214,126,30,0,192,29,1,85,81,167,33,101,184,180,180,
+  244,220,248,196,120,215,235,193,193,206,198,189,194,39,144,105,25,91,223,57,49,57,158,156,248,62,217,197,29,1,34,165,
+  92,113,202,158,231,193,178,172,73,0,240,124,95,39,144,139,103,235,27,134,57,227,186,158,10,192,6,36,93,237,51,65,
+  74,105,0,0,33,196,95,134,145,133,66,107,180,191,249,146,220,194,180,154,76,242,0,0,0,0,73,69,78,68,174,66,
+  96,130,
+};
+const unsigned char Back2x[1236] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,4,139,73,68,65,84,88,133,237,147,91,108,84,
+  69,24,199,255,115,230,156,51,179,103,206,238,158,179,221,75,33,165,72,76,20,181,246,134,38,85,136,36,148,136,111,218,
+  34,250,64,196,26,137,104,162,149,98,98,213,144,118,27,18,72,139,65,16,125,69,46,149,0,133,22,120,192,130,152,240,
+  82,181,101,85,98,3,198,186,150,182,208,64,108,83,40,93,186,187,236,229,248,176,219,237,133,178,136,15,190,216,127,114,
+  114,146,153,95,102,126,243,205,55,192,92,230,50,151,255,123,72,250,239,74,127,100,202,156,5,96,36,253,101,139,12,192,
+  13,128,3,24,5,112,227,65,120,121,66,224,249,85,229,127,204,36,191,239,232,44,8,133,66,247,18,32,0,12,93,215,
+  231,47,89,82,92,205,56,123,235,204,233,239,30,206,34,48,43,47,79,153,196,233,246,179,25,122,213,11,229,99,156,115,
+  22,10,133,102,91,204,6,192,83,90,90,84,62,111,126,238,182,138,138,213,198,145,35,135,1,128,222,99,243,41,252,252,
+  173,149,149,149,230,225,195,135,0,128,202,51,201,225,145,33,184,93,158,123,172,3,10,192,189,104,209,130,71,30,93,188,
+  216,255,120,193,19,101,117,155,253,154,211,225,68,219,241,214,24,128,228,253,248,250,205,126,205,225,112,162,181,237,88,12,
+  64,242,46,129,44,113,50,198,124,101,101,79,191,233,246,184,223,253,232,227,79,88,73,81,41,141,68,195,72,38,103,238,
+  251,207,249,187,4,200,204,1,128,1,240,150,148,20,46,155,151,55,175,241,165,23,43,60,175,191,246,6,79,90,9,220,
+  10,141,2,176,96,227,218,191,230,39,4,172,137,1,42,79,58,17,66,172,188,188,188,162,130,194,199,234,30,90,184,176,
+  188,190,126,11,119,187,221,136,70,35,72,36,226,144,36,9,100,186,50,153,202,251,235,183,240,156,236,124,74,192,225,112,
+  128,210,84,255,208,116,91,80,74,165,226,226,39,215,218,29,246,119,54,214,108,98,75,159,89,70,99,241,24,194,145,48,
+  0,11,132,72,211,220,169,76,201,138,21,207,173,53,93,230,135,239,111,220,196,158,45,91,74,195,145,113,220,184,57,2,
+  11,73,192,34,176,44,11,32,128,46,236,96,170,10,206,185,37,3,128,211,233,180,132,46,0,0,119,98,119,0,0,186,
+  174,11,66,200,7,187,62,255,18,185,222,92,12,223,24,66,44,22,3,149,36,16,34,129,16,2,66,38,47,141,171,76,
+  182,121,185,127,215,174,47,224,243,230,98,120,228,47,196,226,241,73,94,154,206,107,66,35,140,49,72,0,192,24,131,46,
+  82,2,170,162,166,0,77,187,45,43,242,167,13,254,186,241,243,231,59,19,46,167,11,118,221,1,74,101,40,138,2,85,
+  85,161,170,28,140,113,16,66,96,24,70,156,72,196,223,208,80,63,126,62,208,153,112,25,57,89,121,161,9,203,48,12,
+  75,2,0,211,52,45,145,22,224,140,3,0,132,16,201,107,131,67,205,3,253,125,203,247,31,216,215,222,184,125,107,36,
+  26,137,194,112,152,80,20,21,50,149,161,202,74,70,88,232,194,186,216,253,251,129,254,190,171,203,15,52,239,107,111,218,
+  190,237,126,60,56,231,169,10,216,108,182,140,192,68,132,46,96,24,6,44,75,238,254,41,112,97,67,239,229,203,85,59,
+  62,107,26,56,115,182,61,194,20,6,85,97,0,33,144,82,117,133,16,2,66,136,100,79,79,79,119,160,235,194,134,63,
+  131,189,85,59,119,110,31,248,246,236,233,217,121,93,192,52,205,84,15,112,206,33,244,212,211,136,70,35,80,100,5,118,
+  93,7,231,146,213,214,246,77,20,192,160,199,227,57,53,56,112,61,64,41,89,127,241,82,119,245,203,149,175,178,252,252,
+  133,52,30,143,129,2,16,66,135,166,105,86,48,24,140,6,131,193,65,73,146,78,245,246,246,7,136,36,173,191,244,91,
+  119,245,234,138,87,216,130,169,188,38,160,105,90,234,10,52,77,203,84,32,18,13,103,78,196,152,61,243,60,79,158,60,
+  57,166,235,122,95,160,235,215,29,125,3,87,87,182,29,111,57,119,244,216,161,241,100,34,153,190,83,14,206,121,166,130,
+  29,29,29,99,57,57,57,125,129,174,11,59,174,244,95,89,217,122,226,232,185,99,173,71,50,188,166,217,38,159,161,97,
+  24,153,38,116,187,188,233,18,217,96,154,230,180,107,105,105,105,73,0,24,170,242,85,141,117,253,248,203,186,146,146,88,
+  249,254,175,247,52,21,23,150,154,140,51,230,112,56,200,108,188,207,87,53,118,253,135,159,215,197,158,138,151,55,31,252,
+  170,169,168,176,196,228,140,49,175,215,75,100,0,80,85,53,41,116,129,230,131,123,38,123,64,232,118,89,150,35,152,37,
+  123,247,238,141,0,184,230,241,188,119,226,230,205,219,157,76,101,53,66,136,183,109,54,91,34,27,79,41,61,225,243,249,
+  58,101,69,169,17,122,138,39,0,80,91,91,235,4,224,140,199,227,153,19,200,178,108,1,24,109,108,108,28,157,109,209,
+  137,172,89,179,134,230,231,231,155,225,112,216,70,41,29,221,189,123,247,173,7,225,179,177,115,153,203,92,254,147,252,13,
+  221,87,160,118,124,238,51,204,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Eject1x[628] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,2,6,73,68,65,84,56,141,
+  149,83,77,104,19,97,16,125,179,155,152,118,105,44,65,232,154,221,110,18,130,43,98,2,66,65,5,181,90,35,136,138,
+  20,255,218,24,155,24,5,65,17,4,79,94,148,30,60,121,82,207,158,12,90,170,130,224,201,131,182,122,240,162,222,60,
+  24,17,84,234,15,173,105,77,211,109,218,36,187,109,50,30,154,72,210,36,37,14,124,48,135,247,30,111,102,222,71,204,
+  140,102,69,68,118,0,196,204,86,51,140,109,13,242,122,77,211,54,51,179,64,68,159,153,217,104,89,128,136,236,46,151,
+  75,219,179,119,215,83,129,32,189,126,245,230,32,17,37,153,217,172,3,51,115,205,3,64,0,60,39,78,29,127,50,54,
+  246,98,233,221,251,183,203,131,225,147,227,0,124,229,113,106,240,141,28,108,216,183,191,247,72,32,24,232,239,235,11,217,
+  64,192,246,29,59,119,103,178,115,209,151,207,199,239,1,152,110,234,0,128,164,235,122,111,44,30,205,230,242,57,206,46,
+  204,243,124,214,96,211,50,249,252,133,120,174,167,103,219,97,81,20,59,106,56,149,70,81,20,209,239,247,111,58,61,20,
+  254,144,252,148,44,230,11,121,78,205,76,241,239,233,73,94,88,204,242,196,247,137,210,153,88,248,71,48,24,220,234,245,
+  122,109,117,35,248,124,190,141,221,30,229,202,129,80,104,139,174,235,66,102,46,13,34,2,17,33,151,95,132,170,40,20,
+  30,136,200,204,143,110,78,254,156,186,10,224,23,42,75,137,68,34,157,197,98,241,144,236,238,186,127,231,246,221,54,81,
+  16,27,158,150,153,113,99,248,122,225,219,151,175,215,28,142,246,135,137,68,34,99,3,0,85,85,59,102,254,164,6,102,
+  211,233,117,151,46,95,180,168,106,55,88,213,155,166,101,111,107,119,196,84,165,251,25,128,21,1,143,199,179,228,118,187,
+  135,13,195,184,69,68,171,51,81,215,75,146,84,112,58,157,22,80,14,146,166,105,210,232,227,145,143,13,125,55,169,254,
+  163,199,2,0,82,21,7,34,0,140,60,24,109,137,124,246,92,180,168,40,138,88,237,160,36,8,194,114,44,62,68,107,
+  83,255,21,203,178,92,2,202,87,0,208,9,160,11,43,49,110,73,0,64,26,192,44,85,125,103,250,79,1,6,128,191,
+  20,183,247,30,217,9,206,54,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Eject2x[987] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,3,146,73,68,65,84,88,133,237,86,75,108,27,
+  85,20,61,111,230,217,147,52,99,39,184,137,212,218,49,86,105,27,234,32,36,100,49,178,27,106,154,212,160,162,40,49,
+  205,50,45,133,72,40,106,23,8,88,80,132,196,38,11,4,165,236,64,93,176,11,203,10,177,39,146,17,97,7,109,176,
+  10,200,162,18,74,132,66,154,84,81,60,99,79,198,191,249,248,178,112,32,160,122,18,59,45,108,154,163,121,243,209,155,
+  123,239,153,123,207,125,111,128,125,60,234,96,15,96,235,1,112,120,235,126,13,128,181,23,39,226,30,131,51,0,161,248,
+  144,242,82,127,127,48,122,119,101,117,21,128,254,127,18,232,61,113,226,216,211,145,112,228,134,220,37,143,50,70,95,111,
+  108,168,69,0,229,61,250,107,11,157,178,44,15,142,141,143,46,221,93,93,169,255,177,178,92,31,27,31,93,146,101,121,
+  16,64,103,187,206,218,205,128,0,160,127,100,228,249,153,201,201,201,196,208,201,231,184,44,251,152,229,88,93,122,81,235,
+  93,92,92,186,137,70,41,168,93,34,173,226,144,162,196,166,47,93,122,189,98,219,54,21,138,42,105,69,149,44,203,162,
+  203,151,167,43,138,18,155,6,112,232,191,10,238,143,68,34,67,233,244,216,102,161,160,81,169,108,208,134,186,78,27,234,
+  58,109,26,58,229,213,60,165,211,99,155,145,72,100,8,128,255,97,7,247,72,146,52,112,110,98,252,246,173,133,155,182,
+  105,153,164,22,242,164,21,183,71,173,86,165,31,110,125,239,76,76,140,223,246,249,124,3,104,180,233,174,104,73,3,193,
+  96,48,148,76,158,122,59,245,194,153,179,47,167,39,188,149,106,25,140,9,96,76,0,0,80,189,14,211,50,113,36,114,
+  132,229,53,181,135,234,117,209,182,157,159,53,77,219,181,53,119,93,136,82,169,212,193,3,7,164,212,225,80,240,139,207,
+  62,189,222,97,148,12,212,204,42,24,195,223,82,163,173,179,215,219,1,127,151,31,111,190,245,70,237,222,218,218,171,149,
+  138,153,153,155,155,83,247,76,96,106,106,170,195,52,75,79,121,164,142,185,143,63,186,118,208,223,237,135,81,50,192,4,
+  6,6,6,198,182,205,137,8,4,66,87,103,23,12,195,192,149,43,239,228,65,206,89,198,188,185,217,217,217,170,91,12,
+  215,18,204,204,204,8,61,61,61,33,211,177,174,95,56,127,97,32,26,29,20,74,149,18,68,81,4,231,28,156,123,26,
+  87,145,67,20,57,68,81,132,40,8,176,109,27,221,254,30,244,245,245,122,127,189,115,231,201,112,255,227,223,12,15,15,
+  235,243,243,243,77,91,147,187,17,8,133,66,125,191,228,126,186,120,252,232,177,196,200,112,138,3,192,99,221,129,157,18,
+  246,47,36,79,157,230,11,63,46,156,92,94,94,190,24,123,230,217,207,1,172,55,123,207,181,4,153,76,230,137,47,191,
+  186,177,232,241,120,224,56,14,234,245,122,139,161,239,255,208,87,206,191,118,52,153,76,46,181,69,32,151,203,5,0,4,
+  216,63,11,13,64,146,164,22,137,108,209,33,34,73,146,212,112,56,220,84,140,59,137,48,176,53,30,100,203,6,26,41,
+  81,183,198,125,112,213,64,44,22,11,156,121,241,244,111,173,120,111,254,176,141,111,51,223,29,207,102,179,237,17,80,20,
+  133,137,156,227,234,7,215,118,227,176,35,222,123,255,93,40,138,194,178,217,108,211,121,193,205,48,145,72,128,115,14,162,
+  58,242,218,6,10,186,6,221,208,81,42,27,168,214,42,48,45,19,142,227,128,136,224,56,14,76,203,68,181,86,65,169,
+  108,64,55,116,20,116,13,68,4,206,57,18,137,132,43,65,215,12,196,227,113,252,190,178,4,219,113,208,237,235,6,88,
+  99,241,105,28,13,89,252,37,79,65,96,96,140,3,34,7,121,8,32,128,64,112,28,27,156,115,196,227,241,246,9,68,
+  163,81,18,69,17,87,63,249,208,213,184,21,136,92,68,52,26,117,253,63,112,85,56,17,61,212,46,96,140,237,184,39,
+  236,99,31,143,46,254,4,140,41,100,197,10,235,11,217,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Flash1x[607] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,1,220,73,68,65,84,56,141,133,147,59,107,148,65,24,133,159,249,110,
+  43,209,40,134,40,152,8,171,177,49,177,241,2,134,32,66,44,20,4,11,11,27,11,123,241,31,216,139,32,22,234,191,
+  208,50,8,130,133,63,32,44,22,65,188,173,96,52,70,99,130,65,55,155,221,253,246,75,230,61,22,123,55,31,241,133,
+  153,102,230,60,51,115,206,59,78,18,103,166,103,230,128,171,128,241,255,10,128,183,102,54,187,80,154,175,68,0,146,174,
+  92,186,56,19,7,1,4,8,156,90,91,165,1,165,112,136,128,242,167,197,169,229,149,213,57,96,54,234,95,62,57,242,
+  156,201,177,175,56,6,133,173,213,214,92,254,121,28,239,175,37,75,223,87,46,0,116,1,50,99,114,236,51,51,215,31,
+  18,186,117,0,178,44,35,77,155,164,105,147,102,179,137,56,132,74,143,121,179,234,187,224,46,192,100,56,28,97,60,74,
+  90,253,64,218,104,80,175,87,169,109,254,96,227,207,55,178,172,198,248,177,91,4,65,56,240,180,222,13,4,56,71,181,
+  178,200,175,229,87,212,106,117,26,141,12,23,12,179,119,120,156,131,133,136,125,251,71,219,15,177,28,128,9,73,84,42,
+  155,100,156,35,26,218,102,228,0,36,145,17,199,34,137,33,9,214,144,60,222,231,1,36,22,190,28,5,61,2,183,51,
+  187,78,189,91,58,130,247,189,13,81,199,99,147,241,162,116,138,151,175,167,112,78,168,63,9,117,124,2,111,142,98,49,
+  199,3,83,11,98,190,35,112,109,173,6,32,32,212,215,110,189,62,48,33,19,166,157,39,247,131,28,96,214,139,49,232,
+  233,141,213,245,13,146,56,160,16,135,173,145,244,198,158,36,162,144,132,172,253,222,196,219,191,38,10,228,141,208,109,115,
+  251,242,225,60,239,186,117,239,89,21,41,39,5,51,99,203,66,206,222,184,191,43,192,63,189,137,229,196,168,45,111,156,
+  152,152,224,99,249,125,238,95,104,93,212,81,44,22,241,38,104,255,92,39,137,211,231,167,31,32,238,8,134,216,181,11,
+  218,28,104,2,119,23,74,243,79,254,2,78,177,239,207,22,156,213,133,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Flash2x[1323] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,4,168,73,68,65,84,88,133,197,150,77,108,21,85,20,199,127,247,222,
+  153,247,201,123,197,210,22,44,5,186,16,240,43,24,146,66,26,22,38,174,92,73,34,137,33,196,149,137,137,11,23,38,
+  126,236,140,46,88,147,176,213,184,195,40,81,100,225,206,133,46,36,49,85,131,16,65,162,17,19,104,3,130,34,175,237,
+  123,175,51,115,231,222,123,92,244,195,215,210,215,190,106,19,207,102,50,51,103,206,249,205,255,156,115,239,85,34,194,255,
+  105,81,231,205,193,241,35,111,34,242,22,136,217,180,12,74,181,64,157,190,52,241,205,233,85,95,119,42,240,212,225,241,
+  228,233,35,135,74,70,111,94,126,107,45,151,175,92,107,207,37,233,169,203,223,77,188,187,242,253,50,5,16,41,21,11,
+  49,55,110,220,160,49,211,98,186,217,130,224,209,106,227,101,10,162,208,58,226,225,29,67,28,60,240,68,245,242,149,159,
+  222,56,56,62,126,235,210,196,196,251,221,1,22,236,222,253,25,138,250,79,94,63,54,197,158,161,22,26,221,115,98,89,
+  186,122,174,223,174,242,241,87,163,76,221,130,39,31,219,87,253,246,135,31,79,2,107,3,132,32,204,52,231,120,245,232,
+  109,158,125,238,4,219,134,31,65,153,218,130,171,131,208,2,20,232,58,34,224,92,130,119,51,120,15,66,157,16,60,185,
+  109,227,242,38,59,103,238,99,237,167,124,240,69,141,221,187,118,130,208,191,50,223,3,0,62,120,66,8,236,27,105,208,
+  63,188,23,229,46,66,24,0,21,131,228,32,13,130,7,47,125,56,39,228,121,147,60,251,131,60,7,244,32,185,243,216,
+  172,65,154,220,163,82,63,194,163,123,218,56,31,254,145,102,61,128,197,166,212,128,90,252,74,44,72,134,136,35,207,45,
+  46,15,4,202,228,46,224,108,70,154,164,120,15,232,12,231,29,54,77,201,210,148,74,45,199,40,181,44,110,15,0,43,
+  30,168,26,34,109,156,47,224,125,129,220,106,178,244,47,172,157,66,164,134,15,101,178,52,193,121,133,54,22,231,29,34,
+  158,56,134,200,116,198,13,189,1,172,148,202,235,199,113,249,44,206,205,146,219,89,130,12,162,138,251,137,99,33,75,238,
+  144,165,147,36,73,66,187,245,59,165,82,131,56,142,65,218,196,145,33,138,101,41,96,207,10,116,74,96,109,70,214,254,
+  26,239,20,46,20,113,121,74,210,154,196,218,140,64,25,161,130,137,119,80,235,127,134,173,67,49,138,20,173,193,104,141,
+  54,6,37,9,168,197,176,61,151,160,19,32,39,77,18,2,3,248,160,113,121,142,117,37,92,136,81,102,144,224,155,228,
+  173,139,164,51,95,82,44,247,19,197,49,70,57,162,40,16,23,182,81,170,141,173,26,119,109,128,142,73,182,214,146,38,
+  41,162,51,124,48,228,54,35,77,51,144,64,169,16,40,20,234,168,242,110,240,37,34,99,40,84,70,48,58,160,104,162,
+  105,16,27,89,82,180,119,128,48,239,24,68,145,219,156,185,36,67,153,20,31,12,193,91,180,242,68,49,20,98,193,24,
+  153,159,20,45,152,8,10,49,24,173,80,128,18,64,197,248,133,230,235,189,7,16,180,82,252,60,213,199,112,227,46,133,
+  202,97,76,92,195,152,24,200,193,55,80,6,10,133,126,180,81,104,50,68,166,49,218,16,197,3,104,13,18,230,16,159,
+  208,108,204,242,203,100,13,109,212,210,143,245,0,0,149,114,145,207,46,140,80,41,158,103,116,187,69,22,102,121,153,169,
+  165,254,90,221,36,112,243,78,137,115,23,70,169,150,138,29,165,93,7,32,72,160,94,45,211,156,131,83,231,42,196,177,
+  67,175,153,105,117,243,65,225,188,161,90,46,82,223,82,36,244,186,14,136,128,210,80,223,82,166,190,165,220,117,9,93,
+  245,143,186,248,42,69,239,37,144,16,30,108,152,255,10,33,27,106,194,133,15,86,70,90,227,72,176,158,175,136,244,14,
+  16,58,20,216,136,204,107,65,132,213,84,237,6,32,225,65,218,127,173,198,226,102,42,178,129,30,64,152,109,37,20,98,
+  133,54,255,253,108,24,124,192,5,24,216,72,9,18,235,56,190,251,251,158,18,104,109,64,65,240,190,171,207,217,155,99,
+  27,25,195,133,3,137,137,120,225,196,203,168,213,22,33,224,243,243,103,152,107,183,56,118,252,37,180,49,124,242,225,123,
+  107,130,134,158,75,176,0,112,244,228,53,162,106,181,107,192,231,199,222,94,118,255,226,161,119,186,250,158,57,122,140,110,
+  141,179,4,160,148,82,7,198,14,47,1,56,231,200,243,188,107,208,141,218,98,92,165,148,150,142,227,81,180,152,28,40,
+  116,58,58,231,112,206,109,86,250,206,201,218,170,148,106,1,185,136,200,162,2,6,120,8,72,218,115,105,121,215,200,78,
+  174,94,187,74,177,88,92,103,228,122,201,237,217,49,180,157,52,181,72,8,45,96,63,240,43,208,0,188,98,126,83,43,
+  0,195,163,123,247,190,86,235,219,250,138,18,34,214,217,236,54,100,10,1,37,211,141,251,103,39,127,187,254,17,112,21,
+  184,11,56,37,34,40,165,12,208,7,236,2,6,171,245,250,246,77,5,0,242,52,109,91,107,167,129,123,192,20,48,43,
+  34,65,117,52,71,4,148,129,34,243,37,217,108,19,192,3,25,144,136,136,7,248,27,34,54,151,220,107,72,206,19,0,
+  0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Floppy1x[561] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,1,195,73,68,65,84,56,141,
+  149,147,191,139,19,65,20,199,63,51,187,185,132,228,20,148,52,70,136,44,28,92,35,40,34,28,136,86,138,165,133,181,
+  216,28,162,127,131,98,103,165,157,40,254,3,162,133,216,88,164,201,157,88,168,136,88,92,171,22,129,92,97,227,110,147,
+  236,50,155,157,247,198,34,119,249,33,39,196,47,51,195,131,225,251,229,243,30,60,179,117,239,245,91,17,185,201,84,129,
+  185,22,235,35,255,172,181,175,98,17,185,241,112,251,42,91,31,158,130,170,9,170,160,74,8,106,56,172,85,65,101,94,
+  135,192,206,245,7,60,123,243,249,118,12,32,26,248,253,226,49,65,132,85,165,215,238,3,16,3,70,68,56,245,232,57,
+  132,191,169,255,173,202,203,44,0,47,129,147,183,238,174,108,6,144,119,223,23,3,20,17,97,56,28,174,100,78,146,100,
+  137,192,136,40,81,20,145,36,201,234,4,94,231,4,114,48,188,193,96,176,146,185,219,237,46,207,160,58,72,251,31,130,
+  229,22,188,178,253,228,35,141,236,43,81,177,127,180,195,76,159,73,227,12,121,235,44,27,167,143,207,9,188,8,76,10,
+  162,98,159,43,151,47,81,175,215,169,213,106,179,107,173,165,44,75,242,60,103,119,247,61,249,218,6,222,183,0,176,135,
+  56,170,138,181,17,237,118,155,126,191,79,175,215,163,217,108,34,34,140,199,99,70,163,17,69,81,128,177,168,42,126,177,
+  5,149,128,170,98,12,180,90,173,25,117,154,166,148,101,137,115,14,231,28,101,89,18,66,32,168,80,85,11,67,156,84,
+  158,216,78,55,36,203,178,89,64,150,101,75,102,231,28,1,80,85,42,239,167,1,214,152,47,123,63,127,157,223,236,172,
+  55,198,89,32,77,83,58,157,14,222,123,210,52,93,50,59,231,32,192,137,99,107,51,2,115,241,206,203,117,99,248,84,
+  183,126,243,92,252,173,110,76,76,32,48,61,7,187,177,176,35,134,192,158,191,144,139,169,27,145,240,227,15,253,243,15,
+  58,103,73,91,81,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Floppy2x[890] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,3,49,73,68,65,84,88,133,229,151,63,108,28,
+  69,20,135,191,245,46,246,113,113,46,152,156,229,88,142,165,184,64,164,176,133,67,153,130,63,18,37,18,14,113,136,104,
+  80,10,10,40,104,136,132,82,69,20,208,65,73,129,33,21,22,52,20,110,64,2,4,66,178,68,1,52,40,18,21,200,
+  138,29,219,66,54,69,116,156,143,187,157,121,143,98,119,246,102,125,119,123,142,188,174,120,146,229,217,217,153,121,191,249,
+  230,55,59,55,240,127,143,192,21,230,159,125,227,163,118,187,245,38,218,173,59,169,120,100,180,242,229,239,235,31,95,3,
+  136,92,165,233,196,55,86,86,62,8,70,162,8,81,101,126,253,14,168,162,34,160,234,253,9,234,202,222,59,77,223,101,
+  207,126,63,96,253,153,183,80,20,17,229,246,173,119,151,93,222,76,128,6,18,136,194,141,87,94,228,229,155,159,82,127,
+  255,157,172,243,177,35,8,248,238,212,85,84,149,231,22,167,114,175,34,255,193,138,112,229,237,79,16,17,230,55,165,156,
+  228,105,200,135,63,129,42,98,243,227,230,4,136,40,226,208,149,28,42,201,210,89,201,143,221,67,64,173,160,116,27,109,
+  108,108,28,43,241,220,220,28,64,54,49,91,72,192,166,4,60,1,110,128,227,70,70,192,218,193,2,172,72,210,144,242,
+  151,224,72,4,172,149,30,2,101,45,65,151,192,16,19,186,134,135,7,56,110,136,19,96,6,8,80,60,2,39,184,11,
+  140,12,34,160,158,7,244,100,118,129,170,34,133,38,236,67,160,236,93,96,10,77,216,199,3,101,69,215,3,133,4,236,
+  201,123,96,216,54,116,13,95,123,239,123,20,178,147,47,251,15,217,179,35,229,183,73,170,244,80,63,208,180,174,208,3,
+  226,121,192,13,46,251,191,209,217,253,25,149,124,199,97,49,50,18,18,156,93,196,140,63,153,156,202,36,130,10,9,24,
+  143,128,155,109,103,247,23,174,44,189,68,181,90,37,12,67,162,40,34,12,195,190,101,107,45,113,28,99,140,161,209,104,
+  240,217,234,231,72,245,137,28,1,51,216,3,154,219,5,25,58,49,212,106,53,162,40,226,171,175,191,97,119,103,11,128,
+  153,217,11,188,122,125,153,48,12,49,198,208,106,181,178,228,113,28,39,166,19,147,78,168,75,96,200,89,96,243,4,82,
+  47,86,42,21,194,48,100,119,103,139,214,228,18,0,219,91,107,88,107,105,183,219,185,196,126,25,220,25,144,248,68,41,
+  248,18,2,61,4,156,128,177,177,49,162,40,215,20,128,131,131,131,129,201,141,49,9,87,71,64,21,80,226,162,109,104,
+  204,96,2,135,209,1,52,155,205,92,194,35,17,40,254,18,106,15,129,0,178,245,45,131,192,16,1,54,249,221,150,137,
+  72,4,184,153,14,18,240,112,30,232,47,32,82,209,71,239,111,110,51,59,85,231,222,206,131,244,211,9,35,94,162,179,
+  245,115,252,189,183,6,192,99,19,117,154,205,102,207,172,125,17,61,4,52,231,129,211,64,195,9,56,243,207,222,198,213,
+  245,31,190,93,189,252,252,11,149,139,23,166,3,21,65,20,254,216,236,18,120,250,210,2,113,124,49,75,52,136,128,120,
+  71,238,244,100,45,243,149,136,248,36,39,0,9,128,16,168,3,245,250,249,197,203,19,51,79,173,248,136,22,102,26,61,
+  232,31,38,238,110,159,238,169,19,219,249,241,207,95,191,120,29,248,203,93,195,106,192,227,192,25,96,28,24,37,161,95,
+  102,116,210,49,255,5,26,192,62,176,231,223,3,71,73,214,165,154,150,203,14,199,190,5,60,0,218,64,225,69,180,236,
+  75,106,223,51,254,63,200,176,115,154,207,143,225,230,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Next1x[771] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,12,6,17,45,27,217,23,207,165,0,0,2,144,73,
+  68,65,84,56,203,189,146,205,75,84,81,24,135,127,231,222,59,247,156,123,103,70,156,132,57,231,14,153,180,8,196,116,
+  6,197,153,6,218,180,16,170,255,32,136,136,218,180,206,2,147,74,164,54,130,81,88,67,209,70,8,103,81,145,86,138,
+  50,72,43,69,173,69,148,203,180,175,77,230,76,126,204,140,51,222,249,242,158,22,142,34,214,50,122,224,133,195,195,121,
+  15,191,243,242,2,255,128,26,0,202,62,103,0,48,255,226,255,128,0,176,170,103,7,64,26,64,17,64,109,245,17,9,
+  32,95,45,103,207,221,93,52,183,219,68,36,18,233,94,88,88,28,78,165,82,105,69,81,86,92,46,87,33,28,110,239,
+  94,92,252,60,146,205,100,62,129,192,112,28,103,67,74,137,83,167,79,46,237,52,39,18,147,1,69,112,11,134,201,46,
+  6,67,205,137,104,52,114,206,235,245,114,93,215,3,204,160,231,91,130,71,39,66,109,193,46,143,199,91,111,89,129,90,
+  193,183,3,60,123,250,28,0,192,253,2,10,183,4,84,85,85,95,189,124,205,154,67,45,151,162,209,200,104,99,227,145,
+  227,154,75,211,199,70,199,141,99,145,200,133,246,112,219,184,16,226,76,177,84,244,239,141,111,89,2,26,247,251,161,83,
+  13,138,162,226,193,64,204,179,190,182,230,238,190,126,173,63,159,203,83,41,37,250,250,250,107,178,217,172,183,183,183,231,
+  198,161,195,245,103,21,16,0,128,105,154,224,126,14,205,18,2,133,178,13,0,200,231,114,160,6,37,15,99,143,60,211,
+  211,83,187,78,115,169,228,78,255,221,3,153,108,186,166,179,243,242,110,2,97,9,104,92,8,172,172,38,65,8,176,158,
+  89,5,99,6,32,37,236,130,13,66,128,181,204,42,24,165,144,142,68,50,149,148,140,49,0,0,99,12,130,115,40,156,
+  115,24,110,3,138,162,34,32,14,66,119,81,196,227,79,236,153,217,105,185,227,12,230,198,228,155,68,118,100,248,197,55,
+  74,117,0,0,165,58,252,130,67,19,66,32,249,235,7,202,149,50,38,38,198,138,95,191,127,217,244,249,234,186,76,211,
+  125,191,92,41,179,143,243,239,237,183,115,179,197,236,70,254,113,176,165,117,96,118,110,106,105,123,6,6,44,46,160,9,
+  206,241,97,94,146,161,248,96,201,231,171,139,181,134,219,99,110,205,83,172,84,202,247,134,226,131,165,92,62,63,210,26,
+  10,223,52,76,211,118,42,21,194,24,173,126,129,130,11,14,141,91,2,170,162,204,52,53,54,93,9,88,13,203,68,193,
+  166,4,209,150,39,127,190,59,209,209,113,181,33,208,176,76,128,2,8,201,108,57,91,28,0,110,221,238,217,222,3,33,
+  64,108,219,174,174,39,217,4,144,51,12,182,85,44,22,124,0,40,0,71,130,164,25,165,37,0,176,109,219,218,25,226,
+  46,82,74,175,148,146,236,115,84,74,73,241,63,248,13,221,115,236,68,32,12,77,214,0,0,0,0,73,69,78,68,174,
+  66,96,130,
+};
+const unsigned char Next2x[1225] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,4,128,73,68,65,84,88,133,237,149,91,76,28,
+  85,28,198,191,179,51,195,204,206,153,238,50,93,99,122,17,219,64,140,47,53,20,149,154,20,92,48,197,22,147,250,110,
+  106,213,151,22,19,163,70,67,27,94,72,220,38,109,52,177,66,37,37,69,136,5,141,33,77,73,169,73,27,183,37,53,
+  166,150,45,84,218,93,192,138,169,149,130,104,217,114,219,139,11,204,133,101,142,15,179,107,183,20,90,250,226,139,124,201,
+  201,36,103,126,243,63,223,124,231,127,102,128,21,173,104,69,255,119,145,212,117,53,0,23,0,13,192,20,128,228,67,158,
+  123,84,222,3,64,205,88,15,0,24,128,41,62,93,112,251,142,109,55,53,221,168,233,13,246,53,37,18,137,59,0,226,
+  41,104,81,3,143,192,19,69,81,214,108,45,122,225,250,194,27,29,231,191,207,115,164,33,0,168,216,187,247,29,111,73,
+  209,133,130,130,252,87,1,228,0,144,150,48,64,0,96,239,158,61,203,225,137,36,73,34,165,116,250,252,185,11,72,15,
+  128,37,0,16,71,38,185,251,245,55,165,230,230,175,215,123,75,188,95,148,151,191,220,180,97,195,134,103,1,60,14,128,
+  91,204,197,27,187,223,146,90,90,150,207,91,150,133,201,200,196,61,115,142,133,144,211,41,226,179,195,181,206,143,14,28,
+  216,246,220,243,249,29,197,222,173,239,139,162,152,11,123,207,239,147,36,61,26,191,80,247,25,48,76,19,137,153,56,54,
+  231,23,112,173,173,39,233,174,215,118,85,150,109,127,169,35,63,127,83,57,236,152,197,197,249,205,203,226,31,106,128,227,
+  56,16,56,96,152,58,230,147,115,168,168,120,91,106,106,252,114,227,150,45,91,190,218,241,74,89,221,218,156,181,207,32,
+  163,217,238,242,6,146,41,190,49,131,95,147,179,102,19,33,228,30,62,67,44,125,10,152,32,8,0,0,77,159,133,131,
+  56,0,226,128,73,12,204,104,179,112,185,92,56,118,172,81,234,12,92,218,121,244,232,231,101,147,79,69,62,17,4,251,
+  81,66,136,61,64,192,24,131,166,107,240,172,246,160,161,161,73,234,12,252,184,179,174,238,72,89,52,22,175,231,121,158,
+  0,0,207,241,41,35,60,220,110,55,120,0,112,185,92,80,20,10,27,16,82,69,1,198,0,198,24,166,103,167,97,152,
+  6,74,188,165,124,94,94,158,178,111,223,135,7,25,179,95,202,52,205,251,248,25,109,6,89,66,22,188,47,150,242,185,
+  185,121,74,101,229,7,85,78,167,19,132,0,166,105,0,0,40,149,145,157,157,109,39,224,118,187,25,165,182,1,81,148,
+  64,136,253,189,96,204,130,101,89,200,18,68,72,162,136,43,63,117,37,91,90,154,117,2,242,177,76,229,67,203,225,155,
+  155,143,235,28,207,29,165,84,126,15,32,84,16,178,82,6,20,72,146,100,39,32,138,34,210,6,164,44,17,32,4,204,
+  178,0,0,130,144,133,72,52,130,35,71,14,235,99,99,227,254,161,191,70,14,142,14,143,198,74,74,139,14,61,136,175,
+  173,253,84,31,31,31,247,15,253,57,114,104,110,118,46,185,110,253,186,119,211,134,211,9,168,170,106,39,160,170,42,163,
+  169,45,224,120,30,204,178,64,120,1,140,49,124,119,238,172,126,165,59,16,30,189,61,182,63,20,234,239,50,77,115,82,
+  150,229,39,150,226,253,254,179,122,119,247,229,240,216,216,157,253,3,3,191,119,9,130,16,81,85,245,105,217,73,65,8,
+  1,231,176,251,158,42,20,178,44,219,6,156,78,231,191,91,48,63,63,15,129,23,48,52,124,43,217,126,186,205,136,71,
+  163,53,221,221,193,22,77,211,38,66,161,80,2,0,188,94,239,34,252,96,242,84,123,155,17,139,197,106,250,66,191,180,
+  196,98,177,137,64,32,144,240,249,124,142,27,55,126,102,138,66,193,24,131,97,26,224,121,1,138,162,216,61,7,0,146,
+  36,65,161,50,0,96,206,52,209,254,109,155,54,26,190,125,113,248,214,144,111,100,36,60,88,92,92,28,241,249,124,86,
+  250,236,184,221,110,40,41,3,115,166,137,83,167,79,106,225,240,232,197,63,134,134,125,35,35,225,193,194,194,194,123,120,
+  81,92,197,168,108,215,215,13,29,84,86,64,169,12,74,169,157,128,44,203,140,42,20,193,80,143,22,12,93,141,76,78,
+  70,170,250,66,215,127,136,199,227,83,126,191,223,56,115,230,76,230,217,5,165,148,81,69,198,181,80,143,22,188,214,19,
+  153,154,140,86,245,245,45,205,171,170,10,153,202,32,132,192,163,62,6,0,80,236,30,176,19,240,120,60,140,82,138,80,
+  239,213,250,254,222,95,27,34,145,200,196,137,19,39,18,88,226,111,72,41,101,148,82,244,247,7,235,111,254,54,220,160,
+  235,250,146,188,207,231,99,213,213,213,186,32,240,202,55,173,199,239,214,80,148,85,110,183,219,226,1,128,227,184,88,224,
+  82,207,147,201,100,82,139,70,163,209,182,182,182,249,197,22,78,139,227,184,216,229,206,171,203,229,217,244,244,244,68,111,
+  112,96,99,230,36,207,243,12,192,223,15,90,103,69,43,90,209,127,162,127,0,249,122,45,195,125,20,111,61,0,0,0,
+  0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Optical1x[931] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,13,215,0,
+  0,13,215,1,66,40,155,120,0,0,0,7,116,73,77,69,7,213,4,1,17,53,53,42,125,41,75,0,0,3,48,73,
+  68,65,84,56,203,109,147,203,79,92,101,24,198,127,223,119,206,249,56,103,206,64,231,82,24,40,101,46,13,139,138,181,
+  11,77,105,162,27,218,196,109,53,154,214,148,82,117,211,24,132,181,43,255,0,141,91,40,184,211,136,216,164,186,108,216,
+  168,69,161,216,185,64,36,182,44,96,8,129,4,40,48,131,23,152,14,115,174,110,74,98,136,239,242,201,251,203,179,120,
+  158,71,112,226,134,134,7,47,3,31,2,125,64,238,133,188,6,76,3,95,141,142,140,229,255,251,47,78,192,99,201,68,
+  242,245,219,183,63,216,239,232,232,120,213,178,172,102,128,122,189,94,219,218,218,124,50,49,241,77,164,186,95,157,27,29,
+  25,27,228,127,156,167,30,205,205,126,231,121,94,176,180,180,20,46,44,44,132,165,82,41,92,92,92,12,203,229,114,88,
+  173,86,67,223,247,131,217,217,153,169,161,225,193,169,99,78,59,118,238,239,31,16,47,157,239,185,145,207,231,229,193,193,
+  1,190,239,35,132,64,8,129,97,24,72,41,105,52,26,34,155,205,117,39,18,137,253,136,109,190,86,44,148,30,104,67,
+  195,131,151,147,137,228,199,183,250,7,174,46,47,47,75,223,247,169,213,14,57,172,29,80,171,29,80,175,63,71,211,53,
+  154,148,66,211,116,194,48,164,187,187,187,51,159,127,28,121,229,226,133,121,173,183,247,210,167,119,238,124,148,118,29,55,
+  85,175,215,113,93,7,93,55,104,110,110,33,213,214,78,107,107,27,137,68,146,74,117,151,38,213,132,227,184,248,190,79,
+  170,45,229,46,46,254,110,233,64,223,217,206,179,185,74,165,130,82,10,215,115,137,218,205,172,174,174,146,47,252,6,16,
+  222,184,254,158,200,229,206,177,82,94,38,17,79,226,121,30,103,206,116,158,6,250,36,144,51,77,83,41,165,48,77,19,
+  33,32,30,143,147,47,60,14,35,150,125,209,247,253,214,239,127,184,31,196,98,49,170,213,10,158,231,225,56,14,134,97,
+  24,64,78,63,142,83,41,69,16,4,232,186,142,109,219,72,41,130,63,255,218,223,0,208,52,205,1,76,199,113,240,60,
+  15,33,4,190,239,11,64,72,96,173,209,104,120,74,41,148,82,156,58,21,163,209,104,240,238,59,215,165,82,234,153,174,
+  235,171,111,93,123,91,173,175,175,163,84,19,174,235,226,121,30,135,135,135,62,176,166,3,211,219,219,219,201,116,58,221,
+  10,208,158,106,103,119,111,135,158,158,30,241,249,103,95,152,128,185,177,177,193,207,15,127,36,151,61,135,235,186,68,34,
+  17,118,118,119,234,192,67,173,183,247,82,165,188,186,114,237,74,223,213,184,166,105,232,186,142,101,90,236,85,246,152,159,
+  47,242,228,201,31,84,170,21,218,90,83,8,33,145,82,210,213,213,197,189,123,147,255,212,143,234,159,104,197,66,105,243,
+  229,11,61,231,99,177,88,71,186,43,221,34,132,64,74,13,93,55,136,70,155,137,199,19,216,118,20,41,37,71,71,71,
+  100,179,89,138,197,194,223,79,151,158,222,191,59,58,254,165,6,80,44,148,30,88,17,243,77,219,142,158,206,100,50,166,
+  148,18,199,113,8,130,128,48,12,1,176,44,139,76,38,195,220,220,35,231,151,95,167,103,238,142,142,223,4,52,237,184,
+  211,197,66,233,219,104,115,36,59,59,59,147,75,165,218,149,105,154,178,165,165,5,203,178,0,216,220,218,244,39,39,39,
+  158,175,148,87,190,30,29,25,187,249,2,11,197,137,101,234,183,6,250,223,176,237,200,251,186,166,95,17,82,116,9,33,
+  68,16,4,155,158,231,253,100,24,198,248,201,57,255,11,186,149,81,110,74,152,180,58,0,0,0,0,73,69,78,68,174,
+  66,96,130,
+};
+const unsigned char Optical2x[2288] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,8,167,73,68,65,84,88,133,229,151,91,140,93,
+  85,25,199,127,223,186,236,189,207,57,115,105,41,183,82,10,237,204,116,90,138,9,98,138,180,99,73,108,98,76,42,62,
+  153,152,24,227,131,74,192,104,34,198,71,124,218,36,64,120,51,18,209,136,4,121,65,229,65,159,180,137,21,112,148,208,
+  0,137,37,80,96,104,103,10,116,122,133,210,118,230,220,247,222,235,226,195,57,211,116,70,52,98,124,115,237,124,217,59,
+  217,107,175,255,111,125,235,178,255,11,254,223,139,124,146,202,121,158,95,37,34,119,55,26,141,111,199,24,167,157,171,214,
+  151,101,149,38,73,82,24,99,46,41,165,142,182,90,173,167,128,3,121,158,95,252,159,1,228,121,190,163,86,171,253,34,
+  132,48,179,125,251,118,181,101,203,22,53,62,62,74,150,213,72,147,4,231,42,138,162,164,217,106,241,222,187,239,133,185,
+  119,222,9,90,171,67,237,118,231,222,60,207,143,253,215,0,143,61,246,88,218,237,118,159,80,74,125,125,247,238,221,102,
+  98,98,130,178,44,41,138,14,222,59,136,32,40,180,49,88,99,177,54,97,108,108,12,165,20,199,230,231,249,203,236,172,
+  143,49,62,147,101,217,125,247,223,127,127,241,137,0,30,126,248,225,235,180,214,47,78,78,78,78,237,218,181,75,186,221,
+  46,75,75,75,136,114,104,165,33,42,172,49,104,109,208,74,163,181,198,154,132,70,163,129,82,138,52,75,137,34,188,248,
+  226,223,226,209,99,199,230,59,157,206,93,121,158,127,184,86,71,127,156,248,35,143,60,114,141,214,122,238,142,59,238,184,
+  113,199,142,29,114,242,228,73,154,205,38,162,28,50,188,98,80,132,32,40,1,162,0,130,53,22,173,7,77,6,31,16,
+  96,106,106,74,178,44,219,112,230,204,153,123,246,238,221,251,212,236,236,108,247,223,2,228,121,158,36,73,242,202,238,221,
+  187,111,218,188,121,51,39,78,156,160,223,239,163,180,27,8,69,32,42,98,208,32,122,144,194,33,64,146,100,136,104,68,
+  4,17,32,66,12,129,235,55,110,164,209,168,215,62,248,224,131,47,207,204,204,60,57,59,59,235,87,244,212,90,128,122,
+  189,254,147,233,233,233,29,147,147,147,156,59,119,14,0,99,3,49,64,240,145,224,193,251,128,15,17,2,56,7,206,71,
+  188,7,173,204,80,148,97,189,72,240,129,170,44,185,117,231,78,166,182,109,187,101,221,186,117,63,190,82,111,21,64,158,
+  231,55,26,99,190,117,231,157,119,202,249,243,231,81,74,145,164,160,100,208,112,240,145,16,34,193,71,202,126,73,89,246,
+  104,183,250,116,219,93,98,24,8,14,68,35,17,129,56,168,31,3,84,101,201,231,102,246,72,140,241,158,135,30,122,104,
+  211,199,2,140,141,141,61,177,119,239,222,180,40,10,98,140,104,173,209,218,14,199,54,33,4,232,245,10,46,92,184,196,
+  165,165,37,250,189,130,94,175,79,179,217,161,221,238,211,110,245,168,170,64,88,129,141,130,143,145,170,42,105,183,59,184,
+  202,49,179,103,79,58,50,82,127,226,159,0,242,60,191,202,57,247,133,137,137,9,122,189,30,90,107,140,141,24,173,209,
+  198,32,162,41,75,199,210,82,139,170,10,248,10,124,136,104,3,165,139,40,157,80,185,64,171,221,163,232,59,124,128,202,
+  5,218,173,46,237,78,15,31,2,85,85,49,49,177,149,126,191,248,226,163,143,62,58,190,54,3,95,218,185,115,167,14,
+  33,160,148,66,107,131,209,22,165,12,90,25,98,128,94,175,68,68,225,92,129,50,17,107,107,140,175,31,99,124,244,26,
+  234,181,81,188,23,66,20,218,189,130,165,229,22,151,46,45,83,148,37,222,7,156,243,56,231,137,33,48,53,181,77,245,
+  251,253,187,1,204,138,250,232,232,232,189,83,83,83,202,57,135,49,134,72,9,98,8,94,240,74,232,246,150,209,218,224,
+  67,69,150,89,202,178,231,15,191,113,168,83,20,197,104,154,102,205,233,137,219,70,38,39,63,165,47,94,60,79,171,213,
+  36,73,53,27,54,172,7,45,136,15,3,112,9,84,174,98,235,214,155,213,226,226,226,189,192,175,47,3,196,24,167,199,
+  199,199,7,107,211,4,98,180,68,239,8,90,8,253,138,16,4,80,36,73,141,24,11,191,176,176,112,17,248,174,49,230,
+  80,81,244,103,142,204,189,242,51,209,102,67,189,190,65,119,75,71,21,60,141,210,145,138,30,172,118,21,176,81,40,43,
+  199,232,232,40,33,132,233,85,25,40,203,114,93,189,94,167,223,239,163,181,38,70,193,59,64,60,206,41,32,5,177,36,
+  54,99,238,232,161,86,140,241,155,121,158,31,24,126,254,187,60,207,123,199,230,15,63,115,215,93,95,93,247,225,133,11,
+  160,132,110,191,66,25,5,18,6,153,80,32,14,108,146,82,85,213,250,85,115,192,57,151,38,73,130,136,194,104,75,244,
+  26,239,44,193,25,148,88,70,71,50,54,108,168,179,113,99,131,94,175,59,102,173,125,237,202,21,100,173,125,173,215,239,
+  142,105,219,70,169,128,171,42,122,165,163,244,145,42,4,156,139,184,16,112,222,99,172,161,170,170,116,21,128,49,166,112,
+  206,97,108,24,238,229,6,101,20,90,25,68,12,222,107,156,19,124,208,212,235,141,118,85,85,183,95,9,80,85,213,237,
+  181,90,173,147,232,62,90,90,131,127,134,246,84,206,83,184,64,229,2,101,229,241,33,210,237,86,88,107,139,85,67,144,
+  166,233,82,81,20,215,219,196,98,116,36,122,79,173,6,74,60,62,26,150,155,21,69,17,41,92,224,150,233,207,54,14,
+  191,62,251,171,7,31,124,240,123,198,152,67,206,185,25,17,249,249,174,93,183,141,4,218,36,105,151,126,25,177,122,28,
+  161,196,121,75,165,5,9,130,143,129,78,167,131,181,118,105,21,128,82,234,88,171,213,186,254,186,235,174,198,59,143,54,
+  130,118,17,99,132,36,73,169,213,234,52,70,83,180,206,24,173,95,163,145,98,195,91,111,31,126,170,40,139,209,44,203,
+  58,183,127,122,103,227,214,91,183,203,187,239,206,145,101,130,214,5,74,28,49,10,2,20,46,162,180,37,68,97,121,185,
+  137,136,28,91,5,176,188,188,252,203,163,71,231,246,222,112,195,231,149,49,134,224,61,90,71,148,247,100,245,58,155,54,
+  53,88,90,238,226,125,164,40,186,108,222,52,165,183,108,158,24,19,213,65,164,63,226,124,151,247,142,191,9,68,210,84,
+  147,166,138,64,147,200,216,192,55,136,80,120,161,30,234,156,90,60,17,90,173,214,19,171,0,128,3,71,142,188,229,247,
+  237,219,167,140,50,4,35,128,198,88,69,89,6,10,34,89,45,163,215,43,16,60,231,63,58,71,171,121,17,133,195,199,
+  54,89,22,48,182,194,88,131,73,18,34,16,124,73,164,28,252,190,163,34,184,140,8,156,60,121,34,0,7,86,77,194,
+  60,207,47,166,105,250,220,252,252,2,198,24,172,181,36,214,160,181,26,236,140,74,145,101,25,245,90,13,99,12,69,89,
+  96,140,66,84,196,42,131,18,141,171,28,74,60,68,7,56,4,7,244,136,120,8,21,137,17,78,188,255,46,54,77,14,
+  230,121,190,180,54,3,52,155,205,239,60,255,252,11,11,219,38,167,18,165,20,81,129,72,64,91,133,114,17,145,64,146,
+  90,132,132,117,235,199,169,10,3,33,129,152,96,172,66,169,26,33,180,169,188,195,71,197,192,112,5,80,158,16,82,148,
+  4,22,230,94,47,171,170,184,111,69,115,149,33,121,225,133,23,154,251,247,239,223,220,106,181,62,51,57,49,33,33,68,
+  4,69,240,17,65,240,8,33,64,229,10,36,120,146,68,99,18,141,177,67,3,34,1,80,184,104,240,46,226,163,34,98,
+  64,52,181,218,24,243,239,188,25,123,221,246,147,63,122,224,129,223,92,158,252,172,41,151,46,93,250,254,219,111,207,29,
+  61,242,214,155,24,163,81,34,104,173,16,45,88,45,136,82,248,16,81,214,130,210,136,54,40,101,209,214,128,164,96,82,
+  180,74,80,166,70,100,80,39,177,35,156,62,121,130,143,62,60,251,78,175,219,253,193,149,122,107,45,153,153,157,157,77,
+  69,201,1,224,27,181,90,45,219,184,241,6,16,33,134,72,4,156,31,108,40,136,31,108,173,3,55,70,140,1,148,12,
+  28,155,40,124,4,165,13,214,140,113,246,212,25,222,59,62,191,244,231,131,7,247,63,253,244,211,125,6,198,206,175,5,
+  176,64,3,104,44,44,44,168,11,23,46,252,177,86,175,125,161,221,110,141,221,124,211,22,49,214,16,99,164,170,42,66,
+  8,3,199,35,113,32,62,188,3,68,17,2,66,154,53,128,140,249,163,243,241,212,226,226,169,103,159,253,237,215,94,125,
+  245,213,165,97,214,87,38,72,181,22,96,37,146,179,103,207,186,195,135,15,255,97,227,13,27,111,122,243,173,55,182,142,
+  52,26,114,237,117,215,94,238,177,15,3,225,24,35,200,96,104,180,49,88,155,97,146,148,197,247,207,241,250,223,15,135,
+  51,167,79,63,247,248,227,63,253,225,226,226,226,242,176,215,30,112,64,9,184,181,231,130,20,168,3,53,32,91,137,61,
+  123,246,108,223,191,127,255,3,214,38,59,183,109,155,86,155,111,158,144,122,99,20,165,19,180,85,148,253,46,157,78,147,
+  86,115,137,211,167,79,197,51,167,78,135,162,95,204,29,60,248,167,71,95,126,249,229,121,160,63,140,222,48,90,64,1,
+  255,250,96,98,174,128,73,129,4,72,166,167,167,175,158,153,153,217,55,181,109,219,87,140,49,155,131,15,35,206,85,137,
+  49,166,20,165,218,174,170,78,30,63,126,252,247,47,189,244,210,95,231,231,231,63,2,170,97,79,187,195,40,134,189,191,
+  92,254,211,195,233,202,184,13,221,197,229,231,149,54,226,240,217,3,225,138,84,251,43,222,125,108,249,7,245,56,85,181,
+  81,113,17,188,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Pause1x[464] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,12,6,17,32,43,74,96,129,68,0,0,1,93,73,
+  68,65,84,56,203,205,146,75,110,20,65,12,134,191,42,187,153,238,40,234,213,216,138,56,64,114,12,136,224,72,72,112,
+  164,40,202,25,0,133,59,68,16,16,172,103,150,72,48,105,250,97,22,253,200,0,19,177,4,47,74,165,175,92,191,126,
+  63,224,95,71,218,187,159,254,61,59,45,159,34,226,35,16,58,191,173,215,107,206,159,61,121,191,47,250,246,245,245,89,
+  12,67,62,127,254,244,102,159,95,191,121,119,182,217,110,19,16,121,134,102,134,170,198,229,197,21,151,23,87,168,234,224,
+  102,172,15,112,115,95,76,45,14,220,29,17,161,239,123,62,125,249,128,136,96,238,116,93,183,240,219,207,55,35,55,251,
+  83,192,204,16,17,118,119,223,41,180,64,84,48,115,186,182,69,68,184,107,118,136,40,162,130,63,36,208,180,59,154,166,
+  65,84,16,17,220,215,64,26,118,205,55,218,246,7,229,170,90,156,205,113,223,3,31,29,52,109,67,34,33,121,116,48,
+  246,70,136,8,202,85,137,228,95,29,44,2,110,62,38,14,3,67,12,168,42,102,134,79,165,229,44,148,101,133,170,96,
+  110,15,59,32,160,239,187,169,4,95,184,100,229,81,177,154,154,120,104,10,54,78,225,228,228,49,146,5,45,70,7,36,
+  16,17,170,163,106,226,197,92,66,28,154,66,188,124,245,2,0,201,57,215,245,81,189,42,143,191,254,206,143,235,170,158,
+  5,150,237,218,108,55,167,68,34,165,105,99,35,17,41,72,115,74,26,143,116,191,185,183,252,23,241,19,86,58,109,31,
+  74,23,56,251,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Pause2x[481] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,1,152,73,68,65,84,88,133,237,150,221,138,211,
+  64,24,134,159,73,38,33,95,82,200,38,109,8,245,220,43,82,92,240,226,4,241,64,252,187,33,47,192,19,105,151,234,
+  170,176,54,243,122,176,181,80,108,217,217,57,53,239,209,48,239,195,228,97,134,15,2,115,230,204,249,223,227,34,152,39,
+  64,115,161,251,1,124,137,100,206,198,71,8,212,207,175,159,125,62,87,124,124,247,233,233,35,152,52,129,182,109,5,240,
+  254,237,7,238,126,223,1,80,248,130,235,151,47,104,219,86,187,221,46,138,185,148,44,86,64,18,155,205,87,110,110,54,
+  255,116,49,76,178,192,213,213,213,241,240,105,218,179,159,246,76,211,116,210,197,48,201,2,171,213,42,0,4,133,227,158,
+  14,235,191,93,12,147,44,176,92,46,117,56,17,151,101,56,28,146,78,186,24,38,89,96,177,88,8,32,72,228,89,126,
+  248,142,78,186,24,38,89,96,24,6,149,101,9,18,223,111,191,241,243,215,45,65,129,178,44,25,134,65,177,204,165,60,
+  56,134,117,93,135,202,42,132,40,138,2,112,32,168,172,162,174,235,16,203,36,223,192,122,189,150,153,1,142,194,151,120,
+  127,239,108,102,199,17,139,97,146,111,160,44,75,153,25,14,240,222,31,223,214,204,142,35,22,195,36,11,244,125,47,171,
+  42,112,14,239,61,33,28,14,175,42,250,190,87,44,147,44,208,117,93,184,191,94,200,92,6,89,64,8,51,163,235,186,
+  16,203,36,11,140,227,40,51,67,18,102,53,146,14,107,99,28,71,197,50,201,2,77,211,200,172,226,245,155,87,39,251,
+  102,21,77,211,40,150,185,148,7,255,7,182,219,109,155,231,121,126,174,155,166,105,234,251,126,23,195,36,11,0,72,58,
+  59,174,206,185,240,24,102,206,156,57,231,242,7,129,72,10,39,48,222,244,211,0,0,0,0,73,69,78,68,174,66,96,
+  130,
+};
+const unsigned char Play1x[660] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,12,6,17,36,33,206,217,173,94,0,0,2,33,73,
+  68,65,84,56,203,157,147,75,107,19,1,20,133,207,60,50,201,36,77,38,49,153,105,98,19,19,90,73,48,35,186,74,
+  209,212,72,82,108,138,5,193,103,116,39,88,16,193,66,182,221,249,7,92,244,23,72,151,130,47,186,114,163,136,32,46,
+  12,66,77,21,177,88,108,160,17,74,250,208,164,51,77,50,51,185,46,196,166,98,41,177,119,117,238,230,131,115,239,57,
+  64,119,120,28,96,184,93,58,2,192,1,160,9,128,122,5,176,187,151,252,248,216,235,96,48,152,6,224,235,21,192,252,
+  17,138,44,31,25,62,149,250,198,48,76,199,178,204,47,229,15,159,110,182,90,173,207,181,90,77,239,201,66,52,22,147,
+  188,62,169,248,236,233,28,239,145,60,254,106,117,101,178,191,95,25,233,48,244,102,32,52,80,175,213,106,180,47,32,169,
+  170,146,40,58,138,215,11,55,216,72,100,128,157,56,63,193,245,185,221,225,141,245,245,219,162,83,76,58,69,215,187,100,
+  242,88,99,121,185,178,55,96,56,149,146,56,142,41,94,189,114,141,5,1,174,62,55,212,164,202,165,79,167,5,151,83,
+  76,252,168,255,156,52,45,107,117,104,112,168,178,180,180,212,252,7,144,203,102,165,182,217,46,94,186,120,153,221,210,235,
+  48,140,54,12,163,13,187,195,142,120,34,193,229,243,227,14,34,186,64,48,83,137,120,252,125,230,76,166,81,42,149,204,
+  157,223,7,100,5,13,173,14,0,208,116,13,32,2,1,176,241,54,120,61,62,232,164,131,200,98,252,135,252,134,215,19,
+  144,120,142,117,3,104,238,0,20,69,70,245,251,111,127,186,190,5,155,205,142,195,193,48,44,211,196,236,236,3,107,241,
+  235,226,102,44,22,189,163,4,66,111,1,90,187,59,53,101,252,149,62,89,150,201,38,8,0,8,209,240,32,120,158,199,
+  227,39,143,172,133,143,11,70,60,113,244,94,102,36,251,176,211,233,172,22,10,133,22,246,138,175,44,43,16,4,27,117,
+  136,240,242,213,11,42,151,231,45,183,199,243,60,123,118,116,90,16,236,149,92,46,171,237,245,198,46,64,9,64,20,237,
+  52,51,115,223,210,116,109,101,52,59,122,43,32,135,230,143,171,234,198,126,65,234,222,32,32,99,123,187,181,121,110,44,
+  53,125,66,61,57,7,48,155,138,162,80,207,81,38,162,48,0,3,192,26,195,48,214,127,215,146,136,216,131,212,249,23,
+  48,70,193,31,65,224,78,98,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Play2x[1028] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,3,187,73,68,65,84,88,133,237,150,79,104,92,
+  69,28,199,191,191,153,247,222,38,152,221,77,186,89,179,102,119,155,205,214,28,52,193,67,216,98,172,198,158,2,109,18,
+  227,37,53,233,161,16,138,32,5,139,7,17,91,169,36,162,135,106,52,185,21,164,45,246,20,145,28,44,90,16,169,96,
+  138,40,10,94,90,40,66,168,202,102,75,146,110,246,109,220,52,201,251,183,51,227,97,55,138,16,54,219,152,198,131,249,
+  194,156,230,189,249,125,222,119,126,243,157,7,236,105,79,255,177,248,22,243,205,0,26,0,120,229,177,235,0,145,163,125,
+  61,31,25,186,102,46,45,153,22,0,7,128,216,77,128,80,50,217,122,161,189,189,227,165,230,232,99,173,203,249,63,102,
+  215,215,215,5,0,27,128,218,21,128,3,143,39,79,79,77,125,198,91,90,18,79,44,46,206,159,136,52,55,97,97,126,
+  113,78,8,33,81,114,228,225,3,12,14,30,67,67,168,158,6,6,6,116,195,208,187,164,18,199,2,254,186,244,252,252,
+  194,10,128,34,0,247,161,2,12,13,13,195,117,29,40,37,209,222,209,193,143,28,57,234,95,202,229,250,67,251,234,159,
+  83,74,204,154,230,178,139,109,246,71,213,0,158,87,250,72,41,37,56,103,232,238,62,204,83,169,131,177,76,38,51,220,
+  28,107,126,52,183,148,187,99,219,54,202,32,114,71,0,2,129,64,40,22,143,254,3,96,67,82,10,248,3,126,244,245,
+  245,243,253,241,248,83,57,51,123,34,210,212,100,229,243,203,119,125,62,31,28,199,177,255,53,64,50,153,12,5,131,254,
+  211,67,195,199,81,20,69,48,34,16,177,191,7,8,82,10,196,162,49,234,127,97,192,0,84,55,65,188,88,23,12,254,
+  90,91,83,187,222,216,216,40,76,211,172,216,31,84,105,178,167,167,167,141,152,156,189,122,245,11,88,182,5,162,138,143,
+  131,51,142,251,171,171,24,255,224,188,55,151,206,124,127,223,90,123,155,73,150,118,93,119,105,102,102,102,83,71,88,165,
+  5,163,209,104,137,146,24,56,231,224,140,131,115,14,198,74,14,40,165,32,165,128,87,244,96,59,54,86,86,11,144,170,
+  136,209,209,119,244,209,177,177,195,193,186,186,239,2,245,117,175,37,18,137,248,200,200,72,205,3,3,132,195,97,0,128,
+  82,18,150,109,193,118,44,216,182,5,199,117,224,121,14,132,40,66,72,9,40,5,70,4,141,107,240,249,106,192,25,199,
+  194,252,130,180,44,11,156,88,58,28,14,99,109,109,109,211,40,215,42,1,196,98,49,220,254,229,22,136,24,52,174,129,
+  177,141,30,32,16,168,180,129,10,80,229,80,212,53,3,153,204,28,38,38,199,93,199,113,63,125,246,208,51,19,126,255,
+  190,133,124,62,111,78,79,79,111,122,50,42,2,68,163,81,24,186,1,34,250,107,11,24,99,32,198,192,136,176,209,66,
+  156,115,20,10,5,76,78,78,120,119,231,50,63,39,18,251,207,182,181,61,249,91,48,24,204,246,246,246,86,76,203,45,
+  29,208,117,29,4,128,17,3,49,2,99,12,172,220,11,156,115,88,235,22,174,93,251,210,187,126,253,235,108,184,49,124,
+  230,212,169,87,127,16,66,228,186,186,186,86,42,173,93,189,3,134,14,5,64,42,9,146,4,9,9,198,24,164,144,184,
+  117,243,166,188,252,201,69,187,190,190,225,195,179,103,206,77,213,214,214,230,35,145,136,73,68,85,7,81,85,14,40,165,
+  32,68,177,244,130,166,35,123,239,30,46,94,250,216,85,10,159,191,124,242,149,241,206,206,206,44,128,44,17,61,240,229,
+  84,17,0,0,12,195,128,82,18,154,166,67,10,133,43,87,46,123,233,244,239,183,15,166,158,126,115,112,112,232,14,128,
+  28,17,85,101,247,182,0,116,93,7,231,26,126,250,241,70,241,219,153,111,204,120,188,229,220,251,231,39,110,0,40,148,
+  139,87,109,247,246,0,12,29,239,190,55,102,251,31,241,95,120,227,245,183,46,133,66,161,85,108,211,238,109,1,180,182,
+  182,142,29,234,122,254,171,84,42,149,3,96,18,81,97,39,10,111,168,98,184,43,165,14,160,148,150,133,114,241,29,253,
+  31,220,82,74,41,93,41,229,219,213,162,123,250,223,233,79,122,42,124,149,23,233,94,217,0,0,0,0,73,69,78,68,
+  174,66,96,130,
+};
+const unsigned char Record1x[653] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,2,31,73,68,65,84,56,141,
+  165,146,191,79,83,81,20,199,191,231,222,190,246,181,233,15,250,196,244,17,219,69,23,41,97,0,177,9,152,72,28,28,
+  193,137,85,7,255,2,13,187,131,110,44,46,50,59,43,115,19,226,212,116,168,77,108,9,67,141,44,150,0,173,37,64,
+  109,74,222,123,188,182,247,29,135,214,154,98,49,38,124,147,179,220,156,243,201,61,223,243,37,102,198,117,36,174,53,13,
+  192,55,238,177,64,20,212,128,199,18,88,80,64,18,64,81,2,249,57,230,175,151,123,233,242,10,59,68,15,69,52,250,
+  97,106,109,205,8,77,79,251,68,56,76,238,254,190,247,51,151,235,182,10,133,247,12,188,188,199,108,143,5,148,136,30,
+  197,102,103,179,169,245,117,189,231,186,232,53,155,240,92,23,50,24,132,223,52,225,148,74,170,186,185,249,101,190,219,93,
+  196,96,112,8,40,18,69,3,177,216,247,187,27,27,55,156,131,3,168,118,27,96,238,151,231,1,74,33,152,78,227,60,
+  159,239,214,183,182,94,204,51,191,27,49,81,2,79,110,173,174,70,187,167,167,232,213,235,128,101,1,142,3,216,54,96,
+  89,96,203,130,93,46,35,190,188,172,105,209,232,171,191,76,20,192,3,61,153,212,46,118,119,161,26,13,144,223,15,105,
+  24,32,162,225,15,188,94,15,189,86,11,122,42,101,20,136,140,69,230,230,159,43,16,221,145,74,161,83,46,131,29,7,
+  66,8,176,148,16,145,8,40,18,1,2,1,176,235,66,213,106,240,199,98,42,208,191,78,115,184,130,98,46,116,78,78,
+  88,155,156,132,32,130,16,2,130,8,100,89,64,163,1,175,90,133,119,116,4,65,132,139,90,77,234,192,183,17,15,8,
+  200,183,247,246,58,250,204,12,136,8,52,128,72,41,251,48,33,160,153,38,72,215,97,55,26,149,52,115,103,4,176,192,
+  252,233,172,88,252,204,68,28,202,100,32,164,4,6,32,16,65,24,6,66,75,75,168,103,179,29,184,238,243,171,114,48,
+  165,133,195,229,228,202,202,77,221,52,165,58,62,6,92,23,52,49,1,17,143,163,190,189,221,57,175,84,94,207,41,245,
+  230,202,36,150,136,66,36,196,91,61,145,120,22,74,165,60,95,56,76,78,173,38,156,195,195,31,174,109,63,189,207,156,
+  251,103,148,127,235,35,145,188,13,164,25,72,120,192,78,134,249,108,92,223,149,128,255,213,47,18,206,244,197,113,23,107,
+  46,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Record2x[1266] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,4,169,73,68,65,84,88,133,237,150,79,76,20,
+  87,28,199,191,111,102,246,207,204,178,255,177,129,85,10,107,34,75,36,34,161,9,213,149,26,47,214,100,15,180,73,133,
+  54,30,44,141,61,24,155,210,212,68,175,114,241,64,210,139,61,181,49,189,149,139,7,107,99,228,232,65,77,99,116,86,
+  64,75,36,234,194,82,5,171,11,238,226,48,51,59,127,95,15,195,210,45,221,161,208,63,233,133,95,242,242,123,121,51,
+  239,125,63,239,251,222,188,55,192,86,108,197,255,28,228,111,246,99,1,240,0,56,0,12,0,19,128,14,160,252,95,3,
+  248,1,212,3,16,92,158,91,0,74,0,138,0,236,127,27,96,27,128,232,215,64,79,59,240,94,144,144,52,203,48,17,
+  74,41,108,74,75,18,165,63,77,2,63,14,2,183,0,24,0,158,99,3,142,108,4,128,240,60,159,248,220,182,119,191,
+  175,235,23,98,157,157,59,223,232,237,245,241,109,109,96,67,33,80,74,97,21,139,80,31,62,68,225,218,53,237,213,253,
+  251,211,87,188,222,47,190,241,249,102,124,62,223,175,133,66,97,249,31,1,52,55,55,55,126,249,242,229,193,131,192,119,
+  201,51,103,4,161,171,139,104,115,115,48,95,189,130,45,203,0,165,32,62,31,60,209,40,124,137,4,228,177,49,154,191,
+  112,65,185,1,156,248,42,30,207,114,28,247,44,159,207,187,58,193,174,39,222,222,222,94,247,65,177,216,145,41,151,71,
+  118,13,15,7,185,250,122,34,143,143,195,88,92,4,85,85,192,52,1,211,132,173,170,48,23,22,160,61,125,10,62,153,
+  36,177,158,30,111,221,245,235,239,114,44,59,154,11,135,141,133,133,133,215,110,26,204,122,0,209,104,52,214,91,42,157,
+  111,62,117,42,68,56,14,242,216,24,108,69,1,209,52,64,215,87,11,209,117,192,48,0,85,133,148,205,2,0,90,78,
+  156,8,246,150,74,231,35,145,136,231,192,129,3,117,155,6,232,235,235,243,126,146,203,189,21,106,105,217,43,236,217,67,
+  148,241,113,64,211,128,114,217,201,85,0,116,13,140,50,54,6,126,247,110,18,76,36,246,126,154,207,239,9,135,195,129,
+  77,3,120,60,158,192,174,82,233,195,134,195,135,3,229,233,105,216,170,234,8,25,134,35,86,129,208,52,16,93,7,49,
+  12,192,48,64,101,25,230,179,103,80,110,222,196,182,206,206,64,107,169,244,17,207,243,2,92,246,155,43,128,32,8,94,
+  94,215,223,225,147,73,152,115,115,142,200,90,235,53,13,80,85,216,47,94,192,124,244,8,134,40,194,16,69,88,185,28,
+  180,7,15,32,52,53,129,215,245,158,120,60,78,134,134,134,60,181,116,56,55,0,191,223,207,50,182,29,37,150,5,115,
+  126,30,132,101,1,66,0,203,114,156,80,20,216,146,4,40,10,40,165,0,165,0,0,66,156,137,218,178,12,54,24,4,
+  177,237,104,32,16,160,75,75,75,53,55,188,43,64,99,99,163,5,0,116,105,9,230,212,20,96,89,32,132,128,48,140,
+  147,87,10,86,242,42,4,195,0,182,237,192,174,68,56,28,70,44,22,171,121,50,186,46,1,207,243,6,101,217,162,37,
+  73,96,131,193,85,33,66,8,24,134,113,45,149,119,216,96,16,150,36,129,178,108,49,30,143,211,134,134,6,115,83,0,
+  0,84,91,16,110,168,51,51,240,236,216,1,2,252,97,230,21,55,24,134,249,147,43,132,16,120,182,111,135,154,207,195,
+  20,132,155,130,32,104,253,253,253,214,166,0,78,159,62,93,214,218,218,70,10,119,239,46,243,169,20,8,199,173,186,128,
+  106,152,42,241,213,118,142,131,191,181,21,133,59,119,150,105,71,199,72,44,22,83,220,116,214,115,128,154,195,195,183,202,
+  178,60,161,60,121,66,3,233,244,239,79,42,107,95,17,172,106,3,0,97,255,126,40,185,28,213,101,121,98,249,220,185,
+  9,195,48,36,55,145,117,143,226,100,50,169,39,67,161,159,149,209,209,254,104,87,151,223,215,212,4,99,126,30,196,182,
+  87,103,76,1,103,243,81,10,112,28,248,116,26,212,227,193,236,229,203,175,201,177,99,3,108,58,253,203,145,35,71,92,
+  239,130,191,188,140,38,39,39,189,250,201,147,25,122,251,246,247,59,50,25,161,174,181,149,104,83,83,176,158,63,7,149,
+  36,199,133,96,16,108,34,1,111,42,5,249,241,99,250,116,116,84,161,251,246,29,175,187,120,241,70,42,149,90,88,111,
+  252,13,93,199,162,40,114,252,240,240,219,218,213,171,223,250,227,241,157,245,93,93,126,190,185,217,249,58,0,88,146,4,
+  117,118,22,139,247,238,149,213,197,197,105,207,209,163,159,209,179,103,39,58,58,58,74,43,99,208,13,232,212,132,35,112,
+  246,9,123,232,208,33,78,20,197,250,123,221,221,199,179,145,200,15,89,142,43,100,9,49,178,132,24,89,142,43,136,145,
+  200,21,177,187,251,99,81,20,223,188,116,233,82,29,156,229,101,87,250,87,198,218,148,3,213,157,42,117,50,48,48,192,
+  102,50,25,33,20,10,249,88,150,245,48,12,67,52,77,179,12,195,48,102,103,103,213,193,193,65,181,106,214,149,130,53,
+  245,13,1,212,130,168,149,171,131,174,147,107,46,195,102,254,9,137,75,189,22,192,218,250,86,108,133,107,252,6,191,56,
+  1,108,78,79,135,199,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Rewind1x[764] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,12,6,17,39,32,146,243,206,11,0,0,2,137,73,
+  68,65,84,56,203,189,147,203,75,84,97,24,198,159,239,59,183,153,243,157,51,206,120,59,103,108,186,200,232,228,128,102,
+  58,102,74,58,16,65,16,109,211,69,101,33,129,45,170,93,23,108,17,210,133,90,212,34,250,11,2,105,85,102,19,66,
+  132,82,139,194,114,22,225,37,44,138,74,37,203,209,105,200,60,115,142,142,206,215,102,144,2,187,64,208,11,239,230,247,
+  240,91,189,239,3,252,135,161,0,220,191,224,30,241,15,34,203,173,3,192,206,113,5,128,55,151,67,88,67,36,30,143,
+  238,82,20,197,87,84,84,92,29,137,212,118,204,37,147,143,100,89,6,33,196,160,148,110,240,251,253,129,186,186,72,199,
+  236,108,226,9,249,209,12,133,66,50,231,220,107,89,214,250,96,121,105,155,198,180,14,0,153,145,225,177,45,182,109,123,
+  40,165,82,56,188,121,191,166,107,199,8,33,43,175,199,223,148,83,0,136,70,163,180,185,57,234,181,109,39,236,55,205,
+  3,117,219,106,251,182,215,215,183,223,143,245,185,37,89,146,40,165,222,138,138,242,29,13,13,245,177,202,234,170,163,189,
+  119,239,185,4,65,16,12,191,9,177,181,165,213,55,58,54,186,33,176,49,16,138,238,108,58,83,224,203,47,237,234,58,
+  239,243,120,60,132,103,57,152,202,196,166,230,198,27,76,211,106,46,95,186,194,124,249,249,132,103,57,84,85,133,40,200,
+  16,13,191,225,42,44,246,157,211,116,125,215,169,147,167,89,158,199,43,58,75,54,172,133,5,168,42,131,174,107,66,87,
+  215,133,198,194,130,2,209,89,114,86,57,211,24,10,124,110,80,211,48,225,86,93,94,213,237,146,102,18,51,220,118,210,
+  176,172,111,248,242,53,9,66,0,93,215,179,51,137,207,220,89,180,145,78,91,72,229,56,83,85,24,166,9,106,154,230,
+  76,184,162,170,197,178,210,157,61,119,110,191,127,216,255,96,222,237,98,40,49,3,160,84,128,172,72,188,183,183,231,109,
+  119,247,77,91,150,148,85,238,102,110,24,134,1,33,22,139,241,88,44,102,119,118,158,29,46,49,215,221,26,123,57,42,
+  189,26,31,171,20,37,145,23,23,27,210,80,252,121,166,166,58,18,89,90,201,188,27,124,246,180,105,110,118,150,6,131,
+  101,226,208,208,224,114,89,48,116,253,167,51,198,227,113,2,112,150,78,219,133,47,70,226,23,53,198,90,178,28,153,173,
+  149,181,65,14,80,107,121,65,73,37,146,199,83,169,228,137,169,169,143,124,207,238,189,165,100,173,23,156,156,156,164,224,
+  60,239,195,244,196,166,199,253,253,87,15,31,58,178,143,3,243,4,156,241,44,212,233,79,19,102,255,192,192,181,182,182,
+  246,131,228,119,37,112,22,23,101,2,238,5,144,81,20,87,10,0,108,219,17,0,104,0,87,255,186,77,156,115,101,13,
+  70,56,231,250,63,87,245,59,186,53,233,69,8,225,63,138,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Rewind2x[1074] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,3,233,73,68,65,84,88,133,237,148,93,76,91,
+  85,0,199,255,247,156,123,123,111,91,164,20,74,91,109,49,41,108,56,148,143,66,8,48,16,113,217,226,150,24,31,48,
+  225,73,33,60,104,76,124,80,48,243,97,70,93,140,79,62,66,231,147,47,60,227,18,19,147,37,4,199,116,33,194,144,
+  33,88,58,176,161,82,74,111,219,89,90,232,101,10,133,222,15,31,6,200,130,5,38,139,47,246,151,220,151,155,223,57,
+  231,119,238,199,1,114,228,200,241,127,135,254,203,113,44,0,43,0,11,0,6,64,250,9,251,89,97,0,152,243,204,121,
+  149,109,47,183,126,245,202,197,243,26,128,210,147,248,228,49,22,215,3,120,182,190,190,246,245,182,150,150,155,93,93,93,
+  157,59,247,179,61,197,125,126,235,119,221,221,221,111,30,225,103,133,2,176,185,92,174,151,46,94,186,112,235,131,15,123,
+  254,148,164,148,166,105,154,246,234,107,151,182,1,148,157,196,103,143,88,220,196,243,188,189,241,108,195,91,197,150,162,119,
+  175,92,249,136,119,215,212,209,244,214,38,84,85,125,18,126,214,0,1,64,177,219,93,213,250,140,195,241,69,123,123,187,
+  165,171,179,91,80,53,5,235,127,72,0,52,232,5,195,73,252,172,1,4,64,145,195,225,40,171,170,126,254,19,151,203,
+  117,238,234,213,207,244,69,69,22,108,109,165,161,40,50,8,33,96,192,236,31,195,56,28,14,247,99,248,89,3,56,139,
+  197,226,170,169,169,122,163,192,108,186,220,211,211,203,55,159,125,145,102,228,12,54,211,155,0,52,48,204,238,55,171,1,
+  0,40,75,153,115,231,219,58,139,10,205,151,223,123,191,151,111,110,106,161,155,233,13,172,165,86,161,65,5,52,6,154,
+  166,1,12,144,103,124,10,188,78,7,65,16,180,116,58,125,48,192,100,50,229,53,55,55,116,10,122,225,227,254,254,47,
+  97,179,218,145,88,91,65,38,147,1,37,4,12,67,192,48,12,24,6,192,206,142,4,29,207,234,139,133,79,251,250,174,
+  61,244,87,227,200,200,242,223,62,121,212,55,24,13,12,207,243,216,31,176,247,75,84,86,86,42,201,228,218,226,211,118,
+  91,106,252,206,88,131,205,102,35,101,174,50,66,8,133,170,170,96,89,118,231,226,192,178,28,116,156,14,55,71,134,229,
+  109,69,254,124,226,206,120,131,245,24,254,240,240,144,34,138,81,143,36,73,169,3,1,177,88,76,141,199,227,146,78,39,
+  204,110,111,109,126,43,70,194,78,159,207,235,116,87,215,114,5,38,51,52,104,160,132,128,163,15,39,166,132,226,251,219,
+  35,202,196,216,221,183,101,121,235,107,49,18,113,250,238,121,157,238,106,119,86,255,135,219,183,212,224,98,232,90,50,153,
+  60,24,176,251,114,99,177,216,70,121,249,153,68,112,49,52,194,177,220,140,119,118,186,81,150,101,190,252,212,115,44,165,
+  236,222,196,132,16,252,56,54,170,138,225,104,127,36,18,11,72,169,245,17,74,152,25,223,61,111,163,44,103,248,211,255,
+  228,143,143,170,209,200,125,143,40,138,89,3,0,0,129,64,64,17,69,241,129,211,89,18,74,172,196,174,103,228,173,204,
+  244,47,63,215,57,157,37,164,176,176,144,40,170,2,74,40,126,154,156,80,195,203,98,255,212,212,84,82,20,197,7,6,
+  131,49,180,154,252,253,186,172,42,25,239,236,116,157,211,81,66,204,251,252,201,201,9,117,57,36,246,7,131,65,233,208,
+  128,93,252,126,255,118,85,85,237,250,82,48,60,195,82,114,35,26,19,75,35,145,176,173,252,244,25,142,227,56,76,79,
+  79,170,75,75,97,207,194,194,130,4,0,225,112,120,187,182,182,126,61,180,20,158,161,68,119,35,118,127,185,52,18,141,
+  216,202,79,237,248,51,119,213,95,231,23,60,199,14,0,128,185,185,57,45,16,8,108,84,84,188,176,178,28,18,135,12,
+  122,222,239,15,204,55,169,138,202,174,36,227,124,44,26,239,243,249,124,169,131,126,197,74,40,36,14,233,5,157,127,225,
+  183,249,38,69,86,216,68,34,206,199,227,201,71,252,163,142,226,61,6,6,6,210,0,98,249,249,249,223,88,173,214,113,
+  142,247,246,26,141,198,119,244,122,189,114,148,95,144,144,198,89,150,235,53,230,29,244,179,31,81,135,48,56,56,72,71,
+  71,71,11,21,69,17,40,165,146,199,227,89,63,204,239,232,232,160,118,187,253,216,126,142,28,57,254,83,254,2,73,119,
+  244,97,100,22,31,73,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Skip1x[782] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,12,6,17,39,8,167,70,102,241,0,0,2,155,73,
+  68,65,84,56,203,189,147,59,76,19,113,28,199,191,255,123,244,238,218,43,82,192,222,181,64,33,62,18,104,4,68,211,
+  68,133,193,129,81,6,28,28,25,157,92,140,38,74,84,210,85,33,44,190,66,28,12,218,184,24,37,6,69,67,116,84,
+  112,144,71,124,64,76,120,212,96,160,143,163,244,122,215,235,113,45,127,23,32,81,97,51,126,167,95,62,223,228,51,125,
+  127,192,63,72,25,0,102,23,46,237,193,127,11,11,160,2,128,12,192,3,160,8,160,180,213,201,0,246,1,32,91,156,
+  238,42,240,120,220,222,246,246,182,30,199,113,82,133,66,65,230,121,158,147,36,201,113,9,2,215,214,118,170,183,88,44,
+  102,1,106,10,130,80,178,237,141,210,95,130,80,109,200,171,6,149,135,138,226,239,246,251,247,219,186,158,91,100,24,166,
+  92,150,101,82,93,19,28,84,20,127,119,69,165,207,109,26,249,21,85,85,139,85,85,85,142,166,105,59,34,182,49,28,
+  246,122,60,238,139,207,159,13,139,147,51,83,205,101,178,124,214,227,145,150,114,57,35,93,93,27,60,255,98,120,68,154,
+  155,251,22,22,68,225,28,207,242,122,42,173,25,45,45,45,118,125,125,221,70,60,30,167,164,171,171,43,224,18,184,133,
+  216,227,39,34,97,8,50,107,107,180,231,218,85,211,52,140,41,128,156,120,52,20,227,9,67,160,235,58,141,70,123,51,
+  90,102,109,49,153,76,221,92,142,47,127,111,58,210,244,131,11,168,42,10,142,5,0,48,13,3,130,36,144,123,119,238,
+  203,105,77,59,25,141,222,96,182,57,199,179,164,191,111,160,34,171,175,151,245,245,223,122,112,248,224,129,119,44,235,186,
+  192,41,170,138,180,150,0,33,64,38,171,65,20,37,128,82,36,146,171,212,235,245,110,18,2,102,45,171,65,20,4,208,
+  77,138,68,50,65,221,146,200,151,74,78,121,69,185,31,156,162,40,48,11,58,24,134,69,80,173,129,97,26,136,197,134,
+  172,68,50,181,228,18,248,67,219,220,178,242,24,123,251,70,159,253,58,187,106,154,249,187,141,13,77,49,2,178,206,169,
+  170,138,68,234,39,156,162,131,209,209,17,123,97,105,62,239,243,85,94,57,222,90,255,114,230,243,212,130,83,116,248,233,
+  153,79,214,196,248,7,91,207,153,131,199,142,70,6,40,161,122,231,153,206,2,0,144,137,241,241,192,235,177,87,139,181,
+  181,213,196,231,171,188,237,243,87,222,241,112,178,77,128,205,233,47,147,243,12,1,111,152,230,211,214,230,200,117,183,91,
+  74,3,196,140,68,34,59,163,226,148,128,10,150,97,222,135,27,194,151,130,129,186,85,194,32,79,65,76,2,148,173,142,
+  173,124,60,221,209,113,185,62,88,183,4,66,178,161,80,104,243,207,33,17,203,178,2,91,103,30,128,33,73,98,9,0,
+  108,187,224,3,192,83,144,117,81,16,54,246,124,6,74,169,151,82,74,118,225,2,254,71,126,1,54,156,22,72,126,132,
+  128,72,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Skip2x[1205] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,4,108,73,68,65,84,88,133,237,148,91,108,20,
+  85,24,199,255,103,46,59,187,59,179,179,179,51,238,178,203,46,119,234,75,129,181,152,96,140,73,11,65,10,137,23,192,
+  88,31,154,82,133,23,158,172,37,248,166,17,34,17,18,185,147,240,42,226,131,15,154,130,15,38,213,196,4,120,65,132,
+  64,107,140,6,148,118,139,41,88,218,238,236,110,187,219,185,207,241,97,105,173,101,219,194,155,137,253,39,147,124,201,249,
+  157,201,47,223,249,206,1,22,178,144,133,252,223,195,78,171,85,0,139,0,8,0,44,0,254,60,123,159,150,159,87,32,
+  221,188,117,115,223,226,76,154,41,232,133,1,219,182,221,71,63,158,45,79,203,207,43,160,173,90,189,242,221,61,187,247,
+  60,55,94,46,181,72,114,100,112,232,193,144,14,192,6,224,214,216,171,174,90,189,178,227,157,183,119,55,148,43,99,45,
+  81,69,25,44,232,5,221,117,221,217,248,185,5,100,89,86,51,75,210,29,71,63,61,206,111,105,110,150,239,229,114,219,
+  98,106,52,203,113,129,59,166,105,218,182,109,155,0,232,36,159,72,36,98,201,212,162,142,99,71,79,112,91,154,183,202,
+  185,254,190,109,178,28,201,134,66,225,59,12,195,88,229,114,217,154,206,207,43,144,72,36,98,241,184,214,177,171,173,29,
+  148,250,120,245,149,215,248,186,103,235,150,223,249,253,118,235,51,113,205,23,195,210,128,44,203,158,174,235,22,0,164,82,
+  41,53,166,42,51,248,213,203,127,187,253,107,107,84,145,125,53,166,221,147,101,217,205,231,243,246,19,9,44,91,182,44,
+  22,137,136,239,237,106,107,199,120,101,28,142,107,35,147,89,202,180,188,249,86,192,52,39,54,140,230,31,238,12,5,133,
+  190,88,76,43,105,154,102,201,178,44,135,66,66,109,222,48,94,24,26,190,191,83,12,135,251,83,169,116,73,150,101,107,
+  100,100,196,171,37,64,38,139,198,198,198,21,193,16,223,255,253,119,63,160,56,86,0,1,1,8,192,179,28,4,33,132,
+  135,195,67,56,112,224,35,115,232,225,95,221,166,227,28,98,60,166,8,226,61,198,115,44,135,224,12,222,3,14,5,217,
+  224,159,217,108,182,112,240,224,193,127,221,150,169,14,52,52,52,40,32,180,179,181,181,13,133,146,14,207,243,224,122,62,
+  92,215,129,105,25,144,164,8,118,108,127,131,91,156,206,212,253,242,115,111,27,97,73,145,16,108,110,109,109,131,101,91,
+  32,12,1,67,24,0,128,235,58,144,164,8,182,191,190,131,75,167,211,117,61,55,111,182,249,190,111,84,42,19,131,170,
+  170,150,7,6,6,166,36,152,201,66,81,20,72,146,8,0,224,88,30,44,203,129,99,25,16,194,128,82,160,60,81,70,
+  105,188,136,77,77,155,184,19,39,78,71,66,65,225,176,40,86,121,219,182,171,159,99,193,180,76,24,166,129,226,88,1,
+  165,241,34,54,54,109,226,78,158,60,19,9,8,220,97,223,183,90,214,174,93,27,158,222,1,110,178,208,52,141,22,138,
+  85,49,65,8,130,144,234,233,80,234,195,247,125,4,120,1,65,65,192,181,159,126,116,207,127,113,206,136,202,209,195,142,
+  235,28,153,159,191,234,126,126,254,156,17,83,98,159,68,163,218,151,225,112,120,162,166,64,60,30,167,182,83,93,11,6,
+  4,128,16,80,191,42,196,243,1,232,122,30,167,78,31,55,244,188,222,173,38,226,135,228,160,172,15,222,31,56,50,39,
+  127,234,152,161,235,122,119,34,149,250,88,141,168,247,58,59,59,75,132,16,90,83,32,18,137,80,241,209,17,176,28,7,
+  223,247,193,242,60,168,79,209,221,253,173,121,253,198,181,7,12,97,247,103,215,173,191,106,24,70,129,231,249,100,161,52,
+  50,59,127,253,218,3,158,103,247,103,215,61,127,213,48,140,194,222,189,123,157,125,251,246,97,102,166,4,162,209,40,213,
+  139,85,1,207,243,192,115,60,250,115,125,238,197,111,186,44,223,247,142,173,169,111,248,204,52,205,124,123,123,123,5,0,
+  186,186,186,232,228,12,252,195,223,117,47,92,236,178,40,245,143,174,89,211,112,110,58,63,91,166,4,84,85,197,200,104,
+  117,62,108,219,198,133,139,95,27,163,249,145,203,201,68,226,195,76,102,69,255,149,43,87,198,166,95,33,69,81,168,52,
+  109,8,187,46,124,101,228,243,163,151,151,164,23,127,144,76,46,205,205,228,231,21,80,20,133,138,146,136,91,61,55,140,
+  222,222,91,121,46,16,120,127,125,118,195,37,69,81,138,245,245,245,143,189,102,154,166,65,148,194,184,217,115,221,232,237,
+  185,149,23,2,161,253,47,189,216,116,73,16,132,82,45,254,73,4,124,81,20,209,159,251,227,76,83,227,203,103,43,149,
+  138,158,205,102,103,109,223,36,159,203,221,61,179,177,105,203,89,73,146,244,100,50,57,103,187,107,101,234,37,28,30,30,
+  150,40,165,98,32,16,176,20,69,25,35,132,204,217,62,74,169,84,169,84,68,199,113,158,136,95,200,66,22,242,159,205,
+  223,89,195,40,125,34,103,205,222,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Stop1x[429] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,12,6,17,40,46,242,211,255,195,0,0,1,58,73,
+  68,65,84,56,203,205,146,95,74,3,49,16,135,191,236,164,175,22,10,102,60,128,88,240,20,34,30,66,196,75,8,226,
+  137,68,188,130,136,215,16,84,4,69,41,138,62,172,44,180,187,221,221,196,135,253,171,173,138,79,26,8,204,100,50,95,
+  230,55,25,248,235,101,122,246,198,47,115,111,128,96,27,111,52,26,177,189,179,117,105,140,145,159,50,207,207,46,198,113,
+  28,155,15,0,117,142,193,96,96,78,142,79,191,77,222,219,223,245,170,74,28,199,0,68,77,96,213,41,34,213,227,183,
+  119,87,60,78,238,121,121,125,230,45,137,73,179,20,239,61,0,214,90,156,106,11,108,1,170,29,64,196,214,91,144,72,
+  48,192,60,207,234,152,160,206,45,2,156,186,22,16,69,2,6,124,8,20,101,65,154,165,204,102,211,10,96,5,183,12,
+  176,214,171,32,4,79,89,150,20,197,156,44,75,153,165,83,166,105,5,176,34,104,79,130,237,122,224,152,60,61,0,80,
+  150,37,222,123,202,162,226,251,26,216,200,115,234,22,1,234,58,9,121,158,19,8,24,32,16,240,222,183,77,20,43,168,
+  91,82,129,246,122,48,94,223,252,242,27,165,147,16,62,85,160,136,72,56,60,58,248,118,14,36,138,34,231,58,64,59,
+  202,73,146,212,163,28,170,227,80,217,193,84,66,42,191,185,17,24,174,12,175,249,23,235,29,41,108,117,184,218,69,135,
+  206,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Stop2x[571] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,1,242,73,68,65,84,88,133,237,150,237,138,211,
+  64,20,134,159,164,73,219,147,4,178,161,13,177,139,127,189,34,191,240,230,68,20,5,65,111,200,11,88,100,23,132,237,
+  226,7,221,204,121,253,145,182,219,162,219,70,3,254,177,47,12,153,33,115,230,125,50,231,204,16,56,233,164,147,254,119,
+  69,61,230,156,3,249,0,143,175,192,197,125,47,147,30,11,100,79,158,63,254,148,36,201,234,79,157,219,182,29,127,120,
+  255,241,209,161,57,71,1,202,178,20,192,219,215,239,198,238,142,187,247,50,79,211,148,103,47,158,82,150,165,174,175,175,
+  135,3,72,226,242,234,51,174,126,0,231,15,30,110,227,15,1,196,199,22,58,59,59,19,64,240,128,203,145,247,108,107,
+  208,77,252,95,3,204,231,115,135,110,7,254,68,190,158,191,137,191,79,71,83,48,155,205,36,28,73,196,81,140,239,34,
+  107,191,115,55,212,182,86,102,179,217,65,242,163,0,69,81,232,230,219,18,36,226,56,38,210,254,201,213,198,118,199,166,
+  13,45,90,3,20,69,49,12,160,174,107,253,184,248,14,192,104,52,218,166,66,18,33,180,4,119,66,104,105,67,192,67,
+  75,27,156,8,193,188,33,77,83,234,186,30,6,144,101,153,155,25,238,226,182,109,9,161,69,193,9,10,91,16,232,110,
+  180,81,60,34,142,59,72,73,152,25,89,150,13,171,129,197,98,161,171,47,151,68,113,68,68,87,7,36,17,177,70,221,
+  246,171,75,130,180,233,119,230,162,3,88,44,22,195,118,160,170,42,153,77,137,34,72,146,49,146,175,191,16,216,152,233,
+  206,116,211,71,96,54,165,170,170,97,0,101,89,186,153,17,17,147,38,41,238,190,99,228,251,0,59,13,192,204,152,76,
+  38,195,0,204,76,102,70,20,65,28,119,103,80,18,142,211,93,35,90,183,253,84,111,106,160,170,170,97,53,208,52,141,
+  204,12,73,140,39,147,109,206,127,247,132,245,177,20,184,28,51,163,105,154,97,59,144,231,185,204,166,188,122,243,242,216,
+  212,95,100,54,37,207,243,131,0,71,255,7,36,21,192,184,175,233,114,185,220,27,175,86,171,219,186,174,111,250,198,159,
+  116,210,73,255,92,63,1,150,249,59,58,96,29,111,5,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+}
+namespace Place {
+const unsigned char Bookmarks1x[753] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,10,6,3,42,40,185,100,186,202,0,0,0,53,116,
+  69,88,116,67,111,109,109,101,110,116,0,40,99,41,32,50,48,48,52,32,74,97,107,117,98,32,83,116,101,105,110,101,
+  114,10,10,67,114,101,97,116,101,100,32,119,105,116,104,32,84,104,101,32,71,73,77,80,144,217,139,111,0,0,2,61,
+  73,68,65,84,56,203,149,147,77,79,83,65,20,134,159,153,222,185,247,246,131,182,96,63,80,106,20,98,76,140,49,38,
+  198,104,252,13,154,96,220,152,16,226,194,133,127,193,164,11,8,44,76,252,31,132,61,145,159,96,226,194,132,13,10,6,
+  48,86,180,84,161,32,45,183,237,237,237,244,142,139,98,161,194,66,79,50,155,153,57,207,188,239,57,103,4,192,84,113,
+  97,14,152,225,223,99,126,241,213,244,44,128,152,42,46,204,141,72,61,243,226,249,67,60,95,227,181,58,4,90,83,243,
+  218,0,72,41,0,16,199,153,13,63,160,94,89,230,217,189,34,169,236,228,75,11,152,121,252,232,65,24,134,70,118,131,
+  14,217,84,140,141,242,62,141,202,1,67,229,61,84,171,77,168,34,120,163,25,90,153,20,249,145,56,117,32,149,157,164,
+  182,183,244,218,2,112,28,71,26,224,224,208,35,26,115,161,222,36,93,170,80,187,50,74,144,136,97,249,109,82,165,10,
+  93,21,129,145,56,49,39,232,123,177,0,92,87,1,134,150,223,59,144,95,42,212,199,178,68,130,14,185,213,45,140,16,
+  252,186,86,32,249,109,23,198,243,68,237,206,32,192,118,108,194,110,216,223,20,135,30,237,66,142,204,90,137,122,33,71,
+  226,199,62,218,181,81,77,31,128,119,159,124,58,106,131,143,43,49,36,128,173,20,230,84,161,8,13,70,8,164,238,98,
+  34,17,16,2,231,168,137,142,218,103,218,33,1,132,16,128,57,33,196,93,84,195,199,31,30,234,189,110,43,146,219,63,
+  169,95,206,247,248,36,6,45,156,68,143,16,142,143,146,220,44,83,187,122,17,29,117,64,136,129,91,110,73,241,100,17,
+  110,175,55,123,0,131,1,3,185,11,41,0,76,54,77,189,173,73,126,223,69,53,90,116,109,69,245,230,196,185,19,213,
+  83,96,64,41,139,116,58,129,223,209,228,135,227,36,163,14,92,31,235,235,74,13,104,252,11,224,53,90,188,89,126,139,
+  37,13,161,233,45,173,13,66,10,108,21,65,8,129,0,186,221,144,175,229,106,152,111,30,201,207,235,235,0,79,45,128,
+  15,171,91,220,191,17,239,143,237,121,33,165,164,41,210,108,236,7,114,123,252,22,119,143,197,88,0,135,94,131,137,220,
+  16,133,194,165,51,137,226,84,1,215,54,119,206,173,193,252,251,205,234,140,110,53,195,157,106,32,93,87,161,59,122,192,
+  240,31,132,238,134,76,222,201,152,165,149,170,56,221,55,57,85,92,152,253,207,239,204,226,171,105,1,240,27,115,187,219,
+  217,106,190,108,255,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Bookmarks2x[1738] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,6,129,73,68,65,84,88,133,197,151,203,143,28,
+  71,29,199,63,85,213,207,233,158,158,217,151,189,94,219,89,155,216,150,136,108,68,162,24,34,19,17,46,4,5,14,60,
+  2,66,112,201,95,128,224,66,46,8,65,14,17,28,130,16,7,56,32,164,32,71,2,9,68,16,10,132,40,18,92,64,
+  66,138,80,132,18,136,108,130,223,143,221,181,119,103,119,231,61,253,168,31,135,153,157,157,217,25,39,75,114,224,39,181,
+  90,93,213,85,245,249,125,235,215,191,250,53,252,159,77,237,109,56,251,248,183,142,58,70,126,99,145,7,0,253,206,195,
+  197,19,193,236,103,33,163,213,175,254,246,242,247,190,188,183,221,153,104,112,249,233,39,30,123,232,225,207,125,230,17,149,
+  91,33,45,132,78,47,167,211,203,17,17,180,86,104,165,238,121,55,122,178,173,215,233,242,157,103,127,254,169,105,96,19,
+  0,86,236,199,62,253,248,89,101,92,67,237,206,58,185,41,209,104,167,52,218,41,121,97,247,227,236,132,157,60,92,101,
+  182,90,170,252,245,188,90,209,34,15,159,123,138,91,59,125,19,18,139,72,84,41,135,3,111,223,101,7,246,105,86,160,
+  58,19,19,206,63,56,111,133,175,140,246,141,41,112,226,137,175,249,10,196,117,93,122,89,222,7,144,201,9,117,86,16,
+  110,110,227,54,58,152,60,71,180,162,240,61,186,213,50,189,114,52,17,89,89,97,89,156,139,105,171,101,199,113,94,63,
+  125,79,128,5,235,68,174,239,101,90,43,99,119,20,40,70,223,16,226,149,26,209,157,13,178,40,164,87,46,209,245,61,
+  148,21,220,78,151,202,181,21,242,208,103,123,249,16,133,187,59,117,158,91,42,213,132,118,90,37,129,15,222,19,32,45,
+  188,56,41,249,86,13,60,24,3,16,168,94,89,193,233,165,212,78,45,147,133,254,152,151,29,18,154,139,243,36,215,87,
+  169,94,186,73,237,228,125,136,233,111,97,154,23,84,42,49,219,173,10,101,203,241,49,53,71,31,148,54,73,88,242,11,
+  80,32,130,54,187,95,88,233,246,93,76,47,101,227,212,125,131,197,5,211,77,241,154,29,176,130,42,44,88,97,235,216,
+  33,80,138,120,173,182,171,64,97,137,162,50,191,254,243,235,188,120,57,90,248,230,51,209,115,83,1,28,71,162,82,224,
+  1,253,192,25,6,97,47,163,116,167,198,246,241,37,68,107,116,94,48,251,246,13,230,47,92,161,122,229,22,7,222,186,
+  68,114,99,149,228,230,26,40,69,115,113,142,160,182,61,156,55,203,45,113,185,196,125,71,63,201,147,95,248,54,69,33,
+  223,152,10,96,69,162,48,244,135,33,164,6,123,97,214,106,244,146,152,220,239,195,37,55,215,80,2,119,79,159,224,206,
+  153,19,212,143,28,36,220,108,96,157,190,98,89,41,192,100,57,58,235,239,95,86,88,226,40,224,218,173,107,104,165,8,
+  195,114,250,244,119,75,75,19,0,130,68,81,20,14,219,204,96,11,116,189,69,158,68,59,148,4,91,77,26,135,230,135,
+  11,118,171,101,138,192,27,238,185,232,129,15,131,91,158,91,74,97,64,187,29,144,102,117,226,120,54,203,145,99,19,0,
+  202,82,142,194,160,63,76,4,181,51,67,47,27,70,181,201,114,16,161,8,220,209,161,136,82,216,1,176,215,234,82,184,
+  238,16,208,138,160,140,70,108,76,154,55,73,146,121,35,133,62,6,123,51,161,162,92,42,5,67,40,53,240,72,105,141,
+  178,253,44,216,159,84,225,116,82,10,183,15,225,244,82,76,183,135,56,6,172,16,175,110,208,94,168,140,77,109,69,97,
+  36,162,242,145,239,243,81,69,244,96,108,126,240,36,188,180,39,21,235,200,247,29,179,147,125,118,20,176,113,136,211,236,
+  64,37,70,140,166,51,91,166,114,125,133,214,129,89,0,74,235,91,160,53,94,163,77,120,119,147,34,240,105,29,152,27,
+  155,57,47,44,179,115,85,150,159,251,33,177,171,185,241,147,31,87,26,23,255,253,196,120,12,136,68,190,239,58,34,96,
+  173,69,6,89,176,56,80,37,88,223,66,103,57,0,245,163,139,180,230,103,240,235,109,156,118,151,237,229,37,186,73,132,
+  40,69,115,105,97,240,41,142,187,150,229,150,131,115,101,86,206,255,130,252,141,55,40,45,31,115,5,142,143,41,96,148,
+  170,134,129,135,136,80,20,57,198,237,71,189,84,98,210,74,196,204,149,219,212,238,63,130,24,77,107,113,142,214,200,216,
+  52,90,66,89,217,13,192,61,150,21,5,179,51,101,106,38,228,88,179,137,59,51,227,24,173,79,140,159,54,90,205,6,
+  59,121,192,22,67,5,0,154,203,75,136,130,185,139,87,9,54,235,195,152,0,48,105,70,188,186,193,194,191,254,131,73,
+  211,169,0,105,110,169,84,43,108,25,15,154,77,156,106,21,148,58,185,55,8,43,65,208,79,177,69,94,96,71,8,196,
+  209,212,78,28,165,180,190,77,188,178,78,229,218,10,214,113,80,34,232,194,210,75,34,54,63,112,132,194,243,166,2,228,
+  185,37,78,34,54,76,128,180,154,56,73,130,192,145,49,0,133,148,131,192,67,0,43,118,76,129,254,11,138,246,66,149,
+  246,66,21,147,102,152,52,71,140,38,247,189,123,74,191,171,64,65,57,137,185,224,132,72,115,21,103,102,6,172,61,184,
+  231,43,80,137,231,57,136,8,98,5,153,118,22,15,172,240,92,10,207,189,103,255,94,203,114,75,84,13,216,56,117,6,
+  255,195,143,14,156,148,104,28,64,36,14,2,23,100,16,3,22,148,234,95,90,245,203,43,59,33,203,254,44,205,11,226,
+  146,207,213,183,175,240,207,231,159,71,131,213,198,188,48,10,160,173,80,246,93,23,199,209,28,62,124,152,78,154,99,197,
+  195,104,141,239,246,149,49,90,97,180,70,107,118,235,190,105,117,225,224,217,138,96,148,66,27,141,163,21,183,42,139,183,
+  207,246,107,130,58,69,49,150,9,67,144,82,16,248,172,111,108,243,251,87,94,99,107,179,142,239,42,92,199,96,222,99,
+  121,22,149,60,80,176,182,222,166,222,232,32,194,12,16,1,29,32,27,5,240,5,2,165,224,133,95,254,137,251,143,36,
+  124,246,177,51,168,119,142,173,125,217,43,127,185,68,109,171,197,229,171,183,10,107,37,4,2,192,31,5,80,128,163,4,
+  111,245,206,38,245,122,155,115,15,157,198,117,39,138,230,161,169,119,33,219,233,223,110,244,184,120,121,3,0,173,117,239,
+  246,213,215,158,6,220,193,53,126,24,137,194,116,58,253,68,226,7,49,115,179,209,251,90,28,160,20,101,24,173,41,172,
+  197,113,180,114,189,120,231,144,144,81,0,1,10,69,113,161,209,104,63,80,46,135,252,246,213,55,249,234,231,31,97,126,
+  166,188,239,133,61,207,193,117,38,127,148,158,250,210,163,188,248,199,191,179,182,238,57,126,144,84,233,87,154,233,40,0,
+  64,122,247,230,91,95,255,217,249,240,119,31,63,247,161,240,250,141,53,245,236,143,94,154,190,146,244,19,213,255,106,70,
+  105,215,113,131,8,232,2,189,189,0,157,203,111,254,225,31,10,251,197,87,155,237,103,148,113,206,72,63,88,38,77,97,
+  17,178,233,93,147,9,116,164,175,213,109,111,188,12,212,25,212,219,123,53,245,129,24,8,153,242,219,246,62,76,6,11,
+  22,64,107,0,176,3,53,97,102,0,50,253,84,121,239,0,217,200,53,180,255,2,66,219,159,254,45,72,108,79,0,0,
+  0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Desktop1x[722] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,2,23,0,42,10,182,151,62,76,0,0,2,95,73,
+  68,65,84,56,203,165,147,93,76,207,81,24,199,63,231,247,79,180,48,179,24,27,235,154,102,46,136,205,172,197,52,46,
+  112,161,194,13,174,72,102,140,214,100,105,11,115,229,109,35,204,186,112,41,11,139,27,47,155,41,169,141,44,111,49,47,
+  75,72,249,139,213,164,214,239,229,156,231,113,81,254,254,255,113,97,115,110,206,246,61,223,231,57,159,243,221,115,204,162,
+  101,197,84,87,149,51,240,125,8,128,246,246,118,94,63,171,227,111,107,199,238,179,188,121,215,3,64,247,135,78,154,239,
+  63,192,44,204,91,87,239,197,98,69,201,198,135,119,235,99,207,59,26,5,64,84,177,97,200,246,178,218,67,198,152,170,
+  100,159,170,222,51,139,150,21,235,191,16,244,13,206,166,186,106,255,31,4,105,0,111,222,245,208,210,246,130,129,175,189,
+  184,225,247,156,58,126,44,81,248,139,64,129,178,202,163,108,43,41,165,225,102,43,3,95,123,1,70,27,0,163,66,24,
+  167,114,95,49,95,250,186,82,110,247,253,17,172,141,216,185,117,49,53,231,207,49,61,123,126,226,204,251,133,67,24,167,
+  98,239,154,148,66,21,193,218,8,99,60,98,177,52,198,165,167,179,107,251,18,250,62,60,77,120,98,51,179,231,204,253,
+  220,211,153,115,160,124,19,198,132,191,209,69,80,21,84,65,85,176,206,34,206,33,78,200,156,48,204,203,87,189,136,198,
+  14,123,143,154,174,108,152,58,49,78,86,214,20,0,156,115,88,107,113,206,34,162,168,42,65,24,160,162,88,107,241,131,
+  17,188,152,146,53,169,151,182,198,203,7,19,25,8,58,214,192,162,40,6,16,129,48,244,113,206,33,170,132,81,136,136,
+  36,191,210,75,203,205,47,186,248,237,71,72,198,248,76,6,198,8,140,49,40,6,107,35,48,6,85,37,138,2,212,9,
+  34,14,128,254,161,25,228,230,23,174,242,140,49,27,243,150,175,165,116,207,73,84,21,17,71,24,133,248,254,8,65,224,
+  19,4,62,97,20,224,156,224,156,195,57,199,195,39,131,108,44,94,143,49,222,117,15,160,171,59,206,226,165,43,57,81,
+  115,11,39,163,70,113,14,17,193,217,209,93,196,225,196,113,237,198,123,118,148,150,209,252,248,99,234,28,116,117,199,153,
+  183,160,128,51,181,119,88,189,98,22,126,56,12,40,145,181,140,197,67,75,219,32,155,183,148,112,225,210,237,68,8,105,
+  201,137,116,117,199,153,144,145,73,221,181,183,76,155,252,41,101,38,134,252,41,172,40,40,162,225,102,107,138,110,114,243,
+  11,59,140,241,114,146,69,17,119,228,81,211,213,211,64,255,152,52,46,55,191,168,226,111,159,137,255,93,63,1,185,254,
+  98,48,219,255,91,223,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Desktop2x[910] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,3,69,73,68,65,84,88,133,237,85,75,79,19,
+  81,20,254,102,58,116,74,41,24,10,82,84,80,1,41,4,161,104,162,193,104,120,5,53,105,226,35,16,27,227,35,42,
+  38,234,194,168,113,235,198,31,225,90,99,220,184,208,68,141,6,13,137,10,65,23,154,168,173,79,52,241,133,198,71,113,
+  164,5,218,153,78,103,206,117,49,83,168,48,96,69,118,246,75,78,230,158,115,231,158,243,157,115,239,61,23,200,34,139,
+  44,254,119,112,86,70,175,183,189,177,168,120,65,48,215,229,26,27,141,140,67,86,19,47,95,4,111,174,203,212,105,195,
+  42,255,30,151,203,121,46,169,105,9,37,174,216,193,217,174,61,15,245,236,180,250,87,176,50,138,174,188,67,171,55,110,
+  197,215,17,57,63,250,184,31,14,38,55,181,181,181,177,76,9,36,212,4,132,156,2,212,172,109,182,107,206,133,8,221,
+  188,216,2,35,217,105,62,44,43,176,190,37,32,229,22,122,220,44,46,161,123,255,38,212,214,46,3,3,3,99,12,96,
+  198,151,24,126,211,25,12,157,116,29,74,66,69,108,76,198,229,43,247,17,29,211,17,143,171,218,151,143,159,54,188,121,
+  115,231,97,70,21,136,72,63,221,43,42,75,176,247,88,39,136,52,252,144,190,25,65,166,8,81,106,76,48,184,144,169,
+  27,227,237,219,124,120,255,33,140,11,231,251,5,81,68,177,85,172,105,4,2,129,128,45,60,28,141,117,31,240,231,201,
+  74,196,50,176,53,9,107,41,91,82,4,111,181,91,137,70,35,21,86,4,248,169,134,112,56,220,82,223,80,69,188,77,
+  7,17,65,215,245,127,18,34,29,77,235,106,28,162,200,31,207,136,128,195,97,223,215,180,118,181,107,124,124,212,116,66,
+  179,72,102,36,75,60,133,0,176,184,163,163,195,55,43,129,64,32,96,3,184,174,37,229,165,156,170,170,19,25,204,236,
+  60,157,196,108,36,25,170,189,75,29,28,135,163,179,18,144,36,169,181,170,170,130,35,74,78,43,227,220,183,193,32,177,
+  188,162,76,32,98,187,253,126,191,56,35,1,187,93,216,183,102,77,163,107,116,52,98,153,201,244,113,230,36,69,81,64,
+  161,59,159,100,89,238,76,143,105,75,13,234,124,155,79,71,34,218,137,7,15,95,115,117,117,139,33,138,2,136,104,66,
+  140,19,159,210,89,218,119,82,82,183,226,247,121,99,77,60,158,192,192,192,144,168,40,98,87,209,194,202,178,225,240,219,
+  235,128,217,136,86,174,12,216,69,167,60,210,218,181,203,249,244,209,19,36,165,119,56,216,221,10,158,199,95,95,59,171,
+  121,34,134,158,158,23,240,84,212,131,92,139,16,234,189,36,51,141,149,15,14,222,150,120,0,208,245,31,91,106,26,234,
+  237,195,49,192,227,93,5,93,40,64,111,239,51,203,114,255,233,212,91,109,69,48,248,9,5,238,69,176,149,84,131,119,
+  228,193,93,86,153,67,164,30,6,204,70,196,9,182,147,165,229,203,132,239,177,8,100,69,67,97,101,61,30,245,223,128,
+  207,87,10,142,99,208,117,29,201,164,54,153,85,42,75,152,237,151,116,179,251,165,90,179,217,21,205,249,80,240,51,154,
+  119,236,199,136,108,60,5,197,203,107,133,159,159,223,29,1,112,198,236,132,172,250,249,171,65,240,57,134,170,200,9,0,
+  192,173,158,123,83,111,205,156,160,233,60,134,191,124,68,52,174,2,28,7,128,3,35,242,76,84,128,17,157,29,122,26,
+  58,53,117,97,95,95,95,251,124,16,240,214,180,93,13,221,237,93,144,110,99,28,174,2,136,165,191,134,28,128,60,0,
+  78,0,14,164,221,144,121,130,6,128,0,200,0,198,1,168,243,236,63,139,44,178,152,27,126,1,33,210,84,125,239,90,
+  212,11,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Home1x[679] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,2,36,73,68,65,84,56,141,165,146,77,107,83,65,20,134,159,51,115,
+  107,211,196,170,88,48,196,66,193,69,237,34,27,161,226,162,123,201,170,139,32,116,235,47,208,189,208,63,224,198,93,221,
+  250,55,68,20,226,78,40,24,237,198,34,149,86,41,77,73,168,54,183,105,155,59,51,119,142,139,124,180,129,226,198,179,
+  25,230,204,57,207,249,120,71,106,181,26,255,99,201,242,242,242,27,85,93,189,226,237,76,85,159,52,155,205,205,127,2,
+  98,140,245,122,189,126,51,198,72,140,17,85,5,224,248,248,120,174,209,104,108,84,171,213,231,163,96,239,61,198,152,252,
+  224,224,224,115,154,166,57,64,226,189,215,16,2,157,78,135,60,207,199,16,99,12,149,74,165,10,188,27,65,1,122,189,
+  94,146,231,249,171,52,77,215,47,1,60,33,4,98,140,19,144,114,185,92,44,20,10,20,139,69,172,181,24,99,104,181,
+  90,180,219,237,197,241,8,33,132,24,66,206,198,71,199,105,118,81,9,4,0,165,15,244,199,94,85,3,172,172,177,176,
+  178,102,173,249,153,120,239,213,57,71,47,83,94,62,123,140,200,48,240,242,166,116,226,6,128,11,202,250,235,15,11,137,
+  115,46,134,16,0,197,26,248,178,219,189,220,192,232,152,220,188,21,238,149,75,32,170,73,8,1,239,61,34,130,53,130,
+  181,23,41,215,11,9,143,22,111,147,24,225,211,247,223,164,231,126,160,70,136,104,84,4,209,196,123,31,189,247,160,138,
+  17,97,202,10,198,8,247,43,215,89,186,59,139,53,3,96,237,65,153,111,251,41,95,247,186,184,160,152,129,127,0,8,
+  97,208,65,223,229,220,185,49,205,210,252,44,51,215,44,103,46,31,143,175,170,204,207,205,112,171,52,197,214,94,151,204,
+  197,49,64,67,200,17,73,232,164,25,219,251,39,108,238,252,97,245,97,101,84,101,176,11,129,204,71,222,54,15,177,70,
+  88,152,155,25,0,66,8,209,57,7,106,217,105,157,112,212,203,80,224,168,231,198,138,140,150,233,66,36,61,247,88,35,
+  28,118,135,35,136,72,140,49,34,34,100,62,82,156,78,0,232,251,124,152,120,65,201,163,82,154,78,16,17,206,92,0,
+  200,19,85,101,247,40,34,2,91,63,90,227,224,237,189,195,73,9,135,237,140,190,245,233,105,31,129,205,36,78,149,26,
+  239,119,103,159,130,178,255,171,125,133,234,87,155,8,109,17,243,226,47,238,171,54,255,32,151,176,79,0,0,0,0,73,
+  69,78,68,174,66,96,130,
+};
+const unsigned char Home2x[1416] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,5,5,73,68,65,84,88,133,237,151,207,139,91,215,21,128,191,115,223,
+  147,158,52,146,70,154,25,234,177,211,144,12,198,208,89,180,13,133,150,226,16,156,77,65,43,47,186,14,100,209,108,179,
+  235,31,16,232,31,144,101,41,116,85,186,109,119,165,32,156,236,10,83,55,77,194,20,10,110,51,206,216,99,108,50,30,
+  73,35,61,73,239,215,125,247,222,46,36,189,145,44,141,13,169,193,93,244,192,69,239,157,123,222,57,223,61,231,220,251,
+  244,164,221,110,243,42,69,189,210,232,255,11,0,62,192,205,155,55,253,44,203,62,53,198,188,253,162,7,68,36,183,214,
+  254,242,240,240,240,215,47,13,32,73,146,189,74,165,242,227,219,183,111,251,113,28,227,156,3,192,90,11,80,220,207,174,
+  253,59,119,238,124,188,191,191,255,199,123,247,238,157,190,20,128,44,203,210,106,181,234,158,60,121,66,183,219,197,57,183,
+  118,0,136,8,187,187,187,249,241,241,241,123,192,199,47,5,64,107,157,164,105,42,219,219,91,24,99,176,214,46,5,94,
+  204,132,136,80,173,86,107,39,39,39,191,218,223,223,255,104,174,95,39,206,57,109,173,125,255,232,232,232,207,207,5,0,
+  210,52,77,189,110,183,71,183,219,45,0,230,191,243,32,139,129,246,246,246,106,245,122,157,70,163,129,136,32,34,0,40,
+  165,138,235,48,12,185,123,247,238,71,192,243,1,118,118,118,146,243,243,115,111,107,171,133,214,122,5,96,93,41,230,18,
+  69,17,64,1,177,56,162,40,194,24,179,113,89,240,2,224,224,224,32,187,126,253,186,234,247,251,69,6,128,181,32,243,
+  108,44,202,124,197,139,193,149,82,115,128,202,11,1,0,140,49,182,209,216,84,73,146,242,217,137,229,47,247,151,131,92,
+  86,231,103,101,14,51,125,166,133,115,215,110,240,230,187,122,209,198,243,228,247,205,175,127,247,139,37,0,231,156,238,245,
+  122,126,175,215,227,97,183,206,7,63,255,41,55,190,187,181,224,108,246,251,188,232,107,32,103,154,34,206,227,238,152,223,
+  252,225,179,119,230,247,139,25,208,245,122,173,170,181,38,123,160,104,84,203,220,127,58,38,140,242,233,202,214,174,246,50,
+  18,89,185,20,160,94,241,201,82,141,8,221,249,116,113,20,27,99,244,249,249,128,94,175,71,148,90,106,213,18,214,76,
+  13,212,204,193,179,3,119,217,112,23,195,78,135,181,142,56,53,36,105,14,78,138,3,108,177,4,105,165,18,208,106,181,
+  72,141,176,17,148,176,46,195,83,47,126,93,124,167,25,240,131,55,154,252,245,223,61,162,212,172,181,25,39,57,181,134,
+  207,104,152,99,173,123,188,2,144,231,121,22,134,35,206,207,7,104,115,133,106,224,227,156,195,83,151,230,25,223,19,126,
+  114,99,155,183,246,154,40,17,174,239,214,248,244,31,79,57,233,70,23,70,14,70,137,70,231,150,192,87,68,137,182,198,
+  228,79,86,0,140,49,105,185,92,162,218,216,98,115,163,140,3,148,200,250,226,3,87,91,21,222,254,222,14,141,170,79,
+  166,45,200,180,39,126,246,195,43,252,243,81,200,23,95,15,208,214,50,74,52,185,117,120,158,16,148,61,38,113,154,137,
+  200,217,10,128,181,54,29,141,198,156,14,50,154,181,109,116,110,215,174,190,228,43,222,122,179,201,222,149,26,0,137,182,
+  75,243,34,112,227,90,157,86,173,196,39,135,79,193,9,254,204,79,217,83,140,38,89,46,92,52,225,98,6,18,223,247,
+  241,130,128,6,101,210,108,217,49,192,181,173,10,223,127,163,73,80,82,36,218,76,27,78,150,119,223,244,192,130,74,217,
+  163,253,163,171,252,237,171,62,199,79,39,179,57,24,140,18,155,59,183,10,96,173,141,199,227,49,221,129,79,165,85,38,
+  140,53,233,108,117,14,48,214,242,224,44,34,40,121,188,190,83,45,130,95,38,2,28,62,24,242,176,27,145,100,6,7,
+  196,153,97,56,142,61,81,222,218,18,36,34,130,10,234,148,74,62,163,88,19,198,154,36,51,100,218,22,7,208,235,219,
+  85,70,241,210,193,198,225,241,52,16,76,123,160,22,76,221,126,51,136,233,133,105,97,23,165,57,147,88,251,92,82,130,
+  40,138,38,244,195,10,149,13,120,120,22,49,140,150,3,1,100,185,93,210,11,194,217,40,45,160,82,109,201,173,70,128,
+  254,56,155,150,106,150,145,97,148,145,25,83,250,252,181,163,126,251,225,106,6,34,16,172,191,65,154,91,194,72,79,187,
+  251,89,0,109,9,39,249,69,158,129,225,100,106,235,41,97,146,228,133,62,156,228,133,15,165,132,179,97,140,18,21,181,
+  15,14,10,199,75,61,16,199,49,97,108,120,237,90,64,53,240,8,202,171,135,144,239,131,113,211,109,55,175,75,185,36,
+  108,214,124,130,146,194,56,87,232,131,64,40,151,167,33,148,8,73,146,161,148,12,151,252,45,148,32,6,208,148,104,86,
+  61,106,165,245,175,157,163,199,131,21,93,160,32,40,3,88,254,245,168,95,232,235,165,11,27,231,28,231,113,140,88,187,
+  228,192,7,232,116,58,114,235,214,45,19,70,25,131,137,227,209,217,16,213,123,78,139,127,75,57,61,29,218,56,30,126,
+  121,208,233,108,180,219,237,168,0,0,188,48,12,63,249,251,137,124,152,53,241,191,186,255,95,255,217,93,18,7,22,192,
+  234,228,248,244,203,63,253,118,113,78,230,159,102,157,78,167,17,108,110,94,221,8,90,187,14,167,148,168,213,45,240,45,
+  36,55,198,100,105,178,145,139,228,249,232,172,15,124,211,110,183,139,58,201,226,183,97,167,211,81,64,192,52,51,249,203,
+  0,152,73,0,36,64,214,110,183,151,182,150,252,255,227,244,85,3,252,7,56,45,2,128,34,54,254,2,0,0,0,0,
+  73,69,78,68,174,66,96,130,
+};
+const unsigned char Server1x[642] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,96,0,96,0,96,101,20,102,74,0,0,0,9,112,72,89,115,0,0,11,18,0,
+  0,11,18,1,210,221,126,252,0,0,0,7,116,73,77,69,7,213,5,24,13,41,13,225,69,167,57,0,0,0,62,116,
+  69,88,116,67,111,109,109,101,110,116,0,67,114,101,97,116,101,100,32,119,105,116,104,32,84,104,101,32,71,73,77,80,
+  10,10,40,99,41,32,50,48,48,51,32,74,97,107,117,98,32,39,106,105,109,109,97,99,39,32,83,116,101,105,110,101,
+  114,39,51,239,88,0,0,1,197,73,68,65,84,56,203,141,146,189,138,34,81,16,133,191,235,54,218,6,6,98,172,160,
+  145,8,3,254,177,6,194,226,62,192,198,70,3,247,5,140,134,13,124,2,31,192,23,16,246,17,54,22,100,2,3,55,
+  145,53,53,145,246,47,16,49,209,139,77,119,215,6,59,221,171,163,50,123,224,66,113,239,61,167,234,84,149,226,26,79,
+  90,235,223,124,128,193,96,240,25,248,197,29,178,44,151,75,241,125,95,124,223,23,207,243,196,117,93,113,93,87,140,49,
+  98,140,145,241,120,44,90,107,1,190,94,177,181,214,114,62,159,175,200,247,4,78,167,147,236,247,251,80,4,235,82,68,
+  41,197,104,52,250,200,1,173,86,43,138,173,247,143,167,211,137,114,185,252,144,60,157,78,49,198,252,19,208,90,127,1,
+  190,135,23,201,100,18,99,12,34,130,136,16,4,1,34,130,239,251,127,9,150,69,16,4,161,237,159,86,183,219,5,160,
+  215,235,1,112,60,30,153,207,231,0,136,72,148,41,140,67,33,128,78,167,51,179,66,98,136,70,163,17,125,10,43,80,
+  74,33,34,24,99,136,199,227,40,165,0,232,247,251,79,214,96,48,120,5,94,181,214,98,89,22,195,225,144,213,106,69,
+  62,159,167,84,42,177,221,110,241,125,63,170,64,68,200,102,179,225,62,124,139,189,111,146,227,56,20,139,69,102,179,25,
+  74,41,226,241,56,133,66,33,58,151,22,110,166,32,34,20,10,5,38,147,9,237,118,27,219,182,113,93,151,197,98,17,
+  85,96,219,54,135,195,225,241,24,235,245,58,213,106,53,234,124,46,151,187,219,204,55,124,186,177,224,121,30,65,16,68,
+  222,29,199,193,243,60,28,199,1,136,70,248,134,68,236,209,194,236,118,59,0,54,155,13,137,68,130,245,122,77,44,22,
+  139,54,54,220,187,43,11,135,195,129,76,38,3,64,165,82,33,149,74,209,108,54,73,165,82,212,106,53,210,233,244,77,
+  162,75,129,231,151,151,151,31,252,63,158,1,254,0,124,80,17,254,250,115,5,147,0,0,0,0,73,69,78,68,174,66,
+  96,130,
+};
+const unsigned char Server2x[847] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,3,6,73,68,65,84,88,133,237,151,207,75,36,
+  71,20,199,63,213,211,61,253,99,163,44,113,8,134,157,153,75,14,234,34,11,122,200,238,31,145,219,28,131,61,68,17,
+  188,76,240,144,131,130,158,61,4,6,33,224,209,139,103,49,255,192,230,224,65,150,61,140,8,130,123,10,138,6,15,30,
+  36,50,77,79,77,183,253,114,89,39,97,117,166,107,92,115,74,190,151,162,171,190,124,223,247,21,239,85,87,193,127,29,
+  202,148,184,184,184,248,179,214,250,39,19,174,109,219,63,110,111,111,255,242,120,91,159,96,97,97,97,110,101,101,165,125,
+  123,123,43,121,136,227,88,26,141,70,187,94,175,127,111,162,157,187,3,115,115,115,175,125,223,127,219,108,54,159,185,174,
+  139,214,122,32,223,117,93,110,110,110,88,93,93,141,227,56,254,110,103,103,231,183,65,124,43,215,161,82,239,214,214,214,
+  158,249,190,159,27,28,64,107,205,232,232,40,235,235,235,190,82,234,109,30,223,206,85,4,42,149,10,87,87,87,100,89,
+  102,66,39,138,34,202,229,178,17,215,200,0,192,254,254,190,41,21,128,90,173,246,180,6,0,227,172,46,46,46,140,53,
+  115,107,224,223,198,80,59,48,76,102,79,110,96,102,102,6,207,243,140,184,74,25,159,111,230,6,14,15,15,141,69,225,
+  255,34,252,27,155,155,155,239,154,205,230,139,126,235,54,64,163,209,120,153,36,201,43,224,27,165,212,243,143,243,5,192,
+  142,162,168,71,126,76,17,78,79,79,127,219,106,181,222,47,45,45,253,106,89,86,42,34,169,109,219,127,58,142,243,187,
+  227,56,251,182,136,168,131,131,131,162,231,121,89,16,4,90,41,165,147,36,81,90,235,98,154,166,238,214,214,214,157,208,
+  208,193,1,166,166,166,212,209,209,209,248,252,252,188,237,186,110,82,44,22,187,158,231,145,101,217,23,215,215,215,129,173,
+  148,146,90,173,214,17,145,44,73,146,130,136,56,150,101,217,74,41,203,178,44,53,50,50,2,128,136,244,68,219,237,54,
+  103,103,103,125,131,186,174,203,196,196,4,0,39,39,39,162,181,190,218,216,216,80,34,82,16,17,27,72,139,197,226,117,
+  161,80,136,108,128,221,221,221,15,192,135,135,196,194,48,252,1,224,244,244,148,243,243,115,42,149,10,165,82,9,223,247,
+  25,27,27,187,199,239,116,58,164,105,218,251,62,62,62,126,239,121,94,109,111,111,239,143,135,244,141,187,224,242,242,146,
+  217,217,89,90,173,214,131,129,251,97,121,121,249,205,160,117,99,3,227,227,227,180,90,45,202,229,50,34,66,28,199,125,
+  139,50,8,2,99,131,198,6,170,213,42,213,106,181,247,61,57,57,137,82,138,32,8,112,93,23,199,113,140,131,62,202,
+  192,29,68,4,165,84,175,40,219,237,54,81,20,145,101,89,111,94,41,69,169,84,50,210,51,62,136,68,4,17,161,211,
+  233,160,148,186,55,106,173,177,44,203,232,214,244,217,6,128,129,227,63,91,246,201,12,220,161,219,237,98,89,214,192,113,
+  24,12,109,64,107,221,219,242,126,227,83,26,184,119,1,120,132,129,175,134,114,244,9,190,14,195,48,247,49,210,15,97,
+  24,10,240,18,232,219,163,121,109,88,0,168,215,235,159,147,132,195,128,7,80,222,221,233,75,224,5,48,202,128,44,250,
+  160,11,220,2,23,192,131,255,1,19,3,124,12,254,156,225,11,182,11,68,192,13,208,183,47,255,2,107,242,173,196,220,
+  106,38,81,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Settings1x[629] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,11,4,11,55,32,209,169,238,103,0,0,0,29,116,
+  69,88,116,67,111,109,109,101,110,116,0,67,114,101,97,116,101,100,32,119,105,116,104,32,84,104,101,32,71,73,77,80,
+  239,100,37,110,0,0,1,217,73,68,65,84,56,203,197,147,77,107,19,97,20,133,159,105,107,131,52,157,52,35,161,38,
+  67,55,129,198,221,132,100,66,72,138,88,117,37,53,89,137,8,21,4,33,100,254,65,17,92,117,33,136,43,17,55,45,
+  253,3,165,45,8,67,178,81,12,88,65,145,188,249,152,162,130,219,36,148,137,52,37,89,180,136,31,113,97,103,72,219,
+  116,213,133,119,117,121,207,229,112,239,57,231,133,115,150,116,22,240,244,217,147,190,211,63,90,122,124,230,220,152,211,220,
+  189,119,39,163,235,113,19,64,136,74,22,32,159,51,88,93,91,57,134,157,36,115,9,116,61,110,230,115,6,150,101,1,
+  152,161,160,74,203,110,16,10,170,160,99,166,146,105,52,77,3,232,15,146,140,13,178,89,150,197,165,105,63,183,179,11,
+  238,91,44,17,37,70,212,197,79,214,168,211,248,21,191,248,211,255,189,24,185,50,75,171,209,98,251,221,118,175,109,183,
+  61,59,214,78,111,202,55,229,153,240,78,80,42,149,16,162,146,253,242,249,235,183,99,27,56,130,133,130,42,0,181,90,
+  173,103,219,223,95,9,81,221,84,20,229,170,36,141,62,92,200,220,10,56,231,232,122,220,213,98,196,97,202,231,12,98,
+  137,127,171,250,124,62,185,217,108,110,110,172,111,153,157,78,231,189,44,123,3,206,57,249,156,49,220,133,213,181,21,66,
+  65,149,88,34,202,193,193,225,225,220,92,122,9,32,28,14,27,221,110,183,7,200,213,114,157,194,110,241,180,6,111,94,
+  191,93,246,43,126,49,57,233,93,188,113,237,38,63,127,253,184,208,110,183,3,145,200,236,3,73,226,242,252,245,121,121,
+  220,51,78,69,84,16,162,146,125,241,252,229,253,161,54,166,146,105,90,118,3,117,70,69,157,81,47,30,65,178,51,147,
+  74,166,1,204,141,245,45,215,198,145,193,117,52,77,99,207,222,167,96,22,169,150,235,0,84,203,117,10,102,145,61,123,
+  223,201,193,112,13,142,84,237,187,73,212,49,51,211,25,10,187,69,39,153,230,199,79,31,78,37,241,220,127,225,255,215,
+  95,179,89,175,43,2,12,187,45,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Settings2x[2240] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,8,119,73,68,65,84,88,133,157,86,109,108,91,
+  213,25,126,206,189,231,94,95,219,55,54,113,88,18,172,148,186,129,212,26,144,86,84,8,181,64,90,71,26,180,77,25,
+  66,29,63,80,37,74,181,161,6,109,26,63,38,58,36,154,134,219,8,34,42,49,132,248,81,81,84,85,19,131,34,84,
+  129,212,74,168,138,80,107,179,66,155,137,100,45,27,77,192,27,109,234,52,36,115,98,242,225,216,215,190,247,124,236,7,
+  182,229,56,41,130,190,210,35,235,30,251,156,231,121,159,247,125,143,47,193,77,196,193,131,7,255,39,165,108,84,85,181,
+  192,57,55,84,85,189,120,224,192,129,13,55,115,22,189,153,77,138,162,4,119,239,222,13,175,215,107,216,182,141,119,223,
+  125,119,237,205,156,3,0,202,207,221,240,242,203,47,175,166,148,130,82,138,116,58,13,159,207,7,41,165,222,223,223,223,
+  112,51,2,86,116,224,224,193,131,79,19,66,250,1,60,218,219,219,123,177,250,59,198,216,250,198,198,70,193,24,3,33,
+  4,156,115,212,215,215,187,211,211,211,191,4,240,89,205,57,79,73,41,223,81,20,229,119,189,189,189,199,86,226,82,107,
+  23,250,250,250,254,108,24,198,107,237,237,237,161,116,58,253,116,44,22,179,207,158,61,59,232,241,120,26,58,58,58,254,
+  0,224,104,52,26,165,141,141,141,4,0,60,30,15,50,153,12,153,153,153,121,178,179,179,51,31,139,197,70,99,177,88,
+  221,246,237,219,63,172,171,171,123,110,219,182,109,244,250,245,235,143,116,116,116,136,120,60,254,89,45,31,169,126,176,44,
+  235,57,85,85,95,223,181,107,151,234,241,120,96,219,54,78,159,62,93,152,157,157,117,21,69,81,34,145,136,118,215,93,
+  119,233,145,72,4,139,139,139,144,82,194,48,12,120,189,94,164,82,41,140,140,140,20,147,201,164,228,156,27,27,55,110,
+  228,155,55,111,86,1,32,159,207,227,240,225,195,2,192,83,189,189,189,199,111,88,2,69,81,132,199,227,145,62,159,15,
+  169,84,10,186,174,99,231,206,157,198,216,216,152,17,14,135,225,243,249,224,56,14,22,22,22,160,40,10,52,77,3,33,
+  4,140,49,68,34,17,172,93,187,214,179,176,176,128,66,161,128,91,111,189,85,45,22,139,40,187,164,235,186,112,28,167,
+  241,71,75,112,246,236,217,47,18,137,196,86,33,68,184,165,165,69,177,109,27,142,227,160,185,185,25,156,115,20,10,133,
+  31,84,83,10,77,211,150,64,85,85,8,33,160,105,26,12,195,128,235,186,149,231,129,129,1,55,147,201,156,234,233,233,
+  249,83,173,128,37,83,64,8,145,132,144,39,190,252,242,203,130,227,56,240,251,253,80,85,21,249,124,30,82,74,232,186,
+  14,93,215,151,145,83,250,131,145,66,8,48,198,224,186,46,56,231,160,148,34,153,76,34,153,76,102,138,197,226,158,90,
+  242,101,2,0,96,255,254,253,147,66,136,51,67,67,67,34,20,10,45,35,211,52,173,34,66,215,245,74,230,156,115,112,
+  206,33,132,168,128,82,138,243,231,207,51,198,216,41,203,178,22,127,146,0,203,178,2,132,144,206,7,31,124,80,113,28,
+  103,25,185,97,24,240,251,253,48,12,3,249,124,190,82,146,178,3,101,33,156,115,216,182,141,29,59,118,80,69,81,158,
+  180,44,203,92,73,192,74,247,192,19,45,45,45,90,40,20,66,54,155,133,174,235,160,148,66,85,85,24,134,1,33,4,
+  78,157,58,85,248,230,155,111,160,170,106,150,115,94,215,214,214,134,173,91,183,26,138,162,128,49,86,113,192,182,109,132,
+  66,33,132,195,97,45,149,74,237,4,240,78,45,25,1,128,55,223,124,211,51,55,55,183,86,8,17,5,240,65,87,87,
+  151,178,122,245,106,48,198,80,190,245,202,14,188,245,214,91,57,219,182,223,113,28,231,121,203,178,242,150,101,249,116,93,
+  127,205,48,140,221,207,60,243,140,223,182,109,48,198,32,165,172,52,225,212,212,20,78,158,60,9,93,215,255,41,132,24,
+  100,140,125,65,41,61,211,211,211,51,78,250,250,250,174,75,41,195,166,105,22,26,26,26,72,115,115,179,190,105,211,38,
+  197,182,109,40,138,82,17,96,24,6,226,241,120,113,120,120,248,216,139,47,190,248,251,218,76,250,251,251,15,175,91,183,
+  238,183,15,61,244,144,39,155,205,46,41,71,40,20,130,109,219,72,167,211,152,154,154,146,99,99,99,108,122,122,218,121,
+  233,165,151,76,42,165,108,222,187,119,47,209,52,205,203,57,7,0,20,139,197,138,237,229,79,0,184,116,233,18,115,28,
+  231,213,149,106,233,56,206,171,95,125,245,213,238,45,91,182,120,170,167,129,49,134,241,241,113,112,206,161,40,10,34,145,
+  8,137,70,163,218,123,239,189,87,4,0,42,165,84,125,62,31,22,23,23,43,13,85,38,166,148,130,16,2,33,68,89,
+  152,1,96,106,37,1,0,166,28,199,49,74,98,192,24,91,2,33,4,8,33,80,85,21,166,105,66,74,233,7,74,83,
+  48,58,58,10,33,4,2,129,0,76,211,132,215,235,133,166,105,0,176,100,188,2,129,64,94,81,148,246,149,216,21,69,
+  105,55,77,51,239,186,46,92,215,133,227,56,21,132,195,97,132,66,33,112,206,113,237,218,53,196,227,113,71,74,73,0,
+  128,42,138,242,199,79,63,253,244,49,33,196,122,215,117,27,124,62,159,124,246,217,103,105,57,243,50,92,215,69,71,71,
+  135,57,48,48,240,246,145,35,71,54,118,119,119,187,101,242,35,71,142,104,51,51,51,111,223,127,255,253,102,54,155,93,
+  226,128,170,170,200,229,114,56,126,252,56,52,77,27,20,66,92,228,156,255,11,192,80,101,10,202,97,89,150,143,82,122,
+  190,171,171,107,125,52,26,173,92,167,229,18,120,189,94,156,60,121,210,30,27,27,75,186,174,187,95,74,249,31,66,72,
+  155,170,170,175,220,126,251,237,107,187,186,186,188,19,19,19,112,28,167,82,255,96,48,136,201,201,73,12,13,13,125,220,
+  211,211,243,104,173,115,75,254,11,18,137,132,187,121,243,102,135,49,246,200,221,119,223,173,85,11,224,156,195,117,93,180,
+  183,183,107,94,175,183,41,159,207,63,38,165,236,174,175,175,255,205,125,247,221,183,234,129,7,30,208,38,39,39,81,40,
+  20,42,228,156,115,52,55,55,227,194,133,11,118,62,159,239,79,36,18,255,174,21,176,236,34,242,251,253,31,164,82,169,
+  215,211,233,180,55,24,12,194,117,221,202,76,11,33,48,59,59,139,59,238,184,131,68,163,209,58,0,96,140,33,151,203,
+  97,124,124,188,98,125,89,128,105,154,152,159,159,199,236,236,172,42,165,60,177,98,239,212,46,236,219,183,47,199,24,251,
+  123,60,30,23,154,166,45,187,231,25,99,88,88,88,64,58,157,198,119,223,125,135,137,137,9,204,204,204,160,80,40,84,
+  154,174,220,136,182,109,163,88,44,66,74,169,83,74,155,126,146,0,203,178,238,164,148,254,42,22,139,41,185,92,110,89,
+  35,86,119,119,53,89,45,170,223,27,214,175,95,47,8,33,39,202,157,127,195,30,176,44,75,247,120,60,231,58,58,58,
+  154,86,173,90,69,10,133,2,8,33,240,249,124,16,66,44,169,111,217,234,106,48,198,80,87,87,135,214,214,86,152,166,
+  137,92,46,135,92,46,135,104,52,74,82,169,212,47,6,6,6,178,137,68,226,31,55,116,64,85,213,191,250,253,254,59,
+  55,108,216,64,114,185,92,229,141,103,112,112,80,102,179,89,132,66,33,248,124,62,40,138,178,36,123,69,81,80,95,95,
+  143,214,214,86,104,154,134,143,62,250,200,29,28,28,100,173,173,173,8,4,2,112,93,23,247,222,123,175,71,74,249,70,
+  173,3,75,154,144,16,242,113,54,155,125,98,110,110,78,189,229,150,91,240,245,215,95,227,147,79,62,41,22,10,133,203,
+  67,67,67,119,54,53,53,233,109,109,109,70,107,107,43,234,234,234,240,237,183,223,66,85,85,68,34,17,140,140,140,224,
+  243,207,63,183,231,230,230,120,38,147,249,139,105,154,247,124,255,253,247,143,62,252,240,195,30,85,85,113,238,220,185,130,
+  235,186,187,107,5,44,171,137,101,89,207,235,186,254,74,48,24,84,103,103,103,167,47,95,190,188,247,253,247,223,31,9,
+  135,195,129,237,219,183,255,250,182,219,110,219,70,41,221,180,103,207,30,140,142,142,194,239,247,195,182,109,92,184,112,65,
+  92,185,114,229,192,153,51,103,226,19,19,19,11,0,220,238,238,238,88,75,75,203,27,156,115,175,109,219,251,14,29,58,
+  116,24,128,3,128,221,80,0,0,253,133,23,94,120,146,82,186,229,196,137,19,175,36,147,73,9,64,175,70,95,95,223,
+  233,199,31,127,60,120,237,218,53,52,52,52,224,234,213,171,34,30,143,31,61,122,244,232,223,0,184,37,146,34,0,167,
+  179,179,179,97,205,154,53,77,199,142,29,59,87,90,43,2,224,43,150,160,20,236,208,161,67,39,0,156,42,17,122,240,
+  67,179,138,18,164,227,56,169,185,185,185,246,96,48,136,64,32,128,76,38,227,78,78,78,94,41,237,23,37,2,1,128,
+  199,227,241,241,120,60,254,223,82,214,172,154,252,70,2,4,0,187,244,195,50,88,41,51,29,64,49,151,203,93,154,159,
+  159,191,103,221,186,117,196,117,93,204,207,207,211,171,87,175,14,1,152,175,114,160,22,75,50,255,49,1,229,40,111,84,
+  1,104,37,80,0,212,113,156,196,240,240,240,83,195,195,195,40,137,203,143,140,140,140,86,137,45,163,44,230,134,177,82,
+  15,252,212,80,170,246,203,42,252,172,248,63,176,232,199,235,200,160,88,139,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Share1x[697] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,2,54,73,68,65,84,56,141,125,147,207,75,212,65,20,192,63,111,230,
+  107,172,38,90,80,45,66,132,68,157,194,91,93,130,46,65,7,15,29,36,242,210,41,130,14,65,157,69,188,117,144,16,
+  58,85,215,46,5,37,228,31,32,84,22,221,52,163,31,134,66,96,65,184,225,82,173,185,201,126,191,243,102,94,135,93,
+  55,53,233,93,30,243,230,205,231,253,28,25,29,29,189,111,102,231,249,87,54,204,236,194,248,248,248,236,46,119,109,145,
+  145,145,145,218,208,208,80,111,74,137,148,18,102,6,64,173,86,99,102,102,102,54,165,116,99,211,57,132,128,115,46,174,
+  172,172,204,79,78,78,70,128,44,132,96,170,74,181,90,37,198,216,134,56,231,232,235,235,59,1,76,111,66,1,234,245,
+  122,22,99,188,13,140,109,1,4,84,149,148,210,54,72,185,92,238,42,149,74,116,117,117,225,189,199,57,71,165,82,97,
+  117,117,245,248,38,48,83,213,164,26,185,251,162,224,119,254,55,18,8,0,70,3,104,180,173,102,14,56,61,124,234,234,
+  195,97,239,221,151,44,132,96,69,81,80,207,141,91,215,207,33,210,114,220,218,41,219,118,2,160,80,99,236,222,211,35,
+  89,81,20,73,85,1,35,115,240,102,121,173,25,95,118,233,120,75,59,47,28,45,239,5,49,203,84,149,16,2,34,130,
+  115,130,247,187,188,220,33,170,9,51,16,196,178,16,66,10,33,128,25,78,132,142,255,0,52,26,121,72,196,100,248,102,
+  138,77,128,106,51,131,70,17,145,86,201,26,141,104,70,74,70,50,35,104,83,3,100,94,104,20,218,6,152,106,68,36,
+  163,250,43,167,242,163,65,174,233,191,37,100,94,168,174,229,77,128,170,166,162,40,192,60,159,42,235,124,175,231,237,9,
+  104,99,125,219,56,178,206,110,64,240,78,248,182,214,42,65,68,82,140,17,193,104,228,129,206,142,102,15,150,95,62,96,
+  189,178,216,126,159,98,162,251,80,63,199,206,94,193,249,140,141,70,142,64,204,82,74,242,122,225,51,165,159,57,243,207,
+  22,219,209,194,215,247,76,76,76,48,55,55,215,222,204,39,83,83,124,120,254,24,201,246,16,130,146,113,96,73,222,190,
+  91,88,46,237,235,235,223,89,231,181,203,23,25,24,24,64,90,11,97,102,44,46,46,113,115,226,14,61,189,251,241,94,
+  180,167,179,227,149,12,14,14,30,78,41,93,2,14,110,5,152,217,25,51,59,185,213,230,156,251,40,34,211,214,252,93,
+  234,189,127,244,7,187,71,87,220,223,105,176,149,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Share2x[1446] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,9,112,72,89,115,0,0,13,215,0,0,13,
+  215,1,66,40,155,120,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,101,0,119,119,119,46,105,110,107,115,99,
+  97,112,101,46,111,114,103,155,238,60,26,0,0,5,35,73,68,65,84,88,133,197,150,77,104,84,87,20,199,255,231,190,
+  55,243,222,76,102,146,73,4,99,84,48,4,151,165,10,210,22,74,17,193,46,220,184,232,178,180,184,104,41,21,233,66,
+  232,166,46,36,177,59,55,173,80,43,133,118,87,168,11,187,17,36,27,91,144,82,40,98,173,164,110,132,54,181,198,26,
+  19,51,31,153,143,188,143,123,223,61,167,139,100,198,23,51,147,68,147,210,63,28,222,155,119,239,61,231,119,207,189,247,
+  204,37,17,193,255,41,23,0,206,157,59,231,106,173,127,180,214,190,190,209,0,34,74,152,249,227,243,231,207,95,218,14,
+  0,18,17,156,57,115,102,191,239,251,83,199,143,31,207,135,97,136,118,86,152,25,0,144,206,146,136,224,250,245,235,241,
+  210,210,210,190,11,23,46,204,111,21,192,5,0,173,117,156,203,229,100,118,118,22,229,114,25,34,210,213,0,128,136,48,
+  60,60,156,220,191,127,255,29,0,159,109,11,128,49,38,138,227,152,134,134,6,97,173,5,51,175,10,156,206,4,17,33,
+  151,203,245,205,204,204,124,122,250,244,233,241,246,247,110,18,17,195,204,39,46,94,188,56,185,46,0,128,56,142,99,167,
+  92,174,160,92,46,119,0,218,207,118,144,116,160,209,209,209,190,66,161,128,98,177,8,34,2,17,1,0,148,82,157,247,
+  70,163,129,155,55,111,142,3,88,31,96,199,142,29,81,173,86,115,6,7,75,48,198,172,1,232,182,20,109,5,65,0,
+  0,29,136,180,5,65,0,107,109,190,87,240,14,192,248,248,184,62,117,234,148,170,86,171,157,12,0,232,10,210,206,70,
+  90,237,25,167,131,43,165,218,0,254,134,0,0,96,173,229,98,177,95,69,81,140,91,51,140,159,167,87,7,217,108,189,
+  104,195,44,143,41,65,100,100,255,171,31,126,103,210,125,28,135,190,253,229,210,219,239,173,2,16,17,83,169,84,220,74,
+  165,130,7,229,2,222,127,235,53,236,223,51,152,114,182,242,92,47,122,23,200,149,47,157,56,143,202,45,124,245,253,173,
+  55,218,191,211,25,48,133,66,95,206,24,3,253,183,66,49,151,197,244,147,22,26,65,178,60,179,174,179,237,69,66,107,
+  94,9,64,193,119,161,99,3,34,148,219,205,42,13,80,171,45,162,82,169,32,136,25,125,185,12,216,46,119,80,43,14,
+  158,53,72,47,147,167,198,203,198,44,8,99,139,40,78,0,161,78,1,75,47,65,236,251,30,74,165,18,98,75,200,123,
+  25,176,104,56,170,195,184,37,181,162,4,125,69,23,205,122,2,102,121,180,6,32,73,18,221,104,52,81,171,45,194,216,
+  157,200,121,46,68,4,142,234,153,231,205,73,128,102,100,96,18,134,231,42,4,145,97,107,147,217,53,0,214,218,56,155,
+  205,32,87,28,68,127,62,11,1,160,136,186,47,254,38,101,69,208,140,12,18,22,56,14,193,203,58,88,10,99,77,68,
+  11,107,0,152,57,110,54,91,152,95,212,24,232,27,130,73,120,75,179,143,13,35,136,45,32,4,119,197,79,214,81,104,
+  46,233,132,240,116,19,166,51,16,185,174,11,199,243,80,68,22,177,230,13,131,44,239,49,1,203,114,157,176,188,108,58,
+  225,110,39,18,34,192,98,51,226,68,100,45,0,51,135,173,86,11,229,69,23,126,41,139,70,104,16,155,149,63,33,0,
+  137,101,24,43,48,9,35,177,43,101,249,57,179,18,106,139,122,43,116,72,57,93,151,32,34,34,40,175,128,76,198,69,
+  51,52,104,132,6,145,182,208,134,159,59,88,55,5,113,130,165,208,184,232,177,4,65,16,44,161,218,240,225,231,129,7,
+  11,1,234,129,233,234,232,69,68,0,234,129,134,182,54,115,123,247,159,213,53,0,204,28,0,4,118,243,136,19,70,35,
+  48,208,102,227,125,176,89,41,69,88,168,135,80,164,2,25,31,239,56,94,181,7,194,48,68,35,180,216,61,226,33,231,
+  57,240,178,219,83,132,128,229,35,29,69,26,74,81,61,253,61,189,4,33,0,24,100,48,144,115,208,151,217,222,219,178,
+  136,160,22,134,32,230,197,53,0,68,68,135,15,31,182,141,64,99,113,73,240,112,161,14,85,217,98,5,236,162,249,249,
+  58,135,97,253,14,17,229,69,36,232,0,0,112,26,141,198,15,191,206,208,71,122,0,238,31,211,91,190,236,174,146,0,
+  12,0,108,162,251,243,119,174,125,157,110,163,212,109,183,232,245,247,239,202,123,165,97,129,40,69,170,231,17,40,22,114,
+  35,163,251,246,124,183,107,100,196,43,228,243,152,158,158,110,205,63,169,124,50,191,80,251,237,217,190,137,181,86,199,81,
+  62,33,74,146,230,66,21,192,156,136,116,78,1,173,220,116,105,98,98,130,174,92,185,226,62,126,252,216,79,146,196,117,
+  93,55,73,59,234,239,239,87,99,99,99,159,3,120,23,0,121,158,103,15,29,58,148,181,214,226,222,189,123,81,171,213,
+  202,36,73,194,204,60,126,247,238,221,47,211,99,181,214,158,239,251,81,169,84,210,123,247,238,181,71,142,28,225,137,137,
+  9,17,17,33,17,193,177,99,199,70,136,232,101,17,57,0,96,103,183,89,51,115,159,82,234,131,179,103,207,58,179,179,
+  179,56,120,240,32,124,223,79,183,227,198,141,27,184,124,249,178,6,240,69,175,236,17,81,5,192,20,17,253,62,57,57,
+  249,15,137,8,170,213,106,255,208,208,208,43,204,124,80,68,198,186,13,124,248,240,97,254,228,201,147,39,70,71,71,149,
+  234,113,71,208,90,99,110,110,78,95,189,122,245,155,94,0,43,186,229,56,206,36,128,39,36,34,56,122,244,232,62,199,
+  113,14,0,56,160,148,26,232,65,78,34,242,38,51,191,180,158,103,165,212,79,0,110,247,106,39,162,22,128,41,199,113,
+  166,174,93,187,246,23,109,246,182,251,95,105,251,74,221,11,234,95,237,165,49,157,128,222,238,20,0,0,0,0,73,69,
+  78,68,174,66,96,130,
+};
+}
+namespace Prompt {
+const unsigned char Error1x[653] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,11,10,9,50,14,147,83,180,176,0,0,2,26,73,
+  68,65,84,56,203,157,147,189,79,147,81,20,198,127,247,109,11,229,163,190,160,196,26,77,160,104,155,2,182,11,196,148,
+  68,135,142,186,50,105,210,129,17,254,34,59,50,116,102,35,178,144,64,88,68,7,48,146,22,154,104,99,248,176,36,164,
+  45,77,91,40,246,61,199,225,125,75,16,137,26,79,114,115,147,155,243,252,158,228,57,247,24,110,84,14,82,192,60,144,
+  6,198,189,231,18,176,14,44,101,96,235,122,191,185,33,126,59,28,10,45,76,38,147,4,195,97,124,3,3,168,42,157,
+  179,51,206,203,101,138,133,2,213,102,51,155,129,197,223,0,57,120,55,157,76,190,28,153,153,225,114,123,27,231,244,20,
+  28,7,85,69,12,88,67,119,241,79,77,82,221,221,229,83,177,184,154,129,87,0,190,174,243,116,50,249,250,94,44,70,
+  123,115,19,109,52,64,4,85,65,69,65,4,105,182,232,28,124,163,63,22,195,182,172,232,139,106,245,193,50,172,152,28,
+  164,134,67,161,247,207,230,230,184,88,91,67,157,14,170,138,42,168,122,98,5,197,133,169,49,4,83,41,62,111,108,80,
+  107,181,102,45,96,126,50,145,224,114,103,7,117,28,16,80,1,21,113,15,234,129,20,84,193,113,184,200,231,121,60,22,
+  1,152,247,3,233,96,248,62,63,62,124,68,69,25,43,127,231,79,181,111,223,65,170,53,2,15,31,1,164,253,192,184,
+  213,63,136,138,27,216,223,74,68,81,237,96,122,2,0,227,22,112,149,246,191,0,240,250,84,5,0,63,80,234,212,207,
+  38,20,131,170,195,151,145,17,183,65,196,189,81,55,60,55,85,68,221,32,181,217,2,40,89,192,250,249,201,9,198,30,
+  186,34,255,34,238,58,138,39,86,193,26,28,164,93,171,1,172,91,192,210,254,222,30,129,120,220,37,203,117,145,55,58,
+  237,78,67,80,99,240,71,34,148,14,15,1,150,172,12,108,213,90,173,108,165,144,167,103,234,169,11,185,230,138,119,171,
+  40,24,67,79,52,70,227,224,128,122,187,157,205,192,150,15,96,25,86,158,87,42,179,182,207,23,29,72,36,112,26,13,
+  228,162,125,245,19,21,48,118,136,222,248,4,141,114,153,194,241,241,106,6,222,220,186,76,118,95,223,194,147,209,81,2,
+  182,141,233,237,69,69,112,154,77,58,245,58,95,143,142,186,206,139,183,110,227,255,172,243,79,194,71,102,30,185,88,118,
+  119,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Error2x[1645] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,6,36,73,68,65,84,88,133,197,151,93,108,28,
+  87,21,128,191,123,103,246,215,235,221,236,110,215,118,138,147,170,9,78,236,64,171,164,21,133,34,129,8,47,253,175,161,
+  161,145,168,170,42,111,125,2,169,2,193,3,15,72,72,188,33,196,143,250,80,222,194,3,81,211,162,34,165,50,169,120,
+  168,16,84,148,134,168,173,237,196,73,20,154,68,174,236,108,214,107,123,237,157,221,217,157,185,247,242,176,51,155,217,93,
+  59,78,17,18,87,58,186,51,103,238,158,243,157,159,185,119,22,254,207,67,220,237,194,179,80,104,195,83,113,219,126,1,
+  41,15,106,165,138,74,235,33,75,74,199,146,114,197,104,189,224,41,117,74,192,204,211,176,246,63,3,56,3,19,182,101,
+  253,70,195,55,74,163,163,122,247,23,14,165,51,187,199,72,228,11,196,115,195,180,107,27,184,171,171,56,203,55,89,190,
+  112,177,81,41,151,45,97,204,95,60,99,94,153,134,171,255,53,192,105,136,103,164,252,53,112,226,243,15,29,137,223,255,
+  248,99,210,242,61,88,89,5,199,129,86,27,124,15,236,24,36,98,48,52,4,197,60,202,182,249,247,204,59,250,147,217,
+  185,22,198,156,92,212,250,251,47,131,247,153,0,102,160,132,16,239,220,51,50,50,245,224,75,47,38,227,202,135,107,55,
+  160,233,14,172,53,253,215,233,20,220,55,78,219,146,124,252,251,63,184,171,149,149,11,218,152,199,159,129,149,187,2,120,
+  27,242,66,136,185,125,83,83,163,7,159,63,102,115,249,50,172,111,220,209,169,49,102,64,207,174,28,28,220,199,149,55,
+  255,228,223,88,184,124,211,49,230,139,199,161,214,239,207,138,222,156,6,43,41,196,187,251,39,39,39,14,28,251,150,205,
+  220,60,212,27,131,81,6,78,117,244,62,50,107,192,184,45,76,117,141,226,215,191,34,205,74,53,229,86,87,143,78,195,
+  201,55,250,56,101,244,38,43,229,207,75,197,194,3,19,207,127,219,54,115,23,59,70,66,163,198,244,136,137,56,11,69,
+  133,206,195,245,77,23,53,123,137,125,199,158,141,229,139,133,195,25,41,127,214,159,129,110,9,254,8,187,51,82,46,28,
+  125,229,123,57,185,184,4,27,155,3,169,141,206,253,186,48,43,3,107,140,129,108,6,51,62,202,63,126,251,187,245,150,
+  214,147,211,80,30,200,64,90,202,95,30,56,52,149,145,109,15,93,219,232,70,169,183,145,48,74,19,100,68,5,37,209,
+  17,125,88,38,189,81,71,248,62,123,39,15,100,226,82,254,98,160,4,167,33,167,141,153,190,247,153,39,44,117,99,113,
+  91,199,3,165,136,62,11,75,19,232,85,31,136,186,190,196,189,79,124,211,86,198,60,55,3,217,30,128,20,60,85,44,
+  228,149,80,10,221,106,247,58,142,68,169,183,136,178,171,23,162,35,145,244,135,58,37,37,170,237,33,132,36,151,29,214,
+  30,60,214,3,16,19,226,187,163,19,251,51,170,186,142,137,24,209,161,17,41,49,82,118,13,154,64,167,45,11,99,89,
+  24,41,49,17,189,10,214,119,37,208,251,107,27,20,247,237,205,216,66,188,16,2,216,65,195,76,166,247,238,65,55,26,
+  93,67,8,1,175,191,30,45,23,130,207,112,120,4,163,121,252,120,167,153,133,64,55,91,164,62,183,27,241,209,133,169,
+  30,0,13,165,248,72,9,83,174,118,136,131,12,200,237,172,70,134,49,6,173,117,247,90,8,129,148,18,33,58,168,161,
+  61,0,237,249,196,138,187,48,80,10,127,47,1,180,49,153,88,33,143,86,170,147,218,32,117,59,13,173,53,74,169,110,
+  163,133,16,74,41,124,223,71,107,221,233,149,176,23,140,33,150,203,160,141,25,238,1,144,66,212,219,142,131,142,197,111,
+  215,123,7,0,165,84,55,242,59,1,54,206,159,199,171,86,59,189,18,139,225,150,43,8,33,54,195,53,54,128,128,91,
+  205,74,37,55,148,140,163,91,173,29,141,238,228,184,7,180,209,192,159,159,71,164,211,196,238,31,199,53,30,2,42,61,
+  0,192,165,250,213,107,19,67,71,14,99,54,157,78,3,2,238,137,19,157,212,26,131,95,46,227,93,191,142,113,156,238,
+  14,23,246,74,207,238,23,217,61,123,244,142,131,229,58,52,54,234,104,184,216,3,224,27,115,170,60,127,241,104,233,75,
+  71,50,61,77,83,175,163,42,21,252,165,165,206,27,178,205,86,219,175,235,7,12,159,201,177,2,181,203,215,54,181,49,
+  167,122,0,92,152,217,216,172,91,237,197,79,240,254,181,128,49,160,91,45,140,235,110,25,229,221,68,223,3,100,12,50,
+  157,192,196,36,142,219,178,129,179,33,128,4,56,14,53,33,196,91,203,255,156,245,229,125,99,120,181,26,202,117,187,167,
+  91,184,243,133,162,184,189,213,246,111,205,161,94,133,231,67,160,143,29,216,67,249,131,5,95,26,222,152,134,205,30,0,
+  0,87,235,31,46,47,149,235,38,155,70,228,179,183,157,69,14,154,1,167,220,62,134,85,31,96,20,92,230,51,144,142,
+  83,189,181,90,247,225,71,68,70,23,224,24,44,35,196,107,87,223,253,160,145,120,120,18,147,140,239,24,189,218,2,38,
+  10,174,141,193,164,18,164,30,154,96,241,111,179,142,20,226,213,232,81,220,3,0,80,215,250,39,78,211,157,253,244,239,
+  31,122,201,71,31,192,164,18,3,169,221,42,250,158,108,69,162,39,157,96,232,203,7,89,122,111,174,237,182,218,31,213,
+  181,254,41,125,99,96,107,127,11,118,217,48,95,40,229,71,198,191,118,36,230,156,191,132,191,82,235,109,184,45,58,60,
+  170,7,176,75,57,134,14,239,103,249,189,121,111,179,90,91,110,194,131,91,125,19,110,121,182,156,129,123,4,156,77,165,
+  146,135,246,30,125,56,101,26,46,205,11,215,81,78,115,219,215,48,20,107,56,77,106,114,28,145,138,243,233,95,63,110,
+  122,110,123,174,13,79,62,7,213,173,124,109,123,184,189,6,177,49,120,85,10,241,98,126,180,144,24,121,228,144,196,109,
+  209,186,185,138,191,238,160,221,22,218,83,16,179,144,201,4,86,46,77,108,44,143,140,91,220,58,119,197,175,221,90,243,
+  218,112,242,36,252,224,12,52,182,243,179,21,128,0,50,192,16,144,249,14,76,78,195,143,179,240,72,50,149,80,217,177,
+  66,42,89,204,98,15,167,177,135,146,120,78,147,86,173,65,123,117,131,245,155,107,77,207,109,89,235,112,238,77,248,213,
+  219,112,5,168,3,78,100,222,17,32,29,0,12,71,231,61,48,246,36,60,122,24,190,154,133,177,4,100,108,136,251,224,
+  185,80,95,135,202,135,240,254,159,225,220,82,167,211,235,116,222,247,112,222,164,243,159,81,221,77,9,210,116,190,219,194,
+  76,164,131,57,21,72,2,136,211,249,95,97,2,163,30,224,2,77,58,41,15,37,116,188,217,239,252,78,0,209,231,177,
+  192,97,10,72,6,142,227,129,222,6,252,8,64,27,104,5,142,221,64,55,224,52,58,254,3,231,154,16,69,179,153,170,
+  92,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Information1x[863] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,0,0,0,0,0,249,67,187,127,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,213,3,2,6,32,50,58,80,156,247,0,0,0,53,116,
+  69,88,116,67,111,109,109,101,110,116,0,40,99,41,32,50,48,48,52,32,74,97,107,117,98,32,83,116,101,105,110,101,
+  114,10,10,67,114,101,97,116,101,100,32,119,105,116,104,32,84,104,101,32,71,73,77,80,144,217,139,111,0,0,2,171,
+  73,68,65,84,56,203,149,146,75,72,84,113,20,198,191,255,220,59,227,189,58,215,71,38,89,106,102,82,62,8,69,34,
+  19,196,161,6,37,212,164,162,144,108,98,202,112,97,180,8,19,178,69,203,16,49,170,69,143,77,162,139,136,160,2,3,
+  3,37,200,16,73,116,38,74,74,205,138,52,149,76,157,113,116,156,185,119,174,247,245,111,229,160,53,17,126,171,115,224,
+  251,126,156,115,56,4,17,84,92,217,212,76,41,28,6,37,41,32,132,152,136,49,203,16,250,180,255,101,107,227,159,94,
+  118,125,83,84,222,148,193,48,164,239,98,109,101,90,185,189,0,113,2,15,85,55,224,241,5,83,123,122,63,92,33,38,
+  230,44,165,122,73,127,87,235,215,136,0,150,37,111,239,181,212,111,223,147,185,99,44,16,82,70,103,125,146,18,90,85,
+  89,69,211,163,109,37,249,89,233,233,201,123,91,110,61,118,1,136,95,203,48,107,69,73,213,213,219,245,231,143,150,21,
+  31,204,249,172,168,186,155,183,152,21,0,68,167,32,170,78,13,239,74,104,150,139,230,16,205,115,59,117,38,37,115,114,
+  252,109,39,0,152,194,36,134,61,87,110,47,64,32,164,142,177,44,67,45,102,198,32,132,80,80,24,154,110,40,148,194,
+  232,26,156,236,46,42,204,1,195,114,167,214,114,97,192,170,66,227,5,43,15,89,209,87,85,205,72,52,51,166,11,137,
+  177,156,115,87,178,224,200,223,189,213,1,37,144,58,229,17,253,60,207,33,32,169,92,109,93,131,105,195,13,8,33,68,
+  209,116,72,178,106,50,12,42,38,88,163,224,245,75,46,81,10,49,43,65,73,27,158,150,134,21,69,55,169,170,177,22,
+  225,1,136,97,64,12,207,74,94,95,32,70,148,85,203,138,164,250,51,146,99,49,250,195,247,94,84,116,58,183,36,41,
+  238,111,139,30,193,106,73,240,250,131,136,19,120,181,163,173,89,220,176,130,153,209,6,122,222,12,131,143,98,115,39,126,
+  45,139,0,240,211,39,234,31,39,188,254,222,225,153,133,37,81,54,87,236,79,171,24,114,141,193,202,97,226,175,27,108,
+  19,66,199,59,187,250,229,153,233,249,236,180,36,235,161,107,237,3,55,207,28,206,186,228,254,50,31,98,88,146,232,180,
+  103,85,251,23,151,114,220,131,35,170,192,250,74,195,171,175,255,131,99,167,27,171,100,42,60,47,43,45,178,20,30,200,
+  70,52,207,65,213,117,248,150,69,12,185,198,241,206,53,162,197,113,210,229,39,237,55,30,68,4,0,64,109,93,67,98,
+  136,110,113,5,100,164,59,78,36,49,132,0,44,11,116,117,207,5,25,205,191,175,163,237,206,20,254,167,154,26,187,213,
+  233,180,81,207,98,31,21,101,23,253,62,249,140,58,157,54,26,201,203,254,131,161,2,192,253,187,15,145,157,155,141,233,
+  169,105,108,90,78,167,141,206,204,190,50,2,210,16,253,52,250,194,216,236,4,0,80,85,125,242,122,141,32,196,31,89,
+  88,88,120,157,151,23,251,40,146,233,55,86,76,54,94,124,138,29,4,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Information2x[1910] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,214,5,29,20,51,56,165,102,131,162,0,0,7,3,73,
+  68,65,84,88,195,197,150,91,108,84,215,21,134,255,181,247,217,103,110,30,207,140,7,95,48,99,67,112,13,56,16,163,
+  36,38,82,44,5,82,85,109,26,165,17,85,43,171,37,180,64,11,69,77,85,169,141,90,69,125,169,148,23,162,190,180,
+  36,202,67,37,231,210,54,162,74,19,171,109,26,145,160,114,105,16,74,8,16,27,156,16,219,164,216,229,98,60,30,95,
+  230,62,115,174,251,156,221,135,12,21,15,5,60,17,85,143,180,180,165,163,125,214,255,173,127,95,206,2,254,207,15,213,
+  51,121,224,169,167,66,145,10,182,50,30,220,166,160,250,224,201,38,0,0,215,114,4,26,246,61,235,181,106,3,254,54,
+  180,127,191,121,199,1,190,191,231,103,123,193,248,175,90,87,173,215,83,93,189,145,182,214,86,132,195,58,52,70,240,61,
+  23,139,139,139,184,116,241,188,113,105,98,212,86,158,252,197,43,47,253,122,240,142,0,12,12,60,163,71,19,214,80,99,
+  178,229,75,189,253,91,35,16,13,200,228,171,200,85,13,184,210,1,200,135,208,128,229,137,48,122,82,9,68,4,240,247,
+  131,111,26,153,233,43,71,203,249,224,192,208,208,51,206,173,242,107,183,3,140,38,236,161,101,171,214,63,178,225,254,47,
+  7,254,53,103,194,83,121,172,106,19,184,103,117,35,98,17,225,11,206,125,203,145,170,80,117,252,201,76,78,73,87,241,
+  129,111,111,11,31,61,246,238,87,39,206,158,25,2,240,117,0,234,102,2,252,150,182,255,224,233,31,70,91,87,62,185,
+  254,129,199,66,159,206,152,232,78,105,216,180,54,138,182,68,192,143,134,132,20,26,147,156,147,212,57,247,34,33,225,183,
+  55,133,213,66,217,178,206,95,201,185,143,63,124,127,112,58,51,191,178,107,213,154,236,185,179,239,15,215,13,176,107,215,
+  79,227,164,139,55,123,31,218,22,187,186,40,177,105,77,16,157,173,58,52,14,143,49,114,25,65,18,65,50,34,23,68,
+  18,128,7,40,47,222,16,80,87,230,202,213,217,156,161,30,221,220,23,57,115,250,100,255,198,13,125,131,163,163,167,172,
+  255,166,195,110,6,192,116,182,189,185,115,99,216,246,5,218,147,132,150,132,6,2,36,72,185,68,228,48,78,54,39,178,
+  25,193,230,4,75,227,100,114,70,86,88,215,236,120,67,192,40,155,78,161,108,75,187,175,127,115,152,233,108,251,77,117,
+  110,234,63,11,236,108,237,92,23,202,85,44,172,108,211,225,195,247,136,41,151,64,14,65,57,68,176,57,35,139,49,102,
+  50,78,22,17,44,141,51,131,115,50,3,130,85,130,58,171,94,206,148,138,125,247,221,167,129,233,59,235,223,132,190,215,
+  213,16,141,227,90,166,138,128,8,0,32,9,69,46,227,176,25,145,195,137,57,196,148,100,32,23,128,239,51,82,202,87,
+  176,93,207,99,68,197,160,174,133,10,85,155,86,52,167,154,161,188,213,117,3,40,229,69,53,161,193,83,54,76,199,115,
+  130,66,115,137,224,16,200,97,140,108,198,96,127,6,65,18,32,79,3,124,87,249,84,168,184,11,193,0,87,140,200,55,
+  93,15,186,224,164,124,63,90,55,0,49,173,4,101,39,25,147,152,94,168,90,241,136,238,1,204,33,130,205,136,44,6,
+  178,56,35,155,24,115,25,65,42,95,249,89,211,157,119,164,180,131,26,11,17,145,34,34,174,0,159,49,170,214,189,7,
+  136,248,88,185,148,69,83,84,119,22,10,150,145,45,90,101,0,54,129,108,206,200,100,28,38,231,100,104,12,21,71,122,
+  179,243,37,243,188,37,229,204,154,21,137,166,160,174,85,130,140,153,203,155,194,90,174,88,182,24,211,38,235,6,240,60,
+  243,183,215,46,142,150,87,54,55,122,92,35,231,242,98,53,191,241,174,68,42,164,19,207,149,173,116,177,236,78,45,86,
+  236,137,185,188,57,92,49,220,113,193,89,54,98,207,127,165,50,55,249,104,64,104,134,174,51,227,11,109,137,229,31,142,
+  140,84,165,114,95,171,251,30,24,61,123,106,108,221,218,13,223,105,93,209,25,107,111,89,230,152,174,44,180,39,66,72,
+  37,35,45,237,77,193,110,174,92,157,60,155,251,118,57,170,193,94,29,34,123,75,50,30,237,41,148,171,83,20,108,60,
+  159,138,55,222,173,115,213,121,224,15,191,151,220,47,238,28,25,25,113,235,59,134,128,34,215,222,58,124,244,175,182,144,
+  229,96,87,75,60,50,60,153,29,55,28,47,59,126,181,240,22,152,42,45,139,133,187,58,219,146,15,38,227,209,30,14,
+  202,131,107,231,34,205,119,13,166,154,98,107,155,162,250,198,23,158,127,142,219,210,219,57,56,56,104,124,238,159,209,142,
+  61,63,233,13,233,161,127,124,115,199,110,67,137,200,228,138,166,128,34,206,51,134,233,140,69,66,90,62,28,224,37,157,
+  11,67,144,187,129,120,208,47,89,18,209,128,254,163,125,251,158,21,165,98,241,201,87,94,252,205,159,111,149,159,221,14,
+  224,213,151,158,255,216,117,173,239,158,124,247,136,72,54,134,18,153,156,117,213,54,10,9,70,74,10,206,28,157,11,131,
+  152,107,95,188,56,145,116,61,231,211,134,128,232,158,24,31,55,139,133,242,224,237,196,151,4,0,0,228,211,233,185,244,
+  181,88,88,240,144,84,158,149,158,153,45,103,231,210,73,98,76,50,93,185,239,29,59,218,158,158,157,157,212,53,81,225,
+  196,218,174,92,153,38,5,121,118,41,185,151,4,240,242,203,251,115,82,250,31,207,92,155,161,101,13,193,213,134,83,137,
+  125,244,225,177,175,93,250,231,123,219,46,126,114,116,231,216,248,201,39,86,175,140,234,4,74,112,98,61,167,78,125,16,
+  211,25,62,88,74,110,109,169,29,145,237,154,123,255,242,250,129,19,223,219,179,99,85,170,37,169,47,76,11,56,118,241,
+  110,166,128,53,221,43,16,141,69,191,232,58,85,117,240,237,195,215,28,215,25,122,113,240,185,217,59,222,19,110,223,241,
+  248,193,88,162,231,177,135,183,108,65,79,207,90,52,70,35,224,92,3,35,32,155,91,192,59,111,31,198,248,248,196,229,
+  249,140,190,238,208,161,23,236,59,234,0,0,180,54,231,31,218,178,217,134,175,24,222,120,227,79,200,46,148,224,74,15,
+  13,13,1,8,205,65,62,55,229,228,22,47,120,135,14,77,216,75,205,89,23,64,122,166,194,63,25,187,128,93,187,190,
+  129,7,251,31,128,43,61,228,22,11,152,203,100,160,148,133,11,227,89,189,144,15,118,213,147,147,213,51,217,243,228,179,
+  11,243,6,142,31,127,31,122,64,71,34,17,67,170,163,5,93,221,41,156,56,113,26,99,19,83,112,93,247,245,255,25,
+  0,231,180,239,222,123,59,48,48,240,99,104,92,0,0,28,71,226,194,133,171,232,237,237,197,250,158,46,132,66,226,91,
+  117,229,172,103,114,119,119,243,211,154,166,132,97,76,161,92,54,65,76,67,161,88,130,16,192,232,185,143,48,53,121,25,
+  217,92,241,82,60,238,255,110,102,198,148,183,234,134,235,57,5,90,45,68,127,127,199,186,198,198,208,94,33,2,79,0,
+  42,204,57,131,82,62,148,98,80,138,103,149,50,14,159,57,147,249,229,252,124,177,252,89,147,10,23,128,172,141,238,231,
+  113,64,7,16,168,69,112,122,186,100,78,78,102,135,59,59,123,101,115,115,119,223,238,221,63,215,54,109,122,4,211,211,
+  101,59,157,174,28,56,114,100,228,213,106,213,22,181,239,168,182,196,215,131,106,80,75,6,160,27,170,255,143,11,0,66,
+  233,116,122,186,163,163,227,158,177,177,177,214,209,209,81,63,159,207,143,29,63,126,252,143,158,231,121,0,252,154,208,117,
+  7,84,237,157,95,115,163,174,37,160,154,168,94,27,69,13,68,7,16,104,111,111,111,246,125,159,103,50,153,98,77,192,
+  5,96,215,66,214,194,1,96,221,108,9,234,185,9,175,91,170,213,156,187,209,94,220,80,229,245,74,175,187,113,203,141,
+  248,111,77,74,60,229,108,227,134,136,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Question1x[932] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,0,25,116,69,88,116,83,111,102,116,119,97,114,
+  101,0,119,119,119,46,105,110,107,115,99,97,112,101,46,111,114,103,155,238,60,26,0,0,3,54,73,68,65,84,56,141,
+  109,147,91,108,84,101,20,133,191,243,255,231,90,81,26,192,134,78,161,244,54,237,128,78,169,83,130,5,77,83,46,70,
+  45,250,162,162,134,196,132,152,24,19,43,6,73,76,39,65,140,105,162,173,23,36,241,65,13,137,17,210,248,224,131,9,
+  160,71,35,130,142,213,160,5,105,25,90,219,130,99,167,98,157,161,45,80,123,153,105,167,118,206,239,67,75,3,193,157,
+  236,151,157,189,87,214,94,89,75,83,74,113,99,21,111,107,9,0,207,0,117,64,112,126,220,5,68,128,214,184,27,238,
+  187,113,95,187,14,80,188,173,69,0,141,139,114,204,87,119,62,186,206,190,39,224,19,149,229,249,0,156,191,152,164,243,
+  66,194,59,116,236,215,204,100,122,166,9,120,59,238,134,189,5,128,249,227,182,251,170,138,66,45,47,61,236,156,138,14,
+  112,162,61,70,79,255,48,0,107,74,242,120,160,198,207,198,181,171,8,191,255,245,212,79,157,3,29,64,109,220,13,123,
+  250,60,147,198,77,235,74,67,111,238,122,200,217,179,255,75,174,141,165,217,251,220,102,42,253,249,164,167,102,248,161,35,
+  78,171,219,201,241,95,98,188,187,231,17,231,149,3,110,245,143,29,241,70,160,153,162,250,230,64,112,251,123,169,191,135,
+  199,212,211,225,79,85,81,125,179,122,177,229,136,202,102,61,213,211,63,164,70,199,211,74,41,165,78,158,142,169,154,157,
+  31,169,134,183,190,80,137,145,113,21,220,190,63,93,84,223,28,144,185,254,173,47,191,240,228,134,77,163,227,105,237,208,
+  177,179,0,24,134,206,103,199,207,115,216,61,71,123,247,95,60,190,229,110,86,46,207,229,243,239,123,25,25,77,81,186,
+  98,9,37,43,150,202,83,209,63,39,4,80,87,85,225,211,78,180,199,0,176,76,157,75,151,199,72,94,77,97,91,6,
+  85,21,62,0,174,254,147,198,48,116,114,28,139,206,223,135,8,173,46,16,82,136,58,29,8,6,203,150,19,189,152,196,
+  48,36,166,105,96,89,6,150,105,16,10,20,176,123,199,70,148,82,28,60,218,129,99,91,8,161,145,184,50,201,234,226,
+  60,60,165,130,215,69,68,8,13,67,215,49,141,185,182,76,131,189,207,214,98,234,146,195,95,69,233,187,52,74,142,99,
+  34,132,192,177,76,52,52,52,64,0,93,93,177,203,132,2,5,24,134,156,99,97,232,44,190,221,102,32,57,198,153,222,
+  4,109,209,65,28,219,196,177,45,114,28,147,242,194,101,196,6,175,33,164,232,18,64,228,220,133,132,183,101,125,25,186,
+  46,209,117,137,97,232,104,66,240,115,247,32,167,123,147,72,41,177,109,99,1,164,210,159,71,247,31,67,94,54,235,69,
+  4,208,250,241,145,51,153,13,107,87,177,254,174,149,232,82,162,75,65,238,34,135,221,79,221,75,195,99,213,228,56,38,
+  150,101,98,219,38,107,138,239,164,204,151,203,129,214,72,70,41,213,42,226,110,184,111,34,149,105,218,247,193,55,83,175,
+  63,191,153,80,192,135,148,2,41,181,5,191,27,243,186,4,10,151,240,68,109,41,175,125,248,237,244,68,42,211,20,119,
+  195,125,55,89,121,107,141,191,250,141,134,7,237,104,108,152,104,108,152,196,149,73,108,123,238,231,202,210,101,148,228,47,
+  166,233,224,201,105,183,173,231,236,204,191,179,181,113,55,236,221,18,166,59,110,179,247,237,218,113,191,93,85,225,211,202,
+  11,151,162,105,26,241,196,40,191,245,143,120,239,124,242,93,102,124,114,186,41,235,121,55,135,233,255,226,44,165,168,83,
+  74,5,1,164,148,93,179,179,217,136,82,234,150,56,255,7,102,247,76,148,162,219,138,97,0,0,0,0,73,69,78,68,
+  174,66,96,130,
+};
+const unsigned char Question2x[2231] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,8,110,73,68,65,84,88,133,197,151,123,112,85,
+  213,21,198,127,123,159,115,110,110,110,222,185,151,32,132,71,94,4,18,2,17,5,5,34,5,68,10,162,40,214,226,76,
+  167,117,168,118,172,163,51,58,99,103,180,211,135,109,28,43,125,77,255,104,203,216,86,29,41,118,170,69,198,231,12,161,
+  169,160,17,90,1,141,65,30,1,204,131,36,74,66,66,114,243,188,175,220,220,179,119,255,56,231,222,36,213,25,105,167,
+  51,238,153,53,231,220,57,119,175,245,157,111,125,107,173,179,225,75,94,226,74,255,184,110,93,173,217,145,97,173,17,136,
+  237,2,177,70,67,0,200,113,31,143,8,24,16,232,35,54,122,95,113,120,226,72,67,67,109,226,255,2,160,104,91,109,
+  174,24,79,251,49,130,251,202,230,205,224,198,21,165,89,43,170,230,138,171,2,89,248,179,211,1,24,28,141,210,27,28,
+  163,177,249,162,62,244,65,251,88,107,231,101,208,60,171,211,198,127,214,249,122,237,240,255,12,160,104,243,206,135,165,33,
+  158,220,92,179,40,253,254,175,175,180,202,231,5,174,136,179,182,79,131,60,243,202,241,137,253,135,207,70,149,150,143,119,
+  214,125,255,119,255,21,128,162,117,181,94,237,243,254,117,113,233,204,77,79,62,248,213,140,202,226,2,16,142,227,127,157,
+  252,132,19,31,95,34,56,26,97,112,36,134,16,16,200,77,199,159,147,193,178,242,89,172,94,58,151,146,57,249,0,124,
+  220,217,207,227,79,191,21,62,221,214,91,79,56,250,205,206,134,218,216,23,2,88,188,189,214,19,14,167,189,191,109,125,
+  85,197,79,238,223,224,73,247,88,180,126,26,228,185,55,26,105,60,219,141,52,36,134,148,8,33,144,82,32,16,41,47,
+  90,107,180,214,44,175,40,100,199,45,87,83,58,39,159,88,60,193,83,207,190,29,127,229,208,233,115,62,95,236,186,230,
+  125,181,241,169,241,140,233,225,181,200,44,62,246,234,182,27,171,86,238,124,104,83,154,101,26,188,222,112,150,39,158,123,
+  155,75,3,33,76,211,192,154,98,166,97,96,154,6,134,41,49,12,137,105,24,72,67,114,41,24,226,173,227,237,100,249,
+  210,168,44,158,193,141,43,74,141,190,161,112,222,201,150,129,107,134,91,14,238,133,39,62,31,64,241,22,239,163,171,174,
+  46,186,247,55,143,220,146,110,24,146,223,239,61,202,158,253,31,97,24,6,166,105,98,89,110,112,203,249,109,154,198,164,
+  73,3,195,101,199,48,36,0,141,231,123,8,69,226,92,91,49,155,53,203,138,205,51,237,125,115,67,217,251,227,67,45,
+  7,223,251,76,10,10,239,216,233,207,212,86,203,155,191,253,118,254,188,153,185,188,84,127,146,231,222,248,16,211,50,167,
+  188,173,100,105,217,12,150,148,20,80,81,20,160,32,207,71,110,86,58,227,241,4,125,131,97,154,90,250,168,63,222,65,
+  40,26,199,86,10,219,86,36,108,197,221,155,151,114,231,250,10,46,94,30,101,235,195,187,7,71,137,151,119,191,246,195,
+  224,52,6,252,165,55,237,186,231,246,229,215,223,188,122,161,60,115,161,143,159,239,57,140,105,24,88,46,0,203,114,238,
+  127,253,192,87,88,52,223,207,140,92,31,62,175,7,195,144,164,121,76,242,178,188,44,154,159,207,170,170,217,156,106,239,
+  39,22,183,29,157,0,167,218,251,168,46,155,73,73,97,30,19,182,242,156,56,221,93,48,212,114,240,77,0,9,176,120,
+  93,109,166,101,202,187,238,185,109,133,161,209,60,189,239,56,82,200,105,20,59,64,76,132,16,8,225,16,23,79,40,226,
+  9,133,148,18,233,10,51,63,203,203,246,245,11,177,44,19,143,101,98,89,38,134,52,216,189,255,35,52,112,247,150,107,
+  12,211,52,238,90,188,174,54,19,192,4,136,248,188,91,214,94,93,44,243,179,211,57,213,214,75,203,39,65,60,30,115,
+  138,232,220,52,152,6,9,91,113,252,124,63,239,53,247,210,59,20,193,16,130,13,203,231,115,123,77,105,10,92,229,124,
+  63,30,203,36,33,109,92,172,116,116,15,115,174,115,128,202,162,0,107,175,45,145,7,143,182,110,1,94,150,142,246,245,
+  142,155,174,91,224,67,192,145,143,186,28,49,25,78,222,13,55,247,73,48,191,120,233,4,175,253,243,2,3,163,227,164,
+  121,44,44,143,197,217,174,65,180,214,41,49,75,73,138,177,169,44,190,223,220,13,192,198,149,229,62,33,197,142,20,3,
+  104,150,85,149,205,4,160,245,147,224,52,53,155,198,100,42,44,211,36,52,110,99,89,166,11,78,34,165,96,205,146,194,
+  84,15,208,90,115,177,63,140,101,25,174,107,141,214,160,148,230,194,165,33,0,42,75,10,208,90,47,155,4,32,240,23,
+  228,103,2,78,95,151,110,240,169,230,0,145,147,61,192,181,154,197,87,177,170,114,102,42,184,173,20,239,158,238,195,50,
+  13,208,78,115,82,74,99,24,146,145,208,56,8,193,140,220,12,52,218,63,149,1,242,220,193,50,22,137,187,162,18,147,
+  64,164,147,18,195,109,60,201,210,92,187,116,22,107,22,79,9,110,219,28,104,236,166,103,48,138,105,24,78,96,37,49,
+  108,199,79,36,230,12,200,156,204,180,84,253,203,100,55,24,26,141,186,15,189,72,33,166,155,148,24,82,76,99,163,186,
+  56,159,213,139,2,40,165,80,74,97,219,54,117,31,94,226,227,238,49,183,59,78,111,76,82,10,178,51,189,0,140,132,
+  199,83,45,72,2,8,77,176,127,40,12,64,32,207,135,16,56,138,150,142,73,41,16,46,43,73,135,215,47,244,167,130,
+  43,165,56,214,50,68,87,127,212,101,202,1,156,100,82,184,47,146,159,237,0,8,14,71,16,16,156,4,32,228,137,230,
+  11,151,1,88,56,47,224,212,185,16,8,64,32,220,242,34,85,102,82,8,178,211,141,20,245,74,41,218,250,34,41,134,
+  164,16,8,145,188,58,123,17,130,146,217,121,0,156,235,236,71,72,121,34,165,1,173,245,158,67,199,219,214,221,177,190,
+  210,87,179,116,46,7,142,182,77,246,104,145,188,76,25,156,66,240,135,250,14,210,60,22,30,143,133,199,99,162,52,169,
+  6,229,226,159,178,156,221,203,23,205,2,224,173,99,173,17,101,171,61,41,0,190,72,172,238,72,211,5,53,60,22,163,
+  178,164,128,5,243,252,116,245,142,144,20,104,242,77,209,201,178,210,236,88,59,39,53,146,1,94,62,214,143,82,202,97,
+  36,185,7,141,118,157,20,205,202,97,193,156,124,70,67,227,188,243,126,171,242,69,98,117,169,20,52,55,212,134,18,9,
+  181,247,47,117,77,182,0,238,189,117,25,66,8,215,153,83,199,201,123,165,52,202,86,88,6,88,6,152,210,177,248,68,
+  130,137,132,77,194,86,40,91,57,255,83,26,173,28,224,119,173,175,0,1,127,251,199,73,219,182,213,222,230,134,218,208,
+  100,21,0,241,132,245,216,238,215,62,24,238,238,31,99,209,124,63,223,216,88,229,4,87,78,142,237,228,213,157,112,83,
+  5,168,148,34,62,49,193,196,132,77,34,97,147,176,109,108,219,78,61,219,90,83,70,105,97,46,125,193,16,127,218,119,
+  108,56,22,183,30,75,198,77,77,195,209,246,250,104,78,217,6,221,209,51,92,179,185,166,220,170,44,10,16,142,77,208,
+  222,61,228,40,90,72,167,34,132,147,209,107,74,115,177,181,38,97,59,160,62,104,27,38,97,43,7,128,203,196,68,194,
+  230,134,37,133,108,93,93,74,194,86,252,96,87,125,164,173,171,255,169,174,3,143,30,250,15,137,37,151,22,165,183,254,
+  234,245,237,155,170,55,253,244,187,27,210,132,16,28,106,236,96,239,161,115,72,41,221,233,150,252,24,113,155,147,91,102,
+  90,131,210,14,253,9,55,5,183,173,46,225,134,37,133,104,96,231,243,13,227,47,214,53,213,183,189,249,232,54,16,250,
+  51,12,56,235,9,102,87,223,240,234,201,243,3,91,7,70,162,129,85,75,231,25,11,230,250,169,46,43,32,56,26,165,
+  111,40,226,64,118,183,39,243,60,245,227,35,97,219,44,40,204,229,91,27,43,168,42,14,48,62,97,243,203,23,14,199,
+  95,172,107,58,147,150,22,217,220,127,118,189,61,189,62,62,103,205,89,245,72,186,149,31,120,169,186,124,206,198,167,30,
+  186,217,87,234,126,229,94,188,60,202,169,246,126,90,187,135,24,11,79,48,22,139,35,133,32,39,211,75,142,47,141,178,
+  194,92,170,138,253,204,14,56,115,165,227,210,48,63,218,245,247,104,83,243,133,119,123,143,189,112,95,116,176,45,8,68,
+  191,16,0,224,3,178,11,215,126,239,65,111,118,224,145,59,55,44,243,126,231,107,43,204,249,87,229,94,209,81,234,211,
+  203,163,60,255,70,99,226,229,3,31,142,71,131,93,207,116,31,253,227,110,96,204,181,33,64,125,17,128,52,32,11,200,
+  74,47,40,157,237,175,220,246,128,149,225,223,86,85,58,75,108,94,83,153,126,109,69,161,152,145,231,35,39,195,11,2,
+  70,67,227,12,140,68,104,58,223,163,235,14,55,199,206,180,246,232,216,88,79,125,240,212,171,127,30,31,238,233,117,3,
+  135,128,65,32,124,37,12,128,83,162,25,64,54,144,97,89,190,172,236,242,141,43,125,5,11,54,90,233,217,213,96,228,
+  104,33,125,142,19,21,69,219,163,241,240,208,153,72,223,249,119,70,219,222,105,74,36,98,33,28,186,67,192,176,11,226,
+  51,231,197,43,61,156,26,128,5,120,93,118,188,56,93,212,114,129,42,192,6,226,174,197,128,113,247,254,138,14,169,95,
+  218,250,55,61,135,185,234,249,164,187,3,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Warning1x[603] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,16,0,0,0,16,8,6,0,0,0,31,243,255,
+  97,0,0,0,6,98,75,71,68,0,255,0,255,0,255,160,189,167,147,0,0,0,9,112,72,89,115,0,0,11,19,0,
+  0,11,19,1,0,154,156,24,0,0,0,7,116,73,77,69,7,214,2,16,14,39,45,183,238,146,119,0,0,1,232,73,
+  68,65,84,56,203,149,147,193,74,27,97,20,133,191,59,153,206,52,137,51,131,16,153,74,237,70,67,196,32,134,65,74,
+  154,48,4,130,72,99,131,116,23,186,16,34,93,116,231,48,27,241,9,92,27,116,101,192,66,192,69,73,86,5,173,175,
+  80,8,62,128,80,92,4,10,133,22,92,212,64,73,49,127,55,214,18,200,180,246,192,189,139,203,225,59,103,115,133,8,
+  133,240,200,128,183,0,3,120,221,128,47,227,124,122,20,192,132,163,121,120,14,112,1,71,64,117,156,79,139,72,247,82,
+  176,90,88,88,208,158,164,82,90,10,86,67,240,238,13,48,97,47,13,122,98,119,151,76,179,73,26,116,19,246,238,5,
+  8,161,56,5,197,108,185,44,122,62,143,158,207,147,45,151,101,10,138,33,20,249,151,118,160,123,2,195,94,167,163,60,
+  207,83,158,231,169,94,167,163,78,96,184,3,221,191,54,8,97,197,133,165,140,239,139,225,251,56,142,131,227,56,24,190,
+  79,198,247,197,133,165,16,86,34,1,38,236,103,193,72,4,1,162,105,88,150,133,101,89,136,166,145,8,2,178,96,152,
+  176,63,22,16,194,250,52,164,231,10,5,140,82,9,17,193,182,109,108,219,70,68,48,74,37,230,10,5,166,33,29,194,
+  250,8,32,4,49,160,177,120,155,174,233,58,34,242,167,129,8,154,174,147,8,2,22,193,48,160,17,130,192,237,10,225,
+  213,44,180,94,44,47,27,147,103,103,16,139,161,148,162,223,239,3,144,76,38,17,17,184,185,225,106,109,141,15,231,231,
+  131,75,168,55,224,157,132,16,123,12,87,79,193,154,63,62,230,97,181,138,82,10,165,20,181,90,13,128,118,187,141,136,
+  32,34,252,56,61,229,98,99,131,46,124,255,12,147,154,192,102,28,204,153,92,142,120,165,114,103,20,17,92,215,197,117,
+  221,145,91,188,82,97,38,151,35,14,166,192,166,108,195,215,151,144,154,61,56,96,162,94,191,75,255,61,192,8,64,68,
+  184,110,181,184,220,218,226,61,124,147,67,24,62,3,121,192,255,233,39,240,17,148,254,9,14,7,240,102,34,226,47,162,
+  116,13,195,30,52,127,1,151,222,125,8,28,180,225,19,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const unsigned char Warning2x[1391] = {
+  137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,32,0,0,0,32,8,6,0,0,0,115,122,122,
+  244,0,0,0,4,115,66,73,84,8,8,8,8,124,8,100,136,0,0,5,38,73,68,65,84,88,133,229,151,91,104,84,
+  71,24,128,191,153,115,206,238,217,139,187,49,137,171,89,27,147,38,235,221,136,203,170,136,151,120,201,130,151,128,196,10,
+  86,68,163,21,31,52,144,82,21,37,245,130,90,91,233,131,136,125,242,197,198,88,106,31,242,34,141,32,38,18,163,162,
+  96,144,32,68,37,17,188,34,102,19,132,218,205,198,102,147,120,206,233,67,146,37,38,70,155,139,79,253,97,152,97,102,
+  254,255,255,254,51,255,204,207,129,255,187,40,35,81,46,7,101,38,40,215,193,28,174,13,57,92,197,95,97,111,59,252,
+  157,9,177,50,56,62,92,59,98,56,74,101,144,111,79,73,249,51,180,105,147,130,97,80,119,225,66,87,60,26,221,246,
+  13,252,241,217,1,202,65,105,23,162,113,110,113,113,182,250,224,129,16,170,74,60,45,205,186,119,254,124,115,20,190,252,
+  22,58,134,98,111,200,71,208,6,133,41,193,96,166,91,81,68,172,166,134,88,117,53,222,228,100,225,9,4,82,220,80,
+  52,84,123,67,2,40,7,135,162,40,63,79,89,181,74,109,189,116,9,153,154,10,169,169,196,42,43,153,22,14,219,164,
+  16,199,206,65,210,103,3,248,7,138,211,22,47,30,171,181,180,208,241,248,49,250,129,3,56,142,29,35,222,208,128,222,
+  209,129,47,39,199,46,224,251,207,2,112,1,198,42,186,126,56,176,124,185,214,122,249,50,202,172,89,104,249,249,216,194,
+  97,212,185,115,137,93,189,74,246,226,197,54,169,170,223,149,66,250,168,3,116,194,161,244,188,60,187,249,240,33,93,145,
+  8,250,254,253,8,217,173,238,40,41,161,243,213,43,148,166,38,252,161,144,144,112,98,84,1,74,33,221,238,245,22,103,
+  206,155,167,197,170,170,208,150,46,69,91,184,16,33,4,66,8,180,96,16,219,234,213,196,110,220,32,35,24,212,164,195,
+  177,233,28,228,140,26,128,132,19,153,43,87,138,206,59,119,48,98,49,244,125,251,16,162,251,6,247,246,206,253,251,49,
+  98,49,204,198,70,50,230,205,51,37,156,26,21,128,179,48,203,49,126,252,38,255,148,41,106,219,245,235,216,10,10,80,
+  167,79,199,48,12,90,91,91,137,70,163,152,166,137,146,145,129,99,203,22,222,214,214,226,15,4,84,213,235,93,81,10,
+  43,70,12,160,194,169,236,252,124,43,94,83,131,101,89,56,118,239,6,32,18,137,16,12,6,9,6,131,68,34,17,132,
+  16,56,139,139,177,20,133,174,123,247,200,154,63,31,21,78,91,159,120,236,62,10,80,6,185,238,172,172,188,212,148,20,
+  229,109,109,45,246,173,91,145,126,63,66,8,92,46,87,98,159,203,229,66,8,129,76,73,193,85,84,68,251,253,251,164,
+  38,39,75,155,207,55,173,12,190,30,22,128,5,66,8,241,203,212,53,107,120,91,85,133,112,187,209,119,238,76,156,121,
+  127,0,232,206,7,231,142,29,200,113,227,136,215,213,145,29,10,169,18,78,150,131,109,200,0,231,225,171,164,217,179,115,
+  220,166,41,219,235,235,177,239,218,133,76,74,74,56,114,56,28,40,138,130,162,40,232,186,158,184,17,210,233,196,181,119,
+  47,29,79,158,224,149,82,184,38,77,242,189,133,93,67,2,56,10,170,84,148,147,83,194,97,217,118,229,10,210,239,71,
+  47,44,76,56,73,100,190,211,137,211,233,124,111,94,8,129,115,195,6,180,169,83,105,175,171,35,43,39,71,83,164,252,
+  225,119,240,252,103,128,12,216,225,91,176,96,162,253,245,107,209,241,244,41,142,61,123,144,186,158,136,190,183,247,120,60,
+  120,60,158,1,96,82,85,241,28,58,68,87,115,51,142,104,20,111,86,150,110,12,242,68,15,0,248,13,92,138,174,255,
+  148,149,155,171,197,42,43,81,103,204,64,47,40,24,224,92,8,49,224,11,244,93,115,132,195,216,23,45,34,94,95,79,
+  230,228,201,54,161,105,123,206,195,196,79,2,152,176,119,98,110,238,24,217,216,72,87,75,11,206,146,18,144,114,128,3,
+  128,138,138,10,42,42,42,6,28,65,111,75,58,114,4,35,22,67,109,106,98,92,32,128,5,63,126,20,160,20,198,217,
+  188,222,146,140,80,72,139,85,87,163,45,90,132,182,100,201,7,157,11,33,216,182,109,27,133,61,185,209,119,189,183,217,
+  231,204,193,181,110,29,29,143,30,49,209,239,183,73,93,47,44,131,153,131,2,40,112,120,82,94,158,106,222,189,139,209,
+  214,134,179,164,100,208,232,132,16,104,154,134,236,41,72,253,215,122,231,146,14,30,196,178,44,196,139,23,164,5,2,38,
+  253,158,232,4,64,41,100,217,124,190,162,180,236,108,173,237,214,45,236,107,215,162,229,228,12,26,189,16,130,242,242,114,
+  46,94,188,56,168,115,33,4,182,204,76,60,219,183,211,249,236,25,19,188,94,85,115,187,195,101,144,219,235,87,237,19,
+  253,241,204,101,203,172,174,219,183,49,227,113,244,245,235,161,181,21,171,199,24,66,188,55,78,180,110,111,88,125,250,254,
+  123,220,27,55,18,61,115,6,243,249,115,252,233,233,214,203,134,134,147,192,252,190,0,210,130,124,95,118,182,26,187,118,
+  13,128,232,150,45,253,243,101,196,98,188,121,67,82,122,186,242,28,66,71,65,63,10,241,94,0,231,59,104,142,220,188,
+  57,230,139,205,155,165,212,52,176,44,44,195,0,211,196,50,140,238,177,97,96,153,102,119,223,111,60,96,173,255,156,105,
+  98,198,227,52,191,124,105,89,240,215,209,158,34,213,91,169,92,69,176,34,4,103,37,248,70,61,244,62,98,194,235,251,
+  176,243,52,92,2,186,250,150,202,36,96,236,52,152,160,128,110,246,201,143,145,138,132,119,128,48,32,222,8,77,64,11,
+  208,14,3,107,181,2,232,128,157,17,252,182,125,64,76,160,11,232,236,105,214,40,218,30,153,252,11,112,11,162,158,225,
+  77,47,180,0,0,0,0,73,69,78,68,174,66,96,130,
+};
+}
+}
@@ -0,0 +1,196 @@
+namespace Icon {
+namespace Action {
+extern const unsigned char Add1x[323];
+extern const unsigned char Add2x[601];
+extern const unsigned char Attach1x[649];
+extern const unsigned char Attach2x[1747];
+extern const unsigned char Bookmark1x[686];
+extern const unsigned char Bookmark2x[1532];
+extern const unsigned char Close1x[586];
+extern const unsigned char Close2x[2045];
+extern const unsigned char FullScreen1x[650];
+extern const unsigned char FullScreen2x[1256];
+extern const unsigned char Mute1x[632];
+extern const unsigned char Mute2x[1789];
+extern const unsigned char NewFile1x[477];
+extern const unsigned char NewFile2x[1008];
+extern const unsigned char NewFolder1x[635];
+extern const unsigned char NewFolder2x[1399];
+extern const unsigned char Open1x[672];
+extern const unsigned char Open2x[1550];
+extern const unsigned char Properties1x[464];
+extern const unsigned char Properties2x[1115];
+extern const unsigned char Quit1x[799];
+extern const unsigned char Quit2x[1725];
+extern const unsigned char Refresh1x[912];
+extern const unsigned char Refresh2x[2024];
+extern const unsigned char Remove1x[247];
+extern const unsigned char Remove2x[317];
+extern const unsigned char Save1x[911];
+extern const unsigned char Save2x[1971];
+extern const unsigned char Search1x[935];
+extern const unsigned char Search2x[2215];
+extern const unsigned char Settings1x[611];
+extern const unsigned char Settings2x[2129];
+extern const unsigned char Stop1x[820];
+extern const unsigned char Stop2x[1927];
+}
+namespace Application {
+extern const unsigned char Browser1x[928];
+extern const unsigned char Browser2x[2251];
+extern const unsigned char Calculator1x[686];
+extern const unsigned char Calculator2x[1382];
+extern const unsigned char Calendar1x[603];
+extern const unsigned char Calendar2x[1298];
+extern const unsigned char Chat1x[422];
+extern const unsigned char Chat2x[783];
+extern const unsigned char FileManager1x[378];
+extern const unsigned char FileManager2x[667];
+extern const unsigned char Mail1x[550];
+extern const unsigned char Mail2x[1426];
+extern const unsigned char Monitor1x[611];
+extern const unsigned char Monitor2x[1886];
+extern const unsigned char Terminal1x[668];
+extern const unsigned char Terminal2x[1488];
+extern const unsigned char TextEditor1x[574];
+extern const unsigned char TextEditor2x[1523];
+}
+namespace Device {
+extern const unsigned char Clock1x[897];
+extern const unsigned char Clock2x[2399];
+extern const unsigned char Display1x[662];
+extern const unsigned char Display2x[1596];
+extern const unsigned char Joypad1x[812];
+extern const unsigned char Joypad2x[1470];
+extern const unsigned char Keyboard1x[587];
+extern const unsigned char Keyboard2x[1110];
+extern const unsigned char Microphone1x[703];
+extern const unsigned char Microphone2x[2105];
+extern const unsigned char Mouse1x[720];
+extern const unsigned char Mouse2x[1695];
+extern const unsigned char Network1x[408];
+extern const unsigned char Network2x[1293];
+extern const unsigned char Optical1x[720];
+extern const unsigned char Optical2x[1338];
+extern const unsigned char Printer1x[481];
+extern const unsigned char Printer2x[917];
+extern const unsigned char Speaker1x[592];
+extern const unsigned char Speaker2x[1854];
+extern const unsigned char Storage1x[603];
+extern const unsigned char Storage2x[1155];
+extern const unsigned char Tape1x[403];
+extern const unsigned char Tape2x[664];
+}
+namespace Edit {
+extern const unsigned char Clear1x[773];
+extern const unsigned char Clear2x[1682];
+extern const unsigned char Copy1x[498];
+extern const unsigned char Copy2x[723];
+extern const unsigned char Cut1x[807];
+extern const unsigned char Cut2x[2087];
+extern const unsigned char Delete1x[680];
+extern const unsigned char Delete2x[2049];
+extern const unsigned char Find1x[617];
+extern const unsigned char Find2x[1636];
+extern const unsigned char Paste1x[561];
+extern const unsigned char Paste2x[1027];
+extern const unsigned char Redo1x[591];
+extern const unsigned char Redo2x[1502];
+extern const unsigned char Replace1x[776];
+extern const unsigned char Replace2x[2104];
+extern const unsigned char Undo1x[650];
+extern const unsigned char Undo2x[1601];
+}
+namespace Emblem {
+extern const unsigned char Archive1x[540];
+extern const unsigned char Archive2x[1067];
+extern const unsigned char Audio1x[688];
+extern const unsigned char Audio2x[1486];
+extern const unsigned char Binary1x[560];
+extern const unsigned char Binary2x[1675];
+extern const unsigned char File1x[741];
+extern const unsigned char File2x[1342];
+extern const unsigned char Folder1x[581];
+extern const unsigned char Folder2x[1176];
+extern const unsigned char FolderOpen1x[625];
+extern const unsigned char FolderOpen2x[1184];
+extern const unsigned char FolderTemplate1x[429];
+extern const unsigned char FolderTemplate2x[772];
+extern const unsigned char Font1x[627];
+extern const unsigned char Font2x[1121];
+extern const unsigned char Image1x[558];
+extern const unsigned char Image2x[1163];
+extern const unsigned char Markup1x[709];
+extern const unsigned char Markup2x[1759];
+extern const unsigned char Program1x[609];
+extern const unsigned char Program2x[1490];
+extern const unsigned char Script1x[516];
+extern const unsigned char Script2x[1416];
+extern const unsigned char Text1x[333];
+extern const unsigned char Text2x[744];
+extern const unsigned char Video1x[592];
+extern const unsigned char Video2x[1797];
+}
+namespace Go {
+extern const unsigned char Down1x[683];
+extern const unsigned char Down2x[1187];
+extern const unsigned char Home1x[606];
+extern const unsigned char Home2x[1774];
+extern const unsigned char Left1x[655];
+extern const unsigned char Left2x[1200];
+extern const unsigned char Right1x[676];
+extern const unsigned char Right2x[1219];
+extern const unsigned char Up1x[652];
+extern const unsigned char Up2x[1193];
+}
+namespace Media {
+extern const unsigned char Back1x[770];
+extern const unsigned char Back2x[1236];
+extern const unsigned char Eject1x[628];
+extern const unsigned char Eject2x[987];
+extern const unsigned char Flash1x[607];
+extern const unsigned char Flash2x[1323];
+extern const unsigned char Floppy1x[561];
+extern const unsigned char Floppy2x[890];
+extern const unsigned char Next1x[771];
+extern const unsigned char Next2x[1225];
+extern const unsigned char Optical1x[931];
+extern const unsigned char Optical2x[2288];
+extern const unsigned char Pause1x[464];
+extern const unsigned char Pause2x[481];
+extern const unsigned char Play1x[660];
+extern const unsigned char Play2x[1028];
+extern const unsigned char Record1x[653];
+extern const unsigned char Record2x[1266];
+extern const unsigned char Rewind1x[764];
+extern const unsigned char Rewind2x[1074];
+extern const unsigned char Skip1x[782];
+extern const unsigned char Skip2x[1205];
+extern const unsigned char Stop1x[429];
+extern const unsigned char Stop2x[571];
+}
+namespace Place {
+extern const unsigned char Bookmarks1x[753];
+extern const unsigned char Bookmarks2x[1738];
+extern const unsigned char Desktop1x[722];
+extern const unsigned char Desktop2x[910];
+extern const unsigned char Home1x[679];
+extern const unsigned char Home2x[1416];
+extern const unsigned char Server1x[642];
+extern const unsigned char Server2x[847];
+extern const unsigned char Settings1x[629];
+extern const unsigned char Settings2x[2240];
+extern const unsigned char Share1x[697];
+extern const unsigned char Share2x[1446];
+}
+namespace Prompt {
+extern const unsigned char Error1x[653];
+extern const unsigned char Error2x[1645];
+extern const unsigned char Information1x[863];
+extern const unsigned char Information2x[1910];
+extern const unsigned char Question1x[932];
+extern const unsigned char Question2x[2231];
+extern const unsigned char Warning1x[603];
+extern const unsigned char Warning2x[1391];
+}
+}
@@ -21,8 +21,11 @@ auto VsSystemDatabase::load() -> Status {
 
   Database database;
   database.name = "VsSystem";
-  database.list = BML::unserialize(file::read(databaseFile));
-  if(!database.list) return Status::CouldNotParse;
+  database.index = GameDatabase::open(locate("Database/VsSystem.db"), databaseFile);
+  if(!database.index) {
+    database.list = BML::unserialize(file::read(databaseFile));
+    if(!database.list) return Status::CouldNotParse;
+  }
 
   Media::databases.push_back(std::move(database));
   return Status::Successful;
@@ -31,15 +34,21 @@ auto VsSystemDatabase::load() -> Status {
 auto VsSystemDatabase::database() -> Database {
   if(load() != Status::Successful) return {};
   for(auto& database : Media::databases) {
-    if(database.name == "VsSystem") return database;
+    if(database.name != "VsSystem") continue;
+    if(!database.list) database.list = BML::unserialize(file::read(locate("Database/VsSystem.bml")));
+    return database;
   }
   return {};
 }
 
 auto VsSystemDatabase::manifest(string name) -> string {
-  auto source = database();
-  for(auto node : source.list) {
-    if(node["name"].string().iequals(name)) return BML::serialize(node);
+  if(load() != Status::Successful) return {};
+  for(auto& database : Media::databases) {
+    if(database.name != "VsSystem") continue;
+    if(database.index) return database.index->name(name);
+    for(auto node : database.list) {
+      if(node["name"].string().iequals(name)) return BML::serialize(node);
+    }
   }
   return {};
 }
@@ -64,6 +73,7 @@ auto Arcade::database() -> Database {
   auto combined = Medium::database();
   combined.name = "Arcade";
   combined.list = combined.list.clone();
+  combined.index.reset();
 
   VsSystemDatabase vsDatabase;
   auto vs = vsDatabase.database();
@@ -0,0 +1,180 @@
+//compiled form of a Database/<System>.bml game database, produced at build time by tools/bml2db.
+//each game entry is stored already serialized, with sorted sha256 and name indices,
+//so a lookup is a binary search over a mapped file instead of a parse of the whole database.
+//the format is in host byte order; it is rebuilt from the markup with every build.
+struct GameDatabase {
+  static constexpr char Signature[8] = {'a', 'r', 'e', 's', 'g', 'd', 'b', '2'};
+
+  struct Header {
+    char signature[8];
+    u64 size;     //size of the markup file this was compiled from
+    u32 crc32;    //checksum of the markup file this was compiled from
+    u32 entries;
+    u32 hashes;
+    u32 names;
+    u32 text;     //size of the text section that follows the indices
+  };
+
+  struct Entry {
+    u32 offset;
+    u32 size;
+  };
+
+  struct Hash {
+    u8 sha256[32];
+    u32 entry;
+  };
+
+  struct Name {
+    u32 offset;   //lowercase copy of the name, for case-insensitive lookups
+    u32 size;
+    u32 entry;
+  };
+
+  //returns nothing when the file is missing, malformed, or was compiled from different markup than source contains.
+  static auto open(const string& location, const string& source) -> std::shared_ptr<GameDatabase> {
+    auto database = std::make_shared<GameDatabase>();
+    if(!database->fp.open(location, file_map::mode::read)) return {};
+    if(!database->validate(source)) return {};
+    return database;
+  }
+
+  auto sha256(const string& digest) const -> string {
+    if(digest.size() != 64) return {};
+    u8 key[32];
+    for(u32 n : range(32)) key[n] = slice(digest, n * 2, 2).hex();
+    auto first = hashes(), last = hashes() + header()->hashes;
+    auto hash = std::lower_bound(first, last, key, [](const Hash& hash, const u8* key) {
+      return memory::compare(hash.sha256, key, 32) < 0;
+    });
+    if(hash == last || memory::compare(hash->sha256, key, 32)) return {};
+    return entry(hash->entry);
+  }
+
+  auto name(const string& name) const -> string {
+    auto key = string{name}.downcase();
+    auto first = names(), last = names() + header()->names;
+    auto match = std::lower_bound(first, last, key, [&](const Name& name, const string& key) {
+      return compare(name, key) < 0;
+    });
+    if(match == last || compare(*match, key)) return {};
+    return entry(match->entry);
+  }
+
+  //builds the compiled form of a markup database; only game entries with a sha256 or name are indexed.
+  static auto compile(const string& markup) -> std::vector<u8> {
+    auto document = BML::unserialize(markup);
+    std::vector<Entry> entries;
+    std::vector<Hash> hashes;
+    std::vector<Name> names;
+    string text;
+
+    for(auto node : document) {
+      if(node.name() != "game") continue;
+      string sha256 = node["sha256"].string();
+      string name = node["name"].string();
+      if(!sha256 && !name) continue;
+
+      u32 index = entries.size();
+      auto manifest = BML::serialize(node);
+      entries.push_back({text.size(), manifest.size()});
+      text.append(manifest);
+
+      if(sha256.size() == 64) {
+        Hash hash{};
+        for(u32 n : range(32)) hash.sha256[n] = slice(sha256, n * 2, 2).hex();
+        hash.entry = index;
+        hashes.push_back(hash);
+      }
+
+      if(name) {
+        name.downcase();
+        names.push_back({text.size(), name.size(), index});
+        text.append(name);
+      }
+    }
+
+    //stable sorts keep the first of any duplicate entries first, as the linear search did
+    std::ranges::stable_sort(hashes, [](const Hash& x, const Hash& y) {
+      return memory::compare(x.sha256, y.sha256, 32) < 0;
+    });
+    std::ranges::stable_sort(names, [&](const Name& x, const Name& y) {
+      return compare(text.data() + x.offset, x.size, text.data() + y.offset, y.size) < 0;
+    });
+
+    Header header{};
+    memory::copy(header.signature, Signature, sizeof(Signature));
+    header.size = markup.size();
+    header.crc32 = nall::Hash::CRC32({(const u8*)markup.data(), markup.size()}).value();
+    header.entries = entries.size();
+    header.hashes = hashes.size();
+    header.names = names.size();
+    header.text = text.size();
+
+    std::vector<u8> output;
+    auto append = [&](const void* data, u64 size) {
+      auto p = (const u8*)data;
+      output.insert(output.end(), p, p + size);
+    };
+    append(&header, sizeof(Header));
+    append(entries.data(), entries.size() * sizeof(Entry));
+    append(hashes.data(), hashes.size() * sizeof(Hash));
+    append(names.data(), names.size() * sizeof(Name));
+    append(text.data(), text.size());
+    return output;
+  }
+
+private:
+  auto header() const -> const Header* { return (const Header*)fp.data(); }
+  auto entries() const -> const Entry* { return (const Entry*)(fp.data() + sizeof(Header)); }
+  auto hashes() const -> const Hash* { return (const Hash*)(entries() + header()->entries); }
+  auto names() const -> const Name* { return (const Name*)(hashes() + header()->hashes); }
+  auto text() const -> const char* { return (const char*)(names() + header()->names); }
+
+  auto validate(const string& source) const -> bool {
+    if(fp.size() < sizeof(Header)) return false;
+    if(memory::compare(header()->signature, Signature, sizeof(Signature))) return false;
+    //the size is compared first, so that most stale files are rejected without reading the markup
+    if(header()->size != file::size(source)) return false;
+    file_map markup;
+    if(header()->size && !markup.open(source, file_map::mode::read)) return false;
+    if(header()->crc32 != nall::Hash::CRC32({markup.data(), markup.size()}).value()) return false;
+    u64 size = sizeof(Header);
+    size += (u64)header()->entries * sizeof(Entry);
+    size += (u64)header()->hashes * sizeof(Hash);
+    size += (u64)header()->names * sizeof(Name);
+    size += header()->text;
+    if(fp.size() != size) return false;
+    for(u32 index : range(header()->entries)) {
+      auto& entry = entries()[index];
+      if((u64)entry.offset + entry.size > header()->text) return false;
+    }
+    for(u32 index : range(header()->hashes)) {
+      if(hashes()[index].entry >= header()->entries) return false;
+    }
+    for(u32 index : range(header()->names)) {
+      auto& name = names()[index];
+      if(name.entry >= header()->entries || (u64)name.offset + name.size > header()->text) return false;
+    }
+    return true;
+  }
+
+  auto entry(u32 index) const -> string {
+    auto& entry = entries()[index];
+    string manifest;
+    manifest.resize(entry.size);
+    memory::copy(manifest.get(), text() + entry.offset, entry.size);
+    return manifest;
+  }
+
+  auto compare(const Name& name, const string& key) const -> s32 {
+    return compare(text() + name.offset, name.size, key.data(), key.size());
+  }
+
+  static auto compare(const char* x, u32 xsize, const char* y, u32 ysize) -> s32 {
+    if(auto result = memory::compare(x, y, min(xsize, ysize))) return result;
+    return (xsize > ysize) - (xsize < ysize);
+  }
+
+  file_map fp;
+};
@@ -3,22 +3,21 @@ struct MasterSystem : Cartridge {
   auto extensions() -> std::vector<string> override { return {"ms", "sms"}; }
   auto load(string location) -> LoadResult override;
   auto save(string location) -> bool override;
-  auto analyze(std::vector<u8>& rom) -> string;
-  auto validateHeader(std::vector<u8>& rom) -> bool;
+  auto analyze(std::span<const u8> rom) -> string;
+  auto validateHeader(std::span<const u8> rom) -> bool;
 };
 
 auto MasterSystem::load(string location) -> LoadResult {
-  std::vector<u8> rom;
+  std::shared_ptr<vfs::file> rom;
   if(directory::exists(location)) {
-    append(rom, {location, "program.rom"});
+    rom = vfs::disk::open({location, "program.rom"}, vfs::copy);
   } else if(file::exists(location)) {
-    rom = Cartridge::read(location);
-  } else {
-    return romNotFound;
+    rom = Cartridge::map(location);
   }
+  if(!rom) return romNotFound;
 
   this->location = location;
-  this->manifest = analyze(rom);
+  this->manifest = analyze({rom->data(), rom->size()});
   auto document = BML::unserialize(manifest);
   if(!document) return couldNotParseManifest;
 
@@ -48,7 +47,7 @@ auto MasterSystem::save(string location) -> bool {
   return true;
 }
 
-auto MasterSystem::analyze(std::vector<u8>& rom) -> string {
+auto MasterSystem::analyze(std::span<const u8> rom) -> string {
   string hash   = Hash::SHA256(rom).digest();
   string board  = "Sega";
   string region = "NTSC-J, NTSC-U, PAL";  //database required to detect region
@@ -490,7 +489,7 @@ auto MasterSystem::analyze(std::vector<u8>& rom) -> string {
 
 // Validate header: returns true if the header will be accepted by international bios versions
 // NOTE: This does not validate checksum, only region code and 'TMR SEGA' presence
-auto MasterSystem::validateHeader(std::vector<u8>& rom) -> bool {
+auto MasterSystem::validateHeader(std::span<const u8> rom) -> bool {
   if(rom.size() < 0x200) return false;
 
   //Locate "TMR SEGA" header
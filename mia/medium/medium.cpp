@@ -100,7 +100,9 @@ auto Medium::loadDatabase() -> bool {
   database.name = name();
   auto databaseFile = locate({"Database/", name(), ".bml"});
   if(inode::exists(databaseFile)) {
-    database.list = BML::unserialize(file::read(databaseFile));
+    //prefer the compiled index, which avoids parsing the whole database up front
+    database.index = GameDatabase::open(locate({"Database/", name(), ".db"}), databaseFile);
+    if(!database.index) database.list = BML::unserialize(file::read(databaseFile));
     Media::databases.push_back(std::move(database));
     return true;
   }
@@ -115,6 +117,9 @@ auto Medium::database() -> Database {
   //search the database for a given sha256 game entry
   for(auto& database : Media::databases) {
     if (database.name == name()) {
+      if(!database.list) {
+        database.list = BML::unserialize(file::read(locate({"Database/", name(), ".bml"})));
+      }
       return database;
     }
   }
@@ -129,6 +134,7 @@ auto Medium::manifestDatabase(string sha256) -> string {
   //search the database for a given sha256 game entry
   for(auto& database : Media::databases) {
     if(database.name == name()) {
+      if(database.index) return database.index->sha256(sha256);
       for(auto node : database.list) {
         if(node["sha256"].string() == sha256) {
           return BML::serialize(node);
@@ -148,6 +154,7 @@ auto Medium::manifestDatabaseArcade(string rom) -> string {
   //search the database for a given named game entry
   for(auto& database : Media::databases) {
     if(database.name == name()) {
+      if(database.index) return database.index->name(rom);
       for(auto node : database.list) {
         if(node["name"].string().iequals(rom)) {
           return BML::serialize(node);
@@ -1,6 +1,9 @@
+#include "game-database.hpp"
+
 struct Database {
   string name;
-  Markup::Node list;
+  Markup::Node list;                     //parsed on demand when index is available
+  std::shared_ptr<GameDatabase> index;
 };
 
 struct Medium : Pak {
@@ -124,12 +124,12 @@ auto NeoGeo::load(string location) -> LoadResult {
   pak->setAttribute("title",   document["game/title"].string());
   pak->setAttribute("board",   document["game/board"].string());
   pak->append("manifest.bml",  manifest);
-  pak->append("program.rom",   programROM);
-  pak->append("music.rom",     musicROM);
-  pak->append("character.rom", characterROM);
-  pak->append("static.rom",    staticROM);
-  pak->append("voice-a.rom",   voiceAROM);
-  pak->append("voice-b.rom",   voiceBROM);
+  pak->append("program.rom",   std::move(programROM));
+  pak->append("music.rom",     std::move(musicROM));
+  pak->append("character.rom", std::move(characterROM));
+  pak->append("static.rom",    std::move(staticROM));
+  pak->append("voice-a.rom",   std::move(voiceAROM));
+  pak->append("voice-b.rom",   std::move(voiceBROM));
   return successful;
 }
 
@@ -3,7 +3,8 @@ struct Nintendo64 : Cartridge {
   auto extensions() -> std::vector<string> override { return {"n64", "v64", "z64"}; }
   auto load(string location) -> LoadResult override;
   auto save(string location) -> bool override;
-  auto analyze(std::vector<u8>& rom) -> string;
+  auto analyze(std::span<const u8> rom, string cic) -> string;
+  auto byteswap(std::span<u8> data, u32 pass) -> void;
   auto cic_detect(std::span<const u8> ipl3) -> string;
   auto ipl2checksum(u32 seed, std::span<const u8> rom) -> u64;
 };
@@ -84,18 +85,52 @@ auto Nintendo64::ipl2checksum(u32 seed, std::span<const u8> rom) -> u64 {
 }
 
 auto Nintendo64::load(string location) -> LoadResult {
-  std::vector<u8> rom;
+  std::shared_ptr<vfs::file> rom;
   if(directory::exists(location)) {
-    append(rom, {location, "program.rom"});
+    rom = vfs::disk::open({location, "program.rom"}, vfs::copy);
   } else if(file::exists(location)) {
-    rom = Cartridge::read(location);
+    rom = Cartridge::map(location);
   }
-  if(rom.empty()) return romNotFound;
+  if(!rom || !rom->size()) return romNotFound;
 
+  this->sha256   = Hash::SHA256({rom->data(), rom->size()}).digest();
+
+  //detect endianness of the ROM by checking the IPL3 checksum. We run the same
+  //checksum algorithm with the various seeds provided by the various CICs, and
+  //check if the checksum matches. If it doesn't, we try byte-swapping the ROM
+  //and running the checksum again.
+  //this also works for modern IPL3s variants (proprietary or open source),
+  //as long as they are used with a CIC we know of.
+  //only a copy of the header is swapped here; big-endian images are never copied.
+  string cic;
+  u32 passes = 0;
+  if(rom->size() >= 0x1000) {
+    std::vector<u8> header{rom->data(), rom->data() + 0x1000};
+    cic = cic_detect({&header[0x40], 0xfc0});
+    if(cic == "") {
+      //check if byte-swapped
+      byteswap(header, passes = 1);
+      cic = cic_detect({&header[0x40], 0xfc0});
+    }
+    if(cic == "") {
+      //check if little-endian
+      byteswap(header, passes = 2);
+      cic = cic_detect({&header[0x40], 0xfc0});
+    }
+    if(cic == "") {
+      //no match is found. Fallback to CIC 6102, big-endian (the ROM is left as is).
+      passes = 0;
+      cic = "CIC-NUS-6102";
+    }
+  }
+  if(passes) {
+    auto image = vfs::memory::open({rom->data(), rom->size()});
+    for(u32 pass = 1; pass <= passes; pass++) byteswap({image->data(), image->size()}, pass);
+    rom = image;
+  }
 
-  this->sha256   = Hash::SHA256(rom).digest();
   this->location = location;
-  this->manifest = analyze(rom);
+  this->manifest = analyze({rom->data(), rom->size()}, cic);
   auto document = BML::unserialize(manifest);
   if(!document) return couldNotParseManifest;
 
@@ -112,6 +147,7 @@ auto Nintendo64::load(string location) -> LoadResult {
   pak->setAttribute("tpak",   (bool)document["game/transferpak"]);
   pak->setAttribute("cic",    document["game/board/cic"].string());
   pak->setAttribute("dd",     (bool)document["game/dd"]);
+  pak->setAttribute("sha256", sha256);
   pak->append("manifest.bml", manifest);
   pak->append("program.rom",  rom);
 
@@ -129,6 +165,10 @@ auto Nintendo64::load(string location) -> LoadResult {
     Medium::load(node, ".rtc");
   }
 
+  //recompiler warm-up profile: block entry points recorded by the CPU recompiler during play.
+  pak->append("jit.profile", 64_KiB);
+  Medium::load("jit.profile", ".jit");
+
   return successful;
 }
 
@@ -147,6 +187,10 @@ auto Nintendo64::save(string location) -> bool {
   if(auto node = document["game/board/memory(type=RTC,content=Save)"]) {
     Medium::save(node, ".rtc");
   }
+  //the profile stays zeroed until the recompiler records a block, so only write it out once it has.
+  if(auto fp = pak->read("jit.profile"); fp && fp->data()[0]) {
+    Medium::save("jit.profile", ".jit");
+  }
 
   return true;
 }
@@ -182,59 +226,32 @@ auto Nintendo64::cic_detect(std::span<const u8> ipl3) -> string
   return cic;
 }
 
-auto Nintendo64::analyze(std::vector<u8>& data) -> string {
+auto Nintendo64::byteswap(std::span<u8> data, u32 pass) -> void {
+  u32 size = data.size() & ~3;
+  if(pass == 1) {
+    for(u32 index = 0; index < size; index += 2) {
+      std::swap(data[index + 0], data[index + 1]);
+    }
+  }
+  if(pass == 2) {
+    for(u32 index = 0; index < size; index += 4) {
+      std::swap(data[index + 0], data[index + 2]);
+      std::swap(data[index + 1], data[index + 3]);
+    }
+  }
+  if(pass == 3) {
+    for(u32 index = 0; index < size; index += 4) {
+      std::swap(data[index + 0], data[index + 3]);
+      std::swap(data[index + 1], data[index + 2]);
+    }
+  }
+}
+
+auto Nintendo64::analyze(std::span<const u8> data, string cic) -> string {
   if(data.size() < 0x1000) {
     print("[mia] Loading rom failed. Minimum expected rom size is 4096 (0x1000) bytes. Rom size: ", data.size(), " (0x", hex(data.size()), ") bytes.\n");
     return {};
   } 
-  
-  //detect endianness of the ROM by checking the IPL3 checksum. We run the same
-  //checksum algorithm with the various seeds provided by the various CICs, and
-  //check if the checksum matches. If it doesn't, we try byte-swapping the ROM
-  //and running the checksum again.
-  //this also works for modern IPL3s variants (proprietary or open source),
-  //as long as they are used with a CIC we know of.
-  string cic = cic_detect({&data[0x40], 0xfc0});
-  if (cic == "") {
-    //check if byte-swapped
-    for(u32 index = 0; index < data.size(); index += 2) {
-      u8 d0 = data[index + 0];
-      u8 d1 = data[index + 1];
-      data[index + 0] = d1;
-      data[index + 1] = d0;
-    }
-
-    cic = cic_detect({&data[0x40], 0xfc0});
-    if (cic == "") {
-      //check if little-endian
-      for(u32 index = 0; index < data.size(); index += 4) {
-        u8 d0 = data[index + 0];
-        u8 d1 = data[index + 1];
-        u8 d2 = data[index + 2];
-        u8 d3 = data[index + 3];
-        data[index + 0] = d2;
-        data[index + 1] = d3;
-        data[index + 2] = d0;
-        data[index + 3] = d1;
-      }
-
-      cic = cic_detect({&data[0x40], 0xfc0});
-      if (cic == "") {
-        //no match is found. Fallback to CIC 6102, big-endian.
-        cic = "CIC-NUS-6102";
-        for(u32 index = 0; index < data.size(); index += 4) {
-          u8 d0 = data[index + 0];
-          u8 d1 = data[index + 1];
-          u8 d2 = data[index + 2];
-          u8 d3 = data[index + 3];
-          data[index + 0] = d3;
-          data[index + 1] = d2;
-          data[index + 2] = d1;
-          data[index + 3] = d0;
-        }
-      }
-    }
-  }
 
   char region_code = data[0x3e];
   string region = "NTSC";
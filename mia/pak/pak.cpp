@@ -87,6 +87,33 @@ auto Pak::read(string location, std::vector<string> match) -> std::vector<u8> {
   return memory;
 }
 
+auto Pak::map(string location) -> std::shared_ptr<vfs::file> {
+  auto extensions = this->extensions();
+  for(auto& extension : extensions) extension.prepend("*.");
+  if(auto fp = map(location, extensions)) return fp;
+  return map(location, {"*"});
+}
+
+//maps an unpatched, uncompressed ROM file copy-on-write rather than reading it into memory.
+//writes through the mapping (eg from the debugger) stay private to this process.
+//anything that needs to be transformed first falls back to read().
+auto Pak::map(string location, std::vector<string> match) -> std::shared_ptr<vfs::file> {
+  if(!file::exists(location)) return {};
+  bool patched = file::exists({Location::notsuffix(location), ".bps"})
+              || file::exists({Location::notsuffix(location), ".ips"});
+  if(!patched && !location.iendsWith(".zip")) {
+    for(auto& pattern : match) {
+      if(!location.imatch(pattern)) continue;
+      if(auto fp = vfs::disk::open(location, vfs::copy); fp && fp->mapped()) return fp;
+      break;
+    }
+  }
+
+  auto memory = read(location, match);
+  if(memory.empty()) return {};
+  return vfs::memory::open(std::move(memory));
+}
+
 auto Pak::append(std::vector<u8>& output, string filename) -> bool {
   if(!file::exists(filename)) return false;
   auto input = file::read(filename);
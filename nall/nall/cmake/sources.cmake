@@ -150,6 +150,7 @@ target_sources(
     dsp/iir/biquad.hpp
     dsp/iir/dc-removal.hpp
     dsp/iir/one-pole.hpp
+    dsp/resampler/blip.hpp
     dsp/resampler/cubic.hpp
 )
 
@@ -181,6 +182,8 @@ target_sources(
   nall
   PRIVATE #
     gdb/Readme.md
+    gdb/breakpoint.hpp
+    gdb/page-filter.hpp
     gdb/server.cpp
     gdb/server.hpp
     gdb/watchpoint.hpp
@@ -189,6 +192,7 @@ target_sources(
 target_sources(
   nall
   PRIVATE #
+    hash/batch.hpp
     hash/crc16.hpp
     hash/crc32.hpp
     hash/crc64.hpp
@@ -1,341 +1,513 @@
 #pragma once
 
-//a bad implementation of inflate from zlib/minizip
-//todo: replace with Talarubi's version
+//table-driven inflate (RFC 1951)
+//literal/length codes are looked up through an 11-bit primary table whose entries can hold two literals at once,
+//longer codes spill into second-level tables, and non-overlapping matches are copied a word at a time.
+//Inflater stops whenever its output is full and resumes where it left off,
+//so large streams can be decompressed a chunk at a time while they are being consumed.
 
-#include <setjmp.h>
+#include <array>
+#include <memory>
+#include <vector>
 
 namespace nall::Decode {
 
-namespace puff {
-  inline auto puff(u8* dest, u32* destlen, u8* source, u32* sourcelen) -> s32;
-}
-
-inline auto inflate(u8* target, u32 targetLength, const u8* source, u32 sourceLength) -> bool {
-  u32 tl = targetLength, sl = sourceLength;
-  s32 result = puff::puff((u8*)target, &tl, (u8*)source, &sl);
-  return result == 0;
-}
-
-namespace puff {
+struct Inflater {
+  Inflater() = default;
+  Inflater(const u8* source, u64 sourceLength) { open(source, sourceLength); }
+
+  auto open(const u8* source, u64 sourceLength) -> void {
+    input = source;
+    inputEnd = source + sourceLength;
+    overrun = 0;
+    bitbuf = 0;
+    bitcnt = 0;
+    mode = Mode::Header;
+    last = false;
+    storedLength = 0;
+    matchLength = 0;
+    matchDistance = 0;
+    window.clear();
+    windowRead = 0;
+    windowWrite = 0;
+  }
 
-enum : u32 {
-  MAXBITS   =  15,
-  MAXLCODES = 286,
-  MAXDCODES =  30,
-  FIXLCODES = 288,
-  MAXCODES  = MAXLCODES + MAXDCODES,
-};
+  auto finished() const -> bool { return mode == Mode::Done && windowRead == windowWrite; }
+  auto failed() const -> bool { return mode == Mode::Error; }
+
+  //decompresses the next length bytes of the stream into target.
+  //returns the number of bytes written, which is only less than length once the stream has ended or failed.
+  auto read(u8* target, u64 length) -> u64 {
+    u64 total = 0;
+    while(total < length) {
+      if(windowRead < windowWrite) {
+        u64 size = min(length - total, windowWrite - windowRead);
+        memcpy(target + total, window.data() + windowRead, size);
+        windowRead += size;
+        total += size;
+        continue;
+      }
+      if(mode == Mode::Done || mode == Mode::Error) break;
 
-struct state {
-  u8* out;
-  u32 outlen;
-  u32 outcnt;
+      if(window.empty()) window.resize(WindowSize + ChunkSize);
+      if(windowWrite == window.size()) {
+        //keep the last 32KiB as history for matches in the next chunk
+        memmove(window.data(), window.data() + windowWrite - WindowSize, WindowSize);
+        windowRead = windowWrite = WindowSize;
+      }
+      u8* pos = window.data() + windowWrite;
+      run(window.data(), pos, window.data() + window.size());
+      windowWrite = pos - window.data();
+    }
+    return total;
+  }
 
-  u8* in;
-  u32 inlen;
-  u32 incnt;
-  s32 bitbuf;
-  s32 bitcnt;
+  //decompresses the whole stream directly into target, which also serves as the history window.
+  //returns the number of bytes written; the stream was too large for target unless finished() is true afterward.
+  auto decode(u8* target, u64 length) -> u64 {
+    u8* pos = target;
+    run(target, pos, target + length);
+    return pos - target;
+  }
 
-  jmp_buf env;
-};
+private:
+  enum : u32 {
+    WindowSize =  32 * 1024,
+    ChunkSize  = 256 * 1024,
+    MaxMatch   = 258,
 
-struct huffman {
-  s16* count;
-  s16* symbol;
-};
+    LiteralBits   = 11,
+    DistanceBits  =  8,
+    CodeBits      =  7,
+    MaxCodeLength = 15,
+  };
 
-inline auto bits(state* s, s32 need) -> s32 {
-  s32 val;
+  enum class Mode : u32 { Header, Stored, Codes, Done, Error };
 
-  val = s->bitbuf;
-  while(s->bitcnt < need) {
-    if(s->incnt == s->inlen) longjmp(s->env, 1);
-    val |= (s32)(s->in[s->incnt++]) << s->bitcnt;
-    s->bitcnt += 8;
-  }
+  //table entry layout: consumed bits (0-4), kind (5-7), extra bits or subtable bits (8-15), value (16-31).
+  //for a pair of literals, bits 8-15 hold the length of the first code, and the value holds both bytes.
+  enum Kind : u32 { Invalid, Literal, Literals, Base, End, Table };
 
-  s->bitbuf = (s32)(val >> need);
-  s->bitcnt -= need;
+  struct Tables {
+    u32 literal[(1 << LiteralBits) + 288 * (1 << (MaxCodeLength - LiteralBits))];
+    u32 distance[(1 << DistanceBits) + 32 * (1 << (MaxCodeLength - DistanceBits))];
+  };
 
-  return (s32)(val & ((1L << need) - 1));
-}
+  static auto kind(u32 entry) -> u32 { return entry >> 5 & 7; }
 
-inline auto stored(state* s) -> s32 {
-  u32 len;
-
-  s->bitbuf = 0;
-  s->bitcnt = 0;
-
-  if(s->incnt + 4 > s->inlen) return 2;
-  len  = s->in[s->incnt++];
-  len |= s->in[s->incnt++] << 8;
-  if(s->in[s->incnt++] != (~len & 0xff) ||
-     s->in[s->incnt++] != ((~len >> 8) & 0xff)
-  ) return 2;
-
-  if(s->incnt + len > s->inlen) return 2;
-  if(s->out != nullptr) {
-    if(s->outcnt + len > s->outlen) return 1;
-    while(len--) s->out[s->outcnt++] = s->in[s->incnt++];
-  } else {
-    s->outcnt += len;
-    s->incnt += len;
+  static auto symbol(u32 kind, u32 value, u32 extra = 0) -> u32 {
+    return kind << 5 | extra << 8 | value << 16;
   }
 
-  return 0;
-}
-
-inline auto decode(state* s, huffman* h) -> s32 {
-  s32 len, code, first, count, index, bitbuf, left;
-  s16* next;
-
-  bitbuf = s->bitbuf;
-  left = s->bitcnt;
-  code = first = index = 0;
-  len = 1;
-  next = h->count + 1;
-  while(true) {
-    while(left--) {
-      code |= bitbuf & 1;
-      bitbuf >>= 1;
-      count = *next++;
-      if(code - count < first) {
-        s->bitbuf = bitbuf;
-        s->bitcnt = (s->bitcnt - len) & 7;
-        return h->symbol[index + (code - first)];
-      }
-      index += count;
-      first += count;
-      first <<= 1;
-      code <<= 1;
-      len++;
-    }
-    left = (MAXBITS + 1) - len;
-    if(left == 0) break;
-    if(s->incnt == s->inlen) longjmp(s->env, 1);
-    bitbuf = s->in[s->incnt++];
-    if(left > 8) left = 8;
+  static auto literalSymbols() -> const u32* {
+    static const auto symbols = [] {
+      static constexpr u16 base[29] = {
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+        35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+      };
+      static constexpr u8 extra[29] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+        3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0,
+      };
+      std::array<u32, 288> symbols{};
+      for(u32 n : range(256)) symbols[n] = symbol(Literal, n);
+      symbols[256] = symbol(End, 0);
+      for(u32 n : range(29)) symbols[257 + n] = symbol(Base, base[n], extra[n]);
+      return symbols;
+    }();
+    return symbols.data();
   }
 
-  return -10;
-}
-
-inline auto construct(huffman* h, s16* length, s32 n) -> s32 {
-  s32 symbol, left;
-  u32 len;
-  s16 offs[MAXBITS + 1];
-
-  for(len = 0; len <= MAXBITS; len++) h->count[len] = 0;
-  for(symbol = 0; symbol < n; symbol++) h->count[length[symbol]]++;
-  if(h->count[0] == n) return 0;
+  static auto distanceSymbols() -> const u32* {
+    static const auto symbols = [] {
+      static constexpr u16 base[30] = {
+        1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+        257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577,
+      };
+      static constexpr u8 extra[30] = {
+        0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13,
+      };
+      std::array<u32, 32> symbols{};
+      for(u32 n : range(30)) symbols[n] = symbol(Base, base[n], extra[n]);
+      return symbols;
+    }();
+    return symbols.data();
+  }
 
-  left = 1;
-  for(len = 1; len <= MAXBITS; len++) {
-    left <<= 1;
-    left -= h->count[len];
-    if(left < 0) return left;
+  static auto fixedTables() -> const Tables& {
+    static const auto tables = [] {
+      auto tables = std::make_unique<Tables>();
+      u8 lengths[288];
+      for(u32 n : range(144)) lengths[n] = 8;
+      for(u32 n : range(144, 256)) lengths[n] = 9;
+      for(u32 n : range(256, 280)) lengths[n] = 7;
+      for(u32 n : range(280, 288)) lengths[n] = 8;
+      build(tables->literal, LiteralBits, lengths, 288, literalSymbols());
+      pair(tables->literal);
+      for(u32 n : range(32)) lengths[n] = 5;
+      build(tables->distance, DistanceBits, lengths, 32, distanceSymbols());
+      return tables;
+    }();
+    return *tables;
   }
 
-  offs[1] = 0;
-  for(len = 1; len < MAXBITS; len++) offs[len + 1] = offs[len] + h->count[len];
+  //builds a lookup table for a canonical Huffman code, indexed by the next bits of the stream (LSB first).
+  //codes longer than the primary table index a second-level table; incomplete codes leave Invalid entries.
+  static auto build(u32* table, u32 primary, const u8* lengths, u32 count, const u32* symbols) -> bool {
+    u32 histogram[MaxCodeLength + 1] = {};
+    for(u32 n : range(count)) histogram[lengths[n]]++;
+    histogram[0] = 0;
+
+    s32 left = 1;
+    u32 maxLength = 0;
+    for(u32 length : range(1, MaxCodeLength + 1)) {
+      left = (left << 1) - histogram[length];
+      if(left < 0) return false;  //over-subscribed
+      if(histogram[length]) maxLength = length;
+    }
 
-  for(symbol = 0; symbol < n; symbol++) {
-    if(length[symbol] != 0) h->symbol[offs[length[symbol]]++] = symbol;
-  }
+    u32 next[MaxCodeLength + 1] = {};
+    for(u32 code = 0, length = 1; length <= MaxCodeLength; length++) {
+      code = (code + histogram[length - 1]) << 1;
+      next[length] = code;
+    }
 
-  return left;
-}
+    u32 size = 1 << primary;
+    u32 subtable = maxLength > primary ? maxLength - primary : 0;
+    u32 allocated = size;
+    for(u32 n : range(size)) table[n] = 0;
 
-inline auto codes(state* s, huffman* lencode, huffman* distcode) -> s32 {
-  s32 symbol, len;
-  u32 dist;
-  static const s16 lens[29] = {
-    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
-    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
-  };
-  static const s16 lext[29] = {
-    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
-    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
-  };
-  static const s16 dists[30] = {
-    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
-    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
-    8193, 12289, 16385, 24577
-  };
-  static const s16 dext[30] = {
-    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
-    7, 7, 8, 8, 9, 9, 10, 10, 11, 11,
-    12, 12, 13, 13
-  };
+    for(u32 n : range(count)) {
+      u32 length = lengths[n];
+      if(!length) continue;
+      u32 code = next[length]++, reversed = 0;
+      for(u32 bit : range(length)) reversed |= (code >> bit & 1) << (length - 1 - bit);
 
-  do {
-    symbol = decode(s, lencode);
-    if(symbol < 0) return symbol;
-    if(symbol < 256) {
-      if(s->out != nullptr) {
-        if(s->outcnt == s->outlen) return 1;
-        s->out[s->outcnt] = symbol;
+      if(length <= primary) {
+        for(u32 index = reversed; index < size; index += 1 << length) table[index] = symbols[n] | length;
+        continue;
       }
-      s->outcnt++;
-    } else if(symbol > 256) {
-      symbol -= 257;
-      if(symbol >= 29) return -10;
-      len = lens[symbol] + bits(s, lext[symbol]);
-
-      symbol = decode(s, distcode);
-      if(symbol < 0) return symbol;
-      dist = dists[symbol] + bits(s, dext[symbol]);
-      #ifndef INFLATE_ALLOW_INVALID_DISTANCE_TOO_FAR
-      if(dist > s->outcnt) return -11;
-      #endif
-
-      if(s->out != nullptr) {
-        if(s->outcnt + len > s->outlen) return 1;
-        while(len--) {
-          s->out[s->outcnt] =
-          #ifdef INFLATE_ALLOW_INVALID_DISTANCE_TOO_FAR
-          dist > s->outcnt ? 0 :
-          #endif
-          s->out[s->outcnt - dist];
-          s->outcnt++;
-        }
-      } else {
-        s->outcnt += len;
+
+      u32& link = table[reversed & (size - 1)];
+      if(kind(link) != Table) {
+        link = symbol(Table, allocated, subtable) | primary;
+        for(u32 index : range(1 << subtable)) table[allocated + index] = 0;
+        allocated += 1 << subtable;
+      }
+      u32* second = table + (link >> 16);
+      for(u32 index = reversed >> primary; index < 1u << subtable; index += 1 << (length - primary)) {
+        second[index] = symbols[n] | (length - primary);
       }
     }
-  } while(symbol != 256);
+    return true;
+  }
 
-  return 0;
-}
+  //merges literal entries whose code is followed by another literal code that still fits in the primary table.
+  //walks backward so that the entry for the second code is always read before it is merged itself.
+  static auto pair(u32* table) -> void {
+    for(u32 index = 1 << LiteralBits; index--;) {
+      u32 first = table[index];
+      if(kind(first) != Literal) continue;
+      u32 length = first & 31;
+      u32 second = table[index >> length];
+      if(kind(second) != Literal || length + (second & 31) > LiteralBits) continue;
+      table[index] = symbol(Literals, (first >> 16) | (second >> 16) << 8, length) | (length + (second & 31));
+    }
+  }
 
-inline auto fixed(state* s) -> s32 {
-  static s32 virgin = 1;
-  static s16 lencnt[MAXBITS + 1], lensym[FIXLCODES];
-  static s16 distcnt[MAXBITS + 1], distsym[MAXDCODES];
-  static huffman lencode, distcode;
+  auto refill() -> void {
+    if(bitcnt > 56) return;
+    if(inputEnd - input >= 8) {
+      //the bits above bitcnt are the bytes that follow, so reloading them later is harmless
+      u64 word;
+      memcpy(&word, input, 8);
+      bitbuf |= word << bitcnt;
+      u32 bytes = (63 - bitcnt) >> 3;
+      input += bytes;
+      bitcnt += bytes << 3;
+      return;
+    }
+    //past the end of the input, the stream is padded with zeroes; failed() is set if those are consumed
+    while(bitcnt <= 56) {
+      if(input < inputEnd) bitbuf |= (u64)*input++ << bitcnt;
+      else overrun++;
+      bitcnt += 8;
+    }
+  }
 
-  if(virgin) {
-    s32 symbol = 0;
-    s16 lengths[FIXLCODES];
+  auto consume(u32 bits) -> void {
+    bitbuf >>= bits;
+    bitcnt -= bits;
+  }
 
-    lencode.count = lencnt;
-    lencode.symbol = lensym;
-    distcode.count = distcnt;
-    distcode.symbol = distsym;
+  auto bits(u32 count) -> u32 {
+    refill();
+    u32 value = bitbuf & ((1ull << count) - 1);
+    consume(count);
+    return value;
+  }
 
-    for(; symbol <       144; symbol++) lengths[symbol] = 8;
-    for(; symbol <       256; symbol++) lengths[symbol] = 9;
-    for(; symbol <       280; symbol++) lengths[symbol] = 7;
-    for(; symbol < FIXLCODES; symbol++) lengths[symbol] = 8;
-    construct(&lencode, lengths, FIXLCODES);
+  auto overran() const -> bool {
+    return bitcnt < overrun << 3;
+  }
 
-    for(symbol = 0; symbol < MAXDCODES; symbol++) lengths[symbol] = 5;
-    construct(&distcode, lengths, MAXDCODES);
+  //requires at least MaxCodeLength bits in the bit buffer.
+  auto decode(const u32* table, u32 primary) -> u32 {
+    u32 entry = table[bitbuf & ((1 << primary) - 1)];
+    if(kind(entry) == Table) {
+      consume(primary);
+      entry = table[(entry >> 16) + (bitbuf & ((1 << (entry >> 8 & 0xff)) - 1))];
+    }
+    consume(entry & 31);
+    return entry;
+  }
 
-    virgin = 0;
+  auto run(u8* begin, u8*& pos, u8* end) -> void {
+    while(true) {
+      switch(mode) {
+      case Mode::Header:
+        if(overran()) { mode = Mode::Error; return; }
+        if(last) { mode = Mode::Done; return; }
+        header();
+        break;
+      case Mode::Stored:
+        if(!stored(pos, end)) return;
+        break;
+      case Mode::Codes:
+        if(!codes(begin, pos, end)) return;
+        break;
+      case Mode::Done:
+      case Mode::Error:
+        return;
+      }
+    }
   }
 
-  return codes(s, &lencode, &distcode);
-}
+  auto header() -> void {
+    last = bits(1);
+    switch(bits(2)) {
+    case 0: {
+      consume(bitcnt & 7);
+      u32 length = bits(16);
+      u32 complement = bits(16);
+      if(overran() || length != (~complement & 0xffff)) { mode = Mode::Error; return; }
+      //hand the whole bytes left in the bit buffer back to the input
+      input -= (bitcnt >> 3) - overrun;
+      bitbuf = 0;
+      bitcnt = 0;
+      overrun = 0;
+      storedLength = length;
+      mode = Mode::Stored;
+      return;
+    }
+    case 1:
+      tables = &fixedTables();
+      mode = Mode::Codes;
+      return;
+    case 2:
+      mode = dynamic() ? Mode::Codes : Mode::Error;
+      return;
+    default:
+      mode = Mode::Error;
+      return;
+    }
+  }
 
-inline auto dynamic(state* s) -> s32 {
-  s32 nlen, ndist, ncode, index, err;
-  s16 lengths[MAXCODES];
-  s16 lencnt[MAXBITS + 1], lensym[MAXLCODES];
-  s16 distcnt[MAXBITS + 1], distsym[MAXDCODES];
-  huffman lencode, distcode;
-  static const s16 order[19] = {
-    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
-  };
+  auto stored(u8*& pos, u8* end) -> bool {
+    u64 size = min<u64>(storedLength, end - pos);
+    if(size > (u64)(inputEnd - input)) { mode = Mode::Error; return false; }
+    if(size) memcpy(pos, input, size);
+    pos += size;
+    input += size;
+    storedLength -= size;
+    if(storedLength) return false;
+    mode = Mode::Header;
+    return true;
+  }
 
-  lencode.count = lencnt;
-  lencode.symbol = lensym;
-  distcode.count = distcnt;
-  distcode.symbol = distsym;
-
-  nlen = bits(s, 5) + 257;
-  ndist = bits(s, 5) + 1;
-  ncode = bits(s, 4) + 4;
-  if(nlen > MAXLCODES || ndist > MAXDCODES) return -3;
-
-  for(index = 0; index < ncode; index++) lengths[order[index]] = bits(s, 3);
-  for(; index < 19; index++) lengths[order[index]] = 0;
-
-  err = construct(&lencode, lengths, 19);
-  if(err != 0) return -4;
-
-  index = 0;
-  while(index < nlen + ndist) {
-    s32 symbol, len;
-
-    symbol = decode(s, &lencode);
-    if(symbol < 16) {
-      lengths[index++] = symbol;
-    } else {
-      len = 0;
-      if(symbol == 16) {
-        if(index == 0) return -5;
-        len = lengths[index - 1];
-        symbol = 3 + bits(s, 2);
-      } else if(symbol == 17) {
-        symbol = 3 + bits(s, 3);
-      } else {
-        symbol = 11 + bits(s, 7);
+  auto dynamic() -> bool {
+    static constexpr u8 order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+    static const auto codeSymbols = [] {
+      std::array<u32, 19> symbols{};
+      for(u32 n : range(19)) symbols[n] = symbol(Literal, n);
+      return symbols;
+    }();
+
+    u32 literals = bits(5) + 257;
+    u32 distances = bits(5) + 1;
+    u32 codes = bits(4) + 4;
+    if(literals > 286 || distances > 30) return false;
+
+    u8 lengths[286 + 30] = {};
+    for(u32 n : range(codes)) lengths[order[n]] = bits(3);
+    u32 table[1 << CodeBits];
+    if(!build(table, CodeBits, lengths, 19, codeSymbols.data())) return false;
+
+    for(u32 n : range(19)) lengths[n] = 0;
+    for(u32 index = 0; index < literals + distances;) {
+      refill();
+      u32 entry = decode(table, CodeBits);
+      if(kind(entry) != Literal) return false;
+      u32 code = entry >> 16;
+      if(code < 16) {
+        lengths[index++] = code;
+        continue;
+      }
+      u32 length = 0, repeat = 0;
+      if(code == 16) {
+        if(index == 0) return false;
+        length = lengths[index - 1];
+        repeat = 3 + bits(2);
       }
-      if(index + symbol > nlen + ndist) return -6;
-      while(symbol--) lengths[index++] = len;
+      if(code == 17) repeat = 3 + bits(3);
+      if(code == 18) repeat = 11 + bits(7);
+      if(index + repeat > literals + distances) return false;
+      while(repeat--) lengths[index++] = length;
     }
+    if(overran() || lengths[256] == 0) return false;  //no end of block code
+
+    if(!dynamicTables) dynamicTables = std::make_unique<Tables>();
+    if(!build(dynamicTables->literal, LiteralBits, lengths, literals, literalSymbols())) return false;
+    if(!build(dynamicTables->distance, DistanceBits, lengths + literals, distances, distanceSymbols())) return false;
+    pair(dynamicTables->literal);
+    tables = dynamicTables.get();
+    return true;
   }
 
-  if(lengths[256] == 0) return -9;
-
-  err = construct(&lencode, lengths, nlen);
-  if(err < 0 || (err > 0 && nlen - lencode.count[0] != 1)) return -7;
-
-  err = construct(&distcode, lengths + nlen, ndist);
-  if(err < 0 || (err > 0 && ndist - distcode.count[0] != 1)) return -8;
+  //copies as much of the pending match as fits before end.
+  auto match(u8*& pos, u8* end) -> bool {
+    u64 size = min<u64>(matchLength, end - pos);
+    const u8* from = pos - matchDistance;
+    for(u64 n : range(size)) pos[n] = from[n];
+    pos += size;
+    matchLength -= size;
+    return matchLength == 0;
+  }
 
-  return codes(s, &lencode, &distcode);
-}
+  //returns false when the output is full or the stream failed, and true at the end of the block.
+  auto codes(u8* begin, u8*& pos, u8* end) -> bool {
+    if(matchLength && !match(pos, end)) return false;
+    const u32* literal = tables->literal;
+    const u32* distance = tables->distance;
+
+    while(true) {
+      //fast path: one refill covers a whole length/distance pair, and matches may overrun their end by a word
+      while(end - pos >= MaxMatch + 8 && inputEnd - input >= 8) {
+        refill();
+        u32 entry = decode(literal, LiteralBits);
+        if(kind(entry) == Literal) {
+          *pos++ = entry >> 16;
+          continue;
+        }
+        if(kind(entry) == Literals) {
+          pos[0] = entry >> 16;
+          pos[1] = entry >> 24;
+          pos += 2;
+          continue;
+        }
+        if(kind(entry) == End) { mode = Mode::Header; return true; }
+        if(kind(entry) != Base) { mode = Mode::Error; return false; }
+
+        u32 extra = entry >> 8 & 0xff;
+        u32 length = (entry >> 16) + (bitbuf & ((1 << extra) - 1));
+        consume(extra);
+        entry = decode(distance, DistanceBits);
+        if(kind(entry) != Base) { mode = Mode::Error; return false; }
+        extra = entry >> 8 & 0xff;
+        u32 offset = (entry >> 16) + (bitbuf & ((1 << extra) - 1));
+        consume(extra);
+        if(offset > (u64)(pos - begin)) { mode = Mode::Error; return false; }
+
+        const u8* from = pos - offset;
+        if(offset >= 8) {
+          u8* to = pos;
+          do {
+            memcpy(to, from, 8);
+            to += 8;
+            from += 8;
+          } while(to < pos + length);
+        } else if(offset == 1) {
+          memset(pos, pos[-1], length);
+        } else {
+          for(u32 n : range(length)) pos[n] = from[n];
+        }
+        pos += length;
+      }
 
-inline auto puff(u8* dest, u32* destlen, u8* source, u32* sourcelen) -> s32 {
-  state s;
-  s32 last, type, err;
-
-  s.out = dest;
-  s.outlen = *destlen;
-  s.outcnt = 0;
-
-  s.in = source;
-  s.inlen = *sourcelen;
-  s.incnt = 0;
-  s.bitbuf = 0;
-  s.bitcnt = 0;
-
-  if(setjmp(s.env) != 0) {
-    err = 2;
-  } else {
-    do {
-      last = bits(&s, 1);
-      type = bits(&s, 2);
-      err = type == 0 ? stored(&s)
-          : type == 1 ? fixed(&s)
-          : type == 2 ? dynamic(&s)
-          : -1;
-      if(err != 0) break;
-    } while(!last);
-  }
+      //slow path: near the end of the output or input, one symbol at a time with exact bounds
+      refill();
+      u32 entry = literal[bitbuf & ((1 << LiteralBits) - 1)];
+      if(pos == end) {
+        //a full output can still take the end of block code
+        u64 buffer = bitbuf;
+        u32 count = bitcnt;
+        if(kind(decode(literal, LiteralBits)) == End && !overran()) { mode = Mode::Header; return true; }
+        bitbuf = buffer;
+        bitcnt = count;
+        return false;
+      }
+      if(kind(entry) == Literals && end - pos < 2) {
+        //only room for the first of the pair
+        consume(entry >> 8 & 0xff);
+        entry = symbol(Literal, entry >> 16 & 0xff);
+      } else {
+        entry = decode(literal, LiteralBits);
+      }
+      if(overran()) { mode = Mode::Error; return false; }
 
-  if(err <= 0) {
-    *destlen = s.outcnt;
-    *sourcelen = s.incnt;
+      if(kind(entry) == Literal) {
+        *pos++ = entry >> 16;
+        continue;
+      }
+      if(kind(entry) == Literals) {
+        pos[0] = entry >> 16;
+        pos[1] = entry >> 24;
+        pos += 2;
+        continue;
+      }
+      if(kind(entry) == End) { mode = Mode::Header; return true; }
+      if(kind(entry) != Base) { mode = Mode::Error; return false; }
+
+      u32 extra = entry >> 8 & 0xff;
+      u32 length = (entry >> 16) + (bitbuf & ((1 << extra) - 1));
+      consume(extra);
+      entry = decode(distance, DistanceBits);
+      if(kind(entry) != Base) { mode = Mode::Error; return false; }
+      extra = entry >> 8 & 0xff;
+      u32 offset = (entry >> 16) + (bitbuf & ((1 << extra) - 1));
+      consume(extra);
+      if(overran() || offset > (u64)(pos - begin)) { mode = Mode::Error; return false; }
+
+      matchLength = length;
+      matchDistance = offset;
+      if(!match(pos, end)) return false;
+    }
   }
 
-  return err;
-}
+  const u8* input = nullptr;
+  const u8* inputEnd = nullptr;
+  u32 overrun = 0;  //zero bytes appended past the end of the input
+  u64 bitbuf = 0;
+  u32 bitcnt = 0;
+
+  Mode mode = Mode::Header;
+  bool last = false;
+  u32 storedLength = 0;
+  u32 matchLength = 0;
+  u32 matchDistance = 0;
+  const Tables* tables = nullptr;
+  std::unique_ptr<Tables> dynamicTables;
+
+  std::vector<u8> window;
+  u64 windowRead = 0;
+  u64 windowWrite = 0;
+};
 
+inline auto inflate(u8* target, u64 targetLength, const u8* source, u64 sourceLength) -> bool {
+  Inflater inflater{source, sourceLength};
+  inflater.decode(target, targetLength);
+  return inflater.finished();
 }
 
 }
@@ -0,0 +1,70 @@
+#pragma once
+
+namespace nall::Decode {
+
+//decompresses a single LZ4 block into output, which must be exactly the size of the original data.
+//returns false on malformed or truncated input; output is never written out of bounds.
+inline auto LZ4(std::span<const u8> input, std::span<u8> output) -> bool {
+  static constexpr u32 MinimumMatch = 4;
+
+  const u8* source = input.data();
+  const u8* sourceEnd = source + input.size();
+  u8* target = output.data();
+  u8* targetEnd = target + output.size();
+
+  auto readLength = [&](u64& length) -> bool {
+    u8 byte;
+    do {
+      if(source >= sourceEnd) return false;
+      byte = *source++;
+      length += byte;
+    } while(byte == 255);
+    return true;
+  };
+
+  while(source < sourceEnd) {
+    u8 token = *source++;
+
+    u64 literals = token >> 4;
+    if(literals == 15 && !readLength(literals)) return false;
+    if(literals > u64(sourceEnd - source) || literals > u64(targetEnd - target)) return false;
+    memcpy(target, source, literals);
+    target += literals;
+    source += literals;
+    if(source == sourceEnd) break;  //the last sequence has no match
+
+    if(sourceEnd - source < 2) return false;
+    u32 offset = source[0] << 0 | source[1] << 8;
+    source += 2;
+    if(!offset || offset > u64(target - output.data())) return false;
+
+    u64 length = token & 15;
+    if(length == 15 && !readLength(length)) return false;
+    length += MinimumMatch;
+    if(length > u64(targetEnd - target)) return false;
+
+    const u8* match = target - offset;
+    if(length + 8 <= u64(targetEnd - target)) {
+      //copy in 8-byte steps; this may write up to 7 bytes past the match, which later output replaces.
+      //short offsets are repeating patterns: expand the first 8 bytes, then copy from a multiple of the offset.
+      u8* end = target + length;
+      if(offset < 8) {
+        for(u32 n : range(8)) target[n] = match[n];
+        target += 8;
+        match = target - (8 + offset - 1) / offset * offset;
+      }
+      while(target < end) {
+        memcpy(target, match, 8);
+        target += 8;
+        match += 8;
+      }
+      target = end;
+    } else {
+      for(u64 n = 0; n < length; n++) *target++ = *match++;
+    }
+  }
+
+  return target == targetEnd;
+}
+
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+//band-limited step synthesis
+//
+//converts a step signal clocked at a high input frequency (eg a PSG running at several MHz)
+//directly into output samples: each transition is written into the output buffer as a
+//band-limited impulse, and the buffer is integrated as it is read back out. this costs
+//work only per transition, rather than per input clock.
+
+#include <vector>
+#include <nall/memory.hpp>
+#include <nall/serializer.hpp>
+
+namespace nall::DSP::Resampler {
+
+struct Blip {
+  static constexpr u32 Phases = 64;  //sub-sample resolution of transitions
+  static constexpr u32 Taps = 16;    //width of each band-limited impulse, in output samples
+
+  auto clockFrequency() const -> f64 { return _clockFrequency; }
+  auto outputFrequency() const -> f64 { return _outputFrequency; }
+
+  auto reset(f64 clockFrequency, f64 outputFrequency) -> void;
+  auto setClockFrequency(f64 clockFrequency) -> void;
+  auto addDelta(u32 clock, f64 delta) -> void;  //clock is relative to the start of the current frame
+  auto endFrame(u32 clocks) -> void;            //makes all samples before the end of the frame readable
+  auto pending() const -> u32;
+  auto read() -> f64;
+  auto serialize(serializer&) -> void;
+
+private:
+  f64 _clockFrequency = 0.0;
+  f64 _outputFrequency = 0.0;
+  f64 _ratio = 0.0;       //output samples per input clock
+  f64 _offset = 0.0;      //output position of the start of the current frame
+  u32 _available = 0;     //output samples that no future transition can affect
+  u32 _readOffset = 0;
+  f64 _integrator = 0.0;
+  std::vector<f64> _buffer;
+  f64 _kernel[Phases + 1][Taps];
+};
+
+inline auto Blip::reset(f64 clockFrequency, f64 outputFrequency) -> void {
+  _outputFrequency = outputFrequency;
+  setClockFrequency(clockFrequency);
+  _offset = 0.0;
+  _available = 0;
+  _readOffset = 0;
+  _integrator = 0.0;
+  _buffer.assign(Taps * 4, 0.0);
+
+  //Blackman-windowed sinc impulses delayed by Taps/2 samples; one per phase, each with unity gain
+  static constexpr f64 cutoff = 0.90;  //relative to the output Nyquist frequency
+  for(u32 phase : range(Phases + 1)) {
+    f64 sum = 0.0;
+    for(u32 tap : range(Taps)) {
+      f64 x = (f64)tap - (f64)phase / Phases - Taps / 2;
+      f64 sinc = x == 0.0 ? 1.0 : sin(Math::Pi * cutoff * x) / (Math::Pi * cutoff * x);
+      f64 window = fabs(x) >= Taps / 2 ? 0.0
+      : 0.42 + 0.50 * cos(Math::Pi * x / (Taps / 2)) + 0.08 * cos(2.0 * Math::Pi * x / (Taps / 2));
+      _kernel[phase][tap] = sinc * window;
+      sum += _kernel[phase][tap];
+    }
+    for(u32 tap : range(Taps)) _kernel[phase][tap] /= sum;
+  }
+}
+
+inline auto Blip::setClockFrequency(f64 clockFrequency) -> void {
+  _clockFrequency = clockFrequency;
+  _ratio = _outputFrequency / _clockFrequency;
+}
+
+inline auto Blip::addDelta(u32 clock, f64 delta) -> void {
+  f64 position = _offset + clock * _ratio;
+  u32 index = position;
+  u32 phase = (position - index) * Phases + 0.5;
+  if(index + Taps > _buffer.size()) _buffer.resize((index + Taps) * 2, 0.0);
+  f64* target = &_buffer[index];
+  const f64* kernel = _kernel[phase];
+  for(u32 tap : range(Taps)) target[tap] += delta * kernel[tap];
+}
+
+inline auto Blip::endFrame(u32 clocks) -> void {
+  _offset += clocks * _ratio;
+  _available = _offset;
+  if(_available + Taps > _buffer.size()) _buffer.resize((_available + Taps) * 2, 0.0);
+}
+
+inline auto Blip::pending() const -> u32 {
+  return _available - _readOffset;
+}
+
+inline auto Blip::read() -> f64 {
+  _integrator += _buffer[_readOffset++];
+  if(_readOffset == _available) {
+    //all completed samples have been read: shift the partial samples to the front
+    u32 remaining = _buffer.size() - _available;
+    memory::move(_buffer.data(), _buffer.data() + _available, remaining * sizeof(f64));
+    memory::fill(_buffer.data() + remaining, _available * sizeof(f64));
+    _offset -= _available;
+    _available = 0;
+    _readOffset = 0;
+  }
+  return _integrator;
+}
+
+//the kernel is rebuilt by reset(); only the clock rate and the buffered samples are stored
+inline auto Blip::serialize(serializer& s) -> void {
+  s(_clockFrequency);
+  s(_offset);
+  s(_available);
+  s(_readOffset);
+  s(_integrator);
+  u32 size = _buffer.size();
+  s(size);
+  if(size != _buffer.size()) _buffer.resize(size, 0.0);
+  s(std::span<f64>{_buffer});
+  setClockFrequency(_clockFrequency);
+}
+
+}
@@ -12,7 +12,9 @@ struct Cubic {
   auto reset(f64 inputFrequency, f64 outputFrequency = 0, u32 queueSize = 0) -> void;
   auto setInputFrequency(f64 inputFrequency) -> void;
   auto pending() const -> bool;
+  auto size() const -> u32;
   auto read() -> f64;
+  auto read(f64* samples, u32 count, u32 stride = 1) -> void;
   auto write(f64 sample) -> void;
   auto serialize(serializer&) -> void;
 
@@ -45,10 +47,18 @@ inline auto Cubic::pending() const -> bool {
   return _samples.pending();
 }
 
+inline auto Cubic::size() const -> u32 {
+  return _samples.size();
+}
+
 inline auto Cubic::read() -> double {
   return _samples.read();
 }
 
+inline auto Cubic::read(f64* samples, u32 count, u32 stride) -> void {
+  for(u32 n : range(count)) samples[n * stride] = _samples.read();
+}
+
 inline auto Cubic::write(f64 sample) -> void {
   auto& mu = _fraction;
   auto& s = _history;
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <bit>
+
+namespace nall::Encode {
+
+//compresses input into a single LZ4 block (no frame header; the caller records the original size).
+//uses greedy matching through a hash table of 4-byte sequences, skipping faster through incompressible data.
+//this favors speed over ratio: it is meant for large buffers that must be compressed quickly, such as save states.
+inline auto LZ4(std::span<const u8> input) -> std::vector<u8> {
+  static constexpr u32 HashBits = 16;
+  static constexpr u32 MinimumMatch = 4;
+  static constexpr u32 LastLiterals = 5;   //a block must end with at least this many literals
+  static constexpr u32 MatchLimit = 12;    //the last match must start at least this far from the end
+  static constexpr u32 MaximumOffset = 65535;
+
+  const u8* source = input.data();
+  const u64 size = input.size();
+  std::vector<u8> output;
+  output.reserve(size + size / 255 + 16);
+
+  auto read32 = [&](u64 offset) -> u32 {
+    u32 value;
+    memcpy(&value, source + offset, sizeof(u32));
+    return value;
+  };
+
+  auto read64 = [&](u64 offset) -> u64 {
+    u64 value;
+    memcpy(&value, source + offset, sizeof(u64));
+    return value;
+  };
+
+  auto hash = [](u32 sequence) -> u32 {
+    return sequence * 2654435761u >> (32 - HashBits);
+  };
+
+  auto writeLength = [&](u64 length) {
+    while(length >= 255) output.push_back(255), length -= 255;
+    output.push_back((u8)length);
+  };
+
+  auto writeSequence = [&](u64 anchor, u64 literals, u64 offset, u64 length) {
+    u8 token = (u8)(min<u64>(literals, 15) << 4);
+    if(offset) token |= (u8)min<u64>(length - MinimumMatch, 15);
+    output.push_back(token);
+    if(literals >= 15) writeLength(literals - 15);
+    output.insert(output.end(), source + anchor, source + anchor + literals);
+    if(!offset) return;
+    output.push_back((u8)(offset >> 0));
+    output.push_back((u8)(offset >> 8));
+    if(length - MinimumMatch >= 15) writeLength(length - MinimumMatch - 15);
+  };
+
+  u64 anchor = 0;
+  if(size > MatchLimit) {
+    std::vector<u32> table(1 << HashBits);
+    const u64 matchStart = size - MatchLimit;
+    const u64 matchEnd = size - LastLiterals;
+    u64 position = 1;
+    table[hash(read32(0))] = 0;
+
+    while(position < matchStart) {
+      u32 sequence = read32(position);
+      u32& slot = table[hash(sequence)];
+      u64 candidate = slot;
+      slot = position;
+      if(candidate >= position || position - candidate > MaximumOffset || read32(candidate) != sequence) {
+        position += 1 + ((position - anchor) >> 6);
+        continue;
+      }
+
+      while(position > anchor && candidate && source[position - 1] == source[candidate - 1]) {
+        position--;
+        candidate--;
+      }
+
+      u64 length = MinimumMatch;
+      while(position + length + 8 <= matchEnd) {
+        u64 difference = read64(position + length) ^ read64(candidate + length);
+        if(difference) {
+          #if defined(ENDIAN_LITTLE)
+          length += std::countr_zero(difference) >> 3;
+          #else
+          length += std::countl_zero(difference) >> 3;
+          #endif
+          goto matched;
+        }
+        length += 8;
+      }
+      while(position + length < matchEnd && source[position + length] == source[candidate + length]) length++;
+    matched:
+
+      writeSequence(anchor, position - anchor, position - candidate, length);
+      position += length;
+      anchor = position;
+      if(position < matchStart) table[hash(read32(position - 2))] = position - 2;
+    }
+  }
+
+  writeSequence(anchor, size - anchor, 0, 0);
+  return output;
+}
+
+}
@@ -37,6 +37,12 @@ NALL_HEADER_INLINE auto file_map::open(const string& filename, u32 mode_) -> boo
     protection = PAGE_READWRITE;
     mapAccess = FILE_MAP_ALL_ACCESS;
     break;
+  case mode::copy:
+    desiredAccess = GENERIC_READ;
+    creationDisposition = OPEN_EXISTING;
+    protection = PAGE_WRITECOPY;
+    mapAccess = FILE_MAP_COPY;
+    break;
   }
 
   _file = CreateFileW(utf16_t(filename), desiredAccess, FILE_SHARE_READ, nullptr,
@@ -23,7 +23,8 @@
 namespace nall {
 
 struct file_map {
-  struct mode { enum : u32 { read, write, modify, append }; };
+  //copy: the file is opened read-only, and writes to the mapping are private to this process.
+  struct mode { enum : u32 { read, write, modify, append, copy }; };
 
   file_map(const file_map&) = delete;
   auto operator=(const file_map&) = delete;
@@ -124,6 +125,10 @@ public:
       openFlags = O_RDWR | O_CREAT;
       mmapFlags = PROT_READ | PROT_WRITE;
       break;
+    case mode::copy:
+      openFlags = O_RDONLY;
+      mmapFlags = PROT_READ | PROT_WRITE;
+      break;
     }
 
     _fd = ::open(filename, openFlags, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
@@ -133,7 +138,8 @@ public:
     fstat(_fd, &_stat);
     _size = _stat.st_size;
 
-    _data = (u8*)mmap(nullptr, _size, mmapFlags, MAP_SHARED | MAP_NORESERVE, _fd, 0);
+    s32 mapFlags = mode_ == mode::copy ? MAP_PRIVATE : MAP_SHARED;
+    _data = (u8*)mmap(nullptr, _size, mmapFlags, mapFlags | MAP_NORESERVE, _fd, 0);
     if(_data == MAP_FAILED) {
       _data = nullptr;
       ::close(_fd);
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <nall/gdb/page-filter.hpp>
+#include <unordered_set>
+
+namespace nall::GDB {
+
+  /**
+   * Set of breakpoint addresses, queried once per executed instruction.
+   * Most lookups are rejected by the page filter, the rest are a single hash lookup.
+   */
+  struct BreakpointIndex {
+    auto empty() const { return addresses.empty(); }
+    auto size() const { return addresses.size(); }
+
+    auto contains(u64 address) const -> bool {
+      if(!filter.test(address)) return false;
+      return addresses.contains(address);
+    }
+
+    auto insert(u64 address) -> void {
+      addresses.insert(address);
+      filter.insert(address, address);
+    }
+
+    auto remove(u64 address) -> void {
+      if(!addresses.erase(address)) return;
+      filter.clear();
+      for(auto entry : addresses) filter.insert(entry, entry);
+    }
+
+    auto clear() -> void {
+      addresses.clear();
+      filter.clear();
+    }
+
+    auto reserve(u32 capacity) -> void {
+      addresses.reserve(capacity);
+    }
+
+  private:
+    std::unordered_set<u64> addresses{};
+    PageFilter filter{};
+  };
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <nall/tcptext/tcptext-server.hpp>
+
+namespace nall::GDB {
+
+  /**
+   * Coarse prefilter for address lookups, checked before any exact match.
+   * Each 4KiB page is hashed onto one bit, so a clear bit proves no entry touches that page.
+   * A set bit may be a false-positive (aliasing pages), which the exact lookup then rejects.
+   */
+  struct PageFilter {
+    static constexpr u32 PageBits = 12;
+    static constexpr u32 Slots = 4096;
+
+    auto clear() -> void {
+      bits.fill(0);
+    }
+
+    auto insert(u64 addressStart, u64 addressEnd) -> void {
+      u64 pageStart = min(addressStart, addressEnd) >> PageBits;
+      u64 pageEnd = max(addressStart, addressEnd) >> PageBits;
+      if(pageEnd - pageStart >= Slots - 1) return bits.fill(~0ull);
+      for(u64 page = pageStart; page <= pageEnd; page++) {
+        bits[page / 64 % (Slots / 64)] |= 1ull << page % 64;
+      }
+    }
+
+    auto test(u64 address) const -> bool {
+      u64 page = address >> PageBits;
+      return bits[page / 64 % (Slots / 64)] >> page % 64 & 1;
+    }
+
+    auto test(u64 addressStart, u64 addressEnd) const -> bool {
+      // accesses are at most a few bytes, so this checks one or two pages
+      for(u64 page = addressStart >> PageBits; page <= addressEnd >> PageBits; page++) {
+        if(bits[page / 64 % (Slots / 64)] >> page % 64 & 1) return true;
+      }
+      return false;
+    }
+
+  private:
+    std::array<u64, Slots / 64> bits{};
+  };
+}
@@ -19,12 +19,12 @@ namespace {
     return checksum;
   }
 
-  template<typename T>
-  inline auto addOrRemoveEntry(std::vector<T> &data, T value, bool shouldAdd) {
+  template<typename Index, typename T>
+  inline auto addOrRemoveEntry(Index &data, const T &value, bool shouldAdd) {
     if(shouldAdd) {
-      data.push_back(value);
+      data.insert(value);
     } else {
-      std::erase(data, value);
+      data.remove(value);
     }
   }
 }
@@ -60,10 +60,8 @@ namespace nall::GDB {
     }
 
     u64 addressEnd = address + size - 1;
-    for(const auto& wp : watchpointRead) {
-      if(wp.hasOverlap(address, addressEnd)) {
-        return reportWatchpoint(wp, address);
-      }
+    if(auto wp = watchpointRead.find(address, addressEnd)) {
+      return reportWatchpoint(*wp, address);
     }
   }
 
@@ -75,10 +73,8 @@ namespace nall::GDB {
     }
 
     u64 addressEnd = address + size - 1;
-    for(const auto& wp : watchpointWrite) {
-      if(wp.hasOverlap(address, addressEnd)) {
-        return reportWatchpoint(wp, address);
-      }
+    if(auto wp = watchpointWrite.find(address, addressEnd)) {
+      return reportWatchpoint(*wp, address);
     }
   }
 
@@ -86,7 +82,7 @@ namespace nall::GDB {
     if(!hasActiveClient)return true;
 
     currentPC = pc;
-    bool needHalts = forceHalt || std::ranges::find(breakpoints, pc) != breakpoints.end();
+    bool needHalts = forceHalt || breakpoints.contains(pc);
 
     if(needHalts) {
       forceHalt = true; // breakpoints may get deleted after a signal, but we have to stay stopped
@@ -107,7 +103,7 @@ namespace nall::GDB {
 
   auto Server::hasBreakpointAt(u64 pc) const -> bool {
     if(!hasActiveClient) return false;
-    return std::ranges::find(breakpoints, pc) != breakpoints.end();
+    return breakpoints.contains(pc);
   }
 
   auto Server::hasWatchpoints() const -> bool {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <nall/tcptext/tcptext-server.hpp>
+#include <nall/gdb/breakpoint.hpp>
 #include <nall/gdb/watchpoint.hpp>
 #include <functional>
 
@@ -133,9 +134,9 @@ class Server : public nall::TCPText::Server {
     maybe<u64> pcOverride{0}; // temporary override to handle edge-cases for exceptions/watchpoints
 
     // client-state:
-    std::vector<u64> breakpoints{};
-    std::vector<Watchpoint> watchpointRead{};
-    std::vector<Watchpoint> watchpointWrite{};
+    BreakpointIndex breakpoints{};
+    WatchpointIndex watchpointRead{};
+    WatchpointIndex watchpointWrite{};
 
     auto processCommand(const string& cmd, bool &shouldReply) -> string;
     auto resetClientData() -> void;
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <nall/tcptext/tcptext-server.hpp>
+#include <nall/gdb/page-filter.hpp>
 
 namespace nall::GDB {
 
@@ -29,4 +29,75 @@ namespace nall::GDB {
       return "awatch:";
     }
   };
+
+  /**
+   * Watchpoints of one access kind (read or write), queried on every memory access.
+   * Entries are kept in insertion order, since the first overlapping watchpoint is the one reported.
+   * Lookups go through a page filter, then a list sorted by start address with the running
+   * maximum end address, so only watchpoints that can still reach the access are visited.
+   */
+  struct WatchpointIndex {
+    auto empty() const { return watchpoints.empty(); }
+    auto size() const { return watchpoints.size(); }
+
+    auto find(u64 addressStart, u64 addressEnd) const -> const Watchpoint* {
+      if(!filter.test(addressStart, addressEnd)) return nullptr;
+
+      // entries past this point start after the access ends
+      auto last = std::ranges::upper_bound(sorted, addressEnd, {}, &Entry::addressStart);
+      const Watchpoint* match = nullptr;
+      for(auto entry = last; entry != sorted.begin();) {
+        --entry;
+        if(entry->reach < addressStart) break;
+        if(entry->addressEnd >= addressStart && (!match || entry->index < match - watchpoints.data())) {
+          match = &watchpoints[entry->index];
+        }
+      }
+      return match;
+    }
+
+    auto insert(const Watchpoint& wp) -> void {
+      watchpoints.push_back(wp);
+      rebuild();
+    }
+
+    auto remove(const Watchpoint& wp) -> void {
+      if(std::erase(watchpoints, wp)) rebuild();
+    }
+
+    auto clear() -> void {
+      watchpoints.clear();
+      rebuild();
+    }
+
+    auto reserve(u32 capacity) -> void {
+      watchpoints.reserve(capacity);
+      sorted.reserve(capacity);
+    }
+
+  private:
+    struct Entry {
+      u64 addressStart;
+      u64 addressEnd;
+      u64 reach; // highest end address of this and all preceding entries
+      u32 index; // position in insertion order
+    };
+
+    auto rebuild() -> void {
+      sorted.clear();
+      filter.clear();
+      for(u32 index = 0; index < watchpoints.size(); index++) {
+        auto& wp = watchpoints[index];
+        sorted.push_back({wp.addressStart, wp.addressEnd, 0, index});
+        filter.insert(wp.addressStart, wp.addressEnd);
+      }
+      std::ranges::sort(sorted, {}, &Entry::addressStart);
+      u64 reach = 0;
+      for(auto& entry : sorted) entry.reach = reach = max(reach, entry.addressEnd);
+    }
+
+    std::vector<Watchpoint> watchpoints{};
+    std::vector<Entry> sorted{};
+    PageFilter filter{};
+  };
 }
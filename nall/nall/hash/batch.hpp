@@ -0,0 +1,34 @@
+#pragma once
+
+#include <nall/file-map.hpp>
+#include <nall/thread.hpp>
+#include <nall/hash/hash.hpp>
+#include <thread>
+
+namespace nall::Hash {
+
+//hashes many files at once, spread across the available hardware threads.
+//returns one digest per location; files that cannot be opened or exceed limit yield an empty digest.
+template<typename T>
+auto batch(const std::vector<string>& locations, u64 limit = ~0ull) -> std::vector<string> {
+  std::vector<string> digests(locations.size());
+  atomic<u64> next = 0;
+
+  auto worker = [&](uintptr) {
+    for(u64 index = next++; index < locations.size(); index = next++) {
+      file_map fp;
+      if(!fp.open(locations[index], file_map::mode::read)) continue;
+      if(fp.size() > limit) continue;
+      digests[index] = T({fp.data(), fp.size()}).digest();
+    }
+  };
+
+  u64 workers = min<u64>(max(1u, std::thread::hardware_concurrency()), locations.size());
+  std::vector<thread> threads;
+  for(u64 n = 1; n < workers; n++) threads.push_back(thread::create(worker));
+  worker(0);
+  for(auto& thread : threads) thread.join();
+  return digests;
+}
+
+}
@@ -2,6 +2,13 @@
 
 #include <nall/hash/hash.hpp>
 #include <nall/iterator.hpp>
+#include <nall/instruction-set.hpp>
+
+#if defined(ARCHITECTURE_AMD64)
+  #include <immintrin.h>
+#elif defined(ARCHITECTURE_ARM64) && defined(__ARM_FEATURE_CRC32)
+  #include <arm_acle.h>
+#endif
 
 namespace nall::Hash {
 
@@ -21,6 +28,35 @@ struct CRC32 : Hash {
     checksum = (checksum >> 8) ^ table(checksum ^ value);
   }
 
+  auto input(std::span<const u8> data) -> void override {
+    auto p = data.data();
+    u64 size = data.size();
+    #if defined(ARCHITECTURE_AMD64)
+    static const bool accelerated = instruction_set::pclmulqdq() && instruction_set::sse41();
+    if(accelerated && size >= 64) {
+      u64 length = size & ~15;
+      checksum = fold(p, length, checksum);
+      p += length;
+      size -= length;
+    }
+    #elif defined(ARCHITECTURE_ARM64) && defined(__ARM_FEATURE_CRC32)
+    for(; size >= 8; p += 8, size -= 8) {
+      u64 word;
+      memcpy(&word, p, 8);
+      checksum = __crc32d(checksum, word);
+    }
+    #endif
+    auto& tables = slices();
+    for(; size >= 16; p += 16, size -= 16) {
+      checksum = tables[15][(checksum ^ p[0]) & 0xff] ^ tables[14][(checksum >> 8 ^ p[1]) & 0xff]
+               ^ tables[13][(checksum >> 16 ^ p[2]) & 0xff] ^ tables[12][(checksum >> 24 ^ p[3]) & 0xff]
+               ^ tables[11][p[ 4]] ^ tables[10][p[ 5]] ^ tables[ 9][p[ 6]] ^ tables[ 8][p[ 7]]
+               ^ tables[ 7][p[ 8]] ^ tables[ 6][p[ 9]] ^ tables[ 5][p[10]] ^ tables[ 4][p[11]]
+               ^ tables[ 3][p[12]] ^ tables[ 2][p[13]] ^ tables[ 1][p[14]] ^ tables[ 0][p[15]];
+    }
+    while(size--) input(*p++);
+  }
+
   auto output() const -> std::vector<u8> override {
     std::vector<u8> result;
     result.reserve(4);
@@ -34,22 +70,82 @@ struct CRC32 : Hash {
 
 private:
   static auto table(u8 index) -> u32 {
-    static u32 table[256] = {};
-    static bool initialized = false;
-
-    if(!initialized) {
-      initialized = true;
-      for(auto index : range(256)) {
-        u32 crc = index;
-        for(auto bit : range(8)) {
-          crc = (crc >> 1) ^ (crc & 1 ? 0xedb8'8320 : 0);
+    return slices()[0][index];
+  }
+
+  //slice-by-16 tables: slices[n][x] is the CRC of byte x followed by n zero bytes.
+  static auto slices() -> const u32 (&)[16][256] {
+    static const struct Slices {
+      Slices() {
+        for(auto index : range(256)) {
+          u32 crc = index;
+          for(auto bit : range(8)) {
+            crc = (crc >> 1) ^ (crc & 1 ? 0xedb8'8320 : 0);
+          }
+          table[0][index] = crc;
+        }
+        for(auto slice : range(1, 16)) {
+          for(auto index : range(256)) {
+            u32 crc = table[slice - 1][index];
+            table[slice][index] = (crc >> 8) ^ table[0][crc & 0xff];
+          }
         }
-        table[index] = crc;
       }
+      u32 table[16][256];
+    } slices;
+    return slices.table;
+  }
+
+  #if defined(ARCHITECTURE_AMD64)
+  static auto load(const u8* data) -> __m128i {
+    return _mm_loadu_si128((const __m128i*)data);
+  }
+
+  NALL_TARGET("pclmul") static auto step(__m128i x, __m128i k, __m128i y) -> __m128i {
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x11), _mm_clmulepi64_si128(x, k, 0x00)), y);
+  }
+
+  //folds 16-byte lanes with carry-less multiplication, then reduces them with a Barrett step.
+  //size must be a multiple of 16 and at least 64.
+  NALL_TARGET("pclmul,sse4.1") static auto fold(const u8* data, u64 size, u32 crc) -> u32 {
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+    const __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+    const __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    __m128i x1 = _mm_xor_si128(load(data + 0x00), _mm_cvtsi32_si128(crc));
+    __m128i x2 = load(data + 0x10);
+    __m128i x3 = load(data + 0x20);
+    __m128i x4 = load(data + 0x30);
+    for(data += 64, size -= 64; size >= 64; data += 64, size -= 64) {
+      x1 = step(x1, k1k2, load(data + 0x00));
+      x2 = step(x2, k1k2, load(data + 0x10));
+      x3 = step(x3, k1k2, load(data + 0x20));
+      x4 = step(x4, k1k2, load(data + 0x30));
+    }
+
+    x1 = step(x1, k3k4, x2);
+    x1 = step(x1, k3k4, x3);
+    x1 = step(x1, k3k4, x4);
+    for(; size >= 16; data += 16, size -= 16) {
+      x1 = step(x1, k3k4, load(data + 0x00));
     }
 
-    return table[index];
+    //128 bits to 64 bits
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), k5k0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    //64 bits to 32 bits
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), poly, 0x10);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask), poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return _mm_extract_epi32(x1, 1);
   }
+  #endif
 
   u32 checksum = 0;
 };
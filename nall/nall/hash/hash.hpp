@@ -21,21 +21,21 @@ struct Hash {
   virtual auto input(u8 data) -> void = 0;
   virtual auto output() const -> std::vector<u8> = 0;
 
-  auto input(std::span<const u8> data) -> void {
+  //block-oriented hashes override this to consume whole blocks at once.
+  virtual auto input(std::span<const u8> data) -> void {
     for(auto byte : data) input(byte);
   }
 
   auto input(const void* data, u64 size) -> void {
-    auto p = (const u8*)data;
-    while(size--) input(*p++);
+    input(std::span<const u8>{(const u8*)data, size});
   }
 
   auto input(const std::vector<u8>& data) -> void {
-    for(u64 n : range(data.size())) input(data[n]);
+    input(std::span<const u8>{data.data(), data.size()});
   }
 
   auto input(const string& data) -> void {
-    for(auto byte : data) input(byte);
+    input(std::span<const u8>{(const u8*)data.data(), data.size()});
   }
 
   auto digest() const -> string {
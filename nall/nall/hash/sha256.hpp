@@ -2,6 +2,13 @@
 
 #include <nall/hash/hash.hpp>
 #include <nall/iterator.hpp>
+#include <nall/instruction-set.hpp>
+
+#if defined(ARCHITECTURE_AMD64)
+  #include <immintrin.h>
+#elif defined(ARCHITECTURE_ARM64) && defined(__ARM_FEATURE_SHA2)
+  #include <arm_neon.h>
+#endif
 
 namespace nall::Hash {
 
@@ -25,6 +32,19 @@ struct SHA256 : Hash {
     length++;
   }
 
+  auto input(std::span<const u8> data) -> void override {
+    auto p = data.data();
+    u64 size = data.size();
+    length += size;
+    while(queued && size) byte(*p++), size--;
+    if(u64 count = size / 64) {
+      blocks(p, count);
+      p += count * 64;
+      size -= count * 64;
+    }
+    while(size) byte(*p++), size--;
+  }
+
   auto output() const -> std::vector<u8> override {
     SHA256 self(*this);
     self.finish();
@@ -50,6 +70,82 @@ private:
     if(++queued == 64) block(), queued = 0;
   }
 
+  //hashes whole 64-byte blocks straight from the input.
+  //the SHA extensions are used when the processor has them.
+  auto blocks(const u8* data, u64 count) -> void {
+    #if defined(ARCHITECTURE_AMD64)
+    static const bool accelerated = instruction_set::sha() && instruction_set::sse41();
+    if(accelerated) return blocksSHA(data, count);
+    #elif defined(ARCHITECTURE_ARM64) && defined(__ARM_FEATURE_SHA2)
+    return blocksSHA(data, count);
+    #endif
+    for(; count; count--, data += 64) {
+      for(auto n : range(16)) {
+        queue[n] = data[n * 4 + 0] << 24 | data[n * 4 + 1] << 16 | data[n * 4 + 2] << 8 | data[n * 4 + 3] << 0;
+      }
+      block();
+    }
+  }
+
+  #if defined(ARCHITECTURE_AMD64)
+  NALL_TARGET("sha,sse4.1") auto blocksSHA(const u8* data, u64 count) -> void {
+    const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bull, 0x0405060700010203ull);
+    __m128i cdab = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&h[0]), 0xb1);
+    __m128i efgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&h[4]), 0x1b);
+    __m128i abef = _mm_alignr_epi8(cdab, efgh, 8);
+    __m128i cdgh = _mm_blend_epi16(efgh, cdab, 0xf0);
+
+    for(; count; count--, data += 64) {
+      __m128i abefSaved = abef;
+      __m128i cdghSaved = cdgh;
+      __m128i m[4];
+      for(u32 g : range(16)) {
+        if(g < 4) m[g] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + g * 16)), mask);
+        __m128i k = _mm_add_epi32(m[g & 3], _mm_loadu_si128((const __m128i*)&constants()[g * 4]));
+        cdgh = _mm_sha256rnds2_epu32(cdgh, abef, k);
+        if(g >= 3 && g <= 14) {
+          __m128i t = _mm_alignr_epi8(m[g & 3], m[g - 1 & 3], 4);
+          m[g + 1 & 3] = _mm_sha256msg2_epu32(_mm_add_epi32(m[g + 1 & 3], t), m[g & 3]);
+        }
+        abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(k, 0x0e));
+        if(g >= 1 && g <= 12) m[g - 1 & 3] = _mm_sha256msg1_epu32(m[g - 1 & 3], m[g & 3]);
+      }
+      abef = _mm_add_epi32(abef, abefSaved);
+      cdgh = _mm_add_epi32(cdgh, cdghSaved);
+    }
+
+    __m128i feba = _mm_shuffle_epi32(abef, 0x1b);
+    __m128i dchg = _mm_shuffle_epi32(cdgh, 0xb1);
+    _mm_storeu_si128((__m128i*)&h[0], _mm_blend_epi16(feba, dchg, 0xf0));
+    _mm_storeu_si128((__m128i*)&h[4], _mm_alignr_epi8(dchg, feba, 8));
+  }
+  #elif defined(ARCHITECTURE_ARM64) && defined(__ARM_FEATURE_SHA2)
+  auto blocksSHA(const u8* data, u64 count) -> void {
+    uint32x4_t abcd = vld1q_u32(&h[0]);
+    uint32x4_t efgh = vld1q_u32(&h[4]);
+
+    for(; count; count--, data += 64) {
+      uint32x4_t abcdSaved = abcd;
+      uint32x4_t efghSaved = efgh;
+      uint32x4_t m[4];
+      for(u32 g : range(4)) m[g] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + g * 16)));
+      for(u32 g : range(16)) {
+        uint32x4_t k = vaddq_u32(m[g & 3], vld1q_u32(&constants()[g * 4]));
+        if(g < 12) m[g & 3] = vsha256su0q_u32(m[g & 3], m[g + 1 & 3]);
+        uint32x4_t t = abcd;
+        abcd = vsha256hq_u32(abcd, efgh, k);
+        efgh = vsha256h2q_u32(efgh, t, k);
+        if(g < 12) m[g & 3] = vsha256su1q_u32(m[g & 3], m[g + 2 & 3], m[g + 3 & 3]);
+      }
+      abcd = vaddq_u32(abcd, abcdSaved);
+      efgh = vaddq_u32(efgh, efghSaved);
+    }
+
+    vst1q_u32(&h[0], abcd);
+    vst1q_u32(&h[4], efgh);
+  }
+  #endif
+
   auto block() -> void {
     for(auto n : range(16)) w[n] = queue[n];
     for(auto n : range(16, 64)) {
@@ -85,7 +181,11 @@ private:
   }
 
   auto cube(u32 n) -> u32 {
-    static const u32 value[64] = {
+    return constants()[n];
+  }
+
+  static auto constants() -> const u32* {
+    alignas(16) static const u32 value[64] = {
       0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
       0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
       0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
@@ -95,7 +195,7 @@ private:
       0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
       0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
     };
-    return value[n];
+    return value;
   }
 
   u32 queue[16] = {};
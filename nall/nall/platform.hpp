@@ -167,16 +167,19 @@ namespace nall {
 
 #if defined(COMPILER_CLANG) || defined(COMPILER_GCC)
   #define NALL_NOINLINE __attribute__((noinline))
+  #define NALL_TARGET(features) __attribute__((target(features)))
   #define alwaysinline inline __attribute__((always_inline))
   #define NALL_USED __attribute__((used))
 #elif defined(COMPILER_MICROSOFT)
   #define no_optimize
   #define NALL_NOINLINE __declspec(noinline)
+  #define NALL_TARGET(features)
   #define alwaysinline inline __forceinline
   #define NALL_USED
 #else
   #define no_optimize
   #define NALL_NOINLINE
+  #define NALL_TARGET(features)
   #define alwaysinline inline
   #define NALL_USED
 #endif
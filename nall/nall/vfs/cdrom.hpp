@@ -164,9 +164,10 @@ private:
     s32 lbaFileBase = 0;
     for(auto& file : cuesheet->files) {
       bool usingFileBuffer = false;
+      bool usingInflater = false;
       size_t fileDataReadPos = 0;
       file_buffer fileBuffer;
-      std::vector<u8> rawDataBuffer;
+      Decode::Inflater inflater;
       std::span<const u8> rawDataView;
       if(compressedFile != nullptr) {
         auto filePathInArchive = file.archiveFolder;
@@ -175,9 +176,10 @@ private:
         if(fileEntry) {
           if(archive->isDataUncompressed(*fileEntry)) {
             rawDataView = archive->dataViewIfUncompressed(*fileEntry);
-          } else {
-            rawDataBuffer = archive->extract(*fileEntry);
-            rawDataView = {rawDataBuffer.data(), rawDataBuffer.size()};
+          } else if(fileEntry->cmode == 8) {
+            //decompress as the sectors are filled in, rather than extracting the whole track first
+            inflater.open(fileEntry->data, fileEntry->csize);
+            usingInflater = true;
           }
         }
       } else {
@@ -185,8 +187,20 @@ private:
         fileBuffer = nall::file::open(location, nall::file::mode::read);
         usingFileBuffer = true;
       }
+      auto readData = [&](u8* target, u32 length) {
+        if(usingFileBuffer) {
+          fileBuffer.read({target, length});
+        } else if(usingInflater) {
+          if(auto size = inflater.read(target, length); size < length) memory::fill(target + size, length - size);
+        } else {
+          memcpy(target, rawDataView.data() + fileDataReadPos, length);
+          fileDataReadPos += length;
+        }
+      };
       if(file.type == "wave") {
-        if(usingFileBuffer) fileBuffer.seek(44); //skip RIFF header
+        //skip RIFF header
+        if(usingFileBuffer) fileBuffer.seek(44);
+        else if(usingInflater) { u8 header[44]; inflater.read(header, sizeof(header)); }
         else fileDataReadPos = 44;
       }
       for(auto& track : file.tracks) {
@@ -207,22 +221,12 @@ private:
               target[13] = BCD::encode(msf.second);
               target[14] = BCD::encode(msf.frame);
               target[15] = 0x01;  // mode
-              if(usingFileBuffer) {
-                fileBuffer.read({ target + 16, length });
-              } else {
-                memcpy(target + 16, rawDataView.data() + fileDataReadPos, length);
-                fileDataReadPos += length;
-              }
+              readData(target + 16, length);
               CD::RSPC::encodeMode1({target, 2352});
             }
             if(length == 2352) {
               //BIN + WAV: direct copy
-              if(usingFileBuffer) {
-                fileBuffer.read({target, length});
-              } else {
-                memcpy(target, rawDataView.data() + fileDataReadPos, length);
-                fileDataReadPos += length;
-              }
+              readData(target, length);
             }
             _loadOffset = offset + 2448;
           }
@@ -70,6 +70,14 @@ struct directory : node {
     return true;
   }
 
+  auto append(const string& name, std::vector<u8>&& buffer) -> bool {
+    if(find(name)) return false;
+    auto item = memory::open(std::move(buffer));
+    item->setName(name);
+    _nodes.push_back(item);
+    return true;
+  }
+
   auto append(std::shared_ptr<node> item) -> bool {
     if(find(item)) return false;
     _nodes.push_back(item);
@@ -13,6 +13,7 @@ struct disk : file {
   }
 
   auto writable() const -> bool override { return _writable; }
+  auto mapped() const -> bool override { return _mapped; }
   auto data() const -> const u8* override { return _data; }
   auto data() -> u8* override { return _data; }
   auto size() const -> u64 override { return _size; }
@@ -43,10 +44,14 @@ private:
   auto operator=(const disk&) -> disk& = delete;
 
   auto _open(string location_, mode mode_) -> bool {
-    if(!_fp.open(location_, (u32)mode_)) return false;
+    u32 access = file_map::mode::read;
+    if(mode_ == mode::write) access = file_map::mode::write;
+    if(mode_ == mode::copy) access = file_map::mode::copy;
+    if(!_fp.open(location_, access)) return false;
     _data = _fp.data();
     _size = _fp.size();
     _writable = mode_ == mode::write;
+    _mapped = mode_ == mode::copy && _data;
     return true;
   }
 
@@ -55,6 +60,7 @@ private:
   u64 _size = 0;
   u64 _offset = 0;
   bool _writable = false;
+  bool _mapped = false;
 };
 
 }
@@ -17,11 +17,21 @@ struct file : node {
   virtual auto write(u8 data) -> void = 0;
   virtual auto flush() -> void {}
 
+  //true when data() is a private mapping that may be modified and outlives any other reader.
+  //such files can back emulated memory directly instead of being copied into it.
+  virtual auto mapped() const -> bool { return false; }
+
   auto end() const -> bool {
     return offset() >= size();
   }
 
   auto read(std::span<u8> span) -> void {
+    if(auto source = std::as_const(*this).data(); source && offset() <= size()) {
+      u64 length = min<u64>(span.size(), size() - offset());
+      nall::memory::copy(span.data(), source + offset(), length);
+      nall::memory::fill(span.data() + length, span.size() - length);
+      return seek(span.size(), index::relative);
+    }
     for(auto& byte : span) byte = read();
   }
 
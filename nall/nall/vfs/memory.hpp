@@ -6,8 +6,6 @@
 namespace nall::vfs {
 
 struct memory : file {
-  ~memory() { nall::memory::free(_data); }
-
   static auto create(u64 size = 0) -> std::shared_ptr<memory> {
     struct enable_make_shared : memory { using memory::memory; };
     auto instance = std::make_shared<enable_make_shared>();
@@ -22,15 +20,22 @@ struct memory : file {
     return instance;
   }
 
+  //takes ownership of an already materialized buffer without copying it.
+  static auto open(std::vector<u8>&& buffer) -> std::shared_ptr<memory> {
+    struct enable_make_shared : memory { using memory::memory; };
+    auto instance = std::make_shared<enable_make_shared>();
+    instance->_buffer = std::move(buffer);
+    return instance;
+  }
+
   auto writable() const -> bool override { return true; }
-  auto data() const -> const u8* override { return _data; }
-  auto data() -> u8* override { return _data; }
-  auto size() const -> u64 override { return _size; }
+  auto data() const -> const u8* override { return _buffer.data(); }
+  auto data() -> u8* override { return _buffer.data(); }
+  auto size() const -> u64 override { return _buffer.size(); }
   auto offset() const -> u64 override { return _offset; }
 
   auto resize(u64 size) -> bool override {
-    _data = nall::memory::resize(_data, size);
-    _size = size;
+    _buffer.resize(size);
     return true;
   }
 
@@ -40,13 +45,13 @@ struct memory : file {
   }
 
   auto read() -> u8 override {
-    if(_offset >= _size) return 0x00;
-    return _data[_offset++];
+    if(_offset >= _buffer.size()) return 0x00;
+    return _buffer[_offset++];
   }
 
   auto write(u8 data) -> void override {
-    if(_offset >= _size) return;
-    _data[_offset++] = data;
+    if(_offset >= _buffer.size()) return;
+    _buffer[_offset++] = data;
   }
 
 private:
@@ -55,18 +60,14 @@ private:
   auto operator=(const memory&) -> memory& = delete;
 
   auto _create(u64 size) -> void {
-    _size = size;
-    _data = nall::memory::allocate<u8>(size, 0x00);
+    _buffer.resize(size);
   }
 
   auto _open(const u8* data, u64 size) -> void {
-    _size = size;
-    _data = nall::memory::allocate(size);
-    nall::memory::copy(_data, data, size);
+    _buffer.assign(data, data + size);
   }
 
-  u8* _data = nullptr;
-  u64 _size = 0;
+  std::vector<u8> _buffer;
   u64 _offset = 0;
 };
 
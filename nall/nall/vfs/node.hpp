@@ -1,8 +1,9 @@
 namespace nall::vfs {
 
-enum class mode : u32 { read, write };
+enum class mode : u32 { read, write, copy };
 static constexpr auto read  = mode::read;
 static constexpr auto write = mode::write;
+static constexpr auto copy  = mode::copy;  //read-only file; writes through data() stay private
 
 enum class index : u32 { absolute, relative };
 static constexpr auto absolute = index::absolute;
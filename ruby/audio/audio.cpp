@@ -100,6 +100,11 @@ auto Audio::clear() -> void{
 }
 
 auto Audio::output(const f64 samples[]) -> void {
+  output(samples, 1);
+}
+
+//samples holds the given number of stereo frames, interleaved.
+auto Audio::output(const f64 samples[], u32 frames) -> void {
   if(!_ready) return;
 
   if(_blocking) {
@@ -114,10 +119,9 @@ auto Audio::output(const f64 samples[]) -> void {
     }
   }
 
-  f32 output[2];
-  output[0] = samples[0];
-  output[1] = samples[1];
-  SDL_PutAudioStreamData(static_cast<SDL_AudioStream*>(_stream), output, sizeof(output));
+  _outputBuffer.resize(frames * 2);
+  for(u32 n : range(frames * 2)) _outputBuffer[n] = samples[n];
+  SDL_PutAudioStreamData(static_cast<SDL_AudioStream*>(_stream), _outputBuffer.data(), frames * 2 * sizeof(f32));
 }
 
 auto Audio::level() -> f64 {
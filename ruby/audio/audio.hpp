@@ -38,6 +38,7 @@ struct Audio {
   auto clear() -> void;
   auto level() -> double;
   auto output(const f64 samples[]) -> void;
+  auto output(const f64 samples[], u32 frames) -> void;
 
 private:
   auto initialize() -> bool;
@@ -64,4 +65,5 @@ private:
   std::vector<string> _devices;
   std::vector<nall::DSP::Resampler::Cubic> _resamplers;
   std::vector<f64> _resampleBuffer;
+  std::vector<f32> _outputBuffer;
 };
@@ -0,0 +1,126 @@
+#include <nall/nall.hpp>
+using namespace nall;
+
+#include <nall/main.hpp>
+#include <nall/gdb/server.hpp>
+
+//measures the per-instruction and per-access cost of breakpoint and watchpoint lookups
+//while a debugger is attached, comparing the indexed lookups of the GDB server against
+//the linear searches they replaced. both must agree on every hit.
+
+namespace Benchmark {
+  using namespace nall::GDB;
+
+  //deterministic, so runs are comparable
+  struct Random {
+    u64 state = 0x9e3779b97f4a7c15;
+    auto operator()() -> u64 {
+      state ^= state << 13;
+      state ^= state >> 7;
+      state ^= state << 17;
+      return state;
+    }
+  };
+
+  struct Result {
+    u64 hits = 0;
+    u64 checksum = 0;  //identifies which entries were hit
+    u64 elapsed = 0;
+  };
+
+  template<typename F>
+  auto measure(F&& lookup, const std::vector<u64>& addresses) -> Result {
+    Result result;
+    auto start = chrono::nanosecond();
+    for(auto address : addresses) {
+      if(u64 key = lookup(address)) result.hits++, result.checksum += key;
+    }
+    result.elapsed = chrono::nanosecond() - start;
+    return result;
+  }
+
+  auto report(const char* name, u32 count, const Result& linear, const Result& indexed, u64 lookups) -> void {
+    print(pad(name, -12L), " ",
+      pad(count, 4L), " entries  ",
+      pad(string{(f64)linear.elapsed / lookups}.slice(0, 5), 6L), " ns linear  ",
+      pad(string{(f64)indexed.elapsed / lookups}.slice(0, 5), 6L), " ns indexed  ",
+      pad(indexed.hits, 8L), " hits",
+      linear.checksum != indexed.checksum ? "  MISMATCH" : "", "\n");
+  }
+
+  //program counters walk through code in short runs, like basic blocks of a game loop
+  auto generatePCs(Random& random, u32 lookups) -> std::vector<u64> {
+    std::vector<u64> pcs;
+    pcs.reserve(lookups);
+    u64 pc = 0x80000400;
+    while(pcs.size() < lookups) {
+      if(random() % 16 == 0) pc = 0x80000400 + (random() % 0x100000 & ~3ull);
+      pcs.push_back(pc);
+      pc += 4;
+    }
+    return pcs;
+  }
+
+  //data accesses spread across the whole of RDRAM (as normalized physical addresses)
+  auto generateAccesses(Random& random, u32 lookups) -> std::vector<u64> {
+    std::vector<u64> accesses;
+    accesses.reserve(lookups);
+    for(u32 n : range(lookups)) accesses.push_back(random() % 0x800000 & ~3ull);
+    return accesses;
+  }
+
+  auto benchmarkBreakpoints(u32 count, const std::vector<u64>& pcs) -> void {
+    Random random;
+    std::vector<u64> linear;
+    BreakpointIndex indexed;
+    for(u32 n : range(count)) {
+      u64 address = 0x80000400 + (random() % 0x100000 & ~3ull);
+      linear.push_back(address);
+      indexed.insert(address);
+    }
+
+    auto before = measure([&](u64 pc) -> u64 { return std::ranges::find(linear, pc) != linear.end() ? pc : 0; }, pcs);
+    auto after = measure([&](u64 pc) -> u64 { return indexed.contains(pc) ? pc : 0; }, pcs);
+    report("breakpoints", count, before, after, pcs.size());
+  }
+
+  auto benchmarkWatchpoints(u32 count, const std::vector<u64>& accesses) -> void {
+    Random random;
+    std::vector<Watchpoint> linear;
+    WatchpointIndex indexed;
+    for(u32 n : range(count)) {
+      //mostly single variables, with the occasional array or structure
+      u64 start = random() % 0x800000 & ~3ull;
+      u64 size = random() % 8 == 0 ? 0x100 << random() % 6 : 4;
+      Watchpoint wp{start, start + size - 1, 0x80000000 | start, WatchpointType::READ};
+      linear.push_back(wp);
+      indexed.insert(wp);
+    }
+
+    auto before = measure([&](u64 address) -> u64 {
+      for(auto& wp : linear) {
+        if(wp.hasOverlap(address, address + 3)) return wp.addressStart + wp.addressEnd;
+      }
+      return 0;
+    }, accesses);
+    auto after = measure([&](u64 address) -> u64 {
+      auto wp = indexed.find(address, address + 3);
+      return wp ? wp->addressStart + wp->addressEnd : 0;
+    }, accesses);
+    report("watchpoints", count, before, after, accesses.size());
+  }
+}
+
+auto nall::main(Arguments arguments) -> void {
+  using namespace Benchmark;
+
+  u32 lookups = 4'000'000;
+  if(arguments) lookups = arguments.take().natural();
+
+  Random random;
+  auto pcs = generatePCs(random, lookups);
+  auto accesses = generateAccesses(random, lookups);
+
+  for(u32 count : {0, 1, 4, 16, 64, 256, 1024}) benchmarkBreakpoints(count, pcs);
+  for(u32 count : {0, 1, 4, 16, 64, 256, 1024}) benchmarkWatchpoints(count, accesses);
+}
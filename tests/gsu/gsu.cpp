@@ -0,0 +1,309 @@
+#include <nall/nall.hpp>
+using namespace nall;
+
+#include <nall/main.hpp>
+
+#include <ares/ares.hpp>
+#include <component/processor/gsu/gsu.hpp>
+
+//runs random cache-resident programs on the interpreter and on the recompiler,
+//and checks that both leave the same registers, RAM, plotted pixels and clock.
+
+struct GSU : ares::GSU {
+  u64 clock = 0;
+  u64 plotted = 0;
+  u32 stops = 0;
+  bool recompile = false;
+  std::vector<u8> rom = std::vector<u8>(2_MiB);
+  std::vector<u8> ram = std::vector<u8>(128_KiB);
+
+  //the bus below follows ares/sfc/coprocessor/superfx, without the S-CPU side.
+  auto step(u32 clocks) -> void override {
+    if(regs.romcl) {
+      regs.romcl -= min(clocks, regs.romcl);
+      if(regs.romcl == 0) {
+        regs.sfr.r = 0;
+        regs.romdr = read((regs.rombr << 16) + regs.r[14]);
+      }
+    }
+    if(regs.ramcl) {
+      regs.ramcl -= min(clocks, regs.ramcl);
+      if(regs.ramcl == 0) {
+        write(0x700000 + (regs.rambr << 16) + regs.ramar, regs.ramdr);
+      }
+    }
+    clock += clocks;
+  }
+
+  auto stop() -> void override { stops++; }
+
+  auto color(n8 source) -> n8 override {
+    if(regs.por.highnibble) return (regs.colr & 0xf0) | (source >> 4);
+    if(regs.por.freezehigh) return (regs.colr & 0xf0) | (source & 0x0f);
+    return source;
+  }
+
+  auto plot(n8 x, n8 y) -> void override {
+    plotted = plotted * 1000003 ^ (x | y << 8 | regs.colr << 16 | clock << 24);
+  }
+
+  auto rpix(n8 x, n8 y) -> n8 override {
+    step(3);
+    return x ^ y;
+  }
+
+  auto readOpcode(n16 address) -> n8 {
+    n16 offset = address - regs.cbr;
+    if(offset < 512) {
+      if(cache.valid[offset >> 4] == false) {
+        u32 dp = offset & 0xfff0;
+        u32 sp = (regs.pbr << 16) + ((regs.cbr + dp) & 0xfff0);
+        for(u32 n : range(16)) {
+          step(regs.clsr ? 5 : 6);
+          cache.buffer[dp++] = read(sp++);
+        }
+        cache.valid[offset >> 4] = true;
+        if(regs.pbr >= 0x60) recompiler.invalidate();
+      } else {
+        step(regs.clsr ? 1 : 2);
+      }
+      return cache.buffer[offset];
+    }
+    if(regs.pbr <= 0x5f) syncROMBuffer();
+    else syncRAMBuffer();
+    step(regs.clsr ? 5 : 6);
+    return read(regs.pbr << 16 | address);
+  }
+
+  auto peekpipe() -> n8 {
+    n8 result = regs.pipeline;
+    regs.pipeline = readOpcode(regs.r[15]);
+    regs.r[15].modified = false;
+    return result;
+  }
+
+  auto pipe() -> n8 override {
+    n8 result = regs.pipeline;
+    regs.pipeline = readOpcode(++regs.r[15]);
+    regs.r[15].modified = false;
+    return result;
+  }
+
+  auto syncROMBuffer() -> void override { if(regs.romcl) step(regs.romcl); }
+  auto readROMBuffer() -> n8 override { syncROMBuffer(); return regs.romdr; }
+  auto updateROMBuffer() -> void override { regs.sfr.r = 1; regs.romcl = regs.clsr ? 5 : 6; }
+  auto syncRAMBuffer() -> void override { if(regs.ramcl) step(regs.ramcl); }
+
+  auto readRAMBuffer(n16 address) -> n8 override {
+    syncRAMBuffer();
+    return read(0x700000 + (regs.rambr << 16) + address);
+  }
+
+  auto writeRAMBuffer(n16 address, n8 data) -> void override {
+    syncRAMBuffer();
+    regs.ramcl = regs.clsr ? 5 : 6;
+    regs.ramar = address;
+    regs.ramdr = data;
+  }
+
+  auto flushCache() -> void override {
+    for(u32 n : range(32)) cache.valid[n] = false;
+    if(recompiler.written) {
+      recompiler.written = false;
+      recompiler.invalidate();
+    }
+  }
+
+  auto read(n24 address, n8 data = 0) -> n8 override {
+    if((address & 0xc00000) == 0x000000) return rom[((address & 0x3f0000) >> 1 | (address & 0x7fff)) & 0x1fffff];
+    if((address & 0xe00000) == 0x400000) return rom[address & 0x1fffff];
+    if((address & 0xfe0000) == 0x700000) return ram[address & 0x1ffff];
+    return data;
+  }
+
+  auto write(n24 address, n8 data) -> void override {
+    if((address & 0xfe0000) == 0x700000) ram[address & 0x1ffff] = data;
+  }
+
+  auto main() -> void {
+    if(recompile) {
+      if(auto block = recompiler.block()) return block->execute(*this);
+    }
+    auto opcode = peekpipe();
+    instruction(opcode);
+    if(regs.r[14].modified) {
+      regs.r[14].modified = false;
+      updateROMBuffer();
+    }
+    if(regs.r[15].modified) {
+      regs.r[15].modified = false;
+    } else {
+      regs.r[15]++;
+    }
+  }
+};
+
+struct Test {
+  u32 seed;
+  u32 length;      //size of the random program body in bytes
+  u32 iterations;  //how often the body is looped
+  u16 origin;      //where the program is placed in the first ROM bank
+  bool clsr;
+  bool ms0;
+};
+
+static u32 seed = 1;
+static auto next() -> u32 { seed = seed * 1103515245 + 12345; return seed >> 8; }
+
+//r12, r13 and r15 drive the LOOP that repeats the body, so the body never writes them.
+static auto target() -> u32 {
+  while(true) if(u32 n = next() & 15; n != 12 && n != 13 && n != 15) return n;
+}
+
+static auto generate(std::vector<u8>& p, u32 length) -> void {
+  std::vector<u32> starts;
+  std::vector<std::pair<u32, u32>> branches;  //displacement offset, instruction index
+  while(p.size() < length) {
+    starts.push_back(p.size());
+    if(next() % 3 == 0) p.push_back(0x3d + next() % 3);   //alt1, alt2, alt3
+    if(next() % 4 == 0) p.push_back(0x10 | target());     //to
+    if(next() % 4 == 0) p.push_back(0xb0 | next() & 15);  //from
+    if(next() % 6 == 0) p.push_back(0x20 | target());     //with
+    switch(next() % 40) {
+    case  0: p.push_back(0x01); break;  //nop
+    case  1: p.push_back(0x03); break;  //lsr
+    case  2: p.push_back(0x04); break;  //rol
+    case  3: p.push_back(0x4d); break;  //swap
+    case  4: p.push_back(0x4f); break;  //not
+    case  5: p.push_back(0x50 | next() & 15); break;  //add
+    case  6: p.push_back(0x60 | next() & 15); break;  //sub
+    case  7: p.push_back(0x70); break;  //merge
+    case  8: p.push_back(0x71 + next() % 15); break;  //and
+    case  9: p.push_back(0x80 | next() & 15); break;  //mult
+    case 10: p.push_back(0x90); break;  //sbk
+    case 11: p.push_back(0x91 + next() % 4); break;  //link
+    case 12: p.push_back(0x95); break;  //sex
+    case 13: p.push_back(0x96); break;  //asr
+    case 14: p.push_back(0x97); break;  //ror
+    case 15: p.push_back(0x9e); break;  //lob
+    case 16: p.push_back(0x9f); break;  //fmult
+    case 17: p.push_back(0xa0 | target()); p.push_back(next()); break;  //ibt
+    case 18: p.push_back(0xc0); break;  //hib
+    case 19: p.push_back(0xc1 + next() % 15); break;  //or
+    case 20: p.push_back(0xd0 | target()); break;  //inc
+    case 21: p.push_back(0xdf); break;  //getc
+    case 22: p.push_back(0xe0 | target()); break;  //dec
+    case 23: p.push_back(0xef); break;  //getb
+    case 24: p.push_back(0xf0 | target()); p.push_back(next()); p.push_back(next()); break;  //iwt
+    case 25: p.push_back(0x30 + next() % 12); break;  //stw
+    case 26: p.push_back(0x40 + next() % 12); break;  //ldw
+    case 27: p.push_back(0x4c); break;  //plot
+    case 28: p.push_back(0x4e); break;  //color
+    case 29: p.push_back(0x10 | target()); p.push_back(0x20 | next() & 15); p.push_back(0x10 | target()); break;
+    case 30: p.push_back(0x20 | target()); p.push_back(0xb0 | next() & 15); break;
+    case 31: case 32: case 33:  //branch, with a nop in the delay slot
+      p.push_back(0x05 + next() % 11);
+      branches.push_back({(u32)p.size(), (u32)starts.size()});
+      p.push_back(0x00);
+      p.push_back(0x01);
+      break;
+    case 34: p.push_back(0xee); break;  //dec r14: reloads the ROM buffer
+    case 35: p.push_back(0xde); break;  //inc r14
+    case 36: p.push_back(0x3e); p.push_back(0xa0 | target()); p.push_back(next()); break;  //sms
+    case 37: p.push_back(0x3d); p.push_back(0xf0 | target()); p.push_back(next()); p.push_back(next()); break;  //lm
+    case 38: p.push_back(0x3e); p.push_back(0xf0 | target()); p.push_back(next()); p.push_back(next()); break;  //sm
+    default: p.push_back(0x01); break;
+    }
+  }
+  starts.push_back(p.size());
+
+  //branches only go forward, to the start of one of the next few instructions
+  for(auto [offset, index] : branches) {
+    u32 address = starts[index + next() % min<u32>(8, starts.size() - index)];
+    s32 displacement = (s32)max(address, offset + 1) - (s32)(offset + 1);
+    p[offset] = displacement > 127 ? 0 : displacement;
+  }
+}
+
+static auto run(GSU& gsu, const Test& test, bool recompile) -> void {
+  seed = test.seed;
+  gsu.power();
+  gsu.flushCache();
+  gsu.clock = 0;
+  gsu.plotted = 0;
+  gsu.stops = 0;
+  gsu.recompile = recompile;
+  gsu.recompiler.enabled = recompile;
+  for(auto& data : gsu.rom) data = next();
+  for(auto& data : gsu.ram) data = next();
+  for(u32 n : range(12)) gsu.regs.r[n] = next();
+  gsu.regs.r[14] = next();
+  gsu.regs.clsr = test.clsr;
+  gsu.regs.cfgr.ms0 = test.ms0;
+  gsu.regs.scmr.ron = 1;
+  gsu.regs.scmr.ran = 1;
+  gsu.regs.cbr = test.origin & 0xfff0;
+
+  std::vector<u8> p;
+  u16 loop = test.origin + 6;
+  p.insert(p.end(), {0xfc, (u8)test.iterations, (u8)(test.iterations >> 8)});  //iwt r12,#iterations
+  p.insert(p.end(), {0xfd, (u8)loop, (u8)(loop >> 8)});                        //iwt r13,#loop
+  generate(p, test.length);
+  p.insert(p.end(), {0x3c, 0x01, 0x00, 0x01});  //loop; nop; stop; nop
+  for(u32 n : range(p.size())) gsu.rom[test.origin + n & 0x7fff] = p[n];
+
+  gsu.regs.r[15] = test.origin;
+  gsu.regs.sfr.g = 1;
+  for(u32 steps = 0; gsu.regs.sfr.g && steps < 50'000'000; steps++) gsu.main();
+}
+
+static auto compare(const GSU& x, const GSU& y) -> string {
+  string s;
+  for(u32 n : range(16)) {
+    if(x.regs.r[n].data != y.regs.r[n].data) s.append("r", n, " ", hex(x.regs.r[n].data, 4L), " != ", hex(y.regs.r[n].data, 4L), "; ");
+  }
+  if(x.regs.sfr.data != y.regs.sfr.data) s.append("sfr ", hex(x.regs.sfr.data, 4L), " != ", hex(y.regs.sfr.data, 4L), "; ");
+  if(x.regs.pipeline != y.regs.pipeline) s.append("pipeline; ");
+  if(x.regs.ramaddr != y.regs.ramaddr) s.append("ramaddr; ");
+  if(x.regs.romdr != y.regs.romdr || x.regs.romcl != y.regs.romcl) s.append("rom buffer; ");
+  if(x.regs.ramcl != y.regs.ramcl) s.append("ram buffer; ");
+  if(x.regs.rombr != y.regs.rombr || x.regs.rambr != y.regs.rambr) s.append("bank; ");
+  if(x.regs.colr != y.regs.colr) s.append("colr; ");
+  if(x.regs.sreg != y.regs.sreg || x.regs.dreg != y.regs.dreg) s.append("sreg/dreg; ");
+  if(x.clock != y.clock) s.append("clock ", x.clock, " != ", y.clock, "; ");
+  if(x.plotted != y.plotted) s.append("plot; ");
+  if(x.stops != y.stops) s.append("stop; ");
+  if(x.ram != y.ram) s.append("ram; ");
+  return s;
+}
+
+auto nall::main(Arguments arguments) -> void {
+  if constexpr(!ares::GSU::Accuracy::Recompiler) {
+    print("the GSU recompiler is not supported on this architecture\n");
+    return;
+  }
+
+  u32 count = 2000;
+  if(arguments) count = arguments.take().natural();
+
+  auto interpreter = std::make_unique<GSU>();
+  auto recompiler = std::make_unique<GSU>();
+  u32 failures = 0;
+  for(u32 index : range(count)) {
+    Test test;
+    test.seed = index + 1;
+    test.length = 20 + index % 400;
+    test.iterations = 1 + index % 5;
+    test.origin = index & 4 ? 0x0000 : 0x1230 + index % 7 * 0x10 + (index & 8 ? 0x8000 : 0);
+    test.clsr = index & 1;
+    test.ms0 = index & 2;
+    run(*interpreter, test, false);
+    run(*recompiler, test, true);
+    if(auto difference = compare(*interpreter, *recompiler)) {
+      if(failures++ < 10) print("test ", index, ": ", difference, "\n");
+    }
+  }
+
+  print(count - failures, " of ", count, " programs matched\n");
+  if(failures) exit(EXIT_FAILURE);
+}
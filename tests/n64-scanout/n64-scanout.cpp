@@ -0,0 +1,91 @@
+#include <nall/nall.hpp>
+using namespace nall;
+
+#include <nall/main.hpp>
+
+#include <n64/n64.hpp>
+
+//checks the direct scanout of the N64 VI, which reads RDRAM without its accessors,
+//against the pixels that the RDRAM accessors return for the same line.
+
+namespace ares::Nintendo64 {
+  struct Case {
+    const char* name;
+    u32 depth;    //bytes per pixel
+    u32 address;  //framebuffer origin
+    u32 xscale;
+    u32 xsubpixel;
+  };
+
+  //the pixel that VI::refresh() produces from a value read through the accessors
+  auto expected(u32 depth, u32 address) -> u32 {
+    if(depth == 2) return 1 << 24 | (u16)rdram.ram.read<Half>(address, RBusDevice::VI_DMA) >> 1;
+    return (u32)rdram.ram.read<Word>(address, RBusDevice::VI_DMA) >> 8;
+  }
+
+  auto compare(const Case& test, u32 y, u32 address, const std::vector<u32>& output) -> u32 {
+    u32 errors = 0;
+    auto& columns = vi.scanout.columns;
+    for(u32 n : range(columns.size())) {
+      u32 pixel = expected(test.depth, address + columns[n] * test.depth);
+      if(output[n] == pixel) continue;
+      if(errors++ < 4) {
+        print(test.name, ": line ", y, " pixel ", n, ": ", hex(output[n], 8L), " != ", hex(pixel, 8L), "\n");
+      }
+    }
+    return errors;
+  }
+
+  auto run(const Case& test) -> bool {
+    vi.io.hstart = 108;
+    vi.io.xscale = test.xscale;
+    vi.io.xsubpixel = test.xsubpixel;
+    vi.scanout.reset();
+    vi.scanout.frame(test.depth, 108, 108 + 319);
+
+    u32 errors = 0;
+    std::vector<u32> output(vi.scanout.columns.size());
+    for(u32 y : range(2)) {
+      u32 address = test.address + y * 0x1000;
+      errors += compare(test, y, address, (vi.scanout.line(y, output.data(), address), output));
+
+      //the second pass is served from the pixels kept for the line, unless its source changed
+      rdram.ram.write<Word>(address + 0x40, 0x12345678, RBusDevice::VR4300_UNCACHED);
+      errors += compare(test, y, address, (vi.scanout.line(y, output.data(), address), output));
+      errors += compare(test, y, address, (vi.scanout.line(y, output.data(), address), output));
+    }
+
+    print(pad(test.name, -28L), errors ? "failed" : "passed", "\n");
+    return !errors;
+  }
+}
+
+auto nall::main(Arguments arguments) -> void {
+  using namespace ares::Nintendo64;
+
+  //the hidden bits are normally owned by the Vulkan RDP
+  std::vector<u8> hidden(2_MiB);
+  rdram.ram.allocate(4_MiB);
+  rdram.hidden.data = hidden.data();
+  rdram.mapIdentity = 1;
+  ares::Nintendo64::system.homebrewMode = 0;
+
+  //fill RDRAM through the accessors with a pattern that differs in every byte
+  u32 seed = 0x2545f491;
+  for(u32 address = 0; address < 4_MiB; address += 4) {
+    seed = seed * 1664525 + 1013904223;
+    rdram.ram.write<Word>(address, seed, RBusDevice::VR4300_UNCACHED);
+  }
+
+  const Case cases[] = {
+    {"16bpp",                    2, 0x100000, 0x400, 0},
+    {"16bpp unaligned start",    2, 0x100002, 0x400, 0},
+    {"16bpp scaled",             2, 0x100000, 0x200, 0x100},
+    {"32bpp",                    4, 0x200000, 0x400, 0},
+    {"32bpp scaled",             4, 0x200000, 0x2aa, 0x155},
+  };
+
+  bool passed = true;
+  for(auto& test : cases) passed &= run(test);
+  if(!passed) exit(EXIT_FAILURE);
+}
@@ -0,0 +1,172 @@
+#include <nall/nall.hpp>
+using namespace nall;
+
+#include <nall/main.hpp>
+
+#include <ares/ares.hpp>
+
+//measures the overhead of the cooperative scheduler itself, independent of any emulation work.
+//each simulated system is a set of threads with representative frequencies and step sizes;
+//the primary thread synchronizes to every other thread after each step, as CPU cores do,
+//and every other thread synchronizes back to the primary thread.
+
+namespace ares::Benchmark {
+  #include <ares/inline.hpp>
+  Scheduler scheduler;
+
+  u64 switches = 0;
+  void* previous = nullptr;
+
+  //counts each time execution resumes in a different thread than the one that last ran.
+  auto resumed(void* thread) -> void {
+    if(previous != thread) switches++, previous = thread;
+  }
+
+  struct Component : Thread {
+    bool primary = false;
+    u32 clocks = 0;
+    u64 frame = 0;    //clocks per frame (primary thread only)
+    u64 elapsed = 0;
+
+    auto main() -> void {
+      resumed(this);
+      step(clocks);
+      if(primary) {
+        Thread::synchronize();
+        resumed(this);
+        if((elapsed += clocks) >= frame) {
+          elapsed -= frame;
+          scheduler.exit(Event::Frame);
+          resumed(this);
+        }
+      } else {
+        Thread::synchronize(*threads[0]);
+        resumed(this);
+      }
+    }
+
+    static inline std::vector<Component*> threads;
+  };
+
+  struct Sound : Passive {
+    u32 clocks = 0;
+    auto main() -> void { step(clocks); }
+  };
+
+  struct Profile {
+    string name;
+    struct Device { f64 frequency; u32 clocks; bool passive; };
+    std::vector<Device> devices;
+  };
+
+  auto run(const Profile& profile, u32 frames) -> void {
+    scheduler.reset();
+    std::vector<std::unique_ptr<Component>> threads;
+    std::vector<std::unique_ptr<Sound>> passives;
+    Component::threads.clear();
+
+    for(auto& device : profile.devices) {
+      if(device.passive) {
+        auto& passive = passives.emplace_back(std::make_unique<Sound>());
+        passive->clocks = device.clocks;
+        passive->create(device.frequency, std::bind_front(&Sound::main, passive.get()));
+        continue;
+      }
+      auto& thread = threads.emplace_back(std::make_unique<Component>());
+      thread->clocks = device.clocks;
+      thread->primary = threads.size() == 1;
+      thread->frame = device.frequency / 60.0;
+      thread->create(device.frequency, std::bind_front(&Component::main, thread.get()));
+      Component::threads.push_back(thread.get());
+    }
+    scheduler.power(*threads[0]);
+
+    switches = 0;
+    previous = nullptr;
+    auto start = chrono::nanosecond();
+    for(u32 frame : range(frames)) scheduler.enter();
+    auto elapsed = chrono::nanosecond() - start;
+
+    print(pad(profile.name, -24L), " ",
+      pad(threads.size(), 2L), " threads ",
+      pad(passives.size(), 1L), " passive  ",
+      pad(switches / frames, 8L), " switches/frame  ",
+      pad(elapsed / frames / 1000, 6L), " us/frame  ",
+      pad(string{(f64)elapsed / max(1ull, switches)}.slice(0, 5), 6L), " ns/switch\n");
+
+    for(auto& thread : threads) thread->destroy();
+    for(auto& passive : passives) passive->destroy();
+    scheduler.reset();
+  }
+}
+
+//the cost of a raw libco context switch, with no scheduler involvement.
+auto benchmarkSwitch() -> void {
+  static cothread_t host;
+  static cothread_t peer;
+  static u64 count = 0;
+  host = co_active();
+  peer = co_create(64_KiB, [] { while(true) { count++; co_switch(host); } });
+
+  static constexpr u32 Iterations = 10'000'000;
+  auto start = chrono::nanosecond();
+  for(u32 n : range(Iterations)) co_switch(peer);
+  auto elapsed = chrono::nanosecond() - start;
+  co_delete(peer);
+
+  print("co_switch: ", string{(f64)elapsed / (Iterations * 2)}.slice(0, 5), " ns\n");
+}
+
+auto nall::main(Arguments arguments) -> void {
+  using namespace ares::Benchmark;
+  ares::Platform platform;
+  ares::platform = &platform;
+
+  u32 frames = 60;
+  if(arguments) frames = arguments.take().natural();
+
+  benchmarkSwitch();
+
+  std::vector<Profile> profiles = {
+    {"Master System", {
+      {  3'579'545.0,   4, false},  //CPU
+      { 10'738'635.0, 342, false},  //VDP
+      {    223'722.0,   1, false},  //PSG
+    }},
+    {"Master System (passive)", {
+      {  3'579'545.0,   4, false},  //CPU
+      { 10'738'635.0, 342, false},  //VDP
+      {    223'722.0,   1, true },  //PSG
+    }},
+    {"Super Famicom + SA-1", {
+      { 21'477'272.0,   6, false},  //CPU
+      { 24'576'000.0,  24, false},  //SMP
+      { 24'576'000.0,  48, false},  //DSP
+      { 21'477'272.0, 512, false},  //PPU
+      { 21'477'272.0,   6, false},  //SA-1
+    }},
+    {"Mega CD + 32X", {
+      { 53'693'175.0,  28, false},  //68K
+      { 53'693'175.0,  60, false},  //Z80
+      { 53'693'175.0, 336, false},  //VDP
+      { 53'693'175.0, 144, false},  //OPN2
+      { 53'693'175.0, 240, false},  //PSG
+      { 50'000'000.0,  16, false},  //MCD 68K
+      { 50'000'000.0, 384, false},  //CDD/CDC/PCM
+      { 23'011'361.0,   2, false},  //SH2 master
+      { 23'011'361.0,   2, false},  //SH2 slave
+      { 23'011'361.0, 512, false},  //PWM
+    }},
+    {"Nintendo 64", {
+      { 93'750'000.0,  16, false},  //CPU
+      { 62'500'000.0,  16, false},  //RSP
+      { 62'500'000.0, 128, false},  //RDP
+      { 93'750'000.0, 512, false},  //AI
+      { 93'750'000.0, 1024, false}, //VI
+      { 93'750'000.0, 256, false},  //PI
+      { 93'750'000.0, 256, false},  //SI
+    }},
+  };
+
+  for(auto& profile : profiles) run(profile, frames);
+}
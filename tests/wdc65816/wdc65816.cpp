@@ -0,0 +1,251 @@
+#include <nall/nall.hpp>
+using namespace nall;
+
+#include <nall/main.hpp>
+
+#include <ares/ares.hpp>
+#include <component/processor/wdc65816/wdc65816.hpp>
+
+//runs random programs on the interpreter and on the recompiler, and checks that
+//both leave the same registers, memory and clock.
+//programs run from ROM: the recompiler only notices code modified through a runtime
+//address when the block is next entered, which is a documented difference.
+
+struct WDC65816 : ares::WDC65816 {
+  using Recompiler = ares::WDC65816::Recompiler;
+
+  //the address space is split by the upper two bank bits into:
+  //RAM (slow), ROM (fast), RAM (fast), and memory that is only reachable through the bus.
+  enum Type : u32 { SlowRAM, ROM, FastRAM, Bus };
+  static auto type(n24 address) -> Type { return (Type)(address >> 22); }
+  static auto wait(n24 address) -> u32 {
+    static constexpr u32 clocks[] = {8, 6, 6, 12};
+    return clocks[type(address)];
+  }
+
+  u64 clock = 0;
+  bool recompile = false;
+  std::vector<u8> ram = std::vector<u8>(256_KiB);
+  std::vector<u8> rom = std::vector<u8>(128_KiB);
+  std::vector<u8> bus = std::vector<u8>(128_KiB);
+
+  auto memory(n24 address) -> u8& {
+    if(type(address) == ROM) return rom[address & rom.size() - 1];
+    if(type(address) == Bus) return bus[address & bus.size() - 1];
+    return ram[address & ram.size() - 1];
+  }
+
+  auto idle() -> void override { clock += 6; }
+  auto idleBranch() -> void override { if(r.pc.d & 1) idleJump(); }
+  auto idleJump() -> void override { clock += 2; }
+
+  auto read(n24 address) -> n8 override {
+    clock += wait(address);
+    return memory(address);
+  }
+
+  auto write(n24 address, n8 data) -> void override {
+    clock += wait(address);
+    if(type(address) != ROM) memory(address) = data;
+  }
+
+  auto lastCycle() -> void override {}
+  auto interruptPending() const -> bool override { return false; }
+  auto synchronizing() const -> bool override { return r.stp; }  //leaves STP at once
+  auto stepBlock(u32 clocks, u32 cycles) -> void override { clock += clocks; }
+
+  auto power() -> void {
+    ares::WDC65816::power();
+    if constexpr(Accuracy::Recompiler) {
+      recompiler.idleClocks = 6;
+      for(u32 index : range(recompiler.pages.size())) {
+        auto& page = recompiler.pages[index];
+        n24 address = index << Recompiler::PageBits;
+        page.read = type(address) != Bus ? (n8*)&memory(address) : nullptr;
+        page.write = type(address) != Bus && type(address) != ROM ? (n8*)&memory(address) : nullptr;
+        page.clocks = wait(address);
+        page.constant = type(address) == ROM;
+      }
+    }
+  }
+
+  auto main() -> void {
+    if(recompile) {
+      if(auto block = recompiler.block()) return block->execute(*this);
+    }
+    instruction();
+  }
+};
+
+static u32 seed = 1;
+static auto next() -> u32 { seed = seed * 1103515245 + 12345; return seed >> 8; }
+
+//instructions that would leave the program, wait, or move blocks
+static auto excluded(n8 opcode) -> bool {
+  switch(opcode) {
+  case 0x00: case 0x02: case 0x20: case 0x22: case 0x28: case 0x40: case 0x44: case 0x54:
+  case 0x5c: case 0x60: case 0x6b: case 0x6c: case 0x7c: case 0xcb: case 0xdb: case 0xdc: case 0xfc:
+    return true;
+  }
+  return false;
+}
+
+static auto branch(n8 opcode) -> bool {
+  return (opcode & 0x1f) == 0x10 || opcode == 0x80 || opcode == 0x82 || opcode == 0x4c;
+}
+
+//builds a forward-only program at origin, ending in STP.
+//branches and jumps never skip over an instruction that changes E, M or X,
+//so that the operand sizes chosen here are the ones the processor sees.
+static auto generate(u16 origin, u32 count, bool e, bool m, bool x) -> std::vector<u8> {
+  struct Instruction {
+    std::vector<u8> bytes;
+    bool mode = false;  //changes E, M or X
+  };
+  std::vector<Instruction> program;
+  while(program.size() < count) {
+    Instruction instruction;
+    n8 opcode;
+    do opcode = next(); while(excluded(opcode));
+    if(opcode == 0xfb) {
+      //XCE: set or clear the carry first, so that the new E flag is known.
+      //both are one unit here, so that no branch can land between them.
+      bool carry = next() & 1;
+      instruction.bytes.push_back(carry ? 0x38 : 0x18);
+      if(carry) m = 1, x = 1;
+      e = carry;
+      instruction.mode = true;
+    }
+    u32 length = WDC65816::Recompiler::length(opcode, m, x);
+    u32 start = instruction.bytes.size();
+    instruction.bytes.push_back(opcode);
+    for(u32 n = 1; n < length; n++) instruction.bytes.push_back(next());
+    if(opcode == 0xc2 || opcode == 0xe2) {
+      n8 bits = instruction.bytes[start + 1];
+      bool set = opcode == 0xe2;
+      if(bits.bit(5)) m = e | set;
+      if(bits.bit(4)) x = e | set;
+      instruction.mode = true;
+    }
+    program.push_back(instruction);
+  }
+
+  std::vector<u32> addresses;
+  u32 address = origin;
+  for(auto& instruction : program) addresses.push_back(address), address += instruction.bytes.size();
+  addresses.push_back(address);
+
+  for(u32 index : range(program.size())) {
+    auto& bytes = program[index].bytes;
+    if(!branch(bytes[0])) continue;
+    u32 last = index + 1;
+    while(last < program.size() && last < index + 8 && !program[last].mode) last++;
+    u32 target = addresses[index + 1 + next() % (last - index)];
+    u32 displacement = target - addresses[index + 1];
+    if(bytes[0] == 0x4c) bytes[1] = target, bytes[2] = target >> 8;
+    else if(bytes[0] == 0x82) bytes[1] = displacement, bytes[2] = displacement >> 8;
+    else bytes[1] = displacement;
+  }
+
+  std::vector<u8> output;
+  for(auto& instruction : program) output.insert(output.end(), instruction.bytes.begin(), instruction.bytes.end());
+  output.push_back(0xdb);  //stp
+  return output;
+}
+
+struct Test {
+  u32 seed;
+  u32 count;  //instructions in the program
+  u16 origin;
+  u8  bank;
+  bool e;
+};
+
+//random memory and registers; the program is placed in the first ROM bank
+static auto setup(WDC65816& cpu, const Test& test) -> void {
+  seed = test.seed;
+  for(auto& data : cpu.ram) data = next();
+  for(auto& data : cpu.rom) data = next();
+  for(auto& data : cpu.bus) data = next();
+
+  auto& r = cpu.r;
+  r.a = next();
+  r.x = next();
+  r.y = next();
+  r.s = next();
+  r.d = next() & 3 ? next() & 0xff00 : next();
+  r.b = next();
+  r.p = next();
+  r.e = test.e;
+  if(r.e) r.p.m = 1, r.p.x = 1, r.s.h = 0x01;
+  if(r.p.x) r.x.h = 0, r.y.h = 0;
+  r.wai = 0;
+  r.stp = 0;
+
+  auto program = generate(test.origin, test.count, r.e, r.p.m, r.p.x);
+  for(u32 n : range(program.size())) cpu.memory(test.bank << 16 | test.origin + n & 0xffff) = program[n];
+  r.pc.d = test.bank << 16 | test.origin;
+  cpu.clock = 0;
+}
+
+static auto run(WDC65816& cpu) -> void {
+  for(u32 steps = 0; !cpu.r.stp && steps < 1'000'000; steps++) cpu.main();
+}
+
+static auto compare(const WDC65816& x, const WDC65816& y) -> string {
+  string s;
+  auto& a = x.r;
+  auto& b = y.r;
+  if(a.pc.d != b.pc.d) s.append("pc ", hex(a.pc.d, 6L), " != ", hex(b.pc.d, 6L), "; ");
+  if(a.a.w != b.a.w) s.append("a ", hex(a.a.w, 4L), " != ", hex(b.a.w, 4L), "; ");
+  if(a.x.w != b.x.w) s.append("x ", hex(a.x.w, 4L), " != ", hex(b.x.w, 4L), "; ");
+  if(a.y.w != b.y.w) s.append("y ", hex(a.y.w, 4L), " != ", hex(b.y.w, 4L), "; ");
+  if(a.s.w != b.s.w) s.append("s ", hex(a.s.w, 4L), " != ", hex(b.s.w, 4L), "; ");
+  if(a.d.w != b.d.w) s.append("d ", hex(a.d.w, 4L), " != ", hex(b.d.w, 4L), "; ");
+  if(a.b != b.b) s.append("b ", hex(a.b, 2L), " != ", hex(b.b, 2L), "; ");
+  if((u32)a.p != (u32)b.p || a.e != b.e) s.append("p ", hex((u32)a.p, 2L), " != ", hex((u32)b.p, 2L), "; ");
+  if(x.clock != y.clock) s.append("clock ", x.clock, " != ", y.clock, "; ");
+  if(x.ram != y.ram) s.append("ram; ");
+  if(x.bus != y.bus) s.append("bus; ");
+  return s;
+}
+
+auto nall::main(Arguments arguments) -> void {
+  if constexpr(!ares::WDC65816::Accuracy::Recompiler) {
+    print("the WDC65816 recompiler is not supported on this architecture\n");
+    return;
+  }
+
+  u32 count = 1000;
+  if(arguments) count = arguments.take().natural();
+
+  auto interpreter = std::make_unique<WDC65816>();
+  auto recompiler = std::make_unique<WDC65816>();
+  recompiler->recompile = true;
+  u32 failures = 0;
+  for(u32 index : range(count)) {
+    Test test;
+    test.seed = index + 1;
+    test.count = 20 + index % 200;
+    test.origin = 0x8000 + index % 61 * 0x100 + index % 13;
+    test.bank = 0x40 + index % 4;
+    test.e = index & 1;
+
+    interpreter->power();
+    recompiler->power();
+    //the second pass runs the program again from the blocks compiled by the first
+    for(u32 pass : range(2)) {
+      setup(*interpreter, test);
+      setup(*recompiler, test);
+      run(*interpreter);
+      run(*recompiler);
+      if(auto difference = compare(*interpreter, *recompiler)) {
+        if(failures++ < 10) print("test ", index, " pass ", pass, ": ", difference, "\n");
+        break;
+      }
+    }
+  }
+
+  print(count - failures, " of ", count, " programs matched\n");
+  if(failures) exit(EXIT_FAILURE);
+}
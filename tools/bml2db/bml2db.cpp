@@ -0,0 +1,32 @@
+#include <nall/nall.hpp>
+using namespace nall;
+
+#include <mia/medium/game-database.hpp>
+
+//compiles a mia game database (Database/<System>.bml) into its indexed binary form.
+//the result is loaded in place of the markup when it was compiled from an identical file.
+
+//errors exit with a failure status, so that the build step that runs this tool fails with it.
+template<typename... P> [[noreturn]] auto fail(P&&... p) -> void {
+  print(stderr, std::forward<P>(p)...);
+  exit(EXIT_FAILURE);
+}
+
+#include <nall/main.hpp>
+auto nall::main(Arguments arguments) -> void {
+  if(arguments.size() != 2) fail("usage: bml2db database.bml database.db\n");
+
+  string markupName = arguments.take();
+  string outputName = arguments.take();
+  if(!markupName.endsWith(".bml")) fail("error: arguments in incorrect order\n");
+
+  string markup = string::read(markupName);
+  if(!markup) fail("error: unable to read ", markupName, "\n");
+
+  auto output = GameDatabase::compile(markup);
+  if(!file::write(outputName, output)) {
+    //a partial file would look up to date to the build
+    file::remove(outputName);
+    fail("error: unable to write ", outputName, "\n");
+  }
+}
@@ -0,0 +1,107 @@
+#include <ares/ares.hpp>
+#if defined(CORE_N64)
+  #include <n64/n64.hpp>
+#endif
+#if defined(CORE_PS1)
+  #include <ps1/ps1.hpp>
+#endif
+using namespace nall;
+
+//prints a binary instruction trace, as written by the trace logger, in the same text form as a regular trace log.
+//instructions are disassembled with the cores' own disassemblers; register values are not available offline,
+//so each line shows the registers written since the previous record instead.
+
+using Instruction = ares::Core::Debugger::Tracer::Instruction;
+
+static const char* mipsRegisterNames[32] = {
+  "0",  "at", "v0", "v1", "a0", "a1", "a2", "a3",
+  "t0", "t1", "t2", "t3", "t4", "t5", "t6", "t7",
+  "s0", "s1", "s2", "s3", "s4", "s5", "s6", "s7",
+  "t8", "t9", "k0", "k1", "gp", "sp", "s8", "ra",
+};
+
+struct Disassembler {
+  std::function<string (u64 address, u32 opcode)> disassemble;
+  const char** registerNames = nullptr;
+};
+
+static auto disassembler(const string& architecture) -> maybe<Disassembler> {
+  #if defined(CORE_N64)
+  if(architecture == "VR4300") {
+    auto& cpu = ares::Nintendo64::cpu;
+    cpu.disassembler.showColors = 0;
+    cpu.disassembler.showValues = 0;
+    return Disassembler{[&](u64 address, u32 opcode) { return cpu.disassembler.disassemble(address, opcode); }, mipsRegisterNames};
+  }
+  #endif
+  #if defined(CORE_PS1)
+  if(architecture == "R3000A") {
+    auto& cpu = ares::PlayStation::cpu;
+    cpu.disassembler.showColors = 0;
+    cpu.disassembler.showValues = 0;
+    return Disassembler{[&](u64 address, u32 opcode) { return cpu.disassembler.disassemble(address, opcode); }, mipsRegisterNames};
+  }
+  #endif
+  return nothing;
+}
+
+#include <nall/main.hpp>
+auto nall::main(Arguments arguments) -> void {
+  if(arguments.size() < 1 || arguments.size() > 2) return print("usage: tracedump input.trace [output.log]\n");
+
+  string inputName = arguments.take();
+  string outputName = arguments.take();
+
+  file_buffer input;
+  if(!input.open(inputName, file::mode::read)) return print("error: unable to read ", inputName, "\n");
+
+  Instruction::FileHeader header{};
+  if(input.size() < sizeof(header)) return print("error: ", inputName, " is not a binary trace\n");
+  input.read({(u8*)&header, sizeof(header)});
+  if(memory::compare(header.signature, Instruction::FileSignature, sizeof(header.signature))) {
+    return print("error: ", inputName, " is not a binary trace\n");
+  }
+  if(header.recordSize != sizeof(Instruction::Record)) return print("error: unsupported record size\n");
+
+  string architecture = slice(header.architecture, 0, strnlen(header.architecture, sizeof(header.architecture)));
+  string component = slice(header.component, 0, strnlen(header.component, sizeof(header.component)));
+  auto disassembler = ::disassembler(architecture);
+  if(!disassembler) return print("error: no disassembler for architecture \"", architecture, "\"\n");
+
+  file_buffer output;
+  if(outputName && !output.open(outputName, file::mode::write)) return print("error: unable to write ", outputName, "\n");
+
+  u32 addressDigits = (header.addressBits + 3) >> 2;
+  u32 valueDigits = header.addressBits > 32 ? 16 : 8;
+  //continuation records add registers to the line of the instruction before them
+  string line;
+  auto flush = [&] {
+    if(!line) return;
+    line.append("\n");
+    if(output) output.writes(line);
+    else print(line);
+    line = {};
+  };
+
+  std::vector<Instruction::Record> records(64_KiB);
+  u64 remaining = (input.size() - sizeof(header)) / sizeof(Instruction::Record);
+  while(remaining) {
+    u64 count = min<u64>(remaining, records.size());
+    input.read({(u8*)records.data(), count * sizeof(Instruction::Record)});
+    remaining -= count;
+
+    for(auto& record : std::span{records.data(), count}) {
+      if(!(record.flags & Instruction::Continuation)) {
+        flush();
+        line = {
+          component, "  ",
+          hex(record.address, addressDigits), "  ",
+          disassembler->disassemble(record.address, record.opcode), "  ",
+          "[", record.clock, "]"
+        };
+      }
+      if(record.index < 32) line.append("  ", disassembler->registerNames[record.index], "=", hex(record.value, valueDigits));
+    }
+  }
+  flush();
+}